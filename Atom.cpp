@@ -12,6 +12,16 @@ void Atom::SetAtomName(QString atomName)
     m_AtomName = atomName;
 }
 
+int Atom::GetAtomNumber()
+{
+    return m_AtomNumber;
+}
+
+void Atom::SetAtomNumber(int atomNumber)
+{
+    m_AtomNumber = atomNumber;
+}
+
 QString Atom::GetParentResidue()
 {
     return m_ParentResidue;
@@ -32,6 +42,36 @@ void Atom::setParentResidueID(int parentResidueID)
     m_ParentResidueID = parentResidueID;
 }
 
+QVector<QVector3D>& Atom::GetAlignedTrajectoryRef()
+{
+    return m_AlignedTrajectory;
+}
+
+QVector<float>& Atom::GetDiffusionRef()
+{
+    return m_Diffusion;
+}
+
+QVector<float>& Atom::GetDiscreteCurvatureRef()
+{
+    return m_DiscreteCurvature;
+}
+
+QVector<float>& Atom::GetFluctuationRef()
+{
+    return m_Fluctuation;
+}
+
+QVector<float>& Atom::GetMeanSquareDisplacementRef()
+{
+    return m_MeanSquareDisplacement;
+}
+
+QVector<float>& Atom::GetModeAmplitudeRef()
+{
+    return m_ModeAmplitude;
+}
+
 QVector<float>& Atom::GetPathCurvatureRef()
 {
     return m_PathCurvature;
@@ -161,6 +201,12 @@ void Atom::CalculateVelocity()
     GetVelocityRef()[0] = GetVelocityRef()[1];
 }
 
+bool Atom::PathLengthLessThan(Atom* atom1, Atom* atom2)
+{
+    return atom1->GetPathLengthRef().last()
+         < atom2->GetPathLengthRef().last();
+}
+
 void Atom::PrintAtom()
 {
     QTextStream* out = new QTextStream(stdout, QIODevice::WriteOnly);
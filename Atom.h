@@ -29,6 +29,19 @@ public:
      */
     void SetAtomName(QString atomName);
 
+    /**
+     * @brief Getter for the Atom number.
+     * @return The line of the .gro file for this Atom, counting from 1.
+     */
+    int GetAtomNumber();
+
+    /**
+     * @brief Setter for the Atom number.
+     * @param atomNumber The line of the .gro file for this Atom, counting
+     * from 1.
+     */
+    void SetAtomNumber(int atomNumber);
+
     /**
      * @brief Getter for the name of the parent Residue of the Atom.
      * @return A String containing the name of the parent Residue.
@@ -46,7 +59,52 @@ public:
      * @return The ID of the Residue to which this Atom belongs.
      */
     int GetParentResidueID();
-    
+
+    /**
+     * @brief Getter for the aligned trajectory vector for this Atom.
+     * @return A QVector containing the 3D coordinates of the Atom at each
+     * time step once each frame has been fitted onto the reference frame,
+     * or an empty QVector if the frames have not been aligned.
+     */
+    QVector<QVector3D>& GetAlignedTrajectoryRef();
+
+    /**
+     * @brief Getter for the diffusion coefficient of this Atom.
+     * @return A QVector holding the diffusion coefficient of the Atom over
+     * the whole path as a single float value, in nm^2/ps, or an empty
+     * QVector if it has not been calculated.
+     */
+    QVector<float>& GetDiffusionRef();
+
+    /**
+     * @brief Getter for the discrete curvature vector for this Atom.
+     * @return A QVector containing the Menger curvature of the path at each
+     * time step as a float value, in inverse nm.
+     */
+    QVector<float>& GetDiscreteCurvatureRef();
+
+    /**
+     * @brief Getter for the root mean square fluctuation of this Atom.
+     * @return A QVector holding the RMSF of the Atom about its mean position
+     * once the frames have been fitted, as a single float value in nm, or
+     * an empty QVector if it has not been calculated.
+     */
+    QVector<float>& GetFluctuationRef();
+
+    /**
+     * @brief Getter for the mean square displacement vector for this Atom.
+     * @return A QVector containing the mean square displacement of the Atom
+     * at each lag, in frames, as a float value in nm^2.
+     */
+    QVector<float>& GetMeanSquareDisplacementRef();
+
+    /**
+     * @brief Getter for the amplitude of this Atom in a principal component.
+     * @return A QVector holding the root mean square displacement of the
+     * Atom along the component shown, as a single float value in nm, or an
+     * empty QVector if no components have been found.
+     */
+    QVector<float>& GetModeAmplitudeRef();
 
     /**
      * @brief Getter for the path curvature vector for this Atom.
@@ -124,6 +182,15 @@ public:
      */
     void CalculateVelocity();
 
+    /**
+     * @brief Orders atoms by their total path length, shortest first. The path
+     * length of both atoms must already have been calculated.
+     * @param atom1 The first Atom to be compared.
+     * @param atom2 The second Atom to be compared.
+     * @return true if @e atom1 has a shorter total path length than @e atom2.
+     */
+    static bool PathLengthLessThan(Atom* atom1, Atom* atom2);
+
     /**
      * @brief Prints out the information stored in the Atom object.
      */
@@ -160,6 +227,11 @@ public:
     static const int RESIDUE_NAME_START = 5;
 
 private:
+    /**
+     * @brief Residue sets the identity of the centroid pseudo-Atom it owns.
+     */
+    friend class Residue;
+
     /**
      * @brief Setter for the ID of the Residue to which this Atom belongs.
      * @param parentResidueID The ID of the Residue to which this Atom belongs.
@@ -201,11 +273,51 @@ private:
      */
     void setVelocity(QVector<float> velocity);
 
+    /**
+     * @brief A QVector containing the 3D position of the Atom at each time
+     * step once each frame has been fitted onto the reference frame.
+     */
+    QVector<QVector3D> m_AlignedTrajectory;
+
     /**
      * @brief m_AtomName The name of the Atom.
      */
     QString m_AtomName;
 
+    /**
+     * @brief m_AtomNumber The line of the .gro file for the Atom, counting
+     * from 1.
+     */
+    int m_AtomNumber = 0;
+
+    /**
+     * @brief A QVector holding the diffusion coefficient of the Atom.
+     */
+    QVector<float> m_Diffusion;
+
+    /**
+     * @brief A QVector containing the discrete curvature of the path for the
+     * Atom at each time step.
+     */
+    QVector<float> m_DiscreteCurvature;
+
+    /**
+     * @brief A QVector holding the root mean square fluctuation of the Atom.
+     */
+    QVector<float> m_Fluctuation;
+
+    /**
+     * @brief A QVector containing the mean square displacement of the Atom
+     * at each lag.
+     */
+    QVector<float> m_MeanSquareDisplacement;
+
+    /**
+     * @brief A QVector holding the amplitude of the Atom in a principal
+     * component.
+     */
+    QVector<float> m_ModeAmplitude;
+
     /**
      * @brief The name of the Residue to which this Atom belongs.
      */
@@ -0,0 +1,148 @@
+#include "AtomSelection.h"
+#include <QRegExp>
+
+bool AtomSelection::SetExpression(const QString& expression)
+{
+    SelectionExpression check;
+    if (!check.Compile(expression))
+    {
+        m_Error = check.GetError();
+        return false;
+    }
+    QString previous = m_Expression;
+    m_Expression = check.IsEmpty() ? QString() : expression;
+    if (!compile())
+    {
+        m_Expression = previous;
+        return false;
+    }
+    return true;
+}
+
+QString AtomSelection::GetError() const
+{
+    return m_Error;
+}
+
+bool AtomSelection::SetResidueNames(const QString& names)
+{
+    QString previous = m_ResidueNameTerm;
+    m_ResidueNameTerm = listTerm("resname", names);
+    if (!compile())
+    {
+        m_ResidueNameTerm = previous;
+        return false;
+    }
+    return true;
+}
+
+bool AtomSelection::SetAtomNames(const QString& names)
+{
+    QString previous = m_AtomNameTerm;
+    m_AtomNameTerm = listTerm("name", names);
+    if (!compile())
+    {
+        m_AtomNameTerm = previous;
+        return false;
+    }
+    return true;
+}
+
+bool AtomSelection::SetAtomNumbers(const QString& ranges)
+{
+    QStringList items = ranges.split(QRegExp("[,\\s]+"), QString::SkipEmptyParts);
+    for (int i = 0; i < items.length(); ++i)
+    {
+        QString item = items[i];
+        if (item.startsWith('!'))
+        {
+            item.remove(0, 1);
+        }
+        QStringList bounds = item.split('-');
+        if (bounds.length() > 2)
+        {
+            return false;
+        }
+        bool firstOk;
+        bool lastOk;
+        int first = bounds.first().toInt(&firstOk);
+        int last = bounds.last().toInt(&lastOk);
+        if (!firstOk || !lastOk || first < 1 || last < first)
+        {
+            return false;
+        }
+    }
+    QString previous = m_AtomNumberTerm;
+    m_AtomNumberTerm = listTerm("index", ranges);
+    if (!compile())
+    {
+        m_AtomNumberTerm = previous;
+        return false;
+    }
+    return true;
+}
+
+bool AtomSelection::IsEmpty() const
+{
+    return m_Compiled.IsEmpty();
+}
+
+Bitset AtomSelection::Select(const AtomTable& table) const
+{
+    return m_Compiled.Evaluate(table);
+}
+
+QString AtomSelection::listTerm(const QString& keyword, const QString& list)
+{
+    QStringList included;
+    QStringList excluded;
+    QStringList items = list.split(QRegExp("[,\\s]+"), QString::SkipEmptyParts);
+    for (int i = 0; i < items.length(); ++i)
+    {
+        if (items[i] == "!")
+        {
+            continue;
+        }
+        else if (items[i].startsWith('!'))
+        {
+            excluded.append(items[i].mid(1));
+        }
+        else
+        {
+            included.append(items[i]);
+        }
+    }
+
+    QStringList terms;
+    if (!included.isEmpty())
+    {
+        terms.append(keyword + " " + included.join(" "));
+    }
+    if (!excluded.isEmpty())
+    {
+        terms.append("not " + keyword + " " + excluded.join(" "));
+    }
+    return terms.join(" and ");
+}
+
+bool AtomSelection::compile()
+{
+    QStringList terms;
+    QStringList parts = QStringList() << m_Expression << m_ResidueNameTerm
+                                      << m_AtomNameTerm << m_AtomNumberTerm;
+    for (int i = 0; i < parts.length(); ++i)
+    {
+        if (!parts[i].isEmpty())
+        {
+            terms.append("(" + parts[i] + ")");
+        }
+    }
+    // The compiled expression is left unchanged if the terms are invalid.
+    if (!m_Compiled.Compile(terms.join(" and ")))
+    {
+        m_Error = m_Compiled.GetError();
+        return false;
+    }
+    m_Error.clear();
+    return true;
+}
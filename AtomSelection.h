@@ -0,0 +1,137 @@
+/**
+ * @file AtomSelection.h
+ * @date 19 Oct 2026
+ * @see FileReader.h
+ * @see SelectionExpression.h
+ * @brief This class chooses which atoms of a .gro file are loaded.
+ *
+ * Atoms can be chosen by a selection expression, by residue name, by atom
+ * name and by ranges of atom numbers, where atom numbers count the lines of
+ * the .gro file from 1. The names and numbers are each given as a list
+ * separated by commas or spaces, such as "PRO LEU" or "1-100,250". An item
+ * starting with '!' excludes the matching atoms instead, so "!SOL" chooses
+ * every residue other than water. An atom is chosen if it passes the
+ * expression and every list which has been set, and an empty list passes
+ * every atom. The lists are translated into one SelectionExpression, which
+ * is evaluated over the whole topology at once.
+ */
+
+#ifndef ATOMSELECTION_H
+#define ATOMSELECTION_H
+
+#include "AtomTable.h"
+#include "Bitset.h"
+#include "SelectionExpression.h"
+#include <QString>
+#include <QStringList>
+
+class AtomSelection
+{
+public:
+    /**
+     * @brief Sets the selection expression.
+     * @param expression The expression, or an empty string to choose every
+     * atom.
+     * @return true if the expression could be compiled, false otherwise, in
+     * which case the expression is left unchanged and GetError() gives the
+     * reason.
+     */
+    bool SetExpression(const QString& expression);
+
+    /**
+     * @brief Returns the reason the last expression or list could not be
+     * compiled.
+     * @return The error message.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Sets the residue names to choose.
+     * @param names The list of residue names.
+     * @return true if the list could be compiled, false otherwise, in which
+     * case the residue names are left unchanged and GetError() gives the
+     * reason.
+     */
+    bool SetResidueNames(const QString& names);
+
+    /**
+     * @brief Sets the atom names to choose.
+     * @param names The list of atom names.
+     * @return true if the list could be compiled, false otherwise, in which
+     * case the atom names are left unchanged and GetError() gives the
+     * reason.
+     */
+    bool SetAtomNames(const QString& names);
+
+    /**
+     * @brief Sets the atom numbers to choose.
+     * @param ranges The list of atom numbers and inclusive ranges of atom
+     * numbers, such as "1-100,250".
+     * @return true if the list could be parsed, false otherwise, in which
+     * case the atom numbers are left unchanged.
+     */
+    bool SetAtomNumbers(const QString& ranges);
+
+    /**
+     * @brief Returns whether the selection chooses every atom.
+     * @return true if neither an expression nor any list has been set,
+     * false otherwise.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Chooses atoms.
+     * @param table The atoms.
+     * @return A Bitset with one bit per atom of @e table, set for the chosen
+     * atoms.
+     */
+    Bitset Select(const AtomTable& table) const;
+
+private:
+    /**
+     * @brief Translates a list into an expression term.
+     * @param keyword The keyword of the term, such as "resname".
+     * @param list The list.
+     * @return The term, or an empty string if the list is empty.
+     */
+    static QString listTerm(const QString& keyword, const QString& list);
+
+    /**
+     * @brief Combines the expression and lists and compiles the result.
+     * @return true if the result compiled, false otherwise, in which case
+     * the previous result is kept and m_Error gives the reason.
+     */
+    bool compile();
+
+    /**
+     * @brief The term for the atom names.
+     */
+    QString m_AtomNameTerm;
+
+    /**
+     * @brief The term for the atom numbers.
+     */
+    QString m_AtomNumberTerm;
+
+    /**
+     * @brief The compiled expression and lists.
+     */
+    SelectionExpression m_Compiled;
+
+    /**
+     * @brief The reason the last expression or list could not be compiled.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The selection expression.
+     */
+    QString m_Expression;
+
+    /**
+     * @brief The term for the residue names.
+     */
+    QString m_ResidueNameTerm;
+};
+
+#endif // ATOMSELECTION_H
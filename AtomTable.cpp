@@ -0,0 +1,86 @@
+#include "AtomTable.h"
+
+AtomTable AtomTable::FromAtoms(const QVector<Atom*>& atoms)
+{
+    AtomTable table;
+    table.m_AtomNameIDs.reserve(atoms.length());
+    table.m_AtomNumbers.reserve(atoms.length());
+    table.m_ResidueIDs.reserve(atoms.length());
+    table.m_ResidueNameIDs.reserve(atoms.length());
+    for (int i = 0; i < atoms.length(); ++i)
+    {
+        table.Append(atoms[i]->GetParentResidue(),
+                     atoms[i]->GetAtomName(),
+                     atoms[i]->GetParentResidueID(),
+                     atoms[i]->GetAtomNumber());
+    }
+    return table;
+}
+
+void AtomTable::Append(const QString& residueName,
+                       const QString& atomName,
+                       int residueID,
+                       int atomNumber)
+{
+    m_ResidueNameIDs.append(intern(m_ResidueNames, residueName));
+    m_AtomNameIDs.append(intern(m_AtomNames, atomName));
+    m_ResidueIDs.append(residueID);
+    m_AtomNumbers.append(atomNumber);
+}
+
+int AtomTable::GetAtoms() const
+{
+    return m_AtomNumbers.length();
+}
+
+int AtomTable::FindResidueName(const QString& residueName) const
+{
+    return m_ResidueNames.value(residueName, -1);
+}
+
+int AtomTable::FindAtomName(const QString& atomName) const
+{
+    return m_AtomNames.value(atomName, -1);
+}
+
+int AtomTable::GetResidueNameCount() const
+{
+    return m_ResidueNames.size();
+}
+
+int AtomTable::GetAtomNameCount() const
+{
+    return m_AtomNames.size();
+}
+
+const QVector<int>& AtomTable::GetResidueNameIDs() const
+{
+    return m_ResidueNameIDs;
+}
+
+const QVector<int>& AtomTable::GetAtomNameIDs() const
+{
+    return m_AtomNameIDs;
+}
+
+const QVector<int>& AtomTable::GetResidueIDs() const
+{
+    return m_ResidueIDs;
+}
+
+const QVector<int>& AtomTable::GetAtomNumbers() const
+{
+    return m_AtomNumbers;
+}
+
+int AtomTable::intern(QHash<QString, int>& names, const QString& name)
+{
+    QHash<QString, int>::const_iterator found = names.constFind(name);
+    if (found != names.constEnd())
+    {
+        return found.value();
+    }
+    int id = names.size();
+    names.insert(name, id);
+    return id;
+}
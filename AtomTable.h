@@ -0,0 +1,140 @@
+/**
+ * @file AtomTable.h
+ * @date 19 Oct 2026
+ * @see SelectionExpression.h
+ * @brief This class stores the topology of a set of atoms as columns, for
+ * evaluating selections quickly.
+ *
+ * Each residue name and atom name is interned once and stored per atom as a
+ * small integer ID, alongside the residue ID and atom number. A selection
+ * then compares integers in contiguous arrays instead of strings in
+ * scattered Atom objects.
+ */
+
+#ifndef ATOMTABLE_H
+#define ATOMTABLE_H
+
+#include "Atom.h"
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+class AtomTable
+{
+public:
+    /**
+     * @brief Builds a table from a set of atoms, in the same order.
+     * @param atoms The atoms.
+     * @return The table.
+     */
+    static AtomTable FromAtoms(const QVector<Atom*>& atoms);
+
+    /**
+     * @brief Adds an atom to the end of the table.
+     * @param residueName The name of the atom's residue.
+     * @param atomName The name of the atom.
+     * @param residueID The ID of the atom's residue.
+     * @param atomNumber The number of the atom, counting .gro lines from 1.
+     */
+    void Append(const QString& residueName,
+                const QString& atomName,
+                int residueID,
+                int atomNumber);
+
+    /**
+     * @brief Returns the number of atoms in the table.
+     * @return The number of atoms.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the interned ID of a residue name.
+     * @param residueName The residue name.
+     * @return The ID, or -1 if no atom has this residue name.
+     */
+    int FindResidueName(const QString& residueName) const;
+
+    /**
+     * @brief Returns the interned ID of an atom name.
+     * @param atomName The atom name.
+     * @return The ID, or -1 if no atom has this name.
+     */
+    int FindAtomName(const QString& atomName) const;
+
+    /**
+     * @brief Returns the number of distinct residue names.
+     * @return The number of residue name IDs.
+     */
+    int GetResidueNameCount() const;
+
+    /**
+     * @brief Returns the number of distinct atom names.
+     * @return The number of atom name IDs.
+     */
+    int GetAtomNameCount() const;
+
+    /**
+     * @brief Returns the residue name ID of each atom.
+     * @return A QVector of IDs.
+     */
+    const QVector<int>& GetResidueNameIDs() const;
+
+    /**
+     * @brief Returns the atom name ID of each atom.
+     * @return A QVector of IDs.
+     */
+    const QVector<int>& GetAtomNameIDs() const;
+
+    /**
+     * @brief Returns the residue ID of each atom.
+     * @return A QVector of residue IDs.
+     */
+    const QVector<int>& GetResidueIDs() const;
+
+    /**
+     * @brief Returns the number of each atom.
+     * @return A QVector of atom numbers.
+     */
+    const QVector<int>& GetAtomNumbers() const;
+
+private:
+    /**
+     * @brief Returns the ID of a name, adding it if it is new.
+     * @param names The interned names.
+     * @param name The name.
+     * @return The ID.
+     */
+    static int intern(QHash<QString, int>& names, const QString& name);
+
+    /**
+     * @brief The atom name ID of each atom.
+     */
+    QVector<int> m_AtomNameIDs;
+
+    /**
+     * @brief The interned atom names.
+     */
+    QHash<QString, int> m_AtomNames;
+
+    /**
+     * @brief The number of each atom.
+     */
+    QVector<int> m_AtomNumbers;
+
+    /**
+     * @brief The residue ID of each atom.
+     */
+    QVector<int> m_ResidueIDs;
+
+    /**
+     * @brief The residue name ID of each atom.
+     */
+    QVector<int> m_ResidueNameIDs;
+
+    /**
+     * @brief The interned residue names.
+     */
+    QHash<QString, int> m_ResidueNames;
+};
+
+#endif // ATOMTABLE_H
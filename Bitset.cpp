@@ -0,0 +1,116 @@
+#include "Bitset.h"
+#include <QtAlgorithms>
+
+Bitset::Bitset(int size, bool value)
+    : m_Size(qMax(0, size)),
+      m_Words((m_Size + WORD_BITS - 1)/WORD_BITS, value ? ~(quint64)0 : 0)
+{
+    clearPadding();
+}
+
+int Bitset::Size() const
+{
+    return m_Size;
+}
+
+bool Bitset::Test(int index) const
+{
+    return (m_Words[index/WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+void Bitset::Set(int index, bool value)
+{
+    quint64 bit = (quint64)1 << (index % WORD_BITS);
+    if (value)
+    {
+        m_Words[index/WORD_BITS] |= bit;
+    }
+    else
+    {
+        m_Words[index/WORD_BITS] &= ~bit;
+    }
+}
+
+int Bitset::Count() const
+{
+    int count = 0;
+    for (int i = 0; i < m_Words.length(); ++i)
+    {
+        count += qPopulationCount(m_Words[i]);
+    }
+    return count;
+}
+
+QVector<int> Bitset::ToIndices() const
+{
+    QVector<int> indices;
+    indices.reserve(Count());
+    for (int i = 0; i < m_Words.length(); ++i)
+    {
+        quint64 word = m_Words[i];
+        while (word != 0)
+        {
+            indices.append(i*WORD_BITS + qCountTrailingZeroBits(word));
+            word &= word - 1;
+        }
+    }
+    return indices;
+}
+
+quint64* Bitset::Words()
+{
+    return m_Words.data();
+}
+
+const quint64* Bitset::Words() const
+{
+    return m_Words.constData();
+}
+
+int Bitset::WordCount() const
+{
+    return m_Words.length();
+}
+
+Bitset& Bitset::operator&=(const Bitset& other)
+{
+    for (int i = 0; i < m_Words.length(); ++i)
+    {
+        m_Words[i] &= other.m_Words[i];
+    }
+    return *this;
+}
+
+Bitset& Bitset::operator|=(const Bitset& other)
+{
+    for (int i = 0; i < m_Words.length(); ++i)
+    {
+        m_Words[i] |= other.m_Words[i];
+    }
+    return *this;
+}
+
+Bitset Bitset::operator~() const
+{
+    Bitset complement = *this;
+    for (int i = 0; i < complement.m_Words.length(); ++i)
+    {
+        complement.m_Words[i] = ~complement.m_Words[i];
+    }
+    complement.clearPadding();
+    return complement;
+}
+
+bool Bitset::operator==(const Bitset& other) const
+{
+    return m_Size == other.m_Size && m_Words == other.m_Words;
+}
+
+void Bitset::clearPadding()
+{
+    int used = m_Size % WORD_BITS;
+    if (used != 0)
+    {
+        m_Words.last() &= ((quint64)1 << used) - 1;
+    }
+}
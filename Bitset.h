@@ -0,0 +1,130 @@
+/**
+ * @file Bitset.h
+ * @date 19 Oct 2026
+ * @see SelectionExpression.h
+ * @brief This class stores one bit per atom, such as whether each atom is
+ * in a selection.
+ *
+ * The bits are packed 64 to a word, so combining two sets with and, or and
+ * not touches one word per 64 atoms. Any bits in the last word beyond the
+ * size of the set are kept clear, so counts and comparisons can work on
+ * whole words.
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <QVector>
+#include <QtGlobal>
+
+class Bitset
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param size The number of bits.
+     * @param value The value of every bit.
+     */
+    Bitset(int size = 0, bool value = false);
+
+    /**
+     * @brief Returns the number of bits.
+     * @return The number of bits.
+     */
+    int Size() const;
+
+    /**
+     * @brief Returns the value of a bit.
+     * @param index The index of the bit.
+     * @return true if the bit is set, false otherwise.
+     */
+    bool Test(int index) const;
+
+    /**
+     * @brief Sets the value of a bit.
+     * @param index The index of the bit.
+     * @param value The new value of the bit.
+     */
+    void Set(int index, bool value = true);
+
+    /**
+     * @brief Returns the number of set bits.
+     * @return The number of set bits.
+     */
+    int Count() const;
+
+    /**
+     * @brief Returns the indices of the set bits.
+     * @return The indices, in ascending order.
+     */
+    QVector<int> ToIndices() const;
+
+    /**
+     * @brief Returns the packed words of the set, for filling in bulk. Bits
+     * beyond the size of the set must be left clear.
+     * @return A pointer to the first word.
+     */
+    quint64* Words();
+
+    /**
+     * @brief Returns the packed words of the set.
+     * @return A pointer to the first word.
+     */
+    const quint64* Words() const;
+
+    /**
+     * @brief Returns the number of packed words.
+     * @return The number of words.
+     */
+    int WordCount() const;
+
+    /**
+     * @brief Clears every bit which is not set in @e other.
+     * @param other A Bitset of the same size.
+     * @return This Bitset.
+     */
+    Bitset& operator&=(const Bitset& other);
+
+    /**
+     * @brief Sets every bit which is set in @e other.
+     * @param other A Bitset of the same size.
+     * @return This Bitset.
+     */
+    Bitset& operator|=(const Bitset& other);
+
+    /**
+     * @brief Returns the complement of the set.
+     * @return A Bitset with every bit flipped.
+     */
+    Bitset operator~() const;
+
+    /**
+     * @brief Compares two sets.
+     * @param other Another Bitset.
+     * @return true if both have the same size and bits, false otherwise.
+     */
+    bool operator==(const Bitset& other) const;
+
+    /**
+     * @brief The number of bits in each packed word.
+     */
+    static const int WORD_BITS = 64;
+
+private:
+    /**
+     * @brief Clears the bits of the last word beyond the size of the set.
+     */
+    void clearPadding();
+
+    /**
+     * @brief The number of bits.
+     */
+    int m_Size;
+
+    /**
+     * @brief The bits, packed with bit i in bit i % 64 of word i / 64.
+     */
+    QVector<quint64> m_Words;
+};
+
+#endif // BITSET_H
@@ -0,0 +1,240 @@
+/**
+ * @file BoundedQueue.h
+ * @date 19 Oct 2026
+ * @brief Provides fixed capacity queues for passing work between the
+ * threads of a pipeline.
+ *
+ * Pushing to a full queue blocks until there is room, so a slow stage holds
+ * back the stages before it rather than letting work pile up in memory.
+ * BoundedQueue is first in, first out. ReorderQueue accepts items tagged
+ * with a sequence index in any order and hands them out in index order,
+ * for stages that must see items in sequence after a parallel stage.
+ */
+
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QQueue>
+#include <QWaitCondition>
+
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param capacity The largest number of items held at once.
+     */
+    BoundedQueue(int capacity)
+        : m_Capacity(qMax(1, capacity))
+    {
+    }
+
+    /**
+     * @brief Adds an item to the back of the queue, waiting while the queue
+     * is full.
+     * @param item The item to be added.
+     * @return true if the item was added, false if the queue has been closed.
+     */
+    bool Push(const T& item)
+    {
+        QMutexLocker locker(&m_Mutex);
+        while (m_Items.length() >= m_Capacity && !m_Closed)
+        {
+            m_NotFull.wait(&m_Mutex);
+        }
+        if (m_Closed)
+        {
+            return false;
+        }
+        m_Items.enqueue(item);
+        m_NotEmpty.wakeOne();
+        return true;
+    }
+
+    /**
+     * @brief Removes the item at the front of the queue, waiting while the
+     * queue is empty.
+     * @param item Set to the removed item.
+     * @return true if an item was removed, false if the queue has been
+     * closed and is empty.
+     */
+    bool Pop(T& item)
+    {
+        QMutexLocker locker(&m_Mutex);
+        while (m_Items.isEmpty() && !m_Closed)
+        {
+            m_NotEmpty.wait(&m_Mutex);
+        }
+        if (m_Items.isEmpty())
+        {
+            return false;
+        }
+        item = m_Items.dequeue();
+        m_NotFull.wakeOne();
+        return true;
+    }
+
+    /**
+     * @brief Closes the queue. No more items are accepted, items already in
+     * the queue can still be removed, and every waiting thread is woken.
+     */
+    void Close()
+    {
+        QMutexLocker locker(&m_Mutex);
+        m_Closed = true;
+        m_NotEmpty.wakeAll();
+        m_NotFull.wakeAll();
+    }
+
+private:
+    /**
+     * @brief The largest number of items held at once.
+     */
+    int m_Capacity;
+
+    /**
+     * @brief true once the queue has been closed.
+     */
+    bool m_Closed = false;
+
+    /**
+     * @brief The items in the queue.
+     */
+    QQueue<T> m_Items;
+
+    /**
+     * @brief Guards every member.
+     */
+    QMutex m_Mutex;
+
+    /**
+     * @brief Signalled when an item is added or the queue is closed.
+     */
+    QWaitCondition m_NotEmpty;
+
+    /**
+     * @brief Signalled when an item is removed or the queue is closed.
+     */
+    QWaitCondition m_NotFull;
+};
+
+template <typename T>
+class ReorderQueue
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param capacity The number of sequence indices, starting from the next
+     * one to be removed, that may be held at once.
+     */
+    ReorderQueue(int capacity)
+        : m_Capacity(qMax(1, capacity))
+    {
+    }
+
+    /**
+     * @brief Adds an item, waiting while its index is too far ahead of the
+     * next one to be removed.
+     * @param index The sequence index of the item. Every index from zero
+     * must be pushed exactly once.
+     * @param item The item to be added.
+     * @return true if the item was added, false if the queue has been closed.
+     */
+    bool Push(int index, const T& item)
+    {
+        QMutexLocker locker(&m_Mutex);
+        while (index >= m_Next + m_Capacity && !m_Closed)
+        {
+            m_Removed.wait(&m_Mutex);
+        }
+        if (m_Closed)
+        {
+            return false;
+        }
+        m_Items.insert(index, item);
+        if (index == m_Next)
+        {
+            m_Added.wakeAll();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the item with the next sequence index, waiting until it
+     * has been added.
+     * @param item Set to the removed item.
+     * @return true if an item was removed, false if the queue has been
+     * closed without the next item being added.
+     */
+    bool Pop(T& item)
+    {
+        QMutexLocker locker(&m_Mutex);
+        while (!m_Items.contains(m_Next) && !m_Closed)
+        {
+            m_Added.wait(&m_Mutex);
+        }
+        if (!m_Items.contains(m_Next))
+        {
+            return false;
+        }
+        item = m_Items.take(m_Next);
+        ++m_Next;
+        m_Removed.wakeAll();
+        return true;
+    }
+
+    /**
+     * @brief Closes the queue. No more items are accepted, items already in
+     * the queue can still be removed in order, and every waiting thread is
+     * woken.
+     */
+    void Close()
+    {
+        QMutexLocker locker(&m_Mutex);
+        m_Closed = true;
+        m_Added.wakeAll();
+        m_Removed.wakeAll();
+    }
+
+private:
+    /**
+     * @brief The number of sequence indices that may be held at once.
+     */
+    int m_Capacity;
+
+    /**
+     * @brief true once the queue has been closed.
+     */
+    bool m_Closed = false;
+
+    /**
+     * @brief The items in the queue, keyed by sequence index.
+     */
+    QMap<int, T> m_Items;
+
+    /**
+     * @brief The sequence index of the next item to be removed.
+     */
+    int m_Next = 0;
+
+    /**
+     * @brief Guards every member.
+     */
+    QMutex m_Mutex;
+
+    /**
+     * @brief Signalled when the next item is added or the queue is closed.
+     */
+    QWaitCondition m_Added;
+
+    /**
+     * @brief Signalled when an item is removed or the queue is closed.
+     */
+    QWaitCondition m_Removed;
+};
+
+#endif // BOUNDEDQUEUE_H
@@ -0,0 +1,163 @@
+#include "CellList.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <QtMath>
+
+bool CellList::Build(const QVector<Atom*>& atoms, int frame, const QVector3D& box,
+                     float cutoff)
+{
+    TRACE_SCOPE("CellList::Build");
+    if (cutoff <= 0 || 2*cutoff > qMin(box.x(), qMin(box.y(), box.z())))
+    {
+        return false;
+    }
+    m_Box = box;
+    m_Cutoff = cutoff;
+
+    int count = atoms.length();
+    QVector<QVector3D> wrapped(count);
+    QVector3D* wrappedData = wrapped.data();
+    Atom* const* atomData = atoms.constData();
+    Parallel::For(count, MIN_ATOMS_PER_THREAD,
+                  [this, atomData, wrappedData, frame](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            wrappedData[i] = wrap(atomData[i]->GetTrajectoryRef()[frame]);
+        }
+    });
+
+    // Cells narrower than the cutoff are never made, and sparse systems use
+    // wider cells so that there are not more cells than atoms.
+    float volume = box.x()*box.y()*box.z();
+    float cellSize = qMax(cutoff, (float)qPow(volume/qMax(1, count), 1.0/3));
+    m_Grid.SetCellSize(QVector3D(), box, cellSize);
+    m_Grid.Build(wrappedData, 0, count);
+
+    // Store the positions in cell order, so that the atoms searched together
+    // are read together.
+    m_Positions.resize(count);
+    QVector3D* positions = m_Positions.data();
+    const int* sorted = m_Grid.GetSortedItems().constData();
+    Parallel::For(count, MIN_ATOMS_PER_THREAD,
+                  [positions, sorted, wrappedData](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            positions[i] = wrappedData[sorted[i]];
+        }
+    });
+    return true;
+}
+
+int CellList::GetAtoms() const
+{
+    return m_Positions.length();
+}
+
+QVector3D CellList::GetBox() const
+{
+    return m_Box;
+}
+
+int CellList::GetCells() const
+{
+    return m_Grid.GetCells();
+}
+
+float CellList::GetCutoff() const
+{
+    return m_Cutoff;
+}
+
+void CellList::FindNeighbours(const QVector3D& point, float radius,
+                              QVector<int>& atoms) const
+{
+    atoms.clear();
+    if (m_Positions.isEmpty())
+    {
+        return;
+    }
+
+    QVector3D wrapped = wrap(point);
+    const int* sorted = m_Grid.GetSortedItems().constData();
+    float radiusSquared = radius*radius;
+    int neighbours[MAX_NEIGHBOUR_CELLS];
+    int count = neighbourCells(m_Grid.CellOf(wrapped), neighbours);
+    for (int n = 0; n < count; ++n)
+    {
+        int last = m_Grid.GetCellFirst(neighbours[n] + 1);
+        for (int i = m_Grid.GetCellFirst(neighbours[n]); i < last; ++i)
+        {
+            if (DistanceSquared(wrapped, m_Positions[i]) <= radiusSquared)
+            {
+                atoms.append(sorted[i]);
+            }
+        }
+    }
+}
+
+qint64 CellList::GetBytes() const
+{
+    return sizeof(QVector3D)*(qint64)m_Positions.capacity() + m_Grid.GetBytes();
+}
+
+int CellList::neighbourCells(int cell, int* cells) const
+{
+    // The cells around a cell along each axis, wrapping across the boundary.
+    // With fewer than three cells along an axis every cell is a neighbour,
+    // and is only listed once.
+    int around[3][3];
+    int aroundCount[3];
+    int index[3];
+    index[0] = cell % m_Grid.GetDimension(0);
+    index[1] = cell/m_Grid.GetDimension(0) % m_Grid.GetDimension(1);
+    index[2] = cell/(m_Grid.GetDimension(0)*m_Grid.GetDimension(1));
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        int dimension = m_Grid.GetDimension(axis);
+        if (dimension < 3)
+        {
+            aroundCount[axis] = dimension;
+            for (int i = 0; i < dimension; ++i)
+            {
+                around[axis][i] = i;
+            }
+        }
+        else
+        {
+            aroundCount[axis] = 3;
+            for (int i = 0; i < 3; ++i)
+            {
+                around[axis][i] = (index[axis] + i - 1 + dimension) % dimension;
+            }
+        }
+    }
+
+    int count = 0;
+    for (int z = 0; z < aroundCount[2]; ++z)
+    {
+        for (int y = 0; y < aroundCount[1]; ++y)
+        {
+            for (int x = 0; x < aroundCount[0]; ++x)
+            {
+                cells[count++] = (around[2][z]*m_Grid.GetDimension(1)
+                                  + around[1][y])*m_Grid.GetDimension(0)
+                        + around[0][x];
+            }
+        }
+    }
+    return count;
+}
+
+QVector3D CellList::wrap(const QVector3D& point) const
+{
+    QVector3D wrapped;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float position = point[axis] - m_Box[axis]*qFloor(point[axis]/m_Box[axis]);
+        // A position just below zero can round to the upper side.
+        wrapped[axis] = position < m_Box[axis] ? position : 0;
+    }
+    return wrapped;
+}
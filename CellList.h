@@ -0,0 +1,207 @@
+/**
+ * @file CellList.h
+ * @date 19 Oct 2026
+ * @see SpatialGrid.h
+ * @see FileReader.h
+ * @brief This class finds the atoms within a cutoff distance of each other
+ * at one frame, using the periodic boundary of the simulation box.
+ *
+ * The positions of the frame are wrapped into the box and sorted into cells
+ * at least as wide as the cutoff, so the neighbours of an atom can only be
+ * in its own cell or the 26 cells around it, counting cells across the
+ * boundary. The wrapped positions are stored cell by cell, so the atoms of a
+ * cell are contiguous in memory. Distances are measured to the nearest
+ * periodic image, which is why the cutoff may be at most half the shortest
+ * side of the box.
+ *
+ * Only rectangular boxes are supported, as the .xtc reader keeps only the
+ * diagonal of the box matrix.
+ */
+
+#ifndef CELLLIST_H
+#define CELLLIST_H
+
+#include "Atom.h"
+#include "SpatialGrid.h"
+#include <QVector>
+#include <QVector3D>
+
+class CellList
+{
+public:
+    /**
+     * @brief Sorts the positions of a set of atoms at a frame into cells,
+     * splitting the atoms across the global thread pool.
+     * @param atoms The atoms.
+     * @param frame The frame.
+     * @param box The sides of the periodic simulation box, in nm.
+     * @param cutoff The largest distance searched, in nm.
+     * @return true if the cell list was built, false if the cutoff is not
+     * positive or is more than half the shortest side of the box.
+     */
+    bool Build(const QVector<Atom*>& atoms, int frame, const QVector3D& box,
+               float cutoff);
+
+    /**
+     * @brief Returns the number of atoms.
+     * @return The number of atoms passed to the last Build().
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the sides of the simulation box.
+     * @return The box, in nm.
+     */
+    QVector3D GetBox() const;
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The number of cells.
+     */
+    int GetCells() const;
+
+    /**
+     * @brief Returns the largest distance which can be searched.
+     * @return The cutoff, in nm.
+     */
+    float GetCutoff() const;
+
+    /**
+     * @brief Finds the atoms within a distance of a point.
+     * @param point The point, which need not be inside the box.
+     * @param radius The distance, at most the cutoff.
+     * @param atoms Set to the indices of the atoms, in the vector passed to
+     * Build(), cell by cell.
+     */
+    void FindNeighbours(const QVector3D& point, float radius,
+                        QVector<int>& atoms) const;
+
+    /**
+     * @brief Calls a function for every pair of atoms within a distance of
+     * each other, visiting each pair from the cell of the atom stored first.
+     * Each pair is therefore visited once across all the cells, so the
+     * cells can be split across threads.
+     * @param firstCell The first cell.
+     * @param lastCell One past the last cell.
+     * @param radius The distance, at most the cutoff.
+     * @param function A callable taking (int first, int second,
+     * float distanceSquared), where @e first and @e second are indices in
+     * the vector passed to Build().
+     */
+    template <typename Function>
+    void ForEachPair(int firstCell, int lastCell, float radius,
+                     Function function) const;
+
+    /**
+     * @brief Returns the distance squared between two points inside the
+     * box, to the nearest periodic image.
+     * @param first The first point.
+     * @param second The second point.
+     * @return The distance squared, in nm^2.
+     */
+    float DistanceSquared(const QVector3D& first, const QVector3D& second) const;
+
+    /**
+     * @brief Returns the number of bytes held.
+     * @return The number of bytes.
+     */
+    qint64 GetBytes() const;
+
+    /**
+     * @brief The largest number of cells around and including a cell.
+     */
+    static const int MAX_NEIGHBOUR_CELLS = 27;
+
+private:
+    /**
+     * @brief Finds the cells around and including a cell, across the
+     * periodic boundary, each listed once.
+     * @param cell The cell.
+     * @param cells Set to the neighbouring cells.
+     * @return The number of neighbouring cells.
+     */
+    int neighbourCells(int cell, int* cells) const;
+
+    /**
+     * @brief Wraps a point into the box.
+     * @param point The point.
+     * @return The periodic image of the point inside the box.
+     */
+    QVector3D wrap(const QVector3D& point) const;
+
+    /**
+     * @brief The sides of the simulation box.
+     */
+    QVector3D m_Box;
+
+    /**
+     * @brief The largest distance which can be searched.
+     */
+    float m_Cutoff = 0;
+
+    /**
+     * @brief The cells, holding the atoms in cell order.
+     */
+    SpatialGrid m_Grid;
+
+    /**
+     * @brief The wrapped positions, cell by cell, in the order of
+     * SpatialGrid::GetSortedItems().
+     */
+    QVector<QVector3D> m_Positions;
+
+    /**
+     * @brief The smallest number of atoms worth handing to a thread.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 4096;
+};
+
+template <typename Function>
+void CellList::ForEachPair(int firstCell, int lastCell, float radius,
+                           Function function) const
+{
+    const int* atoms = m_Grid.GetSortedItems().constData();
+    const QVector3D* positions = m_Positions.constData();
+    float radiusSquared = radius*radius;
+    int neighbours[MAX_NEIGHBOUR_CELLS];
+    for (int cell = firstCell; cell < lastCell; ++cell)
+    {
+        int count = neighbourCells(cell, neighbours);
+        int first = m_Grid.GetCellFirst(cell);
+        int last = m_Grid.GetCellFirst(cell + 1);
+        for (int n = 0; n < count; ++n)
+        {
+            int neighbourFirst = m_Grid.GetCellFirst(neighbours[n]);
+            int neighbourLast = m_Grid.GetCellFirst(neighbours[n] + 1);
+            for (int i = first; i < last; ++i)
+            {
+                // Each pair is seen from the cells of both atoms, so only
+                // the visit from the atom stored first is kept.
+                for (int j = qMax(i + 1, neighbourFirst); j < neighbourLast; ++j)
+                {
+                    float distanceSquared = DistanceSquared(positions[i],
+                                                            positions[j]);
+                    if (distanceSquared <= radiusSquared)
+                    {
+                        function(atoms[i], atoms[j], distanceSquared);
+                    }
+                }
+            }
+        }
+    }
+}
+
+inline float CellList::DistanceSquared(const QVector3D& first,
+                                       const QVector3D& second) const
+{
+    float sum = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float delta = qAbs(first[axis] - second[axis]);
+        delta = qMin(delta, m_Box[axis] - delta);
+        sum += delta*delta;
+    }
+    return sum;
+}
+
+#endif // CELLLIST_H
@@ -0,0 +1,76 @@
+#include "ColourMapper.h"
+#include "Parallel.h"
+
+ColourMapper::ColourMapper()
+{
+    m_Lut.fill(0, LUT_SIZE*TUPLE_SIZE);
+}
+
+void ColourMapper::SetColourMap(const float* mapData, int mapLength)
+{
+    if (mapLength <= 0)
+    {
+        return;
+    }
+    for (int i = 0; i < LUT_SIZE; ++i)
+    {
+        int mapIndex = (int)((qint64)i*mapLength/LUT_SIZE);
+        for (int j = 0; j < TUPLE_SIZE; ++j)
+        {
+            m_Lut[i*TUPLE_SIZE + j] = mapData[mapIndex*TUPLE_SIZE + j];
+        }
+    }
+}
+
+void ColourMapper::SetRange(float min, float max)
+{
+    float range = max - min;
+    if (range == 0)
+    {
+        range = 1;
+    }
+    m_Min = min;
+    m_Scale = LUT_SIZE/range;
+}
+
+QVector3D ColourMapper::Colour(float value) const
+{
+    float colour[TUPLE_SIZE];
+    Map(&value, 1, colour);
+    return QVector3D(colour[0], colour[1], colour[2]);
+}
+
+void ColourMapper::Map(const float* values,
+                       int count,
+                       float* colours,
+                       int stride) const
+{
+    const float* lut = m_Lut.constData();
+    const float min = m_Min;
+    const float scale = m_Scale;
+    const float lastIndex = LUT_SIZE - 1;
+
+    for (int i = 0; i < count; ++i)
+    {
+        float index = (values[i] - min)*scale;
+        index = index >= 0 ? index : 0;
+        index = index > lastIndex ? lastIndex : index;
+        const float* colour = lut + (int)index*TUPLE_SIZE;
+        float* out = colours + i*stride;
+        out[0] = colour[0];
+        out[1] = colour[1];
+        out[2] = colour[2];
+    }
+}
+
+void ColourMapper::MapParallel(const float* values,
+                               int count,
+                               float* colours,
+                               int stride) const
+{
+    Parallel::For(count, MIN_CHUNK_SIZE,
+                  [this, values, colours, stride](int, int first, int last)
+    {
+        Map(values + first, last - first, colours + first*stride, stride);
+    });
+}
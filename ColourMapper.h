@@ -0,0 +1,114 @@
+/**
+ * @file ColourMapper.h
+ * @date 19 Oct 2026
+ * @see ColourMaps.h
+ * @brief This class converts arrays of scalar values into packed RGB colours
+ * using a colour map.
+ *
+ * The colour map is resampled into a fixed size look-up table when it is
+ * set, and values are mapped with a branch-free clamp and index so the
+ * inner loop can be vectorized by the compiler. Mapping allocates no memory
+ * and large arrays are split across threads.
+ */
+
+#ifndef COLOURMAPPER_H
+#define COLOURMAPPER_H
+
+#include <QVector>
+#include <QVector3D>
+
+class ColourMapper
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    ColourMapper();
+
+    /**
+     * @brief Sets the colour map used for mapping and rebuilds the look-up
+     * table.
+     * @param mapData A pointer to @e mapLength consecutive RGB triplets, as
+     * returned by ColourMaps::GetMapData().
+     * @param mapLength The number of colours in the map.
+     */
+    void SetColourMap(const float* mapData, int mapLength);
+
+    /**
+     * @brief Sets the range of values covered by the colour map. Values
+     * outside the range are given the first or last colour of the map.
+     * @param min The value mapped to the first colour.
+     * @param max The value mapped to the last colour.
+     */
+    void SetRange(float min, float max);
+
+    /**
+     * @brief Returns the colour for a single value.
+     * @param value The value to be mapped.
+     * @return A QVector3D of RGB float values, from 0-1.
+     */
+    QVector3D Colour(float value) const;
+
+    /**
+     * @brief Maps an array of values to colours on the calling thread.
+     * @param values The values to be mapped.
+     * @param count The number of values.
+     * @param colours The output array. The RGB triplet for value @e i is
+     * written at colours[i*stride].
+     * @param stride The distance between consecutive output triplets, in
+     * floats. Use 3 for tightly packed colours.
+     */
+    void Map(const float* values,
+             int count,
+             float* colours,
+             int stride = TUPLE_SIZE) const;
+
+    /**
+     * @brief Maps an array of values to colours, splitting large arrays
+     * across the global thread pool.
+     * @param values The values to be mapped.
+     * @param count The number of values.
+     * @param colours The output array. The RGB triplet for value @e i is
+     * written at colours[i*stride].
+     * @param stride The distance between consecutive output triplets, in
+     * floats. Use 3 for tightly packed colours.
+     */
+    void MapParallel(const float* values,
+                     int count,
+                     float* colours,
+                     int stride = TUPLE_SIZE) const;
+
+    /**
+     * @brief The number of entries in the look-up table.
+     */
+    static const int LUT_SIZE = 1024;
+
+    /**
+     * @brief The number of floats in one colour.
+     */
+    static const int TUPLE_SIZE = 3;
+
+private:
+    /**
+     * @brief The look-up table, as LUT_SIZE packed RGB triplets.
+     */
+    QVector<float> m_Lut;
+
+    /**
+     * @brief The value mapped to the first entry of the look-up table.
+     */
+    float m_Min = 0;
+
+    /**
+     * @brief The factor converting an offset from m_Min into a look-up
+     * table index.
+     */
+    float m_Scale = 1;
+
+    /**
+     * @brief The smallest number of values worth handing to a thread.
+     */
+    static const int MIN_CHUNK_SIZE = 65536;
+};
+
+#endif // COLOURMAPPER_H
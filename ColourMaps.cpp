@@ -1,9850 +1,9878 @@
 #include "ColourMaps.h"
 
-
-
-QVector3D ColourMaps::GetColour(int map, int mapIndex)
+namespace
 {
-    if (mapIndex >= GetMap(map).length())
+    /**
+     * @brief The colour maps, each one being MAP_LENGTH RGB triplets of
+     * float values, from 0-1.
+     */
+    constexpr float COLOUR_MAP_TABLE[ColourMaps::NUMBER_OF_MAPS]
+                                    [ColourMaps::MAP_LENGTH][3] = {
     {
-        return GetMap(map).last();
-    }
-    else if (mapIndex < 0)
+        {0.46877,0.46888,0.46885},
+        {0.47381,0.47391,0.47389},
+        {0.47887,0.47897,0.47895},
+        {0.48395,0.48405,0.48403},
+        {0.48907,0.48917,0.48914},
+        {0.49422,0.49432,0.4943},
+        {0.49939,0.49949,0.49947},
+        {0.50462,0.50472,0.5047},
+        {0.50986,0.50997,0.50994},
+        {0.51515,0.51526,0.51523},
+        {0.52047,0.52058,0.52056},
+        {0.52583,0.52594,0.52592},
+        {0.53121,0.53132,0.5313},
+        {0.53663,0.53674,0.53671},
+        {0.54205,0.54217,0.54214},
+        {0.5475,0.54762,0.54759},
+        {0.55297,0.55309,0.55306},
+        {0.55846,0.55857,0.55855},
+        {0.56397,0.56409,0.56406},
+        {0.56948,0.5696,0.56957},
+        {0.57501,0.57513,0.5751},
+        {0.58055,0.58067,0.58064},
+        {0.58611,0.58623,0.5862},
+        {0.59167,0.59179,0.59176},
+        {0.59724,0.59737,0.59734},
+        {0.60282,0.60295,0.60292},
+        {0.60842,0.60855,0.60852},
+        {0.61401,0.61414,0.6141},
+        {0.61963,0.61976,0.61973},
+        {0.62524,0.62537,0.62534},
+        {0.63088,0.63101,0.63098},
+        {0.63652,0.63665,0.63662},
+        {0.64216,0.64229,0.64226},
+        {0.64781,0.64795,0.64791},
+        {0.65348,0.65361,0.65358},
+        {0.65915,0.65929,0.65926},
+        {0.66484,0.66497,0.66494},
+        {0.67054,0.67067,0.67064},
+        {0.67624,0.67637,0.67634},
+        {0.68194,0.68208,0.68205},
+        {0.68766,0.68781,0.68777},
+        {0.69339,0.69353,0.6935},
+        {0.69913,0.69927,0.69923},
+        {0.70487,0.70502,0.70498},
+        {0.71062,0.71076,0.71073},
+        {0.71636,0.71651,0.71647},
+        {0.72208,0.72223,0.72219},
+        {0.72779,0.72794,0.72791},
+        {0.73347,0.73362,0.73359},
+        {0.73911,0.73926,0.73922},
+        {0.74467,0.74482,0.74478},
+        {0.75014,0.75029,0.75026},
+        {0.75549,0.75565,0.75561},
+        {0.76068,0.76083,0.7608},
+        {0.76567,0.76582,0.76578},
+        {0.77039,0.77055,0.77051},
+        {0.77481,0.77497,0.77493},
+        {0.77887,0.77903,0.77899},
+        {0.7825,0.78266,0.78262},
+        {0.78566,0.78581,0.78578},
+        {0.78827,0.78843,0.78839},
+        {0.79029,0.79045,0.79041},
+        {0.79169,0.79185,0.79182},
+        {0.79244,0.7926,0.79257},
+        {0.79252,0.79269,0.79265},
+        {0.79193,0.79209,0.79205},
+        {0.79069,0.79085,0.79081},
+        {0.78881,0.78897,0.78893},
+        {0.78633,0.78649,0.78645},
+        {0.7833,0.78346,0.78342},
+        {0.77978,0.77994,0.7799},
+        {0.77582,0.77598,0.77594},
+        {0.77149,0.77164,0.7716},
+        {0.76682,0.76698,0.76694},
+        {0.76189,0.76205,0.76201},
+        {0.75675,0.75691,0.75687},
+        {0.75145,0.7516,0.75156},
+        {0.746,0.74615,0.74611},
+        {0.74045,0.7406,0.74056},
+        {0.73484,0.73499,0.73495},
+        {0.72917,0.72932,0.72928},
+        {0.72346,0.72361,0.72357},
+        {0.71774,0.71789,0.71785},
+        {0.712,0.71215,0.71211},
+        {0.70626,0.70641,0.70637},
+        {0.70052,0.70066,0.70062},
+        {0.69477,0.69492,0.69488},
+        {0.68905,0.68919,0.68916},
+        {0.68333,0.68346,0.68343},
+        {0.67762,0.67776,0.67772},
+        {0.67191,0.67205,0.67201},
+        {0.66621,0.66635,0.66631},
+        {0.66052,0.66066,0.66063},
+        {0.65485,0.65498,0.65495},
+        {0.64919,0.64932,0.64929},
+        {0.64352,0.64365,0.64362},
+        {0.63787,0.63801,0.63797},
+        {0.63223,0.63236,0.63233},
+        {0.6266,0.62673,0.6267},
+        {0.62098,0.62111,0.62108},
+        {0.61536,0.61549,0.61546},
+        {0.60976,0.60989,0.60986},
+        {0.60418,0.6043,0.60427},
+        {0.59858,0.59871,0.59868},
+        {0.59302,0.59314,0.59311},
+        {0.58744,0.58756,0.58753},
+        {0.58189,0.58201,0.58198},
+        {0.57635,0.57647,0.57644},
+        {0.57081,0.57092,0.5709},
+        {0.56528,0.56539,0.56537},
+        {0.55977,0.55989,0.55986},
+        {0.55426,0.55438,0.55435},
+        {0.54877,0.54888,0.54886},
+        {0.54328,0.54339,0.54336},
+        {0.53781,0.53792,0.53789},
+        {0.53234,0.53245,0.53242},
+        {0.52688,0.52699,0.52697},
+        {0.52143,0.52154,0.52151},
+        {0.51599,0.5161,0.51607},
+        {0.51057,0.51067,0.51065},
+        {0.50515,0.50526,0.50523},
+        {0.49974,0.49985,0.49982},
+        {0.49436,0.49446,0.49444},
+        {0.48897,0.48907,0.48905},
+        {0.48359,0.4837,0.48367},
+        {0.47824,0.47834,0.47831},
+        {0.47288,0.47298,0.47295},
+        {0.46755,0.46764,0.46762},
+        {0.46221,0.46231,0.46229},
+        {0.45689,0.45699,0.45697},
+        {0.45159,0.45169,0.45166},
+        {0.44629,0.44638,0.44636},
+        {0.441,0.44109,0.44107},
+        {0.43574,0.43583,0.43581},
+        {0.43047,0.43056,0.43054},
+        {0.42522,0.42531,0.42529},
+        {0.41998,0.42007,0.42004},
+        {0.41475,0.41483,0.41481},
+        {0.40953,0.40962,0.4096},
+        {0.40432,0.40441,0.40439},
+        {0.39912,0.39921,0.39919},
+        {0.39395,0.39403,0.39401},
+        {0.38878,0.38887,0.38885},
+        {0.38363,0.38371,0.38369},
+        {0.37848,0.37856,0.37854},
+        {0.37334,0.37342,0.3734},
+        {0.36822,0.36831,0.36829},
+        {0.36311,0.36319,0.36317},
+        {0.35802,0.3581,0.35808},
+        {0.35294,0.35302,0.353},
+        {0.34787,0.34794,0.34793},
+        {0.34282,0.34289,0.34287},
+        {0.33776,0.33783,0.33781},
+        {0.33274,0.33281,0.3328},
+        {0.3277,0.32778,0.32776},
+        {0.32271,0.32278,0.32276},
+        {0.31771,0.31778,0.31776},
+        {0.31272,0.31279,0.31277},
+        {0.30775,0.30782,0.3078},
+        {0.3028,0.30286,0.30285},
+        {0.29786,0.29793,0.29791},
+        {0.29294,0.293,0.29299},
+        {0.28802,0.28809,0.28807},
+        {0.28314,0.2832,0.28319},
+        {0.27826,0.27832,0.2783},
+        {0.27339,0.27345,0.27344},
+        {0.26853,0.2686,0.26858},
+        {0.2637,0.26376,0.26375},
+        {0.25887,0.25893,0.25892},
+        {0.25406,0.25412,0.2541},
+        {0.24925,0.24931,0.2493},
+        {0.24446,0.24452,0.24451},
+        {0.23973,0.23978,0.23977},
+        {0.23502,0.23508,0.23506},
+        {0.2303,0.23036,0.23034},
+        {0.22568,0.22573,0.22572},
+        {0.22109,0.22114,0.22113},
+        {0.21656,0.21662,0.2166},
+        {0.21212,0.21217,0.21216},
+        {0.20777,0.20782,0.20781},
+        {0.20358,0.20363,0.20361},
+        {0.19951,0.19955,0.19954},
+        {0.19568,0.19573,0.19572},
+        {0.19207,0.19212,0.19211},
+        {0.18876,0.1888,0.18879},
+        {0.18577,0.18581,0.1858},
+        {0.18308,0.18313,0.18312},
+        {0.18084,0.18089,0.18087},
+        {0.17906,0.1791,0.17909},
+        {0.17775,0.1778,0.17779},
+        {0.17689,0.17694,0.17693},
+        {0.17656,0.1766,0.17659},
+        {0.17676,0.17681,0.1768},
+        {0.1775,0.17755,0.17754},
+        {0.17871,0.17875,0.17874},
+        {0.18037,0.18041,0.1804},
+        {0.1825,0.18255,0.18254},
+        {0.18509,0.18514,0.18512},
+        {0.18802,0.18807,0.18806},
+        {0.19124,0.19129,0.19128},
+        {0.19481,0.19485,0.19484},
+        {0.19857,0.19862,0.19861},
+        {0.20257,0.20262,0.20261},
+        {0.20676,0.20681,0.2068},
+        {0.21105,0.2111,0.21109},
+        {0.21547,0.21552,0.21551},
+        {0.21999,0.22004,0.22003},
+        {0.22453,0.22458,0.22457},
+        {0.22919,0.22924,0.22923},
+        {0.23386,0.23392,0.2339},
+        {0.23857,0.23863,0.23862},
+        {0.24332,0.24337,0.24336},
+        {0.24812,0.24817,0.24816},
+        {0.2529,0.25295,0.25294},
+        {0.25769,0.25775,0.25774},
+        {0.26252,0.26258,0.26257},
+        {0.26734,0.2674,0.26739},
+        {0.27219,0.27226,0.27224},
+        {0.27708,0.27714,0.27713},
+        {0.28196,0.28203,0.28201},
+        {0.28684,0.2869,0.28688},
+        {0.29176,0.29183,0.29181},
+        {0.29668,0.29675,0.29674},
+        {0.3016,0.30167,0.30165},
+        {0.30657,0.30664,0.30662},
+        {0.31152,0.31159,0.31157},
+        {0.31651,0.31658,0.31656},
+        {0.32149,0.32156,0.32154},
+        {0.32649,0.32656,0.32654},
+        {0.33151,0.33158,0.33156},
+        {0.33654,0.33662,0.3366},
+        {0.34159,0.34166,0.34165},
+        {0.34664,0.34672,0.3467},
+        {0.3517,0.35178,0.35176},
+        {0.3568,0.35688,0.35686},
+        {0.36188,0.36196,0.36194},
+        {0.36698,0.36706,0.36704},
+        {0.37208,0.37216,0.37215},
+        {0.37721,0.37729,0.37727},
+        {0.38233,0.38241,0.38239},
+        {0.38746,0.38755,0.38753},
+        {0.3926,0.39269,0.39267},
+        {0.39775,0.39784,0.39781},
+        {0.40288,0.40297,0.40295},
+        {0.40802,0.4081,0.40808},
+        {0.41315,0.41324,0.41322},
+        {0.41826,0.41834,0.41832},
+        {0.42336,0.42345,0.42343},
+        {0.42846,0.42855,0.42853},
+        {0.43353,0.43362,0.4336},
+        {0.43859,0.43868,0.43866},
+        {0.44365,0.44374,0.44372},
+        {0.44868,0.44878,0.44875},
+        {0.4537,0.4538,0.45377},
+        {0.45872,0.45882,0.4588},
+        {0.46374,0.46385,0.46382}
+    },
     {
-        return GetMap(map).first();
-    }
-    else
+        {0.17676,0.17681,0.1768},
+        {0.1775,0.17755,0.17754},
+        {0.17871,0.17875,0.17874},
+        {0.18037,0.18041,0.1804},
+        {0.1825,0.18255,0.18254},
+        {0.18509,0.18514,0.18512},
+        {0.18802,0.18807,0.18806},
+        {0.19124,0.19129,0.19128},
+        {0.19481,0.19485,0.19484},
+        {0.19857,0.19862,0.19861},
+        {0.20257,0.20262,0.20261},
+        {0.20676,0.20681,0.2068},
+        {0.21105,0.2111,0.21109},
+        {0.21547,0.21552,0.21551},
+        {0.21999,0.22004,0.22003},
+        {0.22453,0.22458,0.22457},
+        {0.22919,0.22924,0.22923},
+        {0.23386,0.23392,0.2339},
+        {0.23857,0.23863,0.23862},
+        {0.24332,0.24337,0.24336},
+        {0.24812,0.24817,0.24816},
+        {0.2529,0.25295,0.25294},
+        {0.25769,0.25775,0.25774},
+        {0.26252,0.26258,0.26257},
+        {0.26734,0.2674,0.26739},
+        {0.27219,0.27226,0.27224},
+        {0.27708,0.27714,0.27713},
+        {0.28196,0.28203,0.28201},
+        {0.28684,0.2869,0.28688},
+        {0.29176,0.29183,0.29181},
+        {0.29668,0.29675,0.29674},
+        {0.3016,0.30167,0.30165},
+        {0.30657,0.30664,0.30662},
+        {0.31152,0.31159,0.31157},
+        {0.31651,0.31658,0.31656},
+        {0.32149,0.32156,0.32154},
+        {0.32649,0.32656,0.32654},
+        {0.33151,0.33158,0.33156},
+        {0.33654,0.33662,0.3366},
+        {0.34159,0.34166,0.34165},
+        {0.34664,0.34672,0.3467},
+        {0.3517,0.35178,0.35176},
+        {0.3568,0.35688,0.35686},
+        {0.36188,0.36196,0.36194},
+        {0.36698,0.36706,0.36704},
+        {0.37208,0.37216,0.37215},
+        {0.37721,0.37729,0.37727},
+        {0.38233,0.38241,0.38239},
+        {0.38746,0.38755,0.38753},
+        {0.3926,0.39269,0.39267},
+        {0.39775,0.39784,0.39781},
+        {0.40288,0.40297,0.40295},
+        {0.40802,0.4081,0.40808},
+        {0.41315,0.41324,0.41322},
+        {0.41826,0.41834,0.41832},
+        {0.42336,0.42345,0.42343},
+        {0.42846,0.42855,0.42853},
+        {0.43353,0.43362,0.4336},
+        {0.43859,0.43868,0.43866},
+        {0.44365,0.44374,0.44372},
+        {0.44868,0.44878,0.44875},
+        {0.4537,0.4538,0.45377},
+        {0.45872,0.45882,0.4588},
+        {0.46374,0.46385,0.46382},
+        {0.46877,0.46888,0.46885},
+        {0.47381,0.47391,0.47389},
+        {0.47887,0.47897,0.47895},
+        {0.48395,0.48405,0.48403},
+        {0.48907,0.48917,0.48914},
+        {0.49422,0.49432,0.4943},
+        {0.49939,0.49949,0.49947},
+        {0.50462,0.50472,0.5047},
+        {0.50986,0.50997,0.50994},
+        {0.51515,0.51526,0.51523},
+        {0.52047,0.52058,0.52056},
+        {0.52583,0.52594,0.52592},
+        {0.53121,0.53132,0.5313},
+        {0.53663,0.53674,0.53671},
+        {0.54205,0.54217,0.54214},
+        {0.5475,0.54762,0.54759},
+        {0.55297,0.55309,0.55306},
+        {0.55846,0.55857,0.55855},
+        {0.56397,0.56409,0.56406},
+        {0.56948,0.5696,0.56957},
+        {0.57501,0.57513,0.5751},
+        {0.58055,0.58067,0.58064},
+        {0.58611,0.58623,0.5862},
+        {0.59167,0.59179,0.59176},
+        {0.59724,0.59737,0.59734},
+        {0.60282,0.60295,0.60292},
+        {0.60842,0.60855,0.60852},
+        {0.61401,0.61414,0.6141},
+        {0.61963,0.61976,0.61973},
+        {0.62524,0.62537,0.62534},
+        {0.63088,0.63101,0.63098},
+        {0.63652,0.63665,0.63662},
+        {0.64216,0.64229,0.64226},
+        {0.64781,0.64795,0.64791},
+        {0.65348,0.65361,0.65358},
+        {0.65915,0.65929,0.65926},
+        {0.66484,0.66497,0.66494},
+        {0.67054,0.67067,0.67064},
+        {0.67624,0.67637,0.67634},
+        {0.68194,0.68208,0.68205},
+        {0.68766,0.68781,0.68777},
+        {0.69339,0.69353,0.6935},
+        {0.69913,0.69927,0.69923},
+        {0.70487,0.70502,0.70498},
+        {0.71062,0.71076,0.71073},
+        {0.71636,0.71651,0.71647},
+        {0.72208,0.72223,0.72219},
+        {0.72779,0.72794,0.72791},
+        {0.73347,0.73362,0.73359},
+        {0.73911,0.73926,0.73922},
+        {0.74467,0.74482,0.74478},
+        {0.75014,0.75029,0.75026},
+        {0.75549,0.75565,0.75561},
+        {0.76068,0.76083,0.7608},
+        {0.76567,0.76582,0.76578},
+        {0.77039,0.77055,0.77051},
+        {0.77481,0.77497,0.77493},
+        {0.77887,0.77903,0.77899},
+        {0.7825,0.78266,0.78262},
+        {0.78566,0.78581,0.78578},
+        {0.78827,0.78843,0.78839},
+        {0.79029,0.79045,0.79041},
+        {0.79169,0.79185,0.79182},
+        {0.79244,0.7926,0.79257},
+        {0.79252,0.79269,0.79265},
+        {0.79193,0.79209,0.79205},
+        {0.79069,0.79085,0.79081},
+        {0.78881,0.78897,0.78893},
+        {0.78633,0.78649,0.78645},
+        {0.7833,0.78346,0.78342},
+        {0.77978,0.77994,0.7799},
+        {0.77582,0.77598,0.77594},
+        {0.77149,0.77164,0.7716},
+        {0.76682,0.76698,0.76694},
+        {0.76189,0.76205,0.76201},
+        {0.75675,0.75691,0.75687},
+        {0.75145,0.7516,0.75156},
+        {0.746,0.74615,0.74611},
+        {0.74045,0.7406,0.74056},
+        {0.73484,0.73499,0.73495},
+        {0.72917,0.72932,0.72928},
+        {0.72346,0.72361,0.72357},
+        {0.71774,0.71789,0.71785},
+        {0.712,0.71215,0.71211},
+        {0.70626,0.70641,0.70637},
+        {0.70052,0.70066,0.70062},
+        {0.69477,0.69492,0.69488},
+        {0.68905,0.68919,0.68916},
+        {0.68333,0.68346,0.68343},
+        {0.67762,0.67776,0.67772},
+        {0.67191,0.67205,0.67201},
+        {0.66621,0.66635,0.66631},
+        {0.66052,0.66066,0.66063},
+        {0.65485,0.65498,0.65495},
+        {0.64919,0.64932,0.64929},
+        {0.64352,0.64365,0.64362},
+        {0.63787,0.63801,0.63797},
+        {0.63223,0.63236,0.63233},
+        {0.6266,0.62673,0.6267},
+        {0.62098,0.62111,0.62108},
+        {0.61536,0.61549,0.61546},
+        {0.60976,0.60989,0.60986},
+        {0.60418,0.6043,0.60427},
+        {0.59858,0.59871,0.59868},
+        {0.59302,0.59314,0.59311},
+        {0.58744,0.58756,0.58753},
+        {0.58189,0.58201,0.58198},
+        {0.57635,0.57647,0.57644},
+        {0.57081,0.57092,0.5709},
+        {0.56528,0.56539,0.56537},
+        {0.55977,0.55989,0.55986},
+        {0.55426,0.55438,0.55435},
+        {0.54877,0.54888,0.54886},
+        {0.54328,0.54339,0.54336},
+        {0.53781,0.53792,0.53789},
+        {0.53234,0.53245,0.53242},
+        {0.52688,0.52699,0.52697},
+        {0.52143,0.52154,0.52151},
+        {0.51599,0.5161,0.51607},
+        {0.51057,0.51067,0.51065},
+        {0.50515,0.50526,0.50523},
+        {0.49974,0.49985,0.49982},
+        {0.49436,0.49446,0.49444},
+        {0.48897,0.48907,0.48905},
+        {0.48359,0.4837,0.48367},
+        {0.47824,0.47834,0.47831},
+        {0.47288,0.47298,0.47295},
+        {0.46755,0.46764,0.46762},
+        {0.46221,0.46231,0.46229},
+        {0.45689,0.45699,0.45697},
+        {0.45159,0.45169,0.45166},
+        {0.44629,0.44638,0.44636},
+        {0.441,0.44109,0.44107},
+        {0.43574,0.43583,0.43581},
+        {0.43047,0.43056,0.43054},
+        {0.42522,0.42531,0.42529},
+        {0.41998,0.42007,0.42004},
+        {0.41475,0.41483,0.41481},
+        {0.40953,0.40962,0.4096},
+        {0.40432,0.40441,0.40439},
+        {0.39912,0.39921,0.39919},
+        {0.39395,0.39403,0.39401},
+        {0.38878,0.38887,0.38885},
+        {0.38363,0.38371,0.38369},
+        {0.37848,0.37856,0.37854},
+        {0.37334,0.37342,0.3734},
+        {0.36822,0.36831,0.36829},
+        {0.36311,0.36319,0.36317},
+        {0.35802,0.3581,0.35808},
+        {0.35294,0.35302,0.353},
+        {0.34787,0.34794,0.34793},
+        {0.34282,0.34289,0.34287},
+        {0.33776,0.33783,0.33781},
+        {0.33274,0.33281,0.3328},
+        {0.3277,0.32778,0.32776},
+        {0.32271,0.32278,0.32276},
+        {0.31771,0.31778,0.31776},
+        {0.31272,0.31279,0.31277},
+        {0.30775,0.30782,0.3078},
+        {0.3028,0.30286,0.30285},
+        {0.29786,0.29793,0.29791},
+        {0.29294,0.293,0.29299},
+        {0.28802,0.28809,0.28807},
+        {0.28314,0.2832,0.28319},
+        {0.27826,0.27832,0.2783},
+        {0.27339,0.27345,0.27344},
+        {0.26853,0.2686,0.26858},
+        {0.2637,0.26376,0.26375},
+        {0.25887,0.25893,0.25892},
+        {0.25406,0.25412,0.2541},
+        {0.24925,0.24931,0.2493},
+        {0.24446,0.24452,0.24451},
+        {0.23973,0.23978,0.23977},
+        {0.23502,0.23508,0.23506},
+        {0.2303,0.23036,0.23034},
+        {0.22568,0.22573,0.22572},
+        {0.22109,0.22114,0.22113},
+        {0.21656,0.21662,0.2166},
+        {0.21212,0.21217,0.21216},
+        {0.20777,0.20782,0.20781},
+        {0.20358,0.20363,0.20361},
+        {0.19951,0.19955,0.19954},
+        {0.19568,0.19573,0.19572},
+        {0.19207,0.19212,0.19211},
+        {0.18876,0.1888,0.18879},
+        {0.18577,0.18581,0.1858},
+        {0.18308,0.18313,0.18312},
+        {0.18084,0.18089,0.18087},
+        {0.17906,0.1791,0.17909},
+        {0.17775,0.1778,0.17779},
+        {0.17689,0.17694,0.17693},
+        {0.17656,0.1766,0.17659}
+    },
+    {
+        {0.97561,0.52012,0.97096},
+        {0.98033,0.51722,0.96319},
+        {0.9842,0.51357,0.95448},
+        {0.98725,0.50922,0.94488},
+        {0.98954,0.5042,0.93442},
+        {0.99112,0.49856,0.9232},
+        {0.99204,0.49233,0.91126},
+        {0.99239,0.48561,0.89871},
+        {0.99221,0.47844,0.88563},
+        {0.99158,0.47088,0.87209},
+        {0.99055,0.46298,0.85819},
+        {0.98919,0.45483,0.84399},
+        {0.98754,0.44642,0.82958},
+        {0.98565,0.43783,0.81499},
+        {0.98354,0.42907,0.80029},
+        {0.98125,0.42019,0.78551},
+        {0.97879,0.4112,0.77068},
+        {0.97618,0.40212,0.75583},
+        {0.97344,0.39297,0.74098},
+        {0.97057,0.38376,0.72614},
+        {0.96757,0.3745,0.71131},
+        {0.96444,0.36519,0.6965},
+        {0.96118,0.35586,0.6817},
+        {0.95779,0.3465,0.66694},
+        {0.95425,0.33716,0.65219},
+        {0.95055,0.3278,0.63745},
+        {0.94668,0.31849,0.62271},
+        {0.94264,0.30923,0.60798},
+        {0.93839,0.3,0.59322},
+        {0.93394,0.29087,0.57844},
+        {0.92929,0.28185,0.56366},
+        {0.92441,0.27294,0.54883},
+        {0.91931,0.26418,0.53396},
+        {0.91398,0.25557,0.51908},
+        {0.90842,0.24712,0.50415},
+        {0.90264,0.23883,0.48918},
+        {0.89665,0.23073,0.47419},
+        {0.89044,0.22281,0.45918},
+        {0.88405,0.21501,0.44415},
+        {0.87747,0.2074,0.42911},
+        {0.87072,0.19987,0.41407},
+        {0.86383,0.1925,0.39903},
+        {0.85679,0.18523,0.38401},
+        {0.84962,0.17801,0.369},
+        {0.84235,0.17082,0.35401},
+        {0.83498,0.16373,0.33907},
+        {0.82753,0.15664,0.32416},
+        {0.82001,0.14962,0.30933},
+        {0.81245,0.14261,0.29452},
+        {0.80486,0.13567,0.27982},
+        {0.79725,0.12885,0.26518},
+        {0.78966,0.12217,0.25066},
+        {0.78212,0.11578,0.23628},
+        {0.77464,0.1097,0.22201},
+        {0.7673,0.104,0.20795},
+        {0.76012,0.098945,0.19412},
+        {0.75317,0.094721,0.18049},
+        {0.74652,0.091421,0.16723},
+        {0.74022,0.089258,0.15426},
+        {0.73434,0.088445,0.14174},
+        {0.72894,0.089069,0.12963},
+        {0.7241,0.091195,0.118},
+        {0.71988,0.094767,0.10689},
+        {0.71631,0.099636,0.096236},
+        {0.71343,0.1058,0.086225},
+        {0.71128,0.11302,0.076774},
+        {0.70983,0.12104,0.068001},
+        {0.7091,0.12989,0.05981},
+        {0.70904,0.1392,0.052084},
+        {0.70963,0.14902,0.04517},
+        {0.71081,0.15914,0.038855},
+        {0.71251,0.1695,0.033292},
+        {0.7147,0.17995,0.028947},
+        {0.71729,0.1905,0.02547},
+        {0.72021,0.20107,0.022733},
+        {0.72342,0.21166,0.020622},
+        {0.72685,0.22214,0.019034},
+        {0.73046,0.23256,0.017876},
+        {0.73419,0.24288,0.017071},
+        {0.73802,0.25311,0.016547},
+        {0.74191,0.26323,0.016249},
+        {0.74585,0.27322,0.016125},
+        {0.74979,0.28311,0.016137},
+        {0.75375,0.29288,0.01625},
+        {0.75769,0.30257,0.01644},
+        {0.76161,0.31217,0.016684},
+        {0.7655,0.32171,0.016989},
+        {0.76932,0.33117,0.017296},
+        {0.7731,0.34058,0.0176},
+        {0.77681,0.34994,0.017896},
+        {0.78044,0.35925,0.018177},
+        {0.784,0.36855,0.018435},
+        {0.78746,0.37783,0.018665},
+        {0.79082,0.38709,0.018861},
+        {0.79409,0.39636,0.019014},
+        {0.79724,0.40564,0.019122},
+        {0.80029,0.4149,0.019179},
+        {0.80322,0.42418,0.019183},
+        {0.80605,0.43346,0.019132},
+        {0.80876,0.44276,0.019026},
+        {0.81136,0.45205,0.018866},
+        {0.81386,0.46134,0.018654},
+        {0.81626,0.47063,0.018394},
+        {0.81857,0.47992,0.01809},
+        {0.8208,0.48918,0.017747},
+        {0.82295,0.49846,0.017369},
+        {0.82503,0.50771,0.016963},
+        {0.82704,0.51694,0.016575},
+        {0.82898,0.52615,0.016225},
+        {0.83084,0.53532,0.015949},
+        {0.83262,0.54446,0.015792},
+        {0.83431,0.55354,0.01582},
+        {0.8359,0.56257,0.016118},
+        {0.83738,0.5715,0.016798},
+        {0.8387,0.58035,0.018004},
+        {0.83985,0.58906,0.019918},
+        {0.84077,0.59761,0.022763},
+        {0.84143,0.60595,0.02681},
+        {0.84177,0.61404,0.032376},
+        {0.84173,0.62182,0.040011},
+        {0.84125,0.62922,0.04912},
+        {0.84026,0.63619,0.059305},
+        {0.83868,0.64264,0.070471},
+        {0.83647,0.6485,0.08264},
+        {0.83356,0.65372,0.095596},
+        {0.82989,0.65824,0.10926},
+        {0.82544,0.66201,0.12343},
+        {0.82017,0.66498,0.13819},
+        {0.81408,0.66715,0.15321},
+        {0.80717,0.66852,0.16856},
+        {0.79947,0.66908,0.18405},
+        {0.79098,0.66887,0.19961},
+        {0.78178,0.66795,0.2152},
+        {0.7719,0.66635,0.23072},
+        {0.76139,0.66416,0.2461},
+        {0.75032,0.66143,0.26133},
+        {0.73873,0.65825,0.27636},
+        {0.72668,0.65467,0.29113},
+        {0.71421,0.65077,0.30567},
+        {0.70137,0.64662,0.31995},
+        {0.68818,0.64226,0.33397},
+        {0.67466,0.63773,0.34774},
+        {0.66084,0.6331,0.36127},
+        {0.64671,0.62838,0.37458},
+        {0.63228,0.6236,0.38765},
+        {0.61753,0.61878,0.40056},
+        {0.60245,0.61393,0.41326},
+        {0.58703,0.60909,0.42578},
+        {0.57126,0.60423,0.43817},
+        {0.55511,0.59936,0.4504},
+        {0.53858,0.59449,0.4625},
+        {0.5216,0.58962,0.47451},
+        {0.5042,0.58475,0.4864},
+        {0.48632,0.57986,0.49821},
+        {0.46796,0.57493,0.50993},
+        {0.44912,0.56996,0.5216},
+        {0.42978,0.56493,0.53322},
+        {0.40998,0.55983,0.5448},
+        {0.38972,0.55461,0.55635},
+        {0.36908,0.54926,0.56789},
+        {0.3481,0.54375,0.57943},
+        {0.32688,0.53805,0.59098},
+        {0.30556,0.53211,0.60256},
+        {0.28424,0.52592,0.61416},
+        {0.26316,0.51945,0.62583},
+        {0.2425,0.51265,0.63755},
+        {0.22257,0.50551,0.64934},
+        {0.20368,0.49802,0.66119},
+        {0.18619,0.49012,0.67313},
+        {0.17051,0.48183,0.68514},
+        {0.15712,0.47312,0.69723},
+        {0.14638,0.46402,0.70941},
+        {0.13859,0.4545,0.72164},
+        {0.1338,0.44458,0.73395},
+        {0.1319,0.43426,0.7463},
+        {0.13253,0.42359,0.75869},
+        {0.13519,0.4126,0.77109},
+        {0.1393,0.40128,0.7835},
+        {0.1445,0.38969,0.79588},
+        {0.15024,0.3779,0.80821},
+        {0.1563,0.36594,0.82045},
+        {0.16246,0.35387,0.83257},
+        {0.16864,0.34179,0.84452},
+        {0.17484,0.32979,0.85623},
+        {0.18105,0.31794,0.86767},
+        {0.18746,0.30639,0.87875},
+        {0.19408,0.29524,0.88943},
+        {0.20101,0.28465,0.89962},
+        {0.20848,0.27478,0.90926},
+        {0.2165,0.26579,0.9183},
+        {0.22506,0.25778,0.92668},
+        {0.2343,0.25098,0.93436},
+        {0.24409,0.24544,0.94131},
+        {0.25448,0.24134,0.94753},
+        {0.26529,0.23866,0.95301},
+        {0.27652,0.2375,0.95778},
+        {0.28798,0.23773,0.96185},
+        {0.29964,0.23933,0.9653},
+        {0.31135,0.24218,0.96816},
+        {0.32305,0.24613,0.9705},
+        {0.33464,0.25106,0.97238},
+        {0.34606,0.25676,0.97386},
+        {0.35733,0.26313,0.97502},
+        {0.36835,0.27,0.9759},
+        {0.37916,0.27724,0.97657},
+        {0.38973,0.28476,0.97706},
+        {0.40009,0.2925,0.97742},
+        {0.41026,0.30036,0.97768},
+        {0.42023,0.3083,0.97787},
+        {0.43006,0.31627,0.978},
+        {0.43977,0.32421,0.97811},
+        {0.4494,0.33213,0.9782},
+        {0.459,0.33997,0.97829},
+        {0.46859,0.34772,0.97838},
+        {0.47825,0.35536,0.97849},
+        {0.48802,0.36282,0.97864},
+        {0.49795,0.37015,0.97883},
+        {0.50807,0.3773,0.97906},
+        {0.51845,0.38426,0.97935},
+        {0.52912,0.39102,0.97969},
+        {0.5401,0.39755,0.9801},
+        {0.55143,0.40386,0.98057},
+        {0.56311,0.40995,0.98111},
+        {0.57513,0.41579,0.98173},
+        {0.58751,0.4214,0.98242},
+        {0.60022,0.42681,0.98317},
+        {0.61322,0.43201,0.984},
+        {0.6265,0.437,0.98489},
+        {0.64002,0.44182,0.98583},
+        {0.65371,0.44647,0.98682},
+        {0.66757,0.45099,0.98786},
+        {0.68153,0.4554,0.98894},
+        {0.69558,0.4597,0.99005},
+        {0.70967,0.46392,0.99118},
+        {0.72376,0.46807,0.99233},
+        {0.73785,0.47218,0.9935},
+        {0.7519,0.47624,0.99467},
+        {0.76589,0.48026,0.99582},
+        {0.77979,0.48425,0.99696},
+        {0.79361,0.48821,0.99807},
+        {0.80729,0.49211,0.99913},
+        {0.82083,0.49595,1},
+        {0.8342,0.49972,1},
+        {0.84736,0.50339,1},
+        {0.86029,0.50693,1},
+        {0.87292,0.5103,1},
+        {0.8852,0.51345,1},
+        {0.89709,0.51632,1},
+        {0.90851,0.51889,1},
+        {0.91939,0.52104,1},
+        {0.92968,0.52273,0.99852},
+        {0.9393,0.52391,0.996},
+        {0.94819,0.5245,0.99274},
+        {0.95631,0.52446,0.98864},
+        {0.9636,0.52374,0.98368},
+        {0.97003,0.52229,0.97779}
+    },
+    {
+        {0.24409,0.24544,0.94131},
+        {0.25448,0.24134,0.94753},
+        {0.26529,0.23866,0.95301},
+        {0.27652,0.2375,0.95778},
+        {0.28798,0.23773,0.96185},
+        {0.29964,0.23933,0.9653},
+        {0.31135,0.24218,0.96816},
+        {0.32305,0.24613,0.9705},
+        {0.33464,0.25106,0.97238},
+        {0.34606,0.25676,0.97386},
+        {0.35733,0.26313,0.97502},
+        {0.36835,0.27,0.9759},
+        {0.37916,0.27724,0.97657},
+        {0.38973,0.28476,0.97706},
+        {0.40009,0.2925,0.97742},
+        {0.41026,0.30036,0.97768},
+        {0.42023,0.3083,0.97787},
+        {0.43006,0.31627,0.978},
+        {0.43977,0.32421,0.97811},
+        {0.4494,0.33213,0.9782},
+        {0.459,0.33997,0.97829},
+        {0.46859,0.34772,0.97838},
+        {0.47825,0.35536,0.97849},
+        {0.48802,0.36282,0.97864},
+        {0.49795,0.37015,0.97883},
+        {0.50807,0.3773,0.97906},
+        {0.51845,0.38426,0.97935},
+        {0.52912,0.39102,0.97969},
+        {0.5401,0.39755,0.9801},
+        {0.55143,0.40386,0.98057},
+        {0.56311,0.40995,0.98111},
+        {0.57513,0.41579,0.98173},
+        {0.58751,0.4214,0.98242},
+        {0.60022,0.42681,0.98317},
+        {0.61322,0.43201,0.984},
+        {0.6265,0.437,0.98489},
+        {0.64002,0.44182,0.98583},
+        {0.65371,0.44647,0.98682},
+        {0.66757,0.45099,0.98786},
+        {0.68153,0.4554,0.98894},
+        {0.69558,0.4597,0.99005},
+        {0.70967,0.46392,0.99118},
+        {0.72376,0.46807,0.99233},
+        {0.73785,0.47218,0.9935},
+        {0.7519,0.47624,0.99467},
+        {0.76589,0.48026,0.99582},
+        {0.77979,0.48425,0.99696},
+        {0.79361,0.48821,0.99807},
+        {0.80729,0.49211,0.99913},
+        {0.82083,0.49595,1},
+        {0.8342,0.49972,1},
+        {0.84736,0.50339,1},
+        {0.86029,0.50693,1},
+        {0.87292,0.5103,1},
+        {0.8852,0.51345,1},
+        {0.89709,0.51632,1},
+        {0.90851,0.51889,1},
+        {0.91939,0.52104,1},
+        {0.92968,0.52273,0.99852},
+        {0.9393,0.52391,0.996},
+        {0.94819,0.5245,0.99274},
+        {0.95631,0.52446,0.98864},
+        {0.9636,0.52374,0.98368},
+        {0.97003,0.52229,0.97779},
+        {0.97561,0.52012,0.97096},
+        {0.98033,0.51722,0.96319},
+        {0.9842,0.51357,0.95448},
+        {0.98725,0.50922,0.94488},
+        {0.98954,0.5042,0.93442},
+        {0.99112,0.49856,0.9232},
+        {0.99204,0.49233,0.91126},
+        {0.99239,0.48561,0.89871},
+        {0.99221,0.47844,0.88563},
+        {0.99158,0.47088,0.87209},
+        {0.99055,0.46298,0.85819},
+        {0.98919,0.45483,0.84399},
+        {0.98754,0.44642,0.82958},
+        {0.98565,0.43783,0.81499},
+        {0.98354,0.42907,0.80029},
+        {0.98125,0.42019,0.78551},
+        {0.97879,0.4112,0.77068},
+        {0.97618,0.40212,0.75583},
+        {0.97344,0.39297,0.74098},
+        {0.97057,0.38376,0.72614},
+        {0.96757,0.3745,0.71131},
+        {0.96444,0.36519,0.6965},
+        {0.96118,0.35586,0.6817},
+        {0.95779,0.3465,0.66694},
+        {0.95425,0.33716,0.65219},
+        {0.95055,0.3278,0.63745},
+        {0.94668,0.31849,0.62271},
+        {0.94264,0.30923,0.60798},
+        {0.93839,0.3,0.59322},
+        {0.93394,0.29087,0.57844},
+        {0.92929,0.28185,0.56366},
+        {0.92441,0.27294,0.54883},
+        {0.91931,0.26418,0.53396},
+        {0.91398,0.25557,0.51908},
+        {0.90842,0.24712,0.50415},
+        {0.90264,0.23883,0.48918},
+        {0.89665,0.23073,0.47419},
+        {0.89044,0.22281,0.45918},
+        {0.88405,0.21501,0.44415},
+        {0.87747,0.2074,0.42911},
+        {0.87072,0.19987,0.41407},
+        {0.86383,0.1925,0.39903},
+        {0.85679,0.18523,0.38401},
+        {0.84962,0.17801,0.369},
+        {0.84235,0.17082,0.35401},
+        {0.83498,0.16373,0.33907},
+        {0.82753,0.15664,0.32416},
+        {0.82001,0.14962,0.30933},
+        {0.81245,0.14261,0.29452},
+        {0.80486,0.13567,0.27982},
+        {0.79725,0.12885,0.26518},
+        {0.78966,0.12217,0.25066},
+        {0.78212,0.11578,0.23628},
+        {0.77464,0.1097,0.22201},
+        {0.7673,0.104,0.20795},
+        {0.76012,0.098945,0.19412},
+        {0.75317,0.094721,0.18049},
+        {0.74652,0.091421,0.16723},
+        {0.74022,0.089258,0.15426},
+        {0.73434,0.088445,0.14174},
+        {0.72894,0.089069,0.12963},
+        {0.7241,0.091195,0.118},
+        {0.71988,0.094767,0.10689},
+        {0.71631,0.099636,0.096236},
+        {0.71343,0.1058,0.086225},
+        {0.71128,0.11302,0.076774},
+        {0.70983,0.12104,0.068001},
+        {0.7091,0.12989,0.05981},
+        {0.70904,0.1392,0.052084},
+        {0.70963,0.14902,0.04517},
+        {0.71081,0.15914,0.038855},
+        {0.71251,0.1695,0.033292},
+        {0.7147,0.17995,0.028947},
+        {0.71729,0.1905,0.02547},
+        {0.72021,0.20107,0.022733},
+        {0.72342,0.21166,0.020622},
+        {0.72685,0.22214,0.019034},
+        {0.73046,0.23256,0.017876},
+        {0.73419,0.24288,0.017071},
+        {0.73802,0.25311,0.016547},
+        {0.74191,0.26323,0.016249},
+        {0.74585,0.27322,0.016125},
+        {0.74979,0.28311,0.016137},
+        {0.75375,0.29288,0.01625},
+        {0.75769,0.30257,0.01644},
+        {0.76161,0.31217,0.016684},
+        {0.7655,0.32171,0.016989},
+        {0.76932,0.33117,0.017296},
+        {0.7731,0.34058,0.0176},
+        {0.77681,0.34994,0.017896},
+        {0.78044,0.35925,0.018177},
+        {0.784,0.36855,0.018435},
+        {0.78746,0.37783,0.018665},
+        {0.79082,0.38709,0.018861},
+        {0.79409,0.39636,0.019014},
+        {0.79724,0.40564,0.019122},
+        {0.80029,0.4149,0.019179},
+        {0.80322,0.42418,0.019183},
+        {0.80605,0.43346,0.019132},
+        {0.80876,0.44276,0.019026},
+        {0.81136,0.45205,0.018866},
+        {0.81386,0.46134,0.018654},
+        {0.81626,0.47063,0.018394},
+        {0.81857,0.47992,0.01809},
+        {0.8208,0.48918,0.017747},
+        {0.82295,0.49846,0.017369},
+        {0.82503,0.50771,0.016963},
+        {0.82704,0.51694,0.016575},
+        {0.82898,0.52615,0.016225},
+        {0.83084,0.53532,0.015949},
+        {0.83262,0.54446,0.015792},
+        {0.83431,0.55354,0.01582},
+        {0.8359,0.56257,0.016118},
+        {0.83738,0.5715,0.016798},
+        {0.8387,0.58035,0.018004},
+        {0.83985,0.58906,0.019918},
+        {0.84077,0.59761,0.022763},
+        {0.84143,0.60595,0.02681},
+        {0.84177,0.61404,0.032376},
+        {0.84173,0.62182,0.040011},
+        {0.84125,0.62922,0.04912},
+        {0.84026,0.63619,0.059305},
+        {0.83868,0.64264,0.070471},
+        {0.83647,0.6485,0.08264},
+        {0.83356,0.65372,0.095596},
+        {0.82989,0.65824,0.10926},
+        {0.82544,0.66201,0.12343},
+        {0.82017,0.66498,0.13819},
+        {0.81408,0.66715,0.15321},
+        {0.80717,0.66852,0.16856},
+        {0.79947,0.66908,0.18405},
+        {0.79098,0.66887,0.19961},
+        {0.78178,0.66795,0.2152},
+        {0.7719,0.66635,0.23072},
+        {0.76139,0.66416,0.2461},
+        {0.75032,0.66143,0.26133},
+        {0.73873,0.65825,0.27636},
+        {0.72668,0.65467,0.29113},
+        {0.71421,0.65077,0.30567},
+        {0.70137,0.64662,0.31995},
+        {0.68818,0.64226,0.33397},
+        {0.67466,0.63773,0.34774},
+        {0.66084,0.6331,0.36127},
+        {0.64671,0.62838,0.37458},
+        {0.63228,0.6236,0.38765},
+        {0.61753,0.61878,0.40056},
+        {0.60245,0.61393,0.41326},
+        {0.58703,0.60909,0.42578},
+        {0.57126,0.60423,0.43817},
+        {0.55511,0.59936,0.4504},
+        {0.53858,0.59449,0.4625},
+        {0.5216,0.58962,0.47451},
+        {0.5042,0.58475,0.4864},
+        {0.48632,0.57986,0.49821},
+        {0.46796,0.57493,0.50993},
+        {0.44912,0.56996,0.5216},
+        {0.42978,0.56493,0.53322},
+        {0.40998,0.55983,0.5448},
+        {0.38972,0.55461,0.55635},
+        {0.36908,0.54926,0.56789},
+        {0.3481,0.54375,0.57943},
+        {0.32688,0.53805,0.59098},
+        {0.30556,0.53211,0.60256},
+        {0.28424,0.52592,0.61416},
+        {0.26316,0.51945,0.62583},
+        {0.2425,0.51265,0.63755},
+        {0.22257,0.50551,0.64934},
+        {0.20368,0.49802,0.66119},
+        {0.18619,0.49012,0.67313},
+        {0.17051,0.48183,0.68514},
+        {0.15712,0.47312,0.69723},
+        {0.14638,0.46402,0.70941},
+        {0.13859,0.4545,0.72164},
+        {0.1338,0.44458,0.73395},
+        {0.1319,0.43426,0.7463},
+        {0.13253,0.42359,0.75869},
+        {0.13519,0.4126,0.77109},
+        {0.1393,0.40128,0.7835},
+        {0.1445,0.38969,0.79588},
+        {0.15024,0.3779,0.80821},
+        {0.1563,0.36594,0.82045},
+        {0.16246,0.35387,0.83257},
+        {0.16864,0.34179,0.84452},
+        {0.17484,0.32979,0.85623},
+        {0.18105,0.31794,0.86767},
+        {0.18746,0.30639,0.87875},
+        {0.19408,0.29524,0.88943},
+        {0.20101,0.28465,0.89962},
+        {0.20848,0.27478,0.90926},
+        {0.2165,0.26579,0.9183},
+        {0.22506,0.25778,0.92668},
+        {0.2343,0.25098,0.93436}
+    },
+    {
+        {0.93769,0.33352,0.94809},
+        {0.94383,0.34283,0.94239},
+        {0.94939,0.35275,0.93613},
+        {0.95439,0.36323,0.92931},
+        {0.95886,0.37422,0.92198},
+        {0.96283,0.38558,0.91416},
+        {0.96634,0.39727,0.90588},
+        {0.96944,0.40921,0.89721},
+        {0.97216,0.4213,0.88817},
+        {0.97454,0.4335,0.87883},
+        {0.97663,0.44573,0.86923},
+        {0.97845,0.45797,0.8594},
+        {0.98004,0.47017,0.84939},
+        {0.98142,0.48228,0.83922},
+        {0.98262,0.4943,0.82894},
+        {0.98364,0.5062,0.81854},
+        {0.98453,0.51799,0.80808},
+        {0.98527,0.52964,0.79753},
+        {0.98588,0.54116,0.78694},
+        {0.98637,0.55255,0.77629},
+        {0.98676,0.56382,0.76559},
+        {0.98704,0.57494,0.75486},
+        {0.98722,0.58595,0.74407},
+        {0.98733,0.59683,0.73326},
+        {0.98736,0.60758,0.72241},
+        {0.98732,0.61821,0.71153},
+        {0.98723,0.62871,0.7006},
+        {0.9871,0.63909,0.68965},
+        {0.98694,0.64936,0.67864},
+        {0.98677,0.65949,0.66762},
+        {0.9866,0.6695,0.65654},
+        {0.98644,0.67938,0.64543},
+        {0.9863,0.68916,0.63428},
+        {0.98621,0.69879,0.62309},
+        {0.98616,0.70831,0.61184},
+        {0.98617,0.71772,0.60055},
+        {0.98624,0.727,0.5892},
+        {0.98636,0.73618,0.57779},
+        {0.98653,0.74526,0.56632},
+        {0.98675,0.75426,0.55476},
+        {0.98702,0.76315,0.54311},
+        {0.98731,0.77198,0.53134},
+        {0.98761,0.78074,0.51946},
+        {0.98792,0.78944,0.50744},
+        {0.9882,0.79807,0.49526},
+        {0.98845,0.80666,0.48291},
+        {0.98864,0.81518,0.47039},
+        {0.98875,0.82365,0.45765},
+        {0.98875,0.83206,0.4447},
+        {0.98863,0.84039,0.43151},
+        {0.98834,0.84863,0.41804},
+        {0.98786,0.85677,0.40433},
+        {0.98715,0.86476,0.39033},
+        {0.98616,0.87259,0.37607},
+        {0.98485,0.8802,0.36152},
+        {0.98316,0.88754,0.3467},
+        {0.98105,0.89458,0.33163},
+        {0.97845,0.90123,0.31637},
+        {0.97534,0.90744,0.30092},
+        {0.97166,0.91315,0.28537},
+        {0.96737,0.91831,0.26983},
+        {0.96244,0.92285,0.25432},
+        {0.95686,0.92672,0.23895},
+        {0.95064,0.9299,0.22388},
+        {0.94377,0.93236,0.2092},
+        {0.93628,0.9341,0.19506},
+        {0.9282,0.93512,0.18153},
+        {0.91959,0.93544,0.16884},
+        {0.91047,0.9351,0.15697},
+        {0.90091,0.93414,0.1461},
+        {0.89097,0.93263,0.13623},
+        {0.8807,0.93061,0.12747},
+        {0.87014,0.92815,0.11977},
+        {0.85937,0.92531,0.11315},
+        {0.8484,0.92216,0.10742},
+        {0.83729,0.91874,0.10257},
+        {0.82605,0.91511,0.098502},
+        {0.81472,0.91132,0.095091},
+        {0.80332,0.90739,0.092162},
+        {0.79187,0.90336,0.089659},
+        {0.78036,0.89925,0.087518},
+        {0.76881,0.89508,0.08551},
+        {0.75723,0.89086,0.083837},
+        {0.74562,0.88662,0.082243},
+        {0.73398,0.88235,0.080673},
+        {0.7223,0.87807,0.079194},
+        {0.7106,0.87376,0.077792},
+        {0.69886,0.86946,0.076415},
+        {0.6871,0.86514,0.075063},
+        {0.67529,0.86082,0.073757},
+        {0.66346,0.85649,0.072319},
+        {0.65156,0.85215,0.071005},
+        {0.63963,0.8478,0.069678},
+        {0.62764,0.84345,0.068313},
+        {0.6156,0.83909,0.066946},
+        {0.60351,0.83473,0.065602},
+        {0.59134,0.83035,0.064284},
+        {0.57911,0.82597,0.063016},
+        {0.56681,0.82158,0.061599},
+        {0.55443,0.81718,0.060374},
+        {0.54195,0.81278,0.059088},
+        {0.5294,0.80837,0.057695},
+        {0.51672,0.80395,0.056522},
+        {0.50395,0.79952,0.055189},
+        {0.49106,0.79508,0.053903},
+        {0.47801,0.79064,0.052644},
+        {0.46484,0.78619,0.051424},
+        {0.45151,0.78173,0.050257},
+        {0.43803,0.77726,0.04922},
+        {0.42437,0.77277,0.04812},
+        {0.41056,0.76827,0.047322},
+        {0.39656,0.76375,0.04674},
+        {0.38239,0.75922,0.046427},
+        {0.36808,0.75466,0.046596},
+        {0.35361,0.75006,0.047299},
+        {0.33906,0.74543,0.04874},
+        {0.32443,0.74075,0.050897},
+        {0.30984,0.73602,0.054069},
+        {0.29532,0.73122,0.058336},
+        {0.28105,0.72634,0.063783},
+        {0.26717,0.72137,0.070322},
+        {0.25387,0.71631,0.077992},
+        {0.24134,0.71112,0.08687},
+        {0.22981,0.7058,0.096608},
+        {0.21961,0.70035,0.10741},
+        {0.21092,0.69475,0.11899},
+        {0.204,0.68901,0.13129},
+        {0.19894,0.6831,0.14422},
+        {0.19593,0.67703,0.15768},
+        {0.19486,0.67081,0.17161},
+        {0.1956,0.66443,0.18594},
+        {0.19795,0.65791,0.2005},
+        {0.20163,0.65125,0.21533},
+        {0.20639,0.64446,0.2303},
+        {0.21183,0.63756,0.24538},
+        {0.21771,0.63057,0.26052},
+        {0.22381,0.62348,0.27565},
+        {0.22992,0.61632,0.29071},
+        {0.23593,0.6091,0.30574},
+        {0.24162,0.60182,0.32064},
+        {0.24693,0.5945,0.33543},
+        {0.25184,0.58716,0.35008},
+        {0.25622,0.5798,0.36459},
+        {0.26011,0.57242,0.37897},
+        {0.26346,0.56501,0.3932},
+        {0.26624,0.55762,0.4073},
+        {0.26846,0.55021,0.42127},
+        {0.27013,0.5428,0.43513},
+        {0.27122,0.53539,0.44886},
+        {0.27173,0.52798,0.46247},
+        {0.2717,0.52057,0.476},
+        {0.27112,0.51317,0.48942},
+        {0.26997,0.50576,0.50275},
+        {0.26823,0.49837,0.516},
+        {0.26598,0.49096,0.52919},
+        {0.26316,0.48352,0.54228},
+        {0.25982,0.4761,0.55529},
+        {0.25594,0.46864,0.56822},
+        {0.25162,0.46117,0.58105},
+        {0.2468,0.45365,0.5938},
+        {0.24161,0.44609,0.60643},
+        {0.23605,0.43849,0.61894},
+        {0.23017,0.43081,0.63131},
+        {0.2241,0.42303,0.64353},
+        {0.21793,0.41517,0.6556},
+        {0.2117,0.40718,0.66749},
+        {0.2055,0.39906,0.67919},
+        {0.19945,0.39079,0.6907},
+        {0.19367,0.38234,0.70201},
+        {0.18818,0.37372,0.71312},
+        {0.183,0.36488,0.72404},
+        {0.17829,0.35585,0.73477},
+        {0.17392,0.34657,0.7453},
+        {0.16999,0.33707,0.75566},
+        {0.16639,0.32732,0.76586},
+        {0.16312,0.31735,0.7759},
+        {0.16005,0.30712,0.78581},
+        {0.15724,0.29667,0.79557},
+        {0.15457,0.28595,0.80522},
+        {0.15202,0.27505,0.81474},
+        {0.14966,0.26395,0.82414},
+        {0.14744,0.25264,0.8334},
+        {0.14554,0.24118,0.84252},
+        {0.14402,0.2296,0.85145},
+        {0.14312,0.218,0.86019},
+        {0.14305,0.20639,0.86869},
+        {0.14404,0.19481,0.87691},
+        {0.1463,0.18336,0.88484},
+        {0.15007,0.17219,0.89241},
+        {0.15537,0.1614,0.8996},
+        {0.1623,0.15103,0.90637},
+        {0.17075,0.14136,0.9127},
+        {0.18062,0.13244,0.91856},
+        {0.19173,0.12446,0.92396},
+        {0.20389,0.11765,0.92889},
+        {0.21681,0.11214,0.93335},
+        {0.23028,0.10794,0.93739},
+        {0.24417,0.10525,0.94101},
+        {0.25828,0.10403,0.94425},
+        {0.27246,0.10417,0.94716},
+        {0.28659,0.1056,0.94977},
+        {0.30059,0.10807,0.95212},
+        {0.3144,0.11153,0.95426},
+        {0.32796,0.11565,0.95622},
+        {0.34126,0.12031,0.95803},
+        {0.35426,0.12544,0.95973},
+        {0.36698,0.13084,0.96134},
+        {0.37942,0.13637,0.96288},
+        {0.3916,0.1421,0.96436},
+        {0.40352,0.14786,0.96581},
+        {0.4152,0.15363,0.96722},
+        {0.42669,0.15941,0.9686},
+        {0.43799,0.16515,0.96996},
+        {0.44913,0.17088,0.97129},
+        {0.46013,0.1765,0.97261},
+        {0.47106,0.18204,0.97389},
+        {0.48191,0.18751,0.97514},
+        {0.49273,0.1928,0.97635},
+        {0.50357,0.19798,0.97752},
+        {0.51446,0.20302,0.97863},
+        {0.52541,0.2079,0.97969},
+        {0.53647,0.21259,0.98067},
+        {0.54767,0.21709,0.98157},
+        {0.55903,0.22137,0.98238},
+        {0.57057,0.22542,0.9831},
+        {0.5823,0.22925,0.98372},
+        {0.59423,0.23284,0.98424},
+        {0.60636,0.23623,0.98465},
+        {0.61868,0.23935,0.98497},
+        {0.63116,0.24227,0.98518},
+        {0.64379,0.24496,0.9853},
+        {0.65656,0.2475,0.98533},
+        {0.66943,0.24982,0.98527},
+        {0.68237,0.25203,0.98515},
+        {0.69537,0.25408,0.98496},
+        {0.70839,0.25601,0.98471},
+        {0.72139,0.25786,0.98441},
+        {0.73437,0.25968,0.98405},
+        {0.74728,0.26143,0.98365},
+        {0.76012,0.26319,0.98321},
+        {0.77286,0.26494,0.98271},
+        {0.78548,0.26676,0.98216},
+        {0.79794,0.26867,0.98153},
+        {0.81023,0.27069,0.98082},
+        {0.82233,0.27285,0.98001},
+        {0.83418,0.27525,0.97905},
+        {0.84576,0.27791,0.97793},
+        {0.85702,0.28089,0.97661},
+        {0.86794,0.2843,0.97504},
+        {0.87845,0.28819,0.97317},
+        {0.88852,0.29263,0.97097},
+        {0.8981,0.29768,0.96837},
+        {0.90717,0.3034,0.96533},
+        {0.91567,0.30984,0.96182},
+        {0.92361,0.317,0.9578},
+        {0.93095,0.32489,0.95323}
+    },
+    {
+        {0.18062,0.13244,0.91856},
+        {0.19173,0.12446,0.92396},
+        {0.20389,0.11765,0.92889},
+        {0.21681,0.11214,0.93335},
+        {0.23028,0.10794,0.93739},
+        {0.24417,0.10525,0.94101},
+        {0.25828,0.10403,0.94425},
+        {0.27246,0.10417,0.94716},
+        {0.28659,0.1056,0.94977},
+        {0.30059,0.10807,0.95212},
+        {0.3144,0.11153,0.95426},
+        {0.32796,0.11565,0.95622},
+        {0.34126,0.12031,0.95803},
+        {0.35426,0.12544,0.95973},
+        {0.36698,0.13084,0.96134},
+        {0.37942,0.13637,0.96288},
+        {0.3916,0.1421,0.96436},
+        {0.40352,0.14786,0.96581},
+        {0.4152,0.15363,0.96722},
+        {0.42669,0.15941,0.9686},
+        {0.43799,0.16515,0.96996},
+        {0.44913,0.17088,0.97129},
+        {0.46013,0.1765,0.97261},
+        {0.47106,0.18204,0.97389},
+        {0.48191,0.18751,0.97514},
+        {0.49273,0.1928,0.97635},
+        {0.50357,0.19798,0.97752},
+        {0.51446,0.20302,0.97863},
+        {0.52541,0.2079,0.97969},
+        {0.53647,0.21259,0.98067},
+        {0.54767,0.21709,0.98157},
+        {0.55903,0.22137,0.98238},
+        {0.57057,0.22542,0.9831},
+        {0.5823,0.22925,0.98372},
+        {0.59423,0.23284,0.98424},
+        {0.60636,0.23623,0.98465},
+        {0.61868,0.23935,0.98497},
+        {0.63116,0.24227,0.98518},
+        {0.64379,0.24496,0.9853},
+        {0.65656,0.2475,0.98533},
+        {0.66943,0.24982,0.98527},
+        {0.68237,0.25203,0.98515},
+        {0.69537,0.25408,0.98496},
+        {0.70839,0.25601,0.98471},
+        {0.72139,0.25786,0.98441},
+        {0.73437,0.25968,0.98405},
+        {0.74728,0.26143,0.98365},
+        {0.76012,0.26319,0.98321},
+        {0.77286,0.26494,0.98271},
+        {0.78548,0.26676,0.98216},
+        {0.79794,0.26867,0.98153},
+        {0.81023,0.27069,0.98082},
+        {0.82233,0.27285,0.98001},
+        {0.83418,0.27525,0.97905},
+        {0.84576,0.27791,0.97793},
+        {0.85702,0.28089,0.97661},
+        {0.86794,0.2843,0.97504},
+        {0.87845,0.28819,0.97317},
+        {0.88852,0.29263,0.97097},
+        {0.8981,0.29768,0.96837},
+        {0.90717,0.3034,0.96533},
+        {0.91567,0.30984,0.96182},
+        {0.92361,0.317,0.9578},
+        {0.93095,0.32489,0.95323},
+        {0.93769,0.33352,0.94809},
+        {0.94383,0.34283,0.94239},
+        {0.94939,0.35275,0.93613},
+        {0.95439,0.36323,0.92931},
+        {0.95886,0.37422,0.92198},
+        {0.96283,0.38558,0.91416},
+        {0.96634,0.39727,0.90588},
+        {0.96944,0.40921,0.89721},
+        {0.97216,0.4213,0.88817},
+        {0.97454,0.4335,0.87883},
+        {0.97663,0.44573,0.86923},
+        {0.97845,0.45797,0.8594},
+        {0.98004,0.47017,0.84939},
+        {0.98142,0.48228,0.83922},
+        {0.98262,0.4943,0.82894},
+        {0.98364,0.5062,0.81854},
+        {0.98453,0.51799,0.80808},
+        {0.98527,0.52964,0.79753},
+        {0.98588,0.54116,0.78694},
+        {0.98637,0.55255,0.77629},
+        {0.98676,0.56382,0.76559},
+        {0.98704,0.57494,0.75486},
+        {0.98722,0.58595,0.74407},
+        {0.98733,0.59683,0.73326},
+        {0.98736,0.60758,0.72241},
+        {0.98732,0.61821,0.71153},
+        {0.98723,0.62871,0.7006},
+        {0.9871,0.63909,0.68965},
+        {0.98694,0.64936,0.67864},
+        {0.98677,0.65949,0.66762},
+        {0.9866,0.6695,0.65654},
+        {0.98644,0.67938,0.64543},
+        {0.9863,0.68916,0.63428},
+        {0.98621,0.69879,0.62309},
+        {0.98616,0.70831,0.61184},
+        {0.98617,0.71772,0.60055},
+        {0.98624,0.727,0.5892},
+        {0.98636,0.73618,0.57779},
+        {0.98653,0.74526,0.56632},
+        {0.98675,0.75426,0.55476},
+        {0.98702,0.76315,0.54311},
+        {0.98731,0.77198,0.53134},
+        {0.98761,0.78074,0.51946},
+        {0.98792,0.78944,0.50744},
+        {0.9882,0.79807,0.49526},
+        {0.98845,0.80666,0.48291},
+        {0.98864,0.81518,0.47039},
+        {0.98875,0.82365,0.45765},
+        {0.98875,0.83206,0.4447},
+        {0.98863,0.84039,0.43151},
+        {0.98834,0.84863,0.41804},
+        {0.98786,0.85677,0.40433},
+        {0.98715,0.86476,0.39033},
+        {0.98616,0.87259,0.37607},
+        {0.98485,0.8802,0.36152},
+        {0.98316,0.88754,0.3467},
+        {0.98105,0.89458,0.33163},
+        {0.97845,0.90123,0.31637},
+        {0.97534,0.90744,0.30092},
+        {0.97166,0.91315,0.28537},
+        {0.96737,0.91831,0.26983},
+        {0.96244,0.92285,0.25432},
+        {0.95686,0.92672,0.23895},
+        {0.95064,0.9299,0.22388},
+        {0.94377,0.93236,0.2092},
+        {0.93628,0.9341,0.19506},
+        {0.9282,0.93512,0.18153},
+        {0.91959,0.93544,0.16884},
+        {0.91047,0.9351,0.15697},
+        {0.90091,0.93414,0.1461},
+        {0.89097,0.93263,0.13623},
+        {0.8807,0.93061,0.12747},
+        {0.87014,0.92815,0.11977},
+        {0.85937,0.92531,0.11315},
+        {0.8484,0.92216,0.10742},
+        {0.83729,0.91874,0.10257},
+        {0.82605,0.91511,0.098502},
+        {0.81472,0.91132,0.095091},
+        {0.80332,0.90739,0.092162},
+        {0.79187,0.90336,0.089659},
+        {0.78036,0.89925,0.087518},
+        {0.76881,0.89508,0.08551},
+        {0.75723,0.89086,0.083837},
+        {0.74562,0.88662,0.082243},
+        {0.73398,0.88235,0.080673},
+        {0.7223,0.87807,0.079194},
+        {0.7106,0.87376,0.077792},
+        {0.69886,0.86946,0.076415},
+        {0.6871,0.86514,0.075063},
+        {0.67529,0.86082,0.073757},
+        {0.66346,0.85649,0.072319},
+        {0.65156,0.85215,0.071005},
+        {0.63963,0.8478,0.069678},
+        {0.62764,0.84345,0.068313},
+        {0.6156,0.83909,0.066946},
+        {0.60351,0.83473,0.065602},
+        {0.59134,0.83035,0.064284},
+        {0.57911,0.82597,0.063016},
+        {0.56681,0.82158,0.061599},
+        {0.55443,0.81718,0.060374},
+        {0.54195,0.81278,0.059088},
+        {0.5294,0.80837,0.057695},
+        {0.51672,0.80395,0.056522},
+        {0.50395,0.79952,0.055189},
+        {0.49106,0.79508,0.053903},
+        {0.47801,0.79064,0.052644},
+        {0.46484,0.78619,0.051424},
+        {0.45151,0.78173,0.050257},
+        {0.43803,0.77726,0.04922},
+        {0.42437,0.77277,0.04812},
+        {0.41056,0.76827,0.047322},
+        {0.39656,0.76375,0.04674},
+        {0.38239,0.75922,0.046427},
+        {0.36808,0.75466,0.046596},
+        {0.35361,0.75006,0.047299},
+        {0.33906,0.74543,0.04874},
+        {0.32443,0.74075,0.050897},
+        {0.30984,0.73602,0.054069},
+        {0.29532,0.73122,0.058336},
+        {0.28105,0.72634,0.063783},
+        {0.26717,0.72137,0.070322},
+        {0.25387,0.71631,0.077992},
+        {0.24134,0.71112,0.08687},
+        {0.22981,0.7058,0.096608},
+        {0.21961,0.70035,0.10741},
+        {0.21092,0.69475,0.11899},
+        {0.204,0.68901,0.13129},
+        {0.19894,0.6831,0.14422},
+        {0.19593,0.67703,0.15768},
+        {0.19486,0.67081,0.17161},
+        {0.1956,0.66443,0.18594},
+        {0.19795,0.65791,0.2005},
+        {0.20163,0.65125,0.21533},
+        {0.20639,0.64446,0.2303},
+        {0.21183,0.63756,0.24538},
+        {0.21771,0.63057,0.26052},
+        {0.22381,0.62348,0.27565},
+        {0.22992,0.61632,0.29071},
+        {0.23593,0.6091,0.30574},
+        {0.24162,0.60182,0.32064},
+        {0.24693,0.5945,0.33543},
+        {0.25184,0.58716,0.35008},
+        {0.25622,0.5798,0.36459},
+        {0.26011,0.57242,0.37897},
+        {0.26346,0.56501,0.3932},
+        {0.26624,0.55762,0.4073},
+        {0.26846,0.55021,0.42127},
+        {0.27013,0.5428,0.43513},
+        {0.27122,0.53539,0.44886},
+        {0.27173,0.52798,0.46247},
+        {0.2717,0.52057,0.476},
+        {0.27112,0.51317,0.48942},
+        {0.26997,0.50576,0.50275},
+        {0.26823,0.49837,0.516},
+        {0.26598,0.49096,0.52919},
+        {0.26316,0.48352,0.54228},
+        {0.25982,0.4761,0.55529},
+        {0.25594,0.46864,0.56822},
+        {0.25162,0.46117,0.58105},
+        {0.2468,0.45365,0.5938},
+        {0.24161,0.44609,0.60643},
+        {0.23605,0.43849,0.61894},
+        {0.23017,0.43081,0.63131},
+        {0.2241,0.42303,0.64353},
+        {0.21793,0.41517,0.6556},
+        {0.2117,0.40718,0.66749},
+        {0.2055,0.39906,0.67919},
+        {0.19945,0.39079,0.6907},
+        {0.19367,0.38234,0.70201},
+        {0.18818,0.37372,0.71312},
+        {0.183,0.36488,0.72404},
+        {0.17829,0.35585,0.73477},
+        {0.17392,0.34657,0.7453},
+        {0.16999,0.33707,0.75566},
+        {0.16639,0.32732,0.76586},
+        {0.16312,0.31735,0.7759},
+        {0.16005,0.30712,0.78581},
+        {0.15724,0.29667,0.79557},
+        {0.15457,0.28595,0.80522},
+        {0.15202,0.27505,0.81474},
+        {0.14966,0.26395,0.82414},
+        {0.14744,0.25264,0.8334},
+        {0.14554,0.24118,0.84252},
+        {0.14402,0.2296,0.85145},
+        {0.14312,0.218,0.86019},
+        {0.14305,0.20639,0.86869},
+        {0.14404,0.19481,0.87691},
+        {0.1463,0.18336,0.88484},
+        {0.15007,0.17219,0.89241},
+        {0.15537,0.1614,0.8996},
+        {0.1623,0.15103,0.90637},
+        {0.17075,0.14136,0.9127}
+    },
+    {
+        {0.873,0.83593,0.84864},
+        {0.8777,0.8339,0.84071},
+        {0.88194,0.83075,0.832},
+        {0.88572,0.82651,0.82253},
+        {0.88906,0.82126,0.81236},
+        {0.89199,0.81507,0.80154},
+        {0.89451,0.80802,0.79013},
+        {0.89666,0.80023,0.77819},
+        {0.89847,0.79178,0.76581},
+        {0.89996,0.78278,0.75305},
+        {0.90116,0.77331,0.73999},
+        {0.9021,0.76347,0.72667},
+        {0.9028,0.75332,0.71316},
+        {0.90327,0.74294,0.69952},
+        {0.90355,0.73237,0.68579},
+        {0.90363,0.72166,0.67199},
+        {0.90355,0.71085,0.65815},
+        {0.9033,0.69996,0.64429},
+        {0.90289,0.68903,0.63046},
+        {0.90234,0.67804,0.61663},
+        {0.90165,0.66702,0.60282},
+        {0.90082,0.65598,0.58904},
+        {0.89986,0.64492,0.57531},
+        {0.89877,0.63386,0.56162},
+        {0.89757,0.62278,0.54797},
+        {0.89623,0.61169,0.53437},
+        {0.89478,0.60058,0.52081},
+        {0.8932,0.58945,0.5073},
+        {0.89151,0.57831,0.49383},
+        {0.8897,0.56715,0.48041},
+        {0.88777,0.55595,0.46704},
+        {0.88574,0.54474,0.4537},
+        {0.88359,0.53349,0.44042},
+        {0.88134,0.52221,0.42718},
+        {0.87897,0.5109,0.41398},
+        {0.87649,0.49954,0.40083},
+        {0.87391,0.48816,0.3877},
+        {0.87123,0.4767,0.37464},
+        {0.86845,0.4652,0.3616},
+        {0.86556,0.45364,0.34861},
+        {0.86257,0.44202,0.33566},
+        {0.85948,0.43032,0.32274},
+        {0.8563,0.41853,0.30985},
+        {0.85302,0.40666,0.29699},
+        {0.84965,0.3947,0.28415},
+        {0.84618,0.38265,0.27137},
+        {0.84264,0.3705,0.25865},
+        {0.83901,0.35827,0.24597},
+        {0.83532,0.34594,0.23336},
+        {0.83157,0.33356,0.22089},
+        {0.82777,0.3211,0.20848},
+        {0.82395,0.30862,0.19626},
+        {0.82013,0.29614,0.1842},
+        {0.81634,0.28375,0.17242},
+        {0.81259,0.2715,0.16099},
+        {0.80896,0.25953,0.14996},
+        {0.80546,0.24792,0.1394},
+        {0.80217,0.23683,0.12955},
+        {0.79914,0.22645,0.1204},
+        {0.7964,0.21697,0.11224},
+        {0.79405,0.20862,0.10504},
+        {0.79209,0.20162,0.099146},
+        {0.79061,0.19625,0.094653},
+        {0.78962,0.19261,0.091622},
+        {0.78916,0.19089,0.090163},
+        {0.78923,0.19116,0.09039},
+        {0.78984,0.19342,0.092261},
+        {0.79096,0.19754,0.095704},
+        {0.79258,0.20339,0.10062},
+        {0.79465,0.21076,0.10693},
+        {0.79711,0.21943,0.11431},
+        {0.79994,0.22917,0.12278},
+        {0.80304,0.23975,0.13216},
+        {0.8064,0.251,0.14222},
+        {0.80993,0.26273,0.15286},
+        {0.81359,0.27479,0.16406},
+        {0.81735,0.28707,0.17556},
+        {0.82116,0.29951,0.18745},
+        {0.82498,0.31196,0.1995},
+        {0.8288,0.32444,0.21181},
+        {0.83258,0.33689,0.2242},
+        {0.83632,0.34927,0.23677},
+        {0.84,0.36157,0.24937},
+        {0.84359,0.37378,0.26206},
+        {0.84712,0.38589,0.27479},
+        {0.85056,0.39792,0.28758},
+        {0.8539,0.40986,0.30042},
+        {0.85716,0.42169,0.3133},
+        {0.86032,0.43345,0.32618},
+        {0.86338,0.44514,0.33913},
+        {0.86634,0.45674,0.35208},
+        {0.8692,0.46829,0.36509},
+        {0.87196,0.47978,0.37813},
+        {0.87462,0.49122,0.39122},
+        {0.87716,0.50259,0.40434},
+        {0.87961,0.51395,0.41751},
+        {0.88195,0.52525,0.43072},
+        {0.88418,0.53652,0.44398},
+        {0.8863,0.54775,0.45727},
+        {0.8883,0.55896,0.47062},
+        {0.89019,0.57014,0.484},
+        {0.89197,0.5813,0.49745},
+        {0.89363,0.59245,0.51092},
+        {0.89518,0.60356,0.52444},
+        {0.8966,0.61466,0.53802},
+        {0.8979,0.62575,0.55163},
+        {0.89908,0.63683,0.56528},
+        {0.90012,0.64788,0.579},
+        {0.90103,0.65892,0.59275},
+        {0.9018,0.66994,0.60654},
+        {0.90242,0.6809,0.62037},
+        {0.90287,0.69183,0.63422},
+        {0.90316,0.70268,0.64808},
+        {0.90325,0.71344,0.66197},
+        {0.90314,0.72408,0.67583},
+        {0.9028,0.73456,0.68967},
+        {0.9022,0.74481,0.70344},
+        {0.90131,0.7548,0.71713},
+        {0.90011,0.76443,0.73066},
+        {0.89855,0.77364,0.74401},
+        {0.8966,0.78234,0.75711},
+        {0.89423,0.79041,0.7699},
+        {0.8914,0.79778,0.7823},
+        {0.88809,0.80433,0.79423},
+        {0.88427,0.80997,0.80561},
+        {0.87992,0.81463,0.8164},
+        {0.87505,0.81822,0.8265},
+        {0.86966,0.82071,0.83587},
+        {0.86376,0.82205,0.84446},
+        {0.85737,0.82224,0.85225},
+        {0.85052,0.8213,0.85923},
+        {0.84325,0.81927,0.8654},
+        {0.8356,0.81621,0.87079},
+        {0.8276,0.81219,0.87544},
+        {0.81931,0.80731,0.8794},
+        {0.81075,0.80165,0.88274},
+        {0.80198,0.79534,0.88552},
+        {0.79302,0.78846,0.88781},
+        {0.7839,0.78111,0.88969},
+        {0.77463,0.77338,0.89122},
+        {0.76527,0.76536,0.89246},
+        {0.75579,0.75709,0.89345},
+        {0.74622,0.74866,0.89427},
+        {0.73657,0.7401,0.89494},
+        {0.72685,0.73145,0.89549},
+        {0.71705,0.72274,0.89595},
+        {0.70717,0.71401,0.89635},
+        {0.69722,0.70526,0.89669},
+        {0.68719,0.69651,0.89699},
+        {0.67709,0.68776,0.89726},
+        {0.66689,0.67902,0.8975},
+        {0.65663,0.67032,0.89772},
+        {0.64625,0.66163,0.89792},
+        {0.63579,0.65297,0.89811},
+        {0.62522,0.64434,0.89828},
+        {0.61453,0.63573,0.89844},
+        {0.60375,0.62715,0.89859},
+        {0.59283,0.6186,0.89872},
+        {0.58178,0.61007,0.89884},
+        {0.57059,0.60157,0.89894},
+        {0.55925,0.59311,0.89902},
+        {0.54776,0.58467,0.8991},
+        {0.53609,0.57626,0.89915},
+        {0.52424,0.56787,0.8992},
+        {0.51219,0.55952,0.89923},
+        {0.49993,0.5512,0.89925},
+        {0.48745,0.54291,0.89925},
+        {0.47471,0.53465,0.89924},
+        {0.46169,0.52643,0.89922},
+        {0.44837,0.51823,0.89918},
+        {0.43473,0.51007,0.89913},
+        {0.42073,0.50196,0.89907},
+        {0.40637,0.49389,0.899},
+        {0.39159,0.48588,0.89891},
+        {0.37638,0.47795,0.89881},
+        {0.36067,0.47012,0.8987},
+        {0.34449,0.46237,0.89858},
+        {0.32777,0.45477,0.89845},
+        {0.31053,0.44731,0.89832},
+        {0.29269,0.44007,0.89817},
+        {0.27432,0.43307,0.89802},
+        {0.25544,0.42636,0.89787},
+        {0.23609,0.42002,0.89772},
+        {0.21638,0.4141,0.89757},
+        {0.19647,0.40866,0.89743},
+        {0.17659,0.40379,0.89729},
+        {0.15722,0.39953,0.89717},
+        {0.13894,0.39598,0.89707},
+        {0.1226,0.39316,0.89698},
+        {0.10959,0.39116,0.89692},
+        {0.1011,0.38996,0.89689},
+        {0.098617,0.38962,0.89687},
+        {0.10246,0.39014,0.89689},
+        {0.11205,0.39152,0.89693},
+        {0.12596,0.39371,0.897},
+        {0.14277,0.39668,0.89709},
+        {0.16137,0.40041,0.8972},
+        {0.18085,0.40478,0.89732},
+        {0.20072,0.4098,0.89746},
+        {0.22066,0.41534,0.8976},
+        {0.24027,0.42135,0.89775},
+        {0.25956,0.42779,0.89791},
+        {0.27833,0.43456,0.89806},
+        {0.29659,0.44162,0.8982},
+        {0.31428,0.44891,0.89835},
+        {0.33142,0.45639,0.89848},
+        {0.34803,0.46404,0.89861},
+        {0.3641,0.4718,0.89873},
+        {0.37969,0.47966,0.89883},
+        {0.39481,0.48761,0.89893},
+        {0.40949,0.49562,0.89901},
+        {0.42377,0.5037,0.89909},
+        {0.4377,0.51182,0.89914},
+        {0.45127,0.51998,0.89919},
+        {0.46453,0.52819,0.89922},
+        {0.47747,0.53643,0.89924},
+        {0.49016,0.54469,0.89925},
+        {0.50259,0.55298,0.89924},
+        {0.51481,0.56131,0.89922},
+        {0.52682,0.56967,0.89919},
+        {0.53863,0.57806,0.89914},
+        {0.55025,0.58648,0.89908},
+        {0.56172,0.59493,0.89901},
+        {0.57302,0.60341,0.89892},
+        {0.58417,0.61191,0.89881},
+        {0.59519,0.62045,0.89869},
+        {0.60608,0.629,0.89856},
+        {0.61685,0.63759,0.89841},
+        {0.62751,0.6462,0.89825},
+        {0.63805,0.65483,0.89807},
+        {0.6485,0.66351,0.89788},
+        {0.65884,0.67219,0.89767},
+        {0.6691,0.6809,0.89745},
+        {0.67927,0.68965,0.89721},
+        {0.68936,0.6984,0.89695},
+        {0.69935,0.70719,0.89668},
+        {0.70928,0.71598,0.89638},
+        {0.71911,0.72477,0.89605},
+        {0.72887,0.73355,0.89569},
+        {0.73854,0.7423,0.89528},
+        {0.74812,0.75101,0.89481},
+        {0.75759,0.75963,0.89427},
+        {0.76695,0.76815,0.89362},
+        {0.7762,0.77652,0.89286},
+        {0.78529,0.78468,0.89193},
+        {0.79422,0.79255,0.8908},
+        {0.80295,0.80008,0.88943},
+        {0.81147,0.80717,0.88775},
+        {0.81973,0.81373,0.88571},
+        {0.82771,0.81967,0.88323},
+        {0.83537,0.82487,0.88026},
+        {0.84268,0.82926,0.87672},
+        {0.84961,0.83271,0.87256},
+        {0.85612,0.83516,0.86771},
+        {0.8622,0.83654,0.86213},
+        {0.86783,0.83681,0.85578}
+    },
+    {
+        {0.10246,0.39014,0.89689},
+        {0.11205,0.39152,0.89693},
+        {0.12596,0.39371,0.897},
+        {0.14277,0.39668,0.89709},
+        {0.16137,0.40041,0.8972},
+        {0.18085,0.40478,0.89732},
+        {0.20072,0.4098,0.89746},
+        {0.22066,0.41534,0.8976},
+        {0.24027,0.42135,0.89775},
+        {0.25956,0.42779,0.89791},
+        {0.27833,0.43456,0.89806},
+        {0.29659,0.44162,0.8982},
+        {0.31428,0.44891,0.89835},
+        {0.33142,0.45639,0.89848},
+        {0.34803,0.46404,0.89861},
+        {0.3641,0.4718,0.89873},
+        {0.37969,0.47966,0.89883},
+        {0.39481,0.48761,0.89893},
+        {0.40949,0.49562,0.89901},
+        {0.42377,0.5037,0.89909},
+        {0.4377,0.51182,0.89914},
+        {0.45127,0.51998,0.89919},
+        {0.46453,0.52819,0.89922},
+        {0.47747,0.53643,0.89924},
+        {0.49016,0.54469,0.89925},
+        {0.50259,0.55298,0.89924},
+        {0.51481,0.56131,0.89922},
+        {0.52682,0.56967,0.89919},
+        {0.53863,0.57806,0.89914},
+        {0.55025,0.58648,0.89908},
+        {0.56172,0.59493,0.89901},
+        {0.57302,0.60341,0.89892},
+        {0.58417,0.61191,0.89881},
+        {0.59519,0.62045,0.89869},
+        {0.60608,0.629,0.89856},
+        {0.61685,0.63759,0.89841},
+        {0.62751,0.6462,0.89825},
+        {0.63805,0.65483,0.89807},
+        {0.6485,0.66351,0.89788},
+        {0.65884,0.67219,0.89767},
+        {0.6691,0.6809,0.89745},
+        {0.67927,0.68965,0.89721},
+        {0.68936,0.6984,0.89695},
+        {0.69935,0.70719,0.89668},
+        {0.70928,0.71598,0.89638},
+        {0.71911,0.72477,0.89605},
+        {0.72887,0.73355,0.89569},
+        {0.73854,0.7423,0.89528},
+        {0.74812,0.75101,0.89481},
+        {0.75759,0.75963,0.89427},
+        {0.76695,0.76815,0.89362},
+        {0.7762,0.77652,0.89286},
+        {0.78529,0.78468,0.89193},
+        {0.79422,0.79255,0.8908},
+        {0.80295,0.80008,0.88943},
+        {0.81147,0.80717,0.88775},
+        {0.81973,0.81373,0.88571},
+        {0.82771,0.81967,0.88323},
+        {0.83537,0.82487,0.88026},
+        {0.84268,0.82926,0.87672},
+        {0.84961,0.83271,0.87256},
+        {0.85612,0.83516,0.86771},
+        {0.8622,0.83654,0.86213},
+        {0.86783,0.83681,0.85578},
+        {0.873,0.83593,0.84864},
+        {0.8777,0.8339,0.84071},
+        {0.88194,0.83075,0.832},
+        {0.88572,0.82651,0.82253},
+        {0.88906,0.82126,0.81236},
+        {0.89199,0.81507,0.80154},
+        {0.89451,0.80802,0.79013},
+        {0.89666,0.80023,0.77819},
+        {0.89847,0.79178,0.76581},
+        {0.89996,0.78278,0.75305},
+        {0.90116,0.77331,0.73999},
+        {0.9021,0.76347,0.72667},
+        {0.9028,0.75332,0.71316},
+        {0.90327,0.74294,0.69952},
+        {0.90355,0.73237,0.68579},
+        {0.90363,0.72166,0.67199},
+        {0.90355,0.71085,0.65815},
+        {0.9033,0.69996,0.64429},
+        {0.90289,0.68903,0.63046},
+        {0.90234,0.67804,0.61663},
+        {0.90165,0.66702,0.60282},
+        {0.90082,0.65598,0.58904},
+        {0.89986,0.64492,0.57531},
+        {0.89877,0.63386,0.56162},
+        {0.89757,0.62278,0.54797},
+        {0.89623,0.61169,0.53437},
+        {0.89478,0.60058,0.52081},
+        {0.8932,0.58945,0.5073},
+        {0.89151,0.57831,0.49383},
+        {0.8897,0.56715,0.48041},
+        {0.88777,0.55595,0.46704},
+        {0.88574,0.54474,0.4537},
+        {0.88359,0.53349,0.44042},
+        {0.88134,0.52221,0.42718},
+        {0.87897,0.5109,0.41398},
+        {0.87649,0.49954,0.40083},
+        {0.87391,0.48816,0.3877},
+        {0.87123,0.4767,0.37464},
+        {0.86845,0.4652,0.3616},
+        {0.86556,0.45364,0.34861},
+        {0.86257,0.44202,0.33566},
+        {0.85948,0.43032,0.32274},
+        {0.8563,0.41853,0.30985},
+        {0.85302,0.40666,0.29699},
+        {0.84965,0.3947,0.28415},
+        {0.84618,0.38265,0.27137},
+        {0.84264,0.3705,0.25865},
+        {0.83901,0.35827,0.24597},
+        {0.83532,0.34594,0.23336},
+        {0.83157,0.33356,0.22089},
+        {0.82777,0.3211,0.20848},
+        {0.82395,0.30862,0.19626},
+        {0.82013,0.29614,0.1842},
+        {0.81634,0.28375,0.17242},
+        {0.81259,0.2715,0.16099},
+        {0.80896,0.25953,0.14996},
+        {0.80546,0.24792,0.1394},
+        {0.80217,0.23683,0.12955},
+        {0.79914,0.22645,0.1204},
+        {0.7964,0.21697,0.11224},
+        {0.79405,0.20862,0.10504},
+        {0.79209,0.20162,0.099146},
+        {0.79061,0.19625,0.094653},
+        {0.78962,0.19261,0.091622},
+        {0.78916,0.19089,0.090163},
+        {0.78923,0.19116,0.09039},
+        {0.78984,0.19342,0.092261},
+        {0.79096,0.19754,0.095704},
+        {0.79258,0.20339,0.10062},
+        {0.79465,0.21076,0.10693},
+        {0.79711,0.21943,0.11431},
+        {0.79994,0.22917,0.12278},
+        {0.80304,0.23975,0.13216},
+        {0.8064,0.251,0.14222},
+        {0.80993,0.26273,0.15286},
+        {0.81359,0.27479,0.16406},
+        {0.81735,0.28707,0.17556},
+        {0.82116,0.29951,0.18745},
+        {0.82498,0.31196,0.1995},
+        {0.8288,0.32444,0.21181},
+        {0.83258,0.33689,0.2242},
+        {0.83632,0.34927,0.23677},
+        {0.84,0.36157,0.24937},
+        {0.84359,0.37378,0.26206},
+        {0.84712,0.38589,0.27479},
+        {0.85056,0.39792,0.28758},
+        {0.8539,0.40986,0.30042},
+        {0.85716,0.42169,0.3133},
+        {0.86032,0.43345,0.32618},
+        {0.86338,0.44514,0.33913},
+        {0.86634,0.45674,0.35208},
+        {0.8692,0.46829,0.36509},
+        {0.87196,0.47978,0.37813},
+        {0.87462,0.49122,0.39122},
+        {0.87716,0.50259,0.40434},
+        {0.87961,0.51395,0.41751},
+        {0.88195,0.52525,0.43072},
+        {0.88418,0.53652,0.44398},
+        {0.8863,0.54775,0.45727},
+        {0.8883,0.55896,0.47062},
+        {0.89019,0.57014,0.484},
+        {0.89197,0.5813,0.49745},
+        {0.89363,0.59245,0.51092},
+        {0.89518,0.60356,0.52444},
+        {0.8966,0.61466,0.53802},
+        {0.8979,0.62575,0.55163},
+        {0.89908,0.63683,0.56528},
+        {0.90012,0.64788,0.579},
+        {0.90103,0.65892,0.59275},
+        {0.9018,0.66994,0.60654},
+        {0.90242,0.6809,0.62037},
+        {0.90287,0.69183,0.63422},
+        {0.90316,0.70268,0.64808},
+        {0.90325,0.71344,0.66197},
+        {0.90314,0.72408,0.67583},
+        {0.9028,0.73456,0.68967},
+        {0.9022,0.74481,0.70344},
+        {0.90131,0.7548,0.71713},
+        {0.90011,0.76443,0.73066},
+        {0.89855,0.77364,0.74401},
+        {0.8966,0.78234,0.75711},
+        {0.89423,0.79041,0.7699},
+        {0.8914,0.79778,0.7823},
+        {0.88809,0.80433,0.79423},
+        {0.88427,0.80997,0.80561},
+        {0.87992,0.81463,0.8164},
+        {0.87505,0.81822,0.8265},
+        {0.86966,0.82071,0.83587},
+        {0.86376,0.82205,0.84446},
+        {0.85737,0.82224,0.85225},
+        {0.85052,0.8213,0.85923},
+        {0.84325,0.81927,0.8654},
+        {0.8356,0.81621,0.87079},
+        {0.8276,0.81219,0.87544},
+        {0.81931,0.80731,0.8794},
+        {0.81075,0.80165,0.88274},
+        {0.80198,0.79534,0.88552},
+        {0.79302,0.78846,0.88781},
+        {0.7839,0.78111,0.88969},
+        {0.77463,0.77338,0.89122},
+        {0.76527,0.76536,0.89246},
+        {0.75579,0.75709,0.89345},
+        {0.74622,0.74866,0.89427},
+        {0.73657,0.7401,0.89494},
+        {0.72685,0.73145,0.89549},
+        {0.71705,0.72274,0.89595},
+        {0.70717,0.71401,0.89635},
+        {0.69722,0.70526,0.89669},
+        {0.68719,0.69651,0.89699},
+        {0.67709,0.68776,0.89726},
+        {0.66689,0.67902,0.8975},
+        {0.65663,0.67032,0.89772},
+        {0.64625,0.66163,0.89792},
+        {0.63579,0.65297,0.89811},
+        {0.62522,0.64434,0.89828},
+        {0.61453,0.63573,0.89844},
+        {0.60375,0.62715,0.89859},
+        {0.59283,0.6186,0.89872},
+        {0.58178,0.61007,0.89884},
+        {0.57059,0.60157,0.89894},
+        {0.55925,0.59311,0.89902},
+        {0.54776,0.58467,0.8991},
+        {0.53609,0.57626,0.89915},
+        {0.52424,0.56787,0.8992},
+        {0.51219,0.55952,0.89923},
+        {0.49993,0.5512,0.89925},
+        {0.48745,0.54291,0.89925},
+        {0.47471,0.53465,0.89924},
+        {0.46169,0.52643,0.89922},
+        {0.44837,0.51823,0.89918},
+        {0.43473,0.51007,0.89913},
+        {0.42073,0.50196,0.89907},
+        {0.40637,0.49389,0.899},
+        {0.39159,0.48588,0.89891},
+        {0.37638,0.47795,0.89881},
+        {0.36067,0.47012,0.8987},
+        {0.34449,0.46237,0.89858},
+        {0.32777,0.45477,0.89845},
+        {0.31053,0.44731,0.89832},
+        {0.29269,0.44007,0.89817},
+        {0.27432,0.43307,0.89802},
+        {0.25544,0.42636,0.89787},
+        {0.23609,0.42002,0.89772},
+        {0.21638,0.4141,0.89757},
+        {0.19647,0.40866,0.89743},
+        {0.17659,0.40379,0.89729},
+        {0.15722,0.39953,0.89717},
+        {0.13894,0.39598,0.89707},
+        {0.1226,0.39316,0.89698},
+        {0.10959,0.39116,0.89692},
+        {0.1011,0.38996,0.89689},
+        {0.098617,0.38962,0.89687}
+    },
+    {
+        {0,0.79435,0.99671},
+        {0,0.79384,0.99455},
+        {0,0.79333,0.99239},
+        {0,0.79282,0.99023},
+        {0,0.79231,0.98806},
+        {0,0.7918,0.9859},
+        {0,0.79128,0.98374},
+        {0,0.79077,0.98158},
+        {0,0.79026,0.97942},
+        {0,0.78975,0.97726},
+        {0,0.78924,0.9751},
+        {0,0.78872,0.97295},
+        {0,0.7882,0.97079},
+        {0,0.78769,0.96863},
+        {0,0.78717,0.96647},
+        {0.030516,0.78666,0.96431},
+        {0.077099,0.78614,0.96216},
+        {0.10792,0.78562,0.96001},
+        {0.13219,0.7851,0.95785},
+        {0.15262,0.78458,0.9557},
+        {0.17059,0.78406,0.95354},
+        {0.18672,0.78354,0.95139},
+        {0.20145,0.78302,0.94923},
+        {0.21508,0.7825,0.94708},
+        {0.22782,0.78198,0.94493},
+        {0.23976,0.78145,0.94278},
+        {0.25106,0.78093,0.94063},
+        {0.26179,0.7804,0.93848},
+        {0.272,0.77988,0.93633},
+        {0.28182,0.77935,0.93417},
+        {0.29123,0.77882,0.93203},
+        {0.30027,0.7783,0.92988},
+        {0.30902,0.77777,0.92773},
+        {0.31745,0.77725,0.92558},
+        {0.32562,0.77672,0.92344},
+        {0.33356,0.77618,0.92129},
+        {0.34126,0.77565,0.91914},
+        {0.34875,0.77512,0.917},
+        {0.35605,0.77459,0.91485},
+        {0.36315,0.77406,0.91271},
+        {0.37009,0.77352,0.91056},
+        {0.37688,0.77299,0.90842},
+        {0.3835,0.77246,0.90627},
+        {0.38997,0.77193,0.90413},
+        {0.39633,0.77139,0.90199},
+        {0.40254,0.77086,0.89985},
+        {0.40865,0.77032,0.8977},
+        {0.41463,0.76978,0.89556},
+        {0.4205,0.76924,0.89342},
+        {0.42627,0.7687,0.89128},
+        {0.43196,0.76816,0.88914},
+        {0.43753,0.76762,0.887},
+        {0.443,0.76708,0.88486},
+        {0.44839,0.76654,0.88272},
+        {0.4537,0.766,0.88058},
+        {0.45893,0.76546,0.87844},
+        {0.46409,0.76492,0.8763},
+        {0.46917,0.76437,0.87417},
+        {0.47416,0.76382,0.87203},
+        {0.4791,0.76328,0.86989},
+        {0.48396,0.76273,0.86776},
+        {0.48876,0.76219,0.86562},
+        {0.4935,0.76164,0.86349},
+        {0.49819,0.76109,0.86135},
+        {0.5028,0.76054,0.85922},
+        {0.50737,0.75999,0.85708},
+        {0.51187,0.75944,0.85495},
+        {0.51632,0.75889,0.85282},
+        {0.52073,0.75834,0.85068},
+        {0.52508,0.75779,0.84855},
+        {0.52939,0.75723,0.84641},
+        {0.53364,0.75668,0.84429},
+        {0.53786,0.75612,0.84216},
+        {0.54202,0.75557,0.84003},
+        {0.54615,0.75502,0.83789},
+        {0.55022,0.75446,0.83576},
+        {0.55426,0.7539,0.83363},
+        {0.55825,0.75334,0.83151},
+        {0.56222,0.75278,0.82938},
+        {0.56614,0.75222,0.82725},
+        {0.57001,0.75166,0.82511},
+        {0.57386,0.7511,0.82299},
+        {0.57767,0.75054,0.82086},
+        {0.58145,0.74997,0.81873},
+        {0.5852,0.7494,0.81661},
+        {0.58889,0.74884,0.81448},
+        {0.59258,0.74828,0.81235},
+        {0.59622,0.74772,0.81023},
+        {0.59983,0.74715,0.8081},
+        {0.60342,0.74658,0.80598},
+        {0.60697,0.74601,0.80385},
+        {0.61049,0.74544,0.80173},
+        {0.61398,0.74487,0.79961},
+        {0.61745,0.7443,0.79748},
+        {0.62089,0.74373,0.79536},
+        {0.6243,0.74316,0.79324},
+        {0.62769,0.74258,0.79111},
+        {0.63105,0.742,0.78899},
+        {0.63438,0.74143,0.78687},
+        {0.63769,0.74085,0.78475},
+        {0.64097,0.74028,0.78262},
+        {0.64423,0.73971,0.7805},
+        {0.64747,0.73913,0.77838},
+        {0.65069,0.73854,0.77626},
+        {0.65388,0.73796,0.77414},
+        {0.65705,0.73738,0.77202},
+        {0.66019,0.7368,0.7699},
+        {0.66332,0.73621,0.76778},
+        {0.66642,0.73563,0.76567},
+        {0.66951,0.73505,0.76355},
+        {0.67257,0.73446,0.76145},
+        {0.6756,0.73388,0.75935},
+        {0.67862,0.73329,0.75727},
+        {0.68161,0.7327,0.75521},
+        {0.68458,0.73211,0.75316},
+        {0.68753,0.73151,0.75116},
+        {0.69045,0.73091,0.74918},
+        {0.69334,0.73031,0.74727},
+        {0.6962,0.72971,0.74541},
+        {0.69902,0.7291,0.74364},
+        {0.70181,0.72848,0.74196},
+        {0.70456,0.72786,0.74039},
+        {0.70726,0.72724,0.73895},
+        {0.70992,0.72661,0.73766},
+        {0.71252,0.72597,0.73652},
+        {0.71507,0.72533,0.73557},
+        {0.71757,0.72468,0.73481},
+        {0.72,0.72402,0.73423},
+        {0.72237,0.72335,0.73386},
+        {0.7247,0.72268,0.73368},
+        {0.72695,0.722,0.7337},
+        {0.72915,0.72132,0.73391},
+        {0.7313,0.72063,0.73429},
+        {0.7334,0.71994,0.73484},
+        {0.73545,0.71924,0.73553},
+        {0.73745,0.71854,0.73635},
+        {0.73943,0.71784,0.73729},
+        {0.74136,0.71713,0.73833},
+        {0.74327,0.71642,0.73945},
+        {0.74515,0.71571,0.74062},
+        {0.74702,0.71498,0.74185},
+        {0.74887,0.71426,0.74313},
+        {0.75071,0.71355,0.74443},
+        {0.75252,0.71282,0.74576},
+        {0.75434,0.7121,0.74711},
+        {0.75615,0.71138,0.74847},
+        {0.75795,0.71064,0.74983},
+        {0.75974,0.70991,0.75121},
+        {0.76153,0.70918,0.75258},
+        {0.76332,0.70845,0.75397},
+        {0.76511,0.7077,0.75535},
+        {0.76688,0.70697,0.75673},
+        {0.76866,0.70623,0.75812},
+        {0.77044,0.70548,0.75949},
+        {0.77221,0.70474,0.76088},
+        {0.77397,0.70399,0.76225},
+        {0.77574,0.70324,0.76364},
+        {0.77751,0.70249,0.76502},
+        {0.77926,0.70173,0.7664},
+        {0.78102,0.70098,0.76778},
+        {0.78278,0.70021,0.76916},
+        {0.78453,0.69945,0.77055},
+        {0.78628,0.69869,0.77193},
+        {0.78802,0.69792,0.7733},
+        {0.78977,0.69715,0.77468},
+        {0.79151,0.69639,0.77607},
+        {0.79325,0.69561,0.77745},
+        {0.79498,0.69483,0.77883},
+        {0.79672,0.69405,0.78021},
+        {0.79845,0.69328,0.78159},
+        {0.80018,0.6925,0.78297},
+        {0.8019,0.69171,0.78435},
+        {0.80363,0.69092,0.78573},
+        {0.80534,0.69014,0.78711},
+        {0.80707,0.68935,0.78849},
+        {0.80878,0.68855,0.78987},
+        {0.81049,0.68775,0.79125},
+        {0.8122,0.68695,0.79263},
+        {0.81391,0.68615,0.79401},
+        {0.81562,0.68535,0.79539},
+        {0.81732,0.68454,0.79677},
+        {0.81902,0.68373,0.79815},
+        {0.82072,0.68292,0.79953},
+        {0.82242,0.68211,0.80091},
+        {0.82411,0.68129,0.80228},
+        {0.82581,0.68047,0.80367},
+        {0.8275,0.67965,0.80504},
+        {0.82919,0.67883,0.80643},
+        {0.83087,0.67801,0.8078},
+        {0.83255,0.67718,0.80919},
+        {0.83424,0.67634,0.81056},
+        {0.83591,0.67551,0.81194},
+        {0.83759,0.67467,0.81332},
+        {0.83927,0.67383,0.8147},
+        {0.84094,0.67299,0.81608},
+        {0.84261,0.67215,0.81746},
+        {0.84427,0.6713,0.81883},
+        {0.84594,0.67045,0.82021},
+        {0.8476,0.6696,0.8216},
+        {0.84927,0.66874,0.82297},
+        {0.85092,0.66788,0.82435},
+        {0.85259,0.66702,0.82573},
+        {0.85424,0.66615,0.82711},
+        {0.8559,0.66529,0.82849},
+        {0.85754,0.66442,0.82987},
+        {0.85919,0.66355,0.83125},
+        {0.86084,0.66268,0.83263},
+        {0.86249,0.6618,0.83401},
+        {0.86414,0.66091,0.83538},
+        {0.86577,0.66003,0.83676},
+        {0.86741,0.65914,0.83814},
+        {0.86906,0.65826,0.83952},
+        {0.87069,0.65737,0.8409},
+        {0.87233,0.65647,0.84228},
+        {0.87395,0.65557,0.84366},
+        {0.87559,0.65467,0.84504},
+        {0.87721,0.65377,0.84641},
+        {0.87884,0.65285,0.84779},
+        {0.88047,0.65195,0.84918},
+        {0.88209,0.65104,0.85055},
+        {0.88371,0.65012,0.85193},
+        {0.88533,0.64921,0.85331},
+        {0.88695,0.64828,0.85469},
+        {0.88857,0.64736,0.85607},
+        {0.89018,0.64643,0.85745},
+        {0.89179,0.64549,0.85883},
+        {0.8934,0.64456,0.86021},
+        {0.89502,0.64362,0.86159},
+        {0.89662,0.64269,0.86297},
+        {0.89822,0.64174,0.86435},
+        {0.89983,0.64079,0.86572},
+        {0.90143,0.63985,0.8671},
+        {0.90304,0.63889,0.86849},
+        {0.90463,0.63793,0.86986},
+        {0.90623,0.63698,0.87124},
+        {0.90783,0.63601,0.87262},
+        {0.90942,0.63504,0.874},
+        {0.91101,0.63408,0.87538},
+        {0.9126,0.6331,0.87675},
+        {0.91419,0.63213,0.87814},
+        {0.91578,0.63115,0.87951},
+        {0.91737,0.63016,0.8809},
+        {0.91895,0.62917,0.88227},
+        {0.92053,0.62819,0.88366},
+        {0.92212,0.62719,0.88504},
+        {0.9237,0.62619,0.88642},
+        {0.92527,0.62519,0.88779},
+        {0.92685,0.62419,0.88918},
+        {0.92842,0.62319,0.89055},
+        {0.93,0.62217,0.89194},
+        {0.93157,0.62116,0.89331},
+        {0.93314,0.62014,0.8947},
+        {0.93471,0.61912,0.89607},
+        {0.93628,0.61809,0.89746},
+        {0.93785,0.61706,0.89883},
+        {0.93941,0.61603,0.90021}
+    },
+    {
+        {0,0.71527,1},
+        {0,0.7149,1},
+        {0,0.71453,1},
+        {0,0.71417,1},
+        {0.024434,0.7138,1},
+        {0.068274,0.71344,0.99912},
+        {0.097664,0.71307,0.99639},
+        {0.12062,0.71271,0.99368},
+        {0.13997,0.71234,0.99096},
+        {0.15693,0.71199,0.98824},
+        {0.1721,0.71163,0.98553},
+        {0.18598,0.71126,0.98281},
+        {0.19872,0.7109,0.9801},
+        {0.21064,0.71054,0.97739},
+        {0.2218,0.71018,0.97467},
+        {0.23235,0.70981,0.97196},
+        {0.24234,0.70945,0.96925},
+        {0.25188,0.7091,0.96654},
+        {0.26097,0.70874,0.96383},
+        {0.26971,0.70837,0.96112},
+        {0.27808,0.70801,0.95841},
+        {0.28614,0.70765,0.95571},
+        {0.29394,0.70729,0.953},
+        {0.30148,0.70693,0.95029},
+        {0.3088,0.70658,0.94759},
+        {0.31588,0.70622,0.94488},
+        {0.32276,0.70586,0.94218},
+        {0.32945,0.7055,0.93948},
+        {0.33595,0.70514,0.93678},
+        {0.3423,0.70478,0.93407},
+        {0.34848,0.70443,0.93137},
+        {0.35453,0.70407,0.92867},
+        {0.36042,0.70371,0.92597},
+        {0.3662,0.70336,0.92327},
+        {0.37184,0.703,0.92057},
+        {0.37737,0.70265,0.91788},
+        {0.38279,0.70229,0.91518},
+        {0.38809,0.70193,0.91249},
+        {0.3933,0.70158,0.90979},
+        {0.39841,0.70122,0.9071},
+        {0.40343,0.70087,0.9044},
+        {0.40835,0.70052,0.90171},
+        {0.4132,0.70016,0.89902},
+        {0.41795,0.69981,0.89633},
+        {0.42262,0.69945,0.89363},
+        {0.42723,0.6991,0.89094},
+        {0.43176,0.69875,0.88826},
+        {0.43621,0.69839,0.88557},
+        {0.44059,0.69804,0.88288},
+        {0.44493,0.69769,0.88019},
+        {0.44919,0.69734,0.8775},
+        {0.45337,0.69699,0.87482},
+        {0.45751,0.69664,0.87213},
+        {0.46159,0.69629,0.86945},
+        {0.46561,0.69594,0.86676},
+        {0.46959,0.69559,0.86408},
+        {0.47349,0.69524,0.86139},
+        {0.47736,0.69489,0.85871},
+        {0.48117,0.69453,0.85603},
+        {0.48494,0.69418,0.85335},
+        {0.48866,0.69384,0.85067},
+        {0.49233,0.69349,0.84799},
+        {0.49596,0.69315,0.84531},
+        {0.49954,0.6928,0.84264},
+        {0.50308,0.69245,0.83996},
+        {0.50659,0.6921,0.83728},
+        {0.51005,0.69175,0.8346},
+        {0.51348,0.6914,0.83193},
+        {0.51686,0.69105,0.82925},
+        {0.5202,0.69071,0.82658},
+        {0.52352,0.69036,0.8239},
+        {0.52679,0.69002,0.82123},
+        {0.53003,0.68967,0.81855},
+        {0.53323,0.68933,0.81588},
+        {0.5364,0.68898,0.81321},
+        {0.53953,0.68864,0.81053},
+        {0.54265,0.68829,0.80787},
+        {0.54572,0.68795,0.80519},
+        {0.54877,0.6876,0.80252},
+        {0.55178,0.68726,0.79986},
+        {0.55476,0.68691,0.79718},
+        {0.55772,0.68657,0.79452},
+        {0.56064,0.68622,0.79185},
+        {0.56355,0.68588,0.78919},
+        {0.56642,0.68554,0.78652},
+        {0.56925,0.6852,0.78385},
+        {0.57208,0.68485,0.78118},
+        {0.57487,0.68451,0.77852},
+        {0.57763,0.68416,0.77585},
+        {0.58038,0.68382,0.77318},
+        {0.5831,0.68348,0.77052},
+        {0.5858,0.68314,0.76786},
+        {0.58846,0.6828,0.7652},
+        {0.59111,0.68246,0.76253},
+        {0.59374,0.68212,0.75987},
+        {0.59634,0.68177,0.75721},
+        {0.59892,0.68143,0.75455},
+        {0.60148,0.68109,0.75189},
+        {0.60402,0.68075,0.74922},
+        {0.60653,0.68041,0.74656},
+        {0.60904,0.68007,0.7439},
+        {0.61151,0.67974,0.74124},
+        {0.61395,0.6794,0.73859},
+        {0.6164,0.67906,0.73592},
+        {0.61882,0.67872,0.73327},
+        {0.62121,0.67839,0.73061},
+        {0.62359,0.67805,0.72795},
+        {0.62595,0.67771,0.7253},
+        {0.62829,0.67738,0.72263},
+        {0.63062,0.67704,0.71998},
+        {0.63293,0.6767,0.71733},
+        {0.63522,0.67636,0.71467},
+        {0.6375,0.67601,0.71202},
+        {0.63977,0.67567,0.70938},
+        {0.64203,0.67533,0.70674},
+        {0.64428,0.67498,0.7041},
+        {0.64653,0.67463,0.70147},
+        {0.64878,0.67427,0.69886},
+        {0.65103,0.67391,0.69626},
+        {0.65329,0.67353,0.69367},
+        {0.65556,0.67315,0.6911},
+        {0.65785,0.67276,0.68857},
+        {0.66016,0.67235,0.68605},
+        {0.6625,0.67193,0.68357},
+        {0.66485,0.67148,0.68111},
+        {0.66726,0.67103,0.6787},
+        {0.6697,0.67055,0.67633},
+        {0.67218,0.67005,0.67399},
+        {0.6747,0.66953,0.6717},
+        {0.67726,0.66898,0.66945},
+        {0.67985,0.66842,0.66724},
+        {0.68249,0.66784,0.66507},
+        {0.68516,0.66723,0.66295},
+        {0.68786,0.6666,0.66084},
+        {0.69058,0.66596,0.65878},
+        {0.69332,0.66531,0.65675},
+        {0.69608,0.66464,0.65473},
+        {0.69884,0.66396,0.65274},
+        {0.70162,0.66328,0.65077},
+        {0.7044,0.66258,0.64882},
+        {0.70718,0.66187,0.64687},
+        {0.70995,0.66115,0.64493},
+        {0.71271,0.66044,0.643},
+        {0.71548,0.65972,0.64107},
+        {0.71822,0.65899,0.63915},
+        {0.72096,0.65827,0.63724},
+        {0.72369,0.65754,0.63532},
+        {0.72641,0.65681,0.63341},
+        {0.72911,0.65607,0.6315},
+        {0.7318,0.65533,0.62958},
+        {0.73448,0.65459,0.62767},
+        {0.73715,0.65385,0.62576},
+        {0.7398,0.6531,0.62385},
+        {0.74244,0.65236,0.62193},
+        {0.74507,0.65162,0.62003},
+        {0.74769,0.65087,0.61811},
+        {0.75029,0.65012,0.61621},
+        {0.75287,0.64937,0.61429},
+        {0.75546,0.64862,0.61238},
+        {0.75803,0.64786,0.61047},
+        {0.76059,0.64711,0.60857},
+        {0.76313,0.64634,0.60666},
+        {0.76567,0.64558,0.60475},
+        {0.76819,0.64482,0.60283},
+        {0.77071,0.64405,0.60092},
+        {0.77321,0.64329,0.59902},
+        {0.7757,0.64252,0.59711},
+        {0.77819,0.64175,0.5952},
+        {0.78066,0.64098,0.59329},
+        {0.78312,0.64021,0.59138},
+        {0.78557,0.63943,0.58947},
+        {0.78801,0.63865,0.58756},
+        {0.79044,0.63787,0.58566},
+        {0.79287,0.63709,0.58374},
+        {0.79528,0.63631,0.58183},
+        {0.79768,0.63552,0.57993},
+        {0.80008,0.63473,0.57801},
+        {0.80246,0.63395,0.57612},
+        {0.80484,0.63315,0.5742},
+        {0.80721,0.63236,0.5723},
+        {0.80956,0.63156,0.57038},
+        {0.81191,0.63077,0.56848},
+        {0.81425,0.62996,0.56657},
+        {0.81658,0.62916,0.56466},
+        {0.8189,0.62836,0.56276},
+        {0.82122,0.62755,0.56084},
+        {0.82352,0.62674,0.55893},
+        {0.82582,0.62593,0.55704},
+        {0.82811,0.62511,0.55512},
+        {0.83039,0.6243,0.55321},
+        {0.83266,0.62349,0.55131},
+        {0.83493,0.62266,0.5494},
+        {0.83719,0.62184,0.54749},
+        {0.83944,0.62102,0.54559},
+        {0.84168,0.6202,0.54367},
+        {0.84391,0.61937,0.54176},
+        {0.84614,0.61854,0.53985},
+        {0.84836,0.6177,0.53795},
+        {0.85057,0.61687,0.53604},
+        {0.85278,0.61603,0.53413},
+        {0.85497,0.61518,0.53223},
+        {0.85716,0.61434,0.53031},
+        {0.85935,0.6135,0.52841},
+        {0.86152,0.61265,0.5265},
+        {0.86369,0.6118,0.52458},
+        {0.86585,0.61096,0.52268},
+        {0.86801,0.6101,0.52076},
+        {0.87015,0.60925,0.51886},
+        {0.8723,0.60839,0.51695},
+        {0.87443,0.60753,0.51503},
+        {0.87656,0.60666,0.51312},
+        {0.87868,0.60579,0.51121},
+        {0.8808,0.60493,0.5093},
+        {0.88291,0.60406,0.50739},
+        {0.88501,0.60319,0.50547},
+        {0.88711,0.60231,0.50356},
+        {0.8892,0.60143,0.50166},
+        {0.89128,0.60055,0.49974},
+        {0.89336,0.59967,0.49784},
+        {0.89544,0.59878,0.49591},
+        {0.8975,0.59789,0.49401},
+        {0.89956,0.59701,0.49209},
+        {0.90162,0.59611,0.49018},
+        {0.90367,0.59521,0.48827},
+        {0.90571,0.59431,0.48635},
+        {0.90775,0.59341,0.48443},
+        {0.90978,0.59252,0.48252},
+        {0.9118,0.5916,0.4806},
+        {0.91383,0.59069,0.47869},
+        {0.91583,0.58978,0.47677},
+        {0.91785,0.58886,0.47486},
+        {0.91985,0.58794,0.47293},
+        {0.92185,0.58703,0.47102},
+        {0.92385,0.58611,0.46911},
+        {0.92583,0.58518,0.46719},
+        {0.92781,0.58425,0.46526},
+        {0.92979,0.58332,0.46333},
+        {0.93176,0.58238,0.46142},
+        {0.93373,0.58145,0.4595},
+        {0.9357,0.58051,0.45758},
+        {0.93765,0.57957,0.45566},
+        {0.93961,0.57862,0.45373},
+        {0.94155,0.57767,0.45181},
+        {0.9435,0.57673,0.44989},
+        {0.94543,0.57577,0.44796},
+        {0.94737,0.5748,0.44603},
+        {0.94929,0.57384,0.44412},
+        {0.95122,0.57289,0.44219},
+        {0.95314,0.57192,0.44025},
+        {0.95505,0.57094,0.43833},
+        {0.95696,0.56997,0.4364},
+        {0.95887,0.56899,0.43447},
+        {0.96077,0.56802,0.43254},
+        {0.96266,0.56704,0.43061},
+        {0.96455,0.56605,0.42867},
+        {0.96644,0.56505,0.42674}
+    },
+    {
+        {0,0.1654,0.84384},
+        {0,0.16745,0.84024},
+        {0,0.16948,0.83663},
+        {0,0.17145,0.83302},
+        {0,0.17344,0.82943},
+        {0,0.17543,0.82582},
+        {0,0.17744,0.82223},
+        {0,0.1794,0.81863},
+        {0.025922,0.18135,0.81503},
+        {0.052828,0.18332,0.81145},
+        {0.073384,0.18532,0.80785},
+        {0.089868,0.18726,0.80427},
+        {0.10397,0.1892,0.80068},
+        {0.11641,0.19113,0.79709},
+        {0.12754,0.19308,0.79352},
+        {0.13776,0.19502,0.78993},
+        {0.14712,0.19696,0.78636},
+        {0.15586,0.19885,0.78277},
+        {0.16403,0.20076,0.7792},
+        {0.17168,0.20269,0.77562},
+        {0.17895,0.20462,0.77205},
+        {0.18585,0.20653,0.76848},
+        {0.19237,0.20841,0.76492},
+        {0.19861,0.2103,0.76135},
+        {0.20461,0.21221,0.75779},
+        {0.21032,0.21409,0.75423},
+        {0.21583,0.21599,0.75066},
+        {0.22112,0.21785,0.7471},
+        {0.22622,0.21973,0.74355},
+        {0.23112,0.22159,0.73999},
+        {0.23587,0.22347,0.73643},
+        {0.24042,0.22532,0.73288},
+        {0.24486,0.22719,0.72933},
+        {0.24917,0.22905,0.72578},
+        {0.25333,0.2309,0.72223},
+        {0.25737,0.23274,0.71868},
+        {0.26128,0.23461,0.71514},
+        {0.26508,0.23645,0.7116},
+        {0.2688,0.23827,0.70806},
+        {0.27236,0.2401,0.70452},
+        {0.27589,0.24194,0.70098},
+        {0.27929,0.24376,0.69744},
+        {0.2826,0.24558,0.6939},
+        {0.2858,0.24742,0.69037},
+        {0.28896,0.24924,0.68684},
+        {0.29202,0.25106,0.68331},
+        {0.29499,0.25287,0.67978},
+        {0.2979,0.2547,0.67625},
+        {0.30074,0.25648,0.67273},
+        {0.3035,0.25829,0.6692},
+        {0.30623,0.2601,0.66568},
+        {0.30886,0.2619,0.66216},
+        {0.31142,0.26371,0.65863},
+        {0.31394,0.26549,0.65511},
+        {0.31639,0.26726,0.6516},
+        {0.31878,0.26908,0.64807},
+        {0.32112,0.27087,0.64456},
+        {0.3234,0.27263,0.64104},
+        {0.32562,0.27442,0.63753},
+        {0.3278,0.27621,0.63402},
+        {0.32994,0.27798,0.63051},
+        {0.33201,0.27975,0.62699},
+        {0.33404,0.28152,0.62349},
+        {0.33602,0.28329,0.61998},
+        {0.33795,0.28504,0.61647},
+        {0.33985,0.28681,0.61296},
+        {0.34169,0.28858,0.60946},
+        {0.34349,0.29033,0.60594},
+        {0.34525,0.2921,0.60244},
+        {0.34698,0.29385,0.59894},
+        {0.34865,0.2956,0.59544},
+        {0.3503,0.29736,0.59194},
+        {0.35188,0.29912,0.58843},
+        {0.35345,0.30085,0.58494},
+        {0.35499,0.30259,0.58143},
+        {0.35647,0.30434,0.57793},
+        {0.35792,0.3061,0.57443},
+        {0.35932,0.30781,0.57094},
+        {0.36069,0.30957,0.56744},
+        {0.36205,0.31129,0.56395},
+        {0.36335,0.31302,0.56045},
+        {0.36463,0.31475,0.55696},
+        {0.36588,0.31649,0.55345},
+        {0.36709,0.31821,0.54996},
+        {0.36827,0.31994,0.54647},
+        {0.36941,0.32165,0.54297},
+        {0.37053,0.32338,0.53947},
+        {0.37161,0.32509,0.53597},
+        {0.37267,0.32681,0.53248},
+        {0.3737,0.32854,0.52899},
+        {0.37469,0.33025,0.52549},
+        {0.37565,0.33196,0.52198},
+        {0.3766,0.33368,0.5185},
+        {0.3775,0.33539,0.51499},
+        {0.37838,0.33709,0.51149},
+        {0.37924,0.33879,0.508},
+        {0.38006,0.3405,0.50451},
+        {0.38087,0.3422,0.501},
+        {0.38163,0.34389,0.4975},
+        {0.38237,0.34559,0.494},
+        {0.3831,0.3473,0.4905},
+        {0.38379,0.34899,0.48699},
+        {0.38445,0.35069,0.48348},
+        {0.38508,0.35237,0.47998},
+        {0.3857,0.35406,0.47647},
+        {0.38629,0.35576,0.47296},
+        {0.38685,0.35745,0.46946},
+        {0.38739,0.35912,0.46593},
+        {0.38791,0.3608,0.46242},
+        {0.3884,0.3625,0.45891},
+        {0.38888,0.36417,0.45539},
+        {0.38931,0.36586,0.45188},
+        {0.38973,0.36753,0.44835},
+        {0.39012,0.36922,0.44483},
+        {0.3905,0.37088,0.4413},
+        {0.39085,0.37256,0.43778},
+        {0.39118,0.37425,0.43423},
+        {0.39148,0.37591,0.4307},
+        {0.39176,0.37758,0.42717},
+        {0.39201,0.37925,0.42362},
+        {0.39224,0.38092,0.42008},
+        {0.39246,0.38258,0.41653},
+        {0.39264,0.38425,0.41298},
+        {0.39281,0.3859,0.40942},
+        {0.39296,0.38757,0.40587},
+        {0.39308,0.38924,0.40228},
+        {0.39318,0.3909,0.39872},
+        {0.39326,0.39255,0.39515},
+        {0.39669,0.39314,0.39214},
+        {0.40343,0.39266,0.38969},
+        {0.41007,0.39217,0.38724},
+        {0.41662,0.39167,0.3848},
+        {0.42308,0.39116,0.38235},
+        {0.42947,0.39062,0.37991},
+        {0.4358,0.39007,0.37746},
+        {0.44205,0.38952,0.37501},
+        {0.44822,0.38896,0.37255},
+        {0.45434,0.38838,0.3701},
+        {0.46038,0.38778,0.36765},
+        {0.46638,0.38717,0.3652},
+        {0.47233,0.38655,0.36274},
+        {0.47821,0.38592,0.36028},
+        {0.48404,0.38527,0.35784},
+        {0.48983,0.38461,0.35538},
+        {0.49557,0.38394,0.35291},
+        {0.50127,0.38326,0.35045},
+        {0.50692,0.38255,0.34798},
+        {0.51253,0.38183,0.34551},
+        {0.5181,0.38111,0.34305},
+        {0.52363,0.38036,0.34058},
+        {0.52913,0.3796,0.33809},
+        {0.53458,0.37882,0.33563},
+        {0.54,0.37803,0.33316},
+        {0.54539,0.37723,0.33067},
+        {0.55075,0.37641,0.32819},
+        {0.55607,0.37556,0.3257},
+        {0.56137,0.37471,0.32323},
+        {0.56664,0.37384,0.32075},
+        {0.57188,0.37295,0.31825},
+        {0.57709,0.37204,0.31576},
+        {0.58227,0.37112,0.31326},
+        {0.58743,0.37018,0.31077},
+        {0.59258,0.36924,0.30826},
+        {0.59768,0.36827,0.30577},
+        {0.60277,0.36727,0.30324},
+        {0.60785,0.36627,0.30073},
+        {0.61288,0.36524,0.29821},
+        {0.61791,0.36419,0.2957},
+        {0.62292,0.36313,0.29318},
+        {0.6279,0.36205,0.29066},
+        {0.63287,0.36094,0.28813},
+        {0.63782,0.35983,0.28559},
+        {0.64275,0.35868,0.28307},
+        {0.64766,0.35754,0.28051},
+        {0.65255,0.35635,0.27798},
+        {0.65744,0.35515,0.27544},
+        {0.6623,0.35391,0.27288},
+        {0.66714,0.35267,0.27033},
+        {0.67198,0.3514,0.26774},
+        {0.6768,0.35012,0.26518},
+        {0.6816,0.3488,0.26261},
+        {0.68639,0.34747,0.26004},
+        {0.69116,0.3461,0.25745},
+        {0.69594,0.34472,0.25487},
+        {0.70069,0.34332,0.25226},
+        {0.70542,0.34189,0.24964},
+        {0.71015,0.34043,0.24704},
+        {0.71486,0.33896,0.24441},
+        {0.71957,0.33745,0.24181},
+        {0.72426,0.33591,0.23917},
+        {0.72895,0.33436,0.23654},
+        {0.73362,0.33277,0.23387},
+        {0.73828,0.33113,0.23124},
+        {0.74294,0.32951,0.22858},
+        {0.74758,0.32782,0.2259},
+        {0.75221,0.32611,0.22322},
+        {0.75684,0.32438,0.22053},
+        {0.76145,0.32263,0.21781},
+        {0.76606,0.32083,0.21509},
+        {0.77066,0.31899,0.21238},
+        {0.77525,0.31713,0.20964},
+        {0.77984,0.31523,0.20691},
+        {0.78442,0.31331,0.20416},
+        {0.78899,0.31134,0.20135},
+        {0.79355,0.30935,0.19857},
+        {0.7981,0.30729,0.19578},
+        {0.80264,0.30522,0.19297},
+        {0.80719,0.30309,0.19014},
+        {0.81172,0.30093,0.18732},
+        {0.81625,0.29874,0.18444},
+        {0.82077,0.2965,0.18155},
+        {0.82529,0.2942,0.17869},
+        {0.8298,0.29189,0.17574},
+        {0.83431,0.28951,0.17282},
+        {0.8388,0.28707,0.16989},
+        {0.84329,0.2846,0.16692},
+        {0.84778,0.28209,0.16393},
+        {0.85227,0.27951,0.16088},
+        {0.85675,0.27688,0.15783},
+        {0.86122,0.27419,0.15475},
+        {0.86569,0.27144,0.15165},
+        {0.87015,0.26865,0.14851},
+        {0.87462,0.26578,0.1454},
+        {0.87907,0.26285,0.14218},
+        {0.88353,0.25985,0.13893},
+        {0.88797,0.25678,0.13565},
+        {0.89242,0.25364,0.13237},
+        {0.89686,0.25041,0.12899},
+        {0.9013,0.24713,0.12563},
+        {0.90573,0.24374,0.12213},
+        {0.91016,0.24028,0.11869},
+        {0.91459,0.23676,0.11509},
+        {0.91901,0.23308,0.11151},
+        {0.92343,0.22934,0.10779},
+        {0.92784,0.22549,0.10405},
+        {0.93226,0.22153,0.1002},
+        {0.93668,0.21745,0.096258},
+        {0.94108,0.21323,0.092292},
+        {0.94549,0.2089,0.088179},
+        {0.94989,0.20443,0.083966},
+        {0.95429,0.19976,0.079537},
+        {0.95869,0.19499,0.075045},
+        {0.96309,0.19001,0.070373},
+        {0.96749,0.18486,0.065518},
+        {0.97188,0.17948,0.06046},
+        {0.97626,0.17389,0.055081},
+        {0.98065,0.16803,0.049511},
+        {0.98504,0.16195,0.043373},
+        {0.98943,0.15551,0.037065},
+        {0.99381,0.14872,0.03044},
+        {0.99819,0.14159,0.024101},
+        {1,0.13398,0.017854},
+        {1,0.12585,0.011691},
+        {1,0.11706,0.0054342},
+        {1,0.10757,0},
+        {1,0.097091,0}
+    },
+    {
+        {0.077854,0.19343,0.75827},
+        {0.095213,0.19629,0.7569},
+        {0.11007,0.1991,0.75553},
+        {0.12317,0.20194,0.75416},
+        {0.13514,0.20481,0.75279},
+        {0.14608,0.20765,0.75143},
+        {0.15626,0.21049,0.75004},
+        {0.16572,0.21333,0.74867},
+        {0.17472,0.21621,0.7473},
+        {0.18318,0.21905,0.74592},
+        {0.19126,0.22188,0.74454},
+        {0.19897,0.22472,0.74317},
+        {0.20641,0.2276,0.74178},
+        {0.21348,0.23044,0.7404},
+        {0.22035,0.23329,0.73902},
+        {0.22695,0.23617,0.73763},
+        {0.23332,0.23902,0.73624},
+        {0.23953,0.24188,0.73486},
+        {0.24552,0.24472,0.73347},
+        {0.25139,0.24761,0.73208},
+        {0.25706,0.25045,0.73069},
+        {0.26259,0.25333,0.72929},
+        {0.26797,0.25618,0.7279},
+        {0.27326,0.25907,0.7265},
+        {0.2784,0.26192,0.72511},
+        {0.28343,0.26478,0.7237},
+        {0.28834,0.26764,0.7223},
+        {0.29316,0.27055,0.7209},
+        {0.29788,0.27341,0.7195},
+        {0.3025,0.27629,0.71809},
+        {0.30706,0.27916,0.71668},
+        {0.31151,0.28204,0.71527},
+        {0.3159,0.2849,0.71386},
+        {0.3202,0.28778,0.71244},
+        {0.32441,0.29066,0.71103},
+        {0.32858,0.29354,0.70962},
+        {0.33268,0.29643,0.7082},
+        {0.33669,0.29932,0.70678},
+        {0.34065,0.30219,0.70535},
+        {0.34455,0.30509,0.70393},
+        {0.34839,0.30797,0.7025},
+        {0.35217,0.31088,0.70108},
+        {0.35592,0.31377,0.69964},
+        {0.35959,0.31666,0.69821},
+        {0.36322,0.31955,0.69678},
+        {0.36681,0.32245,0.69535},
+        {0.37033,0.32533,0.6939},
+        {0.37383,0.32824,0.69247},
+        {0.37727,0.33113,0.69102},
+        {0.38067,0.33405,0.68958},
+        {0.38403,0.33695,0.68814},
+        {0.38734,0.33986,0.68669},
+        {0.39062,0.34277,0.68524},
+        {0.39386,0.34566,0.68378},
+        {0.39705,0.34858,0.68232},
+        {0.40023,0.35149,0.68086},
+        {0.40336,0.35441,0.67941},
+        {0.40645,0.35733,0.67795},
+        {0.40951,0.36023,0.67649},
+        {0.41254,0.36315,0.67502},
+        {0.41553,0.36607,0.67355},
+        {0.41848,0.36899,0.67208},
+        {0.42141,0.3719,0.67061},
+        {0.42432,0.37484,0.66913},
+        {0.4272,0.37776,0.66765},
+        {0.43004,0.38069,0.66616},
+        {0.43285,0.38362,0.66468},
+        {0.43564,0.38654,0.6632},
+        {0.4384,0.38948,0.66171},
+        {0.44113,0.39241,0.66021},
+        {0.44384,0.39535,0.65871},
+        {0.44652,0.39829,0.65722},
+        {0.44918,0.40123,0.65572},
+        {0.45181,0.40416,0.65421},
+        {0.45442,0.4071,0.6527},
+        {0.45699,0.41005,0.6512},
+        {0.45955,0.413,0.64969},
+        {0.46209,0.41594,0.64817},
+        {0.46461,0.41888,0.64665},
+        {0.4671,0.42183,0.64513},
+        {0.46957,0.42479,0.6436},
+        {0.47202,0.42775,0.64208},
+        {0.47444,0.4307,0.64055},
+        {0.47685,0.43364,0.63902},
+        {0.47923,0.43661,0.63748},
+        {0.4816,0.43957,0.63594},
+        {0.48394,0.44254,0.6344},
+        {0.48627,0.44549,0.63285},
+        {0.48858,0.44846,0.6313},
+        {0.49088,0.45143,0.62974},
+        {0.49313,0.4544,0.62819},
+        {0.49539,0.45736,0.62663},
+        {0.49763,0.46033,0.62506},
+        {0.49983,0.4633,0.6235},
+        {0.50204,0.46628,0.62192},
+        {0.50422,0.46927,0.62036},
+        {0.50637,0.47224,0.61878},
+        {0.50853,0.47522,0.61719},
+        {0.51065,0.47819,0.6156},
+        {0.51277,0.48117,0.61401},
+        {0.51487,0.48416,0.61242},
+        {0.51695,0.48715,0.61083},
+        {0.51901,0.49014,0.60923},
+        {0.52106,0.49312,0.60762},
+        {0.52309,0.49611,0.606},
+        {0.52511,0.49911,0.6044},
+        {0.52712,0.50211,0.60277},
+        {0.52911,0.5051,0.60115},
+        {0.53107,0.50811,0.59953},
+        {0.53303,0.5111,0.59789},
+        {0.53497,0.51411,0.59626},
+        {0.53691,0.51711,0.59462},
+        {0.53882,0.5201,0.59298},
+        {0.54072,0.52312,0.59133},
+        {0.54261,0.52613,0.58967},
+        {0.54448,0.52914,0.58801},
+        {0.54635,0.53215,0.58635},
+        {0.54819,0.53516,0.58469},
+        {0.55002,0.53818,0.58301},
+        {0.55184,0.54119,0.58133},
+        {0.55364,0.54421,0.57966},
+        {0.55543,0.54723,0.57796},
+        {0.55722,0.55025,0.57628},
+        {0.55898,0.55327,0.57457},
+        {0.56074,0.55629,0.57288},
+        {0.56249,0.55933,0.57116},
+        {0.56422,0.56236,0.56945},
+        {0.56593,0.56538,0.56773},
+        {0.56883,0.56809,0.5657},
+        {0.57292,0.57047,0.56336},
+        {0.57698,0.57287,0.56099},
+        {0.58101,0.57525,0.55863},
+        {0.58503,0.57764,0.55626},
+        {0.58901,0.58005,0.55389},
+        {0.59299,0.58244,0.55151},
+        {0.59693,0.58486,0.54913},
+        {0.60085,0.58726,0.54673},
+        {0.60476,0.58967,0.54433},
+        {0.60865,0.5921,0.54191},
+        {0.6125,0.59451,0.5395},
+        {0.61635,0.59694,0.53708},
+        {0.62018,0.59936,0.53465},
+        {0.62399,0.60179,0.53221},
+        {0.62777,0.60423,0.52976},
+        {0.63154,0.60666,0.52731},
+        {0.6353,0.6091,0.52484},
+        {0.63904,0.61154,0.52237},
+        {0.64276,0.61398,0.51989},
+        {0.64646,0.61644,0.51741},
+        {0.65015,0.61889,0.51491},
+        {0.65382,0.62134,0.5124},
+        {0.65749,0.62381,0.50989},
+        {0.66112,0.62626,0.50736},
+        {0.66475,0.62873,0.50483},
+        {0.66837,0.6312,0.50229},
+        {0.67197,0.63367,0.49973},
+        {0.67556,0.63615,0.49717},
+        {0.67913,0.63862,0.4946},
+        {0.68269,0.6411,0.49202},
+        {0.68624,0.64358,0.48942},
+        {0.68978,0.64607,0.48682},
+        {0.6933,0.64856,0.4842},
+        {0.69681,0.65106,0.48158},
+        {0.70031,0.65355,0.47894},
+        {0.7038,0.65605,0.47629},
+        {0.70727,0.65855,0.47362},
+        {0.71074,0.66105,0.47096},
+        {0.71419,0.66357,0.46826},
+        {0.71764,0.66607,0.46556},
+        {0.72106,0.66859,0.46285},
+        {0.72449,0.6711,0.46013},
+        {0.7279,0.67362,0.45739},
+        {0.7313,0.67614,0.45465},
+        {0.73469,0.67866,0.45188},
+        {0.73807,0.68119,0.4491},
+        {0.74144,0.68372,0.4463},
+        {0.74481,0.68625,0.44349},
+        {0.74816,0.68879,0.44066},
+        {0.75151,0.69132,0.43783},
+        {0.75485,0.69386,0.43497},
+        {0.75817,0.69641,0.4321},
+        {0.76149,0.69895,0.42919},
+        {0.7648,0.7015,0.42628},
+        {0.7681,0.70405,0.42335},
+        {0.7714,0.70661,0.42041},
+        {0.77468,0.70917,0.41745},
+        {0.77796,0.71173,0.41446},
+        {0.78123,0.71428,0.41146},
+        {0.7845,0.71685,0.40844},
+        {0.78775,0.71942,0.4054},
+        {0.79099,0.72198,0.40232},
+        {0.79424,0.72456,0.39924},
+        {0.79747,0.72713,0.39614},
+        {0.8007,0.72971,0.393},
+        {0.80392,0.73229,0.38984},
+        {0.80713,0.73487,0.38666},
+        {0.81033,0.73745,0.38347},
+        {0.81354,0.74005,0.38023},
+        {0.81673,0.74263,0.37698},
+        {0.81992,0.74522,0.37369},
+        {0.8231,0.74782,0.37037},
+        {0.82628,0.75041,0.36704},
+        {0.82945,0.75301,0.36366},
+        {0.83261,0.75561,0.36026},
+        {0.83577,0.75822,0.35684},
+        {0.83892,0.76082,0.35336},
+        {0.84207,0.76343,0.34987},
+        {0.84521,0.76604,0.34632},
+        {0.84834,0.76865,0.34277},
+        {0.85147,0.77127,0.33916},
+        {0.8546,0.77388,0.33551},
+        {0.85772,0.77651,0.33181},
+        {0.86083,0.77913,0.32808},
+        {0.86395,0.78175,0.3243},
+        {0.86705,0.78438,0.3205},
+        {0.87015,0.78701,0.31662},
+        {0.87324,0.78964,0.31269},
+        {0.87633,0.79227,0.30875},
+        {0.87942,0.79491,0.30472},
+        {0.8825,0.79754,0.30064},
+        {0.88558,0.80019,0.29651},
+        {0.88866,0.80283,0.29232},
+        {0.89172,0.80547,0.28806},
+        {0.89479,0.80812,0.28374},
+        {0.89785,0.81077,0.27936},
+        {0.9009,0.81342,0.27488},
+        {0.90395,0.81607,0.27036},
+        {0.907,0.81872,0.26572},
+        {0.91005,0.82138,0.26101},
+        {0.91309,0.82404,0.2562},
+        {0.91612,0.82671,0.25133},
+        {0.91915,0.82937,0.24631},
+        {0.92219,0.83204,0.24121},
+        {0.92521,0.8347,0.236},
+        {0.92823,0.83737,0.23064},
+        {0.93125,0.84005,0.22515},
+        {0.93426,0.84272,0.21954},
+        {0.93728,0.84539,0.21376},
+        {0.94029,0.84807,0.20781},
+        {0.94329,0.85075,0.20166},
+        {0.94629,0.85343,0.19535},
+        {0.94929,0.85612,0.18881},
+        {0.95229,0.8588,0.18199},
+        {0.95528,0.86149,0.17496},
+        {0.95827,0.86419,0.16758},
+        {0.96125,0.86687,0.15984},
+        {0.96424,0.86957,0.15175},
+        {0.96722,0.87227,0.1432},
+        {0.9702,0.87497,0.13412},
+        {0.97317,0.87767,0.12434},
+        {0.97614,0.88037,0.11385},
+        {0.97911,0.88307,0.10233},
+        {0.98208,0.88578,0.089538},
+        {0.98505,0.88849,0.07491},
+        {0.98801,0.8912,0.057534},
+        {0.99097,0.89391,0.035647}
+    },
+    {
+        {0.032081,0.36182,0.97348},
+        {0.05836,0.37092,0.95845},
+        {0.075961,0.37984,0.94345},
+        {0.088784,0.38858,0.92847},
+        {0.098335,0.39714,0.91352},
+        {0.10538,0.40555,0.89858},
+        {0.1105,0.4138,0.88367},
+        {0.1138,0.42191,0.86877},
+        {0.11557,0.4299,0.85388},
+        {0.11592,0.43777,0.83902},
+        {0.11487,0.44549,0.82416},
+        {0.11266,0.45311,0.80932},
+        {0.10918,0.46059,0.79447},
+        {0.10455,0.46796,0.77961},
+        {0.099069,0.47521,0.76474},
+        {0.092835,0.4823,0.74982},
+        {0.08633,0.48923,0.73486},
+        {0.080053,0.496,0.71982},
+        {0.074782,0.50259,0.70469},
+        {0.071457,0.50899,0.68944},
+        {0.07085,0.51517,0.67403},
+        {0.073695,0.52113,0.65846},
+        {0.079835,0.52688,0.64271},
+        {0.089012,0.5324,0.62676},
+        {0.10026,0.53772,0.61062},
+        {0.11288,0.54284,0.59428},
+        {0.126,0.54779,0.57774},
+        {0.1391,0.55261,0.56104},
+        {0.15183,0.55732,0.54417},
+        {0.16388,0.56193,0.52714},
+        {0.17497,0.56648,0.50997},
+        {0.18508,0.57098,0.49266},
+        {0.19412,0.57547,0.47524},
+        {0.20204,0.57994,0.45766},
+        {0.20895,0.58441,0.43995},
+        {0.21483,0.58888,0.4221},
+        {0.21979,0.59337,0.40411},
+        {0.22384,0.59785,0.38597},
+        {0.22711,0.60234,0.36769},
+        {0.22964,0.60683,0.3493},
+        {0.23163,0.6113,0.33081},
+        {0.23311,0.61574,0.3123},
+        {0.23437,0.62014,0.29385},
+        {0.23553,0.62448,0.27559},
+        {0.23686,0.62873,0.25761},
+        {0.23856,0.63287,0.24012},
+        {0.24094,0.63689,0.22333},
+        {0.24418,0.64076,0.2074},
+        {0.2485,0.64447,0.19256},
+        {0.25393,0.64801,0.17902},
+        {0.26052,0.65139,0.16694},
+        {0.26821,0.65459,0.15642},
+        {0.2769,0.65765,0.14749},
+        {0.28638,0.66054,0.14012},
+        {0.29654,0.66333,0.13429},
+        {0.30712,0.666,0.12971},
+        {0.318,0.6686,0.12623},
+        {0.32904,0.67112,0.12356},
+        {0.34011,0.6736,0.12159},
+        {0.35116,0.67603,0.1201},
+        {0.36212,0.67844,0.11895},
+        {0.37296,0.68081,0.11798},
+        {0.38369,0.68318,0.11711},
+        {0.39426,0.68554,0.11638},
+        {0.40469,0.68788,0.11563},
+        {0.415,0.69021,0.11486},
+        {0.42518,0.69254,0.11414},
+        {0.43523,0.69484,0.11344},
+        {0.44516,0.69715,0.11268},
+        {0.455,0.69945,0.1119},
+        {0.46473,0.70173,0.11112},
+        {0.47437,0.70402,0.11034},
+        {0.48392,0.7063,0.10954},
+        {0.4934,0.70856,0.10866},
+        {0.50281,0.71081,0.10783},
+        {0.51215,0.71306,0.10703},
+        {0.52142,0.7153,0.10617},
+        {0.53064,0.71754,0.10523},
+        {0.53978,0.71976,0.10434},
+        {0.5489,0.72197,0.10349},
+        {0.55794,0.72417,0.10255},
+        {0.56694,0.72637,0.1016},
+        {0.5759,0.72856,0.10065},
+        {0.58481,0.73074,0.099684},
+        {0.59368,0.73292,0.098715},
+        {0.60252,0.73509,0.097735},
+        {0.61132,0.73724,0.096645},
+        {0.62009,0.73939,0.095664},
+        {0.62882,0.74152,0.094646},
+        {0.63752,0.74366,0.09351},
+        {0.64619,0.74578,0.092435},
+        {0.65483,0.7479,0.091367},
+        {0.66346,0.75,0.090209},
+        {0.67205,0.7521,0.089055},
+        {0.68061,0.75419,0.087892},
+        {0.68917,0.75627,0.086685},
+        {0.69769,0.75835,0.085411},
+        {0.7062,0.76041,0.084247},
+        {0.71468,0.76246,0.082921},
+        {0.72315,0.76451,0.081681},
+        {0.73161,0.76655,0.0803},
+        {0.74005,0.76858,0.078922},
+        {0.74847,0.77061,0.077534},
+        {0.75687,0.77262,0.076136},
+        {0.76527,0.77462,0.074724},
+        {0.77364,0.77663,0.07331},
+        {0.78201,0.77861,0.071765},
+        {0.79036,0.78059,0.070194},
+        {0.7987,0.78257,0.068669},
+        {0.80704,0.78453,0.067},
+        {0.81535,0.78649,0.065324},
+        {0.82366,0.78843,0.063634},
+        {0.83198,0.79037,0.061832},
+        {0.84029,0.7923,0.060168},
+        {0.84859,0.7942,0.058382},
+        {0.85689,0.79607,0.056834},
+        {0.8652,0.79789,0.055378},
+        {0.87351,0.79966,0.054292},
+        {0.88182,0.80132,0.053775},
+        {0.89012,0.80285,0.054093},
+        {0.8984,0.8042,0.055566},
+        {0.90662,0.8053,0.058415},
+        {0.91475,0.80608,0.063031},
+        {0.92272,0.80648,0.069366},
+        {0.93047,0.80641,0.077301},
+        {0.9379,0.80582,0.08703},
+        {0.94493,0.80465,0.097983},
+        {0.95147,0.80288,0.10998},
+        {0.95744,0.80051,0.12259},
+        {0.9628,0.79755,0.1357},
+        {0.9675,0.79406,0.14898},
+        {0.97155,0.79007,0.16223},
+        {0.97499,0.78567,0.17523},
+        {0.97786,0.78094,0.18795},
+        {0.98025,0.77593,0.20021},
+        {0.98222,0.77073,0.21212},
+        {0.98385,0.76537,0.22355},
+        {0.98522,0.75991,0.23457},
+        {0.98638,0.75438,0.24514},
+        {0.9874,0.74879,0.25538},
+        {0.98831,0.74317,0.26524},
+        {0.98914,0.73751,0.27479},
+        {0.98991,0.73185,0.28406},
+        {0.99062,0.72616,0.29307},
+        {0.9913,0.72045,0.30183},
+        {0.99194,0.71474,0.3104},
+        {0.99255,0.70902,0.31874},
+        {0.99314,0.70327,0.32691},
+        {0.99369,0.6975,0.33494},
+        {0.99421,0.69172,0.34279},
+        {0.9947,0.68593,0.35051},
+        {0.99516,0.68011,0.35809},
+        {0.9956,0.67428,0.36554},
+        {0.996,0.66843,0.37289},
+        {0.99638,0.66256,0.38013},
+        {0.99672,0.65667,0.38727},
+        {0.99704,0.65075,0.39432},
+        {0.99732,0.64482,0.40128},
+        {0.99758,0.63886,0.40815},
+        {0.99781,0.63289,0.41495},
+        {0.99801,0.62688,0.42166},
+        {0.99818,0.62086,0.42832},
+        {0.99832,0.6148,0.43492},
+        {0.99843,0.60874,0.44143},
+        {0.99851,0.60262,0.44789},
+        {0.99857,0.59649,0.45431},
+        {0.99859,0.59033,0.46065},
+        {0.99858,0.58414,0.46696},
+        {0.99855,0.57791,0.4732},
+        {0.99848,0.57166,0.47942},
+        {0.99839,0.56537,0.48557},
+        {0.99827,0.55905,0.4917},
+        {0.99812,0.5527,0.49778},
+        {0.99793,0.54631,0.50381},
+        {0.99772,0.53987,0.50981},
+        {0.99748,0.53339,0.51577},
+        {0.99721,0.52689,0.52171},
+        {0.99692,0.52032,0.52761},
+        {0.99659,0.51372,0.53348},
+        {0.99623,0.50706,0.53932},
+        {0.99585,0.50036,0.54514},
+        {0.99543,0.4936,0.55092},
+        {0.99499,0.4868,0.55668},
+        {0.99451,0.47994,0.56242},
+        {0.99401,0.473,0.56813},
+        {0.99348,0.46601,0.57381},
+        {0.99292,0.45897,0.57948},
+        {0.99232,0.45185,0.58513},
+        {0.9917,0.44466,0.59074},
+        {0.99105,0.43739,0.59635},
+        {0.99036,0.43003,0.60193},
+        {0.98965,0.42258,0.60751},
+        {0.98891,0.41506,0.61304},
+        {0.98813,0.40745,0.61855},
+        {0.98733,0.39973,0.62399},
+        {0.98649,0.39194,0.62934},
+        {0.98562,0.38405,0.63457},
+        {0.98472,0.37608,0.63961},
+        {0.98378,0.36804,0.64438},
+        {0.98281,0.35995,0.64878},
+        {0.98181,0.35183,0.65266},
+        {0.98078,0.34373,0.65588},
+        {0.97973,0.3357,0.65825},
+        {0.97864,0.32775,0.65959},
+        {0.97754,0.31999,0.65974},
+        {0.97642,0.3124,0.65853},
+        {0.97528,0.30511,0.65589},
+        {0.97411,0.29808,0.65173},
+        {0.97292,0.2914,0.64606},
+        {0.97169,0.285,0.63895},
+        {0.97041,0.27897,0.63052},
+        {0.96907,0.2732,0.62092},
+        {0.96766,0.26768,0.61031},
+        {0.96618,0.26243,0.5989},
+        {0.96461,0.25735,0.58686},
+        {0.96297,0.2524,0.57435},
+        {0.96124,0.24756,0.56152},
+        {0.95942,0.24278,0.54846},
+        {0.95753,0.23806,0.53526},
+        {0.95556,0.23335,0.52198},
+        {0.95351,0.22869,0.50869},
+        {0.95138,0.22398,0.49537},
+        {0.94918,0.2193,0.48207},
+        {0.94691,0.21459,0.4688},
+        {0.94457,0.20987,0.45555},
+        {0.94216,0.20512,0.44234},
+        {0.93968,0.20033,0.42915},
+        {0.93714,0.19555,0.416},
+        {0.93453,0.19073,0.40287},
+        {0.93185,0.1859,0.38976},
+        {0.92911,0.18098,0.3767},
+        {0.92631,0.17605,0.36362},
+        {0.92345,0.17111,0.35059},
+        {0.92052,0.16609,0.33755},
+        {0.91755,0.16106,0.32451},
+        {0.9145,0.15595,0.31148},
+        {0.9114,0.15076,0.29845},
+        {0.90825,0.14556,0.2854},
+        {0.90503,0.1402,0.27233},
+        {0.90176,0.13484,0.25926},
+        {0.89844,0.12932,0.24609},
+        {0.89507,0.12371,0.23288},
+        {0.89164,0.11805,0.21961},
+        {0.88816,0.11221,0.20623},
+        {0.88463,0.10623,0.19268},
+        {0.88106,0.10002,0.17898},
+        {0.87743,0.093639,0.16503},
+        {0.87376,0.087085,0.15083},
+        {0.87004,0.08013,0.13619},
+        {0.86629,0.072935,0.12107},
+        {0.86249,0.065249,0.10524},
+        {0.85864,0.057063,0.088412},
+        {0.85476,0.048151,0.069991},
+        {0.85083,0.038404,0.048987},
+        {0.84687,0.028128,0.024389},
+        {0.84287,0.018301,0.0015175}
+    },
+    {
+        {0.097481,0.50736,0.98205},
+        {0.1033,0.50389,0.97428},
+        {0.10863,0.50041,0.96653},
+        {0.11369,0.49694,0.9588},
+        {0.11841,0.49348,0.95107},
+        {0.12275,0.49002,0.94336},
+        {0.12692,0.48657,0.93566},
+        {0.13089,0.48312,0.92796},
+        {0.1346,0.47968,0.92028},
+        {0.13811,0.47624,0.91262},
+        {0.14143,0.4728,0.90497},
+        {0.14458,0.46938,0.89732},
+        {0.14758,0.46594,0.88969},
+        {0.15043,0.46252,0.88207},
+        {0.15312,0.45912,0.87446},
+        {0.15574,0.4557,0.86687},
+        {0.1582,0.4523,0.85929},
+        {0.16051,0.4489,0.85172},
+        {0.16277,0.44549,0.84416},
+        {0.16488,0.44211,0.83662},
+        {0.16693,0.43871,0.82909},
+        {0.16886,0.43534,0.82157},
+        {0.17068,0.43197,0.81406},
+        {0.17242,0.42859,0.80657},
+        {0.17409,0.42522,0.79909},
+        {0.17566,0.42185,0.79162},
+        {0.17718,0.41849,0.78417},
+        {0.17862,0.41515,0.77672},
+        {0.17995,0.4118,0.76929},
+        {0.18122,0.40846,0.76187},
+        {0.18243,0.40512,0.75448},
+        {0.18359,0.40179,0.74709},
+        {0.18468,0.39847,0.73972},
+        {0.18572,0.39515,0.73235},
+        {0.18665,0.39183,0.725},
+        {0.18758,0.38852,0.71767},
+        {0.18841,0.38521,0.71034},
+        {0.18918,0.38191,0.70304},
+        {0.1899,0.37862,0.69574},
+        {0.19058,0.37533,0.68847},
+        {0.1912,0.37204,0.68119},
+        {0.19177,0.36878,0.67395},
+        {0.1923,0.3655,0.6667},
+        {0.19277,0.36224,0.65948},
+        {0.1932,0.35896,0.65228},
+        {0.19358,0.35572,0.64508},
+        {0.19393,0.35246,0.6379},
+        {0.19422,0.34922,0.63074},
+        {0.19446,0.34597,0.62359},
+        {0.19466,0.34276,0.61645},
+        {0.19481,0.33953,0.60933},
+        {0.19492,0.33629,0.60222},
+        {0.19499,0.33309,0.59513},
+        {0.19502,0.32988,0.58805},
+        {0.19502,0.32665,0.58099},
+        {0.19497,0.32346,0.57394},
+        {0.19489,0.32028,0.56692},
+        {0.19477,0.31708,0.55991},
+        {0.19462,0.31391,0.5529},
+        {0.19442,0.31074,0.54593},
+        {0.19419,0.30755,0.53895},
+        {0.19391,0.30439,0.532},
+        {0.1936,0.30123,0.52507},
+        {0.19325,0.29808,0.51815},
+        {0.19288,0.29493,0.51124},
+        {0.19247,0.29181,0.50436},
+        {0.19202,0.28867,0.49749},
+        {0.19154,0.28553,0.49064},
+        {0.19103,0.28244,0.48379},
+        {0.19049,0.27932,0.47697},
+        {0.18992,0.27622,0.47017},
+        {0.18932,0.27311,0.46338},
+        {0.18869,0.27002,0.45661},
+        {0.18804,0.26691,0.44986},
+        {0.18733,0.26385,0.44313},
+        {0.18658,0.26076,0.43641},
+        {0.18585,0.25769,0.42971},
+        {0.18505,0.25465,0.42302},
+        {0.18421,0.25159,0.41637},
+        {0.18335,0.24855,0.40972},
+        {0.18247,0.24548,0.40309},
+        {0.18156,0.24245,0.39648},
+        {0.18062,0.23944,0.38989},
+        {0.17967,0.23642,0.38333},
+        {0.17869,0.23338,0.37678},
+        {0.17768,0.23038,0.37023},
+        {0.17659,0.2274,0.36372},
+        {0.17551,0.22438,0.35724},
+        {0.17442,0.22142,0.35076},
+        {0.17327,0.21845,0.34429},
+        {0.17211,0.21547,0.33785},
+        {0.17093,0.21251,0.33143},
+        {0.16973,0.20955,0.32503},
+        {0.16847,0.20663,0.31867},
+        {0.16721,0.20368,0.3123},
+        {0.16588,0.20071,0.30599},
+        {0.16458,0.1978,0.29967},
+        {0.16324,0.1949,0.29336},
+        {0.16187,0.19198,0.28708},
+        {0.16042,0.18908,0.28083},
+        {0.15902,0.1862,0.27461},
+        {0.15755,0.18329,0.26841},
+        {0.1561,0.18041,0.26222},
+        {0.15456,0.17758,0.25605},
+        {0.15302,0.17471,0.2499},
+        {0.15147,0.17184,0.24379},
+        {0.14991,0.16902,0.23772},
+        {0.14827,0.16616,0.23164},
+        {0.14665,0.16336,0.22559},
+        {0.14505,0.16051,0.21957},
+        {0.14339,0.15773,0.21357},
+        {0.14175,0.15496,0.20763},
+        {0.14009,0.1522,0.20171},
+        {0.13851,0.14952,0.19588},
+        {0.13692,0.1468,0.19008},
+        {0.13541,0.14419,0.18437},
+        {0.134,0.14163,0.17876},
+        {0.13268,0.1391,0.17324},
+        {0.1315,0.1367,0.16787},
+        {0.13053,0.13444,0.16268},
+        {0.12973,0.13226,0.15764},
+        {0.12916,0.13028,0.15284},
+        {0.12891,0.12842,0.1483},
+        {0.12899,0.12676,0.14407},
+        {0.12945,0.12536,0.14011},
+        {0.13031,0.12415,0.13652},
+        {0.13151,0.12321,0.13332},
+        {0.13315,0.12253,0.13051},
+        {0.13523,0.12211,0.12804},
+        {0.13775,0.12196,0.126},
+        {0.14065,0.12206,0.12429},
+        {0.14394,0.12241,0.12299},
+        {0.14762,0.12299,0.12205},
+        {0.15161,0.12379,0.12145},
+        {0.15595,0.12478,0.12115},
+        {0.1605,0.12596,0.12111},
+        {0.16531,0.1272,0.12131},
+        {0.17036,0.12863,0.12171},
+        {0.17553,0.13018,0.12228},
+        {0.18085,0.13174,0.12299},
+        {0.1863,0.13339,0.12382},
+        {0.1918,0.1351,0.12474},
+        {0.19738,0.13681,0.12575},
+        {0.20301,0.13858,0.12675},
+        {0.20867,0.14035,0.12784},
+        {0.21437,0.14214,0.12891},
+        {0.2201,0.14394,0.13008},
+        {0.22584,0.14575,0.13119},
+        {0.23158,0.14753,0.13232},
+        {0.23735,0.14933,0.13347},
+        {0.24308,0.15109,0.13464},
+        {0.24887,0.15287,0.13574},
+        {0.25465,0.15465,0.13692},
+        {0.26041,0.15645,0.1381},
+        {0.26621,0.15821,0.1392},
+        {0.27198,0.15993,0.14038},
+        {0.27781,0.16174,0.14154},
+        {0.28361,0.16349,0.14269},
+        {0.28944,0.16518,0.14384},
+        {0.29526,0.16697,0.14501},
+        {0.30109,0.16869,0.14614},
+        {0.30695,0.17041,0.1473},
+        {0.3128,0.17212,0.14842},
+        {0.31867,0.17385,0.14962},
+        {0.32454,0.17555,0.15074},
+        {0.33043,0.17728,0.15189},
+        {0.33632,0.17898,0.15304},
+        {0.34224,0.18066,0.1542},
+        {0.34815,0.18235,0.15536},
+        {0.35407,0.18405,0.15654},
+        {0.36001,0.18576,0.15766},
+        {0.36596,0.18743,0.15884},
+        {0.3719,0.18909,0.15995},
+        {0.37787,0.19075,0.16115},
+        {0.38385,0.19241,0.16231},
+        {0.38983,0.1941,0.16346},
+        {0.39584,0.19573,0.1646},
+        {0.40184,0.19738,0.16573},
+        {0.40786,0.19901,0.16693},
+        {0.41389,0.20064,0.16806},
+        {0.41994,0.20228,0.16925},
+        {0.42598,0.20394,0.17038},
+        {0.43206,0.20555,0.17153},
+        {0.43813,0.20718,0.17269},
+        {0.44421,0.20879,0.17385},
+        {0.4503,0.2104,0.17502},
+        {0.4564,0.21202,0.17614},
+        {0.46251,0.21361,0.17734},
+        {0.46864,0.2152,0.1785},
+        {0.47479,0.21681,0.17964},
+        {0.48092,0.21839,0.18078},
+        {0.48709,0.21998,0.18194},
+        {0.49325,0.22155,0.1831},
+        {0.49943,0.22314,0.18427},
+        {0.50562,0.22468,0.18546},
+        {0.51182,0.22628,0.18659},
+        {0.51804,0.22784,0.18779},
+        {0.52426,0.22938,0.18892},
+        {0.53049,0.23094,0.19008},
+        {0.53674,0.23249,0.19123},
+        {0.54299,0.23403,0.1924},
+        {0.54925,0.23559,0.19357},
+        {0.55552,0.23713,0.19474},
+        {0.56181,0.23863,0.19589},
+        {0.5681,0.24016,0.19706},
+        {0.57441,0.2417,0.1982},
+        {0.58073,0.2432,0.19936},
+        {0.58705,0.24472,0.20052},
+        {0.59339,0.24623,0.20169},
+        {0.59974,0.24776,0.20286},
+        {0.60609,0.24925,0.20405},
+        {0.61246,0.25075,0.20519},
+        {0.61885,0.25225,0.20639},
+        {0.62523,0.25374,0.20753},
+        {0.63163,0.25524,0.20869},
+        {0.63803,0.25671,0.20986},
+        {0.64445,0.25817,0.21103},
+        {0.65088,0.25967,0.21221},
+        {0.65732,0.26113,0.21335},
+        {0.66377,0.2626,0.21453},
+        {0.67023,0.26407,0.21571},
+        {0.6767,0.26552,0.21688},
+        {0.68317,0.26696,0.21804},
+        {0.68966,0.26842,0.21921},
+        {0.69616,0.26988,0.22039},
+        {0.70267,0.27131,0.22154},
+        {0.70919,0.27274,0.22272},
+        {0.71571,0.27418,0.22387},
+        {0.72224,0.27563,0.22504},
+        {0.72879,0.27705,0.22624},
+        {0.73535,0.27847,0.2274},
+        {0.74191,0.27988,0.22858},
+        {0.74849,0.28129,0.22972},
+        {0.75508,0.28272,0.23091},
+        {0.76167,0.28411,0.23209},
+        {0.76827,0.28551,0.23324},
+        {0.77488,0.28691,0.23444},
+        {0.78151,0.28831,0.23561},
+        {0.78814,0.28971,0.23679},
+        {0.79478,0.2911,0.23795},
+        {0.80143,0.29248,0.23912},
+        {0.80809,0.29385,0.24028},
+        {0.81476,0.29523,0.24148},
+        {0.82144,0.29662,0.24264},
+        {0.82812,0.29797,0.24381},
+        {0.83482,0.29935,0.24499},
+        {0.84153,0.3007,0.24617},
+        {0.84824,0.30205,0.24736},
+        {0.85497,0.30341,0.24855},
+        {0.8617,0.30477,0.2497},
+        {0.86845,0.30613,0.25089},
+        {0.8752,0.30745,0.25208},
+        {0.88196,0.30881,0.25325},
+        {0.88873,0.31015,0.25444},
+        {0.8955,0.31147,0.25561},
+        {0.90229,0.31279,0.25679}
+    },
+    {
+        {0.056674,0.57959,0.98121},
+        {0.066107,0.57547,0.97345},
+        {0.074463,0.57135,0.9657},
+        {0.081994,0.56724,0.95796},
+        {0.088742,0.56314,0.95024},
+        {0.09499,0.55904,0.94252},
+        {0.10067,0.55495,0.93482},
+        {0.10603,0.55086,0.92713},
+        {0.11098,0.54678,0.91945},
+        {0.1156,0.54271,0.91178},
+        {0.11993,0.53864,0.90413},
+        {0.12401,0.53457,0.89649},
+        {0.1279,0.53052,0.88886},
+        {0.13155,0.52647,0.88124},
+        {0.135,0.52241,0.87363},
+        {0.13827,0.51838,0.86604},
+        {0.14137,0.51435,0.85845},
+        {0.1443,0.51031,0.85088},
+        {0.14707,0.50628,0.84333},
+        {0.14975,0.50227,0.83578},
+        {0.15224,0.49827,0.82825},
+        {0.15465,0.49426,0.82073},
+        {0.15694,0.49026,0.81323},
+        {0.15911,0.48626,0.80573},
+        {0.1612,0.48228,0.79826},
+        {0.16316,0.4783,0.79079},
+        {0.16499,0.47433,0.78334},
+        {0.1668,0.47036,0.77589},
+        {0.16848,0.46639,0.76846},
+        {0.17009,0.46243,0.76105},
+        {0.1716,0.45849,0.75365},
+        {0.17304,0.45455,0.74626},
+        {0.17442,0.45061,0.73889},
+        {0.17569,0.44668,0.73153},
+        {0.17693,0.44275,0.72418},
+        {0.17811,0.43883,0.71685},
+        {0.17917,0.43493,0.70953},
+        {0.18019,0.43102,0.70222},
+        {0.18114,0.42712,0.69493},
+        {0.18204,0.42322,0.68765},
+        {0.18288,0.41934,0.68038},
+        {0.18367,0.41546,0.67314},
+        {0.1844,0.41158,0.6659},
+        {0.18509,0.40772,0.65868},
+        {0.18571,0.40387,0.65148},
+        {0.18626,0.40001,0.64428},
+        {0.18676,0.39617,0.6371},
+        {0.18724,0.39232,0.62994},
+        {0.18767,0.3885,0.62279},
+        {0.18804,0.38466,0.61565},
+        {0.18835,0.38086,0.60854},
+        {0.18861,0.37705,0.60143},
+        {0.18884,0.37323,0.59434},
+        {0.18902,0.36944,0.58727},
+        {0.18916,0.36565,0.58021},
+        {0.18925,0.36187,0.57317},
+        {0.18931,0.3581,0.56614},
+        {0.18932,0.35433,0.55913},
+        {0.18929,0.35058,0.55214},
+        {0.18923,0.34682,0.54515},
+        {0.18912,0.34307,0.53819},
+        {0.18898,0.33934,0.53124},
+        {0.1888,0.3356,0.52431},
+        {0.18859,0.33187,0.51739},
+        {0.18833,0.32815,0.51049},
+        {0.18805,0.32444,0.5036},
+        {0.18772,0.32075,0.49673},
+        {0.18734,0.31705,0.48988},
+        {0.18692,0.31337,0.48305},
+        {0.18649,0.3097,0.47624},
+        {0.18603,0.30603,0.46945},
+        {0.18554,0.30234,0.46265},
+        {0.18499,0.2987,0.45589},
+        {0.1844,0.29505,0.44915},
+        {0.18379,0.29142,0.44242},
+        {0.18315,0.28778,0.43571},
+        {0.18248,0.28416,0.429},
+        {0.18178,0.28053,0.42232},
+        {0.18105,0.27695,0.41567},
+        {0.18029,0.27335,0.40903},
+        {0.1795,0.26977,0.4024},
+        {0.1787,0.26618,0.39581},
+        {0.17786,0.26261,0.38922},
+        {0.17694,0.25905,0.38265},
+        {0.176,0.25549,0.37611},
+        {0.17509,0.25195,0.36958},
+        {0.17411,0.24842,0.36307},
+        {0.1731,0.24486,0.35659},
+        {0.17207,0.24136,0.35012},
+        {0.17101,0.23785,0.34366},
+        {0.16994,0.23435,0.33724},
+        {0.16882,0.23085,0.33082},
+        {0.16766,0.22737,0.32443},
+        {0.16649,0.22389,0.31807},
+        {0.16526,0.22045,0.31171},
+        {0.16408,0.21698,0.3054},
+        {0.16281,0.21352,0.29909},
+        {0.16154,0.21009,0.2928},
+        {0.16017,0.20669,0.28653},
+        {0.15887,0.20325,0.28029},
+        {0.15748,0.19982,0.27408},
+        {0.15612,0.19646,0.26786},
+        {0.15467,0.19306,0.26171},
+        {0.15321,0.18968,0.25556},
+        {0.15174,0.18632,0.24942},
+        {0.15026,0.18294,0.2433},
+        {0.14871,0.17961,0.23725},
+        {0.14718,0.17625,0.23118},
+        {0.14564,0.17295,0.22512},
+        {0.14403,0.16968,0.21913},
+        {0.14243,0.16638,0.21314},
+        {0.14084,0.16314,0.20723},
+        {0.13919,0.15988,0.2013},
+        {0.13765,0.15674,0.19547},
+        {0.13602,0.15358,0.18968},
+        {0.13455,0.15054,0.18396},
+        {0.13306,0.14756,0.17836},
+        {0.13167,0.14469,0.1728},
+        {0.13042,0.14192,0.16741},
+        {0.12922,0.13927,0.16217},
+        {0.12825,0.13686,0.15706},
+        {0.12743,0.13466,0.15217},
+        {0.12685,0.13265,0.14756},
+        {0.12655,0.13093,0.14317},
+        {0.12652,0.12946,0.13905},
+        {0.12678,0.12834,0.1353},
+        {0.12737,0.12752,0.13186},
+        {0.12833,0.12704,0.12874},
+        {0.12961,0.12694,0.12604},
+        {0.13123,0.12718,0.12362},
+        {0.13318,0.1278,0.12159},
+        {0.13545,0.1287,0.11992},
+        {0.13807,0.12997,0.11861},
+        {0.14093,0.13147,0.11751},
+        {0.14404,0.13325,0.11674},
+        {0.14739,0.13526,0.11622},
+        {0.15092,0.1375,0.11588},
+        {0.15463,0.13984,0.11572},
+        {0.15851,0.14242,0.11571},
+        {0.16247,0.14511,0.11584},
+        {0.16652,0.14785,0.11606},
+        {0.17065,0.15069,0.11635},
+        {0.17485,0.15359,0.11668},
+        {0.17908,0.15658,0.11705},
+        {0.18333,0.15955,0.11747},
+        {0.18766,0.16261,0.11793},
+        {0.19194,0.16563,0.11839},
+        {0.19628,0.16874,0.11884},
+        {0.20058,0.17182,0.11927},
+        {0.20495,0.17495,0.11971},
+        {0.2093,0.17808,0.12015},
+        {0.21365,0.18116,0.12058},
+        {0.21802,0.18431,0.12101},
+        {0.22237,0.18748,0.12142},
+        {0.22675,0.19061,0.12183},
+        {0.23112,0.19379,0.12224},
+        {0.23551,0.19696,0.12264},
+        {0.23987,0.20011,0.12303},
+        {0.24425,0.20332,0.12341},
+        {0.24867,0.20654,0.12378},
+        {0.25306,0.20972,0.12415},
+        {0.25746,0.21292,0.12451},
+        {0.26188,0.21617,0.12486},
+        {0.2663,0.21939,0.12521},
+        {0.27074,0.22263,0.12555},
+        {0.27516,0.22588,0.12587},
+        {0.2796,0.22912,0.12618},
+        {0.28403,0.23239,0.12646},
+        {0.28849,0.23566,0.12673},
+        {0.29294,0.23892,0.12701},
+        {0.29741,0.24221,0.12728},
+        {0.30187,0.24549,0.12756},
+        {0.30637,0.24881,0.12782},
+        {0.31086,0.25212,0.12807},
+        {0.31534,0.25543,0.1283},
+        {0.31985,0.25875,0.12852},
+        {0.32434,0.26208,0.12872},
+        {0.32887,0.26541,0.12892},
+        {0.33339,0.26877,0.12911},
+        {0.3379,0.27209,0.12931},
+        {0.34245,0.27548,0.12949},
+        {0.34699,0.27884,0.12967},
+        {0.35153,0.28221,0.12983},
+        {0.35609,0.28557,0.12998},
+        {0.36064,0.28897,0.13012},
+        {0.36522,0.29236,0.13024},
+        {0.36979,0.29575,0.13035},
+        {0.37439,0.29917,0.13045},
+        {0.37897,0.30257,0.13053},
+        {0.38358,0.30601,0.13061},
+        {0.38818,0.30944,0.13067},
+        {0.39279,0.31285,0.13073},
+        {0.39741,0.31631,0.13077},
+        {0.40203,0.31975,0.1308},
+        {0.40668,0.3232,0.13082},
+        {0.41131,0.32665,0.13083},
+        {0.41596,0.33013,0.13082},
+        {0.42062,0.3336,0.13081},
+        {0.42529,0.33708,0.13078},
+        {0.42996,0.34056,0.13075},
+        {0.43464,0.34404,0.1307},
+        {0.43932,0.34756,0.13063},
+        {0.44402,0.35106,0.13056},
+        {0.44872,0.35457,0.13047},
+        {0.45341,0.35808,0.13037},
+        {0.45813,0.3616,0.13025},
+        {0.46284,0.36513,0.13012},
+        {0.46758,0.36867,0.12998},
+        {0.47231,0.3722,0.12981},
+        {0.47705,0.37575,0.12963},
+        {0.4818,0.3793,0.12943},
+        {0.48655,0.38286,0.12922},
+        {0.49133,0.38642,0.129},
+        {0.49608,0.38999,0.12877},
+        {0.50086,0.39357,0.12854},
+        {0.50564,0.39715,0.1283},
+        {0.51043,0.40075,0.12803},
+        {0.51523,0.40433,0.12773},
+        {0.52003,0.40793,0.1274},
+        {0.52484,0.41154,0.12707},
+        {0.52966,0.41515,0.12674},
+        {0.53448,0.41876,0.12641},
+        {0.53931,0.42238,0.12606},
+        {0.54415,0.42601,0.12567},
+        {0.549,0.42965,0.12524},
+        {0.55385,0.43328,0.12481},
+        {0.5587,0.43694,0.12436},
+        {0.56357,0.44058,0.1239},
+        {0.56844,0.44424,0.12341},
+        {0.57332,0.44789,0.12291},
+        {0.5782,0.45157,0.1224},
+        {0.58309,0.45524,0.12186},
+        {0.58798,0.45892,0.12131},
+        {0.5929,0.46259,0.12074},
+        {0.5978,0.46628,0.12015},
+        {0.60272,0.46998,0.11954},
+        {0.60765,0.47367,0.11893},
+        {0.61257,0.47738,0.11828},
+        {0.61751,0.48108,0.11755},
+        {0.62245,0.48479,0.11685},
+        {0.6274,0.48852,0.11615},
+        {0.63236,0.49224,0.11536},
+        {0.63732,0.49596,0.11454},
+        {0.64229,0.4997,0.11378},
+        {0.64726,0.50344,0.11298},
+        {0.65224,0.50719,0.1121},
+        {0.65724,0.51093,0.11121},
+        {0.66223,0.5147,0.11031},
+        {0.66723,0.51846,0.10936},
+        {0.67223,0.52221,0.10832},
+        {0.67725,0.52599,0.10736},
+        {0.68226,0.52976,0.10634},
+        {0.68729,0.53353,0.10521},
+        {0.69232,0.53733,0.10412},
+        {0.69735,0.54111,0.103},
+        {0.7024,0.54491,0.1018}
+    },
+    {
+        {0.12757,0.31619,0.85836},
+        {0.14675,0.32048,0.85923},
+        {0.16386,0.32476,0.8601},
+        {0.17936,0.3291,0.86096},
+        {0.1937,0.33343,0.86182},
+        {0.20708,0.33776,0.86268},
+        {0.21967,0.34213,0.86354},
+        {0.23162,0.34649,0.86439},
+        {0.24297,0.35089,0.86524},
+        {0.25389,0.35529,0.86609},
+        {0.26436,0.35969,0.86693},
+        {0.27445,0.36411,0.86778},
+        {0.28422,0.36855,0.86862},
+        {0.29369,0.37299,0.86945},
+        {0.30289,0.37746,0.87028},
+        {0.31184,0.38192,0.87112},
+        {0.32061,0.3864,0.87195},
+        {0.32914,0.39091,0.87277},
+        {0.33747,0.39542,0.8736},
+        {0.34563,0.39992,0.87442},
+        {0.35364,0.40445,0.87523},
+        {0.36151,0.40899,0.87605},
+        {0.36923,0.41355,0.87686},
+        {0.37682,0.4181,0.87767},
+        {0.38428,0.42267,0.87847},
+        {0.39164,0.42727,0.87927},
+        {0.39887,0.43186,0.88007},
+        {0.40603,0.43645,0.88087},
+        {0.41307,0.44106,0.88167},
+        {0.42002,0.44568,0.88245},
+        {0.4269,0.45032,0.88324},
+        {0.43367,0.45496,0.88403},
+        {0.44039,0.45961,0.88481},
+        {0.44703,0.46428,0.88559},
+        {0.45359,0.46894,0.88636},
+        {0.46009,0.47361,0.88713},
+        {0.46653,0.4783,0.8879},
+        {0.4729,0.483,0.88867},
+        {0.47922,0.48771,0.88943},
+        {0.48547,0.49242,0.89019},
+        {0.49169,0.49715,0.89094},
+        {0.49784,0.50188,0.8917},
+        {0.50394,0.50662,0.89245},
+        {0.50999,0.51137,0.89319},
+        {0.516,0.51612,0.89394},
+        {0.52196,0.5209,0.89468},
+        {0.52789,0.52567,0.89541},
+        {0.53377,0.53046,0.89615},
+        {0.53962,0.53525,0.89688},
+        {0.54543,0.54005,0.8976},
+        {0.5512,0.54486,0.89832},
+        {0.55693,0.54968,0.89905},
+        {0.56263,0.5545,0.89976},
+        {0.56829,0.55933,0.90048},
+        {0.57392,0.56418,0.90119},
+        {0.57953,0.56902,0.90189},
+        {0.5851,0.57388,0.9026},
+        {0.59064,0.57874,0.9033},
+        {0.59616,0.58361,0.90399},
+        {0.60164,0.58849,0.90468},
+        {0.60711,0.59339,0.90538},
+        {0.61254,0.59828,0.90606},
+        {0.61795,0.60318,0.90674},
+        {0.62334,0.6081,0.90742},
+        {0.6287,0.613,0.9081},
+        {0.63404,0.61793,0.90877},
+        {0.63935,0.62287,0.90943},
+        {0.64464,0.62781,0.9101},
+        {0.64992,0.63275,0.91076},
+        {0.65517,0.63771,0.91142},
+        {0.66041,0.64267,0.91207},
+        {0.66562,0.64763,0.91272},
+        {0.67082,0.65261,0.91337},
+        {0.67599,0.6576,0.91401},
+        {0.68115,0.66259,0.91465},
+        {0.68629,0.66758,0.91528},
+        {0.69141,0.67259,0.91591},
+        {0.69652,0.6776,0.91655},
+        {0.70161,0.68261,0.91717},
+        {0.70669,0.68763,0.91779},
+        {0.71175,0.69267,0.91841},
+        {0.71679,0.6977,0.91902},
+        {0.72181,0.70275,0.91963},
+        {0.72683,0.70779,0.92023},
+        {0.73183,0.71285,0.92083},
+        {0.73682,0.71792,0.92143},
+        {0.74179,0.72298,0.92203},
+        {0.74675,0.72806,0.92262},
+        {0.7517,0.73315,0.92321},
+        {0.75663,0.73823,0.92379},
+        {0.76155,0.74334,0.92436},
+        {0.76647,0.74844,0.92494},
+        {0.77137,0.75354,0.92551},
+        {0.77625,0.75866,0.92608},
+        {0.78113,0.76378,0.92664},
+        {0.78599,0.76891,0.9272},
+        {0.79084,0.77404,0.92775},
+        {0.79569,0.77918,0.9283},
+        {0.80052,0.78434,0.92885},
+        {0.80534,0.78949,0.92939},
+        {0.81015,0.79464,0.92993},
+        {0.81496,0.79981,0.93047},
+        {0.81975,0.80498,0.931},
+        {0.82454,0.81015,0.93152},
+        {0.82932,0.81534,0.93204},
+        {0.83408,0.82053,0.93256},
+        {0.83884,0.82573,0.93308},
+        {0.84359,0.83093,0.93358},
+        {0.84833,0.83612,0.93407},
+        {0.85306,0.84131,0.93455},
+        {0.85779,0.84648,0.935},
+        {0.8625,0.85164,0.93542},
+        {0.86719,0.85675,0.9358},
+        {0.87187,0.86182,0.93612},
+        {0.87652,0.86682,0.93638},
+        {0.88114,0.87172,0.93653},
+        {0.88573,0.87649,0.93657},
+        {0.89027,0.8811,0.93646},
+        {0.89475,0.8855,0.93617},
+        {0.89915,0.88964,0.93565},
+        {0.90346,0.89347,0.93488},
+        {0.90766,0.89694,0.9338},
+        {0.91172,0.89998,0.93239},
+        {0.91562,0.90254,0.9306},
+        {0.91935,0.90457,0.9284},
+        {0.92288,0.90602,0.92576},
+        {0.92619,0.90686,0.92266},
+        {0.92926,0.90706,0.91909},
+        {0.93208,0.9066,0.91506},
+        {0.93464,0.90549,0.91056},
+        {0.93695,0.90374,0.90562},
+        {0.93899,0.90139,0.90027},
+        {0.94078,0.89845,0.89453},
+        {0.94232,0.89499,0.88845},
+        {0.94363,0.89105,0.88206},
+        {0.94474,0.8867,0.87541},
+        {0.94565,0.88198,0.86855},
+        {0.94638,0.87695,0.86149},
+        {0.94697,0.87168,0.85429},
+        {0.94743,0.86619,0.84698},
+        {0.94776,0.86054,0.83959},
+        {0.948,0.85477,0.83212},
+        {0.94815,0.8489,0.82461},
+        {0.94822,0.84295,0.81708},
+        {0.94823,0.83695,0.80952},
+        {0.94818,0.83092,0.80196},
+        {0.94808,0.82486,0.79439},
+        {0.94793,0.81878,0.78683},
+        {0.94774,0.81269,0.77926},
+        {0.9475,0.8066,0.77171},
+        {0.94722,0.8005,0.76417},
+        {0.9469,0.7944,0.75665},
+        {0.94655,0.78831,0.74913},
+        {0.94616,0.78221,0.74163},
+        {0.94574,0.77612,0.73414},
+        {0.94528,0.77003,0.72666},
+        {0.94479,0.76394,0.7192},
+        {0.94425,0.75785,0.71174},
+        {0.94369,0.75176,0.7043},
+        {0.94309,0.74567,0.69687},
+        {0.94245,0.73959,0.68946},
+        {0.94178,0.73349,0.68205},
+        {0.94108,0.7274,0.67466},
+        {0.94034,0.72131,0.66728},
+        {0.93957,0.71523,0.65991},
+        {0.93876,0.70914,0.65256},
+        {0.93793,0.70305,0.64521},
+        {0.93706,0.69695,0.63789},
+        {0.93616,0.69086,0.63058},
+        {0.93522,0.68477,0.62327},
+        {0.93425,0.67867,0.61598},
+        {0.93325,0.67258,0.60871},
+        {0.93222,0.66648,0.60143},
+        {0.93116,0.66038,0.59418},
+        {0.93006,0.65428,0.58694},
+        {0.92893,0.64818,0.57973},
+        {0.92777,0.64208,0.57251},
+        {0.92659,0.63597,0.5653},
+        {0.92537,0.62986,0.55812},
+        {0.92412,0.62375,0.55095},
+        {0.92285,0.61762,0.54379},
+        {0.92154,0.61151,0.53665},
+        {0.9202,0.60538,0.52951},
+        {0.91883,0.59925,0.52238},
+        {0.91743,0.59312,0.51527},
+        {0.916,0.58697,0.50819},
+        {0.91455,0.58083,0.5011},
+        {0.91306,0.57468,0.49403},
+        {0.91155,0.56853,0.48698},
+        {0.91001,0.56237,0.47994},
+        {0.90844,0.55619,0.4729},
+        {0.90684,0.55002,0.46589},
+        {0.90521,0.54384,0.45889},
+        {0.90355,0.53765,0.45191},
+        {0.90187,0.53145,0.44493},
+        {0.90016,0.52524,0.43797},
+        {0.89842,0.51903,0.43102},
+        {0.89665,0.51279,0.42408},
+        {0.89486,0.50655,0.41717},
+        {0.89304,0.5003,0.41026},
+        {0.89119,0.49404,0.40336},
+        {0.88932,0.48777,0.39647},
+        {0.88741,0.48147,0.3896},
+        {0.88549,0.47518,0.38274},
+        {0.88354,0.46885,0.3759},
+        {0.88156,0.46251,0.36907},
+        {0.87955,0.45616,0.36225},
+        {0.87752,0.4498,0.35546},
+        {0.87547,0.44341,0.34865},
+        {0.87338,0.437,0.34187},
+        {0.87128,0.43057,0.33511},
+        {0.86914,0.42411,0.32834},
+        {0.86698,0.41764,0.32159},
+        {0.8648,0.41114,0.31485},
+        {0.8626,0.40461,0.30813},
+        {0.86036,0.39806,0.30141},
+        {0.8581,0.39148,0.29471},
+        {0.85582,0.38485,0.28802},
+        {0.85351,0.37821,0.28133},
+        {0.85118,0.37151,0.27466},
+        {0.84883,0.36479,0.26799},
+        {0.84645,0.35804,0.26135},
+        {0.84405,0.35123,0.25471},
+        {0.84163,0.34436,0.24807},
+        {0.83918,0.33747,0.24143},
+        {0.83671,0.3305,0.23481},
+        {0.83422,0.32349,0.22818},
+        {0.8317,0.31643,0.22155},
+        {0.82916,0.30929,0.21492},
+        {0.82659,0.30206,0.20831},
+        {0.824,0.29477,0.20168},
+        {0.8214,0.2874,0.19508},
+        {0.81876,0.27996,0.18847},
+        {0.81611,0.27239,0.1818},
+        {0.81343,0.26474,0.17519},
+        {0.81074,0.25697,0.16854},
+        {0.80802,0.24907,0.16191},
+        {0.80528,0.24103,0.15521},
+        {0.80252,0.23283,0.1485},
+        {0.79974,0.22446,0.1418},
+        {0.79693,0.21594,0.13506},
+        {0.79411,0.20718,0.12827},
+        {0.79126,0.19815,0.12139},
+        {0.78839,0.18889,0.1145},
+        {0.78551,0.1793,0.10759},
+        {0.7826,0.16938,0.10056},
+        {0.77967,0.15898,0.093435},
+        {0.77672,0.14808,0.086208},
+        {0.77375,0.13656,0.078844},
+        {0.77076,0.12429,0.07141},
+        {0.76775,0.11107,0.063657},
+        {0.76473,0.096422,0.055653},
+        {0.76168,0.080002,0.047336},
+        {0.75862,0.060659,0.038618},
+        {0.75553,0.03608,0.029827},
+        {0.75243,0.0084181,0.021805}
+    },
+    {
+        {0,0.85071,1},
+        {0,0.85194,1},
+        {0.056211,0.85316,1},
+        {0.10029,0.85438,1},
+        {0.13168,0.8556,1},
+        {0.15712,0.85682,1},
+        {0.17902,0.85804,1},
+        {0.19846,0.85925,1},
+        {0.21615,0.86047,1},
+        {0.23241,0.86169,1},
+        {0.24758,0.8629,1},
+        {0.26183,0.86412,1},
+        {0.27532,0.86533,1},
+        {0.28813,0.86654,1},
+        {0.30039,0.86775,1},
+        {0.31215,0.86897,1},
+        {0.32349,0.87017,1},
+        {0.33443,0.87138,1},
+        {0.34499,0.87259,1},
+        {0.35526,0.87379,1},
+        {0.36521,0.875,1},
+        {0.37491,0.87621,1},
+        {0.38437,0.87741,1},
+        {0.3936,0.87861,1},
+        {0.40262,0.87982,1},
+        {0.41146,0.88102,1},
+        {0.42011,0.88222,1},
+        {0.4286,0.88342,1},
+        {0.43693,0.88462,1},
+        {0.44511,0.88582,1},
+        {0.45315,0.88702,1},
+        {0.46106,0.88821,1},
+        {0.46885,0.88941,1},
+        {0.47652,0.8906,1},
+        {0.48407,0.8918,1},
+        {0.49154,0.89299,1},
+        {0.49889,0.89419,1},
+        {0.50614,0.89538,1},
+        {0.51332,0.89657,1},
+        {0.5204,0.89776,1},
+        {0.5274,0.89895,1},
+        {0.53432,0.90014,1},
+        {0.54117,0.90132,1},
+        {0.54795,0.90251,1},
+        {0.55466,0.9037,1},
+        {0.56129,0.90488,1},
+        {0.56787,0.90607,1},
+        {0.57438,0.90725,1},
+        {0.58084,0.90844,1},
+        {0.58724,0.90962,1},
+        {0.59358,0.9108,1},
+        {0.59988,0.91198,1},
+        {0.60611,0.91316,1},
+        {0.6123,0.91434,1},
+        {0.61845,0.91551,1},
+        {0.62455,0.91669,1},
+        {0.6306,0.91787,1},
+        {0.63661,0.91904,1},
+        {0.64258,0.92021,1},
+        {0.6485,0.92139,1},
+        {0.65439,0.92256,1},
+        {0.66024,0.92373,1},
+        {0.66606,0.9249,1},
+        {0.67183,0.92607,1},
+        {0.67758,0.92724,1},
+        {0.68329,0.92841,1},
+        {0.68897,0.92958,1},
+        {0.69461,0.93075,1},
+        {0.70023,0.93191,1},
+        {0.70581,0.93307,1},
+        {0.71137,0.93424,1},
+        {0.7169,0.9354,1},
+        {0.72239,0.93657,1},
+        {0.72786,0.93773,1},
+        {0.73331,0.93889,1},
+        {0.73873,0.94005,1},
+        {0.74412,0.94121,1},
+        {0.74949,0.94237,1},
+        {0.75485,0.94352,1},
+        {0.76017,0.94468,1},
+        {0.76547,0.94583,1},
+        {0.77075,0.94699,1},
+        {0.776,0.94814,1},
+        {0.78124,0.9493,1},
+        {0.78646,0.95045,1},
+        {0.79165,0.9516,1},
+        {0.79683,0.95275,1},
+        {0.80199,0.9539,1},
+        {0.80713,0.95505,1},
+        {0.81224,0.9562,1},
+        {0.81735,0.95735,1},
+        {0.82244,0.9585,1},
+        {0.8275,0.95964,1},
+        {0.83255,0.96079,1},
+        {0.83759,0.96192,1},
+        {0.84261,0.96307,1},
+        {0.8476,0.96421,1},
+        {0.8526,0.96535,1},
+        {0.85756,0.9665,1},
+        {0.86253,0.96764,1},
+        {0.86746,0.96878,1},
+        {0.8724,0.96991,1},
+        {0.87731,0.97105,1},
+        {0.88221,0.97219,1},
+        {0.8871,0.97332,1},
+        {0.89197,0.97446,1},
+        {0.89684,0.97559,1},
+        {0.90168,0.97672,1},
+        {0.90652,0.97786,1},
+        {0.91134,0.97899,1},
+        {0.91615,0.98012,1},
+        {0.92095,0.98125,1},
+        {0.92575,0.98238,1},
+        {0.93053,0.98351,1},
+        {0.93529,0.98464,1},
+        {0.94005,0.98576,1},
+        {0.9448,0.98689,1},
+        {0.94953,0.98801,1},
+        {0.95426,0.98914,1},
+        {0.95897,0.99026,1},
+        {0.96367,0.99138,1},
+        {0.96837,0.99251,1},
+        {0.97306,0.99363,1},
+        {0.97773,0.99474,1},
+        {0.9824,0.99586,1},
+        {0.98725,0.99702,1},
+        {0.9912,0.99798,1},
+        {0.99685,0.99934,1},
+        {0.99988,0.9982,0.99969},
+        {0.99991,0.99575,0.99926},
+        {0.99993,0.9933,0.99882},
+        {0.99994,0.99084,0.99839},
+        {0.99996,0.98838,0.99796},
+        {0.99997,0.98593,0.99752},
+        {0.99998,0.98347,0.99709},
+        {0.99998,0.98102,0.99665},
+        {0.99998,0.97856,0.99622},
+        {0.99998,0.97611,0.99578},
+        {0.99998,0.97365,0.99535},
+        {0.99997,0.97119,0.99491},
+        {0.99996,0.96874,0.99448},
+        {0.99995,0.96628,0.99404},
+        {0.99993,0.96382,0.99361},
+        {0.99991,0.96136,0.99317},
+        {0.99989,0.9589,0.99273},
+        {0.99986,0.95644,0.99229},
+        {0.99984,0.95398,0.99185},
+        {0.9998,0.95152,0.99141},
+        {0.99977,0.94906,0.99097},
+        {0.99973,0.9466,0.99053},
+        {0.99969,0.94414,0.99009},
+        {0.99965,0.94167,0.98965},
+        {0.9996,0.93921,0.98921},
+        {0.99955,0.93675,0.98877},
+        {0.9995,0.93428,0.98832},
+        {0.99945,0.93182,0.98788},
+        {0.99939,0.92935,0.98744},
+        {0.99933,0.92689,0.987},
+        {0.99926,0.92442,0.98656},
+        {0.9992,0.92196,0.98611},
+        {0.99913,0.91949,0.98567},
+        {0.99905,0.91702,0.98522},
+        {0.99898,0.91455,0.98478},
+        {0.9989,0.91208,0.98433},
+        {0.99882,0.90961,0.98388},
+        {0.99873,0.90714,0.98343},
+        {0.99865,0.90467,0.98299},
+        {0.99855,0.9022,0.98254},
+        {0.99846,0.89973,0.9821},
+        {0.99837,0.89726,0.98165},
+        {0.99827,0.89478,0.9812},
+        {0.99816,0.89231,0.98075},
+        {0.99806,0.88983,0.9803},
+        {0.99795,0.88735,0.97985},
+        {0.99784,0.88488,0.9794},
+        {0.99773,0.8824,0.97894},
+        {0.99761,0.87992,0.97849},
+        {0.99749,0.87744,0.97804},
+        {0.99737,0.87496,0.97759},
+        {0.99725,0.87248,0.97714},
+        {0.99712,0.87,0.97668},
+        {0.99699,0.86752,0.97623},
+        {0.99686,0.86503,0.97578},
+        {0.99672,0.86256,0.97532},
+        {0.99658,0.86007,0.97487},
+        {0.99644,0.85758,0.97441},
+        {0.9963,0.8551,0.97396},
+        {0.99615,0.85261,0.9735},
+        {0.996,0.85012,0.97305},
+        {0.99585,0.84763,0.97259},
+        {0.9957,0.84514,0.97214},
+        {0.99554,0.84265,0.97168},
+        {0.99538,0.84016,0.97122},
+        {0.99522,0.83767,0.97076},
+        {0.99505,0.83517,0.9703},
+        {0.99488,0.83267,0.96984},
+        {0.99471,0.83018,0.96938},
+        {0.99454,0.82768,0.96892},
+        {0.99436,0.82518,0.96846},
+        {0.99418,0.82268,0.96801},
+        {0.994,0.82018,0.96754},
+        {0.99382,0.81768,0.96708},
+        {0.99363,0.81518,0.96662},
+        {0.99344,0.81267,0.96615},
+        {0.99325,0.81017,0.96569},
+        {0.99305,0.80766,0.96523},
+        {0.99285,0.80516,0.96476},
+        {0.99265,0.80265,0.9643},
+        {0.99245,0.80014,0.96384},
+        {0.99224,0.79763,0.96337},
+        {0.99203,0.79512,0.96291},
+        {0.99182,0.7926,0.96244},
+        {0.99161,0.79009,0.96197},
+        {0.99139,0.78757,0.96151},
+        {0.99117,0.78506,0.96105},
+        {0.99095,0.78254,0.96058},
+        {0.99072,0.78001,0.96011},
+        {0.9905,0.7775,0.95964},
+        {0.99027,0.77497,0.95917},
+        {0.99003,0.77245,0.95871},
+        {0.9898,0.76992,0.95824},
+        {0.98956,0.76739,0.95777},
+        {0.98932,0.76487,0.9573},
+        {0.98908,0.76233,0.95683},
+        {0.98883,0.7598,0.95636},
+        {0.98858,0.75727,0.95589},
+        {0.98833,0.75474,0.95542},
+        {0.98808,0.7522,0.95494},
+        {0.98782,0.74966,0.95447},
+        {0.98756,0.74712,0.954},
+        {0.9873,0.74458,0.95353},
+        {0.98704,0.74204,0.95305},
+        {0.98677,0.7395,0.95258},
+        {0.9865,0.73694,0.9521},
+        {0.98623,0.7344,0.95163},
+        {0.98596,0.73185,0.95115},
+        {0.98568,0.72929,0.95068},
+        {0.9854,0.72674,0.9502},
+        {0.98512,0.72418,0.94972},
+        {0.98484,0.72162,0.94925},
+        {0.98455,0.71907,0.94877},
+        {0.98426,0.71651,0.94829},
+        {0.98397,0.71394,0.94782},
+        {0.98367,0.71138,0.94734},
+        {0.98338,0.70881,0.94686},
+        {0.98308,0.70624,0.94638},
+        {0.98278,0.70366,0.9459},
+        {0.98247,0.70109,0.94542},
+        {0.98217,0.69851,0.94494},
+        {0.98186,0.69594,0.94446},
+        {0.98154,0.69335,0.94398},
+        {0.98123,0.69077,0.9435},
+        {0.98091,0.68819,0.94302},
+        {0.98059,0.6856,0.94253},
+        {0.98027,0.68301,0.94205},
+        {0.97995,0.68041,0.94156}
+    },
+    {
+        {0.2109,0.65114,0.08795},
+        {0.21113,0.64645,0.089674},
+        {0.21134,0.64175,0.091371},
+        {0.21153,0.63707,0.092907},
+        {0.21169,0.63239,0.09454},
+        {0.21184,0.62772,0.095984},
+        {0.21196,0.62306,0.097463},
+        {0.21206,0.6184,0.098858},
+        {0.21214,0.61374,0.1002},
+        {0.2122,0.6091,0.10151},
+        {0.21223,0.60446,0.1028},
+        {0.21225,0.59982,0.10401},
+        {0.21225,0.59519,0.10517},
+        {0.21224,0.59056,0.10638},
+        {0.2122,0.58596,0.10746},
+        {0.21215,0.58134,0.10849},
+        {0.21207,0.57674,0.1096},
+        {0.21198,0.57214,0.11058},
+        {0.21187,0.56755,0.11155},
+        {0.21174,0.56297,0.11249},
+        {0.21159,0.55838,0.1134},
+        {0.21142,0.55382,0.11421},
+        {0.21123,0.54926,0.11506},
+        {0.21103,0.5447,0.11592},
+        {0.21081,0.54014,0.11669},
+        {0.21057,0.5356,0.11742},
+        {0.21032,0.53106,0.1182},
+        {0.21005,0.52654,0.1189},
+        {0.20977,0.522,0.11955},
+        {0.20946,0.5175,0.1202},
+        {0.20915,0.51298,0.12082},
+        {0.20881,0.50848,0.12142},
+        {0.20846,0.50398,0.122},
+        {0.2081,0.49948,0.12257},
+        {0.20772,0.49501,0.12311},
+        {0.20732,0.49053,0.12363},
+        {0.20692,0.48605,0.12413},
+        {0.20649,0.48159,0.12461},
+        {0.20604,0.47713,0.12507},
+        {0.20556,0.47268,0.12553},
+        {0.20508,0.46824,0.12595},
+        {0.2046,0.46381,0.12633},
+        {0.2041,0.45938,0.12668},
+        {0.20357,0.45497,0.12703},
+        {0.20302,0.45055,0.12737},
+        {0.20246,0.44614,0.12771},
+        {0.20189,0.44175,0.12802},
+        {0.2013,0.43736,0.1283},
+        {0.2007,0.43297,0.12855},
+        {0.20009,0.42859,0.12879},
+        {0.19947,0.42421,0.12902},
+        {0.19883,0.41986,0.12924},
+        {0.19818,0.4155,0.12945},
+        {0.19752,0.41115,0.12965},
+        {0.19686,0.40681,0.12982},
+        {0.19616,0.40247,0.12998},
+        {0.19543,0.39816,0.13012},
+        {0.19472,0.39383,0.13024},
+        {0.19399,0.38952,0.13034},
+        {0.19321,0.38522,0.13043},
+        {0.19244,0.38094,0.13051},
+        {0.19166,0.37665,0.13056},
+        {0.19086,0.37236,0.13061},
+        {0.19005,0.36809,0.13064},
+        {0.18924,0.36383,0.13066},
+        {0.18842,0.35958,0.13066},
+        {0.18757,0.35534,0.13065},
+        {0.18668,0.3511,0.13063},
+        {0.18583,0.34687,0.13059},
+        {0.18493,0.34265,0.13054},
+        {0.184,0.33842,0.13048},
+        {0.18308,0.33422,0.13041},
+        {0.18214,0.33002,0.13032},
+        {0.1812,0.32581,0.13022},
+        {0.18025,0.32164,0.1301},
+        {0.17928,0.31747,0.12997},
+        {0.17832,0.31331,0.12982},
+        {0.17731,0.30916,0.12966},
+        {0.17626,0.305,0.12949},
+        {0.17526,0.30085,0.1293},
+        {0.17423,0.29673,0.1291},
+        {0.17316,0.29259,0.1289},
+        {0.1721,0.28848,0.1287},
+        {0.17102,0.28437,0.12849},
+        {0.16995,0.28027,0.12827},
+        {0.16885,0.27621,0.12802},
+        {0.16771,0.27209,0.12776},
+        {0.16659,0.26803,0.12748},
+        {0.16541,0.26399,0.12719},
+        {0.1643,0.25993,0.1269},
+        {0.16312,0.25587,0.12661},
+        {0.16194,0.25185,0.12632},
+        {0.16072,0.24783,0.12601},
+        {0.1595,0.24378,0.12567},
+        {0.1583,0.23979,0.12532},
+        {0.15704,0.2358,0.12495},
+        {0.15581,0.23181,0.12458},
+        {0.15452,0.22783,0.1242},
+        {0.15324,0.22384,0.12382},
+        {0.15195,0.21989,0.12342},
+        {0.15065,0.21594,0.12301},
+        {0.14935,0.212,0.1226},
+        {0.148,0.20805,0.12217},
+        {0.14664,0.20414,0.12174},
+        {0.14533,0.20018,0.1213},
+        {0.14393,0.19632,0.12085},
+        {0.14254,0.1924,0.1204},
+        {0.14116,0.18853,0.11993},
+        {0.1397,0.18465,0.11946},
+        {0.13835,0.18077,0.11899},
+        {0.13693,0.17695,0.11852},
+        {0.13553,0.17313,0.118},
+        {0.1342,0.16938,0.11747},
+        {0.13286,0.16558,0.11697},
+        {0.13158,0.16193,0.1165},
+        {0.13041,0.15828,0.116},
+        {0.12925,0.1547,0.11549},
+        {0.12828,0.15123,0.11499},
+        {0.12744,0.14789,0.11453},
+        {0.1268,0.14468,0.11413},
+        {0.12643,0.14163,0.11378},
+        {0.12631,0.13876,0.11346},
+        {0.12649,0.13609,0.11319},
+        {0.12701,0.13374,0.11297},
+        {0.12798,0.13162,0.11282},
+        {0.12929,0.12981,0.11275},
+        {0.13109,0.12828,0.11276},
+        {0.1333,0.12705,0.11287},
+        {0.13593,0.12624,0.11307},
+        {0.13905,0.12571,0.11335},
+        {0.14261,0.1255,0.11371},
+        {0.14653,0.12561,0.11414},
+        {0.15086,0.12602,0.11466},
+        {0.15553,0.12666,0.11531},
+        {0.16047,0.12758,0.11603},
+        {0.1657,0.12871,0.11675},
+        {0.17119,0.13008,0.11752},
+        {0.17685,0.13154,0.11839},
+        {0.18266,0.13315,0.11923},
+        {0.18863,0.1349,0.1201},
+        {0.1947,0.13667,0.121},
+        {0.20079,0.13857,0.12192},
+        {0.20703,0.1405,0.12286},
+        {0.21324,0.14246,0.12382},
+        {0.21954,0.14446,0.12478},
+        {0.22586,0.14644,0.12577},
+        {0.23219,0.14845,0.12669},
+        {0.23851,0.1505,0.12766},
+        {0.24487,0.1525,0.12861},
+        {0.25127,0.15454,0.12959},
+        {0.25763,0.15658,0.13056},
+        {0.26403,0.1586,0.13149},
+        {0.27043,0.16058,0.13244},
+        {0.27682,0.16261,0.13339},
+        {0.28323,0.1646,0.13435},
+        {0.28965,0.1666,0.13528},
+        {0.29607,0.16858,0.13618},
+        {0.3025,0.17056,0.13717},
+        {0.30898,0.17253,0.13812},
+        {0.31543,0.17453,0.13902},
+        {0.3219,0.17646,0.13994},
+        {0.32839,0.17847,0.14093},
+        {0.33489,0.18039,0.14184},
+        {0.34139,0.18234,0.14277},
+        {0.34791,0.1843,0.1437},
+        {0.35444,0.18626,0.14463},
+        {0.36096,0.18821,0.14557},
+        {0.36752,0.19011,0.14645},
+        {0.3741,0.19204,0.14739},
+        {0.38068,0.19399,0.14829},
+        {0.38725,0.19589,0.14922},
+        {0.39386,0.1978,0.15015},
+        {0.40049,0.19969,0.15104},
+        {0.40711,0.2016,0.15194},
+        {0.41375,0.20353,0.15285},
+        {0.4204,0.20541,0.15376},
+        {0.42707,0.20731,0.15468},
+        {0.43374,0.20919,0.1556},
+        {0.44044,0.21108,0.15651},
+        {0.44714,0.21294,0.15738},
+        {0.45386,0.21481,0.15831},
+        {0.46058,0.21671,0.15919},
+        {0.46734,0.21856,0.16006},
+        {0.47409,0.22044,0.16099},
+        {0.48085,0.22227,0.1619},
+        {0.48764,0.22411,0.16278},
+        {0.49444,0.22599,0.16368},
+        {0.50124,0.22782,0.16455},
+        {0.50806,0.22963,0.1654},
+        {0.51489,0.2315,0.16631},
+        {0.52173,0.2333,0.16721},
+        {0.5286,0.23516,0.16807},
+        {0.53546,0.23698,0.16898},
+        {0.54234,0.23877,0.16985},
+        {0.54924,0.24058,0.17071},
+        {0.55614,0.2424,0.17158},
+        {0.56307,0.2442,0.17245},
+        {0.56999,0.246,0.17332},
+        {0.57695,0.24782,0.17421},
+        {0.5839,0.24959,0.17508},
+        {0.59087,0.25141,0.17591},
+        {0.59785,0.25318,0.17679},
+        {0.60485,0.25498,0.17769},
+        {0.61185,0.25674,0.17854},
+        {0.61888,0.25851,0.17939},
+        {0.6259,0.26028,0.18024},
+        {0.63295,0.26205,0.18109},
+        {0.64001,0.26383,0.18194},
+        {0.64708,0.26557,0.1828},
+        {0.65415,0.26731,0.18366},
+        {0.66125,0.26909,0.18452},
+        {0.66835,0.27084,0.18539},
+        {0.67547,0.27256,0.18622},
+        {0.68259,0.27431,0.18707},
+        {0.68974,0.27606,0.18793},
+        {0.69689,0.27778,0.18876},
+        {0.70405,0.27952,0.18959},
+        {0.71123,0.28123,0.19042},
+        {0.71841,0.28297,0.19126},
+        {0.72562,0.28467,0.1921},
+        {0.73282,0.28638,0.19294},
+        {0.74005,0.2881,0.19379},
+        {0.74728,0.28981,0.19463},
+        {0.75453,0.29152,0.19544},
+        {0.76178,0.29321,0.19629},
+        {0.76904,0.2949,0.19711},
+        {0.77633,0.29661,0.19792},
+        {0.78362,0.29829,0.19874},
+        {0.79092,0.29998,0.19955},
+        {0.79823,0.30166,0.20037},
+        {0.80555,0.30334,0.2012},
+        {0.81289,0.30503,0.20202},
+        {0.82024,0.3067,0.20285},
+        {0.82759,0.30837,0.20368},
+        {0.83497,0.31005,0.2045},
+        {0.84235,0.31169,0.20529},
+        {0.84974,0.31336,0.20613},
+        {0.85714,0.31501,0.20694},
+        {0.86455,0.31667,0.20773},
+        {0.87198,0.31832,0.20854},
+        {0.87941,0.31997,0.20934},
+        {0.88686,0.3216,0.21015},
+        {0.89431,0.32325,0.21095},
+        {0.90178,0.32488,0.21177},
+        {0.90925,0.32651,0.21256},
+        {0.91675,0.32815,0.21334},
+        {0.92424,0.32979,0.21416},
+        {0.93175,0.33139,0.21494},
+        {0.93927,0.33303,0.21575},
+        {0.9468,0.33465,0.21655},
+        {0.95434,0.33625,0.21733},
+        {0.96189,0.33786,0.21812},
+        {0.96945,0.33948,0.21891},
+        {0.97703,0.34108,0.2197},
+        {0.98461,0.34269,0.2205},
+        {0.9922,0.34427,0.22128}
+    },
+    {
+        {0.22157,0.59107,0.055073},
+        {0.22965,0.59389,0.068993},
+        {0.2376,0.59671,0.081291},
+        {0.24531,0.59952,0.092565},
+        {0.25292,0.60233,0.10315},
+        {0.26037,0.60514,0.11313},
+        {0.26768,0.60796,0.12253},
+        {0.27491,0.61076,0.13168},
+        {0.28202,0.61356,0.14045},
+        {0.28902,0.61637,0.14894},
+        {0.29592,0.61918,0.15721},
+        {0.30273,0.62197,0.16528},
+        {0.3095,0.62478,0.1732},
+        {0.31616,0.62758,0.18095},
+        {0.32276,0.63038,0.18859},
+        {0.32929,0.63317,0.1961},
+        {0.33575,0.63597,0.20349},
+        {0.34216,0.63876,0.21079},
+        {0.34851,0.64155,0.21802},
+        {0.35482,0.64434,0.22514},
+        {0.36105,0.64714,0.23224},
+        {0.36726,0.64993,0.23924},
+        {0.37343,0.65271,0.24619},
+        {0.37954,0.6555,0.25311},
+        {0.38562,0.65828,0.25997},
+        {0.39167,0.66106,0.26678},
+        {0.39767,0.66385,0.27357},
+        {0.40364,0.66662,0.28029},
+        {0.40958,0.66941,0.287},
+        {0.41548,0.67219,0.29368},
+        {0.42135,0.67496,0.30034},
+        {0.42721,0.67774,0.30697},
+        {0.43302,0.68051,0.31358},
+        {0.43881,0.68328,0.32017},
+        {0.44459,0.68606,0.32672},
+        {0.45032,0.68883,0.33328},
+        {0.45604,0.6916,0.33982},
+        {0.46174,0.69436,0.34632},
+        {0.46742,0.69713,0.35283},
+        {0.47307,0.6999,0.35932},
+        {0.47871,0.70267,0.3658},
+        {0.48432,0.70543,0.37227},
+        {0.48992,0.70819,0.37873},
+        {0.49551,0.71096,0.38518},
+        {0.50108,0.71371,0.39164},
+        {0.50662,0.71648,0.39808},
+        {0.51215,0.71923,0.40451},
+        {0.51768,0.72199,0.41095},
+        {0.52318,0.72475,0.41738},
+        {0.52867,0.7275,0.42379},
+        {0.53414,0.73026,0.43022},
+        {0.5396,0.73301,0.43664},
+        {0.54506,0.73576,0.44305},
+        {0.5505,0.73851,0.44946},
+        {0.55592,0.74126,0.45587},
+        {0.56134,0.74401,0.46228},
+        {0.56675,0.74676,0.4687},
+        {0.57214,0.7495,0.47512},
+        {0.57752,0.75225,0.48152},
+        {0.58289,0.755,0.48794},
+        {0.58826,0.75775,0.49435},
+        {0.59362,0.76049,0.50076},
+        {0.59896,0.76323,0.50717},
+        {0.60431,0.76597,0.5136},
+        {0.60963,0.76871,0.52001},
+        {0.61495,0.77146,0.52644},
+        {0.62027,0.77419,0.53286},
+        {0.62557,0.77693,0.53928},
+        {0.63088,0.77967,0.54572},
+        {0.63617,0.7824,0.55215},
+        {0.64145,0.78514,0.55858},
+        {0.64673,0.78787,0.56502},
+        {0.652,0.79061,0.57147},
+        {0.65727,0.79334,0.57791},
+        {0.66253,0.79607,0.58437},
+        {0.66778,0.7988,0.59082},
+        {0.67303,0.80153,0.59729},
+        {0.67827,0.80426,0.60376},
+        {0.68351,0.80699,0.61022},
+        {0.68875,0.80972,0.6167},
+        {0.69397,0.81244,0.62318},
+        {0.69919,0.81517,0.62965},
+        {0.70441,0.8179,0.63615},
+        {0.70963,0.82062,0.64264},
+        {0.71483,0.82335,0.64914},
+        {0.72004,0.82607,0.65564},
+        {0.72525,0.82879,0.66215},
+        {0.73044,0.83152,0.66866},
+        {0.73563,0.83424,0.67518},
+        {0.74082,0.83696,0.6817},
+        {0.74601,0.83968,0.68824},
+        {0.7512,0.84239,0.69477},
+        {0.75637,0.84511,0.70131},
+        {0.76155,0.84782,0.70786},
+        {0.76672,0.85054,0.71441},
+        {0.77189,0.85326,0.72097},
+        {0.77706,0.85597,0.72754},
+        {0.78223,0.85869,0.73411},
+        {0.78739,0.8614,0.74068},
+        {0.79255,0.86412,0.74727},
+        {0.7977,0.86682,0.75386},
+        {0.80286,0.86954,0.76045},
+        {0.80801,0.87225,0.76705},
+        {0.81316,0.87496,0.77366},
+        {0.81831,0.87767,0.78027},
+        {0.82345,0.88037,0.7869},
+        {0.8286,0.88308,0.79353},
+        {0.83375,0.88579,0.80016},
+        {0.83889,0.88849,0.80678},
+        {0.84403,0.89117,0.8134},
+        {0.84917,0.89385,0.82001},
+        {0.8543,0.8965,0.82659},
+        {0.85943,0.89913,0.83314},
+        {0.86454,0.90171,0.83964},
+        {0.86965,0.90424,0.84606},
+        {0.87473,0.9067,0.85239},
+        {0.87979,0.90907,0.85857},
+        {0.88483,0.91132,0.8646},
+        {0.88981,0.91343,0.87039},
+        {0.89474,0.91536,0.87592},
+        {0.8996,0.91708,0.88112},
+        {0.90436,0.91854,0.88593},
+        {0.90902,0.91973,0.89029},
+        {0.91355,0.92058,0.89413},
+        {0.91792,0.92108,0.8974},
+        {0.92213,0.9212,0.90005},
+        {0.92614,0.92091,0.90203},
+        {0.92995,0.9202,0.90332},
+        {0.93353,0.91905,0.9039},
+        {0.9369,0.91749,0.90377},
+        {0.94002,0.91549,0.90294},
+        {0.94291,0.91311,0.90144},
+        {0.94556,0.91036,0.89932},
+        {0.94799,0.90726,0.89661},
+        {0.95021,0.90386,0.89338},
+        {0.95224,0.90019,0.88969},
+        {0.95409,0.89629,0.8856},
+        {0.95578,0.89219,0.88117},
+        {0.95733,0.88793,0.87646},
+        {0.95876,0.88354,0.87154},
+        {0.96008,0.87904,0.86642},
+        {0.96131,0.87447,0.86117},
+        {0.96246,0.86983,0.85582},
+        {0.96355,0.86515,0.85038},
+        {0.96458,0.86044,0.8449},
+        {0.96556,0.8557,0.83937},
+        {0.9665,0.85093,0.83383},
+        {0.9674,0.84616,0.82826},
+        {0.96826,0.84138,0.82269},
+        {0.96908,0.83659,0.81711},
+        {0.96988,0.83181,0.81154},
+        {0.97064,0.82702,0.80597},
+        {0.97138,0.82223,0.80041},
+        {0.9721,0.81743,0.79486},
+        {0.97278,0.81263,0.78932},
+        {0.97344,0.80784,0.78378},
+        {0.97407,0.80303,0.77824},
+        {0.97467,0.79823,0.77271},
+        {0.97524,0.79344,0.76719},
+        {0.97579,0.78863,0.76168},
+        {0.97632,0.78382,0.75618},
+        {0.97682,0.77901,0.75068},
+        {0.97729,0.7742,0.74518},
+        {0.97774,0.76938,0.7397},
+        {0.97816,0.76457,0.73422},
+        {0.97855,0.75974,0.72875},
+        {0.97893,0.75493,0.72328},
+        {0.97928,0.7501,0.71783},
+        {0.9796,0.74527,0.71237},
+        {0.9799,0.74044,0.70693},
+        {0.98017,0.7356,0.70149},
+        {0.98042,0.73077,0.69606},
+        {0.98064,0.72593,0.69063},
+        {0.98084,0.72108,0.68522},
+        {0.98102,0.71624,0.6798},
+        {0.98118,0.71138,0.6744},
+        {0.98131,0.70653,0.66901},
+        {0.98142,0.70166,0.66363},
+        {0.9815,0.69679,0.65824},
+        {0.98157,0.69193,0.65286},
+        {0.98161,0.68705,0.6475},
+        {0.98162,0.68217,0.64214},
+        {0.98162,0.67729,0.63679},
+        {0.98159,0.6724,0.63144},
+        {0.98154,0.6675,0.6261},
+        {0.98147,0.6626,0.62077},
+        {0.98138,0.6577,0.61544},
+        {0.98126,0.65278,0.61013},
+        {0.98113,0.64786,0.60482},
+        {0.98097,0.64294,0.59952},
+        {0.98079,0.63801,0.59422},
+        {0.98059,0.63307,0.58893},
+        {0.98037,0.62813,0.58366},
+        {0.98013,0.62318,0.57838},
+        {0.97987,0.61821,0.57313},
+        {0.97959,0.61324,0.56786},
+        {0.97929,0.60827,0.56262},
+        {0.97896,0.60329,0.55738},
+        {0.97862,0.59829,0.55214},
+        {0.97826,0.59329,0.54691},
+        {0.97788,0.58827,0.54169},
+        {0.97747,0.58326,0.53649},
+        {0.97705,0.57822,0.53128},
+        {0.97661,0.57319,0.52609},
+        {0.97615,0.56814,0.5209},
+        {0.97567,0.56308,0.51571},
+        {0.97517,0.558,0.51054},
+        {0.97465,0.55292,0.50537},
+        {0.97411,0.54782,0.50022},
+        {0.97355,0.54272,0.49508},
+        {0.97298,0.5376,0.48993},
+        {0.97239,0.53246,0.48479},
+        {0.97177,0.52731,0.47968},
+        {0.97114,0.52213,0.47456},
+        {0.97049,0.51696,0.46946},
+        {0.96982,0.51176,0.46436},
+        {0.96914,0.50655,0.45926},
+        {0.96843,0.50133,0.45417},
+        {0.96771,0.49607,0.4491},
+        {0.96697,0.49082,0.44403},
+        {0.96621,0.48553,0.43896},
+        {0.96544,0.48023,0.4339},
+        {0.96464,0.47491,0.42887},
+        {0.96383,0.46957,0.42382},
+        {0.96301,0.4642,0.4188},
+        {0.96216,0.45881,0.41378},
+        {0.9613,0.45339,0.40877},
+        {0.96042,0.44795,0.40377},
+        {0.95952,0.4425,0.39877},
+        {0.95861,0.43701,0.39379},
+        {0.95768,0.43149,0.38882},
+        {0.95673,0.42593,0.38384},
+        {0.95577,0.42035,0.37888},
+        {0.95479,0.41474,0.37393},
+        {0.9538,0.4091,0.36899},
+        {0.95278,0.40342,0.36405},
+        {0.95175,0.3977,0.35912},
+        {0.95071,0.39194,0.3542},
+        {0.94964,0.38614,0.3493},
+        {0.94857,0.38031,0.34439},
+        {0.94747,0.37443,0.33951},
+        {0.94636,0.3685,0.33463},
+        {0.94524,0.36251,0.32975},
+        {0.9441,0.35648,0.32487},
+        {0.94294,0.3504,0.32002},
+        {0.94177,0.34423,0.31516},
+        {0.94058,0.33802,0.31033},
+        {0.93938,0.33175,0.3055},
+        {0.93816,0.3254,0.30066},
+        {0.93693,0.31899,0.29584},
+        {0.93568,0.31248,0.29104},
+        {0.93441,0.30592,0.28623},
+        {0.93313,0.29924,0.28145},
+        {0.93184,0.29246,0.27668},
+        {0.93053,0.28558,0.27188},
+        {0.9292,0.27862,0.26712}
+    },
+    {
+        {0.22157,0.59107,0.055073},
+        {0.22965,0.59389,0.068993},
+        {0.2376,0.59671,0.081291},
+        {0.24531,0.59952,0.092565},
+        {0.25292,0.60233,0.10315},
+        {0.26037,0.60514,0.11313},
+        {0.26768,0.60796,0.12253},
+        {0.27491,0.61076,0.13168},
+        {0.28202,0.61356,0.14045},
+        {0.28902,0.61637,0.14894},
+        {0.29592,0.61918,0.15721},
+        {0.30273,0.62197,0.16528},
+        {0.3095,0.62478,0.1732},
+        {0.31616,0.62758,0.18095},
+        {0.32276,0.63038,0.18859},
+        {0.32929,0.63317,0.1961},
+        {0.33575,0.63597,0.20349},
+        {0.34216,0.63876,0.21079},
+        {0.34851,0.64155,0.21802},
+        {0.35482,0.64434,0.22514},
+        {0.36105,0.64714,0.23224},
+        {0.36726,0.64993,0.23924},
+        {0.37343,0.65271,0.24619},
+        {0.37954,0.6555,0.25311},
+        {0.38562,0.65828,0.25997},
+        {0.39167,0.66106,0.26678},
+        {0.39767,0.66385,0.27357},
+        {0.40364,0.66662,0.28029},
+        {0.40958,0.66941,0.287},
+        {0.41548,0.67219,0.29368},
+        {0.42135,0.67496,0.30034},
+        {0.42721,0.67774,0.30697},
+        {0.43302,0.68051,0.31358},
+        {0.43881,0.68328,0.32017},
+        {0.44459,0.68606,0.32672},
+        {0.45032,0.68883,0.33328},
+        {0.45604,0.6916,0.33982},
+        {0.46174,0.69436,0.34632},
+        {0.46742,0.69713,0.35283},
+        {0.47307,0.6999,0.35932},
+        {0.47871,0.70267,0.3658},
+        {0.48432,0.70543,0.37227},
+        {0.48992,0.70819,0.37873},
+        {0.49551,0.71096,0.38518},
+        {0.50108,0.71371,0.39164},
+        {0.50662,0.71648,0.39808},
+        {0.51215,0.71923,0.40451},
+        {0.51768,0.72199,0.41095},
+        {0.52318,0.72475,0.41738},
+        {0.52867,0.7275,0.42379},
+        {0.53414,0.73026,0.43022},
+        {0.5396,0.73301,0.43664},
+        {0.54506,0.73576,0.44305},
+        {0.5505,0.73851,0.44946},
+        {0.55592,0.74126,0.45587},
+        {0.56134,0.74401,0.46228},
+        {0.56675,0.74676,0.4687},
+        {0.57214,0.7495,0.47512},
+        {0.57752,0.75225,0.48152},
+        {0.58289,0.755,0.48794},
+        {0.58826,0.75775,0.49435},
+        {0.59362,0.76049,0.50076},
+        {0.59896,0.76323,0.50717},
+        {0.60431,0.76597,0.5136},
+        {0.60963,0.76871,0.52001},
+        {0.61495,0.77146,0.52644},
+        {0.62027,0.77419,0.53286},
+        {0.62557,0.77693,0.53928},
+        {0.63088,0.77967,0.54572},
+        {0.63617,0.7824,0.55215},
+        {0.64145,0.78514,0.55858},
+        {0.64673,0.78787,0.56502},
+        {0.652,0.79061,0.57147},
+        {0.65727,0.79334,0.57791},
+        {0.66253,0.79607,0.58437},
+        {0.66778,0.7988,0.59082},
+        {0.67303,0.80153,0.59729},
+        {0.67827,0.80426,0.60376},
+        {0.68351,0.80699,0.61022},
+        {0.68875,0.80972,0.6167},
+        {0.69397,0.81244,0.62318},
+        {0.69919,0.81517,0.62965},
+        {0.70441,0.8179,0.63615},
+        {0.70963,0.82062,0.64264},
+        {0.71483,0.82335,0.64914},
+        {0.72004,0.82607,0.65564},
+        {0.72525,0.82879,0.66215},
+        {0.73044,0.83152,0.66866},
+        {0.73563,0.83424,0.67518},
+        {0.74082,0.83696,0.6817},
+        {0.74601,0.83968,0.68824},
+        {0.7512,0.84239,0.69477},
+        {0.75637,0.84511,0.70131},
+        {0.76155,0.84782,0.70786},
+        {0.76672,0.85054,0.71441},
+        {0.77189,0.85326,0.72097},
+        {0.77706,0.85597,0.72754},
+        {0.78223,0.85869,0.73411},
+        {0.78739,0.8614,0.74068},
+        {0.79255,0.86412,0.74727},
+        {0.7977,0.86682,0.75386},
+        {0.80286,0.86954,0.76045},
+        {0.80801,0.87225,0.76705},
+        {0.81316,0.87496,0.77366},
+        {0.81831,0.87767,0.78027},
+        {0.82345,0.88037,0.7869},
+        {0.8286,0.88308,0.79353},
+        {0.83375,0.88579,0.80016},
+        {0.83888,0.88849,0.8068},
+        {0.84401,0.89118,0.81343},
+        {0.84914,0.89385,0.82007},
+        {0.85424,0.89651,0.82671},
+        {0.85933,0.89914,0.83333},
+        {0.8644,0.90172,0.83995},
+        {0.86942,0.90426,0.84652},
+        {0.8744,0.90673,0.85306},
+        {0.87932,0.90912,0.85955},
+        {0.88415,0.91139,0.86596},
+        {0.88888,0.91352,0.87228},
+        {0.89348,0.91548,0.87846},
+        {0.89792,0.91724,0.8845},
+        {0.90218,0.91875,0.89034},
+        {0.90621,0.92,0.89596},
+        {0.90998,0.92093,0.90131},
+        {0.91347,0.92152,0.90637},
+        {0.91664,0.92174,0.91109},
+        {0.91948,0.92157,0.91546},
+        {0.92195,0.92098,0.91944},
+        {0.92406,0.91999,0.92303},
+        {0.92579,0.91859,0.92621},
+        {0.92715,0.91679,0.92898},
+        {0.92815,0.9146,0.93137},
+        {0.92881,0.91206,0.93337},
+        {0.92915,0.90919,0.93503},
+        {0.9292,0.90603,0.93636},
+        {0.92898,0.9026,0.9374},
+        {0.92854,0.89895,0.93818},
+        {0.9279,0.89512,0.93875},
+        {0.9271,0.89113,0.93913},
+        {0.92616,0.88701,0.93935},
+        {0.92511,0.8828,0.93945},
+        {0.92397,0.87851,0.93946},
+        {0.92276,0.87416,0.93938},
+        {0.92149,0.86976,0.93925},
+        {0.92018,0.86533,0.93907},
+        {0.91883,0.86089,0.93886},
+        {0.91747,0.85642,0.93862},
+        {0.91607,0.85195,0.93837},
+        {0.91467,0.84746,0.93811},
+        {0.91325,0.84298,0.93783},
+        {0.91182,0.83849,0.93754},
+        {0.91039,0.834,0.93726},
+        {0.90894,0.82952,0.93697},
+        {0.9075,0.82502,0.93668},
+        {0.90604,0.82053,0.93639},
+        {0.90457,0.81605,0.93609},
+        {0.9031,0.81156,0.93579},
+        {0.90162,0.80708,0.93549},
+        {0.90014,0.80258,0.93519},
+        {0.89864,0.7981,0.93488},
+        {0.89715,0.79361,0.93457},
+        {0.89564,0.78912,0.93426},
+        {0.89412,0.78464,0.93395},
+        {0.8926,0.78014,0.93363},
+        {0.89107,0.77565,0.93332},
+        {0.88953,0.77117,0.93299},
+        {0.88799,0.76667,0.93267},
+        {0.88644,0.76218,0.93235},
+        {0.88488,0.75769,0.93202},
+        {0.88332,0.75319,0.93169},
+        {0.88174,0.7487,0.93136},
+        {0.88016,0.74421,0.93103},
+        {0.87857,0.73972,0.93069},
+        {0.87698,0.73522,0.93035},
+        {0.87538,0.73072,0.93001},
+        {0.87377,0.72622,0.92966},
+        {0.87215,0.72172,0.92931},
+        {0.87052,0.71723,0.92896},
+        {0.8689,0.71271,0.92861},
+        {0.86725,0.70822,0.92826},
+        {0.86561,0.70371,0.9279},
+        {0.86396,0.6992,0.92754},
+        {0.8623,0.69469,0.92718},
+        {0.86063,0.69018,0.92682},
+        {0.85895,0.68568,0.92645},
+        {0.85727,0.68116,0.92609},
+        {0.85558,0.67665,0.92572},
+        {0.85388,0.67213,0.92534},
+        {0.85218,0.66761,0.92497},
+        {0.85046,0.66309,0.92459},
+        {0.84874,0.65856,0.92421},
+        {0.84701,0.65404,0.92383},
+        {0.84528,0.64951,0.92345},
+        {0.84353,0.64497,0.92306},
+        {0.84178,0.64044,0.92267},
+        {0.84003,0.6359,0.92228},
+        {0.83826,0.63136,0.92189},
+        {0.83649,0.62682,0.92149},
+        {0.83471,0.62227,0.92109},
+        {0.83291,0.61772,0.92069},
+        {0.83112,0.61316,0.92029},
+        {0.82932,0.60861,0.91989},
+        {0.8275,0.60405,0.91948},
+        {0.82568,0.59948,0.91907},
+        {0.82386,0.59491,0.91866},
+        {0.82203,0.59033,0.91825},
+        {0.82018,0.58576,0.91784},
+        {0.81833,0.58117,0.91743},
+        {0.81648,0.57659,0.91701},
+        {0.81461,0.57199,0.91658},
+        {0.81273,0.56739,0.91615},
+        {0.81085,0.56279,0.91573},
+        {0.80897,0.55817,0.9153},
+        {0.80707,0.55356,0.91487},
+        {0.80516,0.54895,0.91444},
+        {0.80325,0.54431,0.91401},
+        {0.80133,0.53967,0.91357},
+        {0.7994,0.53504,0.91313},
+        {0.79746,0.53039,0.91269},
+        {0.79552,0.52573,0.91225},
+        {0.79357,0.52107,0.9118},
+        {0.7916,0.51639,0.91136},
+        {0.78964,0.51172,0.91091},
+        {0.78766,0.50703,0.91046},
+        {0.78568,0.50233,0.91001},
+        {0.78368,0.49764,0.90955},
+        {0.78168,0.49291,0.90909},
+        {0.77967,0.48819,0.90863},
+        {0.77766,0.48345,0.90817},
+        {0.77563,0.47871,0.90771},
+        {0.77359,0.47395,0.90724},
+        {0.77155,0.46919,0.90678},
+        {0.7695,0.46441,0.90631},
+        {0.76744,0.45961,0.90584},
+        {0.76538,0.45481,0.90536},
+        {0.76329,0.44999,0.90489},
+        {0.76121,0.44516,0.90441},
+        {0.75912,0.44031,0.90393},
+        {0.75702,0.43546,0.90345},
+        {0.75491,0.43057,0.90297},
+        {0.75278,0.42568,0.90248},
+        {0.75066,0.42076,0.90199},
+        {0.74852,0.41584,0.9015},
+        {0.74638,0.4109,0.90101},
+        {0.74423,0.40594,0.90052},
+        {0.74206,0.40096,0.90002},
+        {0.7399,0.39595,0.89953},
+        {0.73771,0.39092,0.89903},
+        {0.73552,0.38586,0.89853},
+        {0.73333,0.3808,0.89802},
+        {0.73112,0.37569,0.89752},
+        {0.7289,0.37056,0.89702},
+        {0.72668,0.36542,0.89651},
+        {0.72444,0.36023,0.896},
+        {0.72219,0.35504,0.89548},
+        {0.71995,0.34979,0.89497}
+    },
+    {
+        {0.21566,0.71777,0.92594},
+        {0.21805,0.71808,0.92254},
+        {0.2204,0.71839,0.91913},
+        {0.22272,0.7187,0.91573},
+        {0.22499,0.71901,0.91232},
+        {0.22727,0.71931,0.90891},
+        {0.2295,0.71962,0.9055},
+        {0.23174,0.71992,0.90208},
+        {0.23392,0.72022,0.89866},
+        {0.23611,0.72051,0.89524},
+        {0.23825,0.72081,0.89181},
+        {0.24038,0.7211,0.88838},
+        {0.2425,0.72139,0.88495},
+        {0.2446,0.72168,0.88151},
+        {0.24668,0.72196,0.87807},
+        {0.24877,0.72225,0.87462},
+        {0.25081,0.72253,0.87117},
+        {0.25284,0.72281,0.86772},
+        {0.25488,0.72309,0.86426},
+        {0.25687,0.72336,0.8608},
+        {0.25887,0.72363,0.85734},
+        {0.26085,0.7239,0.85387},
+        {0.26281,0.72417,0.8504},
+        {0.26477,0.72444,0.84692},
+        {0.26672,0.7247,0.84344},
+        {0.26866,0.72496,0.83996},
+        {0.27061,0.72522,0.83647},
+        {0.2725,0.72548,0.83297},
+        {0.27442,0.72573,0.82948},
+        {0.27635,0.72598,0.82598},
+        {0.27824,0.72622,0.82247},
+        {0.28012,0.72647,0.81896},
+        {0.28203,0.72671,0.81545},
+        {0.28389,0.72694,0.81193},
+        {0.28576,0.72718,0.8084},
+        {0.28764,0.72741,0.80487},
+        {0.28953,0.72764,0.80134},
+        {0.2914,0.72787,0.7978},
+        {0.29325,0.72809,0.79426},
+        {0.29511,0.72831,0.79071},
+        {0.29699,0.72853,0.78716},
+        {0.29885,0.72875,0.7836},
+        {0.3007,0.72896,0.78003},
+        {0.30255,0.72917,0.77647},
+        {0.30443,0.72937,0.77289},
+        {0.30631,0.72958,0.76931},
+        {0.30815,0.72978,0.76573},
+        {0.31004,0.72997,0.76213},
+        {0.31189,0.73016,0.75854},
+        {0.31378,0.73035,0.75494},
+        {0.31565,0.73053,0.75133},
+        {0.31753,0.73071,0.74772},
+        {0.31943,0.73089,0.74409},
+        {0.32131,0.73106,0.74047},
+        {0.32321,0.73123,0.73684},
+        {0.32511,0.7314,0.7332},
+        {0.32703,0.73156,0.72956},
+        {0.32897,0.73172,0.72591},
+        {0.33088,0.73187,0.72225},
+        {0.33284,0.73202,0.71859},
+        {0.33479,0.73217,0.71492},
+        {0.33674,0.73231,0.71125},
+        {0.33871,0.73244,0.70756},
+        {0.34069,0.73257,0.70388},
+        {0.34269,0.7327,0.70018},
+        {0.34469,0.73282,0.69648},
+        {0.34672,0.73293,0.69278},
+        {0.34875,0.73304,0.68906},
+        {0.35081,0.73315,0.68534},
+        {0.35286,0.73325,0.68161},
+        {0.35496,0.73334,0.67788},
+        {0.35706,0.73343,0.67413},
+        {0.35916,0.73351,0.67039},
+        {0.3613,0.73359,0.66663},
+        {0.36345,0.73366,0.66287},
+        {0.36562,0.73373,0.6591},
+        {0.36781,0.73379,0.65532},
+        {0.37003,0.73384,0.65155},
+        {0.37227,0.73388,0.64775},
+        {0.37454,0.73392,0.64396},
+        {0.37683,0.73395,0.64016},
+        {0.37914,0.73398,0.63635},
+        {0.38148,0.73399,0.63254},
+        {0.38384,0.734,0.62872},
+        {0.38622,0.734,0.62489},
+        {0.38865,0.734,0.62106},
+        {0.3911,0.73398,0.61722},
+        {0.39357,0.73396,0.61337},
+        {0.39609,0.73392,0.60953},
+        {0.39863,0.73388,0.60567},
+        {0.40121,0.73383,0.60181},
+        {0.40382,0.73377,0.59795},
+        {0.40646,0.7337,0.59409},
+        {0.40914,0.73361,0.59021},
+        {0.41186,0.73352,0.58635},
+        {0.41461,0.73342,0.58247},
+        {0.41741,0.7333,0.5786},
+        {0.42024,0.73318,0.57472},
+        {0.4231,0.73304,0.57084},
+        {0.42602,0.73289,0.56698},
+        {0.42898,0.73273,0.5631},
+        {0.43199,0.73255,0.55923},
+        {0.43504,0.73236,0.55536},
+        {0.43813,0.73216,0.5515},
+        {0.44125,0.73194,0.54764},
+        {0.44444,0.73171,0.54379},
+        {0.44765,0.73146,0.53995},
+        {0.45093,0.73119,0.53612},
+        {0.45426,0.73092,0.53231},
+        {0.45762,0.73062,0.5285},
+        {0.46104,0.73032,0.52471},
+        {0.46451,0.72999,0.52094},
+        {0.468,0.72965,0.51719},
+        {0.47157,0.72928,0.51346},
+        {0.47518,0.7289,0.50975},
+        {0.47882,0.7285,0.50606},
+        {0.48251,0.72809,0.50241},
+        {0.48625,0.72766,0.49879},
+        {0.49004,0.7272,0.4952},
+        {0.49386,0.72673,0.49165},
+        {0.49773,0.72625,0.48813},
+        {0.50164,0.72574,0.48464},
+        {0.50557,0.72521,0.48121},
+        {0.50955,0.72466,0.47782},
+        {0.51357,0.72409,0.47449},
+        {0.51761,0.72351,0.4712},
+        {0.52167,0.7229,0.46795},
+        {0.52578,0.72228,0.46477},
+        {0.5299,0.72164,0.46164},
+        {0.53404,0.72098,0.45857},
+        {0.53822,0.7203,0.45556},
+        {0.5424,0.71961,0.45262},
+        {0.5466,0.7189,0.44973},
+        {0.55081,0.71817,0.4469},
+        {0.55503,0.71743,0.44415},
+        {0.55926,0.71667,0.44145},
+        {0.5635,0.71589,0.43882},
+        {0.56773,0.71509,0.43627},
+        {0.57197,0.71428,0.43376},
+        {0.57622,0.71346,0.43134},
+        {0.58045,0.71262,0.42898},
+        {0.58468,0.71178,0.42669},
+        {0.5889,0.71092,0.42445},
+        {0.59311,0.71004,0.42224},
+        {0.5973,0.70917,0.42009},
+        {0.60146,0.70828,0.41796},
+        {0.60561,0.70738,0.41587},
+        {0.60975,0.70647,0.41382},
+        {0.61386,0.70556,0.4118},
+        {0.61796,0.70463,0.40983},
+        {0.62204,0.7037,0.40789},
+        {0.62612,0.70276,0.406},
+        {0.63017,0.70181,0.40413},
+        {0.63421,0.70085,0.4023},
+        {0.63822,0.69988,0.40055},
+        {0.64223,0.69891,0.3988},
+        {0.64621,0.69792,0.39711},
+        {0.65019,0.69693,0.39547},
+        {0.65415,0.69593,0.39385},
+        {0.65809,0.69492,0.39229},
+        {0.66202,0.6939,0.39078},
+        {0.66593,0.69288,0.3893},
+        {0.66983,0.69184,0.38787},
+        {0.67371,0.69079,0.38648},
+        {0.67758,0.68974,0.38515},
+        {0.68143,0.68868,0.38386},
+        {0.68527,0.6876,0.38261},
+        {0.6891,0.68652,0.38142},
+        {0.69291,0.68544,0.38026},
+        {0.6967,0.68433,0.37915},
+        {0.70047,0.68324,0.37809},
+        {0.70424,0.68212,0.37708},
+        {0.70798,0.681,0.37611},
+        {0.71172,0.67987,0.37518},
+        {0.71544,0.67874,0.37432},
+        {0.71914,0.6776,0.37349},
+        {0.72282,0.67644,0.37271},
+        {0.7265,0.67528,0.37197},
+        {0.73016,0.67411,0.37128},
+        {0.7338,0.67294,0.37065},
+        {0.73742,0.67175,0.37006},
+        {0.74103,0.67057,0.36951},
+        {0.74462,0.66937,0.36902},
+        {0.74821,0.66816,0.36856},
+        {0.75177,0.66694,0.36815},
+        {0.75531,0.66573,0.36778},
+        {0.75884,0.6645,0.36746},
+        {0.76236,0.66327,0.36719},
+        {0.76586,0.66203,0.36696},
+        {0.76934,0.66077,0.36678},
+        {0.77281,0.65952,0.36664},
+        {0.77626,0.65826,0.36654},
+        {0.7797,0.65699,0.36649},
+        {0.78312,0.65572,0.36647},
+        {0.78653,0.65443,0.3665},
+        {0.78991,0.65314,0.36657},
+        {0.79329,0.65185,0.36668},
+        {0.79664,0.65055,0.36682},
+        {0.79999,0.64925,0.36701},
+        {0.80331,0.64792,0.36723},
+        {0.80662,0.64661,0.3675},
+        {0.80991,0.64528,0.36781},
+        {0.81318,0.64395,0.36816},
+        {0.81645,0.64261,0.36854},
+        {0.81969,0.64126,0.36896},
+        {0.82293,0.63992,0.36941},
+        {0.82614,0.63856,0.36989},
+        {0.82935,0.6372,0.37041},
+        {0.83253,0.63583,0.37097},
+        {0.8357,0.63446,0.37156},
+        {0.83885,0.63308,0.37219},
+        {0.84199,0.63169,0.37285},
+        {0.84511,0.6303,0.37355},
+        {0.84822,0.6289,0.37427},
+        {0.85131,0.6275,0.37502},
+        {0.85439,0.62609,0.3758},
+        {0.85745,0.62468,0.37663},
+        {0.86051,0.62326,0.37746},
+        {0.86354,0.62183,0.37833},
+        {0.86656,0.62041,0.37923},
+        {0.86956,0.61897,0.38016},
+        {0.87256,0.61752,0.38112},
+        {0.87554,0.61607,0.38209},
+        {0.8785,0.61462,0.38312},
+        {0.88145,0.61316,0.38414},
+        {0.88438,0.6117,0.3852},
+        {0.8873,0.61023,0.38628},
+        {0.89021,0.60876,0.3874},
+        {0.8931,0.60728,0.38854},
+        {0.89598,0.60578,0.38969},
+        {0.89885,0.60429,0.39088},
+        {0.9017,0.60279,0.39208},
+        {0.90454,0.60128,0.3933},
+        {0.90737,0.59978,0.39455},
+        {0.91018,0.59826,0.39583},
+        {0.91298,0.59674,0.3971},
+        {0.91577,0.59521,0.39842},
+        {0.91854,0.59368,0.39974},
+        {0.92131,0.59215,0.40111},
+        {0.92406,0.59059,0.40246},
+        {0.92679,0.58904,0.40386},
+        {0.92952,0.58748,0.40527},
+        {0.93223,0.58593,0.40669},
+        {0.93493,0.58436,0.40813},
+        {0.93763,0.58278,0.4096},
+        {0.9403,0.5812,0.41108},
+        {0.94297,0.57962,0.41258},
+        {0.94562,0.57802,0.41408},
+        {0.94826,0.57644,0.41561},
+        {0.95089,0.57482,0.41716},
+        {0.95351,0.57322,0.41871},
+        {0.95612,0.57159,0.42029},
+        {0.95872,0.56997,0.42188},
+        {0.9613,0.56834,0.42348},
+        {0.96388,0.56671,0.42511},
+        {0.96644,0.56505,0.42674}
+    },
+    {
+        {0.078311,0.7275,0.90055},
+        {0.096546,0.72692,0.9011},
+        {0.11226,0.72635,0.90165},
+        {0.12614,0.72577,0.9022},
+        {0.13869,0.72519,0.90275},
+        {0.15028,0.72461,0.90329},
+        {0.16105,0.72402,0.90382},
+        {0.17113,0.72343,0.90436},
+        {0.18067,0.72284,0.90489},
+        {0.18976,0.72225,0.90541},
+        {0.19841,0.72165,0.90593},
+        {0.20674,0.72106,0.90644},
+        {0.2147,0.72046,0.90695},
+        {0.2224,0.71986,0.90745},
+        {0.22982,0.71926,0.90795},
+        {0.23706,0.71865,0.90845},
+        {0.24402,0.71804,0.90894},
+        {0.25084,0.71744,0.90942},
+        {0.25746,0.71682,0.9099},
+        {0.26394,0.71621,0.91038},
+        {0.27024,0.71559,0.91085},
+        {0.27641,0.71496,0.91131},
+        {0.28246,0.71434,0.91177},
+        {0.28836,0.71372,0.91222},
+        {0.29415,0.71309,0.91267},
+        {0.29986,0.71246,0.91312},
+        {0.30546,0.71183,0.91356},
+        {0.31096,0.71119,0.91399},
+        {0.31637,0.71055,0.91441},
+        {0.32169,0.70991,0.91483},
+        {0.32693,0.70927,0.91524},
+        {0.33212,0.70863,0.91565},
+        {0.33721,0.70797,0.91605},
+        {0.34224,0.70732,0.91645},
+        {0.34721,0.70668,0.91684},
+        {0.3521,0.70602,0.91723},
+        {0.35696,0.70536,0.91761},
+        {0.36174,0.70469,0.91797},
+        {0.36648,0.70403,0.91834},
+        {0.37114,0.70336,0.91869},
+        {0.37578,0.70269,0.91904},
+        {0.38037,0.70202,0.91938},
+        {0.3849,0.70134,0.91972},
+        {0.3894,0.70067,0.92005},
+        {0.39385,0.69998,0.92037},
+        {0.39827,0.6993,0.92068},
+        {0.40264,0.69861,0.92099},
+        {0.40698,0.69792,0.92129},
+        {0.41129,0.69723,0.92158},
+        {0.41555,0.69654,0.92187},
+        {0.41979,0.69584,0.92214},
+        {0.42399,0.69514,0.92241},
+        {0.42817,0.69443,0.92267},
+        {0.43232,0.69372,0.92292},
+        {0.43643,0.69302,0.92316},
+        {0.44051,0.69231,0.92339},
+        {0.44458,0.69158,0.92362},
+        {0.44861,0.69086,0.92383},
+        {0.45263,0.69014,0.92403},
+        {0.4566,0.68942,0.92423},
+        {0.46056,0.68869,0.92441},
+        {0.46452,0.68796,0.92459},
+        {0.46843,0.68722,0.92475},
+        {0.47233,0.68648,0.92491},
+        {0.47621,0.68574,0.92505},
+        {0.48007,0.685,0.92519},
+        {0.4839,0.68424,0.92531},
+        {0.48774,0.6835,0.92543},
+        {0.49155,0.68274,0.92553},
+        {0.49532,0.68198,0.92562},
+        {0.49909,0.68122,0.9257},
+        {0.50285,0.68045,0.92576},
+        {0.50659,0.67969,0.92582},
+        {0.51032,0.67892,0.92586},
+        {0.51404,0.67815,0.92589},
+        {0.51773,0.67737,0.9259},
+        {0.52141,0.67659,0.92591},
+        {0.52509,0.6758,0.92589},
+        {0.52875,0.67501,0.92587},
+        {0.5324,0.67422,0.92583},
+        {0.53603,0.67343,0.92578},
+        {0.53965,0.67264,0.92571},
+        {0.54327,0.67183,0.92562},
+        {0.54687,0.67103,0.92552},
+        {0.55046,0.67022,0.92541},
+        {0.55405,0.66941,0.92527},
+        {0.55762,0.66859,0.92513},
+        {0.56118,0.66778,0.92496},
+        {0.56474,0.66695,0.92478},
+        {0.56828,0.66613,0.92458},
+        {0.57183,0.6653,0.92436},
+        {0.57536,0.66447,0.92412},
+        {0.57888,0.66364,0.92387},
+        {0.58239,0.6628,0.92359},
+        {0.58591,0.66196,0.92329},
+        {0.5894,0.66111,0.92298},
+        {0.5929,0.66026,0.92264},
+        {0.59638,0.65941,0.92228},
+        {0.59986,0.65856,0.92189},
+        {0.60333,0.65771,0.92149},
+        {0.6068,0.65685,0.92106},
+        {0.61025,0.65599,0.9206},
+        {0.6137,0.65512,0.92013},
+        {0.61716,0.65425,0.91962},
+        {0.6206,0.65338,0.91909},
+        {0.62403,0.65251,0.91854},
+        {0.62745,0.65164,0.91796},
+        {0.63088,0.65076,0.91735},
+        {0.63429,0.64989,0.91671},
+        {0.63769,0.64901,0.91604},
+        {0.64108,0.64812,0.91534},
+        {0.64447,0.64724,0.91461},
+        {0.64785,0.64636,0.91385},
+        {0.65123,0.64547,0.91306},
+        {0.65459,0.64458,0.91223},
+        {0.65795,0.6437,0.91137},
+        {0.66129,0.64282,0.91048},
+        {0.66462,0.64193,0.90955},
+        {0.66796,0.64104,0.90858},
+        {0.67126,0.64017,0.90758},
+        {0.67456,0.63928,0.90654},
+        {0.67785,0.6384,0.90546},
+        {0.68111,0.63753,0.90434},
+        {0.68437,0.63666,0.90319},
+        {0.68761,0.63578,0.90199},
+        {0.69083,0.63491,0.90077},
+        {0.69404,0.63405,0.89953},
+        {0.69723,0.63317,0.89826},
+        {0.7004,0.63231,0.89698},
+        {0.70355,0.63144,0.89567},
+        {0.70668,0.63058,0.89435},
+        {0.70979,0.62971,0.89301},
+        {0.71288,0.62885,0.89165},
+        {0.71597,0.62799,0.89028},
+        {0.71902,0.62713,0.88889},
+        {0.72206,0.62627,0.88748},
+        {0.72509,0.62541,0.88607},
+        {0.72809,0.62455,0.88463},
+        {0.73108,0.6237,0.88318},
+        {0.73405,0.62284,0.88173},
+        {0.737,0.62198,0.88025},
+        {0.73994,0.62113,0.87877},
+        {0.74285,0.62028,0.87728},
+        {0.74575,0.61942,0.87577},
+        {0.74863,0.61857,0.87426},
+        {0.7515,0.61771,0.87273},
+        {0.75435,0.61686,0.8712},
+        {0.75718,0.61601,0.86965},
+        {0.75999,0.61515,0.8681},
+        {0.76279,0.6143,0.86653},
+        {0.76558,0.61345,0.86496},
+        {0.76834,0.6126,0.86339},
+        {0.7711,0.61175,0.8618},
+        {0.77383,0.6109,0.8602},
+        {0.77656,0.61005,0.8586},
+        {0.77926,0.6092,0.85699},
+        {0.78195,0.60835,0.85538},
+        {0.78463,0.6075,0.85375},
+        {0.78729,0.60665,0.85212},
+        {0.78993,0.60579,0.85048},
+        {0.79257,0.60495,0.84884},
+        {0.79518,0.6041,0.84719},
+        {0.79779,0.60325,0.84554},
+        {0.80038,0.6024,0.84387},
+        {0.80295,0.60155,0.84221},
+        {0.80551,0.6007,0.84054},
+        {0.80806,0.59985,0.83886},
+        {0.8106,0.599,0.83718},
+        {0.81312,0.59814,0.83549},
+        {0.81563,0.5973,0.83381},
+        {0.81812,0.59644,0.83211},
+        {0.82061,0.59559,0.83041},
+        {0.82308,0.59474,0.8287},
+        {0.82554,0.59389,0.82699},
+        {0.82798,0.59304,0.82528},
+        {0.83042,0.59219,0.82356},
+        {0.83284,0.59133,0.82184},
+        {0.83525,0.59047,0.82011},
+        {0.83765,0.58962,0.81838},
+        {0.84003,0.58876,0.81665},
+        {0.84241,0.58791,0.81491},
+        {0.84477,0.58705,0.81317},
+        {0.84712,0.5862,0.81143},
+        {0.84946,0.58535,0.80968},
+        {0.85179,0.58449,0.80793},
+        {0.8541,0.58363,0.80617},
+        {0.85641,0.58277,0.80442},
+        {0.85871,0.58191,0.80265},
+        {0.86099,0.58105,0.80089},
+        {0.86327,0.5802,0.79913},
+        {0.86553,0.57934,0.79735},
+        {0.86779,0.57847,0.79558},
+        {0.87002,0.57761,0.79381},
+        {0.87226,0.57675,0.79203},
+        {0.87448,0.57589,0.79025},
+        {0.87669,0.57502,0.78847},
+        {0.8789,0.57415,0.78668},
+        {0.88109,0.57329,0.78489},
+        {0.88328,0.57243,0.7831},
+        {0.88545,0.57155,0.78131},
+        {0.88761,0.57068,0.77951},
+        {0.88977,0.56981,0.77772},
+        {0.89192,0.56895,0.77591},
+        {0.89405,0.56808,0.77411},
+        {0.89618,0.56721,0.77231},
+        {0.8983,0.56634,0.7705},
+        {0.90041,0.56546,0.76869},
+        {0.90251,0.56459,0.76688},
+        {0.9046,0.56372,0.76507},
+        {0.90668,0.56284,0.76325},
+        {0.90876,0.56197,0.76143},
+        {0.91082,0.56108,0.75961},
+        {0.91288,0.56021,0.7578},
+        {0.91493,0.55932,0.75597},
+        {0.91697,0.55844,0.75415},
+        {0.91899,0.55756,0.75232},
+        {0.92102,0.55668,0.7505},
+        {0.92304,0.55579,0.74866},
+        {0.92504,0.55491,0.74683},
+        {0.92704,0.55402,0.745},
+        {0.92903,0.55313,0.74317},
+        {0.93102,0.55225,0.74133},
+        {0.93299,0.55136,0.7395},
+        {0.93496,0.55047,0.73765},
+        {0.93692,0.54957,0.73581},
+        {0.93887,0.54869,0.73397},
+        {0.94082,0.54779,0.73213},
+        {0.94276,0.54689,0.73028},
+        {0.94469,0.546,0.72843},
+        {0.94661,0.5451,0.72659},
+        {0.94852,0.54419,0.72474},
+        {0.95043,0.5433,0.72288},
+        {0.95233,0.54239,0.72103},
+        {0.95423,0.54148,0.71918},
+        {0.95611,0.54058,0.71733},
+        {0.95799,0.53967,0.71548},
+        {0.95986,0.53878,0.71361},
+        {0.96173,0.53787,0.71176},
+        {0.96359,0.53696,0.7099},
+        {0.96544,0.53604,0.70804},
+        {0.96729,0.53513,0.70618},
+        {0.96912,0.53421,0.70431},
+        {0.97096,0.53329,0.70245},
+        {0.97278,0.53238,0.70058},
+        {0.9746,0.53146,0.69871},
+        {0.97641,0.53054,0.69685},
+        {0.97822,0.52962,0.69498},
+        {0.98002,0.5287,0.69311},
+        {0.98181,0.52777,0.69124},
+        {0.9836,0.52685,0.68937},
+        {0.98538,0.52592,0.6875},
+        {0.98716,0.52499,0.68563},
+        {0.98892,0.52406,0.68375},
+        {0.99069,0.52313,0.68187},
+        {0.99244,0.52218,0.67999},
+        {0.99419,0.52125,0.67812}
+    },
+    {
+        {0.10261,0,0.52493},
+        {0.10283,0,0.53197},
+        {0.10301,0,0.53902},
+        {0.10318,0.0009426,0.54604},
+        {0.10333,0.0032938,0.55302},
+        {0.10346,0.0057773,0.56},
+        {0.10358,0.0084209,0.56694},
+        {0.10367,0.01129,0.57386},
+        {0.10377,0.014338,0.58073},
+        {0.10383,0.017402,0.5876},
+        {0.1039,0.020685,0.59441},
+        {0.10395,0.024094,0.60121},
+        {0.10399,0.027709,0.60797},
+        {0.10402,0.031481,0.61469},
+        {0.10405,0.035677,0.62137},
+        {0.10407,0.039812,0.62802},
+        {0.10409,0.043972,0.63463},
+        {0.1041,0.048145,0.64118},
+        {0.10411,0.052249,0.64771},
+        {0.10412,0.056438,0.65417},
+        {0.10412,0.060474,0.66061},
+        {0.10414,0.064518,0.66698},
+        {0.10414,0.068586,0.67332},
+        {0.10416,0.072559,0.67957},
+        {0.10417,0.076535,0.68581},
+        {0.1042,0.080591,0.69196},
+        {0.10423,0.084636,0.69806},
+        {0.10427,0.088643,0.7041},
+        {0.10432,0.092635,0.71007},
+        {0.10438,0.096648,0.71599},
+        {0.10445,0.10074,0.72181},
+        {0.10454,0.10477,0.72759},
+        {0.10466,0.1089,0.73327},
+        {0.10478,0.11303,0.73891},
+        {0.10495,0.11711,0.74441},
+        {0.10512,0.12123,0.74987},
+        {0.10534,0.12546,0.75522},
+        {0.10558,0.12966,0.76048},
+        {0.10584,0.13388,0.76566},
+        {0.10615,0.13816,0.77071},
+        {0.10646,0.14242,0.77569},
+        {0.10681,0.14674,0.78053},
+        {0.10717,0.15111,0.78527},
+        {0.10755,0.15551,0.7899},
+        {0.10798,0.15993,0.79438},
+        {0.10845,0.16445,0.79875},
+        {0.10901,0.16898,0.80298},
+        {0.10961,0.17353,0.80705},
+        {0.1102,0.17818,0.81099},
+        {0.11082,0.1828,0.81477},
+        {0.1115,0.18758,0.81836},
+        {0.11222,0.19233,0.82179},
+        {0.11298,0.19716,0.82505},
+        {0.11375,0.20204,0.82808},
+        {0.11454,0.20704,0.83091},
+        {0.11544,0.21207,0.83352},
+        {0.11636,0.21715,0.83593},
+        {0.11726,0.22231,0.83805},
+        {0.11827,0.22758,0.83989},
+        {0.11923,0.23291,0.84144},
+        {0.12022,0.23833,0.84271},
+        {0.12122,0.24384,0.84364},
+        {0.12223,0.24946,0.84423},
+        {0.12325,0.2552,0.84442},
+        {0.12427,0.26103,0.84418},
+        {0.12527,0.26698,0.84347},
+        {0.12622,0.2731,0.84224},
+        {0.12705,0.27937,0.84043},
+        {0.12787,0.28578,0.83797},
+        {0.12853,0.2924,0.83479},
+        {0.129,0.29923,0.8308},
+        {0.12928,0.30627,0.82589},
+        {0.12926,0.31358,0.81986},
+        {0.12882,0.3212,0.8125},
+        {0.12785,0.32922,0.80355},
+        {0.12621,0.33765,0.79274},
+        {0.1245,0.34613,0.78084},
+        {0.12367,0.35431,0.76889},
+        {0.12366,0.36214,0.75705},
+        {0.12444,0.36966,0.74532},
+        {0.12594,0.37693,0.7337},
+        {0.12792,0.38394,0.72217},
+        {0.13044,0.39074,0.71074},
+        {0.13327,0.39733,0.69939},
+        {0.13642,0.40376,0.68814},
+        {0.13984,0.41001,0.67697},
+        {0.14348,0.41611,0.66586},
+        {0.14722,0.42207,0.65483},
+        {0.15108,0.42792,0.64387},
+        {0.15499,0.43363,0.63298},
+        {0.15896,0.43925,0.62214},
+        {0.16291,0.44478,0.61137},
+        {0.16687,0.4502,0.60064},
+        {0.17081,0.45554,0.58996},
+        {0.17471,0.4608,0.57934},
+        {0.17858,0.46599,0.56874},
+        {0.18239,0.47111,0.55819},
+        {0.18617,0.47617,0.54768},
+        {0.18985,0.48116,0.53721},
+        {0.19353,0.4861,0.52675},
+        {0.19713,0.491,0.51631},
+        {0.20061,0.49582,0.50589},
+        {0.20411,0.50061,0.4955},
+        {0.20751,0.50535,0.48511},
+        {0.21087,0.51006,0.47474},
+        {0.21416,0.51473,0.46436},
+        {0.21738,0.51936,0.45396},
+        {0.22058,0.52395,0.44356},
+        {0.2237,0.52851,0.43315},
+        {0.22681,0.53303,0.42271},
+        {0.22982,0.53753,0.41226},
+        {0.23283,0.54198,0.40175},
+        {0.23581,0.54643,0.39121},
+        {0.23872,0.55083,0.38071},
+        {0.24169,0.55518,0.37044},
+        {0.24469,0.55949,0.3605},
+        {0.24781,0.56374,0.35089},
+        {0.25097,0.56793,0.34154},
+        {0.25425,0.57208,0.33247},
+        {0.25761,0.5762,0.32363},
+        {0.26111,0.58025,0.31505},
+        {0.26472,0.58427,0.3067},
+        {0.26848,0.58825,0.29856},
+        {0.27234,0.5922,0.29062},
+        {0.27639,0.5961,0.28291},
+        {0.28053,0.59996,0.27535},
+        {0.28484,0.6038,0.26796},
+        {0.28931,0.60759,0.26077},
+        {0.29388,0.61135,0.25373},
+        {0.29862,0.61508,0.24682},
+        {0.3035,0.61878,0.24008},
+        {0.30855,0.62243,0.23349},
+        {0.31372,0.62607,0.22707},
+        {0.31901,0.62967,0.22077},
+        {0.32444,0.63324,0.21455},
+        {0.33002,0.63679,0.20847},
+        {0.3357,0.6403,0.20249},
+        {0.3415,0.64378,0.19666},
+        {0.34744,0.64724,0.1909},
+        {0.35349,0.65066,0.18533},
+        {0.35968,0.65406,0.17981},
+        {0.36597,0.65744,0.17443},
+        {0.37234,0.66078,0.16914},
+        {0.37883,0.6641,0.16394},
+        {0.38543,0.6674,0.15885},
+        {0.39215,0.67066,0.15389},
+        {0.39895,0.6739,0.14907},
+        {0.40585,0.67712,0.14434},
+        {0.41283,0.6803,0.13966},
+        {0.41989,0.68346,0.13522},
+        {0.42707,0.6866,0.1309},
+        {0.43431,0.68971,0.12666},
+        {0.44163,0.6928,0.12254},
+        {0.44902,0.69586,0.11865},
+        {0.45651,0.69888,0.11488},
+        {0.46408,0.70188,0.11136},
+        {0.4717,0.70487,0.1079},
+        {0.47938,0.70783,0.10464},
+        {0.48716,0.71076,0.10172},
+        {0.495,0.71367,0.098964},
+        {0.50288,0.71655,0.096355},
+        {0.51084,0.71941,0.094134},
+        {0.51888,0.72223,0.092156},
+        {0.52696,0.72504,0.090393},
+        {0.53508,0.72782,0.088892},
+        {0.54329,0.73057,0.087819},
+        {0.55155,0.73329,0.087005},
+        {0.55985,0.73599,0.086399},
+        {0.56821,0.73867,0.08621},
+        {0.57664,0.74131,0.086387},
+        {0.5851,0.74394,0.086866},
+        {0.59361,0.74654,0.087651},
+        {0.60218,0.74911,0.088758},
+        {0.61075,0.75167,0.090091},
+        {0.6193,0.75421,0.091662},
+        {0.62776,0.75676,0.093291},
+        {0.63618,0.7593,0.095179},
+        {0.64452,0.76186,0.097055},
+        {0.65279,0.76442,0.0992},
+        {0.66101,0.76698,0.10144},
+        {0.66917,0.76954,0.10382},
+        {0.67726,0.77211,0.10635},
+        {0.68528,0.77468,0.10898},
+        {0.69324,0.77727,0.11176},
+        {0.70115,0.77985,0.1146},
+        {0.70899,0.78245,0.11768},
+        {0.71675,0.78505,0.12084},
+        {0.72446,0.78766,0.12415},
+        {0.73211,0.79027,0.12759},
+        {0.73969,0.7929,0.13116},
+        {0.74719,0.79554,0.13488},
+        {0.75463,0.79819,0.13869},
+        {0.762,0.80085,0.14265},
+        {0.76931,0.80352,0.1467},
+        {0.77655,0.80621,0.15091},
+        {0.78371,0.80891,0.15527},
+        {0.79078,0.81163,0.15974},
+        {0.79778,0.81436,0.1644},
+        {0.80471,0.81711,0.16917},
+        {0.81155,0.81987,0.17404},
+        {0.8183,0.82266,0.17908},
+        {0.82496,0.82547,0.18425},
+        {0.83154,0.8283,0.18958},
+        {0.83802,0.83116,0.19506},
+        {0.84439,0.83404,0.20068},
+        {0.85066,0.83694,0.20653},
+        {0.85681,0.83988,0.21248},
+        {0.86285,0.84285,0.21864},
+        {0.86877,0.84585,0.22495},
+        {0.87454,0.84889,0.23152},
+        {0.88018,0.85196,0.23823},
+        {0.88567,0.85508,0.24516},
+        {0.89101,0.85823,0.25235},
+        {0.89617,0.86144,0.25975},
+        {0.90116,0.86469,0.26737},
+        {0.90596,0.868,0.27529},
+        {0.91052,0.87137,0.2835},
+        {0.91485,0.87481,0.29203},
+        {0.91894,0.87831,0.30086},
+        {0.92276,0.88189,0.31007},
+        {0.92625,0.88556,0.3197},
+        {0.92941,0.88931,0.32973},
+        {0.93217,0.89317,0.34027},
+        {0.93451,0.89714,0.3513},
+        {0.93634,0.90125,0.36298},
+        {0.93763,0.9055,0.37534},
+        {0.9387,0.90978,0.38837},
+        {0.93989,0.91399,0.40197},
+        {0.94123,0.91811,0.41613},
+        {0.94272,0.92216,0.43083},
+        {0.94436,0.92612,0.44608},
+        {0.94613,0.93,0.46186},
+        {0.94803,0.9338,0.47813},
+        {0.95005,0.93753,0.49497},
+        {0.95218,0.94117,0.5123},
+        {0.95441,0.94474,0.53014},
+        {0.95674,0.94822,0.54852},
+        {0.95915,0.95163,0.56741},
+        {0.96162,0.95496,0.58679},
+        {0.96415,0.95822,0.60671},
+        {0.96673,0.96139,0.62717},
+        {0.96934,0.96449,0.64813},
+        {0.97196,0.96752,0.66962},
+        {0.97459,0.97046,0.69168},
+        {0.97722,0.97333,0.71425},
+        {0.9798,0.97613,0.73736},
+        {0.98235,0.97885,0.76105},
+        {0.98483,0.98151,0.78529},
+        {0.98722,0.98408,0.81007},
+        {0.98952,0.98658,0.83544},
+        {0.99169,0.98901,0.8614},
+        {0.99371,0.99136,0.88792},
+        {0.99556,0.99365,0.91503},
+        {0.99723,0.99585,0.94278},
+        {0.99867,0.99799,0.97109},
+        {0.99986,1,1}
+    },
+    {
+        {0,0.047803,0.4883},
+        {0,0.049756,0.49556},
+        {0,0.051605,0.50281},
+        {0,0.053545,0.51004},
+        {0,0.055585,0.51721},
+        {0,0.057566,0.52435},
+        {0,0.05978,0.53144},
+        {0,0.061812,0.53849},
+        {0,0.064016,0.5455},
+        {0,0.066232,0.55245},
+        {0,0.068551,0.55934},
+        {0,0.070824,0.5662},
+        {0,0.073229,0.57299},
+        {0,0.07557,0.57971},
+        {0,0.078003,0.58638},
+        {0,0.080554,0.59299},
+        {0,0.083114,0.59951},
+        {0,0.085697,0.60596},
+        {0,0.08842,0.61236},
+        {0,0.091168,0.61866},
+        {0,0.093925,0.62487},
+        {0,0.096707,0.63101},
+        {0,0.09963,0.63705},
+        {0,0.1026,0.64298},
+        {0,0.10561,0.64881},
+        {0,0.10866,0.65454},
+        {0,0.11183,0.66016},
+        {0,0.11497,0.66567},
+        {0,0.11829,0.67103},
+        {0,0.12156,0.67626},
+        {0,0.12498,0.68134},
+        {0,0.12846,0.68629},
+        {0,0.13201,0.69107},
+        {0,0.13559,0.6957},
+        {0,0.13927,0.70014},
+        {0,0.14307,0.70439},
+        {0,0.1469,0.70845},
+        {0,0.15085,0.71227},
+        {0,0.15487,0.71588},
+        {0,0.159,0.71923},
+        {0,0.16323,0.7223},
+        {0,0.16754,0.7251},
+        {0,0.17195,0.72757},
+        {0,0.17647,0.72972},
+        {0,0.18113,0.73149},
+        {0,0.18594,0.73289},
+        {0,0.19074,0.73398},
+        {0,0.19556,0.73486},
+        {0,0.20033,0.73556},
+        {0,0.20512,0.73608},
+        {0,0.20987,0.73643},
+        {0,0.21461,0.73659},
+        {0,0.21934,0.73657},
+        {0,0.22402,0.73637},
+        {0,0.22875,0.73599},
+        {0,0.2334,0.73544},
+        {0,0.23809,0.73469},
+        {0,0.24275,0.73376},
+        {0,0.24743,0.73266},
+        {0,0.25208,0.73137},
+        {0,0.25673,0.72991},
+        {0,0.26137,0.72825},
+        {0,0.26603,0.72642},
+        {0,0.27068,0.72441},
+        {0,0.27531,0.72221},
+        {0,0.27995,0.71983},
+        {0,0.28458,0.71727},
+        {0,0.28924,0.71452},
+        {0,0.29387,0.71161},
+        {0,0.29852,0.70851},
+        {0,0.30317,0.70521},
+        {0,0.30782,0.70174},
+        {0,0.31248,0.69809},
+        {0,0.31716,0.69426},
+        {0,0.32182,0.69025},
+        {0,0.32649,0.68607},
+        {0,0.33116,0.68178},
+        {0,0.33582,0.67746},
+        {0,0.34046,0.6731},
+        {0,0.34509,0.66871},
+        {0,0.3497,0.66429},
+        {0,0.3543,0.65984},
+        {0,0.35888,0.65536},
+        {0,0.36346,0.65085},
+        {0,0.36803,0.6463},
+        {0,0.37258,0.64173},
+        {0,0.37713,0.63713},
+        {0,0.38167,0.6325},
+        {0,0.38618,0.62783},
+        {0,0.39071,0.62313},
+        {0,0.39523,0.6184},
+        {0,0.39972,0.61363},
+        {0,0.40423,0.60885},
+        {0,0.40872,0.60402},
+        {0,0.41321,0.59915},
+        {0,0.41769,0.59426},
+        {0,0.42215,0.58932},
+        {0,0.42663,0.58437},
+        {0,0.4311,0.57937},
+        {0,0.43556,0.57433},
+        {0,0.44001,0.56926},
+        {0,0.44446,0.56416},
+        {0,0.44891,0.55902},
+        {0,0.45334,0.55384},
+        {0,0.45778,0.54863},
+        {0,0.46222,0.54336},
+        {0,0.46665,0.53802},
+        {0,0.47105,0.53253},
+        {0,0.47545,0.52691},
+        {0,0.47982,0.52115},
+        {0,0.48417,0.51525},
+        {0,0.48852,0.50921},
+        {0,0.49284,0.50301},
+        {0,0.49717,0.49668},
+        {0,0.50147,0.49022},
+        {0,0.50575,0.48359},
+        {0,0.51003,0.47682},
+        {0,0.51431,0.4699},
+        {0,0.51856,0.4628},
+        {0.0097866,0.52281,0.45558},
+        {0.023896,0.52704,0.44818},
+        {0.038383,0.53126,0.44061},
+        {0.051763,0.53547,0.43289},
+        {0.063442,0.53968,0.42499},
+        {0.073828,0.54388,0.41692},
+        {0.083244,0.54807,0.40866},
+        {0.092062,0.55225,0.40022},
+        {0.10019,0.55642,0.39159},
+        {0.10786,0.56059,0.38276},
+        {0.11513,0.56474,0.37372},
+        {0.12206,0.56889,0.36445},
+        {0.12871,0.57304,0.35498},
+        {0.13507,0.57718,0.34524},
+        {0.14115,0.58131,0.33527},
+        {0.14697,0.58544,0.32499},
+        {0.15257,0.58954,0.31449},
+        {0.15773,0.59367,0.30393},
+        {0.16231,0.59779,0.29352},
+        {0.16631,0.60191,0.28332},
+        {0.16984,0.60603,0.27332},
+        {0.17292,0.61015,0.26352},
+        {0.17565,0.61427,0.25387},
+        {0.17811,0.6184,0.24439},
+        {0.18021,0.62252,0.23514},
+        {0.18207,0.62664,0.22606},
+        {0.18374,0.63076,0.21715},
+        {0.18522,0.63487,0.2084},
+        {0.18649,0.63898,0.19982},
+        {0.18765,0.64309,0.19148},
+        {0.18863,0.6472,0.18334},
+        {0.18951,0.6513,0.1754},
+        {0.19029,0.65539,0.16767},
+        {0.19099,0.65948,0.16013},
+        {0.19162,0.66357,0.15293},
+        {0.19219,0.66765,0.14604},
+        {0.19272,0.67172,0.13937},
+        {0.1932,0.67579,0.13311},
+        {0.19366,0.67985,0.1272},
+        {0.1941,0.68391,0.1218},
+        {0.19451,0.68797,0.11692},
+        {0.1949,0.69202,0.11259},
+        {0.19529,0.69606,0.10881},
+        {0.19569,0.70009,0.10581},
+        {0.19611,0.70412,0.10358},
+        {0.19653,0.70814,0.10209},
+        {0.19694,0.71215,0.10139},
+        {0.19736,0.71617,0.10116},
+        {0.19779,0.72018,0.10101},
+        {0.19823,0.7242,0.10087},
+        {0.19868,0.72822,0.10073},
+        {0.19914,0.73225,0.1006},
+        {0.19961,0.73627,0.10048},
+        {0.20009,0.74031,0.10036},
+        {0.20058,0.74434,0.10025},
+        {0.20108,0.74838,0.10015},
+        {0.20159,0.75242,0.10006},
+        {0.20211,0.75647,0.099977},
+        {0.20265,0.76052,0.099902},
+        {0.2032,0.76457,0.099835},
+        {0.20376,0.76862,0.099777},
+        {0.20433,0.77267,0.099729},
+        {0.20488,0.77674,0.099691},
+        {0.20546,0.7808,0.099663},
+        {0.20608,0.78487,0.099645},
+        {0.20669,0.78894,0.099637},
+        {0.20729,0.79301,0.099641},
+        {0.20791,0.79708,0.099656},
+        {0.20855,0.80116,0.099683},
+        {0.2092,0.80523,0.09972},
+        {0.20987,0.80932,0.09977},
+        {0.21055,0.8134,0.099833},
+        {0.21125,0.81749,0.099908},
+        {0.21196,0.82159,0.099996},
+        {0.21266,0.82567,0.1001},
+        {0.2134,0.82977,0.10021},
+        {0.21454,0.83386,0.10034},
+        {0.21746,0.83784,0.10049},
+        {0.22334,0.84166,0.10065},
+        {0.23182,0.84531,0.10083},
+        {0.24228,0.84884,0.10102},
+        {0.25428,0.85224,0.10123},
+        {0.26735,0.85553,0.10145},
+        {0.28125,0.85872,0.10168},
+        {0.29571,0.86184,0.10193},
+        {0.31067,0.86485,0.10219},
+        {0.32594,0.86779,0.10246},
+        {0.34137,0.87065,0.10275},
+        {0.35684,0.87346,0.10306},
+        {0.3724,0.87619,0.10337},
+        {0.38805,0.87886,0.10369},
+        {0.40366,0.88147,0.10401},
+        {0.41921,0.88402,0.10433},
+        {0.43478,0.88651,0.10468},
+        {0.45028,0.88894,0.10507},
+        {0.4657,0.89133,0.10549},
+        {0.48111,0.89365,0.10592},
+        {0.49641,0.89593,0.10637},
+        {0.51169,0.89815,0.10681},
+        {0.52691,0.90032,0.10725},
+        {0.54202,0.90245,0.1077},
+        {0.55713,0.90452,0.10817},
+        {0.57212,0.90655,0.10869},
+        {0.5871,0.90852,0.10927},
+        {0.60201,0.91045,0.10983},
+        {0.61689,0.91232,0.11037},
+        {0.63169,0.91415,0.11095},
+        {0.64646,0.91593,0.11155},
+        {0.66118,0.91767,0.11216},
+        {0.67585,0.91934,0.11281},
+        {0.69049,0.92098,0.11347},
+        {0.70508,0.92257,0.11409},
+        {0.71966,0.92411,0.11477},
+        {0.73418,0.9256,0.11552},
+        {0.74868,0.92704,0.11627},
+        {0.76314,0.92844,0.11699},
+        {0.77759,0.92979,0.11777},
+        {0.79201,0.93109,0.11859},
+        {0.8064,0.93233,0.11937},
+        {0.82077,0.93353,0.12019},
+        {0.83511,0.93468,0.12102},
+        {0.84946,0.93578,0.12189},
+        {0.86375,0.93684,0.12278},
+        {0.87808,0.93783,0.1237},
+        {0.89234,0.93878,0.12464},
+        {0.90664,0.93968,0.12562},
+        {0.92088,0.94052,0.12657},
+        {0.93514,0.94131,0.12755},
+        {0.94939,0.94206,0.12857},
+        {0.9636,0.94275,0.12961},
+        {0.97785,0.94338,0.13068},
+        {0.99205,0.94397,0.13172},
+        {1,0.94449,0.13281},
+        {1,0.94497,0.13392},
+        {1,0.94539,0.13505},
+        {1,0.94574,0.13614},
+        {1,0.94606,0.13735}
+    },
+    {
+        {0,0.0024382,0.30687},
+        {0,0.0044692,0.31437},
+        {0,0.0062324,0.32191},
+        {0,0.0077305,0.32951},
+        {0,0.008958,0.33713},
+        {0,0.0098968,0.34479},
+        {0,0.010555,0.35249},
+        {0,0.011009,0.36023},
+        {0,0.01114,0.36802},
+        {0.0018829,0.010944,0.37585},
+        {0.0043414,0.010697,0.38371},
+        {0.0068536,0.010463,0.39161},
+        {0.0094655,0.010231,0.39952},
+        {0.01235,0.0099983,0.4075},
+        {0.015052,0.0097591,0.4155},
+        {0.017851,0.0094983,0.42354},
+        {0.020695,0.0092222,0.43163},
+        {0.02357,0.0089375,0.43973},
+        {0.026496,0.0086445,0.44787},
+        {0.029448,0.0083501,0.45605},
+        {0.032396,0.0080591,0.46429},
+        {0.03558,0.0077658,0.47253},
+        {0.038524,0.0074701,0.48082},
+        {0.041458,0.0071848,0.48915},
+        {0.044141,0.0069073,0.49753},
+        {0.04679,0.0066377,0.50593},
+        {0.04932,0.0063792,0.51438},
+        {0.051527,0.0061442,0.52287},
+        {0.053656,0.0059329,0.53139},
+        {0.055683,0.0057462,0.53995},
+        {0.057455,0.0055887,0.54857},
+        {0.059195,0.0054661,0.55722},
+        {0.060593,0.0053876,0.5659},
+        {0.061766,0.0053629,0.57464},
+        {0.062841,0.0053961,0.58343},
+        {0.063532,0.0054935,0.59227},
+        {0.063966,0.0056647,0.60114},
+        {0.0641,0.0059201,0.61007},
+        {0.063882,0.0062716,0.61907},
+        {0.063281,0.0067326,0.6281},
+        {0.062148,0.0073175,0.63719},
+        {0.060493,0.0080408,0.64634},
+        {0.058092,0.008929,0.65557},
+        {0.055233,0.0099623,0.66482},
+        {0.052105,0.011266,0.67402},
+        {0.049146,0.012683,0.68314},
+        {0.046014,0.014144,0.69216},
+        {0.04309,0.015741,0.70108},
+        {0.040435,0.017485,0.70992},
+        {0.037863,0.019379,0.71866},
+        {0.035616,0.021429,0.72731},
+        {0.033428,0.02364,0.73587},
+        {0.031841,0.026021,0.74433},
+        {0.030635,0.028579,0.75268},
+        {0.029823,0.031319,0.76095},
+        {0.029422,0.034249,0.7691},
+        {0.029449,0.037557,0.77717},
+        {0.029926,0.040864,0.78513},
+        {0.030874,0.044198,0.793},
+        {0.032312,0.047578,0.80076},
+        {0.034281,0.051036,0.80842},
+        {0.036977,0.054512,0.81597},
+        {0.040055,0.058003,0.82341},
+        {0.043483,0.061561,0.83076},
+        {0.047434,0.065191,0.83799},
+        {0.051627,0.068868,0.84513},
+        {0.056188,0.072421,0.85216},
+        {0.060871,0.076069,0.85907},
+        {0.065858,0.079772,0.86589},
+        {0.071059,0.083524,0.87259},
+        {0.07632,0.087319,0.87918},
+        {0.081824,0.091117,0.88564},
+        {0.087161,0.095093,0.89195},
+        {0.092292,0.099225,0.89805},
+        {0.097256,0.10365,0.90395},
+        {0.10208,0.10819,0.90965},
+        {0.10678,0.11304,0.91514},
+        {0.11126,0.11798,0.92041},
+        {0.11561,0.12306,0.92547},
+        {0.11981,0.12837,0.93032},
+        {0.12389,0.13378,0.93496},
+        {0.12789,0.13928,0.9394},
+        {0.13172,0.14498,0.94362},
+        {0.13541,0.15071,0.94764},
+        {0.13898,0.15659,0.95143},
+        {0.14245,0.16255,0.95501},
+        {0.14579,0.16859,0.95837},
+        {0.14895,0.17474,0.96151},
+        {0.15202,0.18091,0.96444},
+        {0.15497,0.18721,0.96717},
+        {0.15778,0.19355,0.96967},
+        {0.16044,0.19992,0.97196},
+        {0.16301,0.20643,0.97403},
+        {0.16537,0.21292,0.97587},
+        {0.16765,0.21951,0.9775},
+        {0.16978,0.22614,0.9789},
+        {0.17171,0.23278,0.9801},
+        {0.17352,0.2395,0.98107},
+        {0.17518,0.24623,0.98183},
+        {0.17664,0.25301,0.98238},
+        {0.17803,0.25977,0.98279},
+        {0.17924,0.26645,0.98317},
+        {0.18037,0.27304,0.98356},
+        {0.18141,0.27957,0.98394},
+        {0.18236,0.28598,0.98432},
+        {0.18323,0.29237,0.98469},
+        {0.18401,0.29868,0.98507},
+        {0.1847,0.30493,0.98544},
+        {0.1853,0.31112,0.9858},
+        {0.1858,0.31725,0.98617},
+        {0.18619,0.32334,0.98654},
+        {0.18649,0.32939,0.9869},
+        {0.18671,0.33539,0.98726},
+        {0.18684,0.34133,0.98762},
+        {0.18688,0.34725,0.98797},
+        {0.18682,0.35312,0.98832},
+        {0.18667,0.35896,0.98868},
+        {0.18643,0.36477,0.98903},
+        {0.1861,0.37054,0.98937},
+        {0.18568,0.37631,0.98972},
+        {0.18513,0.38201,0.99006},
+        {0.18448,0.38771,0.9904},
+        {0.18373,0.39338,0.99074},
+        {0.18287,0.39902,0.99107},
+        {0.18192,0.40464,0.9914},
+        {0.18086,0.41025,0.99173},
+        {0.17969,0.41582,0.99206},
+        {0.17843,0.42137,0.99239},
+        {0.17708,0.42691,0.99271},
+        {0.17576,0.43242,0.99301},
+        {0.17462,0.43788,0.9933},
+        {0.17355,0.44331,0.99356},
+        {0.17263,0.44871,0.99381},
+        {0.17185,0.45406,0.99403},
+        {0.17122,0.4594,0.99423},
+        {0.17072,0.4647,0.99442},
+        {0.17037,0.46998,0.99459},
+        {0.17015,0.47522,0.99473},
+        {0.17008,0.48043,0.99486},
+        {0.17016,0.48562,0.99497},
+        {0.17038,0.4908,0.99505},
+        {0.17077,0.49593,0.99512},
+        {0.17131,0.50106,0.99517},
+        {0.17201,0.50615,0.99519},
+        {0.17286,0.51122,0.9952},
+        {0.17386,0.51627,0.99519},
+        {0.17503,0.52131,0.99516},
+        {0.17629,0.52633,0.9951},
+        {0.17778,0.53132,0.99503},
+        {0.17936,0.5363,0.99494},
+        {0.1811,0.54125,0.99482},
+        {0.18299,0.5462,0.99469},
+        {0.18504,0.55111,0.99454},
+        {0.1872,0.55601,0.99436},
+        {0.18948,0.5609,0.99417},
+        {0.19189,0.56577,0.99396},
+        {0.19443,0.57063,0.99373},
+        {0.19686,0.5755,0.99349},
+        {0.19906,0.58036,0.99326},
+        {0.2011,0.58524,0.99303},
+        {0.20297,0.59011,0.99281},
+        {0.20464,0.59499,0.9926},
+        {0.20612,0.59989,0.99239},
+        {0.2074,0.60479,0.99218},
+        {0.2085,0.60969,0.99198},
+        {0.20942,0.6146,0.99179},
+        {0.21016,0.61953,0.9916},
+        {0.21072,0.62445,0.99142},
+        {0.21111,0.62938,0.99124},
+        {0.21132,0.63432,0.99107},
+        {0.21135,0.63926,0.9909},
+        {0.2112,0.64421,0.99074},
+        {0.21086,0.64918,0.99058},
+        {0.21033,0.65414,0.99043},
+        {0.20961,0.65911,0.99029},
+        {0.2087,0.66409,0.99015},
+        {0.2076,0.66908,0.99002},
+        {0.20631,0.67406,0.98989},
+        {0.20478,0.67906,0.98977},
+        {0.20305,0.68406,0.98965},
+        {0.20108,0.68908,0.98954},
+        {0.1989,0.69409,0.98943},
+        {0.19651,0.69911,0.98933},
+        {0.19382,0.70414,0.98924},
+        {0.19088,0.70918,0.98914},
+        {0.18788,0.71421,0.98905},
+        {0.18488,0.71923,0.98895},
+        {0.18198,0.72423,0.98883},
+        {0.17926,0.72923,0.98871},
+        {0.17665,0.73421,0.98857},
+        {0.17423,0.73918,0.98842},
+        {0.17193,0.74412,0.98825},
+        {0.16983,0.74906,0.98808},
+        {0.16785,0.75399,0.98789},
+        {0.16608,0.7589,0.9877},
+        {0.16452,0.76381,0.98749},
+        {0.16316,0.76869,0.98727},
+        {0.16202,0.77357,0.98703},
+        {0.1611,0.77844,0.98679},
+        {0.16037,0.7833,0.98653},
+        {0.15991,0.78814,0.98626},
+        {0.1597,0.79298,0.98597},
+        {0.15972,0.7978,0.98568},
+        {0.15999,0.80261,0.98537},
+        {0.16053,0.80742,0.98505},
+        {0.16137,0.81221,0.98472},
+        {0.16241,0.81699,0.98438},
+        {0.16373,0.82176,0.98402},
+        {0.16523,0.82652,0.98365},
+        {0.16707,0.83127,0.98327},
+        {0.1691,0.83601,0.98287},
+        {0.17134,0.84074,0.98247},
+        {0.17387,0.84546,0.98205},
+        {0.17729,0.85015,0.98162},
+        {0.18258,0.85474,0.98119},
+        {0.19003,0.85923,0.98076},
+        {0.19916,0.86363,0.98033},
+        {0.20965,0.86794,0.97991},
+        {0.22117,0.87217,0.97948},
+        {0.23338,0.87632,0.97905},
+        {0.24622,0.88041,0.97862},
+        {0.25953,0.88443,0.9782},
+        {0.27309,0.8884,0.97777},
+        {0.28681,0.89231,0.97734},
+        {0.30063,0.89617,0.97691},
+        {0.31448,0.89998,0.97648},
+        {0.32832,0.90375,0.97605},
+        {0.34224,0.90747,0.97562},
+        {0.35613,0.91115,0.97518},
+        {0.36991,0.91479,0.97475},
+        {0.38361,0.9184,0.97431},
+        {0.39728,0.92197,0.97387},
+        {0.4109,0.9255,0.97343},
+        {0.42439,0.92899,0.973},
+        {0.43779,0.93247,0.97255},
+        {0.45116,0.9359,0.97211},
+        {0.46443,0.93931,0.97166},
+        {0.47755,0.94269,0.97121},
+        {0.49069,0.94603,0.97076},
+        {0.5037,0.94935,0.97031},
+        {0.51659,0.95265,0.96986},
+        {0.52949,0.95592,0.9694},
+        {0.54227,0.95916,0.96894},
+        {0.55496,0.96238,0.96849},
+        {0.56763,0.96557,0.96803},
+        {0.58018,0.96874,0.96756},
+        {0.59271,0.97189,0.9671},
+        {0.60515,0.97501,0.96663},
+        {0.61751,0.97812,0.96616},
+        {0.62987,0.98119,0.96569},
+        {0.64213,0.98425,0.96521},
+        {0.65436,0.98729,0.96474},
+        {0.66654,0.9903,0.96426},
+        {0.67864,0.9933,0.96378},
+        {0.69072,0.99626,0.9633},
+        {0.70271,0.99922,0.96282}
+    },
+    {
+        {0.94334,0.94353,0.94348},
+        {0.94036,0.94166,0.94325},
+        {0.93738,0.9398,0.94302},
+        {0.93439,0.93793,0.94278},
+        {0.93141,0.93607,0.94255},
+        {0.92843,0.9342,0.94231},
+        {0.92545,0.93234,0.94206},
+        {0.92247,0.93048,0.94182},
+        {0.91948,0.92862,0.94157},
+        {0.9165,0.92676,0.94131},
+        {0.91352,0.9249,0.94106},
+        {0.91054,0.92304,0.9408},
+        {0.90755,0.92118,0.94054},
+        {0.90456,0.91932,0.94028},
+        {0.90157,0.91747,0.94001},
+        {0.89858,0.91561,0.93974},
+        {0.8956,0.91376,0.93947},
+        {0.89261,0.9119,0.93919},
+        {0.88962,0.91005,0.93891},
+        {0.88663,0.9082,0.93863},
+        {0.88364,0.90635,0.93834},
+        {0.88065,0.90449,0.93805},
+        {0.87766,0.90264,0.93776},
+        {0.87466,0.90079,0.93746},
+        {0.87167,0.89894,0.93716},
+        {0.86868,0.8971,0.93686},
+        {0.86569,0.89525,0.93655},
+        {0.8627,0.89339,0.93624},
+        {0.8597,0.89155,0.93593},
+        {0.8567,0.8897,0.93561},
+        {0.8537,0.88785,0.93528},
+        {0.85071,0.88601,0.93496},
+        {0.84771,0.88417,0.93463},
+        {0.84472,0.88232,0.9343},
+        {0.84172,0.88048,0.93396},
+        {0.83872,0.87864,0.93362},
+        {0.83572,0.87679,0.93327},
+        {0.83272,0.87495,0.93292},
+        {0.82973,0.87311,0.93257},
+        {0.82673,0.87127,0.93222},
+        {0.82373,0.86943,0.93186},
+        {0.82073,0.86759,0.93149},
+        {0.81773,0.86575,0.93112},
+        {0.81473,0.86392,0.93075},
+        {0.81173,0.86208,0.93037},
+        {0.80873,0.86025,0.92999},
+        {0.80573,0.85841,0.9296},
+        {0.80273,0.85657,0.92921},
+        {0.79973,0.85474,0.92881},
+        {0.79673,0.85291,0.92841},
+        {0.79374,0.85107,0.928},
+        {0.79073,0.84924,0.92759},
+        {0.78773,0.8474,0.92717},
+        {0.78474,0.84557,0.92675},
+        {0.78174,0.84374,0.92633},
+        {0.77873,0.84191,0.9259},
+        {0.77573,0.84009,0.92546},
+        {0.77274,0.83825,0.92502},
+        {0.76974,0.83642,0.92457},
+        {0.76674,0.8346,0.92412},
+        {0.76375,0.83277,0.92366},
+        {0.76075,0.83094,0.92319},
+        {0.75776,0.82912,0.92272},
+        {0.75477,0.82729,0.92224},
+        {0.75178,0.82546,0.92176},
+        {0.74878,0.82363,0.92127},
+        {0.74579,0.82181,0.92077},
+        {0.7428,0.81998,0.92027},
+        {0.73982,0.81816,0.91976},
+        {0.73683,0.81634,0.91924},
+        {0.73384,0.81451,0.91871},
+        {0.73086,0.81269,0.91818},
+        {0.72788,0.81087,0.91765},
+        {0.72491,0.80905,0.9171},
+        {0.72192,0.80723,0.91654},
+        {0.71895,0.8054,0.91598},
+        {0.71599,0.80358,0.91541},
+        {0.71301,0.80176,0.91483},
+        {0.71005,0.79995,0.91424},
+        {0.70709,0.79812,0.91365},
+        {0.70413,0.7963,0.91304},
+        {0.70117,0.79449,0.91242},
+        {0.69822,0.79266,0.91179},
+        {0.69528,0.79084,0.91116},
+        {0.69234,0.78903,0.91051},
+        {0.6894,0.78721,0.90986},
+        {0.68646,0.78539,0.90919},
+        {0.68354,0.78357,0.90851},
+        {0.68061,0.78175,0.90782},
+        {0.67771,0.77993,0.90711},
+        {0.6748,0.77812,0.9064},
+        {0.6719,0.7763,0.90567},
+        {0.66901,0.77447,0.90492},
+        {0.66612,0.77266,0.90416},
+        {0.66325,0.77084,0.90339},
+        {0.66038,0.76902,0.9026},
+        {0.65753,0.7672,0.90179},
+        {0.65467,0.76538,0.90097},
+        {0.65185,0.76356,0.90013},
+        {0.64903,0.76174,0.89928},
+        {0.64622,0.75992,0.89839},
+        {0.64342,0.7581,0.8975},
+        {0.64065,0.75627,0.89658},
+        {0.63789,0.75445,0.89563},
+        {0.63514,0.75262,0.89466},
+        {0.63243,0.7508,0.89366},
+        {0.62972,0.74897,0.89264},
+        {0.62705,0.74715,0.89159},
+        {0.6244,0.74531,0.8905},
+        {0.62177,0.74349,0.88938},
+        {0.61919,0.74165,0.88823},
+        {0.61663,0.73982,0.88703},
+        {0.6141,0.73798,0.88579},
+        {0.61162,0.73613,0.8845},
+        {0.60918,0.73429,0.88317},
+        {0.60674,0.73245,0.88182},
+        {0.60432,0.73061,0.88046},
+        {0.6019,0.72876,0.87909},
+        {0.5995,0.72692,0.87772},
+        {0.59711,0.72508,0.87632},
+        {0.59471,0.72323,0.87492},
+        {0.59235,0.72139,0.87351},
+        {0.58997,0.71955,0.87209},
+        {0.58761,0.71771,0.87065},
+        {0.58527,0.71586,0.86921},
+        {0.58292,0.71402,0.86776},
+        {0.58059,0.71217,0.86629},
+        {0.57827,0.71033,0.86481},
+        {0.57597,0.70849,0.86333},
+        {0.57366,0.70665,0.86183},
+        {0.57136,0.7048,0.86033},
+        {0.56908,0.70296,0.8588},
+        {0.56682,0.70112,0.85727},
+        {0.56455,0.69927,0.85574},
+        {0.5623,0.69743,0.85418},
+        {0.56006,0.69559,0.85263},
+        {0.55782,0.69375,0.85105},
+        {0.55559,0.69191,0.84947},
+        {0.55338,0.69007,0.84788},
+        {0.55118,0.68823,0.84627},
+        {0.549,0.68638,0.84466},
+        {0.54681,0.68454,0.84304},
+        {0.54464,0.6827,0.8414},
+        {0.54248,0.68085,0.83976},
+        {0.54033,0.67901,0.8381},
+        {0.53819,0.67718,0.83644},
+        {0.53605,0.67533,0.83476},
+        {0.53393,0.67349,0.83307},
+        {0.53183,0.67165,0.83138},
+        {0.52973,0.66981,0.82967},
+        {0.52764,0.66797,0.82795},
+        {0.52557,0.66613,0.82622},
+        {0.5235,0.66429,0.82448},
+        {0.52144,0.66245,0.82274},
+        {0.5194,0.6606,0.82097},
+        {0.51737,0.65876,0.8192},
+        {0.51534,0.65693,0.81742},
+        {0.51333,0.65508,0.81564},
+        {0.51133,0.65324,0.81383},
+        {0.50934,0.65141,0.81203},
+        {0.50737,0.64957,0.8102},
+        {0.50539,0.64772,0.80838},
+        {0.50344,0.64588,0.80654},
+        {0.5015,0.64404,0.80469},
+        {0.49956,0.64221,0.80282},
+        {0.49765,0.64037,0.80095},
+        {0.49573,0.63853,0.79907},
+        {0.49383,0.6367,0.79718},
+        {0.49195,0.63486,0.79528},
+        {0.49007,0.63302,0.79337},
+        {0.4882,0.63118,0.79145},
+        {0.48631,0.62934,0.78955},
+        {0.48439,0.62751,0.78769},
+        {0.48243,0.62568,0.78587},
+        {0.48043,0.62386,0.78409},
+        {0.4784,0.62203,0.78233},
+        {0.47634,0.62022,0.78062},
+        {0.47423,0.61841,0.77894},
+        {0.47211,0.6166,0.77729},
+        {0.46995,0.61479,0.77567},
+        {0.46775,0.61298,0.77408},
+        {0.46552,0.61119,0.77252},
+        {0.46327,0.60939,0.77099},
+        {0.461,0.6076,0.76947},
+        {0.4587,0.6058,0.76799},
+        {0.45636,0.60403,0.76653},
+        {0.45401,0.60223,0.7651},
+        {0.45164,0.60045,0.76367},
+        {0.44923,0.59867,0.76228},
+        {0.4468,0.5969,0.76091},
+        {0.44436,0.59512,0.75956},
+        {0.44188,0.59336,0.75823},
+        {0.43937,0.59159,0.75691},
+        {0.43686,0.58981,0.75562},
+        {0.43431,0.58805,0.75434},
+        {0.43176,0.5863,0.75308},
+        {0.42917,0.58454,0.75184},
+        {0.42655,0.58278,0.75061},
+        {0.42392,0.58102,0.74939},
+        {0.42127,0.57928,0.74821},
+        {0.4186,0.57752,0.74702},
+        {0.41591,0.57578,0.74586},
+        {0.4132,0.57403,0.7447},
+        {0.41046,0.57229,0.74357},
+        {0.4077,0.57054,0.74245},
+        {0.40491,0.56881,0.74133},
+        {0.40211,0.56708,0.74024},
+        {0.39929,0.56533,0.73915},
+        {0.39645,0.56361,0.73807},
+        {0.39358,0.56188,0.73701},
+        {0.3907,0.56015,0.73596},
+        {0.38779,0.55842,0.73493},
+        {0.38485,0.5567,0.7339},
+        {0.3819,0.55498,0.73288},
+        {0.37893,0.55325,0.73187},
+        {0.37593,0.55154,0.73088},
+        {0.3729,0.54983,0.72989},
+        {0.36986,0.54812,0.72892},
+        {0.36679,0.54641,0.72795},
+        {0.36369,0.54469,0.72699},
+        {0.36057,0.54299,0.72605},
+        {0.35745,0.54127,0.72511},
+        {0.35426,0.53957,0.72418},
+        {0.35108,0.53788,0.72326},
+        {0.34785,0.53617,0.72235},
+        {0.3446,0.53447,0.72144},
+        {0.34133,0.53278,0.72055},
+        {0.33801,0.53108,0.71967},
+        {0.3347,0.52939,0.71879},
+        {0.33131,0.5277,0.71792},
+        {0.32793,0.52601,0.71706},
+        {0.3245,0.52432,0.7162},
+        {0.32105,0.52263,0.71535},
+        {0.31756,0.52095,0.7145},
+        {0.31404,0.51927,0.71368},
+        {0.31049,0.5176,0.71284},
+        {0.30689,0.5159,0.71203},
+        {0.30325,0.51424,0.71122},
+        {0.2996,0.51256,0.71041},
+        {0.29588,0.51089,0.70961},
+        {0.29213,0.50922,0.70882},
+        {0.28834,0.50755,0.70803},
+        {0.2845,0.50587,0.70724},
+        {0.28061,0.50422,0.70647},
+        {0.27671,0.50255,0.7057},
+        {0.27272,0.50089,0.70494},
+        {0.2687,0.49923,0.70418},
+        {0.26461,0.49758,0.70343},
+        {0.26047,0.49591,0.70268},
+        {0.25627,0.49427,0.70194},
+        {0.25203,0.4926,0.70121},
+        {0.24771,0.49097,0.70048},
+        {0.24329,0.4893,0.69975},
+        {0.23883,0.48767,0.69903},
+        {0.23431,0.48601,0.69831},
+        {0.22967,0.48437,0.6976}
+    },
+    {
+        {0,0.017709,0.34641},
+        {0,0.020672,0.3555},
+        {0,0.023402,0.3646},
+        {0,0.025899,0.37376},
+        {0,0.028159,0.38295},
+        {0,0.030176,0.39217},
+        {0,0.031948,0.40143},
+        {0,0.03346,0.41074},
+        {0,0.034886,0.42006},
+        {0,0.036005,0.42943},
+        {0,0.037031,0.43882},
+        {0,0.038092,0.44825},
+        {0,0.039171,0.45769},
+        {0,0.04027,0.46718},
+        {0,0.041408,0.47668},
+        {0,0.042463,0.4862},
+        {0,0.043503,0.49576},
+        {0,0.044741,0.50533},
+        {0,0.045774,0.51494},
+        {0,0.047001,0.52456},
+        {0,0.048092,0.5342},
+        {0,0.049352,0.54387},
+        {0,0.050447,0.55355},
+        {0,0.051609,0.56326},
+        {0,0.052795,0.57298},
+        {0,0.054014,0.58271},
+        {0,0.055261,0.59247},
+        {0,0.056563,0.60223},
+        {0,0.057716,0.61201},
+        {0,0.059101,0.6218},
+        {0,0.060386,0.63161},
+        {0,0.061629,0.64141},
+        {0,0.063072,0.65124},
+        {0,0.064391,0.66106},
+        {0,0.065778,0.6709},
+        {0,0.067217,0.68073},
+        {0,0.068717,0.69056},
+        {0,0.070145,0.7004},
+        {0,0.071697,0.71023},
+        {0,0.073287,0.72005},
+        {0,0.074826,0.72985},
+        {0,0.076443,0.73965},
+        {0,0.078139,0.74942},
+        {0,0.079895,0.75915},
+        {0,0.08168,0.76872},
+        {0,0.083307,0.77811},
+        {0,0.084962,0.78731},
+        {0,0.086573,0.79632},
+        {0,0.088156,0.80515},
+        {0,0.089689,0.81379},
+        {0,0.091208,0.82225},
+        {0,0.092616,0.83051},
+        {0,0.09408,0.83857},
+        {0,0.095474,0.84644},
+        {0,0.096762,0.8541},
+        {0,0.098154,0.86158},
+        {0,0.099403,0.86886},
+        {0,0.10065,0.87593},
+        {0,0.10187,0.88281},
+        {0,0.10309,0.88949},
+        {0,0.1042,0.89597},
+        {0,0.10532,0.90224},
+        {0,0.10647,0.9083},
+        {0,0.10749,0.91415},
+        {0,0.10849,0.9198},
+        {0,0.10956,0.92525},
+        {0,0.11052,0.9305},
+        {0,0.11147,0.93553},
+        {0,0.1124,0.94036},
+        {0,0.11331,0.94497},
+        {0,0.11413,0.94937},
+        {0,0.11498,0.95357},
+        {0,0.11585,0.9576},
+        {0,0.11662,0.96148},
+        {0,0.11733,0.96522},
+        {0,0.11806,0.96883},
+        {0,0.11873,0.97228},
+        {0,0.11931,0.97558},
+        {0,0.11987,0.97874},
+        {0,0.12039,0.98176},
+        {0,0.12087,0.98464},
+        {0,0.12132,0.98737},
+        {0,0.12173,0.98995},
+        {0.042484,0.1221,0.99239},
+        {0.096239,0.12243,0.99468},
+        {0.13272,0.12272,0.99682},
+        {0.16225,0.12297,0.99881},
+        {0.18788,0.12318,1},
+        {0.21091,0.12336,1},
+        {0.23216,0.1235,1},
+        {0.25202,0.1236,1},
+        {0.27081,0.12366,1},
+        {0.28872,0.12369,1},
+        {0.30596,0.12367,1},
+        {0.32259,0.12362,1},
+        {0.33869,0.12354,1},
+        {0.35436,0.12342,1},
+        {0.36964,0.12326,1},
+        {0.38457,0.12307,1},
+        {0.39919,0.12286,1},
+        {0.41348,0.12262,1},
+        {0.42736,0.12239,1},
+        {0.44084,0.12216,1},
+        {0.454,0.12195,1},
+        {0.46684,0.12174,1},
+        {0.47939,0.12155,1},
+        {0.49169,0.12136,1},
+        {0.50374,0.12117,1},
+        {0.51557,0.121,1},
+        {0.52721,0.12083,1},
+        {0.53866,0.12067,1},
+        {0.54992,0.12051,1},
+        {0.56102,0.12037,1},
+        {0.57198,0.12022,1},
+        {0.58279,0.12009,1},
+        {0.59347,0.11996,1},
+        {0.60403,0.11983,1},
+        {0.61446,0.11971,1},
+        {0.62479,0.11959,1},
+        {0.63501,0.11948,1},
+        {0.64513,0.11938,1},
+        {0.65516,0.11927,1},
+        {0.66511,0.11918,1},
+        {0.67497,0.11908,1},
+        {0.68475,0.11899,1},
+        {0.69445,0.1189,1},
+        {0.7041,0.11881,1},
+        {0.71366,0.11873,1},
+        {0.72312,0.11873,1},
+        {0.73244,0.11896,1},
+        {0.74156,0.11949,1},
+        {0.75051,0.12036,1},
+        {0.75927,0.12156,1},
+        {0.76785,0.12312,1},
+        {0.77627,0.12504,1},
+        {0.78452,0.12724,1},
+        {0.79261,0.12981,1},
+        {0.80054,0.13262,1},
+        {0.80832,0.1357,1},
+        {0.81594,0.1391,1},
+        {0.82341,0.14279,1},
+        {0.83074,0.14669,1},
+        {0.83791,0.15087,1},
+        {0.84494,0.15527,1},
+        {0.85183,0.15984,1},
+        {0.85859,0.16467,1},
+        {0.8652,0.16967,1},
+        {0.87169,0.17481,1},
+        {0.87803,0.1801,1},
+        {0.88424,0.18562,1},
+        {0.89031,0.1912,1},
+        {0.89626,0.19697,1},
+        {0.90207,0.20282,1},
+        {0.90776,0.2088,1},
+        {0.91332,0.21488,1},
+        {0.91875,0.22109,1},
+        {0.92405,0.22737,1},
+        {0.92919,0.23379,1},
+        {0.93415,0.24041,1},
+        {0.93894,0.2472,1},
+        {0.94355,0.25413,1},
+        {0.94798,0.26118,1},
+        {0.95224,0.26837,1},
+        {0.95633,0.2757,1},
+        {0.96024,0.28311,1},
+        {0.96396,0.29064,1},
+        {0.96751,0.29827,1},
+        {0.97089,0.30602,1},
+        {0.97409,0.31382,1},
+        {0.97712,0.3217,1},
+        {0.97997,0.32968,1},
+        {0.98265,0.33769,1},
+        {0.98515,0.34577,1},
+        {0.98746,0.35394,1},
+        {0.9896,0.36216,1},
+        {0.99155,0.37042,1},
+        {0.99333,0.37874,1},
+        {0.99493,0.3871,1},
+        {0.99635,0.39551,1},
+        {0.9976,0.40394,1},
+        {0.99866,0.41243,1},
+        {0.99953,0.42094,1},
+        {1,0.4295,1},
+        {1,0.43809,1},
+        {1,0.44668,1},
+        {1,0.45524,1},
+        {1,0.46369,1},
+        {1,0.47203,1},
+        {1,0.48024,1},
+        {1,0.48835,1},
+        {1,0.49634,1},
+        {1,0.50426,1},
+        {1,0.51206,1},
+        {1,0.51978,1},
+        {1,0.52742,1},
+        {1,0.53498,1},
+        {1,0.54247,1},
+        {1,0.54988,1},
+        {1,0.55722,1},
+        {1,0.56449,1},
+        {1,0.57169,1},
+        {1,0.57884,1},
+        {1,0.58594,1},
+        {1,0.59297,1},
+        {1,0.59995,1},
+        {1,0.60688,1},
+        {1,0.61374,1},
+        {1,0.62058,1},
+        {1,0.62736,1},
+        {1,0.6341,1},
+        {1,0.64079,1},
+        {1,0.64743,1},
+        {1,0.65405,1},
+        {1,0.66063,1},
+        {1,0.66718,1},
+        {1,0.6737,1},
+        {1,0.68019,1},
+        {1,0.68667,1},
+        {1,0.69312,1},
+        {1,0.69954,1},
+        {1,0.70595,1},
+        {1,0.71233,1},
+        {1,0.71869,1},
+        {1,0.72504,1},
+        {1,0.73136,1},
+        {1,0.73767,1},
+        {1,0.74396,1},
+        {1,0.75023,1},
+        {1,0.75649,1},
+        {1,0.76273,1},
+        {1,0.76895,1},
+        {1,0.77517,1},
+        {1,0.78137,1},
+        {1,0.78755,1},
+        {1,0.79372,1},
+        {1,0.79988,1},
+        {1,0.80602,1},
+        {1,0.81215,1},
+        {1,0.81826,1},
+        {1,0.82437,1},
+        {1,0.83047,1},
+        {1,0.83656,1},
+        {1,0.84263,1},
+        {1,0.84869,1},
+        {1,0.85475,1},
+        {1,0.86079,1},
+        {1,0.86683,1},
+        {1,0.87286,0.99978},
+        {1,0.87887,0.9995},
+        {1,0.88488,0.99921},
+        {1,0.89088,0.99892},
+        {0.99975,0.89688,0.99861},
+        {0.99925,0.90287,0.9983},
+        {0.99872,0.90884,0.99799},
+        {0.99817,0.91481,0.99766},
+        {0.9976,0.92077,0.99733}
+    },
+    {
+        {0,0.047803,0.4883},
+        {0,0.049705,0.49553},
+        {0,0.051451,0.50272},
+        {0,0.053214,0.50983},
+        {0,0.054977,0.51684},
+        {0,0.056756,0.52379},
+        {0,0.058368,0.53062},
+        {0,0.060099,0.53736},
+        {0,0.061618,0.54402},
+        {0,0.063279,0.55055},
+        {0,0.06478,0.55698},
+        {0,0.066288,0.56332},
+        {0,0.067769,0.5695},
+        {0,0.069247,0.57558},
+        {0,0.070546,0.58154},
+        {0,0.071898,0.58736},
+        {0,0.073227,0.59303},
+        {0,0.074425,0.59856},
+        {0,0.075597,0.60398},
+        {0,0.076712,0.60919},
+        {0,0.077789,0.61423},
+        {0,0.078828,0.61913},
+        {0,0.079825,0.62386},
+        {0,0.080751,0.62837},
+        {0,0.081634,0.63267},
+        {0,0.082399,0.63679},
+        {0,0.083056,0.64069},
+        {0,0.083728,0.64438},
+        {0,0.084298,0.64781},
+        {0,0.084735,0.65098},
+        {0,0.085075,0.65389},
+        {0,0.085333,0.65653},
+        {0,0.085503,0.65887},
+        {0,0.085575,0.66091},
+        {0,0.085538,0.66263},
+        {0,0.085387,0.664},
+        {0.041146,0.085117,0.66498},
+        {0.082348,0.084719,0.66559},
+        {0.11295,0.084153,0.66576},
+        {0.13887,0.083348,0.66549},
+        {0.16224,0.08245,0.66472},
+        {0.18389,0.081312,0.66345},
+        {0.20444,0.079918,0.6616},
+        {0.2241,0.078308,0.65916},
+        {0.24323,0.076464,0.65608},
+        {0.26189,0.074387,0.65234},
+        {0.27969,0.072084,0.64827},
+        {0.29634,0.069818,0.64421},
+        {0.31196,0.067486,0.64024},
+        {0.32675,0.065157,0.63634},
+        {0.34081,0.062906,0.63252},
+        {0.35421,0.060546,0.6288},
+        {0.36705,0.058179,0.62515},
+        {0.3794,0.055931,0.62158},
+        {0.39131,0.05356,0.6181},
+        {0.40281,0.051267,0.6147},
+        {0.41397,0.049057,0.6114},
+        {0.42479,0.046684,0.60817},
+        {0.43533,0.044376,0.60501},
+        {0.44558,0.042108,0.60193},
+        {0.4556,0.039763,0.59895},
+        {0.46537,0.037486,0.59604},
+        {0.47496,0.035294,0.59322},
+        {0.48432,0.032963,0.59047},
+        {0.49352,0.030903,0.5878},
+        {0.50254,0.028926,0.58523},
+        {0.5114,0.027022,0.58272},
+        {0.52012,0.025191,0.5803},
+        {0.52872,0.02343,0.57794},
+        {0.53717,0.021744,0.57569},
+        {0.54549,0.020131,0.57351},
+        {0.5537,0.018589,0.5714},
+        {0.56182,0.017116,0.56937},
+        {0.56982,0.015713,0.56743},
+        {0.57772,0.014383,0.56556},
+        {0.58556,0.013108,0.56378},
+        {0.59331,0.011906,0.56202},
+        {0.60102,0.010448,0.56026},
+        {0.60871,0.0092728,0.55849},
+        {0.61634,0.0080608,0.55673},
+        {0.62394,0.0068636,0.55496},
+        {0.6315,0.0056715,0.55317},
+        {0.63904,0.0044851,0.5514},
+        {0.64654,0.0033027,0.5496},
+        {0.65401,0.0021237,0.54781},
+        {0.66146,0.00094944,0.54601},
+        {0.66888,0,0.54419},
+        {0.67628,0,0.54238},
+        {0.68364,0,0.54055},
+        {0.69099,0,0.53873},
+        {0.69832,0,0.53689},
+        {0.70562,0,0.53504},
+        {0.71291,0,0.53319},
+        {0.72018,0,0.53134},
+        {0.72742,0,0.52948},
+        {0.73466,0,0.52761},
+        {0.74187,0,0.52573},
+        {0.74906,0,0.52385},
+        {0.75625,0,0.52195},
+        {0.76342,0,0.52005},
+        {0.77058,0,0.51816},
+        {0.77773,0,0.51624},
+        {0.78486,0,0.51433},
+        {0.79198,0,0.51239},
+        {0.79909,0,0.51046},
+        {0.80618,0,0.50853},
+        {0.81322,0,0.50656},
+        {0.82017,0,0.50459},
+        {0.82703,0,0.50258},
+        {0.83381,0,0.50056},
+        {0.84048,0,0.49853},
+        {0.84706,0,0.49645},
+        {0.85355,0,0.49437},
+        {0.85996,0,0.49225},
+        {0.86628,0,0.49011},
+        {0.8725,0,0.48796},
+        {0.87863,0.0025964,0.48577},
+        {0.88468,0.0090591,0.48356},
+        {0.89063,0.016464,0.48133},
+        {0.8965,0.024452,0.47908},
+        {0.90228,0.033265,0.47679},
+        {0.90796,0.042948,0.47449},
+        {0.91356,0.052352,0.47216},
+        {0.91907,0.061335,0.4698},
+        {0.92449,0.070106,0.46741},
+        {0.92982,0.07857,0.46499},
+        {0.93506,0.086993,0.46255},
+        {0.94022,0.095176,0.46008},
+        {0.94529,0.10322,0.45759},
+        {0.95027,0.11119,0.45507},
+        {0.95516,0.11907,0.45252},
+        {0.95996,0.12687,0.44993},
+        {0.96467,0.13467,0.44731},
+        {0.9693,0.14235,0.44468},
+        {0.97383,0.15004,0.44201},
+        {0.97827,0.15766,0.43929},
+        {0.9826,0.16532,0.43656},
+        {0.9868,0.17308,0.4338},
+        {0.99086,0.18089,0.43103},
+        {0.99477,0.18882,0.42822},
+        {0.99854,0.19681,0.42539},
+        {1,0.20481,0.42252},
+        {1,0.21285,0.41965},
+        {1,0.22099,0.41674},
+        {1,0.22914,0.4138},
+        {1,0.23736,0.41083},
+        {1,0.24555,0.40783},
+        {1,0.25382,0.4048},
+        {1,0.2621,0.40173},
+        {1,0.27043,0.39864},
+        {1,0.27875,0.39552},
+        {1,0.28708,0.39235},
+        {1,0.29545,0.38916},
+        {1,0.30385,0.38591},
+        {1,0.31225,0.38264},
+        {1,0.3207,0.37933},
+        {1,0.32913,0.37598},
+        {1,0.33756,0.37257},
+        {1,0.34602,0.36914},
+        {1,0.35451,0.36565},
+        {1,0.36297,0.36212},
+        {1,0.37145,0.35853},
+        {1,0.37995,0.35492},
+        {1,0.38846,0.35122},
+        {1,0.39696,0.34749},
+        {1,0.40547,0.34369},
+        {1,0.4139,0.33986},
+        {1,0.4222,0.33597},
+        {1,0.4304,0.33207},
+        {1,0.43847,0.3281},
+        {1,0.44643,0.3241},
+        {1,0.45429,0.32007},
+        {1,0.46204,0.31598},
+        {1,0.46971,0.31182},
+        {1,0.47727,0.30763},
+        {1,0.48476,0.30339},
+        {1,0.49217,0.2991},
+        {1,0.4995,0.29473},
+        {1,0.50677,0.2903},
+        {1,0.51397,0.28581},
+        {1,0.5211,0.28126},
+        {1,0.52816,0.27665},
+        {1,0.53517,0.27191},
+        {1,0.54212,0.26713},
+        {1,0.54902,0.26226},
+        {1,0.55585,0.2573},
+        {1,0.56265,0.25223},
+        {1,0.56938,0.24705},
+        {1,0.57609,0.24177},
+        {1,0.58273,0.23637},
+        {1,0.58934,0.23082},
+        {1,0.59591,0.22513},
+        {1,0.60244,0.21933},
+        {1,0.60893,0.21333},
+        {1,0.61536,0.20719},
+        {1,0.62179,0.20085},
+        {1,0.62814,0.19473},
+        {1,0.63438,0.18898},
+        {1,0.64052,0.18363},
+        {1,0.64658,0.17866},
+        {1,0.65258,0.17395},
+        {1,0.65851,0.16956},
+        {1,0.66439,0.16532},
+        {1,0.67023,0.1614},
+        {1,0.67601,0.15763},
+        {1,0.68174,0.1541},
+        {1,0.68745,0.15075},
+        {1,0.69312,0.14754},
+        {1,0.69875,0.14449},
+        {1,0.70435,0.14163},
+        {1,0.70993,0.13886},
+        {1,0.71548,0.13623},
+        {1,0.72099,0.13382},
+        {1,0.72649,0.1315},
+        {1,0.73197,0.12928},
+        {1,0.73742,0.12722},
+        {1,0.74286,0.1253},
+        {1,0.74827,0.12347},
+        {1,0.75367,0.1218},
+        {1,0.75905,0.12025},
+        {1,0.76442,0.11888},
+        {1,0.76976,0.11751},
+        {1,0.7751,0.11639},
+        {1,0.78042,0.11528},
+        {1,0.78573,0.11434},
+        {1,0.79102,0.11357},
+        {1,0.79631,0.11289},
+        {1,0.80158,0.1123},
+        {1,0.80685,0.11183},
+        {1,0.81209,0.1115},
+        {1,0.81733,0.11127},
+        {1,0.82257,0.11116},
+        {1,0.82778,0.11116},
+        {1,0.833,0.11128},
+        {1,0.8382,0.1115},
+        {1,0.8434,0.11183},
+        {1,0.84859,0.11227},
+        {1,0.85377,0.11282},
+        {1,0.85894,0.11347},
+        {1,0.86412,0.11414},
+        {1,0.86928,0.115},
+        {1,0.87443,0.11595},
+        {1,0.87958,0.11697},
+        {1,0.88472,0.11809},
+        {1,0.88986,0.11929},
+        {1,0.89499,0.12054},
+        {1,0.90012,0.1219},
+        {1,0.90524,0.12335},
+        {1,0.91036,0.12486},
+        {1,0.91547,0.12649},
+        {1,0.92058,0.12812},
+        {1,0.92569,0.1299},
+        {1,0.93079,0.13165},
+        {1,0.93588,0.13349},
+        {1,0.94097,0.13541},
+        {1,0.94606,0.13735}
+    },
+    {
+        {0.39872,0.60624,0.56451},
+        {0.40156,0.60721,0.56266},
+        {0.4044,0.60816,0.5608},
+        {0.40724,0.60911,0.55895},
+        {0.41009,0.61005,0.55712},
+        {0.41293,0.61099,0.55528},
+        {0.41577,0.61192,0.55344},
+        {0.41863,0.61285,0.55162},
+        {0.42148,0.61378,0.5498},
+        {0.42435,0.6147,0.54798},
+        {0.42723,0.61561,0.54618},
+        {0.4301,0.61653,0.54436},
+        {0.43298,0.61743,0.54256},
+        {0.43588,0.61833,0.54076},
+        {0.43876,0.61923,0.53897},
+        {0.44169,0.62012,0.53719},
+        {0.44461,0.621,0.5354},
+        {0.44752,0.62186,0.53362},
+        {0.45047,0.62274,0.53186},
+        {0.45342,0.62361,0.5301},
+        {0.45639,0.62446,0.52835},
+        {0.45937,0.62531,0.5266},
+        {0.46235,0.62615,0.52485},
+        {0.46536,0.62698,0.52312},
+        {0.46838,0.62781,0.52138},
+        {0.47142,0.62864,0.51966},
+        {0.47447,0.62944,0.51795},
+        {0.47754,0.63025,0.51623},
+        {0.48061,0.63105,0.51454},
+        {0.48372,0.63184,0.51285},
+        {0.48685,0.63262,0.51116},
+        {0.48999,0.63339,0.50949},
+        {0.49314,0.63416,0.50783},
+        {0.49633,0.63491,0.50616},
+        {0.49954,0.63565,0.50452},
+        {0.50277,0.63639,0.50287},
+        {0.50602,0.63711,0.50125},
+        {0.50931,0.63782,0.49961},
+        {0.51261,0.63852,0.49802},
+        {0.51594,0.63922,0.4964},
+        {0.5193,0.6399,0.49483},
+        {0.52268,0.64057,0.49323},
+        {0.5261,0.64122,0.49168},
+        {0.52955,0.64187,0.49012},
+        {0.53302,0.6425,0.48858},
+        {0.53654,0.64312,0.48705},
+        {0.54007,0.64372,0.48552},
+        {0.54365,0.64431,0.48402},
+        {0.54726,0.64489,0.48253},
+        {0.55092,0.64545,0.48105},
+        {0.55461,0.64599,0.4796},
+        {0.55833,0.64652,0.47815},
+        {0.56212,0.64704,0.47672},
+        {0.56592,0.64753,0.47532},
+        {0.56978,0.648,0.47391},
+        {0.57369,0.64846,0.47253},
+        {0.57764,0.6489,0.47118},
+        {0.58164,0.64932,0.46984},
+        {0.5857,0.64971,0.46851},
+        {0.5898,0.65009,0.46722},
+        {0.59397,0.65044,0.46593},
+        {0.59819,0.65076,0.46469},
+        {0.60248,0.65106,0.46344},
+        {0.60683,0.65134,0.46224},
+        {0.61124,0.65159,0.46106},
+        {0.61572,0.6518,0.45991},
+        {0.62028,0.65199,0.45879},
+        {0.62491,0.65214,0.45769},
+        {0.62961,0.65226,0.45663},
+        {0.63441,0.65235,0.4556},
+        {0.63928,0.6524,0.45461},
+        {0.64424,0.65241,0.45364},
+        {0.6493,0.65237,0.45273},
+        {0.65445,0.6523,0.45184},
+        {0.65971,0.65218,0.451},
+        {0.66508,0.65201,0.45021},
+        {0.67058,0.65178,0.44946},
+        {0.67612,0.65152,0.44876},
+        {0.68161,0.65126,0.44805},
+        {0.68699,0.65102,0.44736},
+        {0.69226,0.65081,0.44667},
+        {0.69741,0.65061,0.44598},
+        {0.70245,0.65044,0.44529},
+        {0.70738,0.65029,0.44461},
+        {0.71221,0.65017,0.44392},
+        {0.71694,0.65007,0.44324},
+        {0.72155,0.65,0.44256},
+        {0.72607,0.64995,0.44187},
+        {0.73048,0.64993,0.44118},
+        {0.7348,0.64994,0.4405},
+        {0.73901,0.64997,0.43982},
+        {0.74312,0.65003,0.43914},
+        {0.74713,0.65011,0.43846},
+        {0.75106,0.65023,0.43779},
+        {0.75488,0.65037,0.43711},
+        {0.7586,0.65054,0.43643},
+        {0.76223,0.65074,0.43576},
+        {0.76578,0.65097,0.43508},
+        {0.76922,0.65123,0.4344},
+        {0.77257,0.65152,0.43372},
+        {0.77583,0.65185,0.43305},
+        {0.779,0.65219,0.43239},
+        {0.78209,0.65257,0.43171},
+        {0.78507,0.65298,0.43103},
+        {0.78797,0.65343,0.43036},
+        {0.79078,0.65391,0.42968},
+        {0.7935,0.65441,0.42901},
+        {0.79612,0.65495,0.42833},
+        {0.79867,0.65553,0.42766},
+        {0.80112,0.65614,0.42699},
+        {0.80349,0.65678,0.4263},
+        {0.80576,0.65745,0.42564},
+        {0.80795,0.65816,0.42497},
+        {0.81006,0.65889,0.42428},
+        {0.81207,0.65966,0.42361},
+        {0.814,0.66047,0.42293},
+        {0.81584,0.66131,0.42225},
+        {0.8176,0.66219,0.42158},
+        {0.81927,0.66309,0.4209},
+        {0.82085,0.66403,0.42023},
+        {0.82235,0.665,0.41956},
+        {0.82376,0.66601,0.41887},
+        {0.82508,0.66705,0.41819},
+        {0.82632,0.66813,0.41752},
+        {0.82747,0.66924,0.41684},
+        {0.82853,0.67039,0.41616},
+        {0.82952,0.67156,0.41547},
+        {0.83041,0.67278,0.41479},
+        {0.83123,0.67401,0.41414},
+        {0.83202,0.67526,0.41355},
+        {0.83279,0.67651,0.41307},
+        {0.83355,0.67776,0.41268},
+        {0.83429,0.67901,0.41239},
+        {0.83501,0.68025,0.41219},
+        {0.83572,0.68151,0.41208},
+        {0.83641,0.68277,0.41209},
+        {0.83708,0.68402,0.41219},
+        {0.83774,0.68528,0.41239},
+        {0.83838,0.68653,0.41269},
+        {0.83901,0.68779,0.41309},
+        {0.83962,0.68906,0.41358},
+        {0.84021,0.69031,0.41417},
+        {0.84079,0.69157,0.41487},
+        {0.84135,0.69284,0.41567},
+        {0.84189,0.6941,0.41657},
+        {0.84242,0.69537,0.41757},
+        {0.84293,0.69663,0.41865},
+        {0.84342,0.6979,0.41986},
+        {0.8439,0.69916,0.42115},
+        {0.84436,0.70044,0.42254},
+        {0.8448,0.7017,0.42404},
+        {0.84523,0.70298,0.42564},
+        {0.84563,0.70425,0.42735},
+        {0.84602,0.70552,0.42913},
+        {0.84639,0.7068,0.43103},
+        {0.84674,0.70808,0.43303},
+        {0.84707,0.70936,0.43513},
+        {0.84739,0.71063,0.43732},
+        {0.84768,0.71191,0.4396},
+        {0.84796,0.71319,0.44201},
+        {0.84821,0.71447,0.4445},
+        {0.84845,0.71577,0.44707},
+        {0.84866,0.71705,0.44976},
+        {0.84885,0.71833,0.45256},
+        {0.84903,0.71963,0.45543},
+        {0.84918,0.72091,0.45841},
+        {0.8493,0.7222,0.46149},
+        {0.84941,0.7235,0.46467},
+        {0.84949,0.7248,0.46793},
+        {0.84954,0.72609,0.4713},
+        {0.84958,0.72739,0.47477},
+        {0.84958,0.72869,0.47832},
+        {0.84956,0.72999,0.48199},
+        {0.84952,0.73129,0.48573},
+        {0.84945,0.7326,0.48957},
+        {0.84935,0.7339,0.49352},
+        {0.84922,0.73521,0.49757},
+        {0.84907,0.73652,0.5017},
+        {0.84889,0.73783,0.50591},
+        {0.84868,0.73916,0.51022},
+        {0.84848,0.74046,0.51454},
+        {0.84828,0.74176,0.51885},
+        {0.8481,0.74306,0.52316},
+        {0.84792,0.74435,0.52745},
+        {0.84775,0.74564,0.53175},
+        {0.84759,0.74692,0.53603},
+        {0.84743,0.74821,0.54032},
+        {0.84727,0.74947,0.5446},
+        {0.84712,0.75075,0.54888},
+        {0.84698,0.75202,0.55314},
+        {0.84684,0.75328,0.55742},
+        {0.8467,0.75455,0.56168},
+        {0.84656,0.7558,0.56594},
+        {0.84643,0.75706,0.57019},
+        {0.84629,0.75831,0.57444},
+        {0.84616,0.75955,0.5787},
+        {0.84603,0.76081,0.58295},
+        {0.8459,0.76205,0.58719},
+        {0.84577,0.76329,0.59144},
+        {0.84564,0.76453,0.59568},
+        {0.84551,0.76577,0.59993},
+        {0.84537,0.767,0.60417},
+        {0.84524,0.76824,0.6084},
+        {0.84511,0.76947,0.61263},
+        {0.84497,0.77071,0.61687},
+        {0.84484,0.77194,0.6211},
+        {0.8447,0.77316,0.62533},
+        {0.84455,0.77439,0.62955},
+        {0.84441,0.77561,0.63379},
+        {0.84426,0.77684,0.63801},
+        {0.84411,0.77806,0.64224},
+        {0.84396,0.77928,0.64646},
+        {0.8438,0.7805,0.65068},
+        {0.84364,0.78172,0.6549},
+        {0.84348,0.78294,0.65912},
+        {0.84331,0.78416,0.66335},
+        {0.84314,0.78537,0.66757},
+        {0.84297,0.78659,0.67179},
+        {0.84279,0.7878,0.67601},
+        {0.84261,0.78901,0.68022},
+        {0.84243,0.79022,0.68444},
+        {0.84224,0.79143,0.68867},
+        {0.84204,0.79265,0.69289},
+        {0.84184,0.79386,0.6971},
+        {0.84163,0.79507,0.70132},
+        {0.84142,0.79627,0.70554},
+        {0.8412,0.79748,0.70976},
+        {0.84098,0.79869,0.71398},
+        {0.84076,0.7999,0.7182},
+        {0.84053,0.8011,0.72241},
+        {0.84029,0.80231,0.72663},
+        {0.84004,0.80352,0.73085},
+        {0.8398,0.80472,0.73508},
+        {0.83954,0.80593,0.7393},
+        {0.83928,0.80713,0.74352},
+        {0.83901,0.80834,0.74774},
+        {0.83873,0.80954,0.75196},
+        {0.83845,0.81074,0.75618},
+        {0.83817,0.81195,0.76041},
+        {0.83788,0.81315,0.76463},
+        {0.83758,0.81435,0.76885},
+        {0.83727,0.81555,0.77308},
+        {0.83695,0.81676,0.77731},
+        {0.83663,0.81795,0.78154},
+        {0.8363,0.81916,0.78577},
+        {0.83597,0.82036,0.78999},
+        {0.83563,0.82156,0.79422},
+        {0.83528,0.82277,0.79845},
+        {0.83492,0.82396,0.80268},
+        {0.83456,0.82516,0.80692},
+        {0.83419,0.82637,0.81115},
+        {0.83381,0.82757,0.81538},
+        {0.83342,0.82877,0.81962},
+        {0.83302,0.82997,0.82386},
+        {0.83262,0.83118,0.82809},
+        {0.83221,0.83237,0.83233}
+    },
     {
-        return GetMap(map)[mapIndex];
+        {0.0020082,0.082527,0.022201},
+        {0.004381,0.08615,0.022118},
+        {0.0067598,0.089747,0.022041},
+        {0.0091625,0.093124,0.021981},
+        {0.011768,0.096433,0.021933},
+        {0.014187,0.099686,0.021895},
+        {0.016629,0.10283,0.021877},
+        {0.019082,0.10587,0.021867},
+        {0.021556,0.1088,0.021877},
+        {0.024018,0.11172,0.021897},
+        {0.026293,0.11459,0.021902},
+        {0.028361,0.1176,0.0219},
+        {0.030209,0.12061,0.021879},
+        {0.031836,0.12368,0.021843},
+        {0.033248,0.12681,0.021797},
+        {0.03448,0.13002,0.021732},
+        {0.035611,0.13318,0.021656},
+        {0.036308,0.13639,0.021568},
+        {0.036803,0.13965,0.021464},
+        {0.037067,0.14299,0.021348},
+        {0.037096,0.14631,0.021222},
+        {0.036881,0.14971,0.021083},
+        {0.036566,0.15305,0.020931},
+        {0.036258,0.15648,0.020778},
+        {0.035956,0.15982,0.02062},
+        {0.035648,0.16326,0.020454},
+        {0.03531,0.16666,0.020281},
+        {0.034935,0.17007,0.02011},
+        {0.034549,0.17347,0.019938},
+        {0.034194,0.17689,0.019764},
+        {0.0339,0.18031,0.01959},
+        {0.033658,0.18374,0.019418},
+        {0.03346,0.18719,0.019251},
+        {0.033308,0.1906,0.019094},
+        {0.033202,0.19407,0.018947},
+        {0.033153,0.19748,0.018811},
+        {0.033171,0.2009,0.018691},
+        {0.033269,0.20438,0.018588},
+        {0.033456,0.2078,0.018509},
+        {0.033755,0.21125,0.018457},
+        {0.034229,0.21467,0.018437},
+        {0.03498,0.21811,0.018456},
+        {0.03581,0.22154,0.018521},
+        {0.036701,0.22495,0.018622},
+        {0.037696,0.22842,0.018735},
+        {0.038702,0.23186,0.018848},
+        {0.039729,0.23531,0.018957},
+        {0.040766,0.23875,0.019061},
+        {0.041844,0.24222,0.019159},
+        {0.042758,0.24568,0.019252},
+        {0.043802,0.24918,0.019339},
+        {0.044931,0.25267,0.019419},
+        {0.045873,0.25616,0.019493},
+        {0.047009,0.25968,0.019561},
+        {0.047989,0.26319,0.019623},
+        {0.049157,0.2667,0.019676},
+        {0.050138,0.27025,0.019721},
+        {0.051173,0.27378,0.019758},
+        {0.052215,0.27732,0.019785},
+        {0.053276,0.28085,0.019802},
+        {0.054355,0.28442,0.01981},
+        {0.055446,0.28799,0.01981},
+        {0.056569,0.29158,0.019809},
+        {0.057528,0.29515,0.019834},
+        {0.058624,0.29874,0.01989},
+        {0.059734,0.30233,0.019977},
+        {0.06068,0.30596,0.020098},
+        {0.061651,0.30957,0.020253},
+        {0.062756,0.31318,0.020445},
+        {0.063696,0.31681,0.020677},
+        {0.064656,0.32045,0.02095},
+        {0.065612,0.32408,0.021258},
+        {0.066576,0.32773,0.021584},
+        {0.067549,0.33138,0.021916},
+        {0.068538,0.33506,0.022251},
+        {0.06952,0.33872,0.022589},
+        {0.070402,0.3424,0.022929},
+        {0.071419,0.34607,0.023272},
+        {0.072319,0.34977,0.023618},
+        {0.073361,0.35346,0.023966},
+        {0.074283,0.35718,0.024318},
+        {0.075218,0.36087,0.024672},
+        {0.076165,0.36459,0.025028},
+        {0.077123,0.36832,0.025388},
+        {0.078091,0.37204,0.02575},
+        {0.079071,0.37578,0.026116},
+        {0.080061,0.37952,0.026484},
+        {0.081061,0.38328,0.026854},
+        {0.082077,0.38702,0.027228},
+        {0.082984,0.39079,0.027604},
+        {0.084013,0.39456,0.027983},
+        {0.084952,0.39834,0.028365},
+        {0.085878,0.40211,0.02875},
+        {0.086941,0.40591,0.029138},
+        {0.087908,0.4097,0.029528},
+        {0.088876,0.4135,0.029921},
+        {0.089858,0.41731,0.030317},
+        {0.090847,0.42111,0.030716},
+        {0.091852,0.42494,0.031118},
+        {0.092761,0.42876,0.031521},
+        {0.093773,0.43259,0.031927},
+        {0.094809,0.43643,0.032341},
+        {0.09575,0.44027,0.03276},
+        {0.096692,0.44412,0.033171},
+        {0.097753,0.44796,0.033567},
+        {0.098721,0.45183,0.033985},
+        {0.099698,0.4557,0.034483},
+        {0.10069,0.45957,0.035028},
+        {0.10168,0.46344,0.035514},
+        {0.10269,0.46733,0.035934},
+        {0.1037,0.47122,0.036349},
+        {0.10463,0.47512,0.036789},
+        {0.10568,0.47902,0.037237},
+        {0.10671,0.48292,0.037682},
+        {0.10766,0.48683,0.038128},
+        {0.10865,0.49076,0.038578},
+        {0.10971,0.49468,0.039032},
+        {0.11069,0.49861,0.039489},
+        {0.11169,0.50254,0.039948},
+        {0.1127,0.50648,0.040406},
+        {0.11369,0.51042,0.040871},
+        {0.11464,0.51438,0.041351},
+        {0.11569,0.51834,0.041826},
+        {0.1167,0.52229,0.042253},
+        {0.11769,0.52627,0.042639},
+        {0.11873,0.53024,0.043044},
+        {0.1197,0.53421,0.043511},
+        {0.1207,0.53821,0.044017},
+        {0.1217,0.54219,0.044525},
+        {0.12271,0.54619,0.044992},
+        {0.12373,0.55018,0.045398},
+        {0.12476,0.55419,0.045806},
+        {0.12581,0.55819,0.046288},
+        {0.12679,0.56222,0.046801},
+        {0.12783,0.56624,0.047247},
+        {0.12882,0.57026,0.047653},
+        {0.12988,0.57429,0.048118},
+        {0.13089,0.57833,0.048645},
+        {0.1319,0.58237,0.049135},
+        {0.13292,0.58642,0.049563},
+        {0.13395,0.59047,0.04998},
+        {0.13498,0.59453,0.050418},
+        {0.13595,0.59859,0.050866},
+        {0.13701,0.60266,0.051311},
+        {0.13806,0.60673,0.051757},
+        {0.13904,0.61081,0.052205},
+        {0.14007,0.61488,0.052658},
+        {0.14114,0.61898,0.053112},
+        {0.14214,0.62307,0.053569},
+        {0.14318,0.62716,0.054029},
+        {0.14421,0.63127,0.054491},
+        {0.14526,0.63537,0.054953},
+        {0.14626,0.63949,0.055418},
+        {0.1473,0.6436,0.055896},
+        {0.14831,0.64772,0.056378},
+        {0.14938,0.65185,0.056824},
+        {0.15041,0.65599,0.057227},
+        {0.15143,0.66012,0.057637},
+        {0.15246,0.66426,0.058099},
+        {0.15349,0.66841,0.058598},
+        {0.15454,0.67256,0.0591},
+        {0.1556,0.67671,0.059581},
+        {0.15665,0.68086,0.060024},
+        {0.15766,0.68503,0.06044},
+        {0.15873,0.68921,0.060845},
+        {0.15973,0.69338,0.061267},
+        {0.1608,0.69755,0.061737},
+        {0.16187,0.70173,0.06225},
+        {0.16291,0.70593,0.06274},
+        {0.16396,0.71012,0.063178},
+        {0.16497,0.71431,0.063603},
+        {0.16602,0.71852,0.064042},
+        {0.1671,0.72272,0.064491},
+        {0.16812,0.72693,0.064939},
+        {0.16921,0.73115,0.065387},
+        {0.17024,0.73537,0.065837},
+        {0.17128,0.7396,0.066291},
+        {0.17233,0.74382,0.066748},
+        {0.17339,0.74806,0.067206},
+        {0.17446,0.75229,0.067663},
+        {0.1755,0.75654,0.068124},
+        {0.17654,0.76078,0.068597},
+        {0.17764,0.76504,0.069073},
+        {0.17869,0.76929,0.069516},
+        {0.17973,0.77355,0.06992},
+        {0.18078,0.77782,0.070337},
+        {0.18184,0.78209,0.070809},
+        {0.1829,0.78636,0.071291},
+        {0.18397,0.79063,0.071723},
+        {0.18506,0.79491,0.072134},
+        {0.18612,0.7992,0.07259},
+        {0.18718,0.80349,0.073087},
+        {0.18826,0.80779,0.073557},
+        {0.1893,0.81208,0.073983},
+        {0.19036,0.81639,0.074402},
+        {0.19143,0.82069,0.074835},
+        {0.1925,0.825,0.075276},
+        {0.19359,0.82933,0.075716},
+        {0.19467,0.83365,0.076155},
+        {0.19571,0.83797,0.076597},
+        {0.19681,0.8423,0.077042},
+        {0.19786,0.84663,0.077489},
+        {0.19892,0.85096,0.077938},
+        {0.19999,0.85531,0.078388},
+        {0.20106,0.85965,0.078841},
+        {0.20215,0.864,0.079296},
+        {0.20324,0.86836,0.079753},
+        {0.20434,0.87271,0.080211},
+        {0.20539,0.87707,0.080669},
+        {0.2065,0.88144,0.081135},
+        {0.20756,0.88581,0.08161},
+        {0.20863,0.89017,0.082069},
+        {0.20974,0.89456,0.082489},
+        {0.21167,0.8989,0.082885},
+        {0.21577,0.90314,0.083267},
+        {0.22243,0.90724,0.083619},
+        {0.23129,0.91122,0.083917},
+        {0.24192,0.91509,0.084156},
+        {0.25398,0.91886,0.084342},
+        {0.26714,0.92253,0.084483},
+        {0.28122,0.92611,0.084587},
+        {0.29605,0.92959,0.084656},
+        {0.31138,0.93299,0.084696},
+        {0.32707,0.93632,0.08471},
+        {0.34303,0.93956,0.084701},
+        {0.35913,0.94274,0.084672},
+        {0.37535,0.94584,0.084623},
+        {0.39181,0.94887,0.084553},
+        {0.40832,0.95183,0.084465},
+        {0.42483,0.95473,0.084363},
+        {0.4413,0.95756,0.084247},
+        {0.45785,0.96033,0.084113},
+        {0.47443,0.96303,0.083964},
+        {0.49093,0.96567,0.083803},
+        {0.50737,0.96826,0.083635},
+        {0.52388,0.97077,0.083456},
+        {0.54033,0.97323,0.083278},
+        {0.55668,0.97564,0.083106},
+        {0.57311,0.97798,0.082937},
+        {0.58945,0.98026,0.082777},
+        {0.60571,0.98249,0.082624},
+        {0.62205,0.98465,0.082472},
+        {0.63831,0.98675,0.082325},
+        {0.6545,0.9888,0.08218},
+        {0.67074,0.99078,0.082035},
+        {0.68689,0.99272,0.081896},
+        {0.70305,0.99458,0.081762},
+        {0.71919,0.99639,0.081638},
+        {0.73525,0.99815,0.081527},
+        {0.75139,0.99984,0.081428},
+        {0.76742,1,0.081347},
+        {0.78349,1,0.081282},
+        {0.79956,1,0.081236},
+        {0.81555,1,0.08121},
+        {0.83159,1,0.081204},
+        {0.84754,1,0.081223}
+    },
+    {
+        {0,0,0},
+        {0.0055606,0.0055631,0.0055625},
+        {0.011212,0.011219,0.011217},
+        {0.016877,0.016885,0.016883},
+        {0.022438,0.022448,0.022445},
+        {0.027998,0.028011,0.028008},
+        {0.03354,0.033554,0.033551},
+        {0.039316,0.039333,0.039329},
+        {0.0447,0.044719,0.044714},
+        {0.049695,0.049713,0.049709},
+        {0.054322,0.054343,0.054338},
+        {0.058797,0.058821,0.058815},
+        {0.063041,0.063062,0.063057},
+        {0.066996,0.067019,0.067014},
+        {0.070827,0.070853,0.070846},
+        {0.074487,0.074511,0.074505},
+        {0.077967,0.077992,0.077986},
+        {0.081449,0.081477,0.08147},
+        {0.084728,0.084752,0.084746},
+        {0.087913,0.087939,0.087933},
+        {0.091003,0.091031,0.091024},
+        {0.094004,0.094034,0.094027},
+        {0.096981,0.097012,0.097005},
+        {0.10004,0.10007,0.10006},
+        {0.10311,0.10314,0.10314},
+        {0.10618,0.10621,0.1062},
+        {0.10924,0.10928,0.10927},
+        {0.11232,0.11235,0.11234},
+        {0.11538,0.11541,0.1154},
+        {0.11852,0.11855,0.11854},
+        {0.12157,0.1216,0.12159},
+        {0.12471,0.12474,0.12473},
+        {0.12787,0.1279,0.12789},
+        {0.13102,0.13105,0.13105},
+        {0.13418,0.13421,0.1342},
+        {0.13734,0.13738,0.13737},
+        {0.14051,0.14055,0.14054},
+        {0.1437,0.14373,0.14372},
+        {0.14687,0.14691,0.1469},
+        {0.15011,0.15015,0.15014},
+        {0.15329,0.15333,0.15332},
+        {0.15656,0.15659,0.15659},
+        {0.15975,0.15979,0.15978},
+        {0.16304,0.16308,0.16307},
+        {0.16628,0.16632,0.16631},
+        {0.16957,0.16961,0.1696},
+        {0.17281,0.17286,0.17285},
+        {0.17608,0.17612,0.17611},
+        {0.1794,0.17944,0.17943},
+        {0.18269,0.18273,0.18272},
+        {0.18604,0.18608,0.18607},
+        {0.18934,0.18939,0.18938},
+        {0.19267,0.19272,0.19271},
+        {0.19602,0.19607,0.19606},
+        {0.19934,0.19939,0.19938},
+        {0.20271,0.20276,0.20275},
+        {0.20611,0.20616,0.20615},
+        {0.20946,0.20951,0.2095},
+        {0.21284,0.21289,0.21288},
+        {0.21626,0.21632,0.2163},
+        {0.21965,0.2197,0.21969},
+        {0.22307,0.22312,0.22311},
+        {0.22649,0.22654,0.22653},
+        {0.22988,0.22994,0.22992},
+        {0.23332,0.23337,0.23336},
+        {0.2368,0.23685,0.23684},
+        {0.24022,0.24027,0.24026},
+        {0.24368,0.24373,0.24372},
+        {0.24716,0.24722,0.2472},
+        {0.25063,0.25069,0.25067},
+        {0.25412,0.25418,0.25417},
+        {0.2576,0.25766,0.25765},
+        {0.26111,0.26117,0.26115},
+        {0.26461,0.26467,0.26465},
+        {0.26812,0.26818,0.26817},
+        {0.27164,0.2717,0.27168},
+        {0.27518,0.27525,0.27523},
+        {0.27872,0.27879,0.27877},
+        {0.28227,0.28234,0.28232},
+        {0.2858,0.28587,0.28585},
+        {0.28938,0.28945,0.28943},
+        {0.29294,0.293,0.29298},
+        {0.29652,0.29659,0.29657},
+        {0.30009,0.30016,0.30014},
+        {0.30368,0.30375,0.30373},
+        {0.30728,0.30734,0.30733},
+        {0.3109,0.31096,0.31095},
+        {0.31449,0.31456,0.31454},
+        {0.31811,0.31819,0.31817},
+        {0.32173,0.32181,0.32179},
+        {0.32536,0.32543,0.32542},
+        {0.32902,0.32909,0.32907},
+        {0.33267,0.33274,0.33272},
+        {0.3363,0.33638,0.33636},
+        {0.33997,0.34005,0.34003},
+        {0.34363,0.3437,0.34369},
+        {0.34731,0.34739,0.34737},
+        {0.35099,0.35107,0.35105},
+        {0.35468,0.35476,0.35474},
+        {0.35836,0.35844,0.35842},
+        {0.36207,0.36214,0.36212},
+        {0.36577,0.36585,0.36583},
+        {0.36948,0.36956,0.36954},
+        {0.37319,0.37328,0.37326},
+        {0.37693,0.37701,0.37699},
+        {0.38066,0.38074,0.38072},
+        {0.38439,0.38447,0.38445},
+        {0.38814,0.38822,0.3882},
+        {0.39189,0.39197,0.39195},
+        {0.39565,0.39574,0.39572},
+        {0.3994,0.39949,0.39946},
+        {0.40318,0.40327,0.40325},
+        {0.40695,0.40704,0.40702},
+        {0.41074,0.41083,0.41081},
+        {0.41452,0.41461,0.41459},
+        {0.41831,0.4184,0.41838},
+        {0.42211,0.4222,0.42218},
+        {0.42592,0.42601,0.42599},
+        {0.42974,0.42983,0.42981},
+        {0.43355,0.43364,0.43362},
+        {0.43739,0.43748,0.43746},
+        {0.44121,0.44131,0.44128},
+        {0.44505,0.44515,0.44512},
+        {0.4489,0.449,0.44897},
+        {0.45275,0.45284,0.45282},
+        {0.45659,0.45669,0.45667},
+        {0.46045,0.46055,0.46052},
+        {0.46433,0.46443,0.46441},
+        {0.46819,0.46829,0.46826},
+        {0.47208,0.47218,0.47215},
+        {0.47596,0.47606,0.47603},
+        {0.47985,0.47995,0.47992},
+        {0.48373,0.48383,0.48381},
+        {0.48764,0.48775,0.48772},
+        {0.49155,0.49165,0.49163},
+        {0.49545,0.49556,0.49553},
+        {0.49936,0.49947,0.49944},
+        {0.50329,0.50339,0.50337},
+        {0.50722,0.50733,0.5073},
+        {0.51115,0.51126,0.51123},
+        {0.51509,0.5152,0.51517},
+        {0.51904,0.51915,0.51912},
+        {0.52299,0.5231,0.52307},
+        {0.52695,0.52706,0.52703},
+        {0.5309,0.53101,0.53099},
+        {0.53487,0.53498,0.53495},
+        {0.53884,0.53895,0.53893},
+        {0.54282,0.54293,0.5429},
+        {0.5468,0.54691,0.54688},
+        {0.55078,0.5509,0.55087},
+        {0.55478,0.55489,0.55486},
+        {0.55877,0.55888,0.55886},
+        {0.56278,0.5629,0.56287},
+        {0.56679,0.56691,0.56688},
+        {0.57079,0.57091,0.57088},
+        {0.57481,0.57493,0.5749},
+        {0.57884,0.57896,0.57893},
+        {0.58286,0.58298,0.58295},
+        {0.5869,0.58702,0.58699},
+        {0.59094,0.59106,0.59103},
+        {0.59498,0.5951,0.59507},
+        {0.59903,0.59916,0.59913},
+        {0.60309,0.60321,0.60318},
+        {0.60715,0.60728,0.60724},
+        {0.61121,0.61134,0.61131},
+        {0.61527,0.6154,0.61537},
+        {0.61936,0.61948,0.61945},
+        {0.62343,0.62356,0.62353},
+        {0.62751,0.62764,0.62761},
+        {0.6316,0.63173,0.6317},
+        {0.63569,0.63583,0.63579},
+        {0.6398,0.63993,0.63989},
+        {0.64389,0.64402,0.64399},
+        {0.648,0.64813,0.6481},
+        {0.65212,0.65225,0.65222},
+        {0.65624,0.65637,0.65634},
+        {0.66035,0.66049,0.66045},
+        {0.66448,0.66461,0.66458},
+        {0.66862,0.66875,0.66872},
+        {0.67275,0.67289,0.67286},
+        {0.6769,0.67703,0.677},
+        {0.68103,0.68117,0.68114},
+        {0.68519,0.68533,0.6853},
+        {0.68935,0.68949,0.68945},
+        {0.6935,0.69364,0.69361},
+        {0.69766,0.69781,0.69777},
+        {0.70183,0.70197,0.70194},
+        {0.70601,0.70616,0.70612},
+        {0.71019,0.71033,0.7103},
+        {0.71437,0.71451,0.71448},
+        {0.71855,0.7187,0.71867},
+        {0.72274,0.72289,0.72286},
+        {0.72694,0.72709,0.72706},
+        {0.73114,0.73129,0.73126},
+        {0.73535,0.7355,0.73546},
+        {0.73957,0.73972,0.73968},
+        {0.74378,0.74393,0.74389},
+        {0.748,0.74815,0.74811},
+        {0.75222,0.75237,0.75233},
+        {0.75644,0.7566,0.75656},
+        {0.76068,0.76083,0.76079},
+        {0.76492,0.76507,0.76503},
+        {0.76915,0.76931,0.76927},
+        {0.7734,0.77355,0.77351},
+        {0.77765,0.77781,0.77777},
+        {0.78191,0.78206,0.78202},
+        {0.78616,0.78632,0.78628},
+        {0.79042,0.79058,0.79054},
+        {0.79469,0.79485,0.79481},
+        {0.79896,0.79913,0.79909},
+        {0.80323,0.8034,0.80336},
+        {0.80752,0.80768,0.80764},
+        {0.8118,0.81196,0.81192},
+        {0.81609,0.81626,0.81621},
+        {0.82038,0.82054,0.8205},
+        {0.82467,0.82484,0.8248},
+        {0.82898,0.82915,0.82911},
+        {0.83328,0.83345,0.83341},
+        {0.83759,0.83776,0.83772},
+        {0.84191,0.84208,0.84204},
+        {0.84622,0.84639,0.84635},
+        {0.85054,0.85071,0.85067},
+        {0.85487,0.85504,0.855},
+        {0.8592,0.85937,0.85933},
+        {0.86354,0.86371,0.86367},
+        {0.86787,0.86805,0.86801},
+        {0.87222,0.87239,0.87235},
+        {0.87656,0.87673,0.87669},
+        {0.88091,0.88109,0.88104},
+        {0.88527,0.88544,0.8854},
+        {0.88962,0.8898,0.88976},
+        {0.89399,0.89417,0.89412},
+        {0.89835,0.89853,0.89849},
+        {0.90272,0.90291,0.90286},
+        {0.9071,0.90728,0.90724},
+        {0.91148,0.91166,0.91161},
+        {0.91585,0.91604,0.91599},
+        {0.92024,0.92043,0.92038},
+        {0.92463,0.92482,0.92477},
+        {0.92903,0.92921,0.92917},
+        {0.93342,0.93361,0.93356},
+        {0.93783,0.93802,0.93797},
+        {0.94224,0.94243,0.94238},
+        {0.94664,0.94683,0.94679},
+        {0.95106,0.95125,0.9512},
+        {0.95548,0.95567,0.95562},
+        {0.9599,0.96009,0.96004},
+        {0.96432,0.96451,0.96446},
+        {0.96875,0.96894,0.9689},
+        {0.97318,0.97338,0.97333},
+        {0.97762,0.97781,0.97777},
+        {0.98206,0.98226,0.98221},
+        {0.98651,0.9867,0.98666},
+        {0.99095,0.99115,0.9911},
+        {0.9954,0.9956,0.99555},
+        {0.99986,1,1}
+    },
+    {
+        {0.066001,0.066024,0.066019},
+        {0.080835,0.066624,0.064683},
+        {0.093644,0.067235,0.063358},
+        {0.10501,0.067862,0.061943},
+        {0.11533,0.068524,0.060589},
+        {0.12493,0.06913,0.059252},
+        {0.13446,0.069402,0.057766},
+        {0.14389,0.069337,0.05652},
+        {0.15329,0.068912,0.055114},
+        {0.16265,0.068217,0.053762},
+        {0.17186,0.067393,0.052418},
+        {0.18101,0.066415,0.051087},
+        {0.19008,0.065312,0.049777},
+        {0.19905,0.064056,0.04839},
+        {0.208,0.06267,0.047034},
+        {0.21686,0.060979,0.045586},
+        {0.22565,0.059301,0.04424},
+        {0.2344,0.057256,0.042784},
+        {0.24306,0.055098,0.041497},
+        {0.2517,0.05272,0.040051},
+        {0.26025,0.050192,0.038638},
+        {0.26877,0.047379,0.037249},
+        {0.27721,0.044339,0.035898},
+        {0.28558,0.041067,0.034375},
+        {0.2939,0.0375,0.03304},
+        {0.30215,0.033602,0.031743},
+        {0.31036,0.029855,0.030482},
+        {0.31847,0.026015,0.029246},
+        {0.32649,0.022146,0.028041},
+        {0.33446,0.018274,0.026868},
+        {0.34231,0.014418,0.025725},
+        {0.35006,0.010378,0.024615},
+        {0.35772,0.0066727,0.023538},
+        {0.36524,0.0030611,0.022497},
+        {0.37265,0,0.021492},
+        {0.37993,0,0.020527},
+        {0.38704,0,0.019604},
+        {0.39401,0,0.018725},
+        {0.40079,0,0.017895},
+        {0.40735,0,0.017114},
+        {0.41371,0,0.016389},
+        {0.41991,0,0.01571},
+        {0.42607,0,0.015054},
+        {0.43225,0,0.014413},
+        {0.43842,0,0.013785},
+        {0.44461,0,0.013163},
+        {0.4508,0,0.01258},
+        {0.45699,0,0.012015},
+        {0.46319,0,0.011343},
+        {0.46943,0,0.01065},
+        {0.47565,0,0.010097},
+        {0.48187,0,0.0095904},
+        {0.48811,0,0.0090697},
+        {0.49436,0,0.0085559},
+        {0.5006,0,0.0080597},
+        {0.50686,0,0.0075745},
+        {0.51313,0,0.0071},
+        {0.5194,0,0.0066376},
+        {0.52568,0,0.0061855},
+        {0.53196,0,0.0057427},
+        {0.53826,0,0.0053086},
+        {0.54455,0,0.0048845},
+        {0.55086,0,0.0044712},
+        {0.55718,0,0.004067},
+        {0.5635,0,0.0036703},
+        {0.56981,0,0.003281},
+        {0.57615,0,0.0028993},
+        {0.58248,0,0.002527},
+        {0.58883,0,0.0021643},
+        {0.5952,0,0.0018102},
+        {0.60158,0,0.0014648},
+        {0.60799,0,0.0011281},
+        {0.6144,0,0.0008024},
+        {0.62084,0,0.00048773},
+        {0.62729,0,0.00018111},
+        {0.63377,0,0},
+        {0.64026,0,0},
+        {0.64676,0,0},
+        {0.65328,0,0},
+        {0.65983,0,0},
+        {0.66638,0,0},
+        {0.67297,0,0},
+        {0.67955,0,0},
+        {0.68617,0,0},
+        {0.6928,0,0},
+        {0.69944,0,0},
+        {0.70611,0,0},
+        {0.71279,0,0},
+        {0.7195,0,0},
+        {0.72621,0,0},
+        {0.73295,0,0},
+        {0.7397,0,0},
+        {0.74647,0,0},
+        {0.75325,0,0},
+        {0.76005,0,0},
+        {0.76685,0,0},
+        {0.77364,0,0},
+        {0.78042,0,0},
+        {0.78719,0,0},
+        {0.79394,0,0},
+        {0.80067,0,0},
+        {0.8074,0,0},
+        {0.8141,0,0},
+        {0.8208,0,0},
+        {0.82748,0,0},
+        {0.83414,0,0},
+        {0.84079,0,0},
+        {0.84742,0,0},
+        {0.85404,0,0},
+        {0.86065,0,0},
+        {0.86723,0,0},
+        {0.8738,0,0},
+        {0.88036,0,0},
+        {0.8869,0,0},
+        {0.89342,0,0},
+        {0.89993,0,0},
+        {0.90642,0,0},
+        {0.91289,0,0},
+        {0.91935,0,0},
+        {0.92579,0.0041866,0},
+        {0.93221,0.0088411,0},
+        {0.93858,0.014235,0},
+        {0.94484,0.020592,0},
+        {0.9509,0.028663,0},
+        {0.95676,0.038768,0},
+        {0.96242,0.049864,0},
+        {0.96787,0.061034,0},
+        {0.97311,0.072263,0},
+        {0.97815,0.083447,0},
+        {0.983,0.094617,0},
+        {0.98764,0.10571,0},
+        {0.99205,0.11685,0},
+        {0.99626,0.12797,0},
+        {1,0.139,0},
+        {1,0.15006,0},
+        {1,0.16105,0},
+        {1,0.17204,0},
+        {1,0.18303,0},
+        {1,0.19402,0},
+        {1,0.20493,0},
+        {1,0.21586,0},
+        {1,0.22677,0},
+        {1,0.23768,0},
+        {1,0.24857,0},
+        {1,0.25943,0},
+        {1,0.27027,0},
+        {1,0.28108,0},
+        {1,0.29193,0},
+        {1,0.30267,0},
+        {1,0.31323,0},
+        {1,0.32352,0},
+        {1,0.33356,0},
+        {1,0.34337,0},
+        {1,0.35298,0},
+        {1,0.3624,0},
+        {1,0.37164,0.00061699},
+        {1,0.38075,0.0021825},
+        {1,0.38968,0.0037567},
+        {1,0.3985,0.0053395},
+        {1,0.40718,0.0069314},
+        {1,0.41575,0.0085283},
+        {1,0.4242,0.010112},
+        {1,0.43257,0.011953},
+        {1,0.44081,0.013525},
+        {1,0.44899,0.015122},
+        {1,0.45706,0.016714},
+        {1,0.46506,0.018299},
+        {1,0.47298,0.019872},
+        {1,0.48083,0.021427},
+        {1,0.48862,0.022968},
+        {1,0.49633,0.024493},
+        {1,0.504,0.026001},
+        {1,0.51159,0.027485},
+        {1,0.51914,0.028939},
+        {1,0.52664,0.030367},
+        {1,0.53406,0.03178},
+        {1,0.54143,0.033208},
+        {1,0.54875,0.034768},
+        {1,0.55598,0.036315},
+        {1,0.56318,0.037812},
+        {1,0.5703,0.039323},
+        {1,0.57737,0.040851},
+        {1,0.58439,0.04235},
+        {1,0.59136,0.043767},
+        {1,0.59828,0.045295},
+        {1,0.60516,0.046771},
+        {1,0.61199,0.048174},
+        {1,0.61878,0.049666},
+        {1,0.62552,0.051026},
+        {1,0.63222,0.0524},
+        {1,0.63889,0.053786},
+        {1,0.64551,0.055176},
+        {1,0.65211,0.056589},
+        {1,0.65866,0.057815},
+        {1,0.66518,0.05925},
+        {1,0.67167,0.060511},
+        {1,0.67814,0.061743},
+        {1,0.68456,0.063098},
+        {1,0.69095,0.064301},
+        {1,0.69731,0.065521},
+        {1,0.70365,0.066739},
+        {1,0.70997,0.068288},
+        {1,0.71622,0.071897},
+        {1,0.72231,0.079934},
+        {1,0.72829,0.091953},
+        {1,0.73416,0.10627},
+        {1,0.73994,0.12182},
+        {1,0.74564,0.13819},
+        {1,0.75128,0.1548},
+        {1,0.75686,0.17158},
+        {1,0.76238,0.18858},
+        {1,0.76786,0.20562},
+        {1,0.7733,0.22256},
+        {1,0.77871,0.23945},
+        {1,0.7841,0.2564},
+        {1,0.78945,0.27335},
+        {1,0.79478,0.29018},
+        {1,0.80008,0.30712},
+        {1,0.80537,0.32404},
+        {1,0.81064,0.34096},
+        {1,0.81591,0.35795},
+        {1,0.82116,0.37487},
+        {1,0.8264,0.39194},
+        {1,0.83163,0.40902},
+        {1,0.83685,0.42615},
+        {1,0.84207,0.44336},
+        {1,0.84727,0.4606},
+        {1,0.85249,0.47795},
+        {1,0.85769,0.49533},
+        {1,0.8629,0.51282},
+        {1,0.86811,0.53035},
+        {1,0.87331,0.54803},
+        {1,0.87852,0.56571},
+        {1,0.88373,0.58356},
+        {1,0.88894,0.60144},
+        {1,0.89415,0.61947},
+        {1,0.89937,0.63753},
+        {1,0.9046,0.65574},
+        {1,0.90983,0.67401},
+        {1,0.91506,0.69239},
+        {1,0.9203,0.71087},
+        {1,0.92556,0.72942},
+        {1,0.93081,0.74812},
+        {1,0.93608,0.76684},
+        {1,0.94135,0.78577},
+        {1,0.94664,0.80471},
+        {1,0.95193,0.82381},
+        {1,0.95723,0.84299},
+        {1,0.96255,0.86225},
+        {1,0.96787,0.88166},
+        {1,0.97321,0.90108},
+        {1,0.97856,0.92074},
+        {1,0.98392,0.94042},
+        {1,0.98928,0.96017},
+        {1,0.99466,0.98008},
+        {0.99986,1,1}
+    },
+    {
+        {0.066001,0.066024,0.066019},
+        {0.07965,0.066744,0.064745},
+        {0.091664,0.06747,0.063475},
+        {0.10228,0.068214,0.06216},
+        {0.112,0.068994,0.060816},
+        {0.12092,0.069706,0.059585},
+        {0.12971,0.070185,0.058154},
+        {0.13843,0.07042,0.05692},
+        {0.14709,0.070382,0.055604},
+        {0.15576,0.07009,0.054295},
+        {0.16433,0.069694,0.052994},
+        {0.17278,0.069179,0.051712},
+        {0.18118,0.068484,0.050432},
+        {0.18954,0.067685,0.049199},
+        {0.1978,0.066788,0.047758},
+        {0.20605,0.065769,0.046454},
+        {0.2142,0.064648,0.045151},
+        {0.2223,0.063428,0.043725},
+        {0.23036,0.062012,0.042429},
+        {0.23838,0.060521,0.04109},
+        {0.24634,0.058898,0.039699},
+        {0.25428,0.057101,0.038324},
+        {0.26215,0.055158,0.036964},
+        {0.26998,0.053082,0.035663},
+        {0.27773,0.050917,0.034117},
+        {0.28544,0.048622,0.032846},
+        {0.29312,0.046013,0.031565},
+        {0.30072,0.043344,0.030323},
+        {0.30827,0.040658,0.029105},
+        {0.31576,0.037722,0.02791},
+        {0.32318,0.034637,0.02674},
+        {0.33052,0.031576,0.025595},
+        {0.33779,0.028628,0.024479},
+        {0.34497,0.025745,0.023396},
+        {0.35205,0.022943,0.022345},
+        {0.35905,0.020248,0.021325},
+        {0.36595,0.017697,0.02034},
+        {0.37272,0.015331,0.01939},
+        {0.37938,0.01319,0.01848},
+        {0.38589,0.01125,0.017611},
+        {0.39225,0.0096476,0.016788},
+        {0.39845,0.0085386,0.016013},
+        {0.40447,0.0079151,0.015288},
+        {0.41036,0.0076915,0.014615},
+        {0.41618,0.0076329,0.013987},
+        {0.42199,0.007602,0.01339},
+        {0.42783,0.0075831,0.012837},
+        {0.43365,0.0075764,0.012347},
+        {0.4395,0.0075827,0.011859},
+        {0.44534,0.0076027,0.011316},
+        {0.4512,0.0076373,0.010796},
+        {0.45705,0.0076872,0.010385},
+        {0.46291,0.0077536,0.010055},
+        {0.46879,0.0078379,0.0097685},
+        {0.47467,0.0079404,0.0095068},
+        {0.48054,0.0080616,0.0092717},
+        {0.48643,0.0082023,0.0090674},
+        {0.49232,0.0083637,0.0088963},
+        {0.49823,0.0085472,0.008759},
+        {0.50414,0.0087542,0.0086553},
+        {0.51004,0.008987,0.0085858},
+        {0.51595,0.0092456,0.0085516},
+        {0.52187,0.0095265,0.0085507},
+        {0.5278,0.0098238,0.0085815},
+        {0.53373,0.010138,0.0086438},
+        {0.53967,0.010498,0.0087375},
+        {0.54563,0.010949,0.0088628},
+        {0.55158,0.011488,0.0090195},
+        {0.55753,0.012012,0.0092082},
+        {0.56349,0.012487,0.0094284},
+        {0.56945,0.012988,0.0096743},
+        {0.57543,0.013545,0.009933},
+        {0.5814,0.014124,0.010192},
+        {0.5874,0.014709,0.010451},
+        {0.59341,0.015309,0.010717},
+        {0.59942,0.015921,0.010993},
+        {0.60544,0.016546,0.011263},
+        {0.61149,0.017183,0.011511},
+        {0.61754,0.017832,0.011726},
+        {0.62361,0.018494,0.011906},
+        {0.62967,0.019169,0.012055},
+        {0.63576,0.019858,0.012179},
+        {0.64186,0.020559,0.01228},
+        {0.64796,0.021273,0.012363},
+        {0.65409,0.022,0.012427},
+        {0.66022,0.022741,0.012473},
+        {0.66635,0.023496,0.012501},
+        {0.67251,0.024264,0.012512},
+        {0.67867,0.025046,0.012503},
+        {0.68485,0.025842,0.012477},
+        {0.69103,0.026652,0.012431},
+        {0.69722,0.027476,0.012369},
+        {0.70343,0.028316,0.012312},
+        {0.70965,0.02917,0.012261},
+        {0.71588,0.030041,0.012218},
+        {0.7221,0.030928,0.012182},
+        {0.72835,0.031827,0.012155},
+        {0.73461,0.032755,0.012137},
+        {0.74086,0.033657,0.012129},
+        {0.74714,0.034746,0.01213},
+        {0.7534,0.035909,0.012143},
+        {0.75965,0.037152,0.012168},
+        {0.76588,0.038639,0.012207},
+        {0.77207,0.040359,0.012259},
+        {0.77825,0.042283,0.012323},
+        {0.7844,0.044355,0.0124},
+        {0.79052,0.046616,0.012491},
+        {0.79662,0.049121,0.012597},
+        {0.80269,0.051607,0.01272},
+        {0.80874,0.054357,0.012862},
+        {0.81476,0.057256,0.013025},
+        {0.82076,0.060328,0.013209},
+        {0.82673,0.063454,0.013414},
+        {0.83267,0.066671,0.01364},
+        {0.83859,0.070023,0.013884},
+        {0.84448,0.073512,0.014147},
+        {0.85034,0.076937,0.014432},
+        {0.85618,0.080598,0.014739},
+        {0.86199,0.084349,0.015072},
+        {0.86776,0.088098,0.015429},
+        {0.87351,0.09196,0.015811},
+        {0.87924,0.095821,0.016218},
+        {0.88494,0.099784,0.016653},
+        {0.89061,0.10383,0.017114},
+        {0.89625,0.10787,0.017605},
+        {0.90186,0.11205,0.018127},
+        {0.90744,0.11624,0.018679},
+        {0.91299,0.12043,0.019262},
+        {0.91846,0.12485,0.019871},
+        {0.92381,0.12964,0.020493},
+        {0.92898,0.13485,0.021122},
+        {0.93399,0.14044,0.02176},
+        {0.93881,0.14642,0.022407},
+        {0.94345,0.15278,0.023063},
+        {0.94791,0.15946,0.023731},
+        {0.95218,0.16642,0.024411},
+        {0.95628,0.17361,0.025105},
+        {0.9602,0.18101,0.025814},
+        {0.96394,0.18866,0.026541},
+        {0.9675,0.19646,0.027287},
+        {0.97086,0.20443,0.028053},
+        {0.97403,0.21254,0.028843},
+        {0.97702,0.22083,0.029658},
+        {0.97982,0.22918,0.0305},
+        {0.98243,0.23769,0.031373},
+        {0.98485,0.24624,0.032279},
+        {0.98708,0.25493,0.03322},
+        {0.98911,0.26367,0.034197},
+        {0.99095,0.27247,0.035441},
+        {0.99259,0.28137,0.036475},
+        {0.99402,0.29032,0.0376},
+        {0.99526,0.29935,0.038765},
+        {0.99629,0.3084,0.039989},
+        {0.99713,0.31749,0.041278},
+        {0.99777,0.32662,0.042522},
+        {0.9982,0.3358,0.043828},
+        {0.99844,0.34498,0.045261},
+        {0.99859,0.35407,0.04666},
+        {0.99869,0.36301,0.048013},
+        {0.99878,0.37178,0.049508},
+        {0.99884,0.38043,0.050843},
+        {0.99888,0.38894,0.052219},
+        {0.99889,0.39731,0.05362},
+        {0.99887,0.40558,0.055042},
+        {0.99884,0.41373,0.056502},
+        {0.99878,0.42178,0.057786},
+        {0.99869,0.42975,0.059296},
+        {0.99857,0.43763,0.060625},
+        {0.99844,0.4454,0.061996},
+        {0.99827,0.45312,0.063411},
+        {0.99808,0.46074,0.064752},
+        {0.99787,0.46831,0.066112},
+        {0.99763,0.47581,0.067489},
+        {0.99736,0.48323,0.068891},
+        {0.99707,0.49061,0.070164},
+        {0.99675,0.49792,0.071543},
+        {0.9964,0.50517,0.072849},
+        {0.99603,0.51237,0.074177},
+        {0.99563,0.51953,0.075448},
+        {0.9952,0.52664,0.076731},
+        {0.99474,0.53369,0.078024},
+        {0.99426,0.54072,0.079325},
+        {0.99375,0.54769,0.08063},
+        {0.99322,0.55463,0.081958},
+        {0.99265,0.56153,0.083158},
+        {0.99204,0.5684,0.084524},
+        {0.99138,0.57524,0.085856},
+        {0.99067,0.58206,0.087485},
+        {0.98991,0.58886,0.089115},
+        {0.98909,0.59566,0.090908},
+        {0.98821,0.60242,0.092755},
+        {0.98728,0.60918,0.094848},
+        {0.98629,0.6159,0.096892},
+        {0.98524,0.62262,0.099162},
+        {0.98414,0.62932,0.1015},
+        {0.98297,0.63601,0.10396},
+        {0.98175,0.64268,0.10656},
+        {0.98046,0.64934,0.10919},
+        {0.97912,0.65599,0.11195},
+        {0.97771,0.66262,0.11474},
+        {0.97623,0.66924,0.11771},
+        {0.9747,0.67585,0.12072},
+        {0.9731,0.68244,0.12383},
+        {0.97144,0.68904,0.12703},
+        {0.9697,0.69561,0.13037},
+        {0.96791,0.70217,0.1337},
+        {0.96603,0.70874,0.13715},
+        {0.96409,0.71529,0.14067},
+        {0.96208,0.72182,0.14425},
+        {0.96,0.72836,0.14791},
+        {0.95785,0.73488,0.15162},
+        {0.95563,0.74139,0.15542},
+        {0.95333,0.74791,0.15928},
+        {0.95104,0.75439,0.16306},
+        {0.94892,0.76075,0.16643},
+        {0.94705,0.767,0.16936},
+        {0.9454,0.77315,0.1718},
+        {0.94394,0.7792,0.1739},
+        {0.94268,0.78516,0.17562},
+        {0.94159,0.79104,0.17704},
+        {0.94067,0.79684,0.17816},
+        {0.93991,0.80258,0.17893},
+        {0.93929,0.80825,0.17943},
+        {0.93881,0.81387,0.1797},
+        {0.93845,0.81943,0.17972},
+        {0.9382,0.82494,0.17952},
+        {0.93807,0.83042,0.17911},
+        {0.93806,0.83583,0.17845},
+        {0.93816,0.84121,0.17756},
+        {0.93835,0.84655,0.17643},
+        {0.93863,0.85186,0.17517},
+        {0.93901,0.85713,0.17363},
+        {0.93948,0.86238,0.17189},
+        {0.94002,0.86758,0.16998},
+        {0.94064,0.87277,0.16783},
+        {0.94135,0.87792,0.16542},
+        {0.94214,0.88305,0.16286},
+        {0.94298,0.88816,0.16003},
+        {0.94391,0.89324,0.15697},
+        {0.9449,0.8983,0.15365},
+        {0.94594,0.90334,0.15015},
+        {0.94707,0.90836,0.14627},
+        {0.94825,0.91336,0.14216},
+        {0.94948,0.91834,0.13776},
+        {0.95079,0.92331,0.13295},
+        {0.95212,0.92826,0.12782},
+        {0.95354,0.93319,0.12222},
+        {0.955,0.93811,0.11627},
+        {0.95649,0.94302,0.1098},
+        {0.95807,0.94791,0.10259},
+        {0.95966,0.95279,0.094821},
+        {0.96132,0.95766,0.086007},
+        {0.96302,0.96252,0.076202},
+        {0.96476,0.96736,0.065035},
+        {0.96656,0.97219,0.051675},
+        {0.96837,0.97701,0.035491}
+    },
+    {
+        {0,0,0},
+        {0.00074336,0.0024531,0.0074342},
+        {0.0014922,0.0049243,0.014921},
+        {0.0022238,0.0073388,0.022238},
+        {0.0029727,0.0098191,0.029727},
+        {0.003759,0.01243,0.037588},
+        {0.0044965,0.014837,0.045061},
+        {0.0052171,0.017216,0.052174},
+        {0.0059233,0.019547,0.05928},
+        {0.0066117,0.021819,0.066122},
+        {0.0072841,0.024037,0.07289},
+        {0.0079425,0.026211,0.079443},
+        {0.008587,0.02834,0.085862},
+        {0.0092271,0.03044,0.092265},
+        {0.009844,0.03246,0.098364},
+        {0.010477,0.034486,0.10458},
+        {0.011109,0.036556,0.11078},
+        {0.01171,0.038495,0.11667},
+        {0.012273,0.040403,0.12242},
+        {0.012818,0.042245,0.1279},
+        {0.013348,0.043976,0.13326},
+        {0.013879,0.04566,0.1385},
+        {0.014395,0.047394,0.14358},
+        {0.014889,0.049082,0.14858},
+        {0.015355,0.050605,0.15335},
+        {0.015827,0.052141,0.15801},
+        {0.016294,0.053656,0.16261},
+        {0.016752,0.05516,0.16717},
+        {0.017191,0.056648,0.17153},
+        {0.017621,0.057987,0.17584},
+        {0.018044,0.059476,0.18012},
+        {0.018452,0.060774,0.18421},
+        {0.018859,0.062143,0.1883},
+        {0.019258,0.063465,0.19229},
+        {0.019638,0.064737,0.19618},
+        {0.019991,0.066008,0.19999},
+        {0.020369,0.06727,0.20383},
+        {0.020743,0.068517,0.20757},
+        {0.021108,0.069731,0.21123},
+        {0.021466,0.07089,0.21479},
+        {0.021817,0.072042,0.21833},
+        {0.022172,0.073262,0.22184},
+        {0.022518,0.074345,0.22528},
+        {0.022855,0.075456,0.22864},
+        {0.023186,0.076553,0.23196},
+        {0.023512,0.077642,0.23526},
+        {0.02384,0.078716,0.2385},
+        {0.024178,0.079786,0.24179},
+        {0.024507,0.080865,0.24506},
+        {0.024831,0.08197,0.24832},
+        {0.025156,0.08299,0.25156},
+        {0.02548,0.084106,0.2548},
+        {0.025801,0.085132,0.25798},
+        {0.026127,0.086192,0.26127},
+        {0.026456,0.087333,0.26456},
+        {0.026783,0.088377,0.26781},
+        {0.027109,0.089458,0.27108},
+        {0.027438,0.090542,0.27438},
+        {0.027766,0.091648,0.27766},
+        {0.02809,0.092669,0.28088},
+        {0.028421,0.093789,0.2842},
+        {0.028753,0.094903,0.28753},
+        {0.029077,0.095942,0.29078},
+        {0.029408,0.097031,0.29407},
+        {0.029741,0.09817,0.29742},
+        {0.030072,0.099229,0.30072},
+        {0.030403,0.10033,0.30402},
+        {0.030735,0.10143,0.30733},
+        {0.031072,0.10254,0.31072},
+        {0.031403,0.10364,0.31403},
+        {0.031734,0.1047,0.31734},
+        {0.032072,0.10585,0.32074},
+        {0.032408,0.10696,0.32408},
+        {0.032743,0.10802,0.32739},
+        {0.033082,0.10918,0.33077},
+        {0.033414,0.11028,0.33418},
+        {0.033742,0.11138,0.33753},
+        {0.034077,0.1125,0.3409},
+        {0.03442,0.11362,0.34424},
+        {0.034765,0.11469,0.34763},
+        {0.035114,0.11586,0.35104},
+        {0.035456,0.11695,0.35445},
+        {0.035791,0.1181,0.35784},
+        {0.036121,0.1192,0.36122},
+        {0.036456,0.12031,0.36459},
+        {0.036796,0.12143,0.36797},
+        {0.037139,0.12255,0.37137},
+        {0.037483,0.12369,0.37481},
+        {0.037828,0.12482,0.37826},
+        {0.038169,0.12598,0.38168},
+        {0.038511,0.12707,0.3851},
+        {0.038856,0.12823,0.38856},
+        {0.0392,0.12935,0.392},
+        {0.039546,0.13052,0.39546},
+        {0.03989,0.13163,0.39889},
+        {0.040235,0.13277,0.40233},
+        {0.040581,0.13392,0.40582},
+        {0.040922,0.13506,0.40923},
+        {0.041266,0.13617,0.41269},
+        {0.041619,0.13735,0.4162},
+        {0.04197,0.13849,0.41964},
+        {0.042315,0.1396,0.42308},
+        {0.042655,0.14079,0.42658},
+        {0.042998,0.14192,0.43006},
+        {0.043353,0.14307,0.43353},
+        {0.043707,0.14422,0.43705},
+        {0.044054,0.1454,0.44054},
+        {0.044401,0.14652,0.44404},
+        {0.044755,0.14769,0.44752},
+        {0.045109,0.14883,0.45103},
+        {0.045452,0.15001,0.45455},
+        {0.045792,0.15115,0.45803},
+        {0.046147,0.15231,0.46154},
+        {0.046509,0.15347,0.46506},
+        {0.046871,0.15464,0.4686},
+        {0.047221,0.15582,0.47216},
+        {0.047563,0.15696,0.47568},
+        {0.047916,0.15815,0.47921},
+        {0.048273,0.1593,0.48272},
+        {0.048631,0.16046,0.48628},
+        {0.048997,0.16167,0.48986},
+        {0.049352,0.16283,0.49342},
+        {0.049698,0.16401,0.49696},
+        {0.050046,0.16514,0.50048},
+        {0.050404,0.16634,0.50406},
+        {0.050762,0.16751,0.50763},
+        {0.051121,0.1687,0.5112},
+        {0.051479,0.16988,0.51479},
+        {0.051833,0.17105,0.51834},
+        {0.05219,0.17223,0.5219},
+        {0.052551,0.17342,0.52551},
+        {0.052909,0.17461,0.5291},
+        {0.053266,0.17577,0.53267},
+        {0.053628,0.17697,0.53628},
+        {0.05399,0.17818,0.53989},
+        {0.054349,0.17935,0.54349},
+        {0.054708,0.18053,0.54707},
+        {0.055067,0.18172,0.55067},
+        {0.055429,0.18292,0.55429},
+        {0.055793,0.18412,0.55793},
+        {0.056155,0.18533,0.56157},
+        {0.056521,0.18651,0.5652},
+        {0.056888,0.18772,0.56884},
+        {0.057244,0.18891,0.57245},
+        {0.0576,0.1901,0.57607},
+        {0.057967,0.1913,0.57969},
+        {0.058336,0.1925,0.58335},
+        {0.058702,0.19372,0.58701},
+        {0.059067,0.19492,0.59066},
+        {0.059436,0.19613,0.59432},
+        {0.059804,0.19733,0.59797},
+        {0.060167,0.19853,0.60161},
+        {0.060527,0.19973,0.60525},
+        {0.060887,0.20094,0.60892},
+        {0.061253,0.20216,0.61259},
+        {0.061628,0.20338,0.6163},
+        {0.062,0.2046,0.61999},
+        {0.06237,0.20581,0.62368},
+        {0.062743,0.20703,0.62736},
+        {0.063109,0.20824,0.63104},
+        {0.063471,0.20946,0.63472},
+        {0.06384,0.21068,0.63842},
+        {0.064212,0.21191,0.64213},
+        {0.064582,0.2131,0.64581},
+        {0.064951,0.21435,0.64951},
+        {0.065324,0.21557,0.65323},
+        {0.065695,0.21679,0.65696},
+        {0.066066,0.21802,0.66066},
+        {0.066438,0.21924,0.66438},
+        {0.066811,0.22049,0.66812},
+        {0.067184,0.22169,0.67183},
+        {0.067556,0.22294,0.67556},
+        {0.067927,0.22415,0.67926},
+        {0.068301,0.2254,0.68302},
+        {0.068677,0.22664,0.68678},
+        {0.069052,0.22788,0.69052},
+        {0.069427,0.2291,0.69424},
+        {0.0698,0.23033,0.69799},
+        {0.07017,0.23158,0.70175},
+        {0.070545,0.23281,0.70549},
+        {0.070927,0.23405,0.70927},
+        {0.07131,0.23531,0.71304},
+        {0.071685,0.23655,0.71681},
+        {0.072052,0.23779,0.72056},
+        {0.072426,0.23902,0.72432},
+        {0.072809,0.24026,0.72809},
+        {0.073193,0.24153,0.73188},
+        {0.073573,0.24276,0.73565},
+        {0.073946,0.24401,0.73944},
+        {0.074319,0.24526,0.74322},
+        {0.0747,0.24651,0.74702},
+        {0.075082,0.24778,0.75083},
+        {0.075461,0.24902,0.75462},
+        {0.075841,0.25026,0.75841},
+        {0.076222,0.25154,0.76222},
+        {0.076602,0.25279,0.76602},
+        {0.076984,0.25405,0.76985},
+        {0.077365,0.25531,0.77365},
+        {0.077744,0.25656,0.77745},
+        {0.078128,0.25781,0.78128},
+        {0.078511,0.25909,0.78511},
+        {0.078893,0.26035,0.78893},
+        {0.079275,0.26161,0.79275},
+        {0.07966,0.26288,0.7966},
+        {0.080044,0.26414,0.80043},
+        {0.080427,0.26541,0.80427},
+        {0.08081,0.26667,0.80809},
+        {0.081193,0.26794,0.81194},
+        {0.081582,0.26923,0.81583},
+        {0.081967,0.27049,0.81966},
+        {0.082351,0.27175,0.8235},
+        {0.082734,0.27303,0.82736},
+        {0.08312,0.2743,0.83122},
+        {0.08351,0.27558,0.8351},
+        {0.083897,0.27686,0.83896},
+        {0.084288,0.27814,0.84284},
+        {0.084673,0.27941,0.84669},
+        {0.085055,0.28068,0.85055},
+        {0.085441,0.28197,0.85445},
+        {0.085828,0.28325,0.85832},
+        {0.086218,0.28452,0.8622},
+        {0.086607,0.2858,0.86608},
+        {0.087001,0.28709,0.86997},
+        {0.087391,0.28838,0.87388},
+        {0.087778,0.28967,0.87777},
+        {0.088167,0.29095,0.88168},
+        {0.088557,0.29224,0.88557},
+        {0.088947,0.29352,0.88947},
+        {0.089338,0.29481,0.89338},
+        {0.08973,0.29611,0.8973},
+        {0.090121,0.29741,0.90121},
+        {0.090513,0.29869,0.90514},
+        {0.090904,0.29999,0.90904},
+        {0.091296,0.30128,0.91296},
+        {0.09169,0.30257,0.91688},
+        {0.092085,0.30387,0.92081},
+        {0.092476,0.30517,0.92477},
+        {0.092866,0.30647,0.92868},
+        {0.093261,0.30776,0.93261},
+        {0.093659,0.30908,0.93659},
+        {0.094052,0.31037,0.94052},
+        {0.094445,0.31167,0.94445},
+        {0.094842,0.31297,0.9484},
+        {0.095238,0.31428,0.95235},
+        {0.095633,0.31559,0.95632},
+        {0.096025,0.31689,0.96026},
+        {0.096419,0.31819,0.96422},
+        {0.096817,0.3195,0.96819},
+        {0.097216,0.32082,0.97216},
+        {0.097613,0.32212,0.97613},
+        {0.098012,0.32343,0.9801},
+        {0.098407,0.32474,0.98406},
+        {0.098802,0.32605,0.98803},
+        {0.099201,0.32737,0.99202},
+        {0.099601,0.32868,0.99601},
+        {0.1,0.33,1}
+    },
+    {
+        {0,0,0},
+        {0,0.0035927,0},
+        {0,0.0071431,1.452e-17},
+        {2.0473e-17,0.010757,3.0748e-17},
+        {8.1864e-21,0.014524,2.5379e-17},
+        {1.7446e-17,0.018105,6.1007e-18},
+        {4.169e-17,0.021687,5.0758e-17},
+        {0,0.025284,2.5867e-17},
+        {6.0593e-17,0.028821,1.8546e-17},
+        {0,0.032444,2.5867e-17},
+        {4.253e-17,0.036221,5.8567e-18},
+        {0,0.039766,1.269e-17},
+        {2.4692e-17,0.043161,2.6355e-17},
+        {1.4341e-16,0.046597,3.7093e-17},
+        {0,0.049768,1.9522e-17},
+        {5.3227e-17,0.052749,4.0997e-17},
+        {1.6012e-18,0.055759,0},
+        {0,0.058542,7.1257e-17},
+        {5.6429e-17,0.061269,3.1236e-17},
+        {6.2098e-17,0.063951,4.783e-17},
+        {1.3454e-16,0.066548,3.026e-17},
+        {1.454e-17,0.069095,2.3427e-17},
+        {0,0.071498,4.6854e-17},
+        {3.2058e-17,0.07387,3.9045e-18},
+        {1.6029e-16,0.076086,1.9522e-17},
+        {1.1606e-16,0.07832,5.271e-17},
+        {6.2194e-17,0.080566,1.3666e-17},
+        {0,0.082735,0},
+        {0,0.084825,0},
+        {0,0.086923,0},
+        {8.7753e-18,0.088913,4.0997e-17},
+        {4.5733e-17,0.090908,0},
+        {5.8543e-17,0.092798,0},
+        {7.9487e-17,0.094766,0},
+        {0,0.096572,0},
+        {0,0.098465,1.9522e-18},
+        {0,0.10025,0},
+        {4.9576e-17,0.10204,0},
+        {1.1817e-16,0.10382,0},
+        {1.1049e-16,0.10552,1.9522e-18},
+        {0,0.10725,0},
+        {0,0.10892,0},
+        {8.1348e-18,0.11059,4.2949e-17},
+        {1.5174e-16,0.11222,1.1713e-17},
+        {4.2384e-06,0.11381,5.6236e-07},
+        {1.619e-05,0.11539,2.1481e-06},
+        {1.6699e-05,0.11698,2.2156e-06},
+        {1.2756e-05,0.11863,1.6925e-06},
+        {9.7295e-06,0.12018,1.2909e-06},
+        {1.3177e-05,0.12176,1.7484e-06},
+        {1.6418e-05,0.12338,2.1783e-06},
+        {1.7338e-05,0.12502,2.3004e-06},
+        {1.6062e-05,0.12662,2.1312e-06},
+        {1.1099e-05,0.12826,1.4726e-06},
+        {8.2989e-06,0.1299,1.1011e-06},
+        {1.4157e-05,0.1315,1.8783e-06},
+        {1.7475e-05,0.13312,2.3186e-06},
+        {1.7885e-05,0.13477,2.373e-06},
+        {1.5761e-05,0.13635,2.0912e-06},
+        {1.1631e-05,0.13803,1.5432e-06},
+        {8.4045e-06,0.13962,1.1151e-06},
+        {1.4146e-05,0.1413,1.8769e-06},
+        {1.7579e-05,0.14293,2.3324e-06},
+        {1.8299e-05,0.14458,2.428e-06},
+        {1.7087e-05,0.14621,2.2671e-06},
+        {1.2461e-05,0.14787,1.6533e-06},
+        {9.2002e-06,0.14954,1.2207e-06},
+        {1.3439e-05,0.15116,1.7831e-06},
+        {1.7166e-05,0.15281,2.2777e-06},
+        {1.8547e-05,0.15448,2.4608e-06},
+        {1.8043e-05,0.15618,2.394e-06},
+        {1.5436e-05,0.15782,2.048e-06},
+        {1.1288e-05,0.15947,1.4977e-06},
+        {9.1088e-06,0.16118,1.2086e-06},
+        {1.463e-05,0.16284,1.9412e-06},
+        {1.7571e-05,0.16452,2.3725e-06},
+        {9.5709e-06,0.16618,2.3585e-06},
+        {0,0.16786,2.12e-06},
+        {0,0.16957,1.7933e-06},
+        {0,0.17123,1.2872e-06},
+        {0,0.17292,1.0023e-06},
+        {0,0.17462,1.66e-06},
+        {0,0.17629,2.0398e-06},
+        {0,0.17804,2.1855e-06},
+        {0,0.1797,2.2541e-06},
+        {0,0.18139,1.9666e-06},
+        {0,0.18309,1.524e-06},
+        {0,0.18482,1.1233e-06},
+        {0,0.18653,1.2478e-06},
+        {0,0.18826,1.8149e-06},
+        {0,0.18994,2.1666e-06},
+        {0,0.19165,2.2543e-06},
+        {0,0.19339,2.1978e-06},
+        {0,0.1951,2.0405e-06},
+        {0,0.19684,1.6279e-06},
+        {0,0.19854,1.1674e-06},
+        {0,0.20025,1.2082e-06},
+        {0,0.20199,1.6696e-06},
+        {0,0.20375,2.0125e-06},
+        {0,0.20547,2.2769e-06},
+        {0,0.20722,2.3292e-06},
+        {0,0.20894,2.1993e-06},
+        {0,0.21069,1.9215e-06},
+        {0,0.21244,1.5648e-06},
+        {0,0.21419,1.1031e-06},
+        {0,0.21594,1.1824e-06},
+        {0,0.21768,1.6796e-06},
+        {0,0.21944,2.0449e-06},
+        {0,0.2212,2.2667e-06},
+        {0,0.22296,2.3344e-06},
+        {0,0.22468,2.2953e-06},
+        {0,0.22648,2.1282e-06},
+        {0,0.22824,1.8455e-06},
+        {0,0.22999,1.3868e-06},
+        {0,0.23177,1.0492e-06},
+        {0,0.23352,1.2152e-06},
+        {0,0.23533,1.6192e-06},
+        {0,0.2371,2.0168e-06},
+        {0,0.23885,2.2741e-06},
+        {0,0.24062,2.3737e-06},
+        {0,0.24241,2.3904e-06},
+        {0,0.24419,2.2583e-06},
+        {0,0.24598,2.0443e-06},
+        {0,0.24779,1.7786e-06},
+        {0,0.24956,1.4126e-06},
+        {0,0.25137,1.0243e-06},
+        {0,0.25316,1.0702e-06},
+        {0,0.25496,1.5288e-06},
+        {0,0.25675,1.8855e-06},
+        {0,0.25854,2.1333e-06},
+        {0,0.26035,2.3139e-06},
+        {0,0.26215,2.3948e-06},
+        {0,0.26397,2.4069e-06},
+        {0,0.26577,2.301e-06},
+        {0,0.26756,2.1598e-06},
+        {0,0.26941,1.9587e-06},
+        {0,0.2712,1.6921e-06},
+        {0,0.27302,1.2675e-06},
+        {0,0.27484,9.345e-07},
+        {0,0.27667,1.0391e-06},
+        {0,0.27848,1.4548e-06},
+        {0,0.2803,1.7503e-06},
+        {0,0.28214,1.9921e-06},
+        {0,0.28396,2.2429e-06},
+        {0,0.28578,2.3368e-06},
+        {0,0.28761,2.387e-06},
+        {0,0.28946,2.4145e-06},
+        {0,0.2913,2.3634e-06},
+        {0,0.29313,2.3021e-06},
+        {0,0.29497,2.1385e-06},
+        {0,0.29682,1.9682e-06},
+        {0,0.29866,1.7236e-06},
+        {0,0.3005,1.4728e-06},
+        {0,0.30234,1.137e-06},
+        {0,0.30421,8.5235e-07},
+        {0,0.30606,9.2407e-07},
+        {0,0.30791,1.2303e-06},
+        {0,0.30977,1.5259e-06},
+        {0,0.31161,1.7664e-06},
+        {0,0.31349,1.8547e-06},
+        {0,0.31534,8.3145e-07},
+        {6.8048e-16,0.31721,9.3707e-17},
+        {3.4536e-16,0.31907,3.1236e-17},
+        {3.3512e-16,0.32095,6.2472e-17},
+        {1.0248e-17,0.32282,0},
+        {0,0.32467,6.2472e-17},
+        {0,0.32654,1.0933e-16},
+        {6.7536e-16,0.32843,1.0933e-16},
+        {7.4709e-16,0.3303,0},
+        {3.3512e-16,0.33219,6.2472e-17},
+        {6.9585e-16,0.33407,4.6854e-17},
+        {1.6756e-16,0.33594,3.1236e-17},
+        {8.4804e-16,0.33782,1.2494e-16},
+        {1.7781e-16,0.33972,0},
+        {0,0.3416,6.2472e-17},
+        {0,0.34348,0},
+        {7.2147e-16,0.34538,0},
+        {0,0.34727,0},
+        {0,0.34917,0},
+        {1.5731e-16,0.35106,6.2472e-17},
+        {6.4974e-16,0.35296,1.8741e-16},
+        {3.8636e-16,0.35487,0},
+        {2.0855e-16,0.35676,0},
+        {0,0.35865,0},
+        {3.1462e-16,0.36055,1.2494e-16},
+        {4.4119e-16,0.36247,2.8112e-16},
+        {5.1292e-16,0.36437,6.2472e-17},
+        {0,0.3663,0},
+        {6.8048e-16,0.3682,9.3707e-17},
+        {7.0098e-16,0.3701,3.1236e-17},
+        {2.9412e-16,0.37202,1.8741e-16},
+        {5.0268e-16,0.37395,9.3707e-17},
+        {0,0.37586,3.1236e-17},
+        {6.7023e-16,0.37778,1.2494e-16},
+        {0,0.3797,3.1236e-17},
+        {6.7023e-16,0.38163,1.2494e-16},
+        {8.5829e-16,0.38356,9.3707e-17},
+        {5.2317e-16,0.38547,3.1236e-17},
+        {1.0566e-15,0.3874,3.1236e-17},
+        {4.9243e-16,0.38934,1.2494e-16},
+        {0,0.39128,6.2472e-17},
+        {3.5561e-16,0.3932,0},
+        {1.0607e-16,0.39514,2.1865e-16},
+        {0,0.39707,9.3707e-17},
+        {2.0855e-16,0.39901,0},
+        {1.2037e-15,0.40097,1.2494e-16},
+        {9.951e-16,0.4029,2.1865e-16},
+        {1.1934e-15,0.40484,1.5618e-16},
+        {0,0.40679,1.2494e-16},
+        {0,0.40874,1.2494e-16},
+        {0,0.41069,0},
+        {1.3507e-15,0.41264,2.1865e-16},
+        {1.0258e-15,0.41458,1.2494e-16},
+        {3.1462e-16,0.41654,1.2494e-16},
+        {1.3815e-15,0.41849,1.2494e-16},
+        {6.9073e-16,0.42045,6.2472e-17},
+        {7.0098e-16,0.4224,3.1236e-17},
+        {6.0875e-16,0.42437,3.1236e-16},
+        {3.4536e-16,0.42633,3.1236e-17},
+        {9.3361e-16,0.4283,4.0607e-16},
+        {7.0098e-16,0.43026,3.1236e-17},
+        {1.3507e-15,0.43223,2.1865e-16},
+        {1.0258e-15,0.43419,1.2494e-16},
+        {1.3712e-15,0.43617,1.5618e-16},
+        {5.4726e-16,0.43814,4.9977e-16},
+        {7.1123e-16,0.44011,0},
+        {1.7063e-15,0.44209,2.1865e-16},
+        {6.3949e-16,0.44406,2.1865e-16},
+        {3.4536e-16,0.44603,3.1236e-17},
+        {6.1488e-17,0.44801,0},
+        {4.4784e-16,0.45,0},
+        {1.0566e-15,0.45199,3.1236e-17},
+        {1.0463e-15,0.45396,6.2472e-17},
+        {6.7023e-16,0.45594,1.2494e-16},
+        {1.0668e-15,0.45793,0},
+        {9.951e-16,0.45992,2.1865e-16},
+        {7.4197e-16,0.46191,0},
+        {1.1181e-15,0.46391,0},
+        {9.6436e-16,0.46589,3.1236e-16},
+        {1.2585e-15,0.46789,4.9977e-16},
+        {1.3815e-15,0.46989,1.2494e-16},
+        {6.7023e-16,0.47189,1.2494e-16},
+        {3.5561e-16,0.47388,0},
+        {2.0722e-15,0.47589,1.8741e-16},
+        {1.1078e-15,0.47788,0},
+        {1.6346e-15,0.4799,4.373e-16},
+        {6.2924e-16,0.4819,2.4989e-16},
+        {1.6756e-15,0.48389,3.1236e-16},
+        {1.402e-15,0.48591,6.2472e-17},
+        {1.0668e-15,0.48793,0},
+        {0,0.48992,0},
+        {0,0.49195,2.4989e-16},
+        {6.7023e-16,0.49395,1.2494e-16},
+        {1.4429e-15,0.49597,0},
+        {2.7363e-16,0.498,2.4989e-16},
+        {7.1123e-16,0.5,0}
+    },
+    {
+        {0,0,0},
+        {0.0080248,0.0015152,4.5084e-17},
+        {0.016166,0.0030536,0},
+        {0.024126,0.0045572,6.0397e-18},
+        {0.032164,0.0060809,1.6594e-17},
+        {0.040345,0.0076161,0},
+        {0.047917,0.0090568,0},
+        {0.055209,0.010404,3.9777e-17},
+        {0.06236,0.011803,0},
+        {0.068888,0.012988,0},
+        {0.074917,0.014153,0},
+        {0.080792,0.015256,5.8811e-17},
+        {0.086386,0.016319,8.7851e-18},
+        {0.091832,0.017341,0},
+        {0.096947,0.018317,0},
+        {0.10199,0.019262,2.1475e-17},
+        {0.10688,0.020182,0},
+        {0.11156,0.021071,4.2461e-17},
+        {0.11612,0.021929,0},
+        {0.12051,0.022761,0},
+        {0.12482,0.023572,0},
+        {0.12901,0.024369,0},
+        {0.13312,0.025144,0},
+        {0.13712,0.025899,2.9284e-17},
+        {0.14104,0.026637,0},
+        {0.14484,0.027362,0},
+        {0.14852,0.028076,0},
+        {0.15218,0.028765,0},
+        {0.15579,0.029444,0},
+        {0.15929,0.03011,0},
+        {0.16274,0.03076,0},
+        {0.16612,0.031401,0},
+        {0.16947,0.032031,0},
+        {0.17271,0.032655,0},
+        {0.1759,0.033257,0},
+        {0.17909,0.033824,0},
+        {0.18223,0.034436,0},
+        {0.18542,0.035067,0},
+        {0.18847,0.03563,0},
+        {0.19142,0.03617,0},
+        {0.19437,0.036729,0},
+        {0.19725,0.037267,5.4019e-07},
+        {0.20012,0.037802,1.2837e-06},
+        {0.20303,0.038349,9.9959e-07},
+        {0.20594,0.038898,7.7892e-07},
+        {0.20884,0.039449,9.7112e-07},
+        {0.21176,0.039999,1.2788e-06},
+        {0.21466,0.040546,1.373e-06},
+        {0.21761,0.0411,1.2556e-06},
+        {0.22057,0.041669,9.5959e-07},
+        {0.22346,0.042219,8.1372e-07},
+        {0.22635,0.042741,1.1485e-06},
+        {0.22925,0.043284,1.3628e-06},
+        {0.23223,0.04386,1.3699e-06},
+        {0.23522,0.044439,1.2685e-06},
+        {0.23815,0.045002,1.0271e-06},
+        {0.24106,0.045522,7.9582e-07},
+        {0.24401,0.046076,1.0449e-06},
+        {0.24701,0.046672,1.3237e-06},
+        {0.24995,0.047232,1.4871e-06},
+        {0.25293,0.047749,1.4007e-06},
+        {0.25591,0.048339,1.1191e-06},
+        {0.25894,0.048928,8.5433e-07},
+        {0.26191,0.049479,9.2045e-07},
+        {0.26486,0.050025,1.3084e-06},
+        {0.26783,0.05059,1.4958e-06},
+        {0.27084,0.051156,1.5067e-06},
+        {0.27383,0.051721,1.3409e-06},
+        {0.27682,0.052289,1.0257e-06},
+        {0.27983,0.052858,7.8803e-07},
+        {0.28284,0.053424,1.0814e-06},
+        {0.28584,0.053993,1.3794e-06},
+        {0.28888,0.054565,1.5209e-06},
+        {0.2919,0.055134,1.522e-06},
+        {0.29494,0.055708,1.3561e-06},
+        {0.29798,0.056296,1.0594e-06},
+        {0.30101,0.056866,8.5564e-07},
+        {0.30401,0.057414,1.0969e-06},
+        {0.30705,0.057986,1.3643e-06},
+        {0.31013,0.05858,1.5001e-06},
+        {0.3132,0.05917,1.5634e-06},
+        {0.31627,0.059754,1.4993e-06},
+        {0.31931,0.06032,1.2688e-06},
+        {0.32234,0.060876,9.3009e-07},
+        {0.32538,0.061448,8.4705e-07},
+        {0.32848,0.062046,1.1943e-06},
+        {0.33157,0.06265,1.4594e-06},
+        {0.33467,0.06322,1.6339e-06},
+        {0.33772,0.063788,1.6369e-06},
+        {0.3408,0.064374,1.4847e-06},
+        {0.34388,0.064956,1.2226e-06},
+        {0.34698,0.065538,8.9134e-07},
+        {0.35008,0.066125,8.5068e-07},
+        {0.35318,0.066712,1.2269e-06},
+        {0.35629,0.067299,1.4894e-06},
+        {0.35939,0.067883,1.6295e-06},
+        {0.36252,0.068473,1.6472e-06},
+        {0.36565,0.069079,1.5852e-06},
+        {0.36876,0.069658,1.4248e-06},
+        {0.37185,0.070223,1.0684e-06},
+        {0.37498,0.070835,7.9019e-07},
+        {0.37813,0.071435,1.022e-06},
+        {0.38125,0.072005,1.3647e-06},
+        {0.38438,0.072592,1.5517e-06},
+        {0.38754,0.073217,1.6548e-06},
+        {0.39069,0.073807,1.7253e-06},
+        {0.39382,0.074384,1.6463e-06},
+        {0.39695,0.074981,1.4452e-06},
+        {0.40011,0.075576,1.1513e-06},
+        {0.40327,0.076172,8.5042e-07},
+        {0.40643,0.076769,8.941e-07},
+        {0.40959,0.077367,1.2367e-06},
+        {0.41277,0.077967,1.4894e-06},
+        {0.41594,0.078566,1.6548e-06},
+        {0.41912,0.079167,1.728e-06},
+        {0.4223,0.079769,1.7184e-06},
+        {0.4255,0.080371,1.6249e-06},
+        {0.4287,0.080974,1.4674e-06},
+        {0.43192,0.081588,1.2356e-06},
+        {0.43512,0.082195,9.4259e-07},
+        {0.43828,0.08278,7.201e-07},
+        {0.4415,0.083388,1.052e-06},
+        {0.44472,0.084012,1.3338e-06},
+        {0.44791,0.084617,1.593e-06},
+        {0.45112,0.085205,1.7373e-06},
+        {0.45433,0.085801,1.7608e-06},
+        {0.45756,0.086427,1.7212e-06},
+        {0.4608,0.087056,1.6842e-06},
+        {0.46404,0.087652,1.5738e-06},
+        {0.46727,0.088257,1.3578e-06},
+        {0.47049,0.088871,1.1045e-06},
+        {0.47373,0.089482,8.1745e-07},
+        {0.47697,0.090095,7.8044e-07},
+        {0.48022,0.090707,1.0884e-06},
+        {0.48348,0.091327,1.3399e-06},
+        {0.48673,0.091949,1.5673e-06},
+        {0.48996,0.092545,1.7249e-06},
+        {0.49321,0.093154,1.7614e-06},
+        {0.49649,0.093784,1.7613e-06},
+        {0.49977,0.094411,1.763e-06},
+        {0.50305,0.095031,1.7236e-06},
+        {0.50631,0.09564,1.6147e-06},
+        {0.50957,0.096244,1.4163e-06},
+        {0.51285,0.096865,1.1666e-06},
+        {0.51615,0.097503,9.3008e-07},
+        {0.51945,0.098123,7.3324e-07},
+        {0.52274,0.098737,8.3616e-07},
+        {0.52603,0.099359,1.0957e-06},
+        {0.52932,0.099983,1.3165e-06},
+        {0.53262,0.10061,1.4935e-06},
+        {0.53592,0.10123,1.6285e-06},
+        {0.53923,0.10185,1.7225e-06},
+        {0.54255,0.10248,1.7716e-06},
+        {0.54588,0.10311,1.8035e-06},
+        {0.54919,0.10374,1.8308e-06},
+        {0.55249,0.10435,1.7782e-06},
+        {0.5558,0.10498,1.6557e-06},
+        {0.55915,0.10562,1.5548e-06},
+        {0.56251,0.10626,1.4434e-06},
+        {0.56583,0.10688,1.3031e-06},
+        {0.56915,0.10751,1.1028e-06},
+        {0.57249,0.10813,8.5642e-07},
+        {0.57584,0.10877,6.5276e-07},
+        {0.57921,0.10941,6.6729e-07},
+        {0.58255,0.11004,8.9887e-07},
+        {0.58591,0.11067,1.1025e-06},
+        {0.58925,0.1113,1.264e-06},
+        {0.59262,0.11194,1.3991e-06},
+        {0.59599,0.11257,1.5204e-06},
+        {0.59936,0.11322,1.6369e-06},
+        {0.60271,0.11385,1.7384e-06},
+        {0.60606,0.11447,1.7667e-06},
+        {0.60945,0.11512,1.7698e-06},
+        {0.61284,0.11576,1.7921e-06},
+        {0.61623,0.11641,1.8189e-06},
+        {0.6196,0.11703,1.7927e-06},
+        {0.62299,0.11767,1.7298e-06},
+        {0.62639,0.11833,1.7048e-06},
+        {0.62978,0.11896,1.6692e-06},
+        {0.63317,0.1196,1.5768e-06},
+        {0.63657,0.12024,1.4791e-06},
+        {0.63997,0.12088,1.3801e-06},
+        {0.64337,0.12153,1.2686e-06},
+        {0.64679,0.12217,1.1466e-06},
+        {0.65019,0.12281,1.0261e-06},
+        {0.65362,0.12346,8.8816e-07},
+        {0.65704,0.12411,7.6247e-07},
+        {0.66046,0.12475,6.252e-07},
+        {0.6639,0.1254,5.0813e-07},
+        {0.66734,0.12605,5.4766e-07},
+        {0.67075,0.12669,4.2573e-07},
+        {0.67419,0.12734,2.3855e-08},
+        {0.67764,0.128,0},
+        {0.68106,0.12864,0},
+        {0.68451,0.12929,0},
+        {0.68797,0.12996,0},
+        {0.69142,0.13061,0},
+        {0.69486,0.13125,0},
+        {0.69832,0.1319,0},
+        {0.70177,0.13256,0},
+        {0.70524,0.13321,0},
+        {0.70871,0.13387,0},
+        {0.71218,0.13453,0},
+        {0.71565,0.13518,0},
+        {0.7191,0.13582,0},
+        {0.72258,0.13648,0},
+        {0.72607,0.13715,0},
+        {0.72956,0.13781,0},
+        {0.73304,0.13847,0},
+        {0.73651,0.13912,0},
+        {0.74001,0.13977,0},
+        {0.74351,0.14044,0},
+        {0.74701,0.14111,0},
+        {0.75051,0.14176,0},
+        {0.75401,0.14242,0},
+        {0.75751,0.14309,0},
+        {0.76102,0.14375,0},
+        {0.76454,0.14441,0},
+        {0.76805,0.14508,0},
+        {0.77157,0.14575,0},
+        {0.77507,0.1464,0},
+        {0.7786,0.14707,0},
+        {0.78213,0.14774,0},
+        {0.78565,0.14839,0},
+        {0.78919,0.14907,0},
+        {0.79273,0.14975,0},
+        {0.79625,0.1504,0},
+        {0.7998,0.15107,0},
+        {0.80333,0.15174,0},
+        {0.80688,0.15241,0},
+        {0.81042,0.15308,0},
+        {0.81397,0.15375,0},
+        {0.81752,0.15442,0},
+        {0.82108,0.15509,0},
+        {0.82465,0.15577,0},
+        {0.82821,0.15645,0},
+        {0.83177,0.15711,0},
+        {0.83534,0.15778,0},
+        {0.83891,0.15847,0},
+        {0.84248,0.15914,0},
+        {0.84604,0.1598,0},
+        {0.84963,0.16048,0},
+        {0.85322,0.16117,0},
+        {0.8568,0.16184,0},
+        {0.86038,0.16251,0},
+        {0.86398,0.16319,0},
+        {0.86757,0.16388,0},
+        {0.87115,0.16455,0},
+        {0.87473,0.16523,0},
+        {0.87834,0.16591,0},
+        {0.88196,0.16659,0},
+        {0.88556,0.16727,0},
+        {0.88915,0.16795,0},
+        {0.89277,0.16863,0},
+        {0.89639,0.16932,0},
+        {0.9,0.17,2.0303e-16}
+    },
+    {
+        {0,0.20755,0.97632},
+        {0,0.22113,0.96201},
+        {0,0.23397,0.94773},
+        {0,0.24623,0.93346},
+        {0,0.25798,0.91922},
+        {0,0.26932,0.905},
+        {0,0.28022,0.89081},
+        {0,0.29079,0.87663},
+        {0,0.30104,0.8625},
+        {0,0.31103,0.84838},
+        {0,0.32074,0.83429},
+        {0,0.3302,0.82023},
+        {0,0.33945,0.80621},
+        {0,0.34846,0.79222},
+        {0,0.35727,0.77828},
+        {0,0.36586,0.76439},
+        {0,0.37426,0.75056},
+        {0,0.38245,0.7368},
+        {0,0.39044,0.72311},
+        {0,0.39823,0.70952},
+        {0,0.4058,0.69603},
+        {0,0.41317,0.68264},
+        {0.0064797,0.42031,0.66938},
+        {0.016533,0.42727,0.65626},
+        {0.028131,0.43398,0.64326},
+        {0.041954,0.44052,0.63041},
+        {0.055821,0.44686,0.6177},
+        {0.069351,0.45301,0.60514},
+        {0.082392,0.45898,0.59273},
+        {0.095132,0.46479,0.58043},
+        {0.10747,0.47045,0.56826},
+        {0.11942,0.47598,0.55619},
+        {0.13095,0.48139,0.54423},
+        {0.14195,0.48671,0.53234},
+        {0.15241,0.49195,0.52051},
+        {0.16235,0.49712,0.50873},
+        {0.17166,0.50225,0.49697},
+        {0.18039,0.50733,0.48522},
+        {0.18854,0.51239,0.47347},
+        {0.19606,0.51744,0.46171},
+        {0.20297,0.52246,0.4499},
+        {0.20931,0.5275,0.43806},
+        {0.21508,0.53254,0.42613},
+        {0.22033,0.53758,0.41415},
+        {0.225,0.54263,0.40206},
+        {0.22922,0.54768,0.38989},
+        {0.23295,0.55275,0.37763},
+        {0.23626,0.55783,0.36524},
+        {0.23913,0.56292,0.35274},
+        {0.24164,0.56801,0.3401},
+        {0.24376,0.57311,0.32732},
+        {0.24561,0.57819,0.31441},
+        {0.24723,0.58328,0.30137},
+        {0.24866,0.58836,0.28822},
+        {0.24993,0.59342,0.27496},
+        {0.25123,0.59845,0.2616},
+        {0.25256,0.60344,0.2482},
+        {0.25407,0.60839,0.23474},
+        {0.25584,0.61326,0.22129},
+        {0.25802,0.61807,0.2079},
+        {0.26074,0.6228,0.19465},
+        {0.26408,0.62744,0.18153},
+        {0.26813,0.63197,0.16873},
+        {0.273,0.63639,0.15625},
+        {0.27873,0.64068,0.14417},
+        {0.28531,0.64485,0.13262},
+        {0.29279,0.6489,0.12165},
+        {0.30109,0.65281,0.1115},
+        {0.31019,0.65661,0.10209},
+        {0.31996,0.66028,0.093634},
+        {0.33034,0.66383,0.08618},
+        {0.34123,0.66728,0.079836},
+        {0.35254,0.67063,0.074617},
+        {0.36416,0.67388,0.07048},
+        {0.37603,0.67707,0.067441},
+        {0.38805,0.68017,0.065341},
+        {0.40017,0.68323,0.064135},
+        {0.41235,0.68622,0.063669},
+        {0.42451,0.68918,0.063793},
+        {0.43665,0.6921,0.064391},
+        {0.44873,0.69498,0.065355},
+        {0.46073,0.69783,0.066603},
+        {0.47266,0.70067,0.068066},
+        {0.4845,0.70348,0.06967},
+        {0.49625,0.70628,0.071332},
+        {0.50793,0.70905,0.07306},
+        {0.5195,0.71181,0.074792},
+        {0.53099,0.71455,0.076552},
+        {0.5424,0.71728,0.078345},
+        {0.55372,0.72,0.08017},
+        {0.56497,0.72269,0.082034},
+        {0.57617,0.72539,0.083799},
+        {0.58729,0.72805,0.085523},
+        {0.59835,0.73071,0.087403},
+        {0.60937,0.73336,0.089162},
+        {0.62033,0.73599,0.090964},
+        {0.63124,0.73861,0.092702},
+        {0.64211,0.74121,0.094561},
+        {0.65293,0.7438,0.096272},
+        {0.66373,0.74637,0.09813},
+        {0.67447,0.74893,0.099882},
+        {0.68519,0.75149,0.10167},
+        {0.69588,0.75402,0.1035},
+        {0.70654,0.75653,0.10524},
+        {0.71717,0.75904,0.10708},
+        {0.72776,0.76153,0.10884},
+        {0.73834,0.764,0.11066},
+        {0.7489,0.76647,0.11246},
+        {0.75944,0.76891,0.1142},
+        {0.76996,0.77134,0.11604},
+        {0.78045,0.77373,0.1178},
+        {0.79092,0.7761,0.11957},
+        {0.80136,0.77843,0.12132},
+        {0.81178,0.78071,0.12308},
+        {0.82215,0.78294,0.12485},
+        {0.83247,0.78509,0.12657},
+        {0.84272,0.78715,0.12828},
+        {0.85289,0.78908,0.12995},
+        {0.86295,0.79087,0.13152},
+        {0.87287,0.79248,0.13305},
+        {0.88262,0.79388,0.13451},
+        {0.89216,0.79501,0.13581},
+        {0.90143,0.79585,0.13707},
+        {0.9104,0.79634,0.13819},
+        {0.919,0.79646,0.1391},
+        {0.9272,0.79616,0.13987},
+        {0.93494,0.79542,0.1405},
+        {0.94218,0.7942,0.14092},
+        {0.94889,0.79248,0.14112},
+        {0.95503,0.79026,0.14111},
+        {0.9606,0.78755,0.14089},
+        {0.96559,0.78436,0.14045},
+        {0.97002,0.7807,0.1398},
+        {0.9739,0.77661,0.13901},
+        {0.97726,0.77212,0.13808},
+        {0.98015,0.76727,0.13693},
+        {0.9826,0.76211,0.13566},
+        {0.98467,0.75668,0.13433},
+        {0.9864,0.75102,0.13284},
+        {0.98784,0.74515,0.13129},
+        {0.98904,0.73914,0.12968},
+        {0.99004,0.73298,0.128},
+        {0.99087,0.72672,0.1263},
+        {0.99158,0.72038,0.12453},
+        {0.99217,0.71398,0.12276},
+        {0.99268,0.70752,0.121},
+        {0.99312,0.70102,0.11926},
+        {0.9935,0.69447,0.11747},
+        {0.99383,0.68791,0.11573},
+        {0.99412,0.68132,0.11394},
+        {0.99438,0.6747,0.1122},
+        {0.99461,0.66807,0.11045},
+        {0.99481,0.66142,0.10865},
+        {0.995,0.65473,0.10697},
+        {0.99516,0.64804,0.10517},
+        {0.99529,0.64132,0.1035},
+        {0.99541,0.63459,0.10176},
+        {0.9955,0.62783,0.10005},
+        {0.99557,0.62104,0.098389},
+        {0.99561,0.61422,0.096641},
+        {0.99564,0.60739,0.095059},
+        {0.99564,0.60052,0.093326},
+        {0.99562,0.59363,0.091753},
+        {0.99558,0.5867,0.090085},
+        {0.99551,0.57975,0.08846},
+        {0.99543,0.57276,0.086866},
+        {0.99532,0.56573,0.085214},
+        {0.9952,0.55867,0.083665},
+        {0.99505,0.55159,0.082128},
+        {0.99488,0.54446,0.080509},
+        {0.99469,0.53729,0.078934},
+        {0.99448,0.53007,0.077397},
+        {0.99425,0.52281,0.0759},
+        {0.994,0.5155,0.074438},
+        {0.99373,0.50816,0.07298},
+        {0.99343,0.50075,0.071525},
+        {0.99312,0.49329,0.070045},
+        {0.99279,0.48577,0.068661},
+        {0.99244,0.4782,0.067207},
+        {0.99206,0.47057,0.0658},
+        {0.99167,0.46285,0.064435},
+        {0.99126,0.45509,0.063129},
+        {0.99083,0.44724,0.061707},
+        {0.99038,0.43931,0.060477},
+        {0.98991,0.43131,0.059288},
+        {0.98943,0.42321,0.058031},
+        {0.98894,0.41505,0.05706},
+        {0.98843,0.40681,0.056202},
+        {0.98792,0.3985,0.055473},
+        {0.98741,0.39011,0.055034},
+        {0.9869,0.38168,0.054941},
+        {0.9864,0.37321,0.055283},
+        {0.98593,0.36474,0.056189},
+        {0.98549,0.3563,0.057588},
+        {0.9851,0.34792,0.059933},
+        {0.98478,0.33968,0.062969},
+        {0.98453,0.33161,0.066854},
+        {0.98439,0.32384,0.071751},
+        {0.98437,0.31645,0.077527},
+        {0.98449,0.30952,0.084428},
+        {0.98477,0.30314,0.09217},
+        {0.98521,0.29747,0.10081},
+        {0.98584,0.29256,0.1104},
+        {0.98667,0.28854,0.12072},
+        {0.98768,0.28545,0.1319},
+        {0.98888,0.2834,0.14376},
+        {0.99026,0.28237,0.15632},
+        {0.9918,0.28237,0.16948},
+        {0.9935,0.28336,0.18318},
+        {0.99531,0.28528,0.19743},
+        {0.99722,0.2881,0.21214},
+        {0.99921,0.29171,0.22722},
+        {1,0.29596,0.24264},
+        {1,0.3008,0.25836},
+        {1,0.30615,0.27432},
+        {1,0.31182,0.29047},
+        {1,0.31783,0.30679},
+        {1,0.32406,0.32321},
+        {1,0.33045,0.33974},
+        {1,0.33697,0.35632},
+        {1,0.34355,0.37295},
+        {1,0.3502,0.38964},
+        {1,0.35686,0.40637},
+        {1,0.36352,0.42312},
+        {1,0.37019,0.43991},
+        {1,0.37687,0.45672},
+        {1,0.38352,0.47355},
+        {1,0.39014,0.49042},
+        {1,0.39675,0.50731},
+        {1,0.40335,0.52423},
+        {1,0.40993,0.54118},
+        {1,0.41648,0.55818},
+        {1,0.42301,0.57522},
+        {1,0.42955,0.5923},
+        {1,0.43607,0.60942},
+        {1,0.44258,0.62659},
+        {1,0.44907,0.6438},
+        {1,0.45556,0.66106},
+        {1,0.46203,0.67837},
+        {1,0.4685,0.69574},
+        {1,0.47498,0.71314},
+        {1,0.48143,0.7306},
+        {1,0.48789,0.74812},
+        {1,0.49434,0.76568},
+        {1,0.50078,0.78329},
+        {1,0.50723,0.80096},
+        {1,0.51367,0.81867},
+        {1,0.5201,0.83645},
+        {1,0.52655,0.85427},
+        {1,0.53299,0.87215},
+        {1,0.53942,0.89007},
+        {1,0.54587,0.90805},
+        {1,0.55231,0.92608},
+        {0.99945,0.55874,0.94416},
+        {0.99597,0.56518,0.96229},
+        {0.99228,0.57163,0.98048}
+    },
+    {
+        {0,0.20387,0.96251},
+        {0,0.21524,0.9514},
+        {0,0.22613,0.94031},
+        {0,0.23654,0.92923},
+        {0,0.24654,0.91817},
+        {0,0.2562,0.90712},
+        {0,0.26557,0.89608},
+        {0,0.27465,0.88506},
+        {0,0.28348,0.87405},
+        {0,0.29209,0.86305},
+        {0,0.30047,0.85206},
+        {0,0.3087,0.84109},
+        {0,0.31672,0.83013},
+        {0,0.32458,0.81917},
+        {0,0.33232,0.80823},
+        {0,0.3399,0.7973},
+        {0,0.34736,0.78638},
+        {0,0.3547,0.77546},
+        {0,0.36191,0.76456},
+        {0,0.36902,0.75367},
+        {0,0.37602,0.7428},
+        {0,0.38291,0.73193},
+        {0,0.38969,0.72108},
+        {0,0.39636,0.71026},
+        {0,0.40292,0.69946},
+        {0,0.40934,0.68872},
+        {0,0.41561,0.67802},
+        {0,0.42172,0.66738},
+        {0,0.42768,0.65684},
+        {0,0.43342,0.64639},
+        {0,0.43896,0.63605},
+        {0,0.44432,0.62583},
+        {0,0.44945,0.61575},
+        {0,0.45438,0.60579},
+        {0,0.45911,0.59597},
+        {0.0043377,0.46367,0.58627},
+        {0.029615,0.46807,0.57668},
+        {0.055795,0.47235,0.56717},
+        {0.077065,0.47652,0.55774},
+        {0.095292,0.48061,0.54837},
+        {0.11119,0.48465,0.53903},
+        {0.1253,0.48865,0.52971},
+        {0.13799,0.49262,0.5204},
+        {0.14937,0.49658,0.5111},
+        {0.15963,0.50055,0.50179},
+        {0.169,0.50452,0.49244},
+        {0.17747,0.50849,0.48309},
+        {0.18517,0.51246,0.4737},
+        {0.19217,0.51645,0.46429},
+        {0.19856,0.52046,0.45483},
+        {0.20443,0.52448,0.44531},
+        {0.20974,0.52851,0.43577},
+        {0.21461,0.53255,0.42616},
+        {0.21905,0.53661,0.41651},
+        {0.22309,0.54066,0.40679},
+        {0.22674,0.54474,0.397},
+        {0.23002,0.54883,0.38713},
+        {0.233,0.55292,0.3772},
+        {0.23568,0.55703,0.36716},
+        {0.23802,0.56114,0.35704},
+        {0.24006,0.56526,0.34678},
+        {0.24185,0.56939,0.3364},
+        {0.24334,0.57354,0.32588},
+        {0.24458,0.57769,0.31523},
+        {0.24556,0.58185,0.30439},
+        {0.2463,0.58603,0.29336},
+        {0.2468,0.59019,0.28214},
+        {0.24707,0.59438,0.27067},
+        {0.24714,0.59856,0.25896},
+        {0.24703,0.60275,0.24696},
+        {0.24679,0.60693,0.23473},
+        {0.24647,0.61109,0.22216},
+        {0.24615,0.61523,0.20936},
+        {0.24595,0.61936,0.19632},
+        {0.246,0.62342,0.18304},
+        {0.24644,0.62742,0.16969},
+        {0.24748,0.63135,0.1563},
+        {0.24925,0.63518,0.14299},
+        {0.25196,0.6389,0.13001},
+        {0.2557,0.64249,0.11741},
+        {0.26057,0.64594,0.10557},
+        {0.26659,0.64926,0.094696},
+        {0.27372,0.65242,0.084904},
+        {0.28182,0.65545,0.076489},
+        {0.29078,0.65835,0.069753},
+        {0.30043,0.66113,0.064513},
+        {0.31061,0.66383,0.060865},
+        {0.32112,0.66642,0.058721},
+        {0.33186,0.66896,0.057692},
+        {0.34272,0.67144,0.057693},
+        {0.35356,0.67388,0.058443},
+        {0.36439,0.67628,0.059738},
+        {0.37512,0.67866,0.061142},
+        {0.38575,0.68102,0.062974},
+        {0.39627,0.68337,0.064759},
+        {0.40666,0.68571,0.066664},
+        {0.41692,0.68803,0.068644},
+        {0.42707,0.69034,0.070512},
+        {0.43709,0.69266,0.072423},
+        {0.44701,0.69494,0.074359},
+        {0.45683,0.69723,0.076211},
+        {0.46657,0.6995,0.07809},
+        {0.47621,0.70177,0.079998},
+        {0.48577,0.70403,0.081943},
+        {0.49527,0.70629,0.083778},
+        {0.5047,0.70853,0.085565},
+        {0.51405,0.71076,0.087502},
+        {0.52335,0.71298,0.089316},
+        {0.53259,0.7152,0.091171},
+        {0.54176,0.7174,0.092931},
+        {0.5509,0.7196,0.094839},
+        {0.55999,0.72178,0.096566},
+        {0.56902,0.72396,0.098445},
+        {0.57802,0.72613,0.10023},
+        {0.58698,0.72828,0.10204},
+        {0.5959,0.73044,0.10385},
+        {0.60479,0.73258,0.10564},
+        {0.61363,0.73471,0.10744},
+        {0.62246,0.73683,0.10925},
+        {0.63125,0.73895,0.11102},
+        {0.64001,0.74104,0.11282},
+        {0.64874,0.74315,0.11452},
+        {0.65745,0.74523,0.11636},
+        {0.66613,0.74731,0.11813},
+        {0.67479,0.74937,0.11986},
+        {0.68343,0.75144,0.12161},
+        {0.69205,0.75348,0.12338},
+        {0.70065,0.75552,0.12517},
+        {0.70923,0.75755,0.12691},
+        {0.71779,0.75957,0.12868},
+        {0.72633,0.76158,0.13048},
+        {0.73487,0.76359,0.13221},
+        {0.74338,0.76559,0.13396},
+        {0.75188,0.76756,0.13568},
+        {0.76037,0.76954,0.13747},
+        {0.76884,0.77151,0.13917},
+        {0.77731,0.77346,0.14097},
+        {0.78576,0.77541,0.14269},
+        {0.7942,0.77736,0.14444},
+        {0.80262,0.77928,0.14617},
+        {0.81105,0.7812,0.14791},
+        {0.81945,0.78311,0.14967},
+        {0.82786,0.78502,0.15138},
+        {0.83626,0.78691,0.15311},
+        {0.84465,0.7888,0.15486},
+        {0.85304,0.79066,0.15662},
+        {0.86141,0.79251,0.15835},
+        {0.86978,0.79434,0.16002},
+        {0.87814,0.79612,0.16178},
+        {0.88647,0.79786,0.16346},
+        {0.89477,0.79952,0.16507},
+        {0.90301,0.80106,0.1667},
+        {0.91115,0.80245,0.16819},
+        {0.91917,0.80364,0.16964},
+        {0.92701,0.80456,0.1709},
+        {0.93459,0.80514,0.172},
+        {0.94185,0.80532,0.17289},
+        {0.94869,0.80504,0.17355},
+        {0.95506,0.80424,0.17392},
+        {0.96088,0.80289,0.17399},
+        {0.96609,0.80097,0.17375},
+        {0.97069,0.7985,0.17319},
+        {0.97465,0.79549,0.17234},
+        {0.97801,0.79201,0.17121},
+        {0.98082,0.7881,0.16986},
+        {0.98314,0.78384,0.16825},
+        {0.98504,0.77928,0.16652},
+        {0.9866,0.7745,0.16463},
+        {0.98789,0.76955,0.16265},
+        {0.98897,0.76449,0.16056},
+        {0.9899,0.75932,0.15848},
+        {0.99072,0.75411,0.15634},
+        {0.99146,0.74885,0.15414},
+        {0.99214,0.74356,0.15196},
+        {0.99279,0.73825,0.14981},
+        {0.9934,0.73293,0.1476},
+        {0.99398,0.72759,0.14543},
+        {0.99454,0.72224,0.1432},
+        {0.99509,0.71689,0.14103},
+        {0.99562,0.71152,0.1388},
+        {0.99613,0.70614,0.13659},
+        {0.99662,0.70075,0.13444},
+        {0.9971,0.69534,0.13223},
+        {0.99755,0.68993,0.13006},
+        {0.998,0.6845,0.12783},
+        {0.99842,0.67906,0.12564},
+        {0.99883,0.67361,0.1234},
+        {0.99922,0.66815,0.12119},
+        {0.99959,0.66267,0.11904},
+        {0.99994,0.65717,0.11682},
+        {1,0.65166,0.11458},
+        {1,0.64613,0.11244},
+        {1,0.64059,0.11024},
+        {1,0.63503,0.10797},
+        {1,0.62945,0.1058},
+        {1,0.62386,0.1036},
+        {1,0.61825,0.10135},
+        {1,0.61261,0.099135},
+        {1,0.60697,0.096882},
+        {1,0.6013,0.094743},
+        {1,0.59561,0.092465},
+        {1,0.58989,0.090257},
+        {1,0.58416,0.088032},
+        {1,0.5784,0.085726},
+        {1,0.57263,0.083542},
+        {1,0.56682,0.081316},
+        {1,0.56098,0.079004},
+        {1,0.55513,0.076745},
+        {1,0.54925,0.07453},
+        {1,0.54333,0.072245},
+        {1,0.53739,0.070004},
+        {1,0.53141,0.067732},
+        {1,0.52541,0.065424},
+        {1,0.51937,0.06318},
+        {1,0.5133,0.06081},
+        {1,0.50718,0.058502},
+        {1,0.50104,0.056232},
+        {1,0.49486,0.053826},
+        {1,0.48863,0.051494},
+        {1,0.48236,0.049242},
+        {1,0.47605,0.046828},
+        {1,0.46969,0.044447},
+        {1,0.46327,0.042093},
+        {1,0.45681,0.039648},
+        {1,0.45031,0.037261},
+        {1,0.44374,0.034882},
+        {1,0.43712,0.032495},
+        {1,0.43043,0.030303},
+        {1,0.42367,0.02818},
+        {1,0.41686,0.026121},
+        {1,0.40997,0.024126},
+        {1,0.40299,0.022194},
+        {1,0.39595,0.020325},
+        {1,0.38882,0.018517},
+        {0.99994,0.38159,0.016771},
+        {0.99961,0.37428,0.015085},
+        {0.99927,0.36685,0.013457},
+        {0.99892,0.35932,0.011916},
+        {0.99855,0.35167,0.010169},
+        {0.99817,0.3439,0.0087437},
+        {0.99778,0.336,0.0073541},
+        {0.99738,0.32796,0.0060199},
+        {0.99696,0.31976,0.0047429},
+        {0.99653,0.31138,0.0035217},
+        {0.99609,0.30282,0.0023557},
+        {0.99563,0.29407,0.0012445},
+        {0.99517,0.2851,0.00018742},
+        {0.99469,0.27591,0},
+        {0.9942,0.26642,0},
+        {0.99369,0.25664,0},
+        {0.99318,0.24652,0},
+        {0.99265,0.23605,0},
+        {0.99211,0.22511,0},
+        {0.99155,0.2137,0},
+        {0.99099,0.20169,0},
+        {0.99041,0.18903,0}
     }
+    };
 }
 
-QVector<QVector3D> ColourMaps::GetMap(int mapNum)
+QVector3D ColourMaps::GetColour(int map, int mapIndex) const
 {
-    if (mapNum >= m_ColourMaps.length())
+    const float* colour;
+    if (mapIndex >= MAP_LENGTH)
     {
-        return m_ColourMaps.last();
+        colour = COLOUR_MAP_TABLE[clampMap(map)][MAP_LENGTH - 1];
     }
-    else if (mapNum < 0)
+    else if (mapIndex < 0)
     {
-        return m_ColourMaps.first();
+        colour = COLOUR_MAP_TABLE[clampMap(map)][0];
     }
     else
     {
-        return m_ColourMaps[mapNum];
+        colour = COLOUR_MAP_TABLE[clampMap(map)][mapIndex];
+    }
+    return QVector3D(colour[0], colour[1], colour[2]);
+}
+
+QVector<QVector3D> ColourMaps::GetMap(int mapNum) const
+{
+    QVector<QVector3D> map(MAP_LENGTH);
+    const float* data = GetMapData(mapNum);
+    for (int i = 0; i < MAP_LENGTH; ++i)
+    {
+        map[i] = QVector3D(data[3*i], data[3*i + 1], data[3*i + 2]);
     }
+    return map;
 }
 
-int ColourMaps::GetNumberOfMaps()
+const float* ColourMaps::GetMapData(int mapNum) const
 {
-    return m_ColourMaps.length();
+    return COLOUR_MAP_TABLE[clampMap(mapNum)][0];
+}
+
+int ColourMaps::GetMapLength() const
+{
+    return MAP_LENGTH;
+}
+
+int ColourMaps::GetNumberOfMaps() const
+{
+    return NUMBER_OF_MAPS;
 }
 
 ColourMaps::ColourMaps()
 {
-    m_ColourMaps = {
-        {
-            QVector3D(0.46877,0.46888,0.46885),
-            QVector3D(0.47381,0.47391,0.47389),
-            QVector3D(0.47887,0.47897,0.47895),
-            QVector3D(0.48395,0.48405,0.48403),
-            QVector3D(0.48907,0.48917,0.48914),
-            QVector3D(0.49422,0.49432,0.4943),
-            QVector3D(0.49939,0.49949,0.49947),
-            QVector3D(0.50462,0.50472,0.5047),
-            QVector3D(0.50986,0.50997,0.50994),
-            QVector3D(0.51515,0.51526,0.51523),
-            QVector3D(0.52047,0.52058,0.52056),
-            QVector3D(0.52583,0.52594,0.52592),
-            QVector3D(0.53121,0.53132,0.5313),
-            QVector3D(0.53663,0.53674,0.53671),
-            QVector3D(0.54205,0.54217,0.54214),
-            QVector3D(0.5475,0.54762,0.54759),
-            QVector3D(0.55297,0.55309,0.55306),
-            QVector3D(0.55846,0.55857,0.55855),
-            QVector3D(0.56397,0.56409,0.56406),
-            QVector3D(0.56948,0.5696,0.56957),
-            QVector3D(0.57501,0.57513,0.5751),
-            QVector3D(0.58055,0.58067,0.58064),
-            QVector3D(0.58611,0.58623,0.5862),
-            QVector3D(0.59167,0.59179,0.59176),
-            QVector3D(0.59724,0.59737,0.59734),
-            QVector3D(0.60282,0.60295,0.60292),
-            QVector3D(0.60842,0.60855,0.60852),
-            QVector3D(0.61401,0.61414,0.6141),
-            QVector3D(0.61963,0.61976,0.61973),
-            QVector3D(0.62524,0.62537,0.62534),
-            QVector3D(0.63088,0.63101,0.63098),
-            QVector3D(0.63652,0.63665,0.63662),
-            QVector3D(0.64216,0.64229,0.64226),
-            QVector3D(0.64781,0.64795,0.64791),
-            QVector3D(0.65348,0.65361,0.65358),
-            QVector3D(0.65915,0.65929,0.65926),
-            QVector3D(0.66484,0.66497,0.66494),
-            QVector3D(0.67054,0.67067,0.67064),
-            QVector3D(0.67624,0.67637,0.67634),
-            QVector3D(0.68194,0.68208,0.68205),
-            QVector3D(0.68766,0.68781,0.68777),
-            QVector3D(0.69339,0.69353,0.6935),
-            QVector3D(0.69913,0.69927,0.69923),
-            QVector3D(0.70487,0.70502,0.70498),
-            QVector3D(0.71062,0.71076,0.71073),
-            QVector3D(0.71636,0.71651,0.71647),
-            QVector3D(0.72208,0.72223,0.72219),
-            QVector3D(0.72779,0.72794,0.72791),
-            QVector3D(0.73347,0.73362,0.73359),
-            QVector3D(0.73911,0.73926,0.73922),
-            QVector3D(0.74467,0.74482,0.74478),
-            QVector3D(0.75014,0.75029,0.75026),
-            QVector3D(0.75549,0.75565,0.75561),
-            QVector3D(0.76068,0.76083,0.7608),
-            QVector3D(0.76567,0.76582,0.76578),
-            QVector3D(0.77039,0.77055,0.77051),
-            QVector3D(0.77481,0.77497,0.77493),
-            QVector3D(0.77887,0.77903,0.77899),
-            QVector3D(0.7825,0.78266,0.78262),
-            QVector3D(0.78566,0.78581,0.78578),
-            QVector3D(0.78827,0.78843,0.78839),
-            QVector3D(0.79029,0.79045,0.79041),
-            QVector3D(0.79169,0.79185,0.79182),
-            QVector3D(0.79244,0.7926,0.79257),
-            QVector3D(0.79252,0.79269,0.79265),
-            QVector3D(0.79193,0.79209,0.79205),
-            QVector3D(0.79069,0.79085,0.79081),
-            QVector3D(0.78881,0.78897,0.78893),
-            QVector3D(0.78633,0.78649,0.78645),
-            QVector3D(0.7833,0.78346,0.78342),
-            QVector3D(0.77978,0.77994,0.7799),
-            QVector3D(0.77582,0.77598,0.77594),
-            QVector3D(0.77149,0.77164,0.7716),
-            QVector3D(0.76682,0.76698,0.76694),
-            QVector3D(0.76189,0.76205,0.76201),
-            QVector3D(0.75675,0.75691,0.75687),
-            QVector3D(0.75145,0.7516,0.75156),
-            QVector3D(0.746,0.74615,0.74611),
-            QVector3D(0.74045,0.7406,0.74056),
-            QVector3D(0.73484,0.73499,0.73495),
-            QVector3D(0.72917,0.72932,0.72928),
-            QVector3D(0.72346,0.72361,0.72357),
-            QVector3D(0.71774,0.71789,0.71785),
-            QVector3D(0.712,0.71215,0.71211),
-            QVector3D(0.70626,0.70641,0.70637),
-            QVector3D(0.70052,0.70066,0.70062),
-            QVector3D(0.69477,0.69492,0.69488),
-            QVector3D(0.68905,0.68919,0.68916),
-            QVector3D(0.68333,0.68346,0.68343),
-            QVector3D(0.67762,0.67776,0.67772),
-            QVector3D(0.67191,0.67205,0.67201),
-            QVector3D(0.66621,0.66635,0.66631),
-            QVector3D(0.66052,0.66066,0.66063),
-            QVector3D(0.65485,0.65498,0.65495),
-            QVector3D(0.64919,0.64932,0.64929),
-            QVector3D(0.64352,0.64365,0.64362),
-            QVector3D(0.63787,0.63801,0.63797),
-            QVector3D(0.63223,0.63236,0.63233),
-            QVector3D(0.6266,0.62673,0.6267),
-            QVector3D(0.62098,0.62111,0.62108),
-            QVector3D(0.61536,0.61549,0.61546),
-            QVector3D(0.60976,0.60989,0.60986),
-            QVector3D(0.60418,0.6043,0.60427),
-            QVector3D(0.59858,0.59871,0.59868),
-            QVector3D(0.59302,0.59314,0.59311),
-            QVector3D(0.58744,0.58756,0.58753),
-            QVector3D(0.58189,0.58201,0.58198),
-            QVector3D(0.57635,0.57647,0.57644),
-            QVector3D(0.57081,0.57092,0.5709),
-            QVector3D(0.56528,0.56539,0.56537),
-            QVector3D(0.55977,0.55989,0.55986),
-            QVector3D(0.55426,0.55438,0.55435),
-            QVector3D(0.54877,0.54888,0.54886),
-            QVector3D(0.54328,0.54339,0.54336),
-            QVector3D(0.53781,0.53792,0.53789),
-            QVector3D(0.53234,0.53245,0.53242),
-            QVector3D(0.52688,0.52699,0.52697),
-            QVector3D(0.52143,0.52154,0.52151),
-            QVector3D(0.51599,0.5161,0.51607),
-            QVector3D(0.51057,0.51067,0.51065),
-            QVector3D(0.50515,0.50526,0.50523),
-            QVector3D(0.49974,0.49985,0.49982),
-            QVector3D(0.49436,0.49446,0.49444),
-            QVector3D(0.48897,0.48907,0.48905),
-            QVector3D(0.48359,0.4837,0.48367),
-            QVector3D(0.47824,0.47834,0.47831),
-            QVector3D(0.47288,0.47298,0.47295),
-            QVector3D(0.46755,0.46764,0.46762),
-            QVector3D(0.46221,0.46231,0.46229),
-            QVector3D(0.45689,0.45699,0.45697),
-            QVector3D(0.45159,0.45169,0.45166),
-            QVector3D(0.44629,0.44638,0.44636),
-            QVector3D(0.441,0.44109,0.44107),
-            QVector3D(0.43574,0.43583,0.43581),
-            QVector3D(0.43047,0.43056,0.43054),
-            QVector3D(0.42522,0.42531,0.42529),
-            QVector3D(0.41998,0.42007,0.42004),
-            QVector3D(0.41475,0.41483,0.41481),
-            QVector3D(0.40953,0.40962,0.4096),
-            QVector3D(0.40432,0.40441,0.40439),
-            QVector3D(0.39912,0.39921,0.39919),
-            QVector3D(0.39395,0.39403,0.39401),
-            QVector3D(0.38878,0.38887,0.38885),
-            QVector3D(0.38363,0.38371,0.38369),
-            QVector3D(0.37848,0.37856,0.37854),
-            QVector3D(0.37334,0.37342,0.3734),
-            QVector3D(0.36822,0.36831,0.36829),
-            QVector3D(0.36311,0.36319,0.36317),
-            QVector3D(0.35802,0.3581,0.35808),
-            QVector3D(0.35294,0.35302,0.353),
-            QVector3D(0.34787,0.34794,0.34793),
-            QVector3D(0.34282,0.34289,0.34287),
-            QVector3D(0.33776,0.33783,0.33781),
-            QVector3D(0.33274,0.33281,0.3328),
-            QVector3D(0.3277,0.32778,0.32776),
-            QVector3D(0.32271,0.32278,0.32276),
-            QVector3D(0.31771,0.31778,0.31776),
-            QVector3D(0.31272,0.31279,0.31277),
-            QVector3D(0.30775,0.30782,0.3078),
-            QVector3D(0.3028,0.30286,0.30285),
-            QVector3D(0.29786,0.29793,0.29791),
-            QVector3D(0.29294,0.293,0.29299),
-            QVector3D(0.28802,0.28809,0.28807),
-            QVector3D(0.28314,0.2832,0.28319),
-            QVector3D(0.27826,0.27832,0.2783),
-            QVector3D(0.27339,0.27345,0.27344),
-            QVector3D(0.26853,0.2686,0.26858),
-            QVector3D(0.2637,0.26376,0.26375),
-            QVector3D(0.25887,0.25893,0.25892),
-            QVector3D(0.25406,0.25412,0.2541),
-            QVector3D(0.24925,0.24931,0.2493),
-            QVector3D(0.24446,0.24452,0.24451),
-            QVector3D(0.23973,0.23978,0.23977),
-            QVector3D(0.23502,0.23508,0.23506),
-            QVector3D(0.2303,0.23036,0.23034),
-            QVector3D(0.22568,0.22573,0.22572),
-            QVector3D(0.22109,0.22114,0.22113),
-            QVector3D(0.21656,0.21662,0.2166),
-            QVector3D(0.21212,0.21217,0.21216),
-            QVector3D(0.20777,0.20782,0.20781),
-            QVector3D(0.20358,0.20363,0.20361),
-            QVector3D(0.19951,0.19955,0.19954),
-            QVector3D(0.19568,0.19573,0.19572),
-            QVector3D(0.19207,0.19212,0.19211),
-            QVector3D(0.18876,0.1888,0.18879),
-            QVector3D(0.18577,0.18581,0.1858),
-            QVector3D(0.18308,0.18313,0.18312),
-            QVector3D(0.18084,0.18089,0.18087),
-            QVector3D(0.17906,0.1791,0.17909),
-            QVector3D(0.17775,0.1778,0.17779),
-            QVector3D(0.17689,0.17694,0.17693),
-            QVector3D(0.17656,0.1766,0.17659),
-            QVector3D(0.17676,0.17681,0.1768),
-            QVector3D(0.1775,0.17755,0.17754),
-            QVector3D(0.17871,0.17875,0.17874),
-            QVector3D(0.18037,0.18041,0.1804),
-            QVector3D(0.1825,0.18255,0.18254),
-            QVector3D(0.18509,0.18514,0.18512),
-            QVector3D(0.18802,0.18807,0.18806),
-            QVector3D(0.19124,0.19129,0.19128),
-            QVector3D(0.19481,0.19485,0.19484),
-            QVector3D(0.19857,0.19862,0.19861),
-            QVector3D(0.20257,0.20262,0.20261),
-            QVector3D(0.20676,0.20681,0.2068),
-            QVector3D(0.21105,0.2111,0.21109),
-            QVector3D(0.21547,0.21552,0.21551),
-            QVector3D(0.21999,0.22004,0.22003),
-            QVector3D(0.22453,0.22458,0.22457),
-            QVector3D(0.22919,0.22924,0.22923),
-            QVector3D(0.23386,0.23392,0.2339),
-            QVector3D(0.23857,0.23863,0.23862),
-            QVector3D(0.24332,0.24337,0.24336),
-            QVector3D(0.24812,0.24817,0.24816),
-            QVector3D(0.2529,0.25295,0.25294),
-            QVector3D(0.25769,0.25775,0.25774),
-            QVector3D(0.26252,0.26258,0.26257),
-            QVector3D(0.26734,0.2674,0.26739),
-            QVector3D(0.27219,0.27226,0.27224),
-            QVector3D(0.27708,0.27714,0.27713),
-            QVector3D(0.28196,0.28203,0.28201),
-            QVector3D(0.28684,0.2869,0.28688),
-            QVector3D(0.29176,0.29183,0.29181),
-            QVector3D(0.29668,0.29675,0.29674),
-            QVector3D(0.3016,0.30167,0.30165),
-            QVector3D(0.30657,0.30664,0.30662),
-            QVector3D(0.31152,0.31159,0.31157),
-            QVector3D(0.31651,0.31658,0.31656),
-            QVector3D(0.32149,0.32156,0.32154),
-            QVector3D(0.32649,0.32656,0.32654),
-            QVector3D(0.33151,0.33158,0.33156),
-            QVector3D(0.33654,0.33662,0.3366),
-            QVector3D(0.34159,0.34166,0.34165),
-            QVector3D(0.34664,0.34672,0.3467),
-            QVector3D(0.3517,0.35178,0.35176),
-            QVector3D(0.3568,0.35688,0.35686),
-            QVector3D(0.36188,0.36196,0.36194),
-            QVector3D(0.36698,0.36706,0.36704),
-            QVector3D(0.37208,0.37216,0.37215),
-            QVector3D(0.37721,0.37729,0.37727),
-            QVector3D(0.38233,0.38241,0.38239),
-            QVector3D(0.38746,0.38755,0.38753),
-            QVector3D(0.3926,0.39269,0.39267),
-            QVector3D(0.39775,0.39784,0.39781),
-            QVector3D(0.40288,0.40297,0.40295),
-            QVector3D(0.40802,0.4081,0.40808),
-            QVector3D(0.41315,0.41324,0.41322),
-            QVector3D(0.41826,0.41834,0.41832),
-            QVector3D(0.42336,0.42345,0.42343),
-            QVector3D(0.42846,0.42855,0.42853),
-            QVector3D(0.43353,0.43362,0.4336),
-            QVector3D(0.43859,0.43868,0.43866),
-            QVector3D(0.44365,0.44374,0.44372),
-            QVector3D(0.44868,0.44878,0.44875),
-            QVector3D(0.4537,0.4538,0.45377),
-            QVector3D(0.45872,0.45882,0.4588),
-            QVector3D(0.46374,0.46385,0.46382)
-        },
-        {
-            QVector3D(0.17676,0.17681,0.1768),
-            QVector3D(0.1775,0.17755,0.17754),
-            QVector3D(0.17871,0.17875,0.17874),
-            QVector3D(0.18037,0.18041,0.1804),
-            QVector3D(0.1825,0.18255,0.18254),
-            QVector3D(0.18509,0.18514,0.18512),
-            QVector3D(0.18802,0.18807,0.18806),
-            QVector3D(0.19124,0.19129,0.19128),
-            QVector3D(0.19481,0.19485,0.19484),
-            QVector3D(0.19857,0.19862,0.19861),
-            QVector3D(0.20257,0.20262,0.20261),
-            QVector3D(0.20676,0.20681,0.2068),
-            QVector3D(0.21105,0.2111,0.21109),
-            QVector3D(0.21547,0.21552,0.21551),
-            QVector3D(0.21999,0.22004,0.22003),
-            QVector3D(0.22453,0.22458,0.22457),
-            QVector3D(0.22919,0.22924,0.22923),
-            QVector3D(0.23386,0.23392,0.2339),
-            QVector3D(0.23857,0.23863,0.23862),
-            QVector3D(0.24332,0.24337,0.24336),
-            QVector3D(0.24812,0.24817,0.24816),
-            QVector3D(0.2529,0.25295,0.25294),
-            QVector3D(0.25769,0.25775,0.25774),
-            QVector3D(0.26252,0.26258,0.26257),
-            QVector3D(0.26734,0.2674,0.26739),
-            QVector3D(0.27219,0.27226,0.27224),
-            QVector3D(0.27708,0.27714,0.27713),
-            QVector3D(0.28196,0.28203,0.28201),
-            QVector3D(0.28684,0.2869,0.28688),
-            QVector3D(0.29176,0.29183,0.29181),
-            QVector3D(0.29668,0.29675,0.29674),
-            QVector3D(0.3016,0.30167,0.30165),
-            QVector3D(0.30657,0.30664,0.30662),
-            QVector3D(0.31152,0.31159,0.31157),
-            QVector3D(0.31651,0.31658,0.31656),
-            QVector3D(0.32149,0.32156,0.32154),
-            QVector3D(0.32649,0.32656,0.32654),
-            QVector3D(0.33151,0.33158,0.33156),
-            QVector3D(0.33654,0.33662,0.3366),
-            QVector3D(0.34159,0.34166,0.34165),
-            QVector3D(0.34664,0.34672,0.3467),
-            QVector3D(0.3517,0.35178,0.35176),
-            QVector3D(0.3568,0.35688,0.35686),
-            QVector3D(0.36188,0.36196,0.36194),
-            QVector3D(0.36698,0.36706,0.36704),
-            QVector3D(0.37208,0.37216,0.37215),
-            QVector3D(0.37721,0.37729,0.37727),
-            QVector3D(0.38233,0.38241,0.38239),
-            QVector3D(0.38746,0.38755,0.38753),
-            QVector3D(0.3926,0.39269,0.39267),
-            QVector3D(0.39775,0.39784,0.39781),
-            QVector3D(0.40288,0.40297,0.40295),
-            QVector3D(0.40802,0.4081,0.40808),
-            QVector3D(0.41315,0.41324,0.41322),
-            QVector3D(0.41826,0.41834,0.41832),
-            QVector3D(0.42336,0.42345,0.42343),
-            QVector3D(0.42846,0.42855,0.42853),
-            QVector3D(0.43353,0.43362,0.4336),
-            QVector3D(0.43859,0.43868,0.43866),
-            QVector3D(0.44365,0.44374,0.44372),
-            QVector3D(0.44868,0.44878,0.44875),
-            QVector3D(0.4537,0.4538,0.45377),
-            QVector3D(0.45872,0.45882,0.4588),
-            QVector3D(0.46374,0.46385,0.46382),
-            QVector3D(0.46877,0.46888,0.46885),
-            QVector3D(0.47381,0.47391,0.47389),
-            QVector3D(0.47887,0.47897,0.47895),
-            QVector3D(0.48395,0.48405,0.48403),
-            QVector3D(0.48907,0.48917,0.48914),
-            QVector3D(0.49422,0.49432,0.4943),
-            QVector3D(0.49939,0.49949,0.49947),
-            QVector3D(0.50462,0.50472,0.5047),
-            QVector3D(0.50986,0.50997,0.50994),
-            QVector3D(0.51515,0.51526,0.51523),
-            QVector3D(0.52047,0.52058,0.52056),
-            QVector3D(0.52583,0.52594,0.52592),
-            QVector3D(0.53121,0.53132,0.5313),
-            QVector3D(0.53663,0.53674,0.53671),
-            QVector3D(0.54205,0.54217,0.54214),
-            QVector3D(0.5475,0.54762,0.54759),
-            QVector3D(0.55297,0.55309,0.55306),
-            QVector3D(0.55846,0.55857,0.55855),
-            QVector3D(0.56397,0.56409,0.56406),
-            QVector3D(0.56948,0.5696,0.56957),
-            QVector3D(0.57501,0.57513,0.5751),
-            QVector3D(0.58055,0.58067,0.58064),
-            QVector3D(0.58611,0.58623,0.5862),
-            QVector3D(0.59167,0.59179,0.59176),
-            QVector3D(0.59724,0.59737,0.59734),
-            QVector3D(0.60282,0.60295,0.60292),
-            QVector3D(0.60842,0.60855,0.60852),
-            QVector3D(0.61401,0.61414,0.6141),
-            QVector3D(0.61963,0.61976,0.61973),
-            QVector3D(0.62524,0.62537,0.62534),
-            QVector3D(0.63088,0.63101,0.63098),
-            QVector3D(0.63652,0.63665,0.63662),
-            QVector3D(0.64216,0.64229,0.64226),
-            QVector3D(0.64781,0.64795,0.64791),
-            QVector3D(0.65348,0.65361,0.65358),
-            QVector3D(0.65915,0.65929,0.65926),
-            QVector3D(0.66484,0.66497,0.66494),
-            QVector3D(0.67054,0.67067,0.67064),
-            QVector3D(0.67624,0.67637,0.67634),
-            QVector3D(0.68194,0.68208,0.68205),
-            QVector3D(0.68766,0.68781,0.68777),
-            QVector3D(0.69339,0.69353,0.6935),
-            QVector3D(0.69913,0.69927,0.69923),
-            QVector3D(0.70487,0.70502,0.70498),
-            QVector3D(0.71062,0.71076,0.71073),
-            QVector3D(0.71636,0.71651,0.71647),
-            QVector3D(0.72208,0.72223,0.72219),
-            QVector3D(0.72779,0.72794,0.72791),
-            QVector3D(0.73347,0.73362,0.73359),
-            QVector3D(0.73911,0.73926,0.73922),
-            QVector3D(0.74467,0.74482,0.74478),
-            QVector3D(0.75014,0.75029,0.75026),
-            QVector3D(0.75549,0.75565,0.75561),
-            QVector3D(0.76068,0.76083,0.7608),
-            QVector3D(0.76567,0.76582,0.76578),
-            QVector3D(0.77039,0.77055,0.77051),
-            QVector3D(0.77481,0.77497,0.77493),
-            QVector3D(0.77887,0.77903,0.77899),
-            QVector3D(0.7825,0.78266,0.78262),
-            QVector3D(0.78566,0.78581,0.78578),
-            QVector3D(0.78827,0.78843,0.78839),
-            QVector3D(0.79029,0.79045,0.79041),
-            QVector3D(0.79169,0.79185,0.79182),
-            QVector3D(0.79244,0.7926,0.79257),
-            QVector3D(0.79252,0.79269,0.79265),
-            QVector3D(0.79193,0.79209,0.79205),
-            QVector3D(0.79069,0.79085,0.79081),
-            QVector3D(0.78881,0.78897,0.78893),
-            QVector3D(0.78633,0.78649,0.78645),
-            QVector3D(0.7833,0.78346,0.78342),
-            QVector3D(0.77978,0.77994,0.7799),
-            QVector3D(0.77582,0.77598,0.77594),
-            QVector3D(0.77149,0.77164,0.7716),
-            QVector3D(0.76682,0.76698,0.76694),
-            QVector3D(0.76189,0.76205,0.76201),
-            QVector3D(0.75675,0.75691,0.75687),
-            QVector3D(0.75145,0.7516,0.75156),
-            QVector3D(0.746,0.74615,0.74611),
-            QVector3D(0.74045,0.7406,0.74056),
-            QVector3D(0.73484,0.73499,0.73495),
-            QVector3D(0.72917,0.72932,0.72928),
-            QVector3D(0.72346,0.72361,0.72357),
-            QVector3D(0.71774,0.71789,0.71785),
-            QVector3D(0.712,0.71215,0.71211),
-            QVector3D(0.70626,0.70641,0.70637),
-            QVector3D(0.70052,0.70066,0.70062),
-            QVector3D(0.69477,0.69492,0.69488),
-            QVector3D(0.68905,0.68919,0.68916),
-            QVector3D(0.68333,0.68346,0.68343),
-            QVector3D(0.67762,0.67776,0.67772),
-            QVector3D(0.67191,0.67205,0.67201),
-            QVector3D(0.66621,0.66635,0.66631),
-            QVector3D(0.66052,0.66066,0.66063),
-            QVector3D(0.65485,0.65498,0.65495),
-            QVector3D(0.64919,0.64932,0.64929),
-            QVector3D(0.64352,0.64365,0.64362),
-            QVector3D(0.63787,0.63801,0.63797),
-            QVector3D(0.63223,0.63236,0.63233),
-            QVector3D(0.6266,0.62673,0.6267),
-            QVector3D(0.62098,0.62111,0.62108),
-            QVector3D(0.61536,0.61549,0.61546),
-            QVector3D(0.60976,0.60989,0.60986),
-            QVector3D(0.60418,0.6043,0.60427),
-            QVector3D(0.59858,0.59871,0.59868),
-            QVector3D(0.59302,0.59314,0.59311),
-            QVector3D(0.58744,0.58756,0.58753),
-            QVector3D(0.58189,0.58201,0.58198),
-            QVector3D(0.57635,0.57647,0.57644),
-            QVector3D(0.57081,0.57092,0.5709),
-            QVector3D(0.56528,0.56539,0.56537),
-            QVector3D(0.55977,0.55989,0.55986),
-            QVector3D(0.55426,0.55438,0.55435),
-            QVector3D(0.54877,0.54888,0.54886),
-            QVector3D(0.54328,0.54339,0.54336),
-            QVector3D(0.53781,0.53792,0.53789),
-            QVector3D(0.53234,0.53245,0.53242),
-            QVector3D(0.52688,0.52699,0.52697),
-            QVector3D(0.52143,0.52154,0.52151),
-            QVector3D(0.51599,0.5161,0.51607),
-            QVector3D(0.51057,0.51067,0.51065),
-            QVector3D(0.50515,0.50526,0.50523),
-            QVector3D(0.49974,0.49985,0.49982),
-            QVector3D(0.49436,0.49446,0.49444),
-            QVector3D(0.48897,0.48907,0.48905),
-            QVector3D(0.48359,0.4837,0.48367),
-            QVector3D(0.47824,0.47834,0.47831),
-            QVector3D(0.47288,0.47298,0.47295),
-            QVector3D(0.46755,0.46764,0.46762),
-            QVector3D(0.46221,0.46231,0.46229),
-            QVector3D(0.45689,0.45699,0.45697),
-            QVector3D(0.45159,0.45169,0.45166),
-            QVector3D(0.44629,0.44638,0.44636),
-            QVector3D(0.441,0.44109,0.44107),
-            QVector3D(0.43574,0.43583,0.43581),
-            QVector3D(0.43047,0.43056,0.43054),
-            QVector3D(0.42522,0.42531,0.42529),
-            QVector3D(0.41998,0.42007,0.42004),
-            QVector3D(0.41475,0.41483,0.41481),
-            QVector3D(0.40953,0.40962,0.4096),
-            QVector3D(0.40432,0.40441,0.40439),
-            QVector3D(0.39912,0.39921,0.39919),
-            QVector3D(0.39395,0.39403,0.39401),
-            QVector3D(0.38878,0.38887,0.38885),
-            QVector3D(0.38363,0.38371,0.38369),
-            QVector3D(0.37848,0.37856,0.37854),
-            QVector3D(0.37334,0.37342,0.3734),
-            QVector3D(0.36822,0.36831,0.36829),
-            QVector3D(0.36311,0.36319,0.36317),
-            QVector3D(0.35802,0.3581,0.35808),
-            QVector3D(0.35294,0.35302,0.353),
-            QVector3D(0.34787,0.34794,0.34793),
-            QVector3D(0.34282,0.34289,0.34287),
-            QVector3D(0.33776,0.33783,0.33781),
-            QVector3D(0.33274,0.33281,0.3328),
-            QVector3D(0.3277,0.32778,0.32776),
-            QVector3D(0.32271,0.32278,0.32276),
-            QVector3D(0.31771,0.31778,0.31776),
-            QVector3D(0.31272,0.31279,0.31277),
-            QVector3D(0.30775,0.30782,0.3078),
-            QVector3D(0.3028,0.30286,0.30285),
-            QVector3D(0.29786,0.29793,0.29791),
-            QVector3D(0.29294,0.293,0.29299),
-            QVector3D(0.28802,0.28809,0.28807),
-            QVector3D(0.28314,0.2832,0.28319),
-            QVector3D(0.27826,0.27832,0.2783),
-            QVector3D(0.27339,0.27345,0.27344),
-            QVector3D(0.26853,0.2686,0.26858),
-            QVector3D(0.2637,0.26376,0.26375),
-            QVector3D(0.25887,0.25893,0.25892),
-            QVector3D(0.25406,0.25412,0.2541),
-            QVector3D(0.24925,0.24931,0.2493),
-            QVector3D(0.24446,0.24452,0.24451),
-            QVector3D(0.23973,0.23978,0.23977),
-            QVector3D(0.23502,0.23508,0.23506),
-            QVector3D(0.2303,0.23036,0.23034),
-            QVector3D(0.22568,0.22573,0.22572),
-            QVector3D(0.22109,0.22114,0.22113),
-            QVector3D(0.21656,0.21662,0.2166),
-            QVector3D(0.21212,0.21217,0.21216),
-            QVector3D(0.20777,0.20782,0.20781),
-            QVector3D(0.20358,0.20363,0.20361),
-            QVector3D(0.19951,0.19955,0.19954),
-            QVector3D(0.19568,0.19573,0.19572),
-            QVector3D(0.19207,0.19212,0.19211),
-            QVector3D(0.18876,0.1888,0.18879),
-            QVector3D(0.18577,0.18581,0.1858),
-            QVector3D(0.18308,0.18313,0.18312),
-            QVector3D(0.18084,0.18089,0.18087),
-            QVector3D(0.17906,0.1791,0.17909),
-            QVector3D(0.17775,0.1778,0.17779),
-            QVector3D(0.17689,0.17694,0.17693),
-            QVector3D(0.17656,0.1766,0.17659)
-        },
-        {
-            QVector3D(0.97561,0.52012,0.97096),
-            QVector3D(0.98033,0.51722,0.96319),
-            QVector3D(0.9842,0.51357,0.95448),
-            QVector3D(0.98725,0.50922,0.94488),
-            QVector3D(0.98954,0.5042,0.93442),
-            QVector3D(0.99112,0.49856,0.9232),
-            QVector3D(0.99204,0.49233,0.91126),
-            QVector3D(0.99239,0.48561,0.89871),
-            QVector3D(0.99221,0.47844,0.88563),
-            QVector3D(0.99158,0.47088,0.87209),
-            QVector3D(0.99055,0.46298,0.85819),
-            QVector3D(0.98919,0.45483,0.84399),
-            QVector3D(0.98754,0.44642,0.82958),
-            QVector3D(0.98565,0.43783,0.81499),
-            QVector3D(0.98354,0.42907,0.80029),
-            QVector3D(0.98125,0.42019,0.78551),
-            QVector3D(0.97879,0.4112,0.77068),
-            QVector3D(0.97618,0.40212,0.75583),
-            QVector3D(0.97344,0.39297,0.74098),
-            QVector3D(0.97057,0.38376,0.72614),
-            QVector3D(0.96757,0.3745,0.71131),
-            QVector3D(0.96444,0.36519,0.6965),
-            QVector3D(0.96118,0.35586,0.6817),
-            QVector3D(0.95779,0.3465,0.66694),
-            QVector3D(0.95425,0.33716,0.65219),
-            QVector3D(0.95055,0.3278,0.63745),
-            QVector3D(0.94668,0.31849,0.62271),
-            QVector3D(0.94264,0.30923,0.60798),
-            QVector3D(0.93839,0.3,0.59322),
-            QVector3D(0.93394,0.29087,0.57844),
-            QVector3D(0.92929,0.28185,0.56366),
-            QVector3D(0.92441,0.27294,0.54883),
-            QVector3D(0.91931,0.26418,0.53396),
-            QVector3D(0.91398,0.25557,0.51908),
-            QVector3D(0.90842,0.24712,0.50415),
-            QVector3D(0.90264,0.23883,0.48918),
-            QVector3D(0.89665,0.23073,0.47419),
-            QVector3D(0.89044,0.22281,0.45918),
-            QVector3D(0.88405,0.21501,0.44415),
-            QVector3D(0.87747,0.2074,0.42911),
-            QVector3D(0.87072,0.19987,0.41407),
-            QVector3D(0.86383,0.1925,0.39903),
-            QVector3D(0.85679,0.18523,0.38401),
-            QVector3D(0.84962,0.17801,0.369),
-            QVector3D(0.84235,0.17082,0.35401),
-            QVector3D(0.83498,0.16373,0.33907),
-            QVector3D(0.82753,0.15664,0.32416),
-            QVector3D(0.82001,0.14962,0.30933),
-            QVector3D(0.81245,0.14261,0.29452),
-            QVector3D(0.80486,0.13567,0.27982),
-            QVector3D(0.79725,0.12885,0.26518),
-            QVector3D(0.78966,0.12217,0.25066),
-            QVector3D(0.78212,0.11578,0.23628),
-            QVector3D(0.77464,0.1097,0.22201),
-            QVector3D(0.7673,0.104,0.20795),
-            QVector3D(0.76012,0.098945,0.19412),
-            QVector3D(0.75317,0.094721,0.18049),
-            QVector3D(0.74652,0.091421,0.16723),
-            QVector3D(0.74022,0.089258,0.15426),
-            QVector3D(0.73434,0.088445,0.14174),
-            QVector3D(0.72894,0.089069,0.12963),
-            QVector3D(0.7241,0.091195,0.118),
-            QVector3D(0.71988,0.094767,0.10689),
-            QVector3D(0.71631,0.099636,0.096236),
-            QVector3D(0.71343,0.1058,0.086225),
-            QVector3D(0.71128,0.11302,0.076774),
-            QVector3D(0.70983,0.12104,0.068001),
-            QVector3D(0.7091,0.12989,0.05981),
-            QVector3D(0.70904,0.1392,0.052084),
-            QVector3D(0.70963,0.14902,0.04517),
-            QVector3D(0.71081,0.15914,0.038855),
-            QVector3D(0.71251,0.1695,0.033292),
-            QVector3D(0.7147,0.17995,0.028947),
-            QVector3D(0.71729,0.1905,0.02547),
-            QVector3D(0.72021,0.20107,0.022733),
-            QVector3D(0.72342,0.21166,0.020622),
-            QVector3D(0.72685,0.22214,0.019034),
-            QVector3D(0.73046,0.23256,0.017876),
-            QVector3D(0.73419,0.24288,0.017071),
-            QVector3D(0.73802,0.25311,0.016547),
-            QVector3D(0.74191,0.26323,0.016249),
-            QVector3D(0.74585,0.27322,0.016125),
-            QVector3D(0.74979,0.28311,0.016137),
-            QVector3D(0.75375,0.29288,0.01625),
-            QVector3D(0.75769,0.30257,0.01644),
-            QVector3D(0.76161,0.31217,0.016684),
-            QVector3D(0.7655,0.32171,0.016989),
-            QVector3D(0.76932,0.33117,0.017296),
-            QVector3D(0.7731,0.34058,0.0176),
-            QVector3D(0.77681,0.34994,0.017896),
-            QVector3D(0.78044,0.35925,0.018177),
-            QVector3D(0.784,0.36855,0.018435),
-            QVector3D(0.78746,0.37783,0.018665),
-            QVector3D(0.79082,0.38709,0.018861),
-            QVector3D(0.79409,0.39636,0.019014),
-            QVector3D(0.79724,0.40564,0.019122),
-            QVector3D(0.80029,0.4149,0.019179),
-            QVector3D(0.80322,0.42418,0.019183),
-            QVector3D(0.80605,0.43346,0.019132),
-            QVector3D(0.80876,0.44276,0.019026),
-            QVector3D(0.81136,0.45205,0.018866),
-            QVector3D(0.81386,0.46134,0.018654),
-            QVector3D(0.81626,0.47063,0.018394),
-            QVector3D(0.81857,0.47992,0.01809),
-            QVector3D(0.8208,0.48918,0.017747),
-            QVector3D(0.82295,0.49846,0.017369),
-            QVector3D(0.82503,0.50771,0.016963),
-            QVector3D(0.82704,0.51694,0.016575),
-            QVector3D(0.82898,0.52615,0.016225),
-            QVector3D(0.83084,0.53532,0.015949),
-            QVector3D(0.83262,0.54446,0.015792),
-            QVector3D(0.83431,0.55354,0.01582),
-            QVector3D(0.8359,0.56257,0.016118),
-            QVector3D(0.83738,0.5715,0.016798),
-            QVector3D(0.8387,0.58035,0.018004),
-            QVector3D(0.83985,0.58906,0.019918),
-            QVector3D(0.84077,0.59761,0.022763),
-            QVector3D(0.84143,0.60595,0.02681),
-            QVector3D(0.84177,0.61404,0.032376),
-            QVector3D(0.84173,0.62182,0.040011),
-            QVector3D(0.84125,0.62922,0.04912),
-            QVector3D(0.84026,0.63619,0.059305),
-            QVector3D(0.83868,0.64264,0.070471),
-            QVector3D(0.83647,0.6485,0.08264),
-            QVector3D(0.83356,0.65372,0.095596),
-            QVector3D(0.82989,0.65824,0.10926),
-            QVector3D(0.82544,0.66201,0.12343),
-            QVector3D(0.82017,0.66498,0.13819),
-            QVector3D(0.81408,0.66715,0.15321),
-            QVector3D(0.80717,0.66852,0.16856),
-            QVector3D(0.79947,0.66908,0.18405),
-            QVector3D(0.79098,0.66887,0.19961),
-            QVector3D(0.78178,0.66795,0.2152),
-            QVector3D(0.7719,0.66635,0.23072),
-            QVector3D(0.76139,0.66416,0.2461),
-            QVector3D(0.75032,0.66143,0.26133),
-            QVector3D(0.73873,0.65825,0.27636),
-            QVector3D(0.72668,0.65467,0.29113),
-            QVector3D(0.71421,0.65077,0.30567),
-            QVector3D(0.70137,0.64662,0.31995),
-            QVector3D(0.68818,0.64226,0.33397),
-            QVector3D(0.67466,0.63773,0.34774),
-            QVector3D(0.66084,0.6331,0.36127),
-            QVector3D(0.64671,0.62838,0.37458),
-            QVector3D(0.63228,0.6236,0.38765),
-            QVector3D(0.61753,0.61878,0.40056),
-            QVector3D(0.60245,0.61393,0.41326),
-            QVector3D(0.58703,0.60909,0.42578),
-            QVector3D(0.57126,0.60423,0.43817),
-            QVector3D(0.55511,0.59936,0.4504),
-            QVector3D(0.53858,0.59449,0.4625),
-            QVector3D(0.5216,0.58962,0.47451),
-            QVector3D(0.5042,0.58475,0.4864),
-            QVector3D(0.48632,0.57986,0.49821),
-            QVector3D(0.46796,0.57493,0.50993),
-            QVector3D(0.44912,0.56996,0.5216),
-            QVector3D(0.42978,0.56493,0.53322),
-            QVector3D(0.40998,0.55983,0.5448),
-            QVector3D(0.38972,0.55461,0.55635),
-            QVector3D(0.36908,0.54926,0.56789),
-            QVector3D(0.3481,0.54375,0.57943),
-            QVector3D(0.32688,0.53805,0.59098),
-            QVector3D(0.30556,0.53211,0.60256),
-            QVector3D(0.28424,0.52592,0.61416),
-            QVector3D(0.26316,0.51945,0.62583),
-            QVector3D(0.2425,0.51265,0.63755),
-            QVector3D(0.22257,0.50551,0.64934),
-            QVector3D(0.20368,0.49802,0.66119),
-            QVector3D(0.18619,0.49012,0.67313),
-            QVector3D(0.17051,0.48183,0.68514),
-            QVector3D(0.15712,0.47312,0.69723),
-            QVector3D(0.14638,0.46402,0.70941),
-            QVector3D(0.13859,0.4545,0.72164),
-            QVector3D(0.1338,0.44458,0.73395),
-            QVector3D(0.1319,0.43426,0.7463),
-            QVector3D(0.13253,0.42359,0.75869),
-            QVector3D(0.13519,0.4126,0.77109),
-            QVector3D(0.1393,0.40128,0.7835),
-            QVector3D(0.1445,0.38969,0.79588),
-            QVector3D(0.15024,0.3779,0.80821),
-            QVector3D(0.1563,0.36594,0.82045),
-            QVector3D(0.16246,0.35387,0.83257),
-            QVector3D(0.16864,0.34179,0.84452),
-            QVector3D(0.17484,0.32979,0.85623),
-            QVector3D(0.18105,0.31794,0.86767),
-            QVector3D(0.18746,0.30639,0.87875),
-            QVector3D(0.19408,0.29524,0.88943),
-            QVector3D(0.20101,0.28465,0.89962),
-            QVector3D(0.20848,0.27478,0.90926),
-            QVector3D(0.2165,0.26579,0.9183),
-            QVector3D(0.22506,0.25778,0.92668),
-            QVector3D(0.2343,0.25098,0.93436),
-            QVector3D(0.24409,0.24544,0.94131),
-            QVector3D(0.25448,0.24134,0.94753),
-            QVector3D(0.26529,0.23866,0.95301),
-            QVector3D(0.27652,0.2375,0.95778),
-            QVector3D(0.28798,0.23773,0.96185),
-            QVector3D(0.29964,0.23933,0.9653),
-            QVector3D(0.31135,0.24218,0.96816),
-            QVector3D(0.32305,0.24613,0.9705),
-            QVector3D(0.33464,0.25106,0.97238),
-            QVector3D(0.34606,0.25676,0.97386),
-            QVector3D(0.35733,0.26313,0.97502),
-            QVector3D(0.36835,0.27,0.9759),
-            QVector3D(0.37916,0.27724,0.97657),
-            QVector3D(0.38973,0.28476,0.97706),
-            QVector3D(0.40009,0.2925,0.97742),
-            QVector3D(0.41026,0.30036,0.97768),
-            QVector3D(0.42023,0.3083,0.97787),
-            QVector3D(0.43006,0.31627,0.978),
-            QVector3D(0.43977,0.32421,0.97811),
-            QVector3D(0.4494,0.33213,0.9782),
-            QVector3D(0.459,0.33997,0.97829),
-            QVector3D(0.46859,0.34772,0.97838),
-            QVector3D(0.47825,0.35536,0.97849),
-            QVector3D(0.48802,0.36282,0.97864),
-            QVector3D(0.49795,0.37015,0.97883),
-            QVector3D(0.50807,0.3773,0.97906),
-            QVector3D(0.51845,0.38426,0.97935),
-            QVector3D(0.52912,0.39102,0.97969),
-            QVector3D(0.5401,0.39755,0.9801),
-            QVector3D(0.55143,0.40386,0.98057),
-            QVector3D(0.56311,0.40995,0.98111),
-            QVector3D(0.57513,0.41579,0.98173),
-            QVector3D(0.58751,0.4214,0.98242),
-            QVector3D(0.60022,0.42681,0.98317),
-            QVector3D(0.61322,0.43201,0.984),
-            QVector3D(0.6265,0.437,0.98489),
-            QVector3D(0.64002,0.44182,0.98583),
-            QVector3D(0.65371,0.44647,0.98682),
-            QVector3D(0.66757,0.45099,0.98786),
-            QVector3D(0.68153,0.4554,0.98894),
-            QVector3D(0.69558,0.4597,0.99005),
-            QVector3D(0.70967,0.46392,0.99118),
-            QVector3D(0.72376,0.46807,0.99233),
-            QVector3D(0.73785,0.47218,0.9935),
-            QVector3D(0.7519,0.47624,0.99467),
-            QVector3D(0.76589,0.48026,0.99582),
-            QVector3D(0.77979,0.48425,0.99696),
-            QVector3D(0.79361,0.48821,0.99807),
-            QVector3D(0.80729,0.49211,0.99913),
-            QVector3D(0.82083,0.49595,1),
-            QVector3D(0.8342,0.49972,1),
-            QVector3D(0.84736,0.50339,1),
-            QVector3D(0.86029,0.50693,1),
-            QVector3D(0.87292,0.5103,1),
-            QVector3D(0.8852,0.51345,1),
-            QVector3D(0.89709,0.51632,1),
-            QVector3D(0.90851,0.51889,1),
-            QVector3D(0.91939,0.52104,1),
-            QVector3D(0.92968,0.52273,0.99852),
-            QVector3D(0.9393,0.52391,0.996),
-            QVector3D(0.94819,0.5245,0.99274),
-            QVector3D(0.95631,0.52446,0.98864),
-            QVector3D(0.9636,0.52374,0.98368),
-            QVector3D(0.97003,0.52229,0.97779)
-        },
-        {
-            QVector3D(0.24409,0.24544,0.94131),
-            QVector3D(0.25448,0.24134,0.94753),
-            QVector3D(0.26529,0.23866,0.95301),
-            QVector3D(0.27652,0.2375,0.95778),
-            QVector3D(0.28798,0.23773,0.96185),
-            QVector3D(0.29964,0.23933,0.9653),
-            QVector3D(0.31135,0.24218,0.96816),
-            QVector3D(0.32305,0.24613,0.9705),
-            QVector3D(0.33464,0.25106,0.97238),
-            QVector3D(0.34606,0.25676,0.97386),
-            QVector3D(0.35733,0.26313,0.97502),
-            QVector3D(0.36835,0.27,0.9759),
-            QVector3D(0.37916,0.27724,0.97657),
-            QVector3D(0.38973,0.28476,0.97706),
-            QVector3D(0.40009,0.2925,0.97742),
-            QVector3D(0.41026,0.30036,0.97768),
-            QVector3D(0.42023,0.3083,0.97787),
-            QVector3D(0.43006,0.31627,0.978),
-            QVector3D(0.43977,0.32421,0.97811),
-            QVector3D(0.4494,0.33213,0.9782),
-            QVector3D(0.459,0.33997,0.97829),
-            QVector3D(0.46859,0.34772,0.97838),
-            QVector3D(0.47825,0.35536,0.97849),
-            QVector3D(0.48802,0.36282,0.97864),
-            QVector3D(0.49795,0.37015,0.97883),
-            QVector3D(0.50807,0.3773,0.97906),
-            QVector3D(0.51845,0.38426,0.97935),
-            QVector3D(0.52912,0.39102,0.97969),
-            QVector3D(0.5401,0.39755,0.9801),
-            QVector3D(0.55143,0.40386,0.98057),
-            QVector3D(0.56311,0.40995,0.98111),
-            QVector3D(0.57513,0.41579,0.98173),
-            QVector3D(0.58751,0.4214,0.98242),
-            QVector3D(0.60022,0.42681,0.98317),
-            QVector3D(0.61322,0.43201,0.984),
-            QVector3D(0.6265,0.437,0.98489),
-            QVector3D(0.64002,0.44182,0.98583),
-            QVector3D(0.65371,0.44647,0.98682),
-            QVector3D(0.66757,0.45099,0.98786),
-            QVector3D(0.68153,0.4554,0.98894),
-            QVector3D(0.69558,0.4597,0.99005),
-            QVector3D(0.70967,0.46392,0.99118),
-            QVector3D(0.72376,0.46807,0.99233),
-            QVector3D(0.73785,0.47218,0.9935),
-            QVector3D(0.7519,0.47624,0.99467),
-            QVector3D(0.76589,0.48026,0.99582),
-            QVector3D(0.77979,0.48425,0.99696),
-            QVector3D(0.79361,0.48821,0.99807),
-            QVector3D(0.80729,0.49211,0.99913),
-            QVector3D(0.82083,0.49595,1),
-            QVector3D(0.8342,0.49972,1),
-            QVector3D(0.84736,0.50339,1),
-            QVector3D(0.86029,0.50693,1),
-            QVector3D(0.87292,0.5103,1),
-            QVector3D(0.8852,0.51345,1),
-            QVector3D(0.89709,0.51632,1),
-            QVector3D(0.90851,0.51889,1),
-            QVector3D(0.91939,0.52104,1),
-            QVector3D(0.92968,0.52273,0.99852),
-            QVector3D(0.9393,0.52391,0.996),
-            QVector3D(0.94819,0.5245,0.99274),
-            QVector3D(0.95631,0.52446,0.98864),
-            QVector3D(0.9636,0.52374,0.98368),
-            QVector3D(0.97003,0.52229,0.97779),
-            QVector3D(0.97561,0.52012,0.97096),
-            QVector3D(0.98033,0.51722,0.96319),
-            QVector3D(0.9842,0.51357,0.95448),
-            QVector3D(0.98725,0.50922,0.94488),
-            QVector3D(0.98954,0.5042,0.93442),
-            QVector3D(0.99112,0.49856,0.9232),
-            QVector3D(0.99204,0.49233,0.91126),
-            QVector3D(0.99239,0.48561,0.89871),
-            QVector3D(0.99221,0.47844,0.88563),
-            QVector3D(0.99158,0.47088,0.87209),
-            QVector3D(0.99055,0.46298,0.85819),
-            QVector3D(0.98919,0.45483,0.84399),
-            QVector3D(0.98754,0.44642,0.82958),
-            QVector3D(0.98565,0.43783,0.81499),
-            QVector3D(0.98354,0.42907,0.80029),
-            QVector3D(0.98125,0.42019,0.78551),
-            QVector3D(0.97879,0.4112,0.77068),
-            QVector3D(0.97618,0.40212,0.75583),
-            QVector3D(0.97344,0.39297,0.74098),
-            QVector3D(0.97057,0.38376,0.72614),
-            QVector3D(0.96757,0.3745,0.71131),
-            QVector3D(0.96444,0.36519,0.6965),
-            QVector3D(0.96118,0.35586,0.6817),
-            QVector3D(0.95779,0.3465,0.66694),
-            QVector3D(0.95425,0.33716,0.65219),
-            QVector3D(0.95055,0.3278,0.63745),
-            QVector3D(0.94668,0.31849,0.62271),
-            QVector3D(0.94264,0.30923,0.60798),
-            QVector3D(0.93839,0.3,0.59322),
-            QVector3D(0.93394,0.29087,0.57844),
-            QVector3D(0.92929,0.28185,0.56366),
-            QVector3D(0.92441,0.27294,0.54883),
-            QVector3D(0.91931,0.26418,0.53396),
-            QVector3D(0.91398,0.25557,0.51908),
-            QVector3D(0.90842,0.24712,0.50415),
-            QVector3D(0.90264,0.23883,0.48918),
-            QVector3D(0.89665,0.23073,0.47419),
-            QVector3D(0.89044,0.22281,0.45918),
-            QVector3D(0.88405,0.21501,0.44415),
-            QVector3D(0.87747,0.2074,0.42911),
-            QVector3D(0.87072,0.19987,0.41407),
-            QVector3D(0.86383,0.1925,0.39903),
-            QVector3D(0.85679,0.18523,0.38401),
-            QVector3D(0.84962,0.17801,0.369),
-            QVector3D(0.84235,0.17082,0.35401),
-            QVector3D(0.83498,0.16373,0.33907),
-            QVector3D(0.82753,0.15664,0.32416),
-            QVector3D(0.82001,0.14962,0.30933),
-            QVector3D(0.81245,0.14261,0.29452),
-            QVector3D(0.80486,0.13567,0.27982),
-            QVector3D(0.79725,0.12885,0.26518),
-            QVector3D(0.78966,0.12217,0.25066),
-            QVector3D(0.78212,0.11578,0.23628),
-            QVector3D(0.77464,0.1097,0.22201),
-            QVector3D(0.7673,0.104,0.20795),
-            QVector3D(0.76012,0.098945,0.19412),
-            QVector3D(0.75317,0.094721,0.18049),
-            QVector3D(0.74652,0.091421,0.16723),
-            QVector3D(0.74022,0.089258,0.15426),
-            QVector3D(0.73434,0.088445,0.14174),
-            QVector3D(0.72894,0.089069,0.12963),
-            QVector3D(0.7241,0.091195,0.118),
-            QVector3D(0.71988,0.094767,0.10689),
-            QVector3D(0.71631,0.099636,0.096236),
-            QVector3D(0.71343,0.1058,0.086225),
-            QVector3D(0.71128,0.11302,0.076774),
-            QVector3D(0.70983,0.12104,0.068001),
-            QVector3D(0.7091,0.12989,0.05981),
-            QVector3D(0.70904,0.1392,0.052084),
-            QVector3D(0.70963,0.14902,0.04517),
-            QVector3D(0.71081,0.15914,0.038855),
-            QVector3D(0.71251,0.1695,0.033292),
-            QVector3D(0.7147,0.17995,0.028947),
-            QVector3D(0.71729,0.1905,0.02547),
-            QVector3D(0.72021,0.20107,0.022733),
-            QVector3D(0.72342,0.21166,0.020622),
-            QVector3D(0.72685,0.22214,0.019034),
-            QVector3D(0.73046,0.23256,0.017876),
-            QVector3D(0.73419,0.24288,0.017071),
-            QVector3D(0.73802,0.25311,0.016547),
-            QVector3D(0.74191,0.26323,0.016249),
-            QVector3D(0.74585,0.27322,0.016125),
-            QVector3D(0.74979,0.28311,0.016137),
-            QVector3D(0.75375,0.29288,0.01625),
-            QVector3D(0.75769,0.30257,0.01644),
-            QVector3D(0.76161,0.31217,0.016684),
-            QVector3D(0.7655,0.32171,0.016989),
-            QVector3D(0.76932,0.33117,0.017296),
-            QVector3D(0.7731,0.34058,0.0176),
-            QVector3D(0.77681,0.34994,0.017896),
-            QVector3D(0.78044,0.35925,0.018177),
-            QVector3D(0.784,0.36855,0.018435),
-            QVector3D(0.78746,0.37783,0.018665),
-            QVector3D(0.79082,0.38709,0.018861),
-            QVector3D(0.79409,0.39636,0.019014),
-            QVector3D(0.79724,0.40564,0.019122),
-            QVector3D(0.80029,0.4149,0.019179),
-            QVector3D(0.80322,0.42418,0.019183),
-            QVector3D(0.80605,0.43346,0.019132),
-            QVector3D(0.80876,0.44276,0.019026),
-            QVector3D(0.81136,0.45205,0.018866),
-            QVector3D(0.81386,0.46134,0.018654),
-            QVector3D(0.81626,0.47063,0.018394),
-            QVector3D(0.81857,0.47992,0.01809),
-            QVector3D(0.8208,0.48918,0.017747),
-            QVector3D(0.82295,0.49846,0.017369),
-            QVector3D(0.82503,0.50771,0.016963),
-            QVector3D(0.82704,0.51694,0.016575),
-            QVector3D(0.82898,0.52615,0.016225),
-            QVector3D(0.83084,0.53532,0.015949),
-            QVector3D(0.83262,0.54446,0.015792),
-            QVector3D(0.83431,0.55354,0.01582),
-            QVector3D(0.8359,0.56257,0.016118),
-            QVector3D(0.83738,0.5715,0.016798),
-            QVector3D(0.8387,0.58035,0.018004),
-            QVector3D(0.83985,0.58906,0.019918),
-            QVector3D(0.84077,0.59761,0.022763),
-            QVector3D(0.84143,0.60595,0.02681),
-            QVector3D(0.84177,0.61404,0.032376),
-            QVector3D(0.84173,0.62182,0.040011),
-            QVector3D(0.84125,0.62922,0.04912),
-            QVector3D(0.84026,0.63619,0.059305),
-            QVector3D(0.83868,0.64264,0.070471),
-            QVector3D(0.83647,0.6485,0.08264),
-            QVector3D(0.83356,0.65372,0.095596),
-            QVector3D(0.82989,0.65824,0.10926),
-            QVector3D(0.82544,0.66201,0.12343),
-            QVector3D(0.82017,0.66498,0.13819),
-            QVector3D(0.81408,0.66715,0.15321),
-            QVector3D(0.80717,0.66852,0.16856),
-            QVector3D(0.79947,0.66908,0.18405),
-            QVector3D(0.79098,0.66887,0.19961),
-            QVector3D(0.78178,0.66795,0.2152),
-            QVector3D(0.7719,0.66635,0.23072),
-            QVector3D(0.76139,0.66416,0.2461),
-            QVector3D(0.75032,0.66143,0.26133),
-            QVector3D(0.73873,0.65825,0.27636),
-            QVector3D(0.72668,0.65467,0.29113),
-            QVector3D(0.71421,0.65077,0.30567),
-            QVector3D(0.70137,0.64662,0.31995),
-            QVector3D(0.68818,0.64226,0.33397),
-            QVector3D(0.67466,0.63773,0.34774),
-            QVector3D(0.66084,0.6331,0.36127),
-            QVector3D(0.64671,0.62838,0.37458),
-            QVector3D(0.63228,0.6236,0.38765),
-            QVector3D(0.61753,0.61878,0.40056),
-            QVector3D(0.60245,0.61393,0.41326),
-            QVector3D(0.58703,0.60909,0.42578),
-            QVector3D(0.57126,0.60423,0.43817),
-            QVector3D(0.55511,0.59936,0.4504),
-            QVector3D(0.53858,0.59449,0.4625),
-            QVector3D(0.5216,0.58962,0.47451),
-            QVector3D(0.5042,0.58475,0.4864),
-            QVector3D(0.48632,0.57986,0.49821),
-            QVector3D(0.46796,0.57493,0.50993),
-            QVector3D(0.44912,0.56996,0.5216),
-            QVector3D(0.42978,0.56493,0.53322),
-            QVector3D(0.40998,0.55983,0.5448),
-            QVector3D(0.38972,0.55461,0.55635),
-            QVector3D(0.36908,0.54926,0.56789),
-            QVector3D(0.3481,0.54375,0.57943),
-            QVector3D(0.32688,0.53805,0.59098),
-            QVector3D(0.30556,0.53211,0.60256),
-            QVector3D(0.28424,0.52592,0.61416),
-            QVector3D(0.26316,0.51945,0.62583),
-            QVector3D(0.2425,0.51265,0.63755),
-            QVector3D(0.22257,0.50551,0.64934),
-            QVector3D(0.20368,0.49802,0.66119),
-            QVector3D(0.18619,0.49012,0.67313),
-            QVector3D(0.17051,0.48183,0.68514),
-            QVector3D(0.15712,0.47312,0.69723),
-            QVector3D(0.14638,0.46402,0.70941),
-            QVector3D(0.13859,0.4545,0.72164),
-            QVector3D(0.1338,0.44458,0.73395),
-            QVector3D(0.1319,0.43426,0.7463),
-            QVector3D(0.13253,0.42359,0.75869),
-            QVector3D(0.13519,0.4126,0.77109),
-            QVector3D(0.1393,0.40128,0.7835),
-            QVector3D(0.1445,0.38969,0.79588),
-            QVector3D(0.15024,0.3779,0.80821),
-            QVector3D(0.1563,0.36594,0.82045),
-            QVector3D(0.16246,0.35387,0.83257),
-            QVector3D(0.16864,0.34179,0.84452),
-            QVector3D(0.17484,0.32979,0.85623),
-            QVector3D(0.18105,0.31794,0.86767),
-            QVector3D(0.18746,0.30639,0.87875),
-            QVector3D(0.19408,0.29524,0.88943),
-            QVector3D(0.20101,0.28465,0.89962),
-            QVector3D(0.20848,0.27478,0.90926),
-            QVector3D(0.2165,0.26579,0.9183),
-            QVector3D(0.22506,0.25778,0.92668),
-            QVector3D(0.2343,0.25098,0.93436)
-        },
-        {
-            QVector3D(0.93769,0.33352,0.94809),
-            QVector3D(0.94383,0.34283,0.94239),
-            QVector3D(0.94939,0.35275,0.93613),
-            QVector3D(0.95439,0.36323,0.92931),
-            QVector3D(0.95886,0.37422,0.92198),
-            QVector3D(0.96283,0.38558,0.91416),
-            QVector3D(0.96634,0.39727,0.90588),
-            QVector3D(0.96944,0.40921,0.89721),
-            QVector3D(0.97216,0.4213,0.88817),
-            QVector3D(0.97454,0.4335,0.87883),
-            QVector3D(0.97663,0.44573,0.86923),
-            QVector3D(0.97845,0.45797,0.8594),
-            QVector3D(0.98004,0.47017,0.84939),
-            QVector3D(0.98142,0.48228,0.83922),
-            QVector3D(0.98262,0.4943,0.82894),
-            QVector3D(0.98364,0.5062,0.81854),
-            QVector3D(0.98453,0.51799,0.80808),
-            QVector3D(0.98527,0.52964,0.79753),
-            QVector3D(0.98588,0.54116,0.78694),
-            QVector3D(0.98637,0.55255,0.77629),
-            QVector3D(0.98676,0.56382,0.76559),
-            QVector3D(0.98704,0.57494,0.75486),
-            QVector3D(0.98722,0.58595,0.74407),
-            QVector3D(0.98733,0.59683,0.73326),
-            QVector3D(0.98736,0.60758,0.72241),
-            QVector3D(0.98732,0.61821,0.71153),
-            QVector3D(0.98723,0.62871,0.7006),
-            QVector3D(0.9871,0.63909,0.68965),
-            QVector3D(0.98694,0.64936,0.67864),
-            QVector3D(0.98677,0.65949,0.66762),
-            QVector3D(0.9866,0.6695,0.65654),
-            QVector3D(0.98644,0.67938,0.64543),
-            QVector3D(0.9863,0.68916,0.63428),
-            QVector3D(0.98621,0.69879,0.62309),
-            QVector3D(0.98616,0.70831,0.61184),
-            QVector3D(0.98617,0.71772,0.60055),
-            QVector3D(0.98624,0.727,0.5892),
-            QVector3D(0.98636,0.73618,0.57779),
-            QVector3D(0.98653,0.74526,0.56632),
-            QVector3D(0.98675,0.75426,0.55476),
-            QVector3D(0.98702,0.76315,0.54311),
-            QVector3D(0.98731,0.77198,0.53134),
-            QVector3D(0.98761,0.78074,0.51946),
-            QVector3D(0.98792,0.78944,0.50744),
-            QVector3D(0.9882,0.79807,0.49526),
-            QVector3D(0.98845,0.80666,0.48291),
-            QVector3D(0.98864,0.81518,0.47039),
-            QVector3D(0.98875,0.82365,0.45765),
-            QVector3D(0.98875,0.83206,0.4447),
-            QVector3D(0.98863,0.84039,0.43151),
-            QVector3D(0.98834,0.84863,0.41804),
-            QVector3D(0.98786,0.85677,0.40433),
-            QVector3D(0.98715,0.86476,0.39033),
-            QVector3D(0.98616,0.87259,0.37607),
-            QVector3D(0.98485,0.8802,0.36152),
-            QVector3D(0.98316,0.88754,0.3467),
-            QVector3D(0.98105,0.89458,0.33163),
-            QVector3D(0.97845,0.90123,0.31637),
-            QVector3D(0.97534,0.90744,0.30092),
-            QVector3D(0.97166,0.91315,0.28537),
-            QVector3D(0.96737,0.91831,0.26983),
-            QVector3D(0.96244,0.92285,0.25432),
-            QVector3D(0.95686,0.92672,0.23895),
-            QVector3D(0.95064,0.9299,0.22388),
-            QVector3D(0.94377,0.93236,0.2092),
-            QVector3D(0.93628,0.9341,0.19506),
-            QVector3D(0.9282,0.93512,0.18153),
-            QVector3D(0.91959,0.93544,0.16884),
-            QVector3D(0.91047,0.9351,0.15697),
-            QVector3D(0.90091,0.93414,0.1461),
-            QVector3D(0.89097,0.93263,0.13623),
-            QVector3D(0.8807,0.93061,0.12747),
-            QVector3D(0.87014,0.92815,0.11977),
-            QVector3D(0.85937,0.92531,0.11315),
-            QVector3D(0.8484,0.92216,0.10742),
-            QVector3D(0.83729,0.91874,0.10257),
-            QVector3D(0.82605,0.91511,0.098502),
-            QVector3D(0.81472,0.91132,0.095091),
-            QVector3D(0.80332,0.90739,0.092162),
-            QVector3D(0.79187,0.90336,0.089659),
-            QVector3D(0.78036,0.89925,0.087518),
-            QVector3D(0.76881,0.89508,0.08551),
-            QVector3D(0.75723,0.89086,0.083837),
-            QVector3D(0.74562,0.88662,0.082243),
-            QVector3D(0.73398,0.88235,0.080673),
-            QVector3D(0.7223,0.87807,0.079194),
-            QVector3D(0.7106,0.87376,0.077792),
-            QVector3D(0.69886,0.86946,0.076415),
-            QVector3D(0.6871,0.86514,0.075063),
-            QVector3D(0.67529,0.86082,0.073757),
-            QVector3D(0.66346,0.85649,0.072319),
-            QVector3D(0.65156,0.85215,0.071005),
-            QVector3D(0.63963,0.8478,0.069678),
-            QVector3D(0.62764,0.84345,0.068313),
-            QVector3D(0.6156,0.83909,0.066946),
-            QVector3D(0.60351,0.83473,0.065602),
-            QVector3D(0.59134,0.83035,0.064284),
-            QVector3D(0.57911,0.82597,0.063016),
-            QVector3D(0.56681,0.82158,0.061599),
-            QVector3D(0.55443,0.81718,0.060374),
-            QVector3D(0.54195,0.81278,0.059088),
-            QVector3D(0.5294,0.80837,0.057695),
-            QVector3D(0.51672,0.80395,0.056522),
-            QVector3D(0.50395,0.79952,0.055189),
-            QVector3D(0.49106,0.79508,0.053903),
-            QVector3D(0.47801,0.79064,0.052644),
-            QVector3D(0.46484,0.78619,0.051424),
-            QVector3D(0.45151,0.78173,0.050257),
-            QVector3D(0.43803,0.77726,0.04922),
-            QVector3D(0.42437,0.77277,0.04812),
-            QVector3D(0.41056,0.76827,0.047322),
-            QVector3D(0.39656,0.76375,0.04674),
-            QVector3D(0.38239,0.75922,0.046427),
-            QVector3D(0.36808,0.75466,0.046596),
-            QVector3D(0.35361,0.75006,0.047299),
-            QVector3D(0.33906,0.74543,0.04874),
-            QVector3D(0.32443,0.74075,0.050897),
-            QVector3D(0.30984,0.73602,0.054069),
-            QVector3D(0.29532,0.73122,0.058336),
-            QVector3D(0.28105,0.72634,0.063783),
-            QVector3D(0.26717,0.72137,0.070322),
-            QVector3D(0.25387,0.71631,0.077992),
-            QVector3D(0.24134,0.71112,0.08687),
-            QVector3D(0.22981,0.7058,0.096608),
-            QVector3D(0.21961,0.70035,0.10741),
-            QVector3D(0.21092,0.69475,0.11899),
-            QVector3D(0.204,0.68901,0.13129),
-            QVector3D(0.19894,0.6831,0.14422),
-            QVector3D(0.19593,0.67703,0.15768),
-            QVector3D(0.19486,0.67081,0.17161),
-            QVector3D(0.1956,0.66443,0.18594),
-            QVector3D(0.19795,0.65791,0.2005),
-            QVector3D(0.20163,0.65125,0.21533),
-            QVector3D(0.20639,0.64446,0.2303),
-            QVector3D(0.21183,0.63756,0.24538),
-            QVector3D(0.21771,0.63057,0.26052),
-            QVector3D(0.22381,0.62348,0.27565),
-            QVector3D(0.22992,0.61632,0.29071),
-            QVector3D(0.23593,0.6091,0.30574),
-            QVector3D(0.24162,0.60182,0.32064),
-            QVector3D(0.24693,0.5945,0.33543),
-            QVector3D(0.25184,0.58716,0.35008),
-            QVector3D(0.25622,0.5798,0.36459),
-            QVector3D(0.26011,0.57242,0.37897),
-            QVector3D(0.26346,0.56501,0.3932),
-            QVector3D(0.26624,0.55762,0.4073),
-            QVector3D(0.26846,0.55021,0.42127),
-            QVector3D(0.27013,0.5428,0.43513),
-            QVector3D(0.27122,0.53539,0.44886),
-            QVector3D(0.27173,0.52798,0.46247),
-            QVector3D(0.2717,0.52057,0.476),
-            QVector3D(0.27112,0.51317,0.48942),
-            QVector3D(0.26997,0.50576,0.50275),
-            QVector3D(0.26823,0.49837,0.516),
-            QVector3D(0.26598,0.49096,0.52919),
-            QVector3D(0.26316,0.48352,0.54228),
-            QVector3D(0.25982,0.4761,0.55529),
-            QVector3D(0.25594,0.46864,0.56822),
-            QVector3D(0.25162,0.46117,0.58105),
-            QVector3D(0.2468,0.45365,0.5938),
-            QVector3D(0.24161,0.44609,0.60643),
-            QVector3D(0.23605,0.43849,0.61894),
-            QVector3D(0.23017,0.43081,0.63131),
-            QVector3D(0.2241,0.42303,0.64353),
-            QVector3D(0.21793,0.41517,0.6556),
-            QVector3D(0.2117,0.40718,0.66749),
-            QVector3D(0.2055,0.39906,0.67919),
-            QVector3D(0.19945,0.39079,0.6907),
-            QVector3D(0.19367,0.38234,0.70201),
-            QVector3D(0.18818,0.37372,0.71312),
-            QVector3D(0.183,0.36488,0.72404),
-            QVector3D(0.17829,0.35585,0.73477),
-            QVector3D(0.17392,0.34657,0.7453),
-            QVector3D(0.16999,0.33707,0.75566),
-            QVector3D(0.16639,0.32732,0.76586),
-            QVector3D(0.16312,0.31735,0.7759),
-            QVector3D(0.16005,0.30712,0.78581),
-            QVector3D(0.15724,0.29667,0.79557),
-            QVector3D(0.15457,0.28595,0.80522),
-            QVector3D(0.15202,0.27505,0.81474),
-            QVector3D(0.14966,0.26395,0.82414),
-            QVector3D(0.14744,0.25264,0.8334),
-            QVector3D(0.14554,0.24118,0.84252),
-            QVector3D(0.14402,0.2296,0.85145),
-            QVector3D(0.14312,0.218,0.86019),
-            QVector3D(0.14305,0.20639,0.86869),
-            QVector3D(0.14404,0.19481,0.87691),
-            QVector3D(0.1463,0.18336,0.88484),
-            QVector3D(0.15007,0.17219,0.89241),
-            QVector3D(0.15537,0.1614,0.8996),
-            QVector3D(0.1623,0.15103,0.90637),
-            QVector3D(0.17075,0.14136,0.9127),
-            QVector3D(0.18062,0.13244,0.91856),
-            QVector3D(0.19173,0.12446,0.92396),
-            QVector3D(0.20389,0.11765,0.92889),
-            QVector3D(0.21681,0.11214,0.93335),
-            QVector3D(0.23028,0.10794,0.93739),
-            QVector3D(0.24417,0.10525,0.94101),
-            QVector3D(0.25828,0.10403,0.94425),
-            QVector3D(0.27246,0.10417,0.94716),
-            QVector3D(0.28659,0.1056,0.94977),
-            QVector3D(0.30059,0.10807,0.95212),
-            QVector3D(0.3144,0.11153,0.95426),
-            QVector3D(0.32796,0.11565,0.95622),
-            QVector3D(0.34126,0.12031,0.95803),
-            QVector3D(0.35426,0.12544,0.95973),
-            QVector3D(0.36698,0.13084,0.96134),
-            QVector3D(0.37942,0.13637,0.96288),
-            QVector3D(0.3916,0.1421,0.96436),
-            QVector3D(0.40352,0.14786,0.96581),
-            QVector3D(0.4152,0.15363,0.96722),
-            QVector3D(0.42669,0.15941,0.9686),
-            QVector3D(0.43799,0.16515,0.96996),
-            QVector3D(0.44913,0.17088,0.97129),
-            QVector3D(0.46013,0.1765,0.97261),
-            QVector3D(0.47106,0.18204,0.97389),
-            QVector3D(0.48191,0.18751,0.97514),
-            QVector3D(0.49273,0.1928,0.97635),
-            QVector3D(0.50357,0.19798,0.97752),
-            QVector3D(0.51446,0.20302,0.97863),
-            QVector3D(0.52541,0.2079,0.97969),
-            QVector3D(0.53647,0.21259,0.98067),
-            QVector3D(0.54767,0.21709,0.98157),
-            QVector3D(0.55903,0.22137,0.98238),
-            QVector3D(0.57057,0.22542,0.9831),
-            QVector3D(0.5823,0.22925,0.98372),
-            QVector3D(0.59423,0.23284,0.98424),
-            QVector3D(0.60636,0.23623,0.98465),
-            QVector3D(0.61868,0.23935,0.98497),
-            QVector3D(0.63116,0.24227,0.98518),
-            QVector3D(0.64379,0.24496,0.9853),
-            QVector3D(0.65656,0.2475,0.98533),
-            QVector3D(0.66943,0.24982,0.98527),
-            QVector3D(0.68237,0.25203,0.98515),
-            QVector3D(0.69537,0.25408,0.98496),
-            QVector3D(0.70839,0.25601,0.98471),
-            QVector3D(0.72139,0.25786,0.98441),
-            QVector3D(0.73437,0.25968,0.98405),
-            QVector3D(0.74728,0.26143,0.98365),
-            QVector3D(0.76012,0.26319,0.98321),
-            QVector3D(0.77286,0.26494,0.98271),
-            QVector3D(0.78548,0.26676,0.98216),
-            QVector3D(0.79794,0.26867,0.98153),
-            QVector3D(0.81023,0.27069,0.98082),
-            QVector3D(0.82233,0.27285,0.98001),
-            QVector3D(0.83418,0.27525,0.97905),
-            QVector3D(0.84576,0.27791,0.97793),
-            QVector3D(0.85702,0.28089,0.97661),
-            QVector3D(0.86794,0.2843,0.97504),
-            QVector3D(0.87845,0.28819,0.97317),
-            QVector3D(0.88852,0.29263,0.97097),
-            QVector3D(0.8981,0.29768,0.96837),
-            QVector3D(0.90717,0.3034,0.96533),
-            QVector3D(0.91567,0.30984,0.96182),
-            QVector3D(0.92361,0.317,0.9578),
-            QVector3D(0.93095,0.32489,0.95323)
-        },
-        {
-            QVector3D(0.18062,0.13244,0.91856),
-            QVector3D(0.19173,0.12446,0.92396),
-            QVector3D(0.20389,0.11765,0.92889),
-            QVector3D(0.21681,0.11214,0.93335),
-            QVector3D(0.23028,0.10794,0.93739),
-            QVector3D(0.24417,0.10525,0.94101),
-            QVector3D(0.25828,0.10403,0.94425),
-            QVector3D(0.27246,0.10417,0.94716),
-            QVector3D(0.28659,0.1056,0.94977),
-            QVector3D(0.30059,0.10807,0.95212),
-            QVector3D(0.3144,0.11153,0.95426),
-            QVector3D(0.32796,0.11565,0.95622),
-            QVector3D(0.34126,0.12031,0.95803),
-            QVector3D(0.35426,0.12544,0.95973),
-            QVector3D(0.36698,0.13084,0.96134),
-            QVector3D(0.37942,0.13637,0.96288),
-            QVector3D(0.3916,0.1421,0.96436),
-            QVector3D(0.40352,0.14786,0.96581),
-            QVector3D(0.4152,0.15363,0.96722),
-            QVector3D(0.42669,0.15941,0.9686),
-            QVector3D(0.43799,0.16515,0.96996),
-            QVector3D(0.44913,0.17088,0.97129),
-            QVector3D(0.46013,0.1765,0.97261),
-            QVector3D(0.47106,0.18204,0.97389),
-            QVector3D(0.48191,0.18751,0.97514),
-            QVector3D(0.49273,0.1928,0.97635),
-            QVector3D(0.50357,0.19798,0.97752),
-            QVector3D(0.51446,0.20302,0.97863),
-            QVector3D(0.52541,0.2079,0.97969),
-            QVector3D(0.53647,0.21259,0.98067),
-            QVector3D(0.54767,0.21709,0.98157),
-            QVector3D(0.55903,0.22137,0.98238),
-            QVector3D(0.57057,0.22542,0.9831),
-            QVector3D(0.5823,0.22925,0.98372),
-            QVector3D(0.59423,0.23284,0.98424),
-            QVector3D(0.60636,0.23623,0.98465),
-            QVector3D(0.61868,0.23935,0.98497),
-            QVector3D(0.63116,0.24227,0.98518),
-            QVector3D(0.64379,0.24496,0.9853),
-            QVector3D(0.65656,0.2475,0.98533),
-            QVector3D(0.66943,0.24982,0.98527),
-            QVector3D(0.68237,0.25203,0.98515),
-            QVector3D(0.69537,0.25408,0.98496),
-            QVector3D(0.70839,0.25601,0.98471),
-            QVector3D(0.72139,0.25786,0.98441),
-            QVector3D(0.73437,0.25968,0.98405),
-            QVector3D(0.74728,0.26143,0.98365),
-            QVector3D(0.76012,0.26319,0.98321),
-            QVector3D(0.77286,0.26494,0.98271),
-            QVector3D(0.78548,0.26676,0.98216),
-            QVector3D(0.79794,0.26867,0.98153),
-            QVector3D(0.81023,0.27069,0.98082),
-            QVector3D(0.82233,0.27285,0.98001),
-            QVector3D(0.83418,0.27525,0.97905),
-            QVector3D(0.84576,0.27791,0.97793),
-            QVector3D(0.85702,0.28089,0.97661),
-            QVector3D(0.86794,0.2843,0.97504),
-            QVector3D(0.87845,0.28819,0.97317),
-            QVector3D(0.88852,0.29263,0.97097),
-            QVector3D(0.8981,0.29768,0.96837),
-            QVector3D(0.90717,0.3034,0.96533),
-            QVector3D(0.91567,0.30984,0.96182),
-            QVector3D(0.92361,0.317,0.9578),
-            QVector3D(0.93095,0.32489,0.95323),
-            QVector3D(0.93769,0.33352,0.94809),
-            QVector3D(0.94383,0.34283,0.94239),
-            QVector3D(0.94939,0.35275,0.93613),
-            QVector3D(0.95439,0.36323,0.92931),
-            QVector3D(0.95886,0.37422,0.92198),
-            QVector3D(0.96283,0.38558,0.91416),
-            QVector3D(0.96634,0.39727,0.90588),
-            QVector3D(0.96944,0.40921,0.89721),
-            QVector3D(0.97216,0.4213,0.88817),
-            QVector3D(0.97454,0.4335,0.87883),
-            QVector3D(0.97663,0.44573,0.86923),
-            QVector3D(0.97845,0.45797,0.8594),
-            QVector3D(0.98004,0.47017,0.84939),
-            QVector3D(0.98142,0.48228,0.83922),
-            QVector3D(0.98262,0.4943,0.82894),
-            QVector3D(0.98364,0.5062,0.81854),
-            QVector3D(0.98453,0.51799,0.80808),
-            QVector3D(0.98527,0.52964,0.79753),
-            QVector3D(0.98588,0.54116,0.78694),
-            QVector3D(0.98637,0.55255,0.77629),
-            QVector3D(0.98676,0.56382,0.76559),
-            QVector3D(0.98704,0.57494,0.75486),
-            QVector3D(0.98722,0.58595,0.74407),
-            QVector3D(0.98733,0.59683,0.73326),
-            QVector3D(0.98736,0.60758,0.72241),
-            QVector3D(0.98732,0.61821,0.71153),
-            QVector3D(0.98723,0.62871,0.7006),
-            QVector3D(0.9871,0.63909,0.68965),
-            QVector3D(0.98694,0.64936,0.67864),
-            QVector3D(0.98677,0.65949,0.66762),
-            QVector3D(0.9866,0.6695,0.65654),
-            QVector3D(0.98644,0.67938,0.64543),
-            QVector3D(0.9863,0.68916,0.63428),
-            QVector3D(0.98621,0.69879,0.62309),
-            QVector3D(0.98616,0.70831,0.61184),
-            QVector3D(0.98617,0.71772,0.60055),
-            QVector3D(0.98624,0.727,0.5892),
-            QVector3D(0.98636,0.73618,0.57779),
-            QVector3D(0.98653,0.74526,0.56632),
-            QVector3D(0.98675,0.75426,0.55476),
-            QVector3D(0.98702,0.76315,0.54311),
-            QVector3D(0.98731,0.77198,0.53134),
-            QVector3D(0.98761,0.78074,0.51946),
-            QVector3D(0.98792,0.78944,0.50744),
-            QVector3D(0.9882,0.79807,0.49526),
-            QVector3D(0.98845,0.80666,0.48291),
-            QVector3D(0.98864,0.81518,0.47039),
-            QVector3D(0.98875,0.82365,0.45765),
-            QVector3D(0.98875,0.83206,0.4447),
-            QVector3D(0.98863,0.84039,0.43151),
-            QVector3D(0.98834,0.84863,0.41804),
-            QVector3D(0.98786,0.85677,0.40433),
-            QVector3D(0.98715,0.86476,0.39033),
-            QVector3D(0.98616,0.87259,0.37607),
-            QVector3D(0.98485,0.8802,0.36152),
-            QVector3D(0.98316,0.88754,0.3467),
-            QVector3D(0.98105,0.89458,0.33163),
-            QVector3D(0.97845,0.90123,0.31637),
-            QVector3D(0.97534,0.90744,0.30092),
-            QVector3D(0.97166,0.91315,0.28537),
-            QVector3D(0.96737,0.91831,0.26983),
-            QVector3D(0.96244,0.92285,0.25432),
-            QVector3D(0.95686,0.92672,0.23895),
-            QVector3D(0.95064,0.9299,0.22388),
-            QVector3D(0.94377,0.93236,0.2092),
-            QVector3D(0.93628,0.9341,0.19506),
-            QVector3D(0.9282,0.93512,0.18153),
-            QVector3D(0.91959,0.93544,0.16884),
-            QVector3D(0.91047,0.9351,0.15697),
-            QVector3D(0.90091,0.93414,0.1461),
-            QVector3D(0.89097,0.93263,0.13623),
-            QVector3D(0.8807,0.93061,0.12747),
-            QVector3D(0.87014,0.92815,0.11977),
-            QVector3D(0.85937,0.92531,0.11315),
-            QVector3D(0.8484,0.92216,0.10742),
-            QVector3D(0.83729,0.91874,0.10257),
-            QVector3D(0.82605,0.91511,0.098502),
-            QVector3D(0.81472,0.91132,0.095091),
-            QVector3D(0.80332,0.90739,0.092162),
-            QVector3D(0.79187,0.90336,0.089659),
-            QVector3D(0.78036,0.89925,0.087518),
-            QVector3D(0.76881,0.89508,0.08551),
-            QVector3D(0.75723,0.89086,0.083837),
-            QVector3D(0.74562,0.88662,0.082243),
-            QVector3D(0.73398,0.88235,0.080673),
-            QVector3D(0.7223,0.87807,0.079194),
-            QVector3D(0.7106,0.87376,0.077792),
-            QVector3D(0.69886,0.86946,0.076415),
-            QVector3D(0.6871,0.86514,0.075063),
-            QVector3D(0.67529,0.86082,0.073757),
-            QVector3D(0.66346,0.85649,0.072319),
-            QVector3D(0.65156,0.85215,0.071005),
-            QVector3D(0.63963,0.8478,0.069678),
-            QVector3D(0.62764,0.84345,0.068313),
-            QVector3D(0.6156,0.83909,0.066946),
-            QVector3D(0.60351,0.83473,0.065602),
-            QVector3D(0.59134,0.83035,0.064284),
-            QVector3D(0.57911,0.82597,0.063016),
-            QVector3D(0.56681,0.82158,0.061599),
-            QVector3D(0.55443,0.81718,0.060374),
-            QVector3D(0.54195,0.81278,0.059088),
-            QVector3D(0.5294,0.80837,0.057695),
-            QVector3D(0.51672,0.80395,0.056522),
-            QVector3D(0.50395,0.79952,0.055189),
-            QVector3D(0.49106,0.79508,0.053903),
-            QVector3D(0.47801,0.79064,0.052644),
-            QVector3D(0.46484,0.78619,0.051424),
-            QVector3D(0.45151,0.78173,0.050257),
-            QVector3D(0.43803,0.77726,0.04922),
-            QVector3D(0.42437,0.77277,0.04812),
-            QVector3D(0.41056,0.76827,0.047322),
-            QVector3D(0.39656,0.76375,0.04674),
-            QVector3D(0.38239,0.75922,0.046427),
-            QVector3D(0.36808,0.75466,0.046596),
-            QVector3D(0.35361,0.75006,0.047299),
-            QVector3D(0.33906,0.74543,0.04874),
-            QVector3D(0.32443,0.74075,0.050897),
-            QVector3D(0.30984,0.73602,0.054069),
-            QVector3D(0.29532,0.73122,0.058336),
-            QVector3D(0.28105,0.72634,0.063783),
-            QVector3D(0.26717,0.72137,0.070322),
-            QVector3D(0.25387,0.71631,0.077992),
-            QVector3D(0.24134,0.71112,0.08687),
-            QVector3D(0.22981,0.7058,0.096608),
-            QVector3D(0.21961,0.70035,0.10741),
-            QVector3D(0.21092,0.69475,0.11899),
-            QVector3D(0.204,0.68901,0.13129),
-            QVector3D(0.19894,0.6831,0.14422),
-            QVector3D(0.19593,0.67703,0.15768),
-            QVector3D(0.19486,0.67081,0.17161),
-            QVector3D(0.1956,0.66443,0.18594),
-            QVector3D(0.19795,0.65791,0.2005),
-            QVector3D(0.20163,0.65125,0.21533),
-            QVector3D(0.20639,0.64446,0.2303),
-            QVector3D(0.21183,0.63756,0.24538),
-            QVector3D(0.21771,0.63057,0.26052),
-            QVector3D(0.22381,0.62348,0.27565),
-            QVector3D(0.22992,0.61632,0.29071),
-            QVector3D(0.23593,0.6091,0.30574),
-            QVector3D(0.24162,0.60182,0.32064),
-            QVector3D(0.24693,0.5945,0.33543),
-            QVector3D(0.25184,0.58716,0.35008),
-            QVector3D(0.25622,0.5798,0.36459),
-            QVector3D(0.26011,0.57242,0.37897),
-            QVector3D(0.26346,0.56501,0.3932),
-            QVector3D(0.26624,0.55762,0.4073),
-            QVector3D(0.26846,0.55021,0.42127),
-            QVector3D(0.27013,0.5428,0.43513),
-            QVector3D(0.27122,0.53539,0.44886),
-            QVector3D(0.27173,0.52798,0.46247),
-            QVector3D(0.2717,0.52057,0.476),
-            QVector3D(0.27112,0.51317,0.48942),
-            QVector3D(0.26997,0.50576,0.50275),
-            QVector3D(0.26823,0.49837,0.516),
-            QVector3D(0.26598,0.49096,0.52919),
-            QVector3D(0.26316,0.48352,0.54228),
-            QVector3D(0.25982,0.4761,0.55529),
-            QVector3D(0.25594,0.46864,0.56822),
-            QVector3D(0.25162,0.46117,0.58105),
-            QVector3D(0.2468,0.45365,0.5938),
-            QVector3D(0.24161,0.44609,0.60643),
-            QVector3D(0.23605,0.43849,0.61894),
-            QVector3D(0.23017,0.43081,0.63131),
-            QVector3D(0.2241,0.42303,0.64353),
-            QVector3D(0.21793,0.41517,0.6556),
-            QVector3D(0.2117,0.40718,0.66749),
-            QVector3D(0.2055,0.39906,0.67919),
-            QVector3D(0.19945,0.39079,0.6907),
-            QVector3D(0.19367,0.38234,0.70201),
-            QVector3D(0.18818,0.37372,0.71312),
-            QVector3D(0.183,0.36488,0.72404),
-            QVector3D(0.17829,0.35585,0.73477),
-            QVector3D(0.17392,0.34657,0.7453),
-            QVector3D(0.16999,0.33707,0.75566),
-            QVector3D(0.16639,0.32732,0.76586),
-            QVector3D(0.16312,0.31735,0.7759),
-            QVector3D(0.16005,0.30712,0.78581),
-            QVector3D(0.15724,0.29667,0.79557),
-            QVector3D(0.15457,0.28595,0.80522),
-            QVector3D(0.15202,0.27505,0.81474),
-            QVector3D(0.14966,0.26395,0.82414),
-            QVector3D(0.14744,0.25264,0.8334),
-            QVector3D(0.14554,0.24118,0.84252),
-            QVector3D(0.14402,0.2296,0.85145),
-            QVector3D(0.14312,0.218,0.86019),
-            QVector3D(0.14305,0.20639,0.86869),
-            QVector3D(0.14404,0.19481,0.87691),
-            QVector3D(0.1463,0.18336,0.88484),
-            QVector3D(0.15007,0.17219,0.89241),
-            QVector3D(0.15537,0.1614,0.8996),
-            QVector3D(0.1623,0.15103,0.90637),
-            QVector3D(0.17075,0.14136,0.9127)
-        },
-        {
-            QVector3D(0.873,0.83593,0.84864),
-            QVector3D(0.8777,0.8339,0.84071),
-            QVector3D(0.88194,0.83075,0.832),
-            QVector3D(0.88572,0.82651,0.82253),
-            QVector3D(0.88906,0.82126,0.81236),
-            QVector3D(0.89199,0.81507,0.80154),
-            QVector3D(0.89451,0.80802,0.79013),
-            QVector3D(0.89666,0.80023,0.77819),
-            QVector3D(0.89847,0.79178,0.76581),
-            QVector3D(0.89996,0.78278,0.75305),
-            QVector3D(0.90116,0.77331,0.73999),
-            QVector3D(0.9021,0.76347,0.72667),
-            QVector3D(0.9028,0.75332,0.71316),
-            QVector3D(0.90327,0.74294,0.69952),
-            QVector3D(0.90355,0.73237,0.68579),
-            QVector3D(0.90363,0.72166,0.67199),
-            QVector3D(0.90355,0.71085,0.65815),
-            QVector3D(0.9033,0.69996,0.64429),
-            QVector3D(0.90289,0.68903,0.63046),
-            QVector3D(0.90234,0.67804,0.61663),
-            QVector3D(0.90165,0.66702,0.60282),
-            QVector3D(0.90082,0.65598,0.58904),
-            QVector3D(0.89986,0.64492,0.57531),
-            QVector3D(0.89877,0.63386,0.56162),
-            QVector3D(0.89757,0.62278,0.54797),
-            QVector3D(0.89623,0.61169,0.53437),
-            QVector3D(0.89478,0.60058,0.52081),
-            QVector3D(0.8932,0.58945,0.5073),
-            QVector3D(0.89151,0.57831,0.49383),
-            QVector3D(0.8897,0.56715,0.48041),
-            QVector3D(0.88777,0.55595,0.46704),
-            QVector3D(0.88574,0.54474,0.4537),
-            QVector3D(0.88359,0.53349,0.44042),
-            QVector3D(0.88134,0.52221,0.42718),
-            QVector3D(0.87897,0.5109,0.41398),
-            QVector3D(0.87649,0.49954,0.40083),
-            QVector3D(0.87391,0.48816,0.3877),
-            QVector3D(0.87123,0.4767,0.37464),
-            QVector3D(0.86845,0.4652,0.3616),
-            QVector3D(0.86556,0.45364,0.34861),
-            QVector3D(0.86257,0.44202,0.33566),
-            QVector3D(0.85948,0.43032,0.32274),
-            QVector3D(0.8563,0.41853,0.30985),
-            QVector3D(0.85302,0.40666,0.29699),
-            QVector3D(0.84965,0.3947,0.28415),
-            QVector3D(0.84618,0.38265,0.27137),
-            QVector3D(0.84264,0.3705,0.25865),
-            QVector3D(0.83901,0.35827,0.24597),
-            QVector3D(0.83532,0.34594,0.23336),
-            QVector3D(0.83157,0.33356,0.22089),
-            QVector3D(0.82777,0.3211,0.20848),
-            QVector3D(0.82395,0.30862,0.19626),
-            QVector3D(0.82013,0.29614,0.1842),
-            QVector3D(0.81634,0.28375,0.17242),
-            QVector3D(0.81259,0.2715,0.16099),
-            QVector3D(0.80896,0.25953,0.14996),
-            QVector3D(0.80546,0.24792,0.1394),
-            QVector3D(0.80217,0.23683,0.12955),
-            QVector3D(0.79914,0.22645,0.1204),
-            QVector3D(0.7964,0.21697,0.11224),
-            QVector3D(0.79405,0.20862,0.10504),
-            QVector3D(0.79209,0.20162,0.099146),
-            QVector3D(0.79061,0.19625,0.094653),
-            QVector3D(0.78962,0.19261,0.091622),
-            QVector3D(0.78916,0.19089,0.090163),
-            QVector3D(0.78923,0.19116,0.09039),
-            QVector3D(0.78984,0.19342,0.092261),
-            QVector3D(0.79096,0.19754,0.095704),
-            QVector3D(0.79258,0.20339,0.10062),
-            QVector3D(0.79465,0.21076,0.10693),
-            QVector3D(0.79711,0.21943,0.11431),
-            QVector3D(0.79994,0.22917,0.12278),
-            QVector3D(0.80304,0.23975,0.13216),
-            QVector3D(0.8064,0.251,0.14222),
-            QVector3D(0.80993,0.26273,0.15286),
-            QVector3D(0.81359,0.27479,0.16406),
-            QVector3D(0.81735,0.28707,0.17556),
-            QVector3D(0.82116,0.29951,0.18745),
-            QVector3D(0.82498,0.31196,0.1995),
-            QVector3D(0.8288,0.32444,0.21181),
-            QVector3D(0.83258,0.33689,0.2242),
-            QVector3D(0.83632,0.34927,0.23677),
-            QVector3D(0.84,0.36157,0.24937),
-            QVector3D(0.84359,0.37378,0.26206),
-            QVector3D(0.84712,0.38589,0.27479),
-            QVector3D(0.85056,0.39792,0.28758),
-            QVector3D(0.8539,0.40986,0.30042),
-            QVector3D(0.85716,0.42169,0.3133),
-            QVector3D(0.86032,0.43345,0.32618),
-            QVector3D(0.86338,0.44514,0.33913),
-            QVector3D(0.86634,0.45674,0.35208),
-            QVector3D(0.8692,0.46829,0.36509),
-            QVector3D(0.87196,0.47978,0.37813),
-            QVector3D(0.87462,0.49122,0.39122),
-            QVector3D(0.87716,0.50259,0.40434),
-            QVector3D(0.87961,0.51395,0.41751),
-            QVector3D(0.88195,0.52525,0.43072),
-            QVector3D(0.88418,0.53652,0.44398),
-            QVector3D(0.8863,0.54775,0.45727),
-            QVector3D(0.8883,0.55896,0.47062),
-            QVector3D(0.89019,0.57014,0.484),
-            QVector3D(0.89197,0.5813,0.49745),
-            QVector3D(0.89363,0.59245,0.51092),
-            QVector3D(0.89518,0.60356,0.52444),
-            QVector3D(0.8966,0.61466,0.53802),
-            QVector3D(0.8979,0.62575,0.55163),
-            QVector3D(0.89908,0.63683,0.56528),
-            QVector3D(0.90012,0.64788,0.579),
-            QVector3D(0.90103,0.65892,0.59275),
-            QVector3D(0.9018,0.66994,0.60654),
-            QVector3D(0.90242,0.6809,0.62037),
-            QVector3D(0.90287,0.69183,0.63422),
-            QVector3D(0.90316,0.70268,0.64808),
-            QVector3D(0.90325,0.71344,0.66197),
-            QVector3D(0.90314,0.72408,0.67583),
-            QVector3D(0.9028,0.73456,0.68967),
-            QVector3D(0.9022,0.74481,0.70344),
-            QVector3D(0.90131,0.7548,0.71713),
-            QVector3D(0.90011,0.76443,0.73066),
-            QVector3D(0.89855,0.77364,0.74401),
-            QVector3D(0.8966,0.78234,0.75711),
-            QVector3D(0.89423,0.79041,0.7699),
-            QVector3D(0.8914,0.79778,0.7823),
-            QVector3D(0.88809,0.80433,0.79423),
-            QVector3D(0.88427,0.80997,0.80561),
-            QVector3D(0.87992,0.81463,0.8164),
-            QVector3D(0.87505,0.81822,0.8265),
-            QVector3D(0.86966,0.82071,0.83587),
-            QVector3D(0.86376,0.82205,0.84446),
-            QVector3D(0.85737,0.82224,0.85225),
-            QVector3D(0.85052,0.8213,0.85923),
-            QVector3D(0.84325,0.81927,0.8654),
-            QVector3D(0.8356,0.81621,0.87079),
-            QVector3D(0.8276,0.81219,0.87544),
-            QVector3D(0.81931,0.80731,0.8794),
-            QVector3D(0.81075,0.80165,0.88274),
-            QVector3D(0.80198,0.79534,0.88552),
-            QVector3D(0.79302,0.78846,0.88781),
-            QVector3D(0.7839,0.78111,0.88969),
-            QVector3D(0.77463,0.77338,0.89122),
-            QVector3D(0.76527,0.76536,0.89246),
-            QVector3D(0.75579,0.75709,0.89345),
-            QVector3D(0.74622,0.74866,0.89427),
-            QVector3D(0.73657,0.7401,0.89494),
-            QVector3D(0.72685,0.73145,0.89549),
-            QVector3D(0.71705,0.72274,0.89595),
-            QVector3D(0.70717,0.71401,0.89635),
-            QVector3D(0.69722,0.70526,0.89669),
-            QVector3D(0.68719,0.69651,0.89699),
-            QVector3D(0.67709,0.68776,0.89726),
-            QVector3D(0.66689,0.67902,0.8975),
-            QVector3D(0.65663,0.67032,0.89772),
-            QVector3D(0.64625,0.66163,0.89792),
-            QVector3D(0.63579,0.65297,0.89811),
-            QVector3D(0.62522,0.64434,0.89828),
-            QVector3D(0.61453,0.63573,0.89844),
-            QVector3D(0.60375,0.62715,0.89859),
-            QVector3D(0.59283,0.6186,0.89872),
-            QVector3D(0.58178,0.61007,0.89884),
-            QVector3D(0.57059,0.60157,0.89894),
-            QVector3D(0.55925,0.59311,0.89902),
-            QVector3D(0.54776,0.58467,0.8991),
-            QVector3D(0.53609,0.57626,0.89915),
-            QVector3D(0.52424,0.56787,0.8992),
-            QVector3D(0.51219,0.55952,0.89923),
-            QVector3D(0.49993,0.5512,0.89925),
-            QVector3D(0.48745,0.54291,0.89925),
-            QVector3D(0.47471,0.53465,0.89924),
-            QVector3D(0.46169,0.52643,0.89922),
-            QVector3D(0.44837,0.51823,0.89918),
-            QVector3D(0.43473,0.51007,0.89913),
-            QVector3D(0.42073,0.50196,0.89907),
-            QVector3D(0.40637,0.49389,0.899),
-            QVector3D(0.39159,0.48588,0.89891),
-            QVector3D(0.37638,0.47795,0.89881),
-            QVector3D(0.36067,0.47012,0.8987),
-            QVector3D(0.34449,0.46237,0.89858),
-            QVector3D(0.32777,0.45477,0.89845),
-            QVector3D(0.31053,0.44731,0.89832),
-            QVector3D(0.29269,0.44007,0.89817),
-            QVector3D(0.27432,0.43307,0.89802),
-            QVector3D(0.25544,0.42636,0.89787),
-            QVector3D(0.23609,0.42002,0.89772),
-            QVector3D(0.21638,0.4141,0.89757),
-            QVector3D(0.19647,0.40866,0.89743),
-            QVector3D(0.17659,0.40379,0.89729),
-            QVector3D(0.15722,0.39953,0.89717),
-            QVector3D(0.13894,0.39598,0.89707),
-            QVector3D(0.1226,0.39316,0.89698),
-            QVector3D(0.10959,0.39116,0.89692),
-            QVector3D(0.1011,0.38996,0.89689),
-            QVector3D(0.098617,0.38962,0.89687),
-            QVector3D(0.10246,0.39014,0.89689),
-            QVector3D(0.11205,0.39152,0.89693),
-            QVector3D(0.12596,0.39371,0.897),
-            QVector3D(0.14277,0.39668,0.89709),
-            QVector3D(0.16137,0.40041,0.8972),
-            QVector3D(0.18085,0.40478,0.89732),
-            QVector3D(0.20072,0.4098,0.89746),
-            QVector3D(0.22066,0.41534,0.8976),
-            QVector3D(0.24027,0.42135,0.89775),
-            QVector3D(0.25956,0.42779,0.89791),
-            QVector3D(0.27833,0.43456,0.89806),
-            QVector3D(0.29659,0.44162,0.8982),
-            QVector3D(0.31428,0.44891,0.89835),
-            QVector3D(0.33142,0.45639,0.89848),
-            QVector3D(0.34803,0.46404,0.89861),
-            QVector3D(0.3641,0.4718,0.89873),
-            QVector3D(0.37969,0.47966,0.89883),
-            QVector3D(0.39481,0.48761,0.89893),
-            QVector3D(0.40949,0.49562,0.89901),
-            QVector3D(0.42377,0.5037,0.89909),
-            QVector3D(0.4377,0.51182,0.89914),
-            QVector3D(0.45127,0.51998,0.89919),
-            QVector3D(0.46453,0.52819,0.89922),
-            QVector3D(0.47747,0.53643,0.89924),
-            QVector3D(0.49016,0.54469,0.89925),
-            QVector3D(0.50259,0.55298,0.89924),
-            QVector3D(0.51481,0.56131,0.89922),
-            QVector3D(0.52682,0.56967,0.89919),
-            QVector3D(0.53863,0.57806,0.89914),
-            QVector3D(0.55025,0.58648,0.89908),
-            QVector3D(0.56172,0.59493,0.89901),
-            QVector3D(0.57302,0.60341,0.89892),
-            QVector3D(0.58417,0.61191,0.89881),
-            QVector3D(0.59519,0.62045,0.89869),
-            QVector3D(0.60608,0.629,0.89856),
-            QVector3D(0.61685,0.63759,0.89841),
-            QVector3D(0.62751,0.6462,0.89825),
-            QVector3D(0.63805,0.65483,0.89807),
-            QVector3D(0.6485,0.66351,0.89788),
-            QVector3D(0.65884,0.67219,0.89767),
-            QVector3D(0.6691,0.6809,0.89745),
-            QVector3D(0.67927,0.68965,0.89721),
-            QVector3D(0.68936,0.6984,0.89695),
-            QVector3D(0.69935,0.70719,0.89668),
-            QVector3D(0.70928,0.71598,0.89638),
-            QVector3D(0.71911,0.72477,0.89605),
-            QVector3D(0.72887,0.73355,0.89569),
-            QVector3D(0.73854,0.7423,0.89528),
-            QVector3D(0.74812,0.75101,0.89481),
-            QVector3D(0.75759,0.75963,0.89427),
-            QVector3D(0.76695,0.76815,0.89362),
-            QVector3D(0.7762,0.77652,0.89286),
-            QVector3D(0.78529,0.78468,0.89193),
-            QVector3D(0.79422,0.79255,0.8908),
-            QVector3D(0.80295,0.80008,0.88943),
-            QVector3D(0.81147,0.80717,0.88775),
-            QVector3D(0.81973,0.81373,0.88571),
-            QVector3D(0.82771,0.81967,0.88323),
-            QVector3D(0.83537,0.82487,0.88026),
-            QVector3D(0.84268,0.82926,0.87672),
-            QVector3D(0.84961,0.83271,0.87256),
-            QVector3D(0.85612,0.83516,0.86771),
-            QVector3D(0.8622,0.83654,0.86213),
-            QVector3D(0.86783,0.83681,0.85578)
-        },
-        {
-            QVector3D(0.10246,0.39014,0.89689),
-            QVector3D(0.11205,0.39152,0.89693),
-            QVector3D(0.12596,0.39371,0.897),
-            QVector3D(0.14277,0.39668,0.89709),
-            QVector3D(0.16137,0.40041,0.8972),
-            QVector3D(0.18085,0.40478,0.89732),
-            QVector3D(0.20072,0.4098,0.89746),
-            QVector3D(0.22066,0.41534,0.8976),
-            QVector3D(0.24027,0.42135,0.89775),
-            QVector3D(0.25956,0.42779,0.89791),
-            QVector3D(0.27833,0.43456,0.89806),
-            QVector3D(0.29659,0.44162,0.8982),
-            QVector3D(0.31428,0.44891,0.89835),
-            QVector3D(0.33142,0.45639,0.89848),
-            QVector3D(0.34803,0.46404,0.89861),
-            QVector3D(0.3641,0.4718,0.89873),
-            QVector3D(0.37969,0.47966,0.89883),
-            QVector3D(0.39481,0.48761,0.89893),
-            QVector3D(0.40949,0.49562,0.89901),
-            QVector3D(0.42377,0.5037,0.89909),
-            QVector3D(0.4377,0.51182,0.89914),
-            QVector3D(0.45127,0.51998,0.89919),
-            QVector3D(0.46453,0.52819,0.89922),
-            QVector3D(0.47747,0.53643,0.89924),
-            QVector3D(0.49016,0.54469,0.89925),
-            QVector3D(0.50259,0.55298,0.89924),
-            QVector3D(0.51481,0.56131,0.89922),
-            QVector3D(0.52682,0.56967,0.89919),
-            QVector3D(0.53863,0.57806,0.89914),
-            QVector3D(0.55025,0.58648,0.89908),
-            QVector3D(0.56172,0.59493,0.89901),
-            QVector3D(0.57302,0.60341,0.89892),
-            QVector3D(0.58417,0.61191,0.89881),
-            QVector3D(0.59519,0.62045,0.89869),
-            QVector3D(0.60608,0.629,0.89856),
-            QVector3D(0.61685,0.63759,0.89841),
-            QVector3D(0.62751,0.6462,0.89825),
-            QVector3D(0.63805,0.65483,0.89807),
-            QVector3D(0.6485,0.66351,0.89788),
-            QVector3D(0.65884,0.67219,0.89767),
-            QVector3D(0.6691,0.6809,0.89745),
-            QVector3D(0.67927,0.68965,0.89721),
-            QVector3D(0.68936,0.6984,0.89695),
-            QVector3D(0.69935,0.70719,0.89668),
-            QVector3D(0.70928,0.71598,0.89638),
-            QVector3D(0.71911,0.72477,0.89605),
-            QVector3D(0.72887,0.73355,0.89569),
-            QVector3D(0.73854,0.7423,0.89528),
-            QVector3D(0.74812,0.75101,0.89481),
-            QVector3D(0.75759,0.75963,0.89427),
-            QVector3D(0.76695,0.76815,0.89362),
-            QVector3D(0.7762,0.77652,0.89286),
-            QVector3D(0.78529,0.78468,0.89193),
-            QVector3D(0.79422,0.79255,0.8908),
-            QVector3D(0.80295,0.80008,0.88943),
-            QVector3D(0.81147,0.80717,0.88775),
-            QVector3D(0.81973,0.81373,0.88571),
-            QVector3D(0.82771,0.81967,0.88323),
-            QVector3D(0.83537,0.82487,0.88026),
-            QVector3D(0.84268,0.82926,0.87672),
-            QVector3D(0.84961,0.83271,0.87256),
-            QVector3D(0.85612,0.83516,0.86771),
-            QVector3D(0.8622,0.83654,0.86213),
-            QVector3D(0.86783,0.83681,0.85578),
-            QVector3D(0.873,0.83593,0.84864),
-            QVector3D(0.8777,0.8339,0.84071),
-            QVector3D(0.88194,0.83075,0.832),
-            QVector3D(0.88572,0.82651,0.82253),
-            QVector3D(0.88906,0.82126,0.81236),
-            QVector3D(0.89199,0.81507,0.80154),
-            QVector3D(0.89451,0.80802,0.79013),
-            QVector3D(0.89666,0.80023,0.77819),
-            QVector3D(0.89847,0.79178,0.76581),
-            QVector3D(0.89996,0.78278,0.75305),
-            QVector3D(0.90116,0.77331,0.73999),
-            QVector3D(0.9021,0.76347,0.72667),
-            QVector3D(0.9028,0.75332,0.71316),
-            QVector3D(0.90327,0.74294,0.69952),
-            QVector3D(0.90355,0.73237,0.68579),
-            QVector3D(0.90363,0.72166,0.67199),
-            QVector3D(0.90355,0.71085,0.65815),
-            QVector3D(0.9033,0.69996,0.64429),
-            QVector3D(0.90289,0.68903,0.63046),
-            QVector3D(0.90234,0.67804,0.61663),
-            QVector3D(0.90165,0.66702,0.60282),
-            QVector3D(0.90082,0.65598,0.58904),
-            QVector3D(0.89986,0.64492,0.57531),
-            QVector3D(0.89877,0.63386,0.56162),
-            QVector3D(0.89757,0.62278,0.54797),
-            QVector3D(0.89623,0.61169,0.53437),
-            QVector3D(0.89478,0.60058,0.52081),
-            QVector3D(0.8932,0.58945,0.5073),
-            QVector3D(0.89151,0.57831,0.49383),
-            QVector3D(0.8897,0.56715,0.48041),
-            QVector3D(0.88777,0.55595,0.46704),
-            QVector3D(0.88574,0.54474,0.4537),
-            QVector3D(0.88359,0.53349,0.44042),
-            QVector3D(0.88134,0.52221,0.42718),
-            QVector3D(0.87897,0.5109,0.41398),
-            QVector3D(0.87649,0.49954,0.40083),
-            QVector3D(0.87391,0.48816,0.3877),
-            QVector3D(0.87123,0.4767,0.37464),
-            QVector3D(0.86845,0.4652,0.3616),
-            QVector3D(0.86556,0.45364,0.34861),
-            QVector3D(0.86257,0.44202,0.33566),
-            QVector3D(0.85948,0.43032,0.32274),
-            QVector3D(0.8563,0.41853,0.30985),
-            QVector3D(0.85302,0.40666,0.29699),
-            QVector3D(0.84965,0.3947,0.28415),
-            QVector3D(0.84618,0.38265,0.27137),
-            QVector3D(0.84264,0.3705,0.25865),
-            QVector3D(0.83901,0.35827,0.24597),
-            QVector3D(0.83532,0.34594,0.23336),
-            QVector3D(0.83157,0.33356,0.22089),
-            QVector3D(0.82777,0.3211,0.20848),
-            QVector3D(0.82395,0.30862,0.19626),
-            QVector3D(0.82013,0.29614,0.1842),
-            QVector3D(0.81634,0.28375,0.17242),
-            QVector3D(0.81259,0.2715,0.16099),
-            QVector3D(0.80896,0.25953,0.14996),
-            QVector3D(0.80546,0.24792,0.1394),
-            QVector3D(0.80217,0.23683,0.12955),
-            QVector3D(0.79914,0.22645,0.1204),
-            QVector3D(0.7964,0.21697,0.11224),
-            QVector3D(0.79405,0.20862,0.10504),
-            QVector3D(0.79209,0.20162,0.099146),
-            QVector3D(0.79061,0.19625,0.094653),
-            QVector3D(0.78962,0.19261,0.091622),
-            QVector3D(0.78916,0.19089,0.090163),
-            QVector3D(0.78923,0.19116,0.09039),
-            QVector3D(0.78984,0.19342,0.092261),
-            QVector3D(0.79096,0.19754,0.095704),
-            QVector3D(0.79258,0.20339,0.10062),
-            QVector3D(0.79465,0.21076,0.10693),
-            QVector3D(0.79711,0.21943,0.11431),
-            QVector3D(0.79994,0.22917,0.12278),
-            QVector3D(0.80304,0.23975,0.13216),
-            QVector3D(0.8064,0.251,0.14222),
-            QVector3D(0.80993,0.26273,0.15286),
-            QVector3D(0.81359,0.27479,0.16406),
-            QVector3D(0.81735,0.28707,0.17556),
-            QVector3D(0.82116,0.29951,0.18745),
-            QVector3D(0.82498,0.31196,0.1995),
-            QVector3D(0.8288,0.32444,0.21181),
-            QVector3D(0.83258,0.33689,0.2242),
-            QVector3D(0.83632,0.34927,0.23677),
-            QVector3D(0.84,0.36157,0.24937),
-            QVector3D(0.84359,0.37378,0.26206),
-            QVector3D(0.84712,0.38589,0.27479),
-            QVector3D(0.85056,0.39792,0.28758),
-            QVector3D(0.8539,0.40986,0.30042),
-            QVector3D(0.85716,0.42169,0.3133),
-            QVector3D(0.86032,0.43345,0.32618),
-            QVector3D(0.86338,0.44514,0.33913),
-            QVector3D(0.86634,0.45674,0.35208),
-            QVector3D(0.8692,0.46829,0.36509),
-            QVector3D(0.87196,0.47978,0.37813),
-            QVector3D(0.87462,0.49122,0.39122),
-            QVector3D(0.87716,0.50259,0.40434),
-            QVector3D(0.87961,0.51395,0.41751),
-            QVector3D(0.88195,0.52525,0.43072),
-            QVector3D(0.88418,0.53652,0.44398),
-            QVector3D(0.8863,0.54775,0.45727),
-            QVector3D(0.8883,0.55896,0.47062),
-            QVector3D(0.89019,0.57014,0.484),
-            QVector3D(0.89197,0.5813,0.49745),
-            QVector3D(0.89363,0.59245,0.51092),
-            QVector3D(0.89518,0.60356,0.52444),
-            QVector3D(0.8966,0.61466,0.53802),
-            QVector3D(0.8979,0.62575,0.55163),
-            QVector3D(0.89908,0.63683,0.56528),
-            QVector3D(0.90012,0.64788,0.579),
-            QVector3D(0.90103,0.65892,0.59275),
-            QVector3D(0.9018,0.66994,0.60654),
-            QVector3D(0.90242,0.6809,0.62037),
-            QVector3D(0.90287,0.69183,0.63422),
-            QVector3D(0.90316,0.70268,0.64808),
-            QVector3D(0.90325,0.71344,0.66197),
-            QVector3D(0.90314,0.72408,0.67583),
-            QVector3D(0.9028,0.73456,0.68967),
-            QVector3D(0.9022,0.74481,0.70344),
-            QVector3D(0.90131,0.7548,0.71713),
-            QVector3D(0.90011,0.76443,0.73066),
-            QVector3D(0.89855,0.77364,0.74401),
-            QVector3D(0.8966,0.78234,0.75711),
-            QVector3D(0.89423,0.79041,0.7699),
-            QVector3D(0.8914,0.79778,0.7823),
-            QVector3D(0.88809,0.80433,0.79423),
-            QVector3D(0.88427,0.80997,0.80561),
-            QVector3D(0.87992,0.81463,0.8164),
-            QVector3D(0.87505,0.81822,0.8265),
-            QVector3D(0.86966,0.82071,0.83587),
-            QVector3D(0.86376,0.82205,0.84446),
-            QVector3D(0.85737,0.82224,0.85225),
-            QVector3D(0.85052,0.8213,0.85923),
-            QVector3D(0.84325,0.81927,0.8654),
-            QVector3D(0.8356,0.81621,0.87079),
-            QVector3D(0.8276,0.81219,0.87544),
-            QVector3D(0.81931,0.80731,0.8794),
-            QVector3D(0.81075,0.80165,0.88274),
-            QVector3D(0.80198,0.79534,0.88552),
-            QVector3D(0.79302,0.78846,0.88781),
-            QVector3D(0.7839,0.78111,0.88969),
-            QVector3D(0.77463,0.77338,0.89122),
-            QVector3D(0.76527,0.76536,0.89246),
-            QVector3D(0.75579,0.75709,0.89345),
-            QVector3D(0.74622,0.74866,0.89427),
-            QVector3D(0.73657,0.7401,0.89494),
-            QVector3D(0.72685,0.73145,0.89549),
-            QVector3D(0.71705,0.72274,0.89595),
-            QVector3D(0.70717,0.71401,0.89635),
-            QVector3D(0.69722,0.70526,0.89669),
-            QVector3D(0.68719,0.69651,0.89699),
-            QVector3D(0.67709,0.68776,0.89726),
-            QVector3D(0.66689,0.67902,0.8975),
-            QVector3D(0.65663,0.67032,0.89772),
-            QVector3D(0.64625,0.66163,0.89792),
-            QVector3D(0.63579,0.65297,0.89811),
-            QVector3D(0.62522,0.64434,0.89828),
-            QVector3D(0.61453,0.63573,0.89844),
-            QVector3D(0.60375,0.62715,0.89859),
-            QVector3D(0.59283,0.6186,0.89872),
-            QVector3D(0.58178,0.61007,0.89884),
-            QVector3D(0.57059,0.60157,0.89894),
-            QVector3D(0.55925,0.59311,0.89902),
-            QVector3D(0.54776,0.58467,0.8991),
-            QVector3D(0.53609,0.57626,0.89915),
-            QVector3D(0.52424,0.56787,0.8992),
-            QVector3D(0.51219,0.55952,0.89923),
-            QVector3D(0.49993,0.5512,0.89925),
-            QVector3D(0.48745,0.54291,0.89925),
-            QVector3D(0.47471,0.53465,0.89924),
-            QVector3D(0.46169,0.52643,0.89922),
-            QVector3D(0.44837,0.51823,0.89918),
-            QVector3D(0.43473,0.51007,0.89913),
-            QVector3D(0.42073,0.50196,0.89907),
-            QVector3D(0.40637,0.49389,0.899),
-            QVector3D(0.39159,0.48588,0.89891),
-            QVector3D(0.37638,0.47795,0.89881),
-            QVector3D(0.36067,0.47012,0.8987),
-            QVector3D(0.34449,0.46237,0.89858),
-            QVector3D(0.32777,0.45477,0.89845),
-            QVector3D(0.31053,0.44731,0.89832),
-            QVector3D(0.29269,0.44007,0.89817),
-            QVector3D(0.27432,0.43307,0.89802),
-            QVector3D(0.25544,0.42636,0.89787),
-            QVector3D(0.23609,0.42002,0.89772),
-            QVector3D(0.21638,0.4141,0.89757),
-            QVector3D(0.19647,0.40866,0.89743),
-            QVector3D(0.17659,0.40379,0.89729),
-            QVector3D(0.15722,0.39953,0.89717),
-            QVector3D(0.13894,0.39598,0.89707),
-            QVector3D(0.1226,0.39316,0.89698),
-            QVector3D(0.10959,0.39116,0.89692),
-            QVector3D(0.1011,0.38996,0.89689),
-            QVector3D(0.098617,0.38962,0.89687)
-        },
-        {
-            QVector3D(0,0.79435,0.99671),
-            QVector3D(0,0.79384,0.99455),
-            QVector3D(0,0.79333,0.99239),
-            QVector3D(0,0.79282,0.99023),
-            QVector3D(0,0.79231,0.98806),
-            QVector3D(0,0.7918,0.9859),
-            QVector3D(0,0.79128,0.98374),
-            QVector3D(0,0.79077,0.98158),
-            QVector3D(0,0.79026,0.97942),
-            QVector3D(0,0.78975,0.97726),
-            QVector3D(0,0.78924,0.9751),
-            QVector3D(0,0.78872,0.97295),
-            QVector3D(0,0.7882,0.97079),
-            QVector3D(0,0.78769,0.96863),
-            QVector3D(0,0.78717,0.96647),
-            QVector3D(0.030516,0.78666,0.96431),
-            QVector3D(0.077099,0.78614,0.96216),
-            QVector3D(0.10792,0.78562,0.96001),
-            QVector3D(0.13219,0.7851,0.95785),
-            QVector3D(0.15262,0.78458,0.9557),
-            QVector3D(0.17059,0.78406,0.95354),
-            QVector3D(0.18672,0.78354,0.95139),
-            QVector3D(0.20145,0.78302,0.94923),
-            QVector3D(0.21508,0.7825,0.94708),
-            QVector3D(0.22782,0.78198,0.94493),
-            QVector3D(0.23976,0.78145,0.94278),
-            QVector3D(0.25106,0.78093,0.94063),
-            QVector3D(0.26179,0.7804,0.93848),
-            QVector3D(0.272,0.77988,0.93633),
-            QVector3D(0.28182,0.77935,0.93417),
-            QVector3D(0.29123,0.77882,0.93203),
-            QVector3D(0.30027,0.7783,0.92988),
-            QVector3D(0.30902,0.77777,0.92773),
-            QVector3D(0.31745,0.77725,0.92558),
-            QVector3D(0.32562,0.77672,0.92344),
-            QVector3D(0.33356,0.77618,0.92129),
-            QVector3D(0.34126,0.77565,0.91914),
-            QVector3D(0.34875,0.77512,0.917),
-            QVector3D(0.35605,0.77459,0.91485),
-            QVector3D(0.36315,0.77406,0.91271),
-            QVector3D(0.37009,0.77352,0.91056),
-            QVector3D(0.37688,0.77299,0.90842),
-            QVector3D(0.3835,0.77246,0.90627),
-            QVector3D(0.38997,0.77193,0.90413),
-            QVector3D(0.39633,0.77139,0.90199),
-            QVector3D(0.40254,0.77086,0.89985),
-            QVector3D(0.40865,0.77032,0.8977),
-            QVector3D(0.41463,0.76978,0.89556),
-            QVector3D(0.4205,0.76924,0.89342),
-            QVector3D(0.42627,0.7687,0.89128),
-            QVector3D(0.43196,0.76816,0.88914),
-            QVector3D(0.43753,0.76762,0.887),
-            QVector3D(0.443,0.76708,0.88486),
-            QVector3D(0.44839,0.76654,0.88272),
-            QVector3D(0.4537,0.766,0.88058),
-            QVector3D(0.45893,0.76546,0.87844),
-            QVector3D(0.46409,0.76492,0.8763),
-            QVector3D(0.46917,0.76437,0.87417),
-            QVector3D(0.47416,0.76382,0.87203),
-            QVector3D(0.4791,0.76328,0.86989),
-            QVector3D(0.48396,0.76273,0.86776),
-            QVector3D(0.48876,0.76219,0.86562),
-            QVector3D(0.4935,0.76164,0.86349),
-            QVector3D(0.49819,0.76109,0.86135),
-            QVector3D(0.5028,0.76054,0.85922),
-            QVector3D(0.50737,0.75999,0.85708),
-            QVector3D(0.51187,0.75944,0.85495),
-            QVector3D(0.51632,0.75889,0.85282),
-            QVector3D(0.52073,0.75834,0.85068),
-            QVector3D(0.52508,0.75779,0.84855),
-            QVector3D(0.52939,0.75723,0.84641),
-            QVector3D(0.53364,0.75668,0.84429),
-            QVector3D(0.53786,0.75612,0.84216),
-            QVector3D(0.54202,0.75557,0.84003),
-            QVector3D(0.54615,0.75502,0.83789),
-            QVector3D(0.55022,0.75446,0.83576),
-            QVector3D(0.55426,0.7539,0.83363),
-            QVector3D(0.55825,0.75334,0.83151),
-            QVector3D(0.56222,0.75278,0.82938),
-            QVector3D(0.56614,0.75222,0.82725),
-            QVector3D(0.57001,0.75166,0.82511),
-            QVector3D(0.57386,0.7511,0.82299),
-            QVector3D(0.57767,0.75054,0.82086),
-            QVector3D(0.58145,0.74997,0.81873),
-            QVector3D(0.5852,0.7494,0.81661),
-            QVector3D(0.58889,0.74884,0.81448),
-            QVector3D(0.59258,0.74828,0.81235),
-            QVector3D(0.59622,0.74772,0.81023),
-            QVector3D(0.59983,0.74715,0.8081),
-            QVector3D(0.60342,0.74658,0.80598),
-            QVector3D(0.60697,0.74601,0.80385),
-            QVector3D(0.61049,0.74544,0.80173),
-            QVector3D(0.61398,0.74487,0.79961),
-            QVector3D(0.61745,0.7443,0.79748),
-            QVector3D(0.62089,0.74373,0.79536),
-            QVector3D(0.6243,0.74316,0.79324),
-            QVector3D(0.62769,0.74258,0.79111),
-            QVector3D(0.63105,0.742,0.78899),
-            QVector3D(0.63438,0.74143,0.78687),
-            QVector3D(0.63769,0.74085,0.78475),
-            QVector3D(0.64097,0.74028,0.78262),
-            QVector3D(0.64423,0.73971,0.7805),
-            QVector3D(0.64747,0.73913,0.77838),
-            QVector3D(0.65069,0.73854,0.77626),
-            QVector3D(0.65388,0.73796,0.77414),
-            QVector3D(0.65705,0.73738,0.77202),
-            QVector3D(0.66019,0.7368,0.7699),
-            QVector3D(0.66332,0.73621,0.76778),
-            QVector3D(0.66642,0.73563,0.76567),
-            QVector3D(0.66951,0.73505,0.76355),
-            QVector3D(0.67257,0.73446,0.76145),
-            QVector3D(0.6756,0.73388,0.75935),
-            QVector3D(0.67862,0.73329,0.75727),
-            QVector3D(0.68161,0.7327,0.75521),
-            QVector3D(0.68458,0.73211,0.75316),
-            QVector3D(0.68753,0.73151,0.75116),
-            QVector3D(0.69045,0.73091,0.74918),
-            QVector3D(0.69334,0.73031,0.74727),
-            QVector3D(0.6962,0.72971,0.74541),
-            QVector3D(0.69902,0.7291,0.74364),
-            QVector3D(0.70181,0.72848,0.74196),
-            QVector3D(0.70456,0.72786,0.74039),
-            QVector3D(0.70726,0.72724,0.73895),
-            QVector3D(0.70992,0.72661,0.73766),
-            QVector3D(0.71252,0.72597,0.73652),
-            QVector3D(0.71507,0.72533,0.73557),
-            QVector3D(0.71757,0.72468,0.73481),
-            QVector3D(0.72,0.72402,0.73423),
-            QVector3D(0.72237,0.72335,0.73386),
-            QVector3D(0.7247,0.72268,0.73368),
-            QVector3D(0.72695,0.722,0.7337),
-            QVector3D(0.72915,0.72132,0.73391),
-            QVector3D(0.7313,0.72063,0.73429),
-            QVector3D(0.7334,0.71994,0.73484),
-            QVector3D(0.73545,0.71924,0.73553),
-            QVector3D(0.73745,0.71854,0.73635),
-            QVector3D(0.73943,0.71784,0.73729),
-            QVector3D(0.74136,0.71713,0.73833),
-            QVector3D(0.74327,0.71642,0.73945),
-            QVector3D(0.74515,0.71571,0.74062),
-            QVector3D(0.74702,0.71498,0.74185),
-            QVector3D(0.74887,0.71426,0.74313),
-            QVector3D(0.75071,0.71355,0.74443),
-            QVector3D(0.75252,0.71282,0.74576),
-            QVector3D(0.75434,0.7121,0.74711),
-            QVector3D(0.75615,0.71138,0.74847),
-            QVector3D(0.75795,0.71064,0.74983),
-            QVector3D(0.75974,0.70991,0.75121),
-            QVector3D(0.76153,0.70918,0.75258),
-            QVector3D(0.76332,0.70845,0.75397),
-            QVector3D(0.76511,0.7077,0.75535),
-            QVector3D(0.76688,0.70697,0.75673),
-            QVector3D(0.76866,0.70623,0.75812),
-            QVector3D(0.77044,0.70548,0.75949),
-            QVector3D(0.77221,0.70474,0.76088),
-            QVector3D(0.77397,0.70399,0.76225),
-            QVector3D(0.77574,0.70324,0.76364),
-            QVector3D(0.77751,0.70249,0.76502),
-            QVector3D(0.77926,0.70173,0.7664),
-            QVector3D(0.78102,0.70098,0.76778),
-            QVector3D(0.78278,0.70021,0.76916),
-            QVector3D(0.78453,0.69945,0.77055),
-            QVector3D(0.78628,0.69869,0.77193),
-            QVector3D(0.78802,0.69792,0.7733),
-            QVector3D(0.78977,0.69715,0.77468),
-            QVector3D(0.79151,0.69639,0.77607),
-            QVector3D(0.79325,0.69561,0.77745),
-            QVector3D(0.79498,0.69483,0.77883),
-            QVector3D(0.79672,0.69405,0.78021),
-            QVector3D(0.79845,0.69328,0.78159),
-            QVector3D(0.80018,0.6925,0.78297),
-            QVector3D(0.8019,0.69171,0.78435),
-            QVector3D(0.80363,0.69092,0.78573),
-            QVector3D(0.80534,0.69014,0.78711),
-            QVector3D(0.80707,0.68935,0.78849),
-            QVector3D(0.80878,0.68855,0.78987),
-            QVector3D(0.81049,0.68775,0.79125),
-            QVector3D(0.8122,0.68695,0.79263),
-            QVector3D(0.81391,0.68615,0.79401),
-            QVector3D(0.81562,0.68535,0.79539),
-            QVector3D(0.81732,0.68454,0.79677),
-            QVector3D(0.81902,0.68373,0.79815),
-            QVector3D(0.82072,0.68292,0.79953),
-            QVector3D(0.82242,0.68211,0.80091),
-            QVector3D(0.82411,0.68129,0.80228),
-            QVector3D(0.82581,0.68047,0.80367),
-            QVector3D(0.8275,0.67965,0.80504),
-            QVector3D(0.82919,0.67883,0.80643),
-            QVector3D(0.83087,0.67801,0.8078),
-            QVector3D(0.83255,0.67718,0.80919),
-            QVector3D(0.83424,0.67634,0.81056),
-            QVector3D(0.83591,0.67551,0.81194),
-            QVector3D(0.83759,0.67467,0.81332),
-            QVector3D(0.83927,0.67383,0.8147),
-            QVector3D(0.84094,0.67299,0.81608),
-            QVector3D(0.84261,0.67215,0.81746),
-            QVector3D(0.84427,0.6713,0.81883),
-            QVector3D(0.84594,0.67045,0.82021),
-            QVector3D(0.8476,0.6696,0.8216),
-            QVector3D(0.84927,0.66874,0.82297),
-            QVector3D(0.85092,0.66788,0.82435),
-            QVector3D(0.85259,0.66702,0.82573),
-            QVector3D(0.85424,0.66615,0.82711),
-            QVector3D(0.8559,0.66529,0.82849),
-            QVector3D(0.85754,0.66442,0.82987),
-            QVector3D(0.85919,0.66355,0.83125),
-            QVector3D(0.86084,0.66268,0.83263),
-            QVector3D(0.86249,0.6618,0.83401),
-            QVector3D(0.86414,0.66091,0.83538),
-            QVector3D(0.86577,0.66003,0.83676),
-            QVector3D(0.86741,0.65914,0.83814),
-            QVector3D(0.86906,0.65826,0.83952),
-            QVector3D(0.87069,0.65737,0.8409),
-            QVector3D(0.87233,0.65647,0.84228),
-            QVector3D(0.87395,0.65557,0.84366),
-            QVector3D(0.87559,0.65467,0.84504),
-            QVector3D(0.87721,0.65377,0.84641),
-            QVector3D(0.87884,0.65285,0.84779),
-            QVector3D(0.88047,0.65195,0.84918),
-            QVector3D(0.88209,0.65104,0.85055),
-            QVector3D(0.88371,0.65012,0.85193),
-            QVector3D(0.88533,0.64921,0.85331),
-            QVector3D(0.88695,0.64828,0.85469),
-            QVector3D(0.88857,0.64736,0.85607),
-            QVector3D(0.89018,0.64643,0.85745),
-            QVector3D(0.89179,0.64549,0.85883),
-            QVector3D(0.8934,0.64456,0.86021),
-            QVector3D(0.89502,0.64362,0.86159),
-            QVector3D(0.89662,0.64269,0.86297),
-            QVector3D(0.89822,0.64174,0.86435),
-            QVector3D(0.89983,0.64079,0.86572),
-            QVector3D(0.90143,0.63985,0.8671),
-            QVector3D(0.90304,0.63889,0.86849),
-            QVector3D(0.90463,0.63793,0.86986),
-            QVector3D(0.90623,0.63698,0.87124),
-            QVector3D(0.90783,0.63601,0.87262),
-            QVector3D(0.90942,0.63504,0.874),
-            QVector3D(0.91101,0.63408,0.87538),
-            QVector3D(0.9126,0.6331,0.87675),
-            QVector3D(0.91419,0.63213,0.87814),
-            QVector3D(0.91578,0.63115,0.87951),
-            QVector3D(0.91737,0.63016,0.8809),
-            QVector3D(0.91895,0.62917,0.88227),
-            QVector3D(0.92053,0.62819,0.88366),
-            QVector3D(0.92212,0.62719,0.88504),
-            QVector3D(0.9237,0.62619,0.88642),
-            QVector3D(0.92527,0.62519,0.88779),
-            QVector3D(0.92685,0.62419,0.88918),
-            QVector3D(0.92842,0.62319,0.89055),
-            QVector3D(0.93,0.62217,0.89194),
-            QVector3D(0.93157,0.62116,0.89331),
-            QVector3D(0.93314,0.62014,0.8947),
-            QVector3D(0.93471,0.61912,0.89607),
-            QVector3D(0.93628,0.61809,0.89746),
-            QVector3D(0.93785,0.61706,0.89883),
-            QVector3D(0.93941,0.61603,0.90021)
-        },
-        {
-            QVector3D(0,0.71527,1),
-            QVector3D(0,0.7149,1),
-            QVector3D(0,0.71453,1),
-            QVector3D(0,0.71417,1),
-            QVector3D(0.024434,0.7138,1),
-            QVector3D(0.068274,0.71344,0.99912),
-            QVector3D(0.097664,0.71307,0.99639),
-            QVector3D(0.12062,0.71271,0.99368),
-            QVector3D(0.13997,0.71234,0.99096),
-            QVector3D(0.15693,0.71199,0.98824),
-            QVector3D(0.1721,0.71163,0.98553),
-            QVector3D(0.18598,0.71126,0.98281),
-            QVector3D(0.19872,0.7109,0.9801),
-            QVector3D(0.21064,0.71054,0.97739),
-            QVector3D(0.2218,0.71018,0.97467),
-            QVector3D(0.23235,0.70981,0.97196),
-            QVector3D(0.24234,0.70945,0.96925),
-            QVector3D(0.25188,0.7091,0.96654),
-            QVector3D(0.26097,0.70874,0.96383),
-            QVector3D(0.26971,0.70837,0.96112),
-            QVector3D(0.27808,0.70801,0.95841),
-            QVector3D(0.28614,0.70765,0.95571),
-            QVector3D(0.29394,0.70729,0.953),
-            QVector3D(0.30148,0.70693,0.95029),
-            QVector3D(0.3088,0.70658,0.94759),
-            QVector3D(0.31588,0.70622,0.94488),
-            QVector3D(0.32276,0.70586,0.94218),
-            QVector3D(0.32945,0.7055,0.93948),
-            QVector3D(0.33595,0.70514,0.93678),
-            QVector3D(0.3423,0.70478,0.93407),
-            QVector3D(0.34848,0.70443,0.93137),
-            QVector3D(0.35453,0.70407,0.92867),
-            QVector3D(0.36042,0.70371,0.92597),
-            QVector3D(0.3662,0.70336,0.92327),
-            QVector3D(0.37184,0.703,0.92057),
-            QVector3D(0.37737,0.70265,0.91788),
-            QVector3D(0.38279,0.70229,0.91518),
-            QVector3D(0.38809,0.70193,0.91249),
-            QVector3D(0.3933,0.70158,0.90979),
-            QVector3D(0.39841,0.70122,0.9071),
-            QVector3D(0.40343,0.70087,0.9044),
-            QVector3D(0.40835,0.70052,0.90171),
-            QVector3D(0.4132,0.70016,0.89902),
-            QVector3D(0.41795,0.69981,0.89633),
-            QVector3D(0.42262,0.69945,0.89363),
-            QVector3D(0.42723,0.6991,0.89094),
-            QVector3D(0.43176,0.69875,0.88826),
-            QVector3D(0.43621,0.69839,0.88557),
-            QVector3D(0.44059,0.69804,0.88288),
-            QVector3D(0.44493,0.69769,0.88019),
-            QVector3D(0.44919,0.69734,0.8775),
-            QVector3D(0.45337,0.69699,0.87482),
-            QVector3D(0.45751,0.69664,0.87213),
-            QVector3D(0.46159,0.69629,0.86945),
-            QVector3D(0.46561,0.69594,0.86676),
-            QVector3D(0.46959,0.69559,0.86408),
-            QVector3D(0.47349,0.69524,0.86139),
-            QVector3D(0.47736,0.69489,0.85871),
-            QVector3D(0.48117,0.69453,0.85603),
-            QVector3D(0.48494,0.69418,0.85335),
-            QVector3D(0.48866,0.69384,0.85067),
-            QVector3D(0.49233,0.69349,0.84799),
-            QVector3D(0.49596,0.69315,0.84531),
-            QVector3D(0.49954,0.6928,0.84264),
-            QVector3D(0.50308,0.69245,0.83996),
-            QVector3D(0.50659,0.6921,0.83728),
-            QVector3D(0.51005,0.69175,0.8346),
-            QVector3D(0.51348,0.6914,0.83193),
-            QVector3D(0.51686,0.69105,0.82925),
-            QVector3D(0.5202,0.69071,0.82658),
-            QVector3D(0.52352,0.69036,0.8239),
-            QVector3D(0.52679,0.69002,0.82123),
-            QVector3D(0.53003,0.68967,0.81855),
-            QVector3D(0.53323,0.68933,0.81588),
-            QVector3D(0.5364,0.68898,0.81321),
-            QVector3D(0.53953,0.68864,0.81053),
-            QVector3D(0.54265,0.68829,0.80787),
-            QVector3D(0.54572,0.68795,0.80519),
-            QVector3D(0.54877,0.6876,0.80252),
-            QVector3D(0.55178,0.68726,0.79986),
-            QVector3D(0.55476,0.68691,0.79718),
-            QVector3D(0.55772,0.68657,0.79452),
-            QVector3D(0.56064,0.68622,0.79185),
-            QVector3D(0.56355,0.68588,0.78919),
-            QVector3D(0.56642,0.68554,0.78652),
-            QVector3D(0.56925,0.6852,0.78385),
-            QVector3D(0.57208,0.68485,0.78118),
-            QVector3D(0.57487,0.68451,0.77852),
-            QVector3D(0.57763,0.68416,0.77585),
-            QVector3D(0.58038,0.68382,0.77318),
-            QVector3D(0.5831,0.68348,0.77052),
-            QVector3D(0.5858,0.68314,0.76786),
-            QVector3D(0.58846,0.6828,0.7652),
-            QVector3D(0.59111,0.68246,0.76253),
-            QVector3D(0.59374,0.68212,0.75987),
-            QVector3D(0.59634,0.68177,0.75721),
-            QVector3D(0.59892,0.68143,0.75455),
-            QVector3D(0.60148,0.68109,0.75189),
-            QVector3D(0.60402,0.68075,0.74922),
-            QVector3D(0.60653,0.68041,0.74656),
-            QVector3D(0.60904,0.68007,0.7439),
-            QVector3D(0.61151,0.67974,0.74124),
-            QVector3D(0.61395,0.6794,0.73859),
-            QVector3D(0.6164,0.67906,0.73592),
-            QVector3D(0.61882,0.67872,0.73327),
-            QVector3D(0.62121,0.67839,0.73061),
-            QVector3D(0.62359,0.67805,0.72795),
-            QVector3D(0.62595,0.67771,0.7253),
-            QVector3D(0.62829,0.67738,0.72263),
-            QVector3D(0.63062,0.67704,0.71998),
-            QVector3D(0.63293,0.6767,0.71733),
-            QVector3D(0.63522,0.67636,0.71467),
-            QVector3D(0.6375,0.67601,0.71202),
-            QVector3D(0.63977,0.67567,0.70938),
-            QVector3D(0.64203,0.67533,0.70674),
-            QVector3D(0.64428,0.67498,0.7041),
-            QVector3D(0.64653,0.67463,0.70147),
-            QVector3D(0.64878,0.67427,0.69886),
-            QVector3D(0.65103,0.67391,0.69626),
-            QVector3D(0.65329,0.67353,0.69367),
-            QVector3D(0.65556,0.67315,0.6911),
-            QVector3D(0.65785,0.67276,0.68857),
-            QVector3D(0.66016,0.67235,0.68605),
-            QVector3D(0.6625,0.67193,0.68357),
-            QVector3D(0.66485,0.67148,0.68111),
-            QVector3D(0.66726,0.67103,0.6787),
-            QVector3D(0.6697,0.67055,0.67633),
-            QVector3D(0.67218,0.67005,0.67399),
-            QVector3D(0.6747,0.66953,0.6717),
-            QVector3D(0.67726,0.66898,0.66945),
-            QVector3D(0.67985,0.66842,0.66724),
-            QVector3D(0.68249,0.66784,0.66507),
-            QVector3D(0.68516,0.66723,0.66295),
-            QVector3D(0.68786,0.6666,0.66084),
-            QVector3D(0.69058,0.66596,0.65878),
-            QVector3D(0.69332,0.66531,0.65675),
-            QVector3D(0.69608,0.66464,0.65473),
-            QVector3D(0.69884,0.66396,0.65274),
-            QVector3D(0.70162,0.66328,0.65077),
-            QVector3D(0.7044,0.66258,0.64882),
-            QVector3D(0.70718,0.66187,0.64687),
-            QVector3D(0.70995,0.66115,0.64493),
-            QVector3D(0.71271,0.66044,0.643),
-            QVector3D(0.71548,0.65972,0.64107),
-            QVector3D(0.71822,0.65899,0.63915),
-            QVector3D(0.72096,0.65827,0.63724),
-            QVector3D(0.72369,0.65754,0.63532),
-            QVector3D(0.72641,0.65681,0.63341),
-            QVector3D(0.72911,0.65607,0.6315),
-            QVector3D(0.7318,0.65533,0.62958),
-            QVector3D(0.73448,0.65459,0.62767),
-            QVector3D(0.73715,0.65385,0.62576),
-            QVector3D(0.7398,0.6531,0.62385),
-            QVector3D(0.74244,0.65236,0.62193),
-            QVector3D(0.74507,0.65162,0.62003),
-            QVector3D(0.74769,0.65087,0.61811),
-            QVector3D(0.75029,0.65012,0.61621),
-            QVector3D(0.75287,0.64937,0.61429),
-            QVector3D(0.75546,0.64862,0.61238),
-            QVector3D(0.75803,0.64786,0.61047),
-            QVector3D(0.76059,0.64711,0.60857),
-            QVector3D(0.76313,0.64634,0.60666),
-            QVector3D(0.76567,0.64558,0.60475),
-            QVector3D(0.76819,0.64482,0.60283),
-            QVector3D(0.77071,0.64405,0.60092),
-            QVector3D(0.77321,0.64329,0.59902),
-            QVector3D(0.7757,0.64252,0.59711),
-            QVector3D(0.77819,0.64175,0.5952),
-            QVector3D(0.78066,0.64098,0.59329),
-            QVector3D(0.78312,0.64021,0.59138),
-            QVector3D(0.78557,0.63943,0.58947),
-            QVector3D(0.78801,0.63865,0.58756),
-            QVector3D(0.79044,0.63787,0.58566),
-            QVector3D(0.79287,0.63709,0.58374),
-            QVector3D(0.79528,0.63631,0.58183),
-            QVector3D(0.79768,0.63552,0.57993),
-            QVector3D(0.80008,0.63473,0.57801),
-            QVector3D(0.80246,0.63395,0.57612),
-            QVector3D(0.80484,0.63315,0.5742),
-            QVector3D(0.80721,0.63236,0.5723),
-            QVector3D(0.80956,0.63156,0.57038),
-            QVector3D(0.81191,0.63077,0.56848),
-            QVector3D(0.81425,0.62996,0.56657),
-            QVector3D(0.81658,0.62916,0.56466),
-            QVector3D(0.8189,0.62836,0.56276),
-            QVector3D(0.82122,0.62755,0.56084),
-            QVector3D(0.82352,0.62674,0.55893),
-            QVector3D(0.82582,0.62593,0.55704),
-            QVector3D(0.82811,0.62511,0.55512),
-            QVector3D(0.83039,0.6243,0.55321),
-            QVector3D(0.83266,0.62349,0.55131),
-            QVector3D(0.83493,0.62266,0.5494),
-            QVector3D(0.83719,0.62184,0.54749),
-            QVector3D(0.83944,0.62102,0.54559),
-            QVector3D(0.84168,0.6202,0.54367),
-            QVector3D(0.84391,0.61937,0.54176),
-            QVector3D(0.84614,0.61854,0.53985),
-            QVector3D(0.84836,0.6177,0.53795),
-            QVector3D(0.85057,0.61687,0.53604),
-            QVector3D(0.85278,0.61603,0.53413),
-            QVector3D(0.85497,0.61518,0.53223),
-            QVector3D(0.85716,0.61434,0.53031),
-            QVector3D(0.85935,0.6135,0.52841),
-            QVector3D(0.86152,0.61265,0.5265),
-            QVector3D(0.86369,0.6118,0.52458),
-            QVector3D(0.86585,0.61096,0.52268),
-            QVector3D(0.86801,0.6101,0.52076),
-            QVector3D(0.87015,0.60925,0.51886),
-            QVector3D(0.8723,0.60839,0.51695),
-            QVector3D(0.87443,0.60753,0.51503),
-            QVector3D(0.87656,0.60666,0.51312),
-            QVector3D(0.87868,0.60579,0.51121),
-            QVector3D(0.8808,0.60493,0.5093),
-            QVector3D(0.88291,0.60406,0.50739),
-            QVector3D(0.88501,0.60319,0.50547),
-            QVector3D(0.88711,0.60231,0.50356),
-            QVector3D(0.8892,0.60143,0.50166),
-            QVector3D(0.89128,0.60055,0.49974),
-            QVector3D(0.89336,0.59967,0.49784),
-            QVector3D(0.89544,0.59878,0.49591),
-            QVector3D(0.8975,0.59789,0.49401),
-            QVector3D(0.89956,0.59701,0.49209),
-            QVector3D(0.90162,0.59611,0.49018),
-            QVector3D(0.90367,0.59521,0.48827),
-            QVector3D(0.90571,0.59431,0.48635),
-            QVector3D(0.90775,0.59341,0.48443),
-            QVector3D(0.90978,0.59252,0.48252),
-            QVector3D(0.9118,0.5916,0.4806),
-            QVector3D(0.91383,0.59069,0.47869),
-            QVector3D(0.91583,0.58978,0.47677),
-            QVector3D(0.91785,0.58886,0.47486),
-            QVector3D(0.91985,0.58794,0.47293),
-            QVector3D(0.92185,0.58703,0.47102),
-            QVector3D(0.92385,0.58611,0.46911),
-            QVector3D(0.92583,0.58518,0.46719),
-            QVector3D(0.92781,0.58425,0.46526),
-            QVector3D(0.92979,0.58332,0.46333),
-            QVector3D(0.93176,0.58238,0.46142),
-            QVector3D(0.93373,0.58145,0.4595),
-            QVector3D(0.9357,0.58051,0.45758),
-            QVector3D(0.93765,0.57957,0.45566),
-            QVector3D(0.93961,0.57862,0.45373),
-            QVector3D(0.94155,0.57767,0.45181),
-            QVector3D(0.9435,0.57673,0.44989),
-            QVector3D(0.94543,0.57577,0.44796),
-            QVector3D(0.94737,0.5748,0.44603),
-            QVector3D(0.94929,0.57384,0.44412),
-            QVector3D(0.95122,0.57289,0.44219),
-            QVector3D(0.95314,0.57192,0.44025),
-            QVector3D(0.95505,0.57094,0.43833),
-            QVector3D(0.95696,0.56997,0.4364),
-            QVector3D(0.95887,0.56899,0.43447),
-            QVector3D(0.96077,0.56802,0.43254),
-            QVector3D(0.96266,0.56704,0.43061),
-            QVector3D(0.96455,0.56605,0.42867),
-            QVector3D(0.96644,0.56505,0.42674)
-        },
-        {
-            QVector3D(0,0.1654,0.84384),
-            QVector3D(0,0.16745,0.84024),
-            QVector3D(0,0.16948,0.83663),
-            QVector3D(0,0.17145,0.83302),
-            QVector3D(0,0.17344,0.82943),
-            QVector3D(0,0.17543,0.82582),
-            QVector3D(0,0.17744,0.82223),
-            QVector3D(0,0.1794,0.81863),
-            QVector3D(0.025922,0.18135,0.81503),
-            QVector3D(0.052828,0.18332,0.81145),
-            QVector3D(0.073384,0.18532,0.80785),
-            QVector3D(0.089868,0.18726,0.80427),
-            QVector3D(0.10397,0.1892,0.80068),
-            QVector3D(0.11641,0.19113,0.79709),
-            QVector3D(0.12754,0.19308,0.79352),
-            QVector3D(0.13776,0.19502,0.78993),
-            QVector3D(0.14712,0.19696,0.78636),
-            QVector3D(0.15586,0.19885,0.78277),
-            QVector3D(0.16403,0.20076,0.7792),
-            QVector3D(0.17168,0.20269,0.77562),
-            QVector3D(0.17895,0.20462,0.77205),
-            QVector3D(0.18585,0.20653,0.76848),
-            QVector3D(0.19237,0.20841,0.76492),
-            QVector3D(0.19861,0.2103,0.76135),
-            QVector3D(0.20461,0.21221,0.75779),
-            QVector3D(0.21032,0.21409,0.75423),
-            QVector3D(0.21583,0.21599,0.75066),
-            QVector3D(0.22112,0.21785,0.7471),
-            QVector3D(0.22622,0.21973,0.74355),
-            QVector3D(0.23112,0.22159,0.73999),
-            QVector3D(0.23587,0.22347,0.73643),
-            QVector3D(0.24042,0.22532,0.73288),
-            QVector3D(0.24486,0.22719,0.72933),
-            QVector3D(0.24917,0.22905,0.72578),
-            QVector3D(0.25333,0.2309,0.72223),
-            QVector3D(0.25737,0.23274,0.71868),
-            QVector3D(0.26128,0.23461,0.71514),
-            QVector3D(0.26508,0.23645,0.7116),
-            QVector3D(0.2688,0.23827,0.70806),
-            QVector3D(0.27236,0.2401,0.70452),
-            QVector3D(0.27589,0.24194,0.70098),
-            QVector3D(0.27929,0.24376,0.69744),
-            QVector3D(0.2826,0.24558,0.6939),
-            QVector3D(0.2858,0.24742,0.69037),
-            QVector3D(0.28896,0.24924,0.68684),
-            QVector3D(0.29202,0.25106,0.68331),
-            QVector3D(0.29499,0.25287,0.67978),
-            QVector3D(0.2979,0.2547,0.67625),
-            QVector3D(0.30074,0.25648,0.67273),
-            QVector3D(0.3035,0.25829,0.6692),
-            QVector3D(0.30623,0.2601,0.66568),
-            QVector3D(0.30886,0.2619,0.66216),
-            QVector3D(0.31142,0.26371,0.65863),
-            QVector3D(0.31394,0.26549,0.65511),
-            QVector3D(0.31639,0.26726,0.6516),
-            QVector3D(0.31878,0.26908,0.64807),
-            QVector3D(0.32112,0.27087,0.64456),
-            QVector3D(0.3234,0.27263,0.64104),
-            QVector3D(0.32562,0.27442,0.63753),
-            QVector3D(0.3278,0.27621,0.63402),
-            QVector3D(0.32994,0.27798,0.63051),
-            QVector3D(0.33201,0.27975,0.62699),
-            QVector3D(0.33404,0.28152,0.62349),
-            QVector3D(0.33602,0.28329,0.61998),
-            QVector3D(0.33795,0.28504,0.61647),
-            QVector3D(0.33985,0.28681,0.61296),
-            QVector3D(0.34169,0.28858,0.60946),
-            QVector3D(0.34349,0.29033,0.60594),
-            QVector3D(0.34525,0.2921,0.60244),
-            QVector3D(0.34698,0.29385,0.59894),
-            QVector3D(0.34865,0.2956,0.59544),
-            QVector3D(0.3503,0.29736,0.59194),
-            QVector3D(0.35188,0.29912,0.58843),
-            QVector3D(0.35345,0.30085,0.58494),
-            QVector3D(0.35499,0.30259,0.58143),
-            QVector3D(0.35647,0.30434,0.57793),
-            QVector3D(0.35792,0.3061,0.57443),
-            QVector3D(0.35932,0.30781,0.57094),
-            QVector3D(0.36069,0.30957,0.56744),
-            QVector3D(0.36205,0.31129,0.56395),
-            QVector3D(0.36335,0.31302,0.56045),
-            QVector3D(0.36463,0.31475,0.55696),
-            QVector3D(0.36588,0.31649,0.55345),
-            QVector3D(0.36709,0.31821,0.54996),
-            QVector3D(0.36827,0.31994,0.54647),
-            QVector3D(0.36941,0.32165,0.54297),
-            QVector3D(0.37053,0.32338,0.53947),
-            QVector3D(0.37161,0.32509,0.53597),
-            QVector3D(0.37267,0.32681,0.53248),
-            QVector3D(0.3737,0.32854,0.52899),
-            QVector3D(0.37469,0.33025,0.52549),
-            QVector3D(0.37565,0.33196,0.52198),
-            QVector3D(0.3766,0.33368,0.5185),
-            QVector3D(0.3775,0.33539,0.51499),
-            QVector3D(0.37838,0.33709,0.51149),
-            QVector3D(0.37924,0.33879,0.508),
-            QVector3D(0.38006,0.3405,0.50451),
-            QVector3D(0.38087,0.3422,0.501),
-            QVector3D(0.38163,0.34389,0.4975),
-            QVector3D(0.38237,0.34559,0.494),
-            QVector3D(0.3831,0.3473,0.4905),
-            QVector3D(0.38379,0.34899,0.48699),
-            QVector3D(0.38445,0.35069,0.48348),
-            QVector3D(0.38508,0.35237,0.47998),
-            QVector3D(0.3857,0.35406,0.47647),
-            QVector3D(0.38629,0.35576,0.47296),
-            QVector3D(0.38685,0.35745,0.46946),
-            QVector3D(0.38739,0.35912,0.46593),
-            QVector3D(0.38791,0.3608,0.46242),
-            QVector3D(0.3884,0.3625,0.45891),
-            QVector3D(0.38888,0.36417,0.45539),
-            QVector3D(0.38931,0.36586,0.45188),
-            QVector3D(0.38973,0.36753,0.44835),
-            QVector3D(0.39012,0.36922,0.44483),
-            QVector3D(0.3905,0.37088,0.4413),
-            QVector3D(0.39085,0.37256,0.43778),
-            QVector3D(0.39118,0.37425,0.43423),
-            QVector3D(0.39148,0.37591,0.4307),
-            QVector3D(0.39176,0.37758,0.42717),
-            QVector3D(0.39201,0.37925,0.42362),
-            QVector3D(0.39224,0.38092,0.42008),
-            QVector3D(0.39246,0.38258,0.41653),
-            QVector3D(0.39264,0.38425,0.41298),
-            QVector3D(0.39281,0.3859,0.40942),
-            QVector3D(0.39296,0.38757,0.40587),
-            QVector3D(0.39308,0.38924,0.40228),
-            QVector3D(0.39318,0.3909,0.39872),
-            QVector3D(0.39326,0.39255,0.39515),
-            QVector3D(0.39669,0.39314,0.39214),
-            QVector3D(0.40343,0.39266,0.38969),
-            QVector3D(0.41007,0.39217,0.38724),
-            QVector3D(0.41662,0.39167,0.3848),
-            QVector3D(0.42308,0.39116,0.38235),
-            QVector3D(0.42947,0.39062,0.37991),
-            QVector3D(0.4358,0.39007,0.37746),
-            QVector3D(0.44205,0.38952,0.37501),
-            QVector3D(0.44822,0.38896,0.37255),
-            QVector3D(0.45434,0.38838,0.3701),
-            QVector3D(0.46038,0.38778,0.36765),
-            QVector3D(0.46638,0.38717,0.3652),
-            QVector3D(0.47233,0.38655,0.36274),
-            QVector3D(0.47821,0.38592,0.36028),
-            QVector3D(0.48404,0.38527,0.35784),
-            QVector3D(0.48983,0.38461,0.35538),
-            QVector3D(0.49557,0.38394,0.35291),
-            QVector3D(0.50127,0.38326,0.35045),
-            QVector3D(0.50692,0.38255,0.34798),
-            QVector3D(0.51253,0.38183,0.34551),
-            QVector3D(0.5181,0.38111,0.34305),
-            QVector3D(0.52363,0.38036,0.34058),
-            QVector3D(0.52913,0.3796,0.33809),
-            QVector3D(0.53458,0.37882,0.33563),
-            QVector3D(0.54,0.37803,0.33316),
-            QVector3D(0.54539,0.37723,0.33067),
-            QVector3D(0.55075,0.37641,0.32819),
-            QVector3D(0.55607,0.37556,0.3257),
-            QVector3D(0.56137,0.37471,0.32323),
-            QVector3D(0.56664,0.37384,0.32075),
-            QVector3D(0.57188,0.37295,0.31825),
-            QVector3D(0.57709,0.37204,0.31576),
-            QVector3D(0.58227,0.37112,0.31326),
-            QVector3D(0.58743,0.37018,0.31077),
-            QVector3D(0.59258,0.36924,0.30826),
-            QVector3D(0.59768,0.36827,0.30577),
-            QVector3D(0.60277,0.36727,0.30324),
-            QVector3D(0.60785,0.36627,0.30073),
-            QVector3D(0.61288,0.36524,0.29821),
-            QVector3D(0.61791,0.36419,0.2957),
-            QVector3D(0.62292,0.36313,0.29318),
-            QVector3D(0.6279,0.36205,0.29066),
-            QVector3D(0.63287,0.36094,0.28813),
-            QVector3D(0.63782,0.35983,0.28559),
-            QVector3D(0.64275,0.35868,0.28307),
-            QVector3D(0.64766,0.35754,0.28051),
-            QVector3D(0.65255,0.35635,0.27798),
-            QVector3D(0.65744,0.35515,0.27544),
-            QVector3D(0.6623,0.35391,0.27288),
-            QVector3D(0.66714,0.35267,0.27033),
-            QVector3D(0.67198,0.3514,0.26774),
-            QVector3D(0.6768,0.35012,0.26518),
-            QVector3D(0.6816,0.3488,0.26261),
-            QVector3D(0.68639,0.34747,0.26004),
-            QVector3D(0.69116,0.3461,0.25745),
-            QVector3D(0.69594,0.34472,0.25487),
-            QVector3D(0.70069,0.34332,0.25226),
-            QVector3D(0.70542,0.34189,0.24964),
-            QVector3D(0.71015,0.34043,0.24704),
-            QVector3D(0.71486,0.33896,0.24441),
-            QVector3D(0.71957,0.33745,0.24181),
-            QVector3D(0.72426,0.33591,0.23917),
-            QVector3D(0.72895,0.33436,0.23654),
-            QVector3D(0.73362,0.33277,0.23387),
-            QVector3D(0.73828,0.33113,0.23124),
-            QVector3D(0.74294,0.32951,0.22858),
-            QVector3D(0.74758,0.32782,0.2259),
-            QVector3D(0.75221,0.32611,0.22322),
-            QVector3D(0.75684,0.32438,0.22053),
-            QVector3D(0.76145,0.32263,0.21781),
-            QVector3D(0.76606,0.32083,0.21509),
-            QVector3D(0.77066,0.31899,0.21238),
-            QVector3D(0.77525,0.31713,0.20964),
-            QVector3D(0.77984,0.31523,0.20691),
-            QVector3D(0.78442,0.31331,0.20416),
-            QVector3D(0.78899,0.31134,0.20135),
-            QVector3D(0.79355,0.30935,0.19857),
-            QVector3D(0.7981,0.30729,0.19578),
-            QVector3D(0.80264,0.30522,0.19297),
-            QVector3D(0.80719,0.30309,0.19014),
-            QVector3D(0.81172,0.30093,0.18732),
-            QVector3D(0.81625,0.29874,0.18444),
-            QVector3D(0.82077,0.2965,0.18155),
-            QVector3D(0.82529,0.2942,0.17869),
-            QVector3D(0.8298,0.29189,0.17574),
-            QVector3D(0.83431,0.28951,0.17282),
-            QVector3D(0.8388,0.28707,0.16989),
-            QVector3D(0.84329,0.2846,0.16692),
-            QVector3D(0.84778,0.28209,0.16393),
-            QVector3D(0.85227,0.27951,0.16088),
-            QVector3D(0.85675,0.27688,0.15783),
-            QVector3D(0.86122,0.27419,0.15475),
-            QVector3D(0.86569,0.27144,0.15165),
-            QVector3D(0.87015,0.26865,0.14851),
-            QVector3D(0.87462,0.26578,0.1454),
-            QVector3D(0.87907,0.26285,0.14218),
-            QVector3D(0.88353,0.25985,0.13893),
-            QVector3D(0.88797,0.25678,0.13565),
-            QVector3D(0.89242,0.25364,0.13237),
-            QVector3D(0.89686,0.25041,0.12899),
-            QVector3D(0.9013,0.24713,0.12563),
-            QVector3D(0.90573,0.24374,0.12213),
-            QVector3D(0.91016,0.24028,0.11869),
-            QVector3D(0.91459,0.23676,0.11509),
-            QVector3D(0.91901,0.23308,0.11151),
-            QVector3D(0.92343,0.22934,0.10779),
-            QVector3D(0.92784,0.22549,0.10405),
-            QVector3D(0.93226,0.22153,0.1002),
-            QVector3D(0.93668,0.21745,0.096258),
-            QVector3D(0.94108,0.21323,0.092292),
-            QVector3D(0.94549,0.2089,0.088179),
-            QVector3D(0.94989,0.20443,0.083966),
-            QVector3D(0.95429,0.19976,0.079537),
-            QVector3D(0.95869,0.19499,0.075045),
-            QVector3D(0.96309,0.19001,0.070373),
-            QVector3D(0.96749,0.18486,0.065518),
-            QVector3D(0.97188,0.17948,0.06046),
-            QVector3D(0.97626,0.17389,0.055081),
-            QVector3D(0.98065,0.16803,0.049511),
-            QVector3D(0.98504,0.16195,0.043373),
-            QVector3D(0.98943,0.15551,0.037065),
-            QVector3D(0.99381,0.14872,0.03044),
-            QVector3D(0.99819,0.14159,0.024101),
-            QVector3D(1,0.13398,0.017854),
-            QVector3D(1,0.12585,0.011691),
-            QVector3D(1,0.11706,0.0054342),
-            QVector3D(1,0.10757,0),
-            QVector3D(1,0.097091,0)
-        },
-        {
-            QVector3D(0.077854,0.19343,0.75827),
-            QVector3D(0.095213,0.19629,0.7569),
-            QVector3D(0.11007,0.1991,0.75553),
-            QVector3D(0.12317,0.20194,0.75416),
-            QVector3D(0.13514,0.20481,0.75279),
-            QVector3D(0.14608,0.20765,0.75143),
-            QVector3D(0.15626,0.21049,0.75004),
-            QVector3D(0.16572,0.21333,0.74867),
-            QVector3D(0.17472,0.21621,0.7473),
-            QVector3D(0.18318,0.21905,0.74592),
-            QVector3D(0.19126,0.22188,0.74454),
-            QVector3D(0.19897,0.22472,0.74317),
-            QVector3D(0.20641,0.2276,0.74178),
-            QVector3D(0.21348,0.23044,0.7404),
-            QVector3D(0.22035,0.23329,0.73902),
-            QVector3D(0.22695,0.23617,0.73763),
-            QVector3D(0.23332,0.23902,0.73624),
-            QVector3D(0.23953,0.24188,0.73486),
-            QVector3D(0.24552,0.24472,0.73347),
-            QVector3D(0.25139,0.24761,0.73208),
-            QVector3D(0.25706,0.25045,0.73069),
-            QVector3D(0.26259,0.25333,0.72929),
-            QVector3D(0.26797,0.25618,0.7279),
-            QVector3D(0.27326,0.25907,0.7265),
-            QVector3D(0.2784,0.26192,0.72511),
-            QVector3D(0.28343,0.26478,0.7237),
-            QVector3D(0.28834,0.26764,0.7223),
-            QVector3D(0.29316,0.27055,0.7209),
-            QVector3D(0.29788,0.27341,0.7195),
-            QVector3D(0.3025,0.27629,0.71809),
-            QVector3D(0.30706,0.27916,0.71668),
-            QVector3D(0.31151,0.28204,0.71527),
-            QVector3D(0.3159,0.2849,0.71386),
-            QVector3D(0.3202,0.28778,0.71244),
-            QVector3D(0.32441,0.29066,0.71103),
-            QVector3D(0.32858,0.29354,0.70962),
-            QVector3D(0.33268,0.29643,0.7082),
-            QVector3D(0.33669,0.29932,0.70678),
-            QVector3D(0.34065,0.30219,0.70535),
-            QVector3D(0.34455,0.30509,0.70393),
-            QVector3D(0.34839,0.30797,0.7025),
-            QVector3D(0.35217,0.31088,0.70108),
-            QVector3D(0.35592,0.31377,0.69964),
-            QVector3D(0.35959,0.31666,0.69821),
-            QVector3D(0.36322,0.31955,0.69678),
-            QVector3D(0.36681,0.32245,0.69535),
-            QVector3D(0.37033,0.32533,0.6939),
-            QVector3D(0.37383,0.32824,0.69247),
-            QVector3D(0.37727,0.33113,0.69102),
-            QVector3D(0.38067,0.33405,0.68958),
-            QVector3D(0.38403,0.33695,0.68814),
-            QVector3D(0.38734,0.33986,0.68669),
-            QVector3D(0.39062,0.34277,0.68524),
-            QVector3D(0.39386,0.34566,0.68378),
-            QVector3D(0.39705,0.34858,0.68232),
-            QVector3D(0.40023,0.35149,0.68086),
-            QVector3D(0.40336,0.35441,0.67941),
-            QVector3D(0.40645,0.35733,0.67795),
-            QVector3D(0.40951,0.36023,0.67649),
-            QVector3D(0.41254,0.36315,0.67502),
-            QVector3D(0.41553,0.36607,0.67355),
-            QVector3D(0.41848,0.36899,0.67208),
-            QVector3D(0.42141,0.3719,0.67061),
-            QVector3D(0.42432,0.37484,0.66913),
-            QVector3D(0.4272,0.37776,0.66765),
-            QVector3D(0.43004,0.38069,0.66616),
-            QVector3D(0.43285,0.38362,0.66468),
-            QVector3D(0.43564,0.38654,0.6632),
-            QVector3D(0.4384,0.38948,0.66171),
-            QVector3D(0.44113,0.39241,0.66021),
-            QVector3D(0.44384,0.39535,0.65871),
-            QVector3D(0.44652,0.39829,0.65722),
-            QVector3D(0.44918,0.40123,0.65572),
-            QVector3D(0.45181,0.40416,0.65421),
-            QVector3D(0.45442,0.4071,0.6527),
-            QVector3D(0.45699,0.41005,0.6512),
-            QVector3D(0.45955,0.413,0.64969),
-            QVector3D(0.46209,0.41594,0.64817),
-            QVector3D(0.46461,0.41888,0.64665),
-            QVector3D(0.4671,0.42183,0.64513),
-            QVector3D(0.46957,0.42479,0.6436),
-            QVector3D(0.47202,0.42775,0.64208),
-            QVector3D(0.47444,0.4307,0.64055),
-            QVector3D(0.47685,0.43364,0.63902),
-            QVector3D(0.47923,0.43661,0.63748),
-            QVector3D(0.4816,0.43957,0.63594),
-            QVector3D(0.48394,0.44254,0.6344),
-            QVector3D(0.48627,0.44549,0.63285),
-            QVector3D(0.48858,0.44846,0.6313),
-            QVector3D(0.49088,0.45143,0.62974),
-            QVector3D(0.49313,0.4544,0.62819),
-            QVector3D(0.49539,0.45736,0.62663),
-            QVector3D(0.49763,0.46033,0.62506),
-            QVector3D(0.49983,0.4633,0.6235),
-            QVector3D(0.50204,0.46628,0.62192),
-            QVector3D(0.50422,0.46927,0.62036),
-            QVector3D(0.50637,0.47224,0.61878),
-            QVector3D(0.50853,0.47522,0.61719),
-            QVector3D(0.51065,0.47819,0.6156),
-            QVector3D(0.51277,0.48117,0.61401),
-            QVector3D(0.51487,0.48416,0.61242),
-            QVector3D(0.51695,0.48715,0.61083),
-            QVector3D(0.51901,0.49014,0.60923),
-            QVector3D(0.52106,0.49312,0.60762),
-            QVector3D(0.52309,0.49611,0.606),
-            QVector3D(0.52511,0.49911,0.6044),
-            QVector3D(0.52712,0.50211,0.60277),
-            QVector3D(0.52911,0.5051,0.60115),
-            QVector3D(0.53107,0.50811,0.59953),
-            QVector3D(0.53303,0.5111,0.59789),
-            QVector3D(0.53497,0.51411,0.59626),
-            QVector3D(0.53691,0.51711,0.59462),
-            QVector3D(0.53882,0.5201,0.59298),
-            QVector3D(0.54072,0.52312,0.59133),
-            QVector3D(0.54261,0.52613,0.58967),
-            QVector3D(0.54448,0.52914,0.58801),
-            QVector3D(0.54635,0.53215,0.58635),
-            QVector3D(0.54819,0.53516,0.58469),
-            QVector3D(0.55002,0.53818,0.58301),
-            QVector3D(0.55184,0.54119,0.58133),
-            QVector3D(0.55364,0.54421,0.57966),
-            QVector3D(0.55543,0.54723,0.57796),
-            QVector3D(0.55722,0.55025,0.57628),
-            QVector3D(0.55898,0.55327,0.57457),
-            QVector3D(0.56074,0.55629,0.57288),
-            QVector3D(0.56249,0.55933,0.57116),
-            QVector3D(0.56422,0.56236,0.56945),
-            QVector3D(0.56593,0.56538,0.56773),
-            QVector3D(0.56883,0.56809,0.5657),
-            QVector3D(0.57292,0.57047,0.56336),
-            QVector3D(0.57698,0.57287,0.56099),
-            QVector3D(0.58101,0.57525,0.55863),
-            QVector3D(0.58503,0.57764,0.55626),
-            QVector3D(0.58901,0.58005,0.55389),
-            QVector3D(0.59299,0.58244,0.55151),
-            QVector3D(0.59693,0.58486,0.54913),
-            QVector3D(0.60085,0.58726,0.54673),
-            QVector3D(0.60476,0.58967,0.54433),
-            QVector3D(0.60865,0.5921,0.54191),
-            QVector3D(0.6125,0.59451,0.5395),
-            QVector3D(0.61635,0.59694,0.53708),
-            QVector3D(0.62018,0.59936,0.53465),
-            QVector3D(0.62399,0.60179,0.53221),
-            QVector3D(0.62777,0.60423,0.52976),
-            QVector3D(0.63154,0.60666,0.52731),
-            QVector3D(0.6353,0.6091,0.52484),
-            QVector3D(0.63904,0.61154,0.52237),
-            QVector3D(0.64276,0.61398,0.51989),
-            QVector3D(0.64646,0.61644,0.51741),
-            QVector3D(0.65015,0.61889,0.51491),
-            QVector3D(0.65382,0.62134,0.5124),
-            QVector3D(0.65749,0.62381,0.50989),
-            QVector3D(0.66112,0.62626,0.50736),
-            QVector3D(0.66475,0.62873,0.50483),
-            QVector3D(0.66837,0.6312,0.50229),
-            QVector3D(0.67197,0.63367,0.49973),
-            QVector3D(0.67556,0.63615,0.49717),
-            QVector3D(0.67913,0.63862,0.4946),
-            QVector3D(0.68269,0.6411,0.49202),
-            QVector3D(0.68624,0.64358,0.48942),
-            QVector3D(0.68978,0.64607,0.48682),
-            QVector3D(0.6933,0.64856,0.4842),
-            QVector3D(0.69681,0.65106,0.48158),
-            QVector3D(0.70031,0.65355,0.47894),
-            QVector3D(0.7038,0.65605,0.47629),
-            QVector3D(0.70727,0.65855,0.47362),
-            QVector3D(0.71074,0.66105,0.47096),
-            QVector3D(0.71419,0.66357,0.46826),
-            QVector3D(0.71764,0.66607,0.46556),
-            QVector3D(0.72106,0.66859,0.46285),
-            QVector3D(0.72449,0.6711,0.46013),
-            QVector3D(0.7279,0.67362,0.45739),
-            QVector3D(0.7313,0.67614,0.45465),
-            QVector3D(0.73469,0.67866,0.45188),
-            QVector3D(0.73807,0.68119,0.4491),
-            QVector3D(0.74144,0.68372,0.4463),
-            QVector3D(0.74481,0.68625,0.44349),
-            QVector3D(0.74816,0.68879,0.44066),
-            QVector3D(0.75151,0.69132,0.43783),
-            QVector3D(0.75485,0.69386,0.43497),
-            QVector3D(0.75817,0.69641,0.4321),
-            QVector3D(0.76149,0.69895,0.42919),
-            QVector3D(0.7648,0.7015,0.42628),
-            QVector3D(0.7681,0.70405,0.42335),
-            QVector3D(0.7714,0.70661,0.42041),
-            QVector3D(0.77468,0.70917,0.41745),
-            QVector3D(0.77796,0.71173,0.41446),
-            QVector3D(0.78123,0.71428,0.41146),
-            QVector3D(0.7845,0.71685,0.40844),
-            QVector3D(0.78775,0.71942,0.4054),
-            QVector3D(0.79099,0.72198,0.40232),
-            QVector3D(0.79424,0.72456,0.39924),
-            QVector3D(0.79747,0.72713,0.39614),
-            QVector3D(0.8007,0.72971,0.393),
-            QVector3D(0.80392,0.73229,0.38984),
-            QVector3D(0.80713,0.73487,0.38666),
-            QVector3D(0.81033,0.73745,0.38347),
-            QVector3D(0.81354,0.74005,0.38023),
-            QVector3D(0.81673,0.74263,0.37698),
-            QVector3D(0.81992,0.74522,0.37369),
-            QVector3D(0.8231,0.74782,0.37037),
-            QVector3D(0.82628,0.75041,0.36704),
-            QVector3D(0.82945,0.75301,0.36366),
-            QVector3D(0.83261,0.75561,0.36026),
-            QVector3D(0.83577,0.75822,0.35684),
-            QVector3D(0.83892,0.76082,0.35336),
-            QVector3D(0.84207,0.76343,0.34987),
-            QVector3D(0.84521,0.76604,0.34632),
-            QVector3D(0.84834,0.76865,0.34277),
-            QVector3D(0.85147,0.77127,0.33916),
-            QVector3D(0.8546,0.77388,0.33551),
-            QVector3D(0.85772,0.77651,0.33181),
-            QVector3D(0.86083,0.77913,0.32808),
-            QVector3D(0.86395,0.78175,0.3243),
-            QVector3D(0.86705,0.78438,0.3205),
-            QVector3D(0.87015,0.78701,0.31662),
-            QVector3D(0.87324,0.78964,0.31269),
-            QVector3D(0.87633,0.79227,0.30875),
-            QVector3D(0.87942,0.79491,0.30472),
-            QVector3D(0.8825,0.79754,0.30064),
-            QVector3D(0.88558,0.80019,0.29651),
-            QVector3D(0.88866,0.80283,0.29232),
-            QVector3D(0.89172,0.80547,0.28806),
-            QVector3D(0.89479,0.80812,0.28374),
-            QVector3D(0.89785,0.81077,0.27936),
-            QVector3D(0.9009,0.81342,0.27488),
-            QVector3D(0.90395,0.81607,0.27036),
-            QVector3D(0.907,0.81872,0.26572),
-            QVector3D(0.91005,0.82138,0.26101),
-            QVector3D(0.91309,0.82404,0.2562),
-            QVector3D(0.91612,0.82671,0.25133),
-            QVector3D(0.91915,0.82937,0.24631),
-            QVector3D(0.92219,0.83204,0.24121),
-            QVector3D(0.92521,0.8347,0.236),
-            QVector3D(0.92823,0.83737,0.23064),
-            QVector3D(0.93125,0.84005,0.22515),
-            QVector3D(0.93426,0.84272,0.21954),
-            QVector3D(0.93728,0.84539,0.21376),
-            QVector3D(0.94029,0.84807,0.20781),
-            QVector3D(0.94329,0.85075,0.20166),
-            QVector3D(0.94629,0.85343,0.19535),
-            QVector3D(0.94929,0.85612,0.18881),
-            QVector3D(0.95229,0.8588,0.18199),
-            QVector3D(0.95528,0.86149,0.17496),
-            QVector3D(0.95827,0.86419,0.16758),
-            QVector3D(0.96125,0.86687,0.15984),
-            QVector3D(0.96424,0.86957,0.15175),
-            QVector3D(0.96722,0.87227,0.1432),
-            QVector3D(0.9702,0.87497,0.13412),
-            QVector3D(0.97317,0.87767,0.12434),
-            QVector3D(0.97614,0.88037,0.11385),
-            QVector3D(0.97911,0.88307,0.10233),
-            QVector3D(0.98208,0.88578,0.089538),
-            QVector3D(0.98505,0.88849,0.07491),
-            QVector3D(0.98801,0.8912,0.057534),
-            QVector3D(0.99097,0.89391,0.035647)
-        },
-        {
-            QVector3D(0.032081,0.36182,0.97348),
-            QVector3D(0.05836,0.37092,0.95845),
-            QVector3D(0.075961,0.37984,0.94345),
-            QVector3D(0.088784,0.38858,0.92847),
-            QVector3D(0.098335,0.39714,0.91352),
-            QVector3D(0.10538,0.40555,0.89858),
-            QVector3D(0.1105,0.4138,0.88367),
-            QVector3D(0.1138,0.42191,0.86877),
-            QVector3D(0.11557,0.4299,0.85388),
-            QVector3D(0.11592,0.43777,0.83902),
-            QVector3D(0.11487,0.44549,0.82416),
-            QVector3D(0.11266,0.45311,0.80932),
-            QVector3D(0.10918,0.46059,0.79447),
-            QVector3D(0.10455,0.46796,0.77961),
-            QVector3D(0.099069,0.47521,0.76474),
-            QVector3D(0.092835,0.4823,0.74982),
-            QVector3D(0.08633,0.48923,0.73486),
-            QVector3D(0.080053,0.496,0.71982),
-            QVector3D(0.074782,0.50259,0.70469),
-            QVector3D(0.071457,0.50899,0.68944),
-            QVector3D(0.07085,0.51517,0.67403),
-            QVector3D(0.073695,0.52113,0.65846),
-            QVector3D(0.079835,0.52688,0.64271),
-            QVector3D(0.089012,0.5324,0.62676),
-            QVector3D(0.10026,0.53772,0.61062),
-            QVector3D(0.11288,0.54284,0.59428),
-            QVector3D(0.126,0.54779,0.57774),
-            QVector3D(0.1391,0.55261,0.56104),
-            QVector3D(0.15183,0.55732,0.54417),
-            QVector3D(0.16388,0.56193,0.52714),
-            QVector3D(0.17497,0.56648,0.50997),
-            QVector3D(0.18508,0.57098,0.49266),
-            QVector3D(0.19412,0.57547,0.47524),
-            QVector3D(0.20204,0.57994,0.45766),
-            QVector3D(0.20895,0.58441,0.43995),
-            QVector3D(0.21483,0.58888,0.4221),
-            QVector3D(0.21979,0.59337,0.40411),
-            QVector3D(0.22384,0.59785,0.38597),
-            QVector3D(0.22711,0.60234,0.36769),
-            QVector3D(0.22964,0.60683,0.3493),
-            QVector3D(0.23163,0.6113,0.33081),
-            QVector3D(0.23311,0.61574,0.3123),
-            QVector3D(0.23437,0.62014,0.29385),
-            QVector3D(0.23553,0.62448,0.27559),
-            QVector3D(0.23686,0.62873,0.25761),
-            QVector3D(0.23856,0.63287,0.24012),
-            QVector3D(0.24094,0.63689,0.22333),
-            QVector3D(0.24418,0.64076,0.2074),
-            QVector3D(0.2485,0.64447,0.19256),
-            QVector3D(0.25393,0.64801,0.17902),
-            QVector3D(0.26052,0.65139,0.16694),
-            QVector3D(0.26821,0.65459,0.15642),
-            QVector3D(0.2769,0.65765,0.14749),
-            QVector3D(0.28638,0.66054,0.14012),
-            QVector3D(0.29654,0.66333,0.13429),
-            QVector3D(0.30712,0.666,0.12971),
-            QVector3D(0.318,0.6686,0.12623),
-            QVector3D(0.32904,0.67112,0.12356),
-            QVector3D(0.34011,0.6736,0.12159),
-            QVector3D(0.35116,0.67603,0.1201),
-            QVector3D(0.36212,0.67844,0.11895),
-            QVector3D(0.37296,0.68081,0.11798),
-            QVector3D(0.38369,0.68318,0.11711),
-            QVector3D(0.39426,0.68554,0.11638),
-            QVector3D(0.40469,0.68788,0.11563),
-            QVector3D(0.415,0.69021,0.11486),
-            QVector3D(0.42518,0.69254,0.11414),
-            QVector3D(0.43523,0.69484,0.11344),
-            QVector3D(0.44516,0.69715,0.11268),
-            QVector3D(0.455,0.69945,0.1119),
-            QVector3D(0.46473,0.70173,0.11112),
-            QVector3D(0.47437,0.70402,0.11034),
-            QVector3D(0.48392,0.7063,0.10954),
-            QVector3D(0.4934,0.70856,0.10866),
-            QVector3D(0.50281,0.71081,0.10783),
-            QVector3D(0.51215,0.71306,0.10703),
-            QVector3D(0.52142,0.7153,0.10617),
-            QVector3D(0.53064,0.71754,0.10523),
-            QVector3D(0.53978,0.71976,0.10434),
-            QVector3D(0.5489,0.72197,0.10349),
-            QVector3D(0.55794,0.72417,0.10255),
-            QVector3D(0.56694,0.72637,0.1016),
-            QVector3D(0.5759,0.72856,0.10065),
-            QVector3D(0.58481,0.73074,0.099684),
-            QVector3D(0.59368,0.73292,0.098715),
-            QVector3D(0.60252,0.73509,0.097735),
-            QVector3D(0.61132,0.73724,0.096645),
-            QVector3D(0.62009,0.73939,0.095664),
-            QVector3D(0.62882,0.74152,0.094646),
-            QVector3D(0.63752,0.74366,0.09351),
-            QVector3D(0.64619,0.74578,0.092435),
-            QVector3D(0.65483,0.7479,0.091367),
-            QVector3D(0.66346,0.75,0.090209),
-            QVector3D(0.67205,0.7521,0.089055),
-            QVector3D(0.68061,0.75419,0.087892),
-            QVector3D(0.68917,0.75627,0.086685),
-            QVector3D(0.69769,0.75835,0.085411),
-            QVector3D(0.7062,0.76041,0.084247),
-            QVector3D(0.71468,0.76246,0.082921),
-            QVector3D(0.72315,0.76451,0.081681),
-            QVector3D(0.73161,0.76655,0.0803),
-            QVector3D(0.74005,0.76858,0.078922),
-            QVector3D(0.74847,0.77061,0.077534),
-            QVector3D(0.75687,0.77262,0.076136),
-            QVector3D(0.76527,0.77462,0.074724),
-            QVector3D(0.77364,0.77663,0.07331),
-            QVector3D(0.78201,0.77861,0.071765),
-            QVector3D(0.79036,0.78059,0.070194),
-            QVector3D(0.7987,0.78257,0.068669),
-            QVector3D(0.80704,0.78453,0.067),
-            QVector3D(0.81535,0.78649,0.065324),
-            QVector3D(0.82366,0.78843,0.063634),
-            QVector3D(0.83198,0.79037,0.061832),
-            QVector3D(0.84029,0.7923,0.060168),
-            QVector3D(0.84859,0.7942,0.058382),
-            QVector3D(0.85689,0.79607,0.056834),
-            QVector3D(0.8652,0.79789,0.055378),
-            QVector3D(0.87351,0.79966,0.054292),
-            QVector3D(0.88182,0.80132,0.053775),
-            QVector3D(0.89012,0.80285,0.054093),
-            QVector3D(0.8984,0.8042,0.055566),
-            QVector3D(0.90662,0.8053,0.058415),
-            QVector3D(0.91475,0.80608,0.063031),
-            QVector3D(0.92272,0.80648,0.069366),
-            QVector3D(0.93047,0.80641,0.077301),
-            QVector3D(0.9379,0.80582,0.08703),
-            QVector3D(0.94493,0.80465,0.097983),
-            QVector3D(0.95147,0.80288,0.10998),
-            QVector3D(0.95744,0.80051,0.12259),
-            QVector3D(0.9628,0.79755,0.1357),
-            QVector3D(0.9675,0.79406,0.14898),
-            QVector3D(0.97155,0.79007,0.16223),
-            QVector3D(0.97499,0.78567,0.17523),
-            QVector3D(0.97786,0.78094,0.18795),
-            QVector3D(0.98025,0.77593,0.20021),
-            QVector3D(0.98222,0.77073,0.21212),
-            QVector3D(0.98385,0.76537,0.22355),
-            QVector3D(0.98522,0.75991,0.23457),
-            QVector3D(0.98638,0.75438,0.24514),
-            QVector3D(0.9874,0.74879,0.25538),
-            QVector3D(0.98831,0.74317,0.26524),
-            QVector3D(0.98914,0.73751,0.27479),
-            QVector3D(0.98991,0.73185,0.28406),
-            QVector3D(0.99062,0.72616,0.29307),
-            QVector3D(0.9913,0.72045,0.30183),
-            QVector3D(0.99194,0.71474,0.3104),
-            QVector3D(0.99255,0.70902,0.31874),
-            QVector3D(0.99314,0.70327,0.32691),
-            QVector3D(0.99369,0.6975,0.33494),
-            QVector3D(0.99421,0.69172,0.34279),
-            QVector3D(0.9947,0.68593,0.35051),
-            QVector3D(0.99516,0.68011,0.35809),
-            QVector3D(0.9956,0.67428,0.36554),
-            QVector3D(0.996,0.66843,0.37289),
-            QVector3D(0.99638,0.66256,0.38013),
-            QVector3D(0.99672,0.65667,0.38727),
-            QVector3D(0.99704,0.65075,0.39432),
-            QVector3D(0.99732,0.64482,0.40128),
-            QVector3D(0.99758,0.63886,0.40815),
-            QVector3D(0.99781,0.63289,0.41495),
-            QVector3D(0.99801,0.62688,0.42166),
-            QVector3D(0.99818,0.62086,0.42832),
-            QVector3D(0.99832,0.6148,0.43492),
-            QVector3D(0.99843,0.60874,0.44143),
-            QVector3D(0.99851,0.60262,0.44789),
-            QVector3D(0.99857,0.59649,0.45431),
-            QVector3D(0.99859,0.59033,0.46065),
-            QVector3D(0.99858,0.58414,0.46696),
-            QVector3D(0.99855,0.57791,0.4732),
-            QVector3D(0.99848,0.57166,0.47942),
-            QVector3D(0.99839,0.56537,0.48557),
-            QVector3D(0.99827,0.55905,0.4917),
-            QVector3D(0.99812,0.5527,0.49778),
-            QVector3D(0.99793,0.54631,0.50381),
-            QVector3D(0.99772,0.53987,0.50981),
-            QVector3D(0.99748,0.53339,0.51577),
-            QVector3D(0.99721,0.52689,0.52171),
-            QVector3D(0.99692,0.52032,0.52761),
-            QVector3D(0.99659,0.51372,0.53348),
-            QVector3D(0.99623,0.50706,0.53932),
-            QVector3D(0.99585,0.50036,0.54514),
-            QVector3D(0.99543,0.4936,0.55092),
-            QVector3D(0.99499,0.4868,0.55668),
-            QVector3D(0.99451,0.47994,0.56242),
-            QVector3D(0.99401,0.473,0.56813),
-            QVector3D(0.99348,0.46601,0.57381),
-            QVector3D(0.99292,0.45897,0.57948),
-            QVector3D(0.99232,0.45185,0.58513),
-            QVector3D(0.9917,0.44466,0.59074),
-            QVector3D(0.99105,0.43739,0.59635),
-            QVector3D(0.99036,0.43003,0.60193),
-            QVector3D(0.98965,0.42258,0.60751),
-            QVector3D(0.98891,0.41506,0.61304),
-            QVector3D(0.98813,0.40745,0.61855),
-            QVector3D(0.98733,0.39973,0.62399),
-            QVector3D(0.98649,0.39194,0.62934),
-            QVector3D(0.98562,0.38405,0.63457),
-            QVector3D(0.98472,0.37608,0.63961),
-            QVector3D(0.98378,0.36804,0.64438),
-            QVector3D(0.98281,0.35995,0.64878),
-            QVector3D(0.98181,0.35183,0.65266),
-            QVector3D(0.98078,0.34373,0.65588),
-            QVector3D(0.97973,0.3357,0.65825),
-            QVector3D(0.97864,0.32775,0.65959),
-            QVector3D(0.97754,0.31999,0.65974),
-            QVector3D(0.97642,0.3124,0.65853),
-            QVector3D(0.97528,0.30511,0.65589),
-            QVector3D(0.97411,0.29808,0.65173),
-            QVector3D(0.97292,0.2914,0.64606),
-            QVector3D(0.97169,0.285,0.63895),
-            QVector3D(0.97041,0.27897,0.63052),
-            QVector3D(0.96907,0.2732,0.62092),
-            QVector3D(0.96766,0.26768,0.61031),
-            QVector3D(0.96618,0.26243,0.5989),
-            QVector3D(0.96461,0.25735,0.58686),
-            QVector3D(0.96297,0.2524,0.57435),
-            QVector3D(0.96124,0.24756,0.56152),
-            QVector3D(0.95942,0.24278,0.54846),
-            QVector3D(0.95753,0.23806,0.53526),
-            QVector3D(0.95556,0.23335,0.52198),
-            QVector3D(0.95351,0.22869,0.50869),
-            QVector3D(0.95138,0.22398,0.49537),
-            QVector3D(0.94918,0.2193,0.48207),
-            QVector3D(0.94691,0.21459,0.4688),
-            QVector3D(0.94457,0.20987,0.45555),
-            QVector3D(0.94216,0.20512,0.44234),
-            QVector3D(0.93968,0.20033,0.42915),
-            QVector3D(0.93714,0.19555,0.416),
-            QVector3D(0.93453,0.19073,0.40287),
-            QVector3D(0.93185,0.1859,0.38976),
-            QVector3D(0.92911,0.18098,0.3767),
-            QVector3D(0.92631,0.17605,0.36362),
-            QVector3D(0.92345,0.17111,0.35059),
-            QVector3D(0.92052,0.16609,0.33755),
-            QVector3D(0.91755,0.16106,0.32451),
-            QVector3D(0.9145,0.15595,0.31148),
-            QVector3D(0.9114,0.15076,0.29845),
-            QVector3D(0.90825,0.14556,0.2854),
-            QVector3D(0.90503,0.1402,0.27233),
-            QVector3D(0.90176,0.13484,0.25926),
-            QVector3D(0.89844,0.12932,0.24609),
-            QVector3D(0.89507,0.12371,0.23288),
-            QVector3D(0.89164,0.11805,0.21961),
-            QVector3D(0.88816,0.11221,0.20623),
-            QVector3D(0.88463,0.10623,0.19268),
-            QVector3D(0.88106,0.10002,0.17898),
-            QVector3D(0.87743,0.093639,0.16503),
-            QVector3D(0.87376,0.087085,0.15083),
-            QVector3D(0.87004,0.08013,0.13619),
-            QVector3D(0.86629,0.072935,0.12107),
-            QVector3D(0.86249,0.065249,0.10524),
-            QVector3D(0.85864,0.057063,0.088412),
-            QVector3D(0.85476,0.048151,0.069991),
-            QVector3D(0.85083,0.038404,0.048987),
-            QVector3D(0.84687,0.028128,0.024389),
-            QVector3D(0.84287,0.018301,0.0015175)
-        },
-        {
-            QVector3D(0.097481,0.50736,0.98205),
-            QVector3D(0.1033,0.50389,0.97428),
-            QVector3D(0.10863,0.50041,0.96653),
-            QVector3D(0.11369,0.49694,0.9588),
-            QVector3D(0.11841,0.49348,0.95107),
-            QVector3D(0.12275,0.49002,0.94336),
-            QVector3D(0.12692,0.48657,0.93566),
-            QVector3D(0.13089,0.48312,0.92796),
-            QVector3D(0.1346,0.47968,0.92028),
-            QVector3D(0.13811,0.47624,0.91262),
-            QVector3D(0.14143,0.4728,0.90497),
-            QVector3D(0.14458,0.46938,0.89732),
-            QVector3D(0.14758,0.46594,0.88969),
-            QVector3D(0.15043,0.46252,0.88207),
-            QVector3D(0.15312,0.45912,0.87446),
-            QVector3D(0.15574,0.4557,0.86687),
-            QVector3D(0.1582,0.4523,0.85929),
-            QVector3D(0.16051,0.4489,0.85172),
-            QVector3D(0.16277,0.44549,0.84416),
-            QVector3D(0.16488,0.44211,0.83662),
-            QVector3D(0.16693,0.43871,0.82909),
-            QVector3D(0.16886,0.43534,0.82157),
-            QVector3D(0.17068,0.43197,0.81406),
-            QVector3D(0.17242,0.42859,0.80657),
-            QVector3D(0.17409,0.42522,0.79909),
-            QVector3D(0.17566,0.42185,0.79162),
-            QVector3D(0.17718,0.41849,0.78417),
-            QVector3D(0.17862,0.41515,0.77672),
-            QVector3D(0.17995,0.4118,0.76929),
-            QVector3D(0.18122,0.40846,0.76187),
-            QVector3D(0.18243,0.40512,0.75448),
-            QVector3D(0.18359,0.40179,0.74709),
-            QVector3D(0.18468,0.39847,0.73972),
-            QVector3D(0.18572,0.39515,0.73235),
-            QVector3D(0.18665,0.39183,0.725),
-            QVector3D(0.18758,0.38852,0.71767),
-            QVector3D(0.18841,0.38521,0.71034),
-            QVector3D(0.18918,0.38191,0.70304),
-            QVector3D(0.1899,0.37862,0.69574),
-            QVector3D(0.19058,0.37533,0.68847),
-            QVector3D(0.1912,0.37204,0.68119),
-            QVector3D(0.19177,0.36878,0.67395),
-            QVector3D(0.1923,0.3655,0.6667),
-            QVector3D(0.19277,0.36224,0.65948),
-            QVector3D(0.1932,0.35896,0.65228),
-            QVector3D(0.19358,0.35572,0.64508),
-            QVector3D(0.19393,0.35246,0.6379),
-            QVector3D(0.19422,0.34922,0.63074),
-            QVector3D(0.19446,0.34597,0.62359),
-            QVector3D(0.19466,0.34276,0.61645),
-            QVector3D(0.19481,0.33953,0.60933),
-            QVector3D(0.19492,0.33629,0.60222),
-            QVector3D(0.19499,0.33309,0.59513),
-            QVector3D(0.19502,0.32988,0.58805),
-            QVector3D(0.19502,0.32665,0.58099),
-            QVector3D(0.19497,0.32346,0.57394),
-            QVector3D(0.19489,0.32028,0.56692),
-            QVector3D(0.19477,0.31708,0.55991),
-            QVector3D(0.19462,0.31391,0.5529),
-            QVector3D(0.19442,0.31074,0.54593),
-            QVector3D(0.19419,0.30755,0.53895),
-            QVector3D(0.19391,0.30439,0.532),
-            QVector3D(0.1936,0.30123,0.52507),
-            QVector3D(0.19325,0.29808,0.51815),
-            QVector3D(0.19288,0.29493,0.51124),
-            QVector3D(0.19247,0.29181,0.50436),
-            QVector3D(0.19202,0.28867,0.49749),
-            QVector3D(0.19154,0.28553,0.49064),
-            QVector3D(0.19103,0.28244,0.48379),
-            QVector3D(0.19049,0.27932,0.47697),
-            QVector3D(0.18992,0.27622,0.47017),
-            QVector3D(0.18932,0.27311,0.46338),
-            QVector3D(0.18869,0.27002,0.45661),
-            QVector3D(0.18804,0.26691,0.44986),
-            QVector3D(0.18733,0.26385,0.44313),
-            QVector3D(0.18658,0.26076,0.43641),
-            QVector3D(0.18585,0.25769,0.42971),
-            QVector3D(0.18505,0.25465,0.42302),
-            QVector3D(0.18421,0.25159,0.41637),
-            QVector3D(0.18335,0.24855,0.40972),
-            QVector3D(0.18247,0.24548,0.40309),
-            QVector3D(0.18156,0.24245,0.39648),
-            QVector3D(0.18062,0.23944,0.38989),
-            QVector3D(0.17967,0.23642,0.38333),
-            QVector3D(0.17869,0.23338,0.37678),
-            QVector3D(0.17768,0.23038,0.37023),
-            QVector3D(0.17659,0.2274,0.36372),
-            QVector3D(0.17551,0.22438,0.35724),
-            QVector3D(0.17442,0.22142,0.35076),
-            QVector3D(0.17327,0.21845,0.34429),
-            QVector3D(0.17211,0.21547,0.33785),
-            QVector3D(0.17093,0.21251,0.33143),
-            QVector3D(0.16973,0.20955,0.32503),
-            QVector3D(0.16847,0.20663,0.31867),
-            QVector3D(0.16721,0.20368,0.3123),
-            QVector3D(0.16588,0.20071,0.30599),
-            QVector3D(0.16458,0.1978,0.29967),
-            QVector3D(0.16324,0.1949,0.29336),
-            QVector3D(0.16187,0.19198,0.28708),
-            QVector3D(0.16042,0.18908,0.28083),
-            QVector3D(0.15902,0.1862,0.27461),
-            QVector3D(0.15755,0.18329,0.26841),
-            QVector3D(0.1561,0.18041,0.26222),
-            QVector3D(0.15456,0.17758,0.25605),
-            QVector3D(0.15302,0.17471,0.2499),
-            QVector3D(0.15147,0.17184,0.24379),
-            QVector3D(0.14991,0.16902,0.23772),
-            QVector3D(0.14827,0.16616,0.23164),
-            QVector3D(0.14665,0.16336,0.22559),
-            QVector3D(0.14505,0.16051,0.21957),
-            QVector3D(0.14339,0.15773,0.21357),
-            QVector3D(0.14175,0.15496,0.20763),
-            QVector3D(0.14009,0.1522,0.20171),
-            QVector3D(0.13851,0.14952,0.19588),
-            QVector3D(0.13692,0.1468,0.19008),
-            QVector3D(0.13541,0.14419,0.18437),
-            QVector3D(0.134,0.14163,0.17876),
-            QVector3D(0.13268,0.1391,0.17324),
-            QVector3D(0.1315,0.1367,0.16787),
-            QVector3D(0.13053,0.13444,0.16268),
-            QVector3D(0.12973,0.13226,0.15764),
-            QVector3D(0.12916,0.13028,0.15284),
-            QVector3D(0.12891,0.12842,0.1483),
-            QVector3D(0.12899,0.12676,0.14407),
-            QVector3D(0.12945,0.12536,0.14011),
-            QVector3D(0.13031,0.12415,0.13652),
-            QVector3D(0.13151,0.12321,0.13332),
-            QVector3D(0.13315,0.12253,0.13051),
-            QVector3D(0.13523,0.12211,0.12804),
-            QVector3D(0.13775,0.12196,0.126),
-            QVector3D(0.14065,0.12206,0.12429),
-            QVector3D(0.14394,0.12241,0.12299),
-            QVector3D(0.14762,0.12299,0.12205),
-            QVector3D(0.15161,0.12379,0.12145),
-            QVector3D(0.15595,0.12478,0.12115),
-            QVector3D(0.1605,0.12596,0.12111),
-            QVector3D(0.16531,0.1272,0.12131),
-            QVector3D(0.17036,0.12863,0.12171),
-            QVector3D(0.17553,0.13018,0.12228),
-            QVector3D(0.18085,0.13174,0.12299),
-            QVector3D(0.1863,0.13339,0.12382),
-            QVector3D(0.1918,0.1351,0.12474),
-            QVector3D(0.19738,0.13681,0.12575),
-            QVector3D(0.20301,0.13858,0.12675),
-            QVector3D(0.20867,0.14035,0.12784),
-            QVector3D(0.21437,0.14214,0.12891),
-            QVector3D(0.2201,0.14394,0.13008),
-            QVector3D(0.22584,0.14575,0.13119),
-            QVector3D(0.23158,0.14753,0.13232),
-            QVector3D(0.23735,0.14933,0.13347),
-            QVector3D(0.24308,0.15109,0.13464),
-            QVector3D(0.24887,0.15287,0.13574),
-            QVector3D(0.25465,0.15465,0.13692),
-            QVector3D(0.26041,0.15645,0.1381),
-            QVector3D(0.26621,0.15821,0.1392),
-            QVector3D(0.27198,0.15993,0.14038),
-            QVector3D(0.27781,0.16174,0.14154),
-            QVector3D(0.28361,0.16349,0.14269),
-            QVector3D(0.28944,0.16518,0.14384),
-            QVector3D(0.29526,0.16697,0.14501),
-            QVector3D(0.30109,0.16869,0.14614),
-            QVector3D(0.30695,0.17041,0.1473),
-            QVector3D(0.3128,0.17212,0.14842),
-            QVector3D(0.31867,0.17385,0.14962),
-            QVector3D(0.32454,0.17555,0.15074),
-            QVector3D(0.33043,0.17728,0.15189),
-            QVector3D(0.33632,0.17898,0.15304),
-            QVector3D(0.34224,0.18066,0.1542),
-            QVector3D(0.34815,0.18235,0.15536),
-            QVector3D(0.35407,0.18405,0.15654),
-            QVector3D(0.36001,0.18576,0.15766),
-            QVector3D(0.36596,0.18743,0.15884),
-            QVector3D(0.3719,0.18909,0.15995),
-            QVector3D(0.37787,0.19075,0.16115),
-            QVector3D(0.38385,0.19241,0.16231),
-            QVector3D(0.38983,0.1941,0.16346),
-            QVector3D(0.39584,0.19573,0.1646),
-            QVector3D(0.40184,0.19738,0.16573),
-            QVector3D(0.40786,0.19901,0.16693),
-            QVector3D(0.41389,0.20064,0.16806),
-            QVector3D(0.41994,0.20228,0.16925),
-            QVector3D(0.42598,0.20394,0.17038),
-            QVector3D(0.43206,0.20555,0.17153),
-            QVector3D(0.43813,0.20718,0.17269),
-            QVector3D(0.44421,0.20879,0.17385),
-            QVector3D(0.4503,0.2104,0.17502),
-            QVector3D(0.4564,0.21202,0.17614),
-            QVector3D(0.46251,0.21361,0.17734),
-            QVector3D(0.46864,0.2152,0.1785),
-            QVector3D(0.47479,0.21681,0.17964),
-            QVector3D(0.48092,0.21839,0.18078),
-            QVector3D(0.48709,0.21998,0.18194),
-            QVector3D(0.49325,0.22155,0.1831),
-            QVector3D(0.49943,0.22314,0.18427),
-            QVector3D(0.50562,0.22468,0.18546),
-            QVector3D(0.51182,0.22628,0.18659),
-            QVector3D(0.51804,0.22784,0.18779),
-            QVector3D(0.52426,0.22938,0.18892),
-            QVector3D(0.53049,0.23094,0.19008),
-            QVector3D(0.53674,0.23249,0.19123),
-            QVector3D(0.54299,0.23403,0.1924),
-            QVector3D(0.54925,0.23559,0.19357),
-            QVector3D(0.55552,0.23713,0.19474),
-            QVector3D(0.56181,0.23863,0.19589),
-            QVector3D(0.5681,0.24016,0.19706),
-            QVector3D(0.57441,0.2417,0.1982),
-            QVector3D(0.58073,0.2432,0.19936),
-            QVector3D(0.58705,0.24472,0.20052),
-            QVector3D(0.59339,0.24623,0.20169),
-            QVector3D(0.59974,0.24776,0.20286),
-            QVector3D(0.60609,0.24925,0.20405),
-            QVector3D(0.61246,0.25075,0.20519),
-            QVector3D(0.61885,0.25225,0.20639),
-            QVector3D(0.62523,0.25374,0.20753),
-            QVector3D(0.63163,0.25524,0.20869),
-            QVector3D(0.63803,0.25671,0.20986),
-            QVector3D(0.64445,0.25817,0.21103),
-            QVector3D(0.65088,0.25967,0.21221),
-            QVector3D(0.65732,0.26113,0.21335),
-            QVector3D(0.66377,0.2626,0.21453),
-            QVector3D(0.67023,0.26407,0.21571),
-            QVector3D(0.6767,0.26552,0.21688),
-            QVector3D(0.68317,0.26696,0.21804),
-            QVector3D(0.68966,0.26842,0.21921),
-            QVector3D(0.69616,0.26988,0.22039),
-            QVector3D(0.70267,0.27131,0.22154),
-            QVector3D(0.70919,0.27274,0.22272),
-            QVector3D(0.71571,0.27418,0.22387),
-            QVector3D(0.72224,0.27563,0.22504),
-            QVector3D(0.72879,0.27705,0.22624),
-            QVector3D(0.73535,0.27847,0.2274),
-            QVector3D(0.74191,0.27988,0.22858),
-            QVector3D(0.74849,0.28129,0.22972),
-            QVector3D(0.75508,0.28272,0.23091),
-            QVector3D(0.76167,0.28411,0.23209),
-            QVector3D(0.76827,0.28551,0.23324),
-            QVector3D(0.77488,0.28691,0.23444),
-            QVector3D(0.78151,0.28831,0.23561),
-            QVector3D(0.78814,0.28971,0.23679),
-            QVector3D(0.79478,0.2911,0.23795),
-            QVector3D(0.80143,0.29248,0.23912),
-            QVector3D(0.80809,0.29385,0.24028),
-            QVector3D(0.81476,0.29523,0.24148),
-            QVector3D(0.82144,0.29662,0.24264),
-            QVector3D(0.82812,0.29797,0.24381),
-            QVector3D(0.83482,0.29935,0.24499),
-            QVector3D(0.84153,0.3007,0.24617),
-            QVector3D(0.84824,0.30205,0.24736),
-            QVector3D(0.85497,0.30341,0.24855),
-            QVector3D(0.8617,0.30477,0.2497),
-            QVector3D(0.86845,0.30613,0.25089),
-            QVector3D(0.8752,0.30745,0.25208),
-            QVector3D(0.88196,0.30881,0.25325),
-            QVector3D(0.88873,0.31015,0.25444),
-            QVector3D(0.8955,0.31147,0.25561),
-            QVector3D(0.90229,0.31279,0.25679)
-        },
-        {
-            QVector3D(0.056674,0.57959,0.98121),
-            QVector3D(0.066107,0.57547,0.97345),
-            QVector3D(0.074463,0.57135,0.9657),
-            QVector3D(0.081994,0.56724,0.95796),
-            QVector3D(0.088742,0.56314,0.95024),
-            QVector3D(0.09499,0.55904,0.94252),
-            QVector3D(0.10067,0.55495,0.93482),
-            QVector3D(0.10603,0.55086,0.92713),
-            QVector3D(0.11098,0.54678,0.91945),
-            QVector3D(0.1156,0.54271,0.91178),
-            QVector3D(0.11993,0.53864,0.90413),
-            QVector3D(0.12401,0.53457,0.89649),
-            QVector3D(0.1279,0.53052,0.88886),
-            QVector3D(0.13155,0.52647,0.88124),
-            QVector3D(0.135,0.52241,0.87363),
-            QVector3D(0.13827,0.51838,0.86604),
-            QVector3D(0.14137,0.51435,0.85845),
-            QVector3D(0.1443,0.51031,0.85088),
-            QVector3D(0.14707,0.50628,0.84333),
-            QVector3D(0.14975,0.50227,0.83578),
-            QVector3D(0.15224,0.49827,0.82825),
-            QVector3D(0.15465,0.49426,0.82073),
-            QVector3D(0.15694,0.49026,0.81323),
-            QVector3D(0.15911,0.48626,0.80573),
-            QVector3D(0.1612,0.48228,0.79826),
-            QVector3D(0.16316,0.4783,0.79079),
-            QVector3D(0.16499,0.47433,0.78334),
-            QVector3D(0.1668,0.47036,0.77589),
-            QVector3D(0.16848,0.46639,0.76846),
-            QVector3D(0.17009,0.46243,0.76105),
-            QVector3D(0.1716,0.45849,0.75365),
-            QVector3D(0.17304,0.45455,0.74626),
-            QVector3D(0.17442,0.45061,0.73889),
-            QVector3D(0.17569,0.44668,0.73153),
-            QVector3D(0.17693,0.44275,0.72418),
-            QVector3D(0.17811,0.43883,0.71685),
-            QVector3D(0.17917,0.43493,0.70953),
-            QVector3D(0.18019,0.43102,0.70222),
-            QVector3D(0.18114,0.42712,0.69493),
-            QVector3D(0.18204,0.42322,0.68765),
-            QVector3D(0.18288,0.41934,0.68038),
-            QVector3D(0.18367,0.41546,0.67314),
-            QVector3D(0.1844,0.41158,0.6659),
-            QVector3D(0.18509,0.40772,0.65868),
-            QVector3D(0.18571,0.40387,0.65148),
-            QVector3D(0.18626,0.40001,0.64428),
-            QVector3D(0.18676,0.39617,0.6371),
-            QVector3D(0.18724,0.39232,0.62994),
-            QVector3D(0.18767,0.3885,0.62279),
-            QVector3D(0.18804,0.38466,0.61565),
-            QVector3D(0.18835,0.38086,0.60854),
-            QVector3D(0.18861,0.37705,0.60143),
-            QVector3D(0.18884,0.37323,0.59434),
-            QVector3D(0.18902,0.36944,0.58727),
-            QVector3D(0.18916,0.36565,0.58021),
-            QVector3D(0.18925,0.36187,0.57317),
-            QVector3D(0.18931,0.3581,0.56614),
-            QVector3D(0.18932,0.35433,0.55913),
-            QVector3D(0.18929,0.35058,0.55214),
-            QVector3D(0.18923,0.34682,0.54515),
-            QVector3D(0.18912,0.34307,0.53819),
-            QVector3D(0.18898,0.33934,0.53124),
-            QVector3D(0.1888,0.3356,0.52431),
-            QVector3D(0.18859,0.33187,0.51739),
-            QVector3D(0.18833,0.32815,0.51049),
-            QVector3D(0.18805,0.32444,0.5036),
-            QVector3D(0.18772,0.32075,0.49673),
-            QVector3D(0.18734,0.31705,0.48988),
-            QVector3D(0.18692,0.31337,0.48305),
-            QVector3D(0.18649,0.3097,0.47624),
-            QVector3D(0.18603,0.30603,0.46945),
-            QVector3D(0.18554,0.30234,0.46265),
-            QVector3D(0.18499,0.2987,0.45589),
-            QVector3D(0.1844,0.29505,0.44915),
-            QVector3D(0.18379,0.29142,0.44242),
-            QVector3D(0.18315,0.28778,0.43571),
-            QVector3D(0.18248,0.28416,0.429),
-            QVector3D(0.18178,0.28053,0.42232),
-            QVector3D(0.18105,0.27695,0.41567),
-            QVector3D(0.18029,0.27335,0.40903),
-            QVector3D(0.1795,0.26977,0.4024),
-            QVector3D(0.1787,0.26618,0.39581),
-            QVector3D(0.17786,0.26261,0.38922),
-            QVector3D(0.17694,0.25905,0.38265),
-            QVector3D(0.176,0.25549,0.37611),
-            QVector3D(0.17509,0.25195,0.36958),
-            QVector3D(0.17411,0.24842,0.36307),
-            QVector3D(0.1731,0.24486,0.35659),
-            QVector3D(0.17207,0.24136,0.35012),
-            QVector3D(0.17101,0.23785,0.34366),
-            QVector3D(0.16994,0.23435,0.33724),
-            QVector3D(0.16882,0.23085,0.33082),
-            QVector3D(0.16766,0.22737,0.32443),
-            QVector3D(0.16649,0.22389,0.31807),
-            QVector3D(0.16526,0.22045,0.31171),
-            QVector3D(0.16408,0.21698,0.3054),
-            QVector3D(0.16281,0.21352,0.29909),
-            QVector3D(0.16154,0.21009,0.2928),
-            QVector3D(0.16017,0.20669,0.28653),
-            QVector3D(0.15887,0.20325,0.28029),
-            QVector3D(0.15748,0.19982,0.27408),
-            QVector3D(0.15612,0.19646,0.26786),
-            QVector3D(0.15467,0.19306,0.26171),
-            QVector3D(0.15321,0.18968,0.25556),
-            QVector3D(0.15174,0.18632,0.24942),
-            QVector3D(0.15026,0.18294,0.2433),
-            QVector3D(0.14871,0.17961,0.23725),
-            QVector3D(0.14718,0.17625,0.23118),
-            QVector3D(0.14564,0.17295,0.22512),
-            QVector3D(0.14403,0.16968,0.21913),
-            QVector3D(0.14243,0.16638,0.21314),
-            QVector3D(0.14084,0.16314,0.20723),
-            QVector3D(0.13919,0.15988,0.2013),
-            QVector3D(0.13765,0.15674,0.19547),
-            QVector3D(0.13602,0.15358,0.18968),
-            QVector3D(0.13455,0.15054,0.18396),
-            QVector3D(0.13306,0.14756,0.17836),
-            QVector3D(0.13167,0.14469,0.1728),
-            QVector3D(0.13042,0.14192,0.16741),
-            QVector3D(0.12922,0.13927,0.16217),
-            QVector3D(0.12825,0.13686,0.15706),
-            QVector3D(0.12743,0.13466,0.15217),
-            QVector3D(0.12685,0.13265,0.14756),
-            QVector3D(0.12655,0.13093,0.14317),
-            QVector3D(0.12652,0.12946,0.13905),
-            QVector3D(0.12678,0.12834,0.1353),
-            QVector3D(0.12737,0.12752,0.13186),
-            QVector3D(0.12833,0.12704,0.12874),
-            QVector3D(0.12961,0.12694,0.12604),
-            QVector3D(0.13123,0.12718,0.12362),
-            QVector3D(0.13318,0.1278,0.12159),
-            QVector3D(0.13545,0.1287,0.11992),
-            QVector3D(0.13807,0.12997,0.11861),
-            QVector3D(0.14093,0.13147,0.11751),
-            QVector3D(0.14404,0.13325,0.11674),
-            QVector3D(0.14739,0.13526,0.11622),
-            QVector3D(0.15092,0.1375,0.11588),
-            QVector3D(0.15463,0.13984,0.11572),
-            QVector3D(0.15851,0.14242,0.11571),
-            QVector3D(0.16247,0.14511,0.11584),
-            QVector3D(0.16652,0.14785,0.11606),
-            QVector3D(0.17065,0.15069,0.11635),
-            QVector3D(0.17485,0.15359,0.11668),
-            QVector3D(0.17908,0.15658,0.11705),
-            QVector3D(0.18333,0.15955,0.11747),
-            QVector3D(0.18766,0.16261,0.11793),
-            QVector3D(0.19194,0.16563,0.11839),
-            QVector3D(0.19628,0.16874,0.11884),
-            QVector3D(0.20058,0.17182,0.11927),
-            QVector3D(0.20495,0.17495,0.11971),
-            QVector3D(0.2093,0.17808,0.12015),
-            QVector3D(0.21365,0.18116,0.12058),
-            QVector3D(0.21802,0.18431,0.12101),
-            QVector3D(0.22237,0.18748,0.12142),
-            QVector3D(0.22675,0.19061,0.12183),
-            QVector3D(0.23112,0.19379,0.12224),
-            QVector3D(0.23551,0.19696,0.12264),
-            QVector3D(0.23987,0.20011,0.12303),
-            QVector3D(0.24425,0.20332,0.12341),
-            QVector3D(0.24867,0.20654,0.12378),
-            QVector3D(0.25306,0.20972,0.12415),
-            QVector3D(0.25746,0.21292,0.12451),
-            QVector3D(0.26188,0.21617,0.12486),
-            QVector3D(0.2663,0.21939,0.12521),
-            QVector3D(0.27074,0.22263,0.12555),
-            QVector3D(0.27516,0.22588,0.12587),
-            QVector3D(0.2796,0.22912,0.12618),
-            QVector3D(0.28403,0.23239,0.12646),
-            QVector3D(0.28849,0.23566,0.12673),
-            QVector3D(0.29294,0.23892,0.12701),
-            QVector3D(0.29741,0.24221,0.12728),
-            QVector3D(0.30187,0.24549,0.12756),
-            QVector3D(0.30637,0.24881,0.12782),
-            QVector3D(0.31086,0.25212,0.12807),
-            QVector3D(0.31534,0.25543,0.1283),
-            QVector3D(0.31985,0.25875,0.12852),
-            QVector3D(0.32434,0.26208,0.12872),
-            QVector3D(0.32887,0.26541,0.12892),
-            QVector3D(0.33339,0.26877,0.12911),
-            QVector3D(0.3379,0.27209,0.12931),
-            QVector3D(0.34245,0.27548,0.12949),
-            QVector3D(0.34699,0.27884,0.12967),
-            QVector3D(0.35153,0.28221,0.12983),
-            QVector3D(0.35609,0.28557,0.12998),
-            QVector3D(0.36064,0.28897,0.13012),
-            QVector3D(0.36522,0.29236,0.13024),
-            QVector3D(0.36979,0.29575,0.13035),
-            QVector3D(0.37439,0.29917,0.13045),
-            QVector3D(0.37897,0.30257,0.13053),
-            QVector3D(0.38358,0.30601,0.13061),
-            QVector3D(0.38818,0.30944,0.13067),
-            QVector3D(0.39279,0.31285,0.13073),
-            QVector3D(0.39741,0.31631,0.13077),
-            QVector3D(0.40203,0.31975,0.1308),
-            QVector3D(0.40668,0.3232,0.13082),
-            QVector3D(0.41131,0.32665,0.13083),
-            QVector3D(0.41596,0.33013,0.13082),
-            QVector3D(0.42062,0.3336,0.13081),
-            QVector3D(0.42529,0.33708,0.13078),
-            QVector3D(0.42996,0.34056,0.13075),
-            QVector3D(0.43464,0.34404,0.1307),
-            QVector3D(0.43932,0.34756,0.13063),
-            QVector3D(0.44402,0.35106,0.13056),
-            QVector3D(0.44872,0.35457,0.13047),
-            QVector3D(0.45341,0.35808,0.13037),
-            QVector3D(0.45813,0.3616,0.13025),
-            QVector3D(0.46284,0.36513,0.13012),
-            QVector3D(0.46758,0.36867,0.12998),
-            QVector3D(0.47231,0.3722,0.12981),
-            QVector3D(0.47705,0.37575,0.12963),
-            QVector3D(0.4818,0.3793,0.12943),
-            QVector3D(0.48655,0.38286,0.12922),
-            QVector3D(0.49133,0.38642,0.129),
-            QVector3D(0.49608,0.38999,0.12877),
-            QVector3D(0.50086,0.39357,0.12854),
-            QVector3D(0.50564,0.39715,0.1283),
-            QVector3D(0.51043,0.40075,0.12803),
-            QVector3D(0.51523,0.40433,0.12773),
-            QVector3D(0.52003,0.40793,0.1274),
-            QVector3D(0.52484,0.41154,0.12707),
-            QVector3D(0.52966,0.41515,0.12674),
-            QVector3D(0.53448,0.41876,0.12641),
-            QVector3D(0.53931,0.42238,0.12606),
-            QVector3D(0.54415,0.42601,0.12567),
-            QVector3D(0.549,0.42965,0.12524),
-            QVector3D(0.55385,0.43328,0.12481),
-            QVector3D(0.5587,0.43694,0.12436),
-            QVector3D(0.56357,0.44058,0.1239),
-            QVector3D(0.56844,0.44424,0.12341),
-            QVector3D(0.57332,0.44789,0.12291),
-            QVector3D(0.5782,0.45157,0.1224),
-            QVector3D(0.58309,0.45524,0.12186),
-            QVector3D(0.58798,0.45892,0.12131),
-            QVector3D(0.5929,0.46259,0.12074),
-            QVector3D(0.5978,0.46628,0.12015),
-            QVector3D(0.60272,0.46998,0.11954),
-            QVector3D(0.60765,0.47367,0.11893),
-            QVector3D(0.61257,0.47738,0.11828),
-            QVector3D(0.61751,0.48108,0.11755),
-            QVector3D(0.62245,0.48479,0.11685),
-            QVector3D(0.6274,0.48852,0.11615),
-            QVector3D(0.63236,0.49224,0.11536),
-            QVector3D(0.63732,0.49596,0.11454),
-            QVector3D(0.64229,0.4997,0.11378),
-            QVector3D(0.64726,0.50344,0.11298),
-            QVector3D(0.65224,0.50719,0.1121),
-            QVector3D(0.65724,0.51093,0.11121),
-            QVector3D(0.66223,0.5147,0.11031),
-            QVector3D(0.66723,0.51846,0.10936),
-            QVector3D(0.67223,0.52221,0.10832),
-            QVector3D(0.67725,0.52599,0.10736),
-            QVector3D(0.68226,0.52976,0.10634),
-            QVector3D(0.68729,0.53353,0.10521),
-            QVector3D(0.69232,0.53733,0.10412),
-            QVector3D(0.69735,0.54111,0.103),
-            QVector3D(0.7024,0.54491,0.1018)
-        },
-        {
-            QVector3D(0.12757,0.31619,0.85836),
-            QVector3D(0.14675,0.32048,0.85923),
-            QVector3D(0.16386,0.32476,0.8601),
-            QVector3D(0.17936,0.3291,0.86096),
-            QVector3D(0.1937,0.33343,0.86182),
-            QVector3D(0.20708,0.33776,0.86268),
-            QVector3D(0.21967,0.34213,0.86354),
-            QVector3D(0.23162,0.34649,0.86439),
-            QVector3D(0.24297,0.35089,0.86524),
-            QVector3D(0.25389,0.35529,0.86609),
-            QVector3D(0.26436,0.35969,0.86693),
-            QVector3D(0.27445,0.36411,0.86778),
-            QVector3D(0.28422,0.36855,0.86862),
-            QVector3D(0.29369,0.37299,0.86945),
-            QVector3D(0.30289,0.37746,0.87028),
-            QVector3D(0.31184,0.38192,0.87112),
-            QVector3D(0.32061,0.3864,0.87195),
-            QVector3D(0.32914,0.39091,0.87277),
-            QVector3D(0.33747,0.39542,0.8736),
-            QVector3D(0.34563,0.39992,0.87442),
-            QVector3D(0.35364,0.40445,0.87523),
-            QVector3D(0.36151,0.40899,0.87605),
-            QVector3D(0.36923,0.41355,0.87686),
-            QVector3D(0.37682,0.4181,0.87767),
-            QVector3D(0.38428,0.42267,0.87847),
-            QVector3D(0.39164,0.42727,0.87927),
-            QVector3D(0.39887,0.43186,0.88007),
-            QVector3D(0.40603,0.43645,0.88087),
-            QVector3D(0.41307,0.44106,0.88167),
-            QVector3D(0.42002,0.44568,0.88245),
-            QVector3D(0.4269,0.45032,0.88324),
-            QVector3D(0.43367,0.45496,0.88403),
-            QVector3D(0.44039,0.45961,0.88481),
-            QVector3D(0.44703,0.46428,0.88559),
-            QVector3D(0.45359,0.46894,0.88636),
-            QVector3D(0.46009,0.47361,0.88713),
-            QVector3D(0.46653,0.4783,0.8879),
-            QVector3D(0.4729,0.483,0.88867),
-            QVector3D(0.47922,0.48771,0.88943),
-            QVector3D(0.48547,0.49242,0.89019),
-            QVector3D(0.49169,0.49715,0.89094),
-            QVector3D(0.49784,0.50188,0.8917),
-            QVector3D(0.50394,0.50662,0.89245),
-            QVector3D(0.50999,0.51137,0.89319),
-            QVector3D(0.516,0.51612,0.89394),
-            QVector3D(0.52196,0.5209,0.89468),
-            QVector3D(0.52789,0.52567,0.89541),
-            QVector3D(0.53377,0.53046,0.89615),
-            QVector3D(0.53962,0.53525,0.89688),
-            QVector3D(0.54543,0.54005,0.8976),
-            QVector3D(0.5512,0.54486,0.89832),
-            QVector3D(0.55693,0.54968,0.89905),
-            QVector3D(0.56263,0.5545,0.89976),
-            QVector3D(0.56829,0.55933,0.90048),
-            QVector3D(0.57392,0.56418,0.90119),
-            QVector3D(0.57953,0.56902,0.90189),
-            QVector3D(0.5851,0.57388,0.9026),
-            QVector3D(0.59064,0.57874,0.9033),
-            QVector3D(0.59616,0.58361,0.90399),
-            QVector3D(0.60164,0.58849,0.90468),
-            QVector3D(0.60711,0.59339,0.90538),
-            QVector3D(0.61254,0.59828,0.90606),
-            QVector3D(0.61795,0.60318,0.90674),
-            QVector3D(0.62334,0.6081,0.90742),
-            QVector3D(0.6287,0.613,0.9081),
-            QVector3D(0.63404,0.61793,0.90877),
-            QVector3D(0.63935,0.62287,0.90943),
-            QVector3D(0.64464,0.62781,0.9101),
-            QVector3D(0.64992,0.63275,0.91076),
-            QVector3D(0.65517,0.63771,0.91142),
-            QVector3D(0.66041,0.64267,0.91207),
-            QVector3D(0.66562,0.64763,0.91272),
-            QVector3D(0.67082,0.65261,0.91337),
-            QVector3D(0.67599,0.6576,0.91401),
-            QVector3D(0.68115,0.66259,0.91465),
-            QVector3D(0.68629,0.66758,0.91528),
-            QVector3D(0.69141,0.67259,0.91591),
-            QVector3D(0.69652,0.6776,0.91655),
-            QVector3D(0.70161,0.68261,0.91717),
-            QVector3D(0.70669,0.68763,0.91779),
-            QVector3D(0.71175,0.69267,0.91841),
-            QVector3D(0.71679,0.6977,0.91902),
-            QVector3D(0.72181,0.70275,0.91963),
-            QVector3D(0.72683,0.70779,0.92023),
-            QVector3D(0.73183,0.71285,0.92083),
-            QVector3D(0.73682,0.71792,0.92143),
-            QVector3D(0.74179,0.72298,0.92203),
-            QVector3D(0.74675,0.72806,0.92262),
-            QVector3D(0.7517,0.73315,0.92321),
-            QVector3D(0.75663,0.73823,0.92379),
-            QVector3D(0.76155,0.74334,0.92436),
-            QVector3D(0.76647,0.74844,0.92494),
-            QVector3D(0.77137,0.75354,0.92551),
-            QVector3D(0.77625,0.75866,0.92608),
-            QVector3D(0.78113,0.76378,0.92664),
-            QVector3D(0.78599,0.76891,0.9272),
-            QVector3D(0.79084,0.77404,0.92775),
-            QVector3D(0.79569,0.77918,0.9283),
-            QVector3D(0.80052,0.78434,0.92885),
-            QVector3D(0.80534,0.78949,0.92939),
-            QVector3D(0.81015,0.79464,0.92993),
-            QVector3D(0.81496,0.79981,0.93047),
-            QVector3D(0.81975,0.80498,0.931),
-            QVector3D(0.82454,0.81015,0.93152),
-            QVector3D(0.82932,0.81534,0.93204),
-            QVector3D(0.83408,0.82053,0.93256),
-            QVector3D(0.83884,0.82573,0.93308),
-            QVector3D(0.84359,0.83093,0.93358),
-            QVector3D(0.84833,0.83612,0.93407),
-            QVector3D(0.85306,0.84131,0.93455),
-            QVector3D(0.85779,0.84648,0.935),
-            QVector3D(0.8625,0.85164,0.93542),
-            QVector3D(0.86719,0.85675,0.9358),
-            QVector3D(0.87187,0.86182,0.93612),
-            QVector3D(0.87652,0.86682,0.93638),
-            QVector3D(0.88114,0.87172,0.93653),
-            QVector3D(0.88573,0.87649,0.93657),
-            QVector3D(0.89027,0.8811,0.93646),
-            QVector3D(0.89475,0.8855,0.93617),
-            QVector3D(0.89915,0.88964,0.93565),
-            QVector3D(0.90346,0.89347,0.93488),
-            QVector3D(0.90766,0.89694,0.9338),
-            QVector3D(0.91172,0.89998,0.93239),
-            QVector3D(0.91562,0.90254,0.9306),
-            QVector3D(0.91935,0.90457,0.9284),
-            QVector3D(0.92288,0.90602,0.92576),
-            QVector3D(0.92619,0.90686,0.92266),
-            QVector3D(0.92926,0.90706,0.91909),
-            QVector3D(0.93208,0.9066,0.91506),
-            QVector3D(0.93464,0.90549,0.91056),
-            QVector3D(0.93695,0.90374,0.90562),
-            QVector3D(0.93899,0.90139,0.90027),
-            QVector3D(0.94078,0.89845,0.89453),
-            QVector3D(0.94232,0.89499,0.88845),
-            QVector3D(0.94363,0.89105,0.88206),
-            QVector3D(0.94474,0.8867,0.87541),
-            QVector3D(0.94565,0.88198,0.86855),
-            QVector3D(0.94638,0.87695,0.86149),
-            QVector3D(0.94697,0.87168,0.85429),
-            QVector3D(0.94743,0.86619,0.84698),
-            QVector3D(0.94776,0.86054,0.83959),
-            QVector3D(0.948,0.85477,0.83212),
-            QVector3D(0.94815,0.8489,0.82461),
-            QVector3D(0.94822,0.84295,0.81708),
-            QVector3D(0.94823,0.83695,0.80952),
-            QVector3D(0.94818,0.83092,0.80196),
-            QVector3D(0.94808,0.82486,0.79439),
-            QVector3D(0.94793,0.81878,0.78683),
-            QVector3D(0.94774,0.81269,0.77926),
-            QVector3D(0.9475,0.8066,0.77171),
-            QVector3D(0.94722,0.8005,0.76417),
-            QVector3D(0.9469,0.7944,0.75665),
-            QVector3D(0.94655,0.78831,0.74913),
-            QVector3D(0.94616,0.78221,0.74163),
-            QVector3D(0.94574,0.77612,0.73414),
-            QVector3D(0.94528,0.77003,0.72666),
-            QVector3D(0.94479,0.76394,0.7192),
-            QVector3D(0.94425,0.75785,0.71174),
-            QVector3D(0.94369,0.75176,0.7043),
-            QVector3D(0.94309,0.74567,0.69687),
-            QVector3D(0.94245,0.73959,0.68946),
-            QVector3D(0.94178,0.73349,0.68205),
-            QVector3D(0.94108,0.7274,0.67466),
-            QVector3D(0.94034,0.72131,0.66728),
-            QVector3D(0.93957,0.71523,0.65991),
-            QVector3D(0.93876,0.70914,0.65256),
-            QVector3D(0.93793,0.70305,0.64521),
-            QVector3D(0.93706,0.69695,0.63789),
-            QVector3D(0.93616,0.69086,0.63058),
-            QVector3D(0.93522,0.68477,0.62327),
-            QVector3D(0.93425,0.67867,0.61598),
-            QVector3D(0.93325,0.67258,0.60871),
-            QVector3D(0.93222,0.66648,0.60143),
-            QVector3D(0.93116,0.66038,0.59418),
-            QVector3D(0.93006,0.65428,0.58694),
-            QVector3D(0.92893,0.64818,0.57973),
-            QVector3D(0.92777,0.64208,0.57251),
-            QVector3D(0.92659,0.63597,0.5653),
-            QVector3D(0.92537,0.62986,0.55812),
-            QVector3D(0.92412,0.62375,0.55095),
-            QVector3D(0.92285,0.61762,0.54379),
-            QVector3D(0.92154,0.61151,0.53665),
-            QVector3D(0.9202,0.60538,0.52951),
-            QVector3D(0.91883,0.59925,0.52238),
-            QVector3D(0.91743,0.59312,0.51527),
-            QVector3D(0.916,0.58697,0.50819),
-            QVector3D(0.91455,0.58083,0.5011),
-            QVector3D(0.91306,0.57468,0.49403),
-            QVector3D(0.91155,0.56853,0.48698),
-            QVector3D(0.91001,0.56237,0.47994),
-            QVector3D(0.90844,0.55619,0.4729),
-            QVector3D(0.90684,0.55002,0.46589),
-            QVector3D(0.90521,0.54384,0.45889),
-            QVector3D(0.90355,0.53765,0.45191),
-            QVector3D(0.90187,0.53145,0.44493),
-            QVector3D(0.90016,0.52524,0.43797),
-            QVector3D(0.89842,0.51903,0.43102),
-            QVector3D(0.89665,0.51279,0.42408),
-            QVector3D(0.89486,0.50655,0.41717),
-            QVector3D(0.89304,0.5003,0.41026),
-            QVector3D(0.89119,0.49404,0.40336),
-            QVector3D(0.88932,0.48777,0.39647),
-            QVector3D(0.88741,0.48147,0.3896),
-            QVector3D(0.88549,0.47518,0.38274),
-            QVector3D(0.88354,0.46885,0.3759),
-            QVector3D(0.88156,0.46251,0.36907),
-            QVector3D(0.87955,0.45616,0.36225),
-            QVector3D(0.87752,0.4498,0.35546),
-            QVector3D(0.87547,0.44341,0.34865),
-            QVector3D(0.87338,0.437,0.34187),
-            QVector3D(0.87128,0.43057,0.33511),
-            QVector3D(0.86914,0.42411,0.32834),
-            QVector3D(0.86698,0.41764,0.32159),
-            QVector3D(0.8648,0.41114,0.31485),
-            QVector3D(0.8626,0.40461,0.30813),
-            QVector3D(0.86036,0.39806,0.30141),
-            QVector3D(0.8581,0.39148,0.29471),
-            QVector3D(0.85582,0.38485,0.28802),
-            QVector3D(0.85351,0.37821,0.28133),
-            QVector3D(0.85118,0.37151,0.27466),
-            QVector3D(0.84883,0.36479,0.26799),
-            QVector3D(0.84645,0.35804,0.26135),
-            QVector3D(0.84405,0.35123,0.25471),
-            QVector3D(0.84163,0.34436,0.24807),
-            QVector3D(0.83918,0.33747,0.24143),
-            QVector3D(0.83671,0.3305,0.23481),
-            QVector3D(0.83422,0.32349,0.22818),
-            QVector3D(0.8317,0.31643,0.22155),
-            QVector3D(0.82916,0.30929,0.21492),
-            QVector3D(0.82659,0.30206,0.20831),
-            QVector3D(0.824,0.29477,0.20168),
-            QVector3D(0.8214,0.2874,0.19508),
-            QVector3D(0.81876,0.27996,0.18847),
-            QVector3D(0.81611,0.27239,0.1818),
-            QVector3D(0.81343,0.26474,0.17519),
-            QVector3D(0.81074,0.25697,0.16854),
-            QVector3D(0.80802,0.24907,0.16191),
-            QVector3D(0.80528,0.24103,0.15521),
-            QVector3D(0.80252,0.23283,0.1485),
-            QVector3D(0.79974,0.22446,0.1418),
-            QVector3D(0.79693,0.21594,0.13506),
-            QVector3D(0.79411,0.20718,0.12827),
-            QVector3D(0.79126,0.19815,0.12139),
-            QVector3D(0.78839,0.18889,0.1145),
-            QVector3D(0.78551,0.1793,0.10759),
-            QVector3D(0.7826,0.16938,0.10056),
-            QVector3D(0.77967,0.15898,0.093435),
-            QVector3D(0.77672,0.14808,0.086208),
-            QVector3D(0.77375,0.13656,0.078844),
-            QVector3D(0.77076,0.12429,0.07141),
-            QVector3D(0.76775,0.11107,0.063657),
-            QVector3D(0.76473,0.096422,0.055653),
-            QVector3D(0.76168,0.080002,0.047336),
-            QVector3D(0.75862,0.060659,0.038618),
-            QVector3D(0.75553,0.03608,0.029827),
-            QVector3D(0.75243,0.0084181,0.021805)
-        },
-        {
-            QVector3D(0,0.85071,1),
-            QVector3D(0,0.85194,1),
-            QVector3D(0.056211,0.85316,1),
-            QVector3D(0.10029,0.85438,1),
-            QVector3D(0.13168,0.8556,1),
-            QVector3D(0.15712,0.85682,1),
-            QVector3D(0.17902,0.85804,1),
-            QVector3D(0.19846,0.85925,1),
-            QVector3D(0.21615,0.86047,1),
-            QVector3D(0.23241,0.86169,1),
-            QVector3D(0.24758,0.8629,1),
-            QVector3D(0.26183,0.86412,1),
-            QVector3D(0.27532,0.86533,1),
-            QVector3D(0.28813,0.86654,1),
-            QVector3D(0.30039,0.86775,1),
-            QVector3D(0.31215,0.86897,1),
-            QVector3D(0.32349,0.87017,1),
-            QVector3D(0.33443,0.87138,1),
-            QVector3D(0.34499,0.87259,1),
-            QVector3D(0.35526,0.87379,1),
-            QVector3D(0.36521,0.875,1),
-            QVector3D(0.37491,0.87621,1),
-            QVector3D(0.38437,0.87741,1),
-            QVector3D(0.3936,0.87861,1),
-            QVector3D(0.40262,0.87982,1),
-            QVector3D(0.41146,0.88102,1),
-            QVector3D(0.42011,0.88222,1),
-            QVector3D(0.4286,0.88342,1),
-            QVector3D(0.43693,0.88462,1),
-            QVector3D(0.44511,0.88582,1),
-            QVector3D(0.45315,0.88702,1),
-            QVector3D(0.46106,0.88821,1),
-            QVector3D(0.46885,0.88941,1),
-            QVector3D(0.47652,0.8906,1),
-            QVector3D(0.48407,0.8918,1),
-            QVector3D(0.49154,0.89299,1),
-            QVector3D(0.49889,0.89419,1),
-            QVector3D(0.50614,0.89538,1),
-            QVector3D(0.51332,0.89657,1),
-            QVector3D(0.5204,0.89776,1),
-            QVector3D(0.5274,0.89895,1),
-            QVector3D(0.53432,0.90014,1),
-            QVector3D(0.54117,0.90132,1),
-            QVector3D(0.54795,0.90251,1),
-            QVector3D(0.55466,0.9037,1),
-            QVector3D(0.56129,0.90488,1),
-            QVector3D(0.56787,0.90607,1),
-            QVector3D(0.57438,0.90725,1),
-            QVector3D(0.58084,0.90844,1),
-            QVector3D(0.58724,0.90962,1),
-            QVector3D(0.59358,0.9108,1),
-            QVector3D(0.59988,0.91198,1),
-            QVector3D(0.60611,0.91316,1),
-            QVector3D(0.6123,0.91434,1),
-            QVector3D(0.61845,0.91551,1),
-            QVector3D(0.62455,0.91669,1),
-            QVector3D(0.6306,0.91787,1),
-            QVector3D(0.63661,0.91904,1),
-            QVector3D(0.64258,0.92021,1),
-            QVector3D(0.6485,0.92139,1),
-            QVector3D(0.65439,0.92256,1),
-            QVector3D(0.66024,0.92373,1),
-            QVector3D(0.66606,0.9249,1),
-            QVector3D(0.67183,0.92607,1),
-            QVector3D(0.67758,0.92724,1),
-            QVector3D(0.68329,0.92841,1),
-            QVector3D(0.68897,0.92958,1),
-            QVector3D(0.69461,0.93075,1),
-            QVector3D(0.70023,0.93191,1),
-            QVector3D(0.70581,0.93307,1),
-            QVector3D(0.71137,0.93424,1),
-            QVector3D(0.7169,0.9354,1),
-            QVector3D(0.72239,0.93657,1),
-            QVector3D(0.72786,0.93773,1),
-            QVector3D(0.73331,0.93889,1),
-            QVector3D(0.73873,0.94005,1),
-            QVector3D(0.74412,0.94121,1),
-            QVector3D(0.74949,0.94237,1),
-            QVector3D(0.75485,0.94352,1),
-            QVector3D(0.76017,0.94468,1),
-            QVector3D(0.76547,0.94583,1),
-            QVector3D(0.77075,0.94699,1),
-            QVector3D(0.776,0.94814,1),
-            QVector3D(0.78124,0.9493,1),
-            QVector3D(0.78646,0.95045,1),
-            QVector3D(0.79165,0.9516,1),
-            QVector3D(0.79683,0.95275,1),
-            QVector3D(0.80199,0.9539,1),
-            QVector3D(0.80713,0.95505,1),
-            QVector3D(0.81224,0.9562,1),
-            QVector3D(0.81735,0.95735,1),
-            QVector3D(0.82244,0.9585,1),
-            QVector3D(0.8275,0.95964,1),
-            QVector3D(0.83255,0.96079,1),
-            QVector3D(0.83759,0.96192,1),
-            QVector3D(0.84261,0.96307,1),
-            QVector3D(0.8476,0.96421,1),
-            QVector3D(0.8526,0.96535,1),
-            QVector3D(0.85756,0.9665,1),
-            QVector3D(0.86253,0.96764,1),
-            QVector3D(0.86746,0.96878,1),
-            QVector3D(0.8724,0.96991,1),
-            QVector3D(0.87731,0.97105,1),
-            QVector3D(0.88221,0.97219,1),
-            QVector3D(0.8871,0.97332,1),
-            QVector3D(0.89197,0.97446,1),
-            QVector3D(0.89684,0.97559,1),
-            QVector3D(0.90168,0.97672,1),
-            QVector3D(0.90652,0.97786,1),
-            QVector3D(0.91134,0.97899,1),
-            QVector3D(0.91615,0.98012,1),
-            QVector3D(0.92095,0.98125,1),
-            QVector3D(0.92575,0.98238,1),
-            QVector3D(0.93053,0.98351,1),
-            QVector3D(0.93529,0.98464,1),
-            QVector3D(0.94005,0.98576,1),
-            QVector3D(0.9448,0.98689,1),
-            QVector3D(0.94953,0.98801,1),
-            QVector3D(0.95426,0.98914,1),
-            QVector3D(0.95897,0.99026,1),
-            QVector3D(0.96367,0.99138,1),
-            QVector3D(0.96837,0.99251,1),
-            QVector3D(0.97306,0.99363,1),
-            QVector3D(0.97773,0.99474,1),
-            QVector3D(0.9824,0.99586,1),
-            QVector3D(0.98725,0.99702,1),
-            QVector3D(0.9912,0.99798,1),
-            QVector3D(0.99685,0.99934,1),
-            QVector3D(0.99988,0.9982,0.99969),
-            QVector3D(0.99991,0.99575,0.99926),
-            QVector3D(0.99993,0.9933,0.99882),
-            QVector3D(0.99994,0.99084,0.99839),
-            QVector3D(0.99996,0.98838,0.99796),
-            QVector3D(0.99997,0.98593,0.99752),
-            QVector3D(0.99998,0.98347,0.99709),
-            QVector3D(0.99998,0.98102,0.99665),
-            QVector3D(0.99998,0.97856,0.99622),
-            QVector3D(0.99998,0.97611,0.99578),
-            QVector3D(0.99998,0.97365,0.99535),
-            QVector3D(0.99997,0.97119,0.99491),
-            QVector3D(0.99996,0.96874,0.99448),
-            QVector3D(0.99995,0.96628,0.99404),
-            QVector3D(0.99993,0.96382,0.99361),
-            QVector3D(0.99991,0.96136,0.99317),
-            QVector3D(0.99989,0.9589,0.99273),
-            QVector3D(0.99986,0.95644,0.99229),
-            QVector3D(0.99984,0.95398,0.99185),
-            QVector3D(0.9998,0.95152,0.99141),
-            QVector3D(0.99977,0.94906,0.99097),
-            QVector3D(0.99973,0.9466,0.99053),
-            QVector3D(0.99969,0.94414,0.99009),
-            QVector3D(0.99965,0.94167,0.98965),
-            QVector3D(0.9996,0.93921,0.98921),
-            QVector3D(0.99955,0.93675,0.98877),
-            QVector3D(0.9995,0.93428,0.98832),
-            QVector3D(0.99945,0.93182,0.98788),
-            QVector3D(0.99939,0.92935,0.98744),
-            QVector3D(0.99933,0.92689,0.987),
-            QVector3D(0.99926,0.92442,0.98656),
-            QVector3D(0.9992,0.92196,0.98611),
-            QVector3D(0.99913,0.91949,0.98567),
-            QVector3D(0.99905,0.91702,0.98522),
-            QVector3D(0.99898,0.91455,0.98478),
-            QVector3D(0.9989,0.91208,0.98433),
-            QVector3D(0.99882,0.90961,0.98388),
-            QVector3D(0.99873,0.90714,0.98343),
-            QVector3D(0.99865,0.90467,0.98299),
-            QVector3D(0.99855,0.9022,0.98254),
-            QVector3D(0.99846,0.89973,0.9821),
-            QVector3D(0.99837,0.89726,0.98165),
-            QVector3D(0.99827,0.89478,0.9812),
-            QVector3D(0.99816,0.89231,0.98075),
-            QVector3D(0.99806,0.88983,0.9803),
-            QVector3D(0.99795,0.88735,0.97985),
-            QVector3D(0.99784,0.88488,0.9794),
-            QVector3D(0.99773,0.8824,0.97894),
-            QVector3D(0.99761,0.87992,0.97849),
-            QVector3D(0.99749,0.87744,0.97804),
-            QVector3D(0.99737,0.87496,0.97759),
-            QVector3D(0.99725,0.87248,0.97714),
-            QVector3D(0.99712,0.87,0.97668),
-            QVector3D(0.99699,0.86752,0.97623),
-            QVector3D(0.99686,0.86503,0.97578),
-            QVector3D(0.99672,0.86256,0.97532),
-            QVector3D(0.99658,0.86007,0.97487),
-            QVector3D(0.99644,0.85758,0.97441),
-            QVector3D(0.9963,0.8551,0.97396),
-            QVector3D(0.99615,0.85261,0.9735),
-            QVector3D(0.996,0.85012,0.97305),
-            QVector3D(0.99585,0.84763,0.97259),
-            QVector3D(0.9957,0.84514,0.97214),
-            QVector3D(0.99554,0.84265,0.97168),
-            QVector3D(0.99538,0.84016,0.97122),
-            QVector3D(0.99522,0.83767,0.97076),
-            QVector3D(0.99505,0.83517,0.9703),
-            QVector3D(0.99488,0.83267,0.96984),
-            QVector3D(0.99471,0.83018,0.96938),
-            QVector3D(0.99454,0.82768,0.96892),
-            QVector3D(0.99436,0.82518,0.96846),
-            QVector3D(0.99418,0.82268,0.96801),
-            QVector3D(0.994,0.82018,0.96754),
-            QVector3D(0.99382,0.81768,0.96708),
-            QVector3D(0.99363,0.81518,0.96662),
-            QVector3D(0.99344,0.81267,0.96615),
-            QVector3D(0.99325,0.81017,0.96569),
-            QVector3D(0.99305,0.80766,0.96523),
-            QVector3D(0.99285,0.80516,0.96476),
-            QVector3D(0.99265,0.80265,0.9643),
-            QVector3D(0.99245,0.80014,0.96384),
-            QVector3D(0.99224,0.79763,0.96337),
-            QVector3D(0.99203,0.79512,0.96291),
-            QVector3D(0.99182,0.7926,0.96244),
-            QVector3D(0.99161,0.79009,0.96197),
-            QVector3D(0.99139,0.78757,0.96151),
-            QVector3D(0.99117,0.78506,0.96105),
-            QVector3D(0.99095,0.78254,0.96058),
-            QVector3D(0.99072,0.78001,0.96011),
-            QVector3D(0.9905,0.7775,0.95964),
-            QVector3D(0.99027,0.77497,0.95917),
-            QVector3D(0.99003,0.77245,0.95871),
-            QVector3D(0.9898,0.76992,0.95824),
-            QVector3D(0.98956,0.76739,0.95777),
-            QVector3D(0.98932,0.76487,0.9573),
-            QVector3D(0.98908,0.76233,0.95683),
-            QVector3D(0.98883,0.7598,0.95636),
-            QVector3D(0.98858,0.75727,0.95589),
-            QVector3D(0.98833,0.75474,0.95542),
-            QVector3D(0.98808,0.7522,0.95494),
-            QVector3D(0.98782,0.74966,0.95447),
-            QVector3D(0.98756,0.74712,0.954),
-            QVector3D(0.9873,0.74458,0.95353),
-            QVector3D(0.98704,0.74204,0.95305),
-            QVector3D(0.98677,0.7395,0.95258),
-            QVector3D(0.9865,0.73694,0.9521),
-            QVector3D(0.98623,0.7344,0.95163),
-            QVector3D(0.98596,0.73185,0.95115),
-            QVector3D(0.98568,0.72929,0.95068),
-            QVector3D(0.9854,0.72674,0.9502),
-            QVector3D(0.98512,0.72418,0.94972),
-            QVector3D(0.98484,0.72162,0.94925),
-            QVector3D(0.98455,0.71907,0.94877),
-            QVector3D(0.98426,0.71651,0.94829),
-            QVector3D(0.98397,0.71394,0.94782),
-            QVector3D(0.98367,0.71138,0.94734),
-            QVector3D(0.98338,0.70881,0.94686),
-            QVector3D(0.98308,0.70624,0.94638),
-            QVector3D(0.98278,0.70366,0.9459),
-            QVector3D(0.98247,0.70109,0.94542),
-            QVector3D(0.98217,0.69851,0.94494),
-            QVector3D(0.98186,0.69594,0.94446),
-            QVector3D(0.98154,0.69335,0.94398),
-            QVector3D(0.98123,0.69077,0.9435),
-            QVector3D(0.98091,0.68819,0.94302),
-            QVector3D(0.98059,0.6856,0.94253),
-            QVector3D(0.98027,0.68301,0.94205),
-            QVector3D(0.97995,0.68041,0.94156)
-        },
-        {
-            QVector3D(0.2109,0.65114,0.08795),
-            QVector3D(0.21113,0.64645,0.089674),
-            QVector3D(0.21134,0.64175,0.091371),
-            QVector3D(0.21153,0.63707,0.092907),
-            QVector3D(0.21169,0.63239,0.09454),
-            QVector3D(0.21184,0.62772,0.095984),
-            QVector3D(0.21196,0.62306,0.097463),
-            QVector3D(0.21206,0.6184,0.098858),
-            QVector3D(0.21214,0.61374,0.1002),
-            QVector3D(0.2122,0.6091,0.10151),
-            QVector3D(0.21223,0.60446,0.1028),
-            QVector3D(0.21225,0.59982,0.10401),
-            QVector3D(0.21225,0.59519,0.10517),
-            QVector3D(0.21224,0.59056,0.10638),
-            QVector3D(0.2122,0.58596,0.10746),
-            QVector3D(0.21215,0.58134,0.10849),
-            QVector3D(0.21207,0.57674,0.1096),
-            QVector3D(0.21198,0.57214,0.11058),
-            QVector3D(0.21187,0.56755,0.11155),
-            QVector3D(0.21174,0.56297,0.11249),
-            QVector3D(0.21159,0.55838,0.1134),
-            QVector3D(0.21142,0.55382,0.11421),
-            QVector3D(0.21123,0.54926,0.11506),
-            QVector3D(0.21103,0.5447,0.11592),
-            QVector3D(0.21081,0.54014,0.11669),
-            QVector3D(0.21057,0.5356,0.11742),
-            QVector3D(0.21032,0.53106,0.1182),
-            QVector3D(0.21005,0.52654,0.1189),
-            QVector3D(0.20977,0.522,0.11955),
-            QVector3D(0.20946,0.5175,0.1202),
-            QVector3D(0.20915,0.51298,0.12082),
-            QVector3D(0.20881,0.50848,0.12142),
-            QVector3D(0.20846,0.50398,0.122),
-            QVector3D(0.2081,0.49948,0.12257),
-            QVector3D(0.20772,0.49501,0.12311),
-            QVector3D(0.20732,0.49053,0.12363),
-            QVector3D(0.20692,0.48605,0.12413),
-            QVector3D(0.20649,0.48159,0.12461),
-            QVector3D(0.20604,0.47713,0.12507),
-            QVector3D(0.20556,0.47268,0.12553),
-            QVector3D(0.20508,0.46824,0.12595),
-            QVector3D(0.2046,0.46381,0.12633),
-            QVector3D(0.2041,0.45938,0.12668),
-            QVector3D(0.20357,0.45497,0.12703),
-            QVector3D(0.20302,0.45055,0.12737),
-            QVector3D(0.20246,0.44614,0.12771),
-            QVector3D(0.20189,0.44175,0.12802),
-            QVector3D(0.2013,0.43736,0.1283),
-            QVector3D(0.2007,0.43297,0.12855),
-            QVector3D(0.20009,0.42859,0.12879),
-            QVector3D(0.19947,0.42421,0.12902),
-            QVector3D(0.19883,0.41986,0.12924),
-            QVector3D(0.19818,0.4155,0.12945),
-            QVector3D(0.19752,0.41115,0.12965),
-            QVector3D(0.19686,0.40681,0.12982),
-            QVector3D(0.19616,0.40247,0.12998),
-            QVector3D(0.19543,0.39816,0.13012),
-            QVector3D(0.19472,0.39383,0.13024),
-            QVector3D(0.19399,0.38952,0.13034),
-            QVector3D(0.19321,0.38522,0.13043),
-            QVector3D(0.19244,0.38094,0.13051),
-            QVector3D(0.19166,0.37665,0.13056),
-            QVector3D(0.19086,0.37236,0.13061),
-            QVector3D(0.19005,0.36809,0.13064),
-            QVector3D(0.18924,0.36383,0.13066),
-            QVector3D(0.18842,0.35958,0.13066),
-            QVector3D(0.18757,0.35534,0.13065),
-            QVector3D(0.18668,0.3511,0.13063),
-            QVector3D(0.18583,0.34687,0.13059),
-            QVector3D(0.18493,0.34265,0.13054),
-            QVector3D(0.184,0.33842,0.13048),
-            QVector3D(0.18308,0.33422,0.13041),
-            QVector3D(0.18214,0.33002,0.13032),
-            QVector3D(0.1812,0.32581,0.13022),
-            QVector3D(0.18025,0.32164,0.1301),
-            QVector3D(0.17928,0.31747,0.12997),
-            QVector3D(0.17832,0.31331,0.12982),
-            QVector3D(0.17731,0.30916,0.12966),
-            QVector3D(0.17626,0.305,0.12949),
-            QVector3D(0.17526,0.30085,0.1293),
-            QVector3D(0.17423,0.29673,0.1291),
-            QVector3D(0.17316,0.29259,0.1289),
-            QVector3D(0.1721,0.28848,0.1287),
-            QVector3D(0.17102,0.28437,0.12849),
-            QVector3D(0.16995,0.28027,0.12827),
-            QVector3D(0.16885,0.27621,0.12802),
-            QVector3D(0.16771,0.27209,0.12776),
-            QVector3D(0.16659,0.26803,0.12748),
-            QVector3D(0.16541,0.26399,0.12719),
-            QVector3D(0.1643,0.25993,0.1269),
-            QVector3D(0.16312,0.25587,0.12661),
-            QVector3D(0.16194,0.25185,0.12632),
-            QVector3D(0.16072,0.24783,0.12601),
-            QVector3D(0.1595,0.24378,0.12567),
-            QVector3D(0.1583,0.23979,0.12532),
-            QVector3D(0.15704,0.2358,0.12495),
-            QVector3D(0.15581,0.23181,0.12458),
-            QVector3D(0.15452,0.22783,0.1242),
-            QVector3D(0.15324,0.22384,0.12382),
-            QVector3D(0.15195,0.21989,0.12342),
-            QVector3D(0.15065,0.21594,0.12301),
-            QVector3D(0.14935,0.212,0.1226),
-            QVector3D(0.148,0.20805,0.12217),
-            QVector3D(0.14664,0.20414,0.12174),
-            QVector3D(0.14533,0.20018,0.1213),
-            QVector3D(0.14393,0.19632,0.12085),
-            QVector3D(0.14254,0.1924,0.1204),
-            QVector3D(0.14116,0.18853,0.11993),
-            QVector3D(0.1397,0.18465,0.11946),
-            QVector3D(0.13835,0.18077,0.11899),
-            QVector3D(0.13693,0.17695,0.11852),
-            QVector3D(0.13553,0.17313,0.118),
-            QVector3D(0.1342,0.16938,0.11747),
-            QVector3D(0.13286,0.16558,0.11697),
-            QVector3D(0.13158,0.16193,0.1165),
-            QVector3D(0.13041,0.15828,0.116),
-            QVector3D(0.12925,0.1547,0.11549),
-            QVector3D(0.12828,0.15123,0.11499),
-            QVector3D(0.12744,0.14789,0.11453),
-            QVector3D(0.1268,0.14468,0.11413),
-            QVector3D(0.12643,0.14163,0.11378),
-            QVector3D(0.12631,0.13876,0.11346),
-            QVector3D(0.12649,0.13609,0.11319),
-            QVector3D(0.12701,0.13374,0.11297),
-            QVector3D(0.12798,0.13162,0.11282),
-            QVector3D(0.12929,0.12981,0.11275),
-            QVector3D(0.13109,0.12828,0.11276),
-            QVector3D(0.1333,0.12705,0.11287),
-            QVector3D(0.13593,0.12624,0.11307),
-            QVector3D(0.13905,0.12571,0.11335),
-            QVector3D(0.14261,0.1255,0.11371),
-            QVector3D(0.14653,0.12561,0.11414),
-            QVector3D(0.15086,0.12602,0.11466),
-            QVector3D(0.15553,0.12666,0.11531),
-            QVector3D(0.16047,0.12758,0.11603),
-            QVector3D(0.1657,0.12871,0.11675),
-            QVector3D(0.17119,0.13008,0.11752),
-            QVector3D(0.17685,0.13154,0.11839),
-            QVector3D(0.18266,0.13315,0.11923),
-            QVector3D(0.18863,0.1349,0.1201),
-            QVector3D(0.1947,0.13667,0.121),
-            QVector3D(0.20079,0.13857,0.12192),
-            QVector3D(0.20703,0.1405,0.12286),
-            QVector3D(0.21324,0.14246,0.12382),
-            QVector3D(0.21954,0.14446,0.12478),
-            QVector3D(0.22586,0.14644,0.12577),
-            QVector3D(0.23219,0.14845,0.12669),
-            QVector3D(0.23851,0.1505,0.12766),
-            QVector3D(0.24487,0.1525,0.12861),
-            QVector3D(0.25127,0.15454,0.12959),
-            QVector3D(0.25763,0.15658,0.13056),
-            QVector3D(0.26403,0.1586,0.13149),
-            QVector3D(0.27043,0.16058,0.13244),
-            QVector3D(0.27682,0.16261,0.13339),
-            QVector3D(0.28323,0.1646,0.13435),
-            QVector3D(0.28965,0.1666,0.13528),
-            QVector3D(0.29607,0.16858,0.13618),
-            QVector3D(0.3025,0.17056,0.13717),
-            QVector3D(0.30898,0.17253,0.13812),
-            QVector3D(0.31543,0.17453,0.13902),
-            QVector3D(0.3219,0.17646,0.13994),
-            QVector3D(0.32839,0.17847,0.14093),
-            QVector3D(0.33489,0.18039,0.14184),
-            QVector3D(0.34139,0.18234,0.14277),
-            QVector3D(0.34791,0.1843,0.1437),
-            QVector3D(0.35444,0.18626,0.14463),
-            QVector3D(0.36096,0.18821,0.14557),
-            QVector3D(0.36752,0.19011,0.14645),
-            QVector3D(0.3741,0.19204,0.14739),
-            QVector3D(0.38068,0.19399,0.14829),
-            QVector3D(0.38725,0.19589,0.14922),
-            QVector3D(0.39386,0.1978,0.15015),
-            QVector3D(0.40049,0.19969,0.15104),
-            QVector3D(0.40711,0.2016,0.15194),
-            QVector3D(0.41375,0.20353,0.15285),
-            QVector3D(0.4204,0.20541,0.15376),
-            QVector3D(0.42707,0.20731,0.15468),
-            QVector3D(0.43374,0.20919,0.1556),
-            QVector3D(0.44044,0.21108,0.15651),
-            QVector3D(0.44714,0.21294,0.15738),
-            QVector3D(0.45386,0.21481,0.15831),
-            QVector3D(0.46058,0.21671,0.15919),
-            QVector3D(0.46734,0.21856,0.16006),
-            QVector3D(0.47409,0.22044,0.16099),
-            QVector3D(0.48085,0.22227,0.1619),
-            QVector3D(0.48764,0.22411,0.16278),
-            QVector3D(0.49444,0.22599,0.16368),
-            QVector3D(0.50124,0.22782,0.16455),
-            QVector3D(0.50806,0.22963,0.1654),
-            QVector3D(0.51489,0.2315,0.16631),
-            QVector3D(0.52173,0.2333,0.16721),
-            QVector3D(0.5286,0.23516,0.16807),
-            QVector3D(0.53546,0.23698,0.16898),
-            QVector3D(0.54234,0.23877,0.16985),
-            QVector3D(0.54924,0.24058,0.17071),
-            QVector3D(0.55614,0.2424,0.17158),
-            QVector3D(0.56307,0.2442,0.17245),
-            QVector3D(0.56999,0.246,0.17332),
-            QVector3D(0.57695,0.24782,0.17421),
-            QVector3D(0.5839,0.24959,0.17508),
-            QVector3D(0.59087,0.25141,0.17591),
-            QVector3D(0.59785,0.25318,0.17679),
-            QVector3D(0.60485,0.25498,0.17769),
-            QVector3D(0.61185,0.25674,0.17854),
-            QVector3D(0.61888,0.25851,0.17939),
-            QVector3D(0.6259,0.26028,0.18024),
-            QVector3D(0.63295,0.26205,0.18109),
-            QVector3D(0.64001,0.26383,0.18194),
-            QVector3D(0.64708,0.26557,0.1828),
-            QVector3D(0.65415,0.26731,0.18366),
-            QVector3D(0.66125,0.26909,0.18452),
-            QVector3D(0.66835,0.27084,0.18539),
-            QVector3D(0.67547,0.27256,0.18622),
-            QVector3D(0.68259,0.27431,0.18707),
-            QVector3D(0.68974,0.27606,0.18793),
-            QVector3D(0.69689,0.27778,0.18876),
-            QVector3D(0.70405,0.27952,0.18959),
-            QVector3D(0.71123,0.28123,0.19042),
-            QVector3D(0.71841,0.28297,0.19126),
-            QVector3D(0.72562,0.28467,0.1921),
-            QVector3D(0.73282,0.28638,0.19294),
-            QVector3D(0.74005,0.2881,0.19379),
-            QVector3D(0.74728,0.28981,0.19463),
-            QVector3D(0.75453,0.29152,0.19544),
-            QVector3D(0.76178,0.29321,0.19629),
-            QVector3D(0.76904,0.2949,0.19711),
-            QVector3D(0.77633,0.29661,0.19792),
-            QVector3D(0.78362,0.29829,0.19874),
-            QVector3D(0.79092,0.29998,0.19955),
-            QVector3D(0.79823,0.30166,0.20037),
-            QVector3D(0.80555,0.30334,0.2012),
-            QVector3D(0.81289,0.30503,0.20202),
-            QVector3D(0.82024,0.3067,0.20285),
-            QVector3D(0.82759,0.30837,0.20368),
-            QVector3D(0.83497,0.31005,0.2045),
-            QVector3D(0.84235,0.31169,0.20529),
-            QVector3D(0.84974,0.31336,0.20613),
-            QVector3D(0.85714,0.31501,0.20694),
-            QVector3D(0.86455,0.31667,0.20773),
-            QVector3D(0.87198,0.31832,0.20854),
-            QVector3D(0.87941,0.31997,0.20934),
-            QVector3D(0.88686,0.3216,0.21015),
-            QVector3D(0.89431,0.32325,0.21095),
-            QVector3D(0.90178,0.32488,0.21177),
-            QVector3D(0.90925,0.32651,0.21256),
-            QVector3D(0.91675,0.32815,0.21334),
-            QVector3D(0.92424,0.32979,0.21416),
-            QVector3D(0.93175,0.33139,0.21494),
-            QVector3D(0.93927,0.33303,0.21575),
-            QVector3D(0.9468,0.33465,0.21655),
-            QVector3D(0.95434,0.33625,0.21733),
-            QVector3D(0.96189,0.33786,0.21812),
-            QVector3D(0.96945,0.33948,0.21891),
-            QVector3D(0.97703,0.34108,0.2197),
-            QVector3D(0.98461,0.34269,0.2205),
-            QVector3D(0.9922,0.34427,0.22128)
-        },
-        {
-            QVector3D(0.22157,0.59107,0.055073),
-            QVector3D(0.22965,0.59389,0.068993),
-            QVector3D(0.2376,0.59671,0.081291),
-            QVector3D(0.24531,0.59952,0.092565),
-            QVector3D(0.25292,0.60233,0.10315),
-            QVector3D(0.26037,0.60514,0.11313),
-            QVector3D(0.26768,0.60796,0.12253),
-            QVector3D(0.27491,0.61076,0.13168),
-            QVector3D(0.28202,0.61356,0.14045),
-            QVector3D(0.28902,0.61637,0.14894),
-            QVector3D(0.29592,0.61918,0.15721),
-            QVector3D(0.30273,0.62197,0.16528),
-            QVector3D(0.3095,0.62478,0.1732),
-            QVector3D(0.31616,0.62758,0.18095),
-            QVector3D(0.32276,0.63038,0.18859),
-            QVector3D(0.32929,0.63317,0.1961),
-            QVector3D(0.33575,0.63597,0.20349),
-            QVector3D(0.34216,0.63876,0.21079),
-            QVector3D(0.34851,0.64155,0.21802),
-            QVector3D(0.35482,0.64434,0.22514),
-            QVector3D(0.36105,0.64714,0.23224),
-            QVector3D(0.36726,0.64993,0.23924),
-            QVector3D(0.37343,0.65271,0.24619),
-            QVector3D(0.37954,0.6555,0.25311),
-            QVector3D(0.38562,0.65828,0.25997),
-            QVector3D(0.39167,0.66106,0.26678),
-            QVector3D(0.39767,0.66385,0.27357),
-            QVector3D(0.40364,0.66662,0.28029),
-            QVector3D(0.40958,0.66941,0.287),
-            QVector3D(0.41548,0.67219,0.29368),
-            QVector3D(0.42135,0.67496,0.30034),
-            QVector3D(0.42721,0.67774,0.30697),
-            QVector3D(0.43302,0.68051,0.31358),
-            QVector3D(0.43881,0.68328,0.32017),
-            QVector3D(0.44459,0.68606,0.32672),
-            QVector3D(0.45032,0.68883,0.33328),
-            QVector3D(0.45604,0.6916,0.33982),
-            QVector3D(0.46174,0.69436,0.34632),
-            QVector3D(0.46742,0.69713,0.35283),
-            QVector3D(0.47307,0.6999,0.35932),
-            QVector3D(0.47871,0.70267,0.3658),
-            QVector3D(0.48432,0.70543,0.37227),
-            QVector3D(0.48992,0.70819,0.37873),
-            QVector3D(0.49551,0.71096,0.38518),
-            QVector3D(0.50108,0.71371,0.39164),
-            QVector3D(0.50662,0.71648,0.39808),
-            QVector3D(0.51215,0.71923,0.40451),
-            QVector3D(0.51768,0.72199,0.41095),
-            QVector3D(0.52318,0.72475,0.41738),
-            QVector3D(0.52867,0.7275,0.42379),
-            QVector3D(0.53414,0.73026,0.43022),
-            QVector3D(0.5396,0.73301,0.43664),
-            QVector3D(0.54506,0.73576,0.44305),
-            QVector3D(0.5505,0.73851,0.44946),
-            QVector3D(0.55592,0.74126,0.45587),
-            QVector3D(0.56134,0.74401,0.46228),
-            QVector3D(0.56675,0.74676,0.4687),
-            QVector3D(0.57214,0.7495,0.47512),
-            QVector3D(0.57752,0.75225,0.48152),
-            QVector3D(0.58289,0.755,0.48794),
-            QVector3D(0.58826,0.75775,0.49435),
-            QVector3D(0.59362,0.76049,0.50076),
-            QVector3D(0.59896,0.76323,0.50717),
-            QVector3D(0.60431,0.76597,0.5136),
-            QVector3D(0.60963,0.76871,0.52001),
-            QVector3D(0.61495,0.77146,0.52644),
-            QVector3D(0.62027,0.77419,0.53286),
-            QVector3D(0.62557,0.77693,0.53928),
-            QVector3D(0.63088,0.77967,0.54572),
-            QVector3D(0.63617,0.7824,0.55215),
-            QVector3D(0.64145,0.78514,0.55858),
-            QVector3D(0.64673,0.78787,0.56502),
-            QVector3D(0.652,0.79061,0.57147),
-            QVector3D(0.65727,0.79334,0.57791),
-            QVector3D(0.66253,0.79607,0.58437),
-            QVector3D(0.66778,0.7988,0.59082),
-            QVector3D(0.67303,0.80153,0.59729),
-            QVector3D(0.67827,0.80426,0.60376),
-            QVector3D(0.68351,0.80699,0.61022),
-            QVector3D(0.68875,0.80972,0.6167),
-            QVector3D(0.69397,0.81244,0.62318),
-            QVector3D(0.69919,0.81517,0.62965),
-            QVector3D(0.70441,0.8179,0.63615),
-            QVector3D(0.70963,0.82062,0.64264),
-            QVector3D(0.71483,0.82335,0.64914),
-            QVector3D(0.72004,0.82607,0.65564),
-            QVector3D(0.72525,0.82879,0.66215),
-            QVector3D(0.73044,0.83152,0.66866),
-            QVector3D(0.73563,0.83424,0.67518),
-            QVector3D(0.74082,0.83696,0.6817),
-            QVector3D(0.74601,0.83968,0.68824),
-            QVector3D(0.7512,0.84239,0.69477),
-            QVector3D(0.75637,0.84511,0.70131),
-            QVector3D(0.76155,0.84782,0.70786),
-            QVector3D(0.76672,0.85054,0.71441),
-            QVector3D(0.77189,0.85326,0.72097),
-            QVector3D(0.77706,0.85597,0.72754),
-            QVector3D(0.78223,0.85869,0.73411),
-            QVector3D(0.78739,0.8614,0.74068),
-            QVector3D(0.79255,0.86412,0.74727),
-            QVector3D(0.7977,0.86682,0.75386),
-            QVector3D(0.80286,0.86954,0.76045),
-            QVector3D(0.80801,0.87225,0.76705),
-            QVector3D(0.81316,0.87496,0.77366),
-            QVector3D(0.81831,0.87767,0.78027),
-            QVector3D(0.82345,0.88037,0.7869),
-            QVector3D(0.8286,0.88308,0.79353),
-            QVector3D(0.83375,0.88579,0.80016),
-            QVector3D(0.83889,0.88849,0.80678),
-            QVector3D(0.84403,0.89117,0.8134),
-            QVector3D(0.84917,0.89385,0.82001),
-            QVector3D(0.8543,0.8965,0.82659),
-            QVector3D(0.85943,0.89913,0.83314),
-            QVector3D(0.86454,0.90171,0.83964),
-            QVector3D(0.86965,0.90424,0.84606),
-            QVector3D(0.87473,0.9067,0.85239),
-            QVector3D(0.87979,0.90907,0.85857),
-            QVector3D(0.88483,0.91132,0.8646),
-            QVector3D(0.88981,0.91343,0.87039),
-            QVector3D(0.89474,0.91536,0.87592),
-            QVector3D(0.8996,0.91708,0.88112),
-            QVector3D(0.90436,0.91854,0.88593),
-            QVector3D(0.90902,0.91973,0.89029),
-            QVector3D(0.91355,0.92058,0.89413),
-            QVector3D(0.91792,0.92108,0.8974),
-            QVector3D(0.92213,0.9212,0.90005),
-            QVector3D(0.92614,0.92091,0.90203),
-            QVector3D(0.92995,0.9202,0.90332),
-            QVector3D(0.93353,0.91905,0.9039),
-            QVector3D(0.9369,0.91749,0.90377),
-            QVector3D(0.94002,0.91549,0.90294),
-            QVector3D(0.94291,0.91311,0.90144),
-            QVector3D(0.94556,0.91036,0.89932),
-            QVector3D(0.94799,0.90726,0.89661),
-            QVector3D(0.95021,0.90386,0.89338),
-            QVector3D(0.95224,0.90019,0.88969),
-            QVector3D(0.95409,0.89629,0.8856),
-            QVector3D(0.95578,0.89219,0.88117),
-            QVector3D(0.95733,0.88793,0.87646),
-            QVector3D(0.95876,0.88354,0.87154),
-            QVector3D(0.96008,0.87904,0.86642),
-            QVector3D(0.96131,0.87447,0.86117),
-            QVector3D(0.96246,0.86983,0.85582),
-            QVector3D(0.96355,0.86515,0.85038),
-            QVector3D(0.96458,0.86044,0.8449),
-            QVector3D(0.96556,0.8557,0.83937),
-            QVector3D(0.9665,0.85093,0.83383),
-            QVector3D(0.9674,0.84616,0.82826),
-            QVector3D(0.96826,0.84138,0.82269),
-            QVector3D(0.96908,0.83659,0.81711),
-            QVector3D(0.96988,0.83181,0.81154),
-            QVector3D(0.97064,0.82702,0.80597),
-            QVector3D(0.97138,0.82223,0.80041),
-            QVector3D(0.9721,0.81743,0.79486),
-            QVector3D(0.97278,0.81263,0.78932),
-            QVector3D(0.97344,0.80784,0.78378),
-            QVector3D(0.97407,0.80303,0.77824),
-            QVector3D(0.97467,0.79823,0.77271),
-            QVector3D(0.97524,0.79344,0.76719),
-            QVector3D(0.97579,0.78863,0.76168),
-            QVector3D(0.97632,0.78382,0.75618),
-            QVector3D(0.97682,0.77901,0.75068),
-            QVector3D(0.97729,0.7742,0.74518),
-            QVector3D(0.97774,0.76938,0.7397),
-            QVector3D(0.97816,0.76457,0.73422),
-            QVector3D(0.97855,0.75974,0.72875),
-            QVector3D(0.97893,0.75493,0.72328),
-            QVector3D(0.97928,0.7501,0.71783),
-            QVector3D(0.9796,0.74527,0.71237),
-            QVector3D(0.9799,0.74044,0.70693),
-            QVector3D(0.98017,0.7356,0.70149),
-            QVector3D(0.98042,0.73077,0.69606),
-            QVector3D(0.98064,0.72593,0.69063),
-            QVector3D(0.98084,0.72108,0.68522),
-            QVector3D(0.98102,0.71624,0.6798),
-            QVector3D(0.98118,0.71138,0.6744),
-            QVector3D(0.98131,0.70653,0.66901),
-            QVector3D(0.98142,0.70166,0.66363),
-            QVector3D(0.9815,0.69679,0.65824),
-            QVector3D(0.98157,0.69193,0.65286),
-            QVector3D(0.98161,0.68705,0.6475),
-            QVector3D(0.98162,0.68217,0.64214),
-            QVector3D(0.98162,0.67729,0.63679),
-            QVector3D(0.98159,0.6724,0.63144),
-            QVector3D(0.98154,0.6675,0.6261),
-            QVector3D(0.98147,0.6626,0.62077),
-            QVector3D(0.98138,0.6577,0.61544),
-            QVector3D(0.98126,0.65278,0.61013),
-            QVector3D(0.98113,0.64786,0.60482),
-            QVector3D(0.98097,0.64294,0.59952),
-            QVector3D(0.98079,0.63801,0.59422),
-            QVector3D(0.98059,0.63307,0.58893),
-            QVector3D(0.98037,0.62813,0.58366),
-            QVector3D(0.98013,0.62318,0.57838),
-            QVector3D(0.97987,0.61821,0.57313),
-            QVector3D(0.97959,0.61324,0.56786),
-            QVector3D(0.97929,0.60827,0.56262),
-            QVector3D(0.97896,0.60329,0.55738),
-            QVector3D(0.97862,0.59829,0.55214),
-            QVector3D(0.97826,0.59329,0.54691),
-            QVector3D(0.97788,0.58827,0.54169),
-            QVector3D(0.97747,0.58326,0.53649),
-            QVector3D(0.97705,0.57822,0.53128),
-            QVector3D(0.97661,0.57319,0.52609),
-            QVector3D(0.97615,0.56814,0.5209),
-            QVector3D(0.97567,0.56308,0.51571),
-            QVector3D(0.97517,0.558,0.51054),
-            QVector3D(0.97465,0.55292,0.50537),
-            QVector3D(0.97411,0.54782,0.50022),
-            QVector3D(0.97355,0.54272,0.49508),
-            QVector3D(0.97298,0.5376,0.48993),
-            QVector3D(0.97239,0.53246,0.48479),
-            QVector3D(0.97177,0.52731,0.47968),
-            QVector3D(0.97114,0.52213,0.47456),
-            QVector3D(0.97049,0.51696,0.46946),
-            QVector3D(0.96982,0.51176,0.46436),
-            QVector3D(0.96914,0.50655,0.45926),
-            QVector3D(0.96843,0.50133,0.45417),
-            QVector3D(0.96771,0.49607,0.4491),
-            QVector3D(0.96697,0.49082,0.44403),
-            QVector3D(0.96621,0.48553,0.43896),
-            QVector3D(0.96544,0.48023,0.4339),
-            QVector3D(0.96464,0.47491,0.42887),
-            QVector3D(0.96383,0.46957,0.42382),
-            QVector3D(0.96301,0.4642,0.4188),
-            QVector3D(0.96216,0.45881,0.41378),
-            QVector3D(0.9613,0.45339,0.40877),
-            QVector3D(0.96042,0.44795,0.40377),
-            QVector3D(0.95952,0.4425,0.39877),
-            QVector3D(0.95861,0.43701,0.39379),
-            QVector3D(0.95768,0.43149,0.38882),
-            QVector3D(0.95673,0.42593,0.38384),
-            QVector3D(0.95577,0.42035,0.37888),
-            QVector3D(0.95479,0.41474,0.37393),
-            QVector3D(0.9538,0.4091,0.36899),
-            QVector3D(0.95278,0.40342,0.36405),
-            QVector3D(0.95175,0.3977,0.35912),
-            QVector3D(0.95071,0.39194,0.3542),
-            QVector3D(0.94964,0.38614,0.3493),
-            QVector3D(0.94857,0.38031,0.34439),
-            QVector3D(0.94747,0.37443,0.33951),
-            QVector3D(0.94636,0.3685,0.33463),
-            QVector3D(0.94524,0.36251,0.32975),
-            QVector3D(0.9441,0.35648,0.32487),
-            QVector3D(0.94294,0.3504,0.32002),
-            QVector3D(0.94177,0.34423,0.31516),
-            QVector3D(0.94058,0.33802,0.31033),
-            QVector3D(0.93938,0.33175,0.3055),
-            QVector3D(0.93816,0.3254,0.30066),
-            QVector3D(0.93693,0.31899,0.29584),
-            QVector3D(0.93568,0.31248,0.29104),
-            QVector3D(0.93441,0.30592,0.28623),
-            QVector3D(0.93313,0.29924,0.28145),
-            QVector3D(0.93184,0.29246,0.27668),
-            QVector3D(0.93053,0.28558,0.27188),
-            QVector3D(0.9292,0.27862,0.26712)
-        },
-        {
-            QVector3D(0.22157,0.59107,0.055073),
-            QVector3D(0.22965,0.59389,0.068993),
-            QVector3D(0.2376,0.59671,0.081291),
-            QVector3D(0.24531,0.59952,0.092565),
-            QVector3D(0.25292,0.60233,0.10315),
-            QVector3D(0.26037,0.60514,0.11313),
-            QVector3D(0.26768,0.60796,0.12253),
-            QVector3D(0.27491,0.61076,0.13168),
-            QVector3D(0.28202,0.61356,0.14045),
-            QVector3D(0.28902,0.61637,0.14894),
-            QVector3D(0.29592,0.61918,0.15721),
-            QVector3D(0.30273,0.62197,0.16528),
-            QVector3D(0.3095,0.62478,0.1732),
-            QVector3D(0.31616,0.62758,0.18095),
-            QVector3D(0.32276,0.63038,0.18859),
-            QVector3D(0.32929,0.63317,0.1961),
-            QVector3D(0.33575,0.63597,0.20349),
-            QVector3D(0.34216,0.63876,0.21079),
-            QVector3D(0.34851,0.64155,0.21802),
-            QVector3D(0.35482,0.64434,0.22514),
-            QVector3D(0.36105,0.64714,0.23224),
-            QVector3D(0.36726,0.64993,0.23924),
-            QVector3D(0.37343,0.65271,0.24619),
-            QVector3D(0.37954,0.6555,0.25311),
-            QVector3D(0.38562,0.65828,0.25997),
-            QVector3D(0.39167,0.66106,0.26678),
-            QVector3D(0.39767,0.66385,0.27357),
-            QVector3D(0.40364,0.66662,0.28029),
-            QVector3D(0.40958,0.66941,0.287),
-            QVector3D(0.41548,0.67219,0.29368),
-            QVector3D(0.42135,0.67496,0.30034),
-            QVector3D(0.42721,0.67774,0.30697),
-            QVector3D(0.43302,0.68051,0.31358),
-            QVector3D(0.43881,0.68328,0.32017),
-            QVector3D(0.44459,0.68606,0.32672),
-            QVector3D(0.45032,0.68883,0.33328),
-            QVector3D(0.45604,0.6916,0.33982),
-            QVector3D(0.46174,0.69436,0.34632),
-            QVector3D(0.46742,0.69713,0.35283),
-            QVector3D(0.47307,0.6999,0.35932),
-            QVector3D(0.47871,0.70267,0.3658),
-            QVector3D(0.48432,0.70543,0.37227),
-            QVector3D(0.48992,0.70819,0.37873),
-            QVector3D(0.49551,0.71096,0.38518),
-            QVector3D(0.50108,0.71371,0.39164),
-            QVector3D(0.50662,0.71648,0.39808),
-            QVector3D(0.51215,0.71923,0.40451),
-            QVector3D(0.51768,0.72199,0.41095),
-            QVector3D(0.52318,0.72475,0.41738),
-            QVector3D(0.52867,0.7275,0.42379),
-            QVector3D(0.53414,0.73026,0.43022),
-            QVector3D(0.5396,0.73301,0.43664),
-            QVector3D(0.54506,0.73576,0.44305),
-            QVector3D(0.5505,0.73851,0.44946),
-            QVector3D(0.55592,0.74126,0.45587),
-            QVector3D(0.56134,0.74401,0.46228),
-            QVector3D(0.56675,0.74676,0.4687),
-            QVector3D(0.57214,0.7495,0.47512),
-            QVector3D(0.57752,0.75225,0.48152),
-            QVector3D(0.58289,0.755,0.48794),
-            QVector3D(0.58826,0.75775,0.49435),
-            QVector3D(0.59362,0.76049,0.50076),
-            QVector3D(0.59896,0.76323,0.50717),
-            QVector3D(0.60431,0.76597,0.5136),
-            QVector3D(0.60963,0.76871,0.52001),
-            QVector3D(0.61495,0.77146,0.52644),
-            QVector3D(0.62027,0.77419,0.53286),
-            QVector3D(0.62557,0.77693,0.53928),
-            QVector3D(0.63088,0.77967,0.54572),
-            QVector3D(0.63617,0.7824,0.55215),
-            QVector3D(0.64145,0.78514,0.55858),
-            QVector3D(0.64673,0.78787,0.56502),
-            QVector3D(0.652,0.79061,0.57147),
-            QVector3D(0.65727,0.79334,0.57791),
-            QVector3D(0.66253,0.79607,0.58437),
-            QVector3D(0.66778,0.7988,0.59082),
-            QVector3D(0.67303,0.80153,0.59729),
-            QVector3D(0.67827,0.80426,0.60376),
-            QVector3D(0.68351,0.80699,0.61022),
-            QVector3D(0.68875,0.80972,0.6167),
-            QVector3D(0.69397,0.81244,0.62318),
-            QVector3D(0.69919,0.81517,0.62965),
-            QVector3D(0.70441,0.8179,0.63615),
-            QVector3D(0.70963,0.82062,0.64264),
-            QVector3D(0.71483,0.82335,0.64914),
-            QVector3D(0.72004,0.82607,0.65564),
-            QVector3D(0.72525,0.82879,0.66215),
-            QVector3D(0.73044,0.83152,0.66866),
-            QVector3D(0.73563,0.83424,0.67518),
-            QVector3D(0.74082,0.83696,0.6817),
-            QVector3D(0.74601,0.83968,0.68824),
-            QVector3D(0.7512,0.84239,0.69477),
-            QVector3D(0.75637,0.84511,0.70131),
-            QVector3D(0.76155,0.84782,0.70786),
-            QVector3D(0.76672,0.85054,0.71441),
-            QVector3D(0.77189,0.85326,0.72097),
-            QVector3D(0.77706,0.85597,0.72754),
-            QVector3D(0.78223,0.85869,0.73411),
-            QVector3D(0.78739,0.8614,0.74068),
-            QVector3D(0.79255,0.86412,0.74727),
-            QVector3D(0.7977,0.86682,0.75386),
-            QVector3D(0.80286,0.86954,0.76045),
-            QVector3D(0.80801,0.87225,0.76705),
-            QVector3D(0.81316,0.87496,0.77366),
-            QVector3D(0.81831,0.87767,0.78027),
-            QVector3D(0.82345,0.88037,0.7869),
-            QVector3D(0.8286,0.88308,0.79353),
-            QVector3D(0.83375,0.88579,0.80016),
-            QVector3D(0.83888,0.88849,0.8068),
-            QVector3D(0.84401,0.89118,0.81343),
-            QVector3D(0.84914,0.89385,0.82007),
-            QVector3D(0.85424,0.89651,0.82671),
-            QVector3D(0.85933,0.89914,0.83333),
-            QVector3D(0.8644,0.90172,0.83995),
-            QVector3D(0.86942,0.90426,0.84652),
-            QVector3D(0.8744,0.90673,0.85306),
-            QVector3D(0.87932,0.90912,0.85955),
-            QVector3D(0.88415,0.91139,0.86596),
-            QVector3D(0.88888,0.91352,0.87228),
-            QVector3D(0.89348,0.91548,0.87846),
-            QVector3D(0.89792,0.91724,0.8845),
-            QVector3D(0.90218,0.91875,0.89034),
-            QVector3D(0.90621,0.92,0.89596),
-            QVector3D(0.90998,0.92093,0.90131),
-            QVector3D(0.91347,0.92152,0.90637),
-            QVector3D(0.91664,0.92174,0.91109),
-            QVector3D(0.91948,0.92157,0.91546),
-            QVector3D(0.92195,0.92098,0.91944),
-            QVector3D(0.92406,0.91999,0.92303),
-            QVector3D(0.92579,0.91859,0.92621),
-            QVector3D(0.92715,0.91679,0.92898),
-            QVector3D(0.92815,0.9146,0.93137),
-            QVector3D(0.92881,0.91206,0.93337),
-            QVector3D(0.92915,0.90919,0.93503),
-            QVector3D(0.9292,0.90603,0.93636),
-            QVector3D(0.92898,0.9026,0.9374),
-            QVector3D(0.92854,0.89895,0.93818),
-            QVector3D(0.9279,0.89512,0.93875),
-            QVector3D(0.9271,0.89113,0.93913),
-            QVector3D(0.92616,0.88701,0.93935),
-            QVector3D(0.92511,0.8828,0.93945),
-            QVector3D(0.92397,0.87851,0.93946),
-            QVector3D(0.92276,0.87416,0.93938),
-            QVector3D(0.92149,0.86976,0.93925),
-            QVector3D(0.92018,0.86533,0.93907),
-            QVector3D(0.91883,0.86089,0.93886),
-            QVector3D(0.91747,0.85642,0.93862),
-            QVector3D(0.91607,0.85195,0.93837),
-            QVector3D(0.91467,0.84746,0.93811),
-            QVector3D(0.91325,0.84298,0.93783),
-            QVector3D(0.91182,0.83849,0.93754),
-            QVector3D(0.91039,0.834,0.93726),
-            QVector3D(0.90894,0.82952,0.93697),
-            QVector3D(0.9075,0.82502,0.93668),
-            QVector3D(0.90604,0.82053,0.93639),
-            QVector3D(0.90457,0.81605,0.93609),
-            QVector3D(0.9031,0.81156,0.93579),
-            QVector3D(0.90162,0.80708,0.93549),
-            QVector3D(0.90014,0.80258,0.93519),
-            QVector3D(0.89864,0.7981,0.93488),
-            QVector3D(0.89715,0.79361,0.93457),
-            QVector3D(0.89564,0.78912,0.93426),
-            QVector3D(0.89412,0.78464,0.93395),
-            QVector3D(0.8926,0.78014,0.93363),
-            QVector3D(0.89107,0.77565,0.93332),
-            QVector3D(0.88953,0.77117,0.93299),
-            QVector3D(0.88799,0.76667,0.93267),
-            QVector3D(0.88644,0.76218,0.93235),
-            QVector3D(0.88488,0.75769,0.93202),
-            QVector3D(0.88332,0.75319,0.93169),
-            QVector3D(0.88174,0.7487,0.93136),
-            QVector3D(0.88016,0.74421,0.93103),
-            QVector3D(0.87857,0.73972,0.93069),
-            QVector3D(0.87698,0.73522,0.93035),
-            QVector3D(0.87538,0.73072,0.93001),
-            QVector3D(0.87377,0.72622,0.92966),
-            QVector3D(0.87215,0.72172,0.92931),
-            QVector3D(0.87052,0.71723,0.92896),
-            QVector3D(0.8689,0.71271,0.92861),
-            QVector3D(0.86725,0.70822,0.92826),
-            QVector3D(0.86561,0.70371,0.9279),
-            QVector3D(0.86396,0.6992,0.92754),
-            QVector3D(0.8623,0.69469,0.92718),
-            QVector3D(0.86063,0.69018,0.92682),
-            QVector3D(0.85895,0.68568,0.92645),
-            QVector3D(0.85727,0.68116,0.92609),
-            QVector3D(0.85558,0.67665,0.92572),
-            QVector3D(0.85388,0.67213,0.92534),
-            QVector3D(0.85218,0.66761,0.92497),
-            QVector3D(0.85046,0.66309,0.92459),
-            QVector3D(0.84874,0.65856,0.92421),
-            QVector3D(0.84701,0.65404,0.92383),
-            QVector3D(0.84528,0.64951,0.92345),
-            QVector3D(0.84353,0.64497,0.92306),
-            QVector3D(0.84178,0.64044,0.92267),
-            QVector3D(0.84003,0.6359,0.92228),
-            QVector3D(0.83826,0.63136,0.92189),
-            QVector3D(0.83649,0.62682,0.92149),
-            QVector3D(0.83471,0.62227,0.92109),
-            QVector3D(0.83291,0.61772,0.92069),
-            QVector3D(0.83112,0.61316,0.92029),
-            QVector3D(0.82932,0.60861,0.91989),
-            QVector3D(0.8275,0.60405,0.91948),
-            QVector3D(0.82568,0.59948,0.91907),
-            QVector3D(0.82386,0.59491,0.91866),
-            QVector3D(0.82203,0.59033,0.91825),
-            QVector3D(0.82018,0.58576,0.91784),
-            QVector3D(0.81833,0.58117,0.91743),
-            QVector3D(0.81648,0.57659,0.91701),
-            QVector3D(0.81461,0.57199,0.91658),
-            QVector3D(0.81273,0.56739,0.91615),
-            QVector3D(0.81085,0.56279,0.91573),
-            QVector3D(0.80897,0.55817,0.9153),
-            QVector3D(0.80707,0.55356,0.91487),
-            QVector3D(0.80516,0.54895,0.91444),
-            QVector3D(0.80325,0.54431,0.91401),
-            QVector3D(0.80133,0.53967,0.91357),
-            QVector3D(0.7994,0.53504,0.91313),
-            QVector3D(0.79746,0.53039,0.91269),
-            QVector3D(0.79552,0.52573,0.91225),
-            QVector3D(0.79357,0.52107,0.9118),
-            QVector3D(0.7916,0.51639,0.91136),
-            QVector3D(0.78964,0.51172,0.91091),
-            QVector3D(0.78766,0.50703,0.91046),
-            QVector3D(0.78568,0.50233,0.91001),
-            QVector3D(0.78368,0.49764,0.90955),
-            QVector3D(0.78168,0.49291,0.90909),
-            QVector3D(0.77967,0.48819,0.90863),
-            QVector3D(0.77766,0.48345,0.90817),
-            QVector3D(0.77563,0.47871,0.90771),
-            QVector3D(0.77359,0.47395,0.90724),
-            QVector3D(0.77155,0.46919,0.90678),
-            QVector3D(0.7695,0.46441,0.90631),
-            QVector3D(0.76744,0.45961,0.90584),
-            QVector3D(0.76538,0.45481,0.90536),
-            QVector3D(0.76329,0.44999,0.90489),
-            QVector3D(0.76121,0.44516,0.90441),
-            QVector3D(0.75912,0.44031,0.90393),
-            QVector3D(0.75702,0.43546,0.90345),
-            QVector3D(0.75491,0.43057,0.90297),
-            QVector3D(0.75278,0.42568,0.90248),
-            QVector3D(0.75066,0.42076,0.90199),
-            QVector3D(0.74852,0.41584,0.9015),
-            QVector3D(0.74638,0.4109,0.90101),
-            QVector3D(0.74423,0.40594,0.90052),
-            QVector3D(0.74206,0.40096,0.90002),
-            QVector3D(0.7399,0.39595,0.89953),
-            QVector3D(0.73771,0.39092,0.89903),
-            QVector3D(0.73552,0.38586,0.89853),
-            QVector3D(0.73333,0.3808,0.89802),
-            QVector3D(0.73112,0.37569,0.89752),
-            QVector3D(0.7289,0.37056,0.89702),
-            QVector3D(0.72668,0.36542,0.89651),
-            QVector3D(0.72444,0.36023,0.896),
-            QVector3D(0.72219,0.35504,0.89548),
-            QVector3D(0.71995,0.34979,0.89497)
-        },
-        {
-            QVector3D(0.21566,0.71777,0.92594),
-            QVector3D(0.21805,0.71808,0.92254),
-            QVector3D(0.2204,0.71839,0.91913),
-            QVector3D(0.22272,0.7187,0.91573),
-            QVector3D(0.22499,0.71901,0.91232),
-            QVector3D(0.22727,0.71931,0.90891),
-            QVector3D(0.2295,0.71962,0.9055),
-            QVector3D(0.23174,0.71992,0.90208),
-            QVector3D(0.23392,0.72022,0.89866),
-            QVector3D(0.23611,0.72051,0.89524),
-            QVector3D(0.23825,0.72081,0.89181),
-            QVector3D(0.24038,0.7211,0.88838),
-            QVector3D(0.2425,0.72139,0.88495),
-            QVector3D(0.2446,0.72168,0.88151),
-            QVector3D(0.24668,0.72196,0.87807),
-            QVector3D(0.24877,0.72225,0.87462),
-            QVector3D(0.25081,0.72253,0.87117),
-            QVector3D(0.25284,0.72281,0.86772),
-            QVector3D(0.25488,0.72309,0.86426),
-            QVector3D(0.25687,0.72336,0.8608),
-            QVector3D(0.25887,0.72363,0.85734),
-            QVector3D(0.26085,0.7239,0.85387),
-            QVector3D(0.26281,0.72417,0.8504),
-            QVector3D(0.26477,0.72444,0.84692),
-            QVector3D(0.26672,0.7247,0.84344),
-            QVector3D(0.26866,0.72496,0.83996),
-            QVector3D(0.27061,0.72522,0.83647),
-            QVector3D(0.2725,0.72548,0.83297),
-            QVector3D(0.27442,0.72573,0.82948),
-            QVector3D(0.27635,0.72598,0.82598),
-            QVector3D(0.27824,0.72622,0.82247),
-            QVector3D(0.28012,0.72647,0.81896),
-            QVector3D(0.28203,0.72671,0.81545),
-            QVector3D(0.28389,0.72694,0.81193),
-            QVector3D(0.28576,0.72718,0.8084),
-            QVector3D(0.28764,0.72741,0.80487),
-            QVector3D(0.28953,0.72764,0.80134),
-            QVector3D(0.2914,0.72787,0.7978),
-            QVector3D(0.29325,0.72809,0.79426),
-            QVector3D(0.29511,0.72831,0.79071),
-            QVector3D(0.29699,0.72853,0.78716),
-            QVector3D(0.29885,0.72875,0.7836),
-            QVector3D(0.3007,0.72896,0.78003),
-            QVector3D(0.30255,0.72917,0.77647),
-            QVector3D(0.30443,0.72937,0.77289),
-            QVector3D(0.30631,0.72958,0.76931),
-            QVector3D(0.30815,0.72978,0.76573),
-            QVector3D(0.31004,0.72997,0.76213),
-            QVector3D(0.31189,0.73016,0.75854),
-            QVector3D(0.31378,0.73035,0.75494),
-            QVector3D(0.31565,0.73053,0.75133),
-            QVector3D(0.31753,0.73071,0.74772),
-            QVector3D(0.31943,0.73089,0.74409),
-            QVector3D(0.32131,0.73106,0.74047),
-            QVector3D(0.32321,0.73123,0.73684),
-            QVector3D(0.32511,0.7314,0.7332),
-            QVector3D(0.32703,0.73156,0.72956),
-            QVector3D(0.32897,0.73172,0.72591),
-            QVector3D(0.33088,0.73187,0.72225),
-            QVector3D(0.33284,0.73202,0.71859),
-            QVector3D(0.33479,0.73217,0.71492),
-            QVector3D(0.33674,0.73231,0.71125),
-            QVector3D(0.33871,0.73244,0.70756),
-            QVector3D(0.34069,0.73257,0.70388),
-            QVector3D(0.34269,0.7327,0.70018),
-            QVector3D(0.34469,0.73282,0.69648),
-            QVector3D(0.34672,0.73293,0.69278),
-            QVector3D(0.34875,0.73304,0.68906),
-            QVector3D(0.35081,0.73315,0.68534),
-            QVector3D(0.35286,0.73325,0.68161),
-            QVector3D(0.35496,0.73334,0.67788),
-            QVector3D(0.35706,0.73343,0.67413),
-            QVector3D(0.35916,0.73351,0.67039),
-            QVector3D(0.3613,0.73359,0.66663),
-            QVector3D(0.36345,0.73366,0.66287),
-            QVector3D(0.36562,0.73373,0.6591),
-            QVector3D(0.36781,0.73379,0.65532),
-            QVector3D(0.37003,0.73384,0.65155),
-            QVector3D(0.37227,0.73388,0.64775),
-            QVector3D(0.37454,0.73392,0.64396),
-            QVector3D(0.37683,0.73395,0.64016),
-            QVector3D(0.37914,0.73398,0.63635),
-            QVector3D(0.38148,0.73399,0.63254),
-            QVector3D(0.38384,0.734,0.62872),
-            QVector3D(0.38622,0.734,0.62489),
-            QVector3D(0.38865,0.734,0.62106),
-            QVector3D(0.3911,0.73398,0.61722),
-            QVector3D(0.39357,0.73396,0.61337),
-            QVector3D(0.39609,0.73392,0.60953),
-            QVector3D(0.39863,0.73388,0.60567),
-            QVector3D(0.40121,0.73383,0.60181),
-            QVector3D(0.40382,0.73377,0.59795),
-            QVector3D(0.40646,0.7337,0.59409),
-            QVector3D(0.40914,0.73361,0.59021),
-            QVector3D(0.41186,0.73352,0.58635),
-            QVector3D(0.41461,0.73342,0.58247),
-            QVector3D(0.41741,0.7333,0.5786),
-            QVector3D(0.42024,0.73318,0.57472),
-            QVector3D(0.4231,0.73304,0.57084),
-            QVector3D(0.42602,0.73289,0.56698),
-            QVector3D(0.42898,0.73273,0.5631),
-            QVector3D(0.43199,0.73255,0.55923),
-            QVector3D(0.43504,0.73236,0.55536),
-            QVector3D(0.43813,0.73216,0.5515),
-            QVector3D(0.44125,0.73194,0.54764),
-            QVector3D(0.44444,0.73171,0.54379),
-            QVector3D(0.44765,0.73146,0.53995),
-            QVector3D(0.45093,0.73119,0.53612),
-            QVector3D(0.45426,0.73092,0.53231),
-            QVector3D(0.45762,0.73062,0.5285),
-            QVector3D(0.46104,0.73032,0.52471),
-            QVector3D(0.46451,0.72999,0.52094),
-            QVector3D(0.468,0.72965,0.51719),
-            QVector3D(0.47157,0.72928,0.51346),
-            QVector3D(0.47518,0.7289,0.50975),
-            QVector3D(0.47882,0.7285,0.50606),
-            QVector3D(0.48251,0.72809,0.50241),
-            QVector3D(0.48625,0.72766,0.49879),
-            QVector3D(0.49004,0.7272,0.4952),
-            QVector3D(0.49386,0.72673,0.49165),
-            QVector3D(0.49773,0.72625,0.48813),
-            QVector3D(0.50164,0.72574,0.48464),
-            QVector3D(0.50557,0.72521,0.48121),
-            QVector3D(0.50955,0.72466,0.47782),
-            QVector3D(0.51357,0.72409,0.47449),
-            QVector3D(0.51761,0.72351,0.4712),
-            QVector3D(0.52167,0.7229,0.46795),
-            QVector3D(0.52578,0.72228,0.46477),
-            QVector3D(0.5299,0.72164,0.46164),
-            QVector3D(0.53404,0.72098,0.45857),
-            QVector3D(0.53822,0.7203,0.45556),
-            QVector3D(0.5424,0.71961,0.45262),
-            QVector3D(0.5466,0.7189,0.44973),
-            QVector3D(0.55081,0.71817,0.4469),
-            QVector3D(0.55503,0.71743,0.44415),
-            QVector3D(0.55926,0.71667,0.44145),
-            QVector3D(0.5635,0.71589,0.43882),
-            QVector3D(0.56773,0.71509,0.43627),
-            QVector3D(0.57197,0.71428,0.43376),
-            QVector3D(0.57622,0.71346,0.43134),
-            QVector3D(0.58045,0.71262,0.42898),
-            QVector3D(0.58468,0.71178,0.42669),
-            QVector3D(0.5889,0.71092,0.42445),
-            QVector3D(0.59311,0.71004,0.42224),
-            QVector3D(0.5973,0.70917,0.42009),
-            QVector3D(0.60146,0.70828,0.41796),
-            QVector3D(0.60561,0.70738,0.41587),
-            QVector3D(0.60975,0.70647,0.41382),
-            QVector3D(0.61386,0.70556,0.4118),
-            QVector3D(0.61796,0.70463,0.40983),
-            QVector3D(0.62204,0.7037,0.40789),
-            QVector3D(0.62612,0.70276,0.406),
-            QVector3D(0.63017,0.70181,0.40413),
-            QVector3D(0.63421,0.70085,0.4023),
-            QVector3D(0.63822,0.69988,0.40055),
-            QVector3D(0.64223,0.69891,0.3988),
-            QVector3D(0.64621,0.69792,0.39711),
-            QVector3D(0.65019,0.69693,0.39547),
-            QVector3D(0.65415,0.69593,0.39385),
-            QVector3D(0.65809,0.69492,0.39229),
-            QVector3D(0.66202,0.6939,0.39078),
-            QVector3D(0.66593,0.69288,0.3893),
-            QVector3D(0.66983,0.69184,0.38787),
-            QVector3D(0.67371,0.69079,0.38648),
-            QVector3D(0.67758,0.68974,0.38515),
-            QVector3D(0.68143,0.68868,0.38386),
-            QVector3D(0.68527,0.6876,0.38261),
-            QVector3D(0.6891,0.68652,0.38142),
-            QVector3D(0.69291,0.68544,0.38026),
-            QVector3D(0.6967,0.68433,0.37915),
-            QVector3D(0.70047,0.68324,0.37809),
-            QVector3D(0.70424,0.68212,0.37708),
-            QVector3D(0.70798,0.681,0.37611),
-            QVector3D(0.71172,0.67987,0.37518),
-            QVector3D(0.71544,0.67874,0.37432),
-            QVector3D(0.71914,0.6776,0.37349),
-            QVector3D(0.72282,0.67644,0.37271),
-            QVector3D(0.7265,0.67528,0.37197),
-            QVector3D(0.73016,0.67411,0.37128),
-            QVector3D(0.7338,0.67294,0.37065),
-            QVector3D(0.73742,0.67175,0.37006),
-            QVector3D(0.74103,0.67057,0.36951),
-            QVector3D(0.74462,0.66937,0.36902),
-            QVector3D(0.74821,0.66816,0.36856),
-            QVector3D(0.75177,0.66694,0.36815),
-            QVector3D(0.75531,0.66573,0.36778),
-            QVector3D(0.75884,0.6645,0.36746),
-            QVector3D(0.76236,0.66327,0.36719),
-            QVector3D(0.76586,0.66203,0.36696),
-            QVector3D(0.76934,0.66077,0.36678),
-            QVector3D(0.77281,0.65952,0.36664),
-            QVector3D(0.77626,0.65826,0.36654),
-            QVector3D(0.7797,0.65699,0.36649),
-            QVector3D(0.78312,0.65572,0.36647),
-            QVector3D(0.78653,0.65443,0.3665),
-            QVector3D(0.78991,0.65314,0.36657),
-            QVector3D(0.79329,0.65185,0.36668),
-            QVector3D(0.79664,0.65055,0.36682),
-            QVector3D(0.79999,0.64925,0.36701),
-            QVector3D(0.80331,0.64792,0.36723),
-            QVector3D(0.80662,0.64661,0.3675),
-            QVector3D(0.80991,0.64528,0.36781),
-            QVector3D(0.81318,0.64395,0.36816),
-            QVector3D(0.81645,0.64261,0.36854),
-            QVector3D(0.81969,0.64126,0.36896),
-            QVector3D(0.82293,0.63992,0.36941),
-            QVector3D(0.82614,0.63856,0.36989),
-            QVector3D(0.82935,0.6372,0.37041),
-            QVector3D(0.83253,0.63583,0.37097),
-            QVector3D(0.8357,0.63446,0.37156),
-            QVector3D(0.83885,0.63308,0.37219),
-            QVector3D(0.84199,0.63169,0.37285),
-            QVector3D(0.84511,0.6303,0.37355),
-            QVector3D(0.84822,0.6289,0.37427),
-            QVector3D(0.85131,0.6275,0.37502),
-            QVector3D(0.85439,0.62609,0.3758),
-            QVector3D(0.85745,0.62468,0.37663),
-            QVector3D(0.86051,0.62326,0.37746),
-            QVector3D(0.86354,0.62183,0.37833),
-            QVector3D(0.86656,0.62041,0.37923),
-            QVector3D(0.86956,0.61897,0.38016),
-            QVector3D(0.87256,0.61752,0.38112),
-            QVector3D(0.87554,0.61607,0.38209),
-            QVector3D(0.8785,0.61462,0.38312),
-            QVector3D(0.88145,0.61316,0.38414),
-            QVector3D(0.88438,0.6117,0.3852),
-            QVector3D(0.8873,0.61023,0.38628),
-            QVector3D(0.89021,0.60876,0.3874),
-            QVector3D(0.8931,0.60728,0.38854),
-            QVector3D(0.89598,0.60578,0.38969),
-            QVector3D(0.89885,0.60429,0.39088),
-            QVector3D(0.9017,0.60279,0.39208),
-            QVector3D(0.90454,0.60128,0.3933),
-            QVector3D(0.90737,0.59978,0.39455),
-            QVector3D(0.91018,0.59826,0.39583),
-            QVector3D(0.91298,0.59674,0.3971),
-            QVector3D(0.91577,0.59521,0.39842),
-            QVector3D(0.91854,0.59368,0.39974),
-            QVector3D(0.92131,0.59215,0.40111),
-            QVector3D(0.92406,0.59059,0.40246),
-            QVector3D(0.92679,0.58904,0.40386),
-            QVector3D(0.92952,0.58748,0.40527),
-            QVector3D(0.93223,0.58593,0.40669),
-            QVector3D(0.93493,0.58436,0.40813),
-            QVector3D(0.93763,0.58278,0.4096),
-            QVector3D(0.9403,0.5812,0.41108),
-            QVector3D(0.94297,0.57962,0.41258),
-            QVector3D(0.94562,0.57802,0.41408),
-            QVector3D(0.94826,0.57644,0.41561),
-            QVector3D(0.95089,0.57482,0.41716),
-            QVector3D(0.95351,0.57322,0.41871),
-            QVector3D(0.95612,0.57159,0.42029),
-            QVector3D(0.95872,0.56997,0.42188),
-            QVector3D(0.9613,0.56834,0.42348),
-            QVector3D(0.96388,0.56671,0.42511),
-            QVector3D(0.96644,0.56505,0.42674)
-        },
-        {
-            QVector3D(0.078311,0.7275,0.90055),
-            QVector3D(0.096546,0.72692,0.9011),
-            QVector3D(0.11226,0.72635,0.90165),
-            QVector3D(0.12614,0.72577,0.9022),
-            QVector3D(0.13869,0.72519,0.90275),
-            QVector3D(0.15028,0.72461,0.90329),
-            QVector3D(0.16105,0.72402,0.90382),
-            QVector3D(0.17113,0.72343,0.90436),
-            QVector3D(0.18067,0.72284,0.90489),
-            QVector3D(0.18976,0.72225,0.90541),
-            QVector3D(0.19841,0.72165,0.90593),
-            QVector3D(0.20674,0.72106,0.90644),
-            QVector3D(0.2147,0.72046,0.90695),
-            QVector3D(0.2224,0.71986,0.90745),
-            QVector3D(0.22982,0.71926,0.90795),
-            QVector3D(0.23706,0.71865,0.90845),
-            QVector3D(0.24402,0.71804,0.90894),
-            QVector3D(0.25084,0.71744,0.90942),
-            QVector3D(0.25746,0.71682,0.9099),
-            QVector3D(0.26394,0.71621,0.91038),
-            QVector3D(0.27024,0.71559,0.91085),
-            QVector3D(0.27641,0.71496,0.91131),
-            QVector3D(0.28246,0.71434,0.91177),
-            QVector3D(0.28836,0.71372,0.91222),
-            QVector3D(0.29415,0.71309,0.91267),
-            QVector3D(0.29986,0.71246,0.91312),
-            QVector3D(0.30546,0.71183,0.91356),
-            QVector3D(0.31096,0.71119,0.91399),
-            QVector3D(0.31637,0.71055,0.91441),
-            QVector3D(0.32169,0.70991,0.91483),
-            QVector3D(0.32693,0.70927,0.91524),
-            QVector3D(0.33212,0.70863,0.91565),
-            QVector3D(0.33721,0.70797,0.91605),
-            QVector3D(0.34224,0.70732,0.91645),
-            QVector3D(0.34721,0.70668,0.91684),
-            QVector3D(0.3521,0.70602,0.91723),
-            QVector3D(0.35696,0.70536,0.91761),
-            QVector3D(0.36174,0.70469,0.91797),
-            QVector3D(0.36648,0.70403,0.91834),
-            QVector3D(0.37114,0.70336,0.91869),
-            QVector3D(0.37578,0.70269,0.91904),
-            QVector3D(0.38037,0.70202,0.91938),
-            QVector3D(0.3849,0.70134,0.91972),
-            QVector3D(0.3894,0.70067,0.92005),
-            QVector3D(0.39385,0.69998,0.92037),
-            QVector3D(0.39827,0.6993,0.92068),
-            QVector3D(0.40264,0.69861,0.92099),
-            QVector3D(0.40698,0.69792,0.92129),
-            QVector3D(0.41129,0.69723,0.92158),
-            QVector3D(0.41555,0.69654,0.92187),
-            QVector3D(0.41979,0.69584,0.92214),
-            QVector3D(0.42399,0.69514,0.92241),
-            QVector3D(0.42817,0.69443,0.92267),
-            QVector3D(0.43232,0.69372,0.92292),
-            QVector3D(0.43643,0.69302,0.92316),
-            QVector3D(0.44051,0.69231,0.92339),
-            QVector3D(0.44458,0.69158,0.92362),
-            QVector3D(0.44861,0.69086,0.92383),
-            QVector3D(0.45263,0.69014,0.92403),
-            QVector3D(0.4566,0.68942,0.92423),
-            QVector3D(0.46056,0.68869,0.92441),
-            QVector3D(0.46452,0.68796,0.92459),
-            QVector3D(0.46843,0.68722,0.92475),
-            QVector3D(0.47233,0.68648,0.92491),
-            QVector3D(0.47621,0.68574,0.92505),
-            QVector3D(0.48007,0.685,0.92519),
-            QVector3D(0.4839,0.68424,0.92531),
-            QVector3D(0.48774,0.6835,0.92543),
-            QVector3D(0.49155,0.68274,0.92553),
-            QVector3D(0.49532,0.68198,0.92562),
-            QVector3D(0.49909,0.68122,0.9257),
-            QVector3D(0.50285,0.68045,0.92576),
-            QVector3D(0.50659,0.67969,0.92582),
-            QVector3D(0.51032,0.67892,0.92586),
-            QVector3D(0.51404,0.67815,0.92589),
-            QVector3D(0.51773,0.67737,0.9259),
-            QVector3D(0.52141,0.67659,0.92591),
-            QVector3D(0.52509,0.6758,0.92589),
-            QVector3D(0.52875,0.67501,0.92587),
-            QVector3D(0.5324,0.67422,0.92583),
-            QVector3D(0.53603,0.67343,0.92578),
-            QVector3D(0.53965,0.67264,0.92571),
-            QVector3D(0.54327,0.67183,0.92562),
-            QVector3D(0.54687,0.67103,0.92552),
-            QVector3D(0.55046,0.67022,0.92541),
-            QVector3D(0.55405,0.66941,0.92527),
-            QVector3D(0.55762,0.66859,0.92513),
-            QVector3D(0.56118,0.66778,0.92496),
-            QVector3D(0.56474,0.66695,0.92478),
-            QVector3D(0.56828,0.66613,0.92458),
-            QVector3D(0.57183,0.6653,0.92436),
-            QVector3D(0.57536,0.66447,0.92412),
-            QVector3D(0.57888,0.66364,0.92387),
-            QVector3D(0.58239,0.6628,0.92359),
-            QVector3D(0.58591,0.66196,0.92329),
-            QVector3D(0.5894,0.66111,0.92298),
-            QVector3D(0.5929,0.66026,0.92264),
-            QVector3D(0.59638,0.65941,0.92228),
-            QVector3D(0.59986,0.65856,0.92189),
-            QVector3D(0.60333,0.65771,0.92149),
-            QVector3D(0.6068,0.65685,0.92106),
-            QVector3D(0.61025,0.65599,0.9206),
-            QVector3D(0.6137,0.65512,0.92013),
-            QVector3D(0.61716,0.65425,0.91962),
-            QVector3D(0.6206,0.65338,0.91909),
-            QVector3D(0.62403,0.65251,0.91854),
-            QVector3D(0.62745,0.65164,0.91796),
-            QVector3D(0.63088,0.65076,0.91735),
-            QVector3D(0.63429,0.64989,0.91671),
-            QVector3D(0.63769,0.64901,0.91604),
-            QVector3D(0.64108,0.64812,0.91534),
-            QVector3D(0.64447,0.64724,0.91461),
-            QVector3D(0.64785,0.64636,0.91385),
-            QVector3D(0.65123,0.64547,0.91306),
-            QVector3D(0.65459,0.64458,0.91223),
-            QVector3D(0.65795,0.6437,0.91137),
-            QVector3D(0.66129,0.64282,0.91048),
-            QVector3D(0.66462,0.64193,0.90955),
-            QVector3D(0.66796,0.64104,0.90858),
-            QVector3D(0.67126,0.64017,0.90758),
-            QVector3D(0.67456,0.63928,0.90654),
-            QVector3D(0.67785,0.6384,0.90546),
-            QVector3D(0.68111,0.63753,0.90434),
-            QVector3D(0.68437,0.63666,0.90319),
-            QVector3D(0.68761,0.63578,0.90199),
-            QVector3D(0.69083,0.63491,0.90077),
-            QVector3D(0.69404,0.63405,0.89953),
-            QVector3D(0.69723,0.63317,0.89826),
-            QVector3D(0.7004,0.63231,0.89698),
-            QVector3D(0.70355,0.63144,0.89567),
-            QVector3D(0.70668,0.63058,0.89435),
-            QVector3D(0.70979,0.62971,0.89301),
-            QVector3D(0.71288,0.62885,0.89165),
-            QVector3D(0.71597,0.62799,0.89028),
-            QVector3D(0.71902,0.62713,0.88889),
-            QVector3D(0.72206,0.62627,0.88748),
-            QVector3D(0.72509,0.62541,0.88607),
-            QVector3D(0.72809,0.62455,0.88463),
-            QVector3D(0.73108,0.6237,0.88318),
-            QVector3D(0.73405,0.62284,0.88173),
-            QVector3D(0.737,0.62198,0.88025),
-            QVector3D(0.73994,0.62113,0.87877),
-            QVector3D(0.74285,0.62028,0.87728),
-            QVector3D(0.74575,0.61942,0.87577),
-            QVector3D(0.74863,0.61857,0.87426),
-            QVector3D(0.7515,0.61771,0.87273),
-            QVector3D(0.75435,0.61686,0.8712),
-            QVector3D(0.75718,0.61601,0.86965),
-            QVector3D(0.75999,0.61515,0.8681),
-            QVector3D(0.76279,0.6143,0.86653),
-            QVector3D(0.76558,0.61345,0.86496),
-            QVector3D(0.76834,0.6126,0.86339),
-            QVector3D(0.7711,0.61175,0.8618),
-            QVector3D(0.77383,0.6109,0.8602),
-            QVector3D(0.77656,0.61005,0.8586),
-            QVector3D(0.77926,0.6092,0.85699),
-            QVector3D(0.78195,0.60835,0.85538),
-            QVector3D(0.78463,0.6075,0.85375),
-            QVector3D(0.78729,0.60665,0.85212),
-            QVector3D(0.78993,0.60579,0.85048),
-            QVector3D(0.79257,0.60495,0.84884),
-            QVector3D(0.79518,0.6041,0.84719),
-            QVector3D(0.79779,0.60325,0.84554),
-            QVector3D(0.80038,0.6024,0.84387),
-            QVector3D(0.80295,0.60155,0.84221),
-            QVector3D(0.80551,0.6007,0.84054),
-            QVector3D(0.80806,0.59985,0.83886),
-            QVector3D(0.8106,0.599,0.83718),
-            QVector3D(0.81312,0.59814,0.83549),
-            QVector3D(0.81563,0.5973,0.83381),
-            QVector3D(0.81812,0.59644,0.83211),
-            QVector3D(0.82061,0.59559,0.83041),
-            QVector3D(0.82308,0.59474,0.8287),
-            QVector3D(0.82554,0.59389,0.82699),
-            QVector3D(0.82798,0.59304,0.82528),
-            QVector3D(0.83042,0.59219,0.82356),
-            QVector3D(0.83284,0.59133,0.82184),
-            QVector3D(0.83525,0.59047,0.82011),
-            QVector3D(0.83765,0.58962,0.81838),
-            QVector3D(0.84003,0.58876,0.81665),
-            QVector3D(0.84241,0.58791,0.81491),
-            QVector3D(0.84477,0.58705,0.81317),
-            QVector3D(0.84712,0.5862,0.81143),
-            QVector3D(0.84946,0.58535,0.80968),
-            QVector3D(0.85179,0.58449,0.80793),
-            QVector3D(0.8541,0.58363,0.80617),
-            QVector3D(0.85641,0.58277,0.80442),
-            QVector3D(0.85871,0.58191,0.80265),
-            QVector3D(0.86099,0.58105,0.80089),
-            QVector3D(0.86327,0.5802,0.79913),
-            QVector3D(0.86553,0.57934,0.79735),
-            QVector3D(0.86779,0.57847,0.79558),
-            QVector3D(0.87002,0.57761,0.79381),
-            QVector3D(0.87226,0.57675,0.79203),
-            QVector3D(0.87448,0.57589,0.79025),
-            QVector3D(0.87669,0.57502,0.78847),
-            QVector3D(0.8789,0.57415,0.78668),
-            QVector3D(0.88109,0.57329,0.78489),
-            QVector3D(0.88328,0.57243,0.7831),
-            QVector3D(0.88545,0.57155,0.78131),
-            QVector3D(0.88761,0.57068,0.77951),
-            QVector3D(0.88977,0.56981,0.77772),
-            QVector3D(0.89192,0.56895,0.77591),
-            QVector3D(0.89405,0.56808,0.77411),
-            QVector3D(0.89618,0.56721,0.77231),
-            QVector3D(0.8983,0.56634,0.7705),
-            QVector3D(0.90041,0.56546,0.76869),
-            QVector3D(0.90251,0.56459,0.76688),
-            QVector3D(0.9046,0.56372,0.76507),
-            QVector3D(0.90668,0.56284,0.76325),
-            QVector3D(0.90876,0.56197,0.76143),
-            QVector3D(0.91082,0.56108,0.75961),
-            QVector3D(0.91288,0.56021,0.7578),
-            QVector3D(0.91493,0.55932,0.75597),
-            QVector3D(0.91697,0.55844,0.75415),
-            QVector3D(0.91899,0.55756,0.75232),
-            QVector3D(0.92102,0.55668,0.7505),
-            QVector3D(0.92304,0.55579,0.74866),
-            QVector3D(0.92504,0.55491,0.74683),
-            QVector3D(0.92704,0.55402,0.745),
-            QVector3D(0.92903,0.55313,0.74317),
-            QVector3D(0.93102,0.55225,0.74133),
-            QVector3D(0.93299,0.55136,0.7395),
-            QVector3D(0.93496,0.55047,0.73765),
-            QVector3D(0.93692,0.54957,0.73581),
-            QVector3D(0.93887,0.54869,0.73397),
-            QVector3D(0.94082,0.54779,0.73213),
-            QVector3D(0.94276,0.54689,0.73028),
-            QVector3D(0.94469,0.546,0.72843),
-            QVector3D(0.94661,0.5451,0.72659),
-            QVector3D(0.94852,0.54419,0.72474),
-            QVector3D(0.95043,0.5433,0.72288),
-            QVector3D(0.95233,0.54239,0.72103),
-            QVector3D(0.95423,0.54148,0.71918),
-            QVector3D(0.95611,0.54058,0.71733),
-            QVector3D(0.95799,0.53967,0.71548),
-            QVector3D(0.95986,0.53878,0.71361),
-            QVector3D(0.96173,0.53787,0.71176),
-            QVector3D(0.96359,0.53696,0.7099),
-            QVector3D(0.96544,0.53604,0.70804),
-            QVector3D(0.96729,0.53513,0.70618),
-            QVector3D(0.96912,0.53421,0.70431),
-            QVector3D(0.97096,0.53329,0.70245),
-            QVector3D(0.97278,0.53238,0.70058),
-            QVector3D(0.9746,0.53146,0.69871),
-            QVector3D(0.97641,0.53054,0.69685),
-            QVector3D(0.97822,0.52962,0.69498),
-            QVector3D(0.98002,0.5287,0.69311),
-            QVector3D(0.98181,0.52777,0.69124),
-            QVector3D(0.9836,0.52685,0.68937),
-            QVector3D(0.98538,0.52592,0.6875),
-            QVector3D(0.98716,0.52499,0.68563),
-            QVector3D(0.98892,0.52406,0.68375),
-            QVector3D(0.99069,0.52313,0.68187),
-            QVector3D(0.99244,0.52218,0.67999),
-            QVector3D(0.99419,0.52125,0.67812)
-        },
-        {
-            QVector3D(0.10261,0,0.52493),
-            QVector3D(0.10283,0,0.53197),
-            QVector3D(0.10301,0,0.53902),
-            QVector3D(0.10318,0.0009426,0.54604),
-            QVector3D(0.10333,0.0032938,0.55302),
-            QVector3D(0.10346,0.0057773,0.56),
-            QVector3D(0.10358,0.0084209,0.56694),
-            QVector3D(0.10367,0.01129,0.57386),
-            QVector3D(0.10377,0.014338,0.58073),
-            QVector3D(0.10383,0.017402,0.5876),
-            QVector3D(0.1039,0.020685,0.59441),
-            QVector3D(0.10395,0.024094,0.60121),
-            QVector3D(0.10399,0.027709,0.60797),
-            QVector3D(0.10402,0.031481,0.61469),
-            QVector3D(0.10405,0.035677,0.62137),
-            QVector3D(0.10407,0.039812,0.62802),
-            QVector3D(0.10409,0.043972,0.63463),
-            QVector3D(0.1041,0.048145,0.64118),
-            QVector3D(0.10411,0.052249,0.64771),
-            QVector3D(0.10412,0.056438,0.65417),
-            QVector3D(0.10412,0.060474,0.66061),
-            QVector3D(0.10414,0.064518,0.66698),
-            QVector3D(0.10414,0.068586,0.67332),
-            QVector3D(0.10416,0.072559,0.67957),
-            QVector3D(0.10417,0.076535,0.68581),
-            QVector3D(0.1042,0.080591,0.69196),
-            QVector3D(0.10423,0.084636,0.69806),
-            QVector3D(0.10427,0.088643,0.7041),
-            QVector3D(0.10432,0.092635,0.71007),
-            QVector3D(0.10438,0.096648,0.71599),
-            QVector3D(0.10445,0.10074,0.72181),
-            QVector3D(0.10454,0.10477,0.72759),
-            QVector3D(0.10466,0.1089,0.73327),
-            QVector3D(0.10478,0.11303,0.73891),
-            QVector3D(0.10495,0.11711,0.74441),
-            QVector3D(0.10512,0.12123,0.74987),
-            QVector3D(0.10534,0.12546,0.75522),
-            QVector3D(0.10558,0.12966,0.76048),
-            QVector3D(0.10584,0.13388,0.76566),
-            QVector3D(0.10615,0.13816,0.77071),
-            QVector3D(0.10646,0.14242,0.77569),
-            QVector3D(0.10681,0.14674,0.78053),
-            QVector3D(0.10717,0.15111,0.78527),
-            QVector3D(0.10755,0.15551,0.7899),
-            QVector3D(0.10798,0.15993,0.79438),
-            QVector3D(0.10845,0.16445,0.79875),
-            QVector3D(0.10901,0.16898,0.80298),
-            QVector3D(0.10961,0.17353,0.80705),
-            QVector3D(0.1102,0.17818,0.81099),
-            QVector3D(0.11082,0.1828,0.81477),
-            QVector3D(0.1115,0.18758,0.81836),
-            QVector3D(0.11222,0.19233,0.82179),
-            QVector3D(0.11298,0.19716,0.82505),
-            QVector3D(0.11375,0.20204,0.82808),
-            QVector3D(0.11454,0.20704,0.83091),
-            QVector3D(0.11544,0.21207,0.83352),
-            QVector3D(0.11636,0.21715,0.83593),
-            QVector3D(0.11726,0.22231,0.83805),
-            QVector3D(0.11827,0.22758,0.83989),
-            QVector3D(0.11923,0.23291,0.84144),
-            QVector3D(0.12022,0.23833,0.84271),
-            QVector3D(0.12122,0.24384,0.84364),
-            QVector3D(0.12223,0.24946,0.84423),
-            QVector3D(0.12325,0.2552,0.84442),
-            QVector3D(0.12427,0.26103,0.84418),
-            QVector3D(0.12527,0.26698,0.84347),
-            QVector3D(0.12622,0.2731,0.84224),
-            QVector3D(0.12705,0.27937,0.84043),
-            QVector3D(0.12787,0.28578,0.83797),
-            QVector3D(0.12853,0.2924,0.83479),
-            QVector3D(0.129,0.29923,0.8308),
-            QVector3D(0.12928,0.30627,0.82589),
-            QVector3D(0.12926,0.31358,0.81986),
-            QVector3D(0.12882,0.3212,0.8125),
-            QVector3D(0.12785,0.32922,0.80355),
-            QVector3D(0.12621,0.33765,0.79274),
-            QVector3D(0.1245,0.34613,0.78084),
-            QVector3D(0.12367,0.35431,0.76889),
-            QVector3D(0.12366,0.36214,0.75705),
-            QVector3D(0.12444,0.36966,0.74532),
-            QVector3D(0.12594,0.37693,0.7337),
-            QVector3D(0.12792,0.38394,0.72217),
-            QVector3D(0.13044,0.39074,0.71074),
-            QVector3D(0.13327,0.39733,0.69939),
-            QVector3D(0.13642,0.40376,0.68814),
-            QVector3D(0.13984,0.41001,0.67697),
-            QVector3D(0.14348,0.41611,0.66586),
-            QVector3D(0.14722,0.42207,0.65483),
-            QVector3D(0.15108,0.42792,0.64387),
-            QVector3D(0.15499,0.43363,0.63298),
-            QVector3D(0.15896,0.43925,0.62214),
-            QVector3D(0.16291,0.44478,0.61137),
-            QVector3D(0.16687,0.4502,0.60064),
-            QVector3D(0.17081,0.45554,0.58996),
-            QVector3D(0.17471,0.4608,0.57934),
-            QVector3D(0.17858,0.46599,0.56874),
-            QVector3D(0.18239,0.47111,0.55819),
-            QVector3D(0.18617,0.47617,0.54768),
-            QVector3D(0.18985,0.48116,0.53721),
-            QVector3D(0.19353,0.4861,0.52675),
-            QVector3D(0.19713,0.491,0.51631),
-            QVector3D(0.20061,0.49582,0.50589),
-            QVector3D(0.20411,0.50061,0.4955),
-            QVector3D(0.20751,0.50535,0.48511),
-            QVector3D(0.21087,0.51006,0.47474),
-            QVector3D(0.21416,0.51473,0.46436),
-            QVector3D(0.21738,0.51936,0.45396),
-            QVector3D(0.22058,0.52395,0.44356),
-            QVector3D(0.2237,0.52851,0.43315),
-            QVector3D(0.22681,0.53303,0.42271),
-            QVector3D(0.22982,0.53753,0.41226),
-            QVector3D(0.23283,0.54198,0.40175),
-            QVector3D(0.23581,0.54643,0.39121),
-            QVector3D(0.23872,0.55083,0.38071),
-            QVector3D(0.24169,0.55518,0.37044),
-            QVector3D(0.24469,0.55949,0.3605),
-            QVector3D(0.24781,0.56374,0.35089),
-            QVector3D(0.25097,0.56793,0.34154),
-            QVector3D(0.25425,0.57208,0.33247),
-            QVector3D(0.25761,0.5762,0.32363),
-            QVector3D(0.26111,0.58025,0.31505),
-            QVector3D(0.26472,0.58427,0.3067),
-            QVector3D(0.26848,0.58825,0.29856),
-            QVector3D(0.27234,0.5922,0.29062),
-            QVector3D(0.27639,0.5961,0.28291),
-            QVector3D(0.28053,0.59996,0.27535),
-            QVector3D(0.28484,0.6038,0.26796),
-            QVector3D(0.28931,0.60759,0.26077),
-            QVector3D(0.29388,0.61135,0.25373),
-            QVector3D(0.29862,0.61508,0.24682),
-            QVector3D(0.3035,0.61878,0.24008),
-            QVector3D(0.30855,0.62243,0.23349),
-            QVector3D(0.31372,0.62607,0.22707),
-            QVector3D(0.31901,0.62967,0.22077),
-            QVector3D(0.32444,0.63324,0.21455),
-            QVector3D(0.33002,0.63679,0.20847),
-            QVector3D(0.3357,0.6403,0.20249),
-            QVector3D(0.3415,0.64378,0.19666),
-            QVector3D(0.34744,0.64724,0.1909),
-            QVector3D(0.35349,0.65066,0.18533),
-            QVector3D(0.35968,0.65406,0.17981),
-            QVector3D(0.36597,0.65744,0.17443),
-            QVector3D(0.37234,0.66078,0.16914),
-            QVector3D(0.37883,0.6641,0.16394),
-            QVector3D(0.38543,0.6674,0.15885),
-            QVector3D(0.39215,0.67066,0.15389),
-            QVector3D(0.39895,0.6739,0.14907),
-            QVector3D(0.40585,0.67712,0.14434),
-            QVector3D(0.41283,0.6803,0.13966),
-            QVector3D(0.41989,0.68346,0.13522),
-            QVector3D(0.42707,0.6866,0.1309),
-            QVector3D(0.43431,0.68971,0.12666),
-            QVector3D(0.44163,0.6928,0.12254),
-            QVector3D(0.44902,0.69586,0.11865),
-            QVector3D(0.45651,0.69888,0.11488),
-            QVector3D(0.46408,0.70188,0.11136),
-            QVector3D(0.4717,0.70487,0.1079),
-            QVector3D(0.47938,0.70783,0.10464),
-            QVector3D(0.48716,0.71076,0.10172),
-            QVector3D(0.495,0.71367,0.098964),
-            QVector3D(0.50288,0.71655,0.096355),
-            QVector3D(0.51084,0.71941,0.094134),
-            QVector3D(0.51888,0.72223,0.092156),
-            QVector3D(0.52696,0.72504,0.090393),
-            QVector3D(0.53508,0.72782,0.088892),
-            QVector3D(0.54329,0.73057,0.087819),
-            QVector3D(0.55155,0.73329,0.087005),
-            QVector3D(0.55985,0.73599,0.086399),
-            QVector3D(0.56821,0.73867,0.08621),
-            QVector3D(0.57664,0.74131,0.086387),
-            QVector3D(0.5851,0.74394,0.086866),
-            QVector3D(0.59361,0.74654,0.087651),
-            QVector3D(0.60218,0.74911,0.088758),
-            QVector3D(0.61075,0.75167,0.090091),
-            QVector3D(0.6193,0.75421,0.091662),
-            QVector3D(0.62776,0.75676,0.093291),
-            QVector3D(0.63618,0.7593,0.095179),
-            QVector3D(0.64452,0.76186,0.097055),
-            QVector3D(0.65279,0.76442,0.0992),
-            QVector3D(0.66101,0.76698,0.10144),
-            QVector3D(0.66917,0.76954,0.10382),
-            QVector3D(0.67726,0.77211,0.10635),
-            QVector3D(0.68528,0.77468,0.10898),
-            QVector3D(0.69324,0.77727,0.11176),
-            QVector3D(0.70115,0.77985,0.1146),
-            QVector3D(0.70899,0.78245,0.11768),
-            QVector3D(0.71675,0.78505,0.12084),
-            QVector3D(0.72446,0.78766,0.12415),
-            QVector3D(0.73211,0.79027,0.12759),
-            QVector3D(0.73969,0.7929,0.13116),
-            QVector3D(0.74719,0.79554,0.13488),
-            QVector3D(0.75463,0.79819,0.13869),
-            QVector3D(0.762,0.80085,0.14265),
-            QVector3D(0.76931,0.80352,0.1467),
-            QVector3D(0.77655,0.80621,0.15091),
-            QVector3D(0.78371,0.80891,0.15527),
-            QVector3D(0.79078,0.81163,0.15974),
-            QVector3D(0.79778,0.81436,0.1644),
-            QVector3D(0.80471,0.81711,0.16917),
-            QVector3D(0.81155,0.81987,0.17404),
-            QVector3D(0.8183,0.82266,0.17908),
-            QVector3D(0.82496,0.82547,0.18425),
-            QVector3D(0.83154,0.8283,0.18958),
-            QVector3D(0.83802,0.83116,0.19506),
-            QVector3D(0.84439,0.83404,0.20068),
-            QVector3D(0.85066,0.83694,0.20653),
-            QVector3D(0.85681,0.83988,0.21248),
-            QVector3D(0.86285,0.84285,0.21864),
-            QVector3D(0.86877,0.84585,0.22495),
-            QVector3D(0.87454,0.84889,0.23152),
-            QVector3D(0.88018,0.85196,0.23823),
-            QVector3D(0.88567,0.85508,0.24516),
-            QVector3D(0.89101,0.85823,0.25235),
-            QVector3D(0.89617,0.86144,0.25975),
-            QVector3D(0.90116,0.86469,0.26737),
-            QVector3D(0.90596,0.868,0.27529),
-            QVector3D(0.91052,0.87137,0.2835),
-            QVector3D(0.91485,0.87481,0.29203),
-            QVector3D(0.91894,0.87831,0.30086),
-            QVector3D(0.92276,0.88189,0.31007),
-            QVector3D(0.92625,0.88556,0.3197),
-            QVector3D(0.92941,0.88931,0.32973),
-            QVector3D(0.93217,0.89317,0.34027),
-            QVector3D(0.93451,0.89714,0.3513),
-            QVector3D(0.93634,0.90125,0.36298),
-            QVector3D(0.93763,0.9055,0.37534),
-            QVector3D(0.9387,0.90978,0.38837),
-            QVector3D(0.93989,0.91399,0.40197),
-            QVector3D(0.94123,0.91811,0.41613),
-            QVector3D(0.94272,0.92216,0.43083),
-            QVector3D(0.94436,0.92612,0.44608),
-            QVector3D(0.94613,0.93,0.46186),
-            QVector3D(0.94803,0.9338,0.47813),
-            QVector3D(0.95005,0.93753,0.49497),
-            QVector3D(0.95218,0.94117,0.5123),
-            QVector3D(0.95441,0.94474,0.53014),
-            QVector3D(0.95674,0.94822,0.54852),
-            QVector3D(0.95915,0.95163,0.56741),
-            QVector3D(0.96162,0.95496,0.58679),
-            QVector3D(0.96415,0.95822,0.60671),
-            QVector3D(0.96673,0.96139,0.62717),
-            QVector3D(0.96934,0.96449,0.64813),
-            QVector3D(0.97196,0.96752,0.66962),
-            QVector3D(0.97459,0.97046,0.69168),
-            QVector3D(0.97722,0.97333,0.71425),
-            QVector3D(0.9798,0.97613,0.73736),
-            QVector3D(0.98235,0.97885,0.76105),
-            QVector3D(0.98483,0.98151,0.78529),
-            QVector3D(0.98722,0.98408,0.81007),
-            QVector3D(0.98952,0.98658,0.83544),
-            QVector3D(0.99169,0.98901,0.8614),
-            QVector3D(0.99371,0.99136,0.88792),
-            QVector3D(0.99556,0.99365,0.91503),
-            QVector3D(0.99723,0.99585,0.94278),
-            QVector3D(0.99867,0.99799,0.97109),
-            QVector3D(0.99986,1,1)
-        },
-        {
-            QVector3D(0,0.047803,0.4883),
-            QVector3D(0,0.049756,0.49556),
-            QVector3D(0,0.051605,0.50281),
-            QVector3D(0,0.053545,0.51004),
-            QVector3D(0,0.055585,0.51721),
-            QVector3D(0,0.057566,0.52435),
-            QVector3D(0,0.05978,0.53144),
-            QVector3D(0,0.061812,0.53849),
-            QVector3D(0,0.064016,0.5455),
-            QVector3D(0,0.066232,0.55245),
-            QVector3D(0,0.068551,0.55934),
-            QVector3D(0,0.070824,0.5662),
-            QVector3D(0,0.073229,0.57299),
-            QVector3D(0,0.07557,0.57971),
-            QVector3D(0,0.078003,0.58638),
-            QVector3D(0,0.080554,0.59299),
-            QVector3D(0,0.083114,0.59951),
-            QVector3D(0,0.085697,0.60596),
-            QVector3D(0,0.08842,0.61236),
-            QVector3D(0,0.091168,0.61866),
-            QVector3D(0,0.093925,0.62487),
-            QVector3D(0,0.096707,0.63101),
-            QVector3D(0,0.09963,0.63705),
-            QVector3D(0,0.1026,0.64298),
-            QVector3D(0,0.10561,0.64881),
-            QVector3D(0,0.10866,0.65454),
-            QVector3D(0,0.11183,0.66016),
-            QVector3D(0,0.11497,0.66567),
-            QVector3D(0,0.11829,0.67103),
-            QVector3D(0,0.12156,0.67626),
-            QVector3D(0,0.12498,0.68134),
-            QVector3D(0,0.12846,0.68629),
-            QVector3D(0,0.13201,0.69107),
-            QVector3D(0,0.13559,0.6957),
-            QVector3D(0,0.13927,0.70014),
-            QVector3D(0,0.14307,0.70439),
-            QVector3D(0,0.1469,0.70845),
-            QVector3D(0,0.15085,0.71227),
-            QVector3D(0,0.15487,0.71588),
-            QVector3D(0,0.159,0.71923),
-            QVector3D(0,0.16323,0.7223),
-            QVector3D(0,0.16754,0.7251),
-            QVector3D(0,0.17195,0.72757),
-            QVector3D(0,0.17647,0.72972),
-            QVector3D(0,0.18113,0.73149),
-            QVector3D(0,0.18594,0.73289),
-            QVector3D(0,0.19074,0.73398),
-            QVector3D(0,0.19556,0.73486),
-            QVector3D(0,0.20033,0.73556),
-            QVector3D(0,0.20512,0.73608),
-            QVector3D(0,0.20987,0.73643),
-            QVector3D(0,0.21461,0.73659),
-            QVector3D(0,0.21934,0.73657),
-            QVector3D(0,0.22402,0.73637),
-            QVector3D(0,0.22875,0.73599),
-            QVector3D(0,0.2334,0.73544),
-            QVector3D(0,0.23809,0.73469),
-            QVector3D(0,0.24275,0.73376),
-            QVector3D(0,0.24743,0.73266),
-            QVector3D(0,0.25208,0.73137),
-            QVector3D(0,0.25673,0.72991),
-            QVector3D(0,0.26137,0.72825),
-            QVector3D(0,0.26603,0.72642),
-            QVector3D(0,0.27068,0.72441),
-            QVector3D(0,0.27531,0.72221),
-            QVector3D(0,0.27995,0.71983),
-            QVector3D(0,0.28458,0.71727),
-            QVector3D(0,0.28924,0.71452),
-            QVector3D(0,0.29387,0.71161),
-            QVector3D(0,0.29852,0.70851),
-            QVector3D(0,0.30317,0.70521),
-            QVector3D(0,0.30782,0.70174),
-            QVector3D(0,0.31248,0.69809),
-            QVector3D(0,0.31716,0.69426),
-            QVector3D(0,0.32182,0.69025),
-            QVector3D(0,0.32649,0.68607),
-            QVector3D(0,0.33116,0.68178),
-            QVector3D(0,0.33582,0.67746),
-            QVector3D(0,0.34046,0.6731),
-            QVector3D(0,0.34509,0.66871),
-            QVector3D(0,0.3497,0.66429),
-            QVector3D(0,0.3543,0.65984),
-            QVector3D(0,0.35888,0.65536),
-            QVector3D(0,0.36346,0.65085),
-            QVector3D(0,0.36803,0.6463),
-            QVector3D(0,0.37258,0.64173),
-            QVector3D(0,0.37713,0.63713),
-            QVector3D(0,0.38167,0.6325),
-            QVector3D(0,0.38618,0.62783),
-            QVector3D(0,0.39071,0.62313),
-            QVector3D(0,0.39523,0.6184),
-            QVector3D(0,0.39972,0.61363),
-            QVector3D(0,0.40423,0.60885),
-            QVector3D(0,0.40872,0.60402),
-            QVector3D(0,0.41321,0.59915),
-            QVector3D(0,0.41769,0.59426),
-            QVector3D(0,0.42215,0.58932),
-            QVector3D(0,0.42663,0.58437),
-            QVector3D(0,0.4311,0.57937),
-            QVector3D(0,0.43556,0.57433),
-            QVector3D(0,0.44001,0.56926),
-            QVector3D(0,0.44446,0.56416),
-            QVector3D(0,0.44891,0.55902),
-            QVector3D(0,0.45334,0.55384),
-            QVector3D(0,0.45778,0.54863),
-            QVector3D(0,0.46222,0.54336),
-            QVector3D(0,0.46665,0.53802),
-            QVector3D(0,0.47105,0.53253),
-            QVector3D(0,0.47545,0.52691),
-            QVector3D(0,0.47982,0.52115),
-            QVector3D(0,0.48417,0.51525),
-            QVector3D(0,0.48852,0.50921),
-            QVector3D(0,0.49284,0.50301),
-            QVector3D(0,0.49717,0.49668),
-            QVector3D(0,0.50147,0.49022),
-            QVector3D(0,0.50575,0.48359),
-            QVector3D(0,0.51003,0.47682),
-            QVector3D(0,0.51431,0.4699),
-            QVector3D(0,0.51856,0.4628),
-            QVector3D(0.0097866,0.52281,0.45558),
-            QVector3D(0.023896,0.52704,0.44818),
-            QVector3D(0.038383,0.53126,0.44061),
-            QVector3D(0.051763,0.53547,0.43289),
-            QVector3D(0.063442,0.53968,0.42499),
-            QVector3D(0.073828,0.54388,0.41692),
-            QVector3D(0.083244,0.54807,0.40866),
-            QVector3D(0.092062,0.55225,0.40022),
-            QVector3D(0.10019,0.55642,0.39159),
-            QVector3D(0.10786,0.56059,0.38276),
-            QVector3D(0.11513,0.56474,0.37372),
-            QVector3D(0.12206,0.56889,0.36445),
-            QVector3D(0.12871,0.57304,0.35498),
-            QVector3D(0.13507,0.57718,0.34524),
-            QVector3D(0.14115,0.58131,0.33527),
-            QVector3D(0.14697,0.58544,0.32499),
-            QVector3D(0.15257,0.58954,0.31449),
-            QVector3D(0.15773,0.59367,0.30393),
-            QVector3D(0.16231,0.59779,0.29352),
-            QVector3D(0.16631,0.60191,0.28332),
-            QVector3D(0.16984,0.60603,0.27332),
-            QVector3D(0.17292,0.61015,0.26352),
-            QVector3D(0.17565,0.61427,0.25387),
-            QVector3D(0.17811,0.6184,0.24439),
-            QVector3D(0.18021,0.62252,0.23514),
-            QVector3D(0.18207,0.62664,0.22606),
-            QVector3D(0.18374,0.63076,0.21715),
-            QVector3D(0.18522,0.63487,0.2084),
-            QVector3D(0.18649,0.63898,0.19982),
-            QVector3D(0.18765,0.64309,0.19148),
-            QVector3D(0.18863,0.6472,0.18334),
-            QVector3D(0.18951,0.6513,0.1754),
-            QVector3D(0.19029,0.65539,0.16767),
-            QVector3D(0.19099,0.65948,0.16013),
-            QVector3D(0.19162,0.66357,0.15293),
-            QVector3D(0.19219,0.66765,0.14604),
-            QVector3D(0.19272,0.67172,0.13937),
-            QVector3D(0.1932,0.67579,0.13311),
-            QVector3D(0.19366,0.67985,0.1272),
-            QVector3D(0.1941,0.68391,0.1218),
-            QVector3D(0.19451,0.68797,0.11692),
-            QVector3D(0.1949,0.69202,0.11259),
-            QVector3D(0.19529,0.69606,0.10881),
-            QVector3D(0.19569,0.70009,0.10581),
-            QVector3D(0.19611,0.70412,0.10358),
-            QVector3D(0.19653,0.70814,0.10209),
-            QVector3D(0.19694,0.71215,0.10139),
-            QVector3D(0.19736,0.71617,0.10116),
-            QVector3D(0.19779,0.72018,0.10101),
-            QVector3D(0.19823,0.7242,0.10087),
-            QVector3D(0.19868,0.72822,0.10073),
-            QVector3D(0.19914,0.73225,0.1006),
-            QVector3D(0.19961,0.73627,0.10048),
-            QVector3D(0.20009,0.74031,0.10036),
-            QVector3D(0.20058,0.74434,0.10025),
-            QVector3D(0.20108,0.74838,0.10015),
-            QVector3D(0.20159,0.75242,0.10006),
-            QVector3D(0.20211,0.75647,0.099977),
-            QVector3D(0.20265,0.76052,0.099902),
-            QVector3D(0.2032,0.76457,0.099835),
-            QVector3D(0.20376,0.76862,0.099777),
-            QVector3D(0.20433,0.77267,0.099729),
-            QVector3D(0.20488,0.77674,0.099691),
-            QVector3D(0.20546,0.7808,0.099663),
-            QVector3D(0.20608,0.78487,0.099645),
-            QVector3D(0.20669,0.78894,0.099637),
-            QVector3D(0.20729,0.79301,0.099641),
-            QVector3D(0.20791,0.79708,0.099656),
-            QVector3D(0.20855,0.80116,0.099683),
-            QVector3D(0.2092,0.80523,0.09972),
-            QVector3D(0.20987,0.80932,0.09977),
-            QVector3D(0.21055,0.8134,0.099833),
-            QVector3D(0.21125,0.81749,0.099908),
-            QVector3D(0.21196,0.82159,0.099996),
-            QVector3D(0.21266,0.82567,0.1001),
-            QVector3D(0.2134,0.82977,0.10021),
-            QVector3D(0.21454,0.83386,0.10034),
-            QVector3D(0.21746,0.83784,0.10049),
-            QVector3D(0.22334,0.84166,0.10065),
-            QVector3D(0.23182,0.84531,0.10083),
-            QVector3D(0.24228,0.84884,0.10102),
-            QVector3D(0.25428,0.85224,0.10123),
-            QVector3D(0.26735,0.85553,0.10145),
-            QVector3D(0.28125,0.85872,0.10168),
-            QVector3D(0.29571,0.86184,0.10193),
-            QVector3D(0.31067,0.86485,0.10219),
-            QVector3D(0.32594,0.86779,0.10246),
-            QVector3D(0.34137,0.87065,0.10275),
-            QVector3D(0.35684,0.87346,0.10306),
-            QVector3D(0.3724,0.87619,0.10337),
-            QVector3D(0.38805,0.87886,0.10369),
-            QVector3D(0.40366,0.88147,0.10401),
-            QVector3D(0.41921,0.88402,0.10433),
-            QVector3D(0.43478,0.88651,0.10468),
-            QVector3D(0.45028,0.88894,0.10507),
-            QVector3D(0.4657,0.89133,0.10549),
-            QVector3D(0.48111,0.89365,0.10592),
-            QVector3D(0.49641,0.89593,0.10637),
-            QVector3D(0.51169,0.89815,0.10681),
-            QVector3D(0.52691,0.90032,0.10725),
-            QVector3D(0.54202,0.90245,0.1077),
-            QVector3D(0.55713,0.90452,0.10817),
-            QVector3D(0.57212,0.90655,0.10869),
-            QVector3D(0.5871,0.90852,0.10927),
-            QVector3D(0.60201,0.91045,0.10983),
-            QVector3D(0.61689,0.91232,0.11037),
-            QVector3D(0.63169,0.91415,0.11095),
-            QVector3D(0.64646,0.91593,0.11155),
-            QVector3D(0.66118,0.91767,0.11216),
-            QVector3D(0.67585,0.91934,0.11281),
-            QVector3D(0.69049,0.92098,0.11347),
-            QVector3D(0.70508,0.92257,0.11409),
-            QVector3D(0.71966,0.92411,0.11477),
-            QVector3D(0.73418,0.9256,0.11552),
-            QVector3D(0.74868,0.92704,0.11627),
-            QVector3D(0.76314,0.92844,0.11699),
-            QVector3D(0.77759,0.92979,0.11777),
-            QVector3D(0.79201,0.93109,0.11859),
-            QVector3D(0.8064,0.93233,0.11937),
-            QVector3D(0.82077,0.93353,0.12019),
-            QVector3D(0.83511,0.93468,0.12102),
-            QVector3D(0.84946,0.93578,0.12189),
-            QVector3D(0.86375,0.93684,0.12278),
-            QVector3D(0.87808,0.93783,0.1237),
-            QVector3D(0.89234,0.93878,0.12464),
-            QVector3D(0.90664,0.93968,0.12562),
-            QVector3D(0.92088,0.94052,0.12657),
-            QVector3D(0.93514,0.94131,0.12755),
-            QVector3D(0.94939,0.94206,0.12857),
-            QVector3D(0.9636,0.94275,0.12961),
-            QVector3D(0.97785,0.94338,0.13068),
-            QVector3D(0.99205,0.94397,0.13172),
-            QVector3D(1,0.94449,0.13281),
-            QVector3D(1,0.94497,0.13392),
-            QVector3D(1,0.94539,0.13505),
-            QVector3D(1,0.94574,0.13614),
-            QVector3D(1,0.94606,0.13735)
-        },
-        {
-            QVector3D(0,0.0024382,0.30687),
-            QVector3D(0,0.0044692,0.31437),
-            QVector3D(0,0.0062324,0.32191),
-            QVector3D(0,0.0077305,0.32951),
-            QVector3D(0,0.008958,0.33713),
-            QVector3D(0,0.0098968,0.34479),
-            QVector3D(0,0.010555,0.35249),
-            QVector3D(0,0.011009,0.36023),
-            QVector3D(0,0.01114,0.36802),
-            QVector3D(0.0018829,0.010944,0.37585),
-            QVector3D(0.0043414,0.010697,0.38371),
-            QVector3D(0.0068536,0.010463,0.39161),
-            QVector3D(0.0094655,0.010231,0.39952),
-            QVector3D(0.01235,0.0099983,0.4075),
-            QVector3D(0.015052,0.0097591,0.4155),
-            QVector3D(0.017851,0.0094983,0.42354),
-            QVector3D(0.020695,0.0092222,0.43163),
-            QVector3D(0.02357,0.0089375,0.43973),
-            QVector3D(0.026496,0.0086445,0.44787),
-            QVector3D(0.029448,0.0083501,0.45605),
-            QVector3D(0.032396,0.0080591,0.46429),
-            QVector3D(0.03558,0.0077658,0.47253),
-            QVector3D(0.038524,0.0074701,0.48082),
-            QVector3D(0.041458,0.0071848,0.48915),
-            QVector3D(0.044141,0.0069073,0.49753),
-            QVector3D(0.04679,0.0066377,0.50593),
-            QVector3D(0.04932,0.0063792,0.51438),
-            QVector3D(0.051527,0.0061442,0.52287),
-            QVector3D(0.053656,0.0059329,0.53139),
-            QVector3D(0.055683,0.0057462,0.53995),
-            QVector3D(0.057455,0.0055887,0.54857),
-            QVector3D(0.059195,0.0054661,0.55722),
-            QVector3D(0.060593,0.0053876,0.5659),
-            QVector3D(0.061766,0.0053629,0.57464),
-            QVector3D(0.062841,0.0053961,0.58343),
-            QVector3D(0.063532,0.0054935,0.59227),
-            QVector3D(0.063966,0.0056647,0.60114),
-            QVector3D(0.0641,0.0059201,0.61007),
-            QVector3D(0.063882,0.0062716,0.61907),
-            QVector3D(0.063281,0.0067326,0.6281),
-            QVector3D(0.062148,0.0073175,0.63719),
-            QVector3D(0.060493,0.0080408,0.64634),
-            QVector3D(0.058092,0.008929,0.65557),
-            QVector3D(0.055233,0.0099623,0.66482),
-            QVector3D(0.052105,0.011266,0.67402),
-            QVector3D(0.049146,0.012683,0.68314),
-            QVector3D(0.046014,0.014144,0.69216),
-            QVector3D(0.04309,0.015741,0.70108),
-            QVector3D(0.040435,0.017485,0.70992),
-            QVector3D(0.037863,0.019379,0.71866),
-            QVector3D(0.035616,0.021429,0.72731),
-            QVector3D(0.033428,0.02364,0.73587),
-            QVector3D(0.031841,0.026021,0.74433),
-            QVector3D(0.030635,0.028579,0.75268),
-            QVector3D(0.029823,0.031319,0.76095),
-            QVector3D(0.029422,0.034249,0.7691),
-            QVector3D(0.029449,0.037557,0.77717),
-            QVector3D(0.029926,0.040864,0.78513),
-            QVector3D(0.030874,0.044198,0.793),
-            QVector3D(0.032312,0.047578,0.80076),
-            QVector3D(0.034281,0.051036,0.80842),
-            QVector3D(0.036977,0.054512,0.81597),
-            QVector3D(0.040055,0.058003,0.82341),
-            QVector3D(0.043483,0.061561,0.83076),
-            QVector3D(0.047434,0.065191,0.83799),
-            QVector3D(0.051627,0.068868,0.84513),
-            QVector3D(0.056188,0.072421,0.85216),
-            QVector3D(0.060871,0.076069,0.85907),
-            QVector3D(0.065858,0.079772,0.86589),
-            QVector3D(0.071059,0.083524,0.87259),
-            QVector3D(0.07632,0.087319,0.87918),
-            QVector3D(0.081824,0.091117,0.88564),
-            QVector3D(0.087161,0.095093,0.89195),
-            QVector3D(0.092292,0.099225,0.89805),
-            QVector3D(0.097256,0.10365,0.90395),
-            QVector3D(0.10208,0.10819,0.90965),
-            QVector3D(0.10678,0.11304,0.91514),
-            QVector3D(0.11126,0.11798,0.92041),
-            QVector3D(0.11561,0.12306,0.92547),
-            QVector3D(0.11981,0.12837,0.93032),
-            QVector3D(0.12389,0.13378,0.93496),
-            QVector3D(0.12789,0.13928,0.9394),
-            QVector3D(0.13172,0.14498,0.94362),
-            QVector3D(0.13541,0.15071,0.94764),
-            QVector3D(0.13898,0.15659,0.95143),
-            QVector3D(0.14245,0.16255,0.95501),
-            QVector3D(0.14579,0.16859,0.95837),
-            QVector3D(0.14895,0.17474,0.96151),
-            QVector3D(0.15202,0.18091,0.96444),
-            QVector3D(0.15497,0.18721,0.96717),
-            QVector3D(0.15778,0.19355,0.96967),
-            QVector3D(0.16044,0.19992,0.97196),
-            QVector3D(0.16301,0.20643,0.97403),
-            QVector3D(0.16537,0.21292,0.97587),
-            QVector3D(0.16765,0.21951,0.9775),
-            QVector3D(0.16978,0.22614,0.9789),
-            QVector3D(0.17171,0.23278,0.9801),
-            QVector3D(0.17352,0.2395,0.98107),
-            QVector3D(0.17518,0.24623,0.98183),
-            QVector3D(0.17664,0.25301,0.98238),
-            QVector3D(0.17803,0.25977,0.98279),
-            QVector3D(0.17924,0.26645,0.98317),
-            QVector3D(0.18037,0.27304,0.98356),
-            QVector3D(0.18141,0.27957,0.98394),
-            QVector3D(0.18236,0.28598,0.98432),
-            QVector3D(0.18323,0.29237,0.98469),
-            QVector3D(0.18401,0.29868,0.98507),
-            QVector3D(0.1847,0.30493,0.98544),
-            QVector3D(0.1853,0.31112,0.9858),
-            QVector3D(0.1858,0.31725,0.98617),
-            QVector3D(0.18619,0.32334,0.98654),
-            QVector3D(0.18649,0.32939,0.9869),
-            QVector3D(0.18671,0.33539,0.98726),
-            QVector3D(0.18684,0.34133,0.98762),
-            QVector3D(0.18688,0.34725,0.98797),
-            QVector3D(0.18682,0.35312,0.98832),
-            QVector3D(0.18667,0.35896,0.98868),
-            QVector3D(0.18643,0.36477,0.98903),
-            QVector3D(0.1861,0.37054,0.98937),
-            QVector3D(0.18568,0.37631,0.98972),
-            QVector3D(0.18513,0.38201,0.99006),
-            QVector3D(0.18448,0.38771,0.9904),
-            QVector3D(0.18373,0.39338,0.99074),
-            QVector3D(0.18287,0.39902,0.99107),
-            QVector3D(0.18192,0.40464,0.9914),
-            QVector3D(0.18086,0.41025,0.99173),
-            QVector3D(0.17969,0.41582,0.99206),
-            QVector3D(0.17843,0.42137,0.99239),
-            QVector3D(0.17708,0.42691,0.99271),
-            QVector3D(0.17576,0.43242,0.99301),
-            QVector3D(0.17462,0.43788,0.9933),
-            QVector3D(0.17355,0.44331,0.99356),
-            QVector3D(0.17263,0.44871,0.99381),
-            QVector3D(0.17185,0.45406,0.99403),
-            QVector3D(0.17122,0.4594,0.99423),
-            QVector3D(0.17072,0.4647,0.99442),
-            QVector3D(0.17037,0.46998,0.99459),
-            QVector3D(0.17015,0.47522,0.99473),
-            QVector3D(0.17008,0.48043,0.99486),
-            QVector3D(0.17016,0.48562,0.99497),
-            QVector3D(0.17038,0.4908,0.99505),
-            QVector3D(0.17077,0.49593,0.99512),
-            QVector3D(0.17131,0.50106,0.99517),
-            QVector3D(0.17201,0.50615,0.99519),
-            QVector3D(0.17286,0.51122,0.9952),
-            QVector3D(0.17386,0.51627,0.99519),
-            QVector3D(0.17503,0.52131,0.99516),
-            QVector3D(0.17629,0.52633,0.9951),
-            QVector3D(0.17778,0.53132,0.99503),
-            QVector3D(0.17936,0.5363,0.99494),
-            QVector3D(0.1811,0.54125,0.99482),
-            QVector3D(0.18299,0.5462,0.99469),
-            QVector3D(0.18504,0.55111,0.99454),
-            QVector3D(0.1872,0.55601,0.99436),
-            QVector3D(0.18948,0.5609,0.99417),
-            QVector3D(0.19189,0.56577,0.99396),
-            QVector3D(0.19443,0.57063,0.99373),
-            QVector3D(0.19686,0.5755,0.99349),
-            QVector3D(0.19906,0.58036,0.99326),
-            QVector3D(0.2011,0.58524,0.99303),
-            QVector3D(0.20297,0.59011,0.99281),
-            QVector3D(0.20464,0.59499,0.9926),
-            QVector3D(0.20612,0.59989,0.99239),
-            QVector3D(0.2074,0.60479,0.99218),
-            QVector3D(0.2085,0.60969,0.99198),
-            QVector3D(0.20942,0.6146,0.99179),
-            QVector3D(0.21016,0.61953,0.9916),
-            QVector3D(0.21072,0.62445,0.99142),
-            QVector3D(0.21111,0.62938,0.99124),
-            QVector3D(0.21132,0.63432,0.99107),
-            QVector3D(0.21135,0.63926,0.9909),
-            QVector3D(0.2112,0.64421,0.99074),
-            QVector3D(0.21086,0.64918,0.99058),
-            QVector3D(0.21033,0.65414,0.99043),
-            QVector3D(0.20961,0.65911,0.99029),
-            QVector3D(0.2087,0.66409,0.99015),
-            QVector3D(0.2076,0.66908,0.99002),
-            QVector3D(0.20631,0.67406,0.98989),
-            QVector3D(0.20478,0.67906,0.98977),
-            QVector3D(0.20305,0.68406,0.98965),
-            QVector3D(0.20108,0.68908,0.98954),
-            QVector3D(0.1989,0.69409,0.98943),
-            QVector3D(0.19651,0.69911,0.98933),
-            QVector3D(0.19382,0.70414,0.98924),
-            QVector3D(0.19088,0.70918,0.98914),
-            QVector3D(0.18788,0.71421,0.98905),
-            QVector3D(0.18488,0.71923,0.98895),
-            QVector3D(0.18198,0.72423,0.98883),
-            QVector3D(0.17926,0.72923,0.98871),
-            QVector3D(0.17665,0.73421,0.98857),
-            QVector3D(0.17423,0.73918,0.98842),
-            QVector3D(0.17193,0.74412,0.98825),
-            QVector3D(0.16983,0.74906,0.98808),
-            QVector3D(0.16785,0.75399,0.98789),
-            QVector3D(0.16608,0.7589,0.9877),
-            QVector3D(0.16452,0.76381,0.98749),
-            QVector3D(0.16316,0.76869,0.98727),
-            QVector3D(0.16202,0.77357,0.98703),
-            QVector3D(0.1611,0.77844,0.98679),
-            QVector3D(0.16037,0.7833,0.98653),
-            QVector3D(0.15991,0.78814,0.98626),
-            QVector3D(0.1597,0.79298,0.98597),
-            QVector3D(0.15972,0.7978,0.98568),
-            QVector3D(0.15999,0.80261,0.98537),
-            QVector3D(0.16053,0.80742,0.98505),
-            QVector3D(0.16137,0.81221,0.98472),
-            QVector3D(0.16241,0.81699,0.98438),
-            QVector3D(0.16373,0.82176,0.98402),
-            QVector3D(0.16523,0.82652,0.98365),
-            QVector3D(0.16707,0.83127,0.98327),
-            QVector3D(0.1691,0.83601,0.98287),
-            QVector3D(0.17134,0.84074,0.98247),
-            QVector3D(0.17387,0.84546,0.98205),
-            QVector3D(0.17729,0.85015,0.98162),
-            QVector3D(0.18258,0.85474,0.98119),
-            QVector3D(0.19003,0.85923,0.98076),
-            QVector3D(0.19916,0.86363,0.98033),
-            QVector3D(0.20965,0.86794,0.97991),
-            QVector3D(0.22117,0.87217,0.97948),
-            QVector3D(0.23338,0.87632,0.97905),
-            QVector3D(0.24622,0.88041,0.97862),
-            QVector3D(0.25953,0.88443,0.9782),
-            QVector3D(0.27309,0.8884,0.97777),
-            QVector3D(0.28681,0.89231,0.97734),
-            QVector3D(0.30063,0.89617,0.97691),
-            QVector3D(0.31448,0.89998,0.97648),
-            QVector3D(0.32832,0.90375,0.97605),
-            QVector3D(0.34224,0.90747,0.97562),
-            QVector3D(0.35613,0.91115,0.97518),
-            QVector3D(0.36991,0.91479,0.97475),
-            QVector3D(0.38361,0.9184,0.97431),
-            QVector3D(0.39728,0.92197,0.97387),
-            QVector3D(0.4109,0.9255,0.97343),
-            QVector3D(0.42439,0.92899,0.973),
-            QVector3D(0.43779,0.93247,0.97255),
-            QVector3D(0.45116,0.9359,0.97211),
-            QVector3D(0.46443,0.93931,0.97166),
-            QVector3D(0.47755,0.94269,0.97121),
-            QVector3D(0.49069,0.94603,0.97076),
-            QVector3D(0.5037,0.94935,0.97031),
-            QVector3D(0.51659,0.95265,0.96986),
-            QVector3D(0.52949,0.95592,0.9694),
-            QVector3D(0.54227,0.95916,0.96894),
-            QVector3D(0.55496,0.96238,0.96849),
-            QVector3D(0.56763,0.96557,0.96803),
-            QVector3D(0.58018,0.96874,0.96756),
-            QVector3D(0.59271,0.97189,0.9671),
-            QVector3D(0.60515,0.97501,0.96663),
-            QVector3D(0.61751,0.97812,0.96616),
-            QVector3D(0.62987,0.98119,0.96569),
-            QVector3D(0.64213,0.98425,0.96521),
-            QVector3D(0.65436,0.98729,0.96474),
-            QVector3D(0.66654,0.9903,0.96426),
-            QVector3D(0.67864,0.9933,0.96378),
-            QVector3D(0.69072,0.99626,0.9633),
-            QVector3D(0.70271,0.99922,0.96282)
-        },
-        {
-            QVector3D(0.94334,0.94353,0.94348),
-            QVector3D(0.94036,0.94166,0.94325),
-            QVector3D(0.93738,0.9398,0.94302),
-            QVector3D(0.93439,0.93793,0.94278),
-            QVector3D(0.93141,0.93607,0.94255),
-            QVector3D(0.92843,0.9342,0.94231),
-            QVector3D(0.92545,0.93234,0.94206),
-            QVector3D(0.92247,0.93048,0.94182),
-            QVector3D(0.91948,0.92862,0.94157),
-            QVector3D(0.9165,0.92676,0.94131),
-            QVector3D(0.91352,0.9249,0.94106),
-            QVector3D(0.91054,0.92304,0.9408),
-            QVector3D(0.90755,0.92118,0.94054),
-            QVector3D(0.90456,0.91932,0.94028),
-            QVector3D(0.90157,0.91747,0.94001),
-            QVector3D(0.89858,0.91561,0.93974),
-            QVector3D(0.8956,0.91376,0.93947),
-            QVector3D(0.89261,0.9119,0.93919),
-            QVector3D(0.88962,0.91005,0.93891),
-            QVector3D(0.88663,0.9082,0.93863),
-            QVector3D(0.88364,0.90635,0.93834),
-            QVector3D(0.88065,0.90449,0.93805),
-            QVector3D(0.87766,0.90264,0.93776),
-            QVector3D(0.87466,0.90079,0.93746),
-            QVector3D(0.87167,0.89894,0.93716),
-            QVector3D(0.86868,0.8971,0.93686),
-            QVector3D(0.86569,0.89525,0.93655),
-            QVector3D(0.8627,0.89339,0.93624),
-            QVector3D(0.8597,0.89155,0.93593),
-            QVector3D(0.8567,0.8897,0.93561),
-            QVector3D(0.8537,0.88785,0.93528),
-            QVector3D(0.85071,0.88601,0.93496),
-            QVector3D(0.84771,0.88417,0.93463),
-            QVector3D(0.84472,0.88232,0.9343),
-            QVector3D(0.84172,0.88048,0.93396),
-            QVector3D(0.83872,0.87864,0.93362),
-            QVector3D(0.83572,0.87679,0.93327),
-            QVector3D(0.83272,0.87495,0.93292),
-            QVector3D(0.82973,0.87311,0.93257),
-            QVector3D(0.82673,0.87127,0.93222),
-            QVector3D(0.82373,0.86943,0.93186),
-            QVector3D(0.82073,0.86759,0.93149),
-            QVector3D(0.81773,0.86575,0.93112),
-            QVector3D(0.81473,0.86392,0.93075),
-            QVector3D(0.81173,0.86208,0.93037),
-            QVector3D(0.80873,0.86025,0.92999),
-            QVector3D(0.80573,0.85841,0.9296),
-            QVector3D(0.80273,0.85657,0.92921),
-            QVector3D(0.79973,0.85474,0.92881),
-            QVector3D(0.79673,0.85291,0.92841),
-            QVector3D(0.79374,0.85107,0.928),
-            QVector3D(0.79073,0.84924,0.92759),
-            QVector3D(0.78773,0.8474,0.92717),
-            QVector3D(0.78474,0.84557,0.92675),
-            QVector3D(0.78174,0.84374,0.92633),
-            QVector3D(0.77873,0.84191,0.9259),
-            QVector3D(0.77573,0.84009,0.92546),
-            QVector3D(0.77274,0.83825,0.92502),
-            QVector3D(0.76974,0.83642,0.92457),
-            QVector3D(0.76674,0.8346,0.92412),
-            QVector3D(0.76375,0.83277,0.92366),
-            QVector3D(0.76075,0.83094,0.92319),
-            QVector3D(0.75776,0.82912,0.92272),
-            QVector3D(0.75477,0.82729,0.92224),
-            QVector3D(0.75178,0.82546,0.92176),
-            QVector3D(0.74878,0.82363,0.92127),
-            QVector3D(0.74579,0.82181,0.92077),
-            QVector3D(0.7428,0.81998,0.92027),
-            QVector3D(0.73982,0.81816,0.91976),
-            QVector3D(0.73683,0.81634,0.91924),
-            QVector3D(0.73384,0.81451,0.91871),
-            QVector3D(0.73086,0.81269,0.91818),
-            QVector3D(0.72788,0.81087,0.91765),
-            QVector3D(0.72491,0.80905,0.9171),
-            QVector3D(0.72192,0.80723,0.91654),
-            QVector3D(0.71895,0.8054,0.91598),
-            QVector3D(0.71599,0.80358,0.91541),
-            QVector3D(0.71301,0.80176,0.91483),
-            QVector3D(0.71005,0.79995,0.91424),
-            QVector3D(0.70709,0.79812,0.91365),
-            QVector3D(0.70413,0.7963,0.91304),
-            QVector3D(0.70117,0.79449,0.91242),
-            QVector3D(0.69822,0.79266,0.91179),
-            QVector3D(0.69528,0.79084,0.91116),
-            QVector3D(0.69234,0.78903,0.91051),
-            QVector3D(0.6894,0.78721,0.90986),
-            QVector3D(0.68646,0.78539,0.90919),
-            QVector3D(0.68354,0.78357,0.90851),
-            QVector3D(0.68061,0.78175,0.90782),
-            QVector3D(0.67771,0.77993,0.90711),
-            QVector3D(0.6748,0.77812,0.9064),
-            QVector3D(0.6719,0.7763,0.90567),
-            QVector3D(0.66901,0.77447,0.90492),
-            QVector3D(0.66612,0.77266,0.90416),
-            QVector3D(0.66325,0.77084,0.90339),
-            QVector3D(0.66038,0.76902,0.9026),
-            QVector3D(0.65753,0.7672,0.90179),
-            QVector3D(0.65467,0.76538,0.90097),
-            QVector3D(0.65185,0.76356,0.90013),
-            QVector3D(0.64903,0.76174,0.89928),
-            QVector3D(0.64622,0.75992,0.89839),
-            QVector3D(0.64342,0.7581,0.8975),
-            QVector3D(0.64065,0.75627,0.89658),
-            QVector3D(0.63789,0.75445,0.89563),
-            QVector3D(0.63514,0.75262,0.89466),
-            QVector3D(0.63243,0.7508,0.89366),
-            QVector3D(0.62972,0.74897,0.89264),
-            QVector3D(0.62705,0.74715,0.89159),
-            QVector3D(0.6244,0.74531,0.8905),
-            QVector3D(0.62177,0.74349,0.88938),
-            QVector3D(0.61919,0.74165,0.88823),
-            QVector3D(0.61663,0.73982,0.88703),
-            QVector3D(0.6141,0.73798,0.88579),
-            QVector3D(0.61162,0.73613,0.8845),
-            QVector3D(0.60918,0.73429,0.88317),
-            QVector3D(0.60674,0.73245,0.88182),
-            QVector3D(0.60432,0.73061,0.88046),
-            QVector3D(0.6019,0.72876,0.87909),
-            QVector3D(0.5995,0.72692,0.87772),
-            QVector3D(0.59711,0.72508,0.87632),
-            QVector3D(0.59471,0.72323,0.87492),
-            QVector3D(0.59235,0.72139,0.87351),
-            QVector3D(0.58997,0.71955,0.87209),
-            QVector3D(0.58761,0.71771,0.87065),
-            QVector3D(0.58527,0.71586,0.86921),
-            QVector3D(0.58292,0.71402,0.86776),
-            QVector3D(0.58059,0.71217,0.86629),
-            QVector3D(0.57827,0.71033,0.86481),
-            QVector3D(0.57597,0.70849,0.86333),
-            QVector3D(0.57366,0.70665,0.86183),
-            QVector3D(0.57136,0.7048,0.86033),
-            QVector3D(0.56908,0.70296,0.8588),
-            QVector3D(0.56682,0.70112,0.85727),
-            QVector3D(0.56455,0.69927,0.85574),
-            QVector3D(0.5623,0.69743,0.85418),
-            QVector3D(0.56006,0.69559,0.85263),
-            QVector3D(0.55782,0.69375,0.85105),
-            QVector3D(0.55559,0.69191,0.84947),
-            QVector3D(0.55338,0.69007,0.84788),
-            QVector3D(0.55118,0.68823,0.84627),
-            QVector3D(0.549,0.68638,0.84466),
-            QVector3D(0.54681,0.68454,0.84304),
-            QVector3D(0.54464,0.6827,0.8414),
-            QVector3D(0.54248,0.68085,0.83976),
-            QVector3D(0.54033,0.67901,0.8381),
-            QVector3D(0.53819,0.67718,0.83644),
-            QVector3D(0.53605,0.67533,0.83476),
-            QVector3D(0.53393,0.67349,0.83307),
-            QVector3D(0.53183,0.67165,0.83138),
-            QVector3D(0.52973,0.66981,0.82967),
-            QVector3D(0.52764,0.66797,0.82795),
-            QVector3D(0.52557,0.66613,0.82622),
-            QVector3D(0.5235,0.66429,0.82448),
-            QVector3D(0.52144,0.66245,0.82274),
-            QVector3D(0.5194,0.6606,0.82097),
-            QVector3D(0.51737,0.65876,0.8192),
-            QVector3D(0.51534,0.65693,0.81742),
-            QVector3D(0.51333,0.65508,0.81564),
-            QVector3D(0.51133,0.65324,0.81383),
-            QVector3D(0.50934,0.65141,0.81203),
-            QVector3D(0.50737,0.64957,0.8102),
-            QVector3D(0.50539,0.64772,0.80838),
-            QVector3D(0.50344,0.64588,0.80654),
-            QVector3D(0.5015,0.64404,0.80469),
-            QVector3D(0.49956,0.64221,0.80282),
-            QVector3D(0.49765,0.64037,0.80095),
-            QVector3D(0.49573,0.63853,0.79907),
-            QVector3D(0.49383,0.6367,0.79718),
-            QVector3D(0.49195,0.63486,0.79528),
-            QVector3D(0.49007,0.63302,0.79337),
-            QVector3D(0.4882,0.63118,0.79145),
-            QVector3D(0.48631,0.62934,0.78955),
-            QVector3D(0.48439,0.62751,0.78769),
-            QVector3D(0.48243,0.62568,0.78587),
-            QVector3D(0.48043,0.62386,0.78409),
-            QVector3D(0.4784,0.62203,0.78233),
-            QVector3D(0.47634,0.62022,0.78062),
-            QVector3D(0.47423,0.61841,0.77894),
-            QVector3D(0.47211,0.6166,0.77729),
-            QVector3D(0.46995,0.61479,0.77567),
-            QVector3D(0.46775,0.61298,0.77408),
-            QVector3D(0.46552,0.61119,0.77252),
-            QVector3D(0.46327,0.60939,0.77099),
-            QVector3D(0.461,0.6076,0.76947),
-            QVector3D(0.4587,0.6058,0.76799),
-            QVector3D(0.45636,0.60403,0.76653),
-            QVector3D(0.45401,0.60223,0.7651),
-            QVector3D(0.45164,0.60045,0.76367),
-            QVector3D(0.44923,0.59867,0.76228),
-            QVector3D(0.4468,0.5969,0.76091),
-            QVector3D(0.44436,0.59512,0.75956),
-            QVector3D(0.44188,0.59336,0.75823),
-            QVector3D(0.43937,0.59159,0.75691),
-            QVector3D(0.43686,0.58981,0.75562),
-            QVector3D(0.43431,0.58805,0.75434),
-            QVector3D(0.43176,0.5863,0.75308),
-            QVector3D(0.42917,0.58454,0.75184),
-            QVector3D(0.42655,0.58278,0.75061),
-            QVector3D(0.42392,0.58102,0.74939),
-            QVector3D(0.42127,0.57928,0.74821),
-            QVector3D(0.4186,0.57752,0.74702),
-            QVector3D(0.41591,0.57578,0.74586),
-            QVector3D(0.4132,0.57403,0.7447),
-            QVector3D(0.41046,0.57229,0.74357),
-            QVector3D(0.4077,0.57054,0.74245),
-            QVector3D(0.40491,0.56881,0.74133),
-            QVector3D(0.40211,0.56708,0.74024),
-            QVector3D(0.39929,0.56533,0.73915),
-            QVector3D(0.39645,0.56361,0.73807),
-            QVector3D(0.39358,0.56188,0.73701),
-            QVector3D(0.3907,0.56015,0.73596),
-            QVector3D(0.38779,0.55842,0.73493),
-            QVector3D(0.38485,0.5567,0.7339),
-            QVector3D(0.3819,0.55498,0.73288),
-            QVector3D(0.37893,0.55325,0.73187),
-            QVector3D(0.37593,0.55154,0.73088),
-            QVector3D(0.3729,0.54983,0.72989),
-            QVector3D(0.36986,0.54812,0.72892),
-            QVector3D(0.36679,0.54641,0.72795),
-            QVector3D(0.36369,0.54469,0.72699),
-            QVector3D(0.36057,0.54299,0.72605),
-            QVector3D(0.35745,0.54127,0.72511),
-            QVector3D(0.35426,0.53957,0.72418),
-            QVector3D(0.35108,0.53788,0.72326),
-            QVector3D(0.34785,0.53617,0.72235),
-            QVector3D(0.3446,0.53447,0.72144),
-            QVector3D(0.34133,0.53278,0.72055),
-            QVector3D(0.33801,0.53108,0.71967),
-            QVector3D(0.3347,0.52939,0.71879),
-            QVector3D(0.33131,0.5277,0.71792),
-            QVector3D(0.32793,0.52601,0.71706),
-            QVector3D(0.3245,0.52432,0.7162),
-            QVector3D(0.32105,0.52263,0.71535),
-            QVector3D(0.31756,0.52095,0.7145),
-            QVector3D(0.31404,0.51927,0.71368),
-            QVector3D(0.31049,0.5176,0.71284),
-            QVector3D(0.30689,0.5159,0.71203),
-            QVector3D(0.30325,0.51424,0.71122),
-            QVector3D(0.2996,0.51256,0.71041),
-            QVector3D(0.29588,0.51089,0.70961),
-            QVector3D(0.29213,0.50922,0.70882),
-            QVector3D(0.28834,0.50755,0.70803),
-            QVector3D(0.2845,0.50587,0.70724),
-            QVector3D(0.28061,0.50422,0.70647),
-            QVector3D(0.27671,0.50255,0.7057),
-            QVector3D(0.27272,0.50089,0.70494),
-            QVector3D(0.2687,0.49923,0.70418),
-            QVector3D(0.26461,0.49758,0.70343),
-            QVector3D(0.26047,0.49591,0.70268),
-            QVector3D(0.25627,0.49427,0.70194),
-            QVector3D(0.25203,0.4926,0.70121),
-            QVector3D(0.24771,0.49097,0.70048),
-            QVector3D(0.24329,0.4893,0.69975),
-            QVector3D(0.23883,0.48767,0.69903),
-            QVector3D(0.23431,0.48601,0.69831),
-            QVector3D(0.22967,0.48437,0.6976)
-        },
-        {
-            QVector3D(0,0.017709,0.34641),
-            QVector3D(0,0.020672,0.3555),
-            QVector3D(0,0.023402,0.3646),
-            QVector3D(0,0.025899,0.37376),
-            QVector3D(0,0.028159,0.38295),
-            QVector3D(0,0.030176,0.39217),
-            QVector3D(0,0.031948,0.40143),
-            QVector3D(0,0.03346,0.41074),
-            QVector3D(0,0.034886,0.42006),
-            QVector3D(0,0.036005,0.42943),
-            QVector3D(0,0.037031,0.43882),
-            QVector3D(0,0.038092,0.44825),
-            QVector3D(0,0.039171,0.45769),
-            QVector3D(0,0.04027,0.46718),
-            QVector3D(0,0.041408,0.47668),
-            QVector3D(0,0.042463,0.4862),
-            QVector3D(0,0.043503,0.49576),
-            QVector3D(0,0.044741,0.50533),
-            QVector3D(0,0.045774,0.51494),
-            QVector3D(0,0.047001,0.52456),
-            QVector3D(0,0.048092,0.5342),
-            QVector3D(0,0.049352,0.54387),
-            QVector3D(0,0.050447,0.55355),
-            QVector3D(0,0.051609,0.56326),
-            QVector3D(0,0.052795,0.57298),
-            QVector3D(0,0.054014,0.58271),
-            QVector3D(0,0.055261,0.59247),
-            QVector3D(0,0.056563,0.60223),
-            QVector3D(0,0.057716,0.61201),
-            QVector3D(0,0.059101,0.6218),
-            QVector3D(0,0.060386,0.63161),
-            QVector3D(0,0.061629,0.64141),
-            QVector3D(0,0.063072,0.65124),
-            QVector3D(0,0.064391,0.66106),
-            QVector3D(0,0.065778,0.6709),
-            QVector3D(0,0.067217,0.68073),
-            QVector3D(0,0.068717,0.69056),
-            QVector3D(0,0.070145,0.7004),
-            QVector3D(0,0.071697,0.71023),
-            QVector3D(0,0.073287,0.72005),
-            QVector3D(0,0.074826,0.72985),
-            QVector3D(0,0.076443,0.73965),
-            QVector3D(0,0.078139,0.74942),
-            QVector3D(0,0.079895,0.75915),
-            QVector3D(0,0.08168,0.76872),
-            QVector3D(0,0.083307,0.77811),
-            QVector3D(0,0.084962,0.78731),
-            QVector3D(0,0.086573,0.79632),
-            QVector3D(0,0.088156,0.80515),
-            QVector3D(0,0.089689,0.81379),
-            QVector3D(0,0.091208,0.82225),
-            QVector3D(0,0.092616,0.83051),
-            QVector3D(0,0.09408,0.83857),
-            QVector3D(0,0.095474,0.84644),
-            QVector3D(0,0.096762,0.8541),
-            QVector3D(0,0.098154,0.86158),
-            QVector3D(0,0.099403,0.86886),
-            QVector3D(0,0.10065,0.87593),
-            QVector3D(0,0.10187,0.88281),
-            QVector3D(0,0.10309,0.88949),
-            QVector3D(0,0.1042,0.89597),
-            QVector3D(0,0.10532,0.90224),
-            QVector3D(0,0.10647,0.9083),
-            QVector3D(0,0.10749,0.91415),
-            QVector3D(0,0.10849,0.9198),
-            QVector3D(0,0.10956,0.92525),
-            QVector3D(0,0.11052,0.9305),
-            QVector3D(0,0.11147,0.93553),
-            QVector3D(0,0.1124,0.94036),
-            QVector3D(0,0.11331,0.94497),
-            QVector3D(0,0.11413,0.94937),
-            QVector3D(0,0.11498,0.95357),
-            QVector3D(0,0.11585,0.9576),
-            QVector3D(0,0.11662,0.96148),
-            QVector3D(0,0.11733,0.96522),
-            QVector3D(0,0.11806,0.96883),
-            QVector3D(0,0.11873,0.97228),
-            QVector3D(0,0.11931,0.97558),
-            QVector3D(0,0.11987,0.97874),
-            QVector3D(0,0.12039,0.98176),
-            QVector3D(0,0.12087,0.98464),
-            QVector3D(0,0.12132,0.98737),
-            QVector3D(0,0.12173,0.98995),
-            QVector3D(0.042484,0.1221,0.99239),
-            QVector3D(0.096239,0.12243,0.99468),
-            QVector3D(0.13272,0.12272,0.99682),
-            QVector3D(0.16225,0.12297,0.99881),
-            QVector3D(0.18788,0.12318,1),
-            QVector3D(0.21091,0.12336,1),
-            QVector3D(0.23216,0.1235,1),
-            QVector3D(0.25202,0.1236,1),
-            QVector3D(0.27081,0.12366,1),
-            QVector3D(0.28872,0.12369,1),
-            QVector3D(0.30596,0.12367,1),
-            QVector3D(0.32259,0.12362,1),
-            QVector3D(0.33869,0.12354,1),
-            QVector3D(0.35436,0.12342,1),
-            QVector3D(0.36964,0.12326,1),
-            QVector3D(0.38457,0.12307,1),
-            QVector3D(0.39919,0.12286,1),
-            QVector3D(0.41348,0.12262,1),
-            QVector3D(0.42736,0.12239,1),
-            QVector3D(0.44084,0.12216,1),
-            QVector3D(0.454,0.12195,1),
-            QVector3D(0.46684,0.12174,1),
-            QVector3D(0.47939,0.12155,1),
-            QVector3D(0.49169,0.12136,1),
-            QVector3D(0.50374,0.12117,1),
-            QVector3D(0.51557,0.121,1),
-            QVector3D(0.52721,0.12083,1),
-            QVector3D(0.53866,0.12067,1),
-            QVector3D(0.54992,0.12051,1),
-            QVector3D(0.56102,0.12037,1),
-            QVector3D(0.57198,0.12022,1),
-            QVector3D(0.58279,0.12009,1),
-            QVector3D(0.59347,0.11996,1),
-            QVector3D(0.60403,0.11983,1),
-            QVector3D(0.61446,0.11971,1),
-            QVector3D(0.62479,0.11959,1),
-            QVector3D(0.63501,0.11948,1),
-            QVector3D(0.64513,0.11938,1),
-            QVector3D(0.65516,0.11927,1),
-            QVector3D(0.66511,0.11918,1),
-            QVector3D(0.67497,0.11908,1),
-            QVector3D(0.68475,0.11899,1),
-            QVector3D(0.69445,0.1189,1),
-            QVector3D(0.7041,0.11881,1),
-            QVector3D(0.71366,0.11873,1),
-            QVector3D(0.72312,0.11873,1),
-            QVector3D(0.73244,0.11896,1),
-            QVector3D(0.74156,0.11949,1),
-            QVector3D(0.75051,0.12036,1),
-            QVector3D(0.75927,0.12156,1),
-            QVector3D(0.76785,0.12312,1),
-            QVector3D(0.77627,0.12504,1),
-            QVector3D(0.78452,0.12724,1),
-            QVector3D(0.79261,0.12981,1),
-            QVector3D(0.80054,0.13262,1),
-            QVector3D(0.80832,0.1357,1),
-            QVector3D(0.81594,0.1391,1),
-            QVector3D(0.82341,0.14279,1),
-            QVector3D(0.83074,0.14669,1),
-            QVector3D(0.83791,0.15087,1),
-            QVector3D(0.84494,0.15527,1),
-            QVector3D(0.85183,0.15984,1),
-            QVector3D(0.85859,0.16467,1),
-            QVector3D(0.8652,0.16967,1),
-            QVector3D(0.87169,0.17481,1),
-            QVector3D(0.87803,0.1801,1),
-            QVector3D(0.88424,0.18562,1),
-            QVector3D(0.89031,0.1912,1),
-            QVector3D(0.89626,0.19697,1),
-            QVector3D(0.90207,0.20282,1),
-            QVector3D(0.90776,0.2088,1),
-            QVector3D(0.91332,0.21488,1),
-            QVector3D(0.91875,0.22109,1),
-            QVector3D(0.92405,0.22737,1),
-            QVector3D(0.92919,0.23379,1),
-            QVector3D(0.93415,0.24041,1),
-            QVector3D(0.93894,0.2472,1),
-            QVector3D(0.94355,0.25413,1),
-            QVector3D(0.94798,0.26118,1),
-            QVector3D(0.95224,0.26837,1),
-            QVector3D(0.95633,0.2757,1),
-            QVector3D(0.96024,0.28311,1),
-            QVector3D(0.96396,0.29064,1),
-            QVector3D(0.96751,0.29827,1),
-            QVector3D(0.97089,0.30602,1),
-            QVector3D(0.97409,0.31382,1),
-            QVector3D(0.97712,0.3217,1),
-            QVector3D(0.97997,0.32968,1),
-            QVector3D(0.98265,0.33769,1),
-            QVector3D(0.98515,0.34577,1),
-            QVector3D(0.98746,0.35394,1),
-            QVector3D(0.9896,0.36216,1),
-            QVector3D(0.99155,0.37042,1),
-            QVector3D(0.99333,0.37874,1),
-            QVector3D(0.99493,0.3871,1),
-            QVector3D(0.99635,0.39551,1),
-            QVector3D(0.9976,0.40394,1),
-            QVector3D(0.99866,0.41243,1),
-            QVector3D(0.99953,0.42094,1),
-            QVector3D(1,0.4295,1),
-            QVector3D(1,0.43809,1),
-            QVector3D(1,0.44668,1),
-            QVector3D(1,0.45524,1),
-            QVector3D(1,0.46369,1),
-            QVector3D(1,0.47203,1),
-            QVector3D(1,0.48024,1),
-            QVector3D(1,0.48835,1),
-            QVector3D(1,0.49634,1),
-            QVector3D(1,0.50426,1),
-            QVector3D(1,0.51206,1),
-            QVector3D(1,0.51978,1),
-            QVector3D(1,0.52742,1),
-            QVector3D(1,0.53498,1),
-            QVector3D(1,0.54247,1),
-            QVector3D(1,0.54988,1),
-            QVector3D(1,0.55722,1),
-            QVector3D(1,0.56449,1),
-            QVector3D(1,0.57169,1),
-            QVector3D(1,0.57884,1),
-            QVector3D(1,0.58594,1),
-            QVector3D(1,0.59297,1),
-            QVector3D(1,0.59995,1),
-            QVector3D(1,0.60688,1),
-            QVector3D(1,0.61374,1),
-            QVector3D(1,0.62058,1),
-            QVector3D(1,0.62736,1),
-            QVector3D(1,0.6341,1),
-            QVector3D(1,0.64079,1),
-            QVector3D(1,0.64743,1),
-            QVector3D(1,0.65405,1),
-            QVector3D(1,0.66063,1),
-            QVector3D(1,0.66718,1),
-            QVector3D(1,0.6737,1),
-            QVector3D(1,0.68019,1),
-            QVector3D(1,0.68667,1),
-            QVector3D(1,0.69312,1),
-            QVector3D(1,0.69954,1),
-            QVector3D(1,0.70595,1),
-            QVector3D(1,0.71233,1),
-            QVector3D(1,0.71869,1),
-            QVector3D(1,0.72504,1),
-            QVector3D(1,0.73136,1),
-            QVector3D(1,0.73767,1),
-            QVector3D(1,0.74396,1),
-            QVector3D(1,0.75023,1),
-            QVector3D(1,0.75649,1),
-            QVector3D(1,0.76273,1),
-            QVector3D(1,0.76895,1),
-            QVector3D(1,0.77517,1),
-            QVector3D(1,0.78137,1),
-            QVector3D(1,0.78755,1),
-            QVector3D(1,0.79372,1),
-            QVector3D(1,0.79988,1),
-            QVector3D(1,0.80602,1),
-            QVector3D(1,0.81215,1),
-            QVector3D(1,0.81826,1),
-            QVector3D(1,0.82437,1),
-            QVector3D(1,0.83047,1),
-            QVector3D(1,0.83656,1),
-            QVector3D(1,0.84263,1),
-            QVector3D(1,0.84869,1),
-            QVector3D(1,0.85475,1),
-            QVector3D(1,0.86079,1),
-            QVector3D(1,0.86683,1),
-            QVector3D(1,0.87286,0.99978),
-            QVector3D(1,0.87887,0.9995),
-            QVector3D(1,0.88488,0.99921),
-            QVector3D(1,0.89088,0.99892),
-            QVector3D(0.99975,0.89688,0.99861),
-            QVector3D(0.99925,0.90287,0.9983),
-            QVector3D(0.99872,0.90884,0.99799),
-            QVector3D(0.99817,0.91481,0.99766),
-            QVector3D(0.9976,0.92077,0.99733)
-        },
-        {
-            QVector3D(0,0.047803,0.4883),
-            QVector3D(0,0.049705,0.49553),
-            QVector3D(0,0.051451,0.50272),
-            QVector3D(0,0.053214,0.50983),
-            QVector3D(0,0.054977,0.51684),
-            QVector3D(0,0.056756,0.52379),
-            QVector3D(0,0.058368,0.53062),
-            QVector3D(0,0.060099,0.53736),
-            QVector3D(0,0.061618,0.54402),
-            QVector3D(0,0.063279,0.55055),
-            QVector3D(0,0.06478,0.55698),
-            QVector3D(0,0.066288,0.56332),
-            QVector3D(0,0.067769,0.5695),
-            QVector3D(0,0.069247,0.57558),
-            QVector3D(0,0.070546,0.58154),
-            QVector3D(0,0.071898,0.58736),
-            QVector3D(0,0.073227,0.59303),
-            QVector3D(0,0.074425,0.59856),
-            QVector3D(0,0.075597,0.60398),
-            QVector3D(0,0.076712,0.60919),
-            QVector3D(0,0.077789,0.61423),
-            QVector3D(0,0.078828,0.61913),
-            QVector3D(0,0.079825,0.62386),
-            QVector3D(0,0.080751,0.62837),
-            QVector3D(0,0.081634,0.63267),
-            QVector3D(0,0.082399,0.63679),
-            QVector3D(0,0.083056,0.64069),
-            QVector3D(0,0.083728,0.64438),
-            QVector3D(0,0.084298,0.64781),
-            QVector3D(0,0.084735,0.65098),
-            QVector3D(0,0.085075,0.65389),
-            QVector3D(0,0.085333,0.65653),
-            QVector3D(0,0.085503,0.65887),
-            QVector3D(0,0.085575,0.66091),
-            QVector3D(0,0.085538,0.66263),
-            QVector3D(0,0.085387,0.664),
-            QVector3D(0.041146,0.085117,0.66498),
-            QVector3D(0.082348,0.084719,0.66559),
-            QVector3D(0.11295,0.084153,0.66576),
-            QVector3D(0.13887,0.083348,0.66549),
-            QVector3D(0.16224,0.08245,0.66472),
-            QVector3D(0.18389,0.081312,0.66345),
-            QVector3D(0.20444,0.079918,0.6616),
-            QVector3D(0.2241,0.078308,0.65916),
-            QVector3D(0.24323,0.076464,0.65608),
-            QVector3D(0.26189,0.074387,0.65234),
-            QVector3D(0.27969,0.072084,0.64827),
-            QVector3D(0.29634,0.069818,0.64421),
-            QVector3D(0.31196,0.067486,0.64024),
-            QVector3D(0.32675,0.065157,0.63634),
-            QVector3D(0.34081,0.062906,0.63252),
-            QVector3D(0.35421,0.060546,0.6288),
-            QVector3D(0.36705,0.058179,0.62515),
-            QVector3D(0.3794,0.055931,0.62158),
-            QVector3D(0.39131,0.05356,0.6181),
-            QVector3D(0.40281,0.051267,0.6147),
-            QVector3D(0.41397,0.049057,0.6114),
-            QVector3D(0.42479,0.046684,0.60817),
-            QVector3D(0.43533,0.044376,0.60501),
-            QVector3D(0.44558,0.042108,0.60193),
-            QVector3D(0.4556,0.039763,0.59895),
-            QVector3D(0.46537,0.037486,0.59604),
-            QVector3D(0.47496,0.035294,0.59322),
-            QVector3D(0.48432,0.032963,0.59047),
-            QVector3D(0.49352,0.030903,0.5878),
-            QVector3D(0.50254,0.028926,0.58523),
-            QVector3D(0.5114,0.027022,0.58272),
-            QVector3D(0.52012,0.025191,0.5803),
-            QVector3D(0.52872,0.02343,0.57794),
-            QVector3D(0.53717,0.021744,0.57569),
-            QVector3D(0.54549,0.020131,0.57351),
-            QVector3D(0.5537,0.018589,0.5714),
-            QVector3D(0.56182,0.017116,0.56937),
-            QVector3D(0.56982,0.015713,0.56743),
-            QVector3D(0.57772,0.014383,0.56556),
-            QVector3D(0.58556,0.013108,0.56378),
-            QVector3D(0.59331,0.011906,0.56202),
-            QVector3D(0.60102,0.010448,0.56026),
-            QVector3D(0.60871,0.0092728,0.55849),
-            QVector3D(0.61634,0.0080608,0.55673),
-            QVector3D(0.62394,0.0068636,0.55496),
-            QVector3D(0.6315,0.0056715,0.55317),
-            QVector3D(0.63904,0.0044851,0.5514),
-            QVector3D(0.64654,0.0033027,0.5496),
-            QVector3D(0.65401,0.0021237,0.54781),
-            QVector3D(0.66146,0.00094944,0.54601),
-            QVector3D(0.66888,0,0.54419),
-            QVector3D(0.67628,0,0.54238),
-            QVector3D(0.68364,0,0.54055),
-            QVector3D(0.69099,0,0.53873),
-            QVector3D(0.69832,0,0.53689),
-            QVector3D(0.70562,0,0.53504),
-            QVector3D(0.71291,0,0.53319),
-            QVector3D(0.72018,0,0.53134),
-            QVector3D(0.72742,0,0.52948),
-            QVector3D(0.73466,0,0.52761),
-            QVector3D(0.74187,0,0.52573),
-            QVector3D(0.74906,0,0.52385),
-            QVector3D(0.75625,0,0.52195),
-            QVector3D(0.76342,0,0.52005),
-            QVector3D(0.77058,0,0.51816),
-            QVector3D(0.77773,0,0.51624),
-            QVector3D(0.78486,0,0.51433),
-            QVector3D(0.79198,0,0.51239),
-            QVector3D(0.79909,0,0.51046),
-            QVector3D(0.80618,0,0.50853),
-            QVector3D(0.81322,0,0.50656),
-            QVector3D(0.82017,0,0.50459),
-            QVector3D(0.82703,0,0.50258),
-            QVector3D(0.83381,0,0.50056),
-            QVector3D(0.84048,0,0.49853),
-            QVector3D(0.84706,0,0.49645),
-            QVector3D(0.85355,0,0.49437),
-            QVector3D(0.85996,0,0.49225),
-            QVector3D(0.86628,0,0.49011),
-            QVector3D(0.8725,0,0.48796),
-            QVector3D(0.87863,0.0025964,0.48577),
-            QVector3D(0.88468,0.0090591,0.48356),
-            QVector3D(0.89063,0.016464,0.48133),
-            QVector3D(0.8965,0.024452,0.47908),
-            QVector3D(0.90228,0.033265,0.47679),
-            QVector3D(0.90796,0.042948,0.47449),
-            QVector3D(0.91356,0.052352,0.47216),
-            QVector3D(0.91907,0.061335,0.4698),
-            QVector3D(0.92449,0.070106,0.46741),
-            QVector3D(0.92982,0.07857,0.46499),
-            QVector3D(0.93506,0.086993,0.46255),
-            QVector3D(0.94022,0.095176,0.46008),
-            QVector3D(0.94529,0.10322,0.45759),
-            QVector3D(0.95027,0.11119,0.45507),
-            QVector3D(0.95516,0.11907,0.45252),
-            QVector3D(0.95996,0.12687,0.44993),
-            QVector3D(0.96467,0.13467,0.44731),
-            QVector3D(0.9693,0.14235,0.44468),
-            QVector3D(0.97383,0.15004,0.44201),
-            QVector3D(0.97827,0.15766,0.43929),
-            QVector3D(0.9826,0.16532,0.43656),
-            QVector3D(0.9868,0.17308,0.4338),
-            QVector3D(0.99086,0.18089,0.43103),
-            QVector3D(0.99477,0.18882,0.42822),
-            QVector3D(0.99854,0.19681,0.42539),
-            QVector3D(1,0.20481,0.42252),
-            QVector3D(1,0.21285,0.41965),
-            QVector3D(1,0.22099,0.41674),
-            QVector3D(1,0.22914,0.4138),
-            QVector3D(1,0.23736,0.41083),
-            QVector3D(1,0.24555,0.40783),
-            QVector3D(1,0.25382,0.4048),
-            QVector3D(1,0.2621,0.40173),
-            QVector3D(1,0.27043,0.39864),
-            QVector3D(1,0.27875,0.39552),
-            QVector3D(1,0.28708,0.39235),
-            QVector3D(1,0.29545,0.38916),
-            QVector3D(1,0.30385,0.38591),
-            QVector3D(1,0.31225,0.38264),
-            QVector3D(1,0.3207,0.37933),
-            QVector3D(1,0.32913,0.37598),
-            QVector3D(1,0.33756,0.37257),
-            QVector3D(1,0.34602,0.36914),
-            QVector3D(1,0.35451,0.36565),
-            QVector3D(1,0.36297,0.36212),
-            QVector3D(1,0.37145,0.35853),
-            QVector3D(1,0.37995,0.35492),
-            QVector3D(1,0.38846,0.35122),
-            QVector3D(1,0.39696,0.34749),
-            QVector3D(1,0.40547,0.34369),
-            QVector3D(1,0.4139,0.33986),
-            QVector3D(1,0.4222,0.33597),
-            QVector3D(1,0.4304,0.33207),
-            QVector3D(1,0.43847,0.3281),
-            QVector3D(1,0.44643,0.3241),
-            QVector3D(1,0.45429,0.32007),
-            QVector3D(1,0.46204,0.31598),
-            QVector3D(1,0.46971,0.31182),
-            QVector3D(1,0.47727,0.30763),
-            QVector3D(1,0.48476,0.30339),
-            QVector3D(1,0.49217,0.2991),
-            QVector3D(1,0.4995,0.29473),
-            QVector3D(1,0.50677,0.2903),
-            QVector3D(1,0.51397,0.28581),
-            QVector3D(1,0.5211,0.28126),
-            QVector3D(1,0.52816,0.27665),
-            QVector3D(1,0.53517,0.27191),
-            QVector3D(1,0.54212,0.26713),
-            QVector3D(1,0.54902,0.26226),
-            QVector3D(1,0.55585,0.2573),
-            QVector3D(1,0.56265,0.25223),
-            QVector3D(1,0.56938,0.24705),
-            QVector3D(1,0.57609,0.24177),
-            QVector3D(1,0.58273,0.23637),
-            QVector3D(1,0.58934,0.23082),
-            QVector3D(1,0.59591,0.22513),
-            QVector3D(1,0.60244,0.21933),
-            QVector3D(1,0.60893,0.21333),
-            QVector3D(1,0.61536,0.20719),
-            QVector3D(1,0.62179,0.20085),
-            QVector3D(1,0.62814,0.19473),
-            QVector3D(1,0.63438,0.18898),
-            QVector3D(1,0.64052,0.18363),
-            QVector3D(1,0.64658,0.17866),
-            QVector3D(1,0.65258,0.17395),
-            QVector3D(1,0.65851,0.16956),
-            QVector3D(1,0.66439,0.16532),
-            QVector3D(1,0.67023,0.1614),
-            QVector3D(1,0.67601,0.15763),
-            QVector3D(1,0.68174,0.1541),
-            QVector3D(1,0.68745,0.15075),
-            QVector3D(1,0.69312,0.14754),
-            QVector3D(1,0.69875,0.14449),
-            QVector3D(1,0.70435,0.14163),
-            QVector3D(1,0.70993,0.13886),
-            QVector3D(1,0.71548,0.13623),
-            QVector3D(1,0.72099,0.13382),
-            QVector3D(1,0.72649,0.1315),
-            QVector3D(1,0.73197,0.12928),
-            QVector3D(1,0.73742,0.12722),
-            QVector3D(1,0.74286,0.1253),
-            QVector3D(1,0.74827,0.12347),
-            QVector3D(1,0.75367,0.1218),
-            QVector3D(1,0.75905,0.12025),
-            QVector3D(1,0.76442,0.11888),
-            QVector3D(1,0.76976,0.11751),
-            QVector3D(1,0.7751,0.11639),
-            QVector3D(1,0.78042,0.11528),
-            QVector3D(1,0.78573,0.11434),
-            QVector3D(1,0.79102,0.11357),
-            QVector3D(1,0.79631,0.11289),
-            QVector3D(1,0.80158,0.1123),
-            QVector3D(1,0.80685,0.11183),
-            QVector3D(1,0.81209,0.1115),
-            QVector3D(1,0.81733,0.11127),
-            QVector3D(1,0.82257,0.11116),
-            QVector3D(1,0.82778,0.11116),
-            QVector3D(1,0.833,0.11128),
-            QVector3D(1,0.8382,0.1115),
-            QVector3D(1,0.8434,0.11183),
-            QVector3D(1,0.84859,0.11227),
-            QVector3D(1,0.85377,0.11282),
-            QVector3D(1,0.85894,0.11347),
-            QVector3D(1,0.86412,0.11414),
-            QVector3D(1,0.86928,0.115),
-            QVector3D(1,0.87443,0.11595),
-            QVector3D(1,0.87958,0.11697),
-            QVector3D(1,0.88472,0.11809),
-            QVector3D(1,0.88986,0.11929),
-            QVector3D(1,0.89499,0.12054),
-            QVector3D(1,0.90012,0.1219),
-            QVector3D(1,0.90524,0.12335),
-            QVector3D(1,0.91036,0.12486),
-            QVector3D(1,0.91547,0.12649),
-            QVector3D(1,0.92058,0.12812),
-            QVector3D(1,0.92569,0.1299),
-            QVector3D(1,0.93079,0.13165),
-            QVector3D(1,0.93588,0.13349),
-            QVector3D(1,0.94097,0.13541),
-            QVector3D(1,0.94606,0.13735)
-        },
-        {
-            QVector3D(0.39872,0.60624,0.56451),
-            QVector3D(0.40156,0.60721,0.56266),
-            QVector3D(0.4044,0.60816,0.5608),
-            QVector3D(0.40724,0.60911,0.55895),
-            QVector3D(0.41009,0.61005,0.55712),
-            QVector3D(0.41293,0.61099,0.55528),
-            QVector3D(0.41577,0.61192,0.55344),
-            QVector3D(0.41863,0.61285,0.55162),
-            QVector3D(0.42148,0.61378,0.5498),
-            QVector3D(0.42435,0.6147,0.54798),
-            QVector3D(0.42723,0.61561,0.54618),
-            QVector3D(0.4301,0.61653,0.54436),
-            QVector3D(0.43298,0.61743,0.54256),
-            QVector3D(0.43588,0.61833,0.54076),
-            QVector3D(0.43876,0.61923,0.53897),
-            QVector3D(0.44169,0.62012,0.53719),
-            QVector3D(0.44461,0.621,0.5354),
-            QVector3D(0.44752,0.62186,0.53362),
-            QVector3D(0.45047,0.62274,0.53186),
-            QVector3D(0.45342,0.62361,0.5301),
-            QVector3D(0.45639,0.62446,0.52835),
-            QVector3D(0.45937,0.62531,0.5266),
-            QVector3D(0.46235,0.62615,0.52485),
-            QVector3D(0.46536,0.62698,0.52312),
-            QVector3D(0.46838,0.62781,0.52138),
-            QVector3D(0.47142,0.62864,0.51966),
-            QVector3D(0.47447,0.62944,0.51795),
-            QVector3D(0.47754,0.63025,0.51623),
-            QVector3D(0.48061,0.63105,0.51454),
-            QVector3D(0.48372,0.63184,0.51285),
-            QVector3D(0.48685,0.63262,0.51116),
-            QVector3D(0.48999,0.63339,0.50949),
-            QVector3D(0.49314,0.63416,0.50783),
-            QVector3D(0.49633,0.63491,0.50616),
-            QVector3D(0.49954,0.63565,0.50452),
-            QVector3D(0.50277,0.63639,0.50287),
-            QVector3D(0.50602,0.63711,0.50125),
-            QVector3D(0.50931,0.63782,0.49961),
-            QVector3D(0.51261,0.63852,0.49802),
-            QVector3D(0.51594,0.63922,0.4964),
-            QVector3D(0.5193,0.6399,0.49483),
-            QVector3D(0.52268,0.64057,0.49323),
-            QVector3D(0.5261,0.64122,0.49168),
-            QVector3D(0.52955,0.64187,0.49012),
-            QVector3D(0.53302,0.6425,0.48858),
-            QVector3D(0.53654,0.64312,0.48705),
-            QVector3D(0.54007,0.64372,0.48552),
-            QVector3D(0.54365,0.64431,0.48402),
-            QVector3D(0.54726,0.64489,0.48253),
-            QVector3D(0.55092,0.64545,0.48105),
-            QVector3D(0.55461,0.64599,0.4796),
-            QVector3D(0.55833,0.64652,0.47815),
-            QVector3D(0.56212,0.64704,0.47672),
-            QVector3D(0.56592,0.64753,0.47532),
-            QVector3D(0.56978,0.648,0.47391),
-            QVector3D(0.57369,0.64846,0.47253),
-            QVector3D(0.57764,0.6489,0.47118),
-            QVector3D(0.58164,0.64932,0.46984),
-            QVector3D(0.5857,0.64971,0.46851),
-            QVector3D(0.5898,0.65009,0.46722),
-            QVector3D(0.59397,0.65044,0.46593),
-            QVector3D(0.59819,0.65076,0.46469),
-            QVector3D(0.60248,0.65106,0.46344),
-            QVector3D(0.60683,0.65134,0.46224),
-            QVector3D(0.61124,0.65159,0.46106),
-            QVector3D(0.61572,0.6518,0.45991),
-            QVector3D(0.62028,0.65199,0.45879),
-            QVector3D(0.62491,0.65214,0.45769),
-            QVector3D(0.62961,0.65226,0.45663),
-            QVector3D(0.63441,0.65235,0.4556),
-            QVector3D(0.63928,0.6524,0.45461),
-            QVector3D(0.64424,0.65241,0.45364),
-            QVector3D(0.6493,0.65237,0.45273),
-            QVector3D(0.65445,0.6523,0.45184),
-            QVector3D(0.65971,0.65218,0.451),
-            QVector3D(0.66508,0.65201,0.45021),
-            QVector3D(0.67058,0.65178,0.44946),
-            QVector3D(0.67612,0.65152,0.44876),
-            QVector3D(0.68161,0.65126,0.44805),
-            QVector3D(0.68699,0.65102,0.44736),
-            QVector3D(0.69226,0.65081,0.44667),
-            QVector3D(0.69741,0.65061,0.44598),
-            QVector3D(0.70245,0.65044,0.44529),
-            QVector3D(0.70738,0.65029,0.44461),
-            QVector3D(0.71221,0.65017,0.44392),
-            QVector3D(0.71694,0.65007,0.44324),
-            QVector3D(0.72155,0.65,0.44256),
-            QVector3D(0.72607,0.64995,0.44187),
-            QVector3D(0.73048,0.64993,0.44118),
-            QVector3D(0.7348,0.64994,0.4405),
-            QVector3D(0.73901,0.64997,0.43982),
-            QVector3D(0.74312,0.65003,0.43914),
-            QVector3D(0.74713,0.65011,0.43846),
-            QVector3D(0.75106,0.65023,0.43779),
-            QVector3D(0.75488,0.65037,0.43711),
-            QVector3D(0.7586,0.65054,0.43643),
-            QVector3D(0.76223,0.65074,0.43576),
-            QVector3D(0.76578,0.65097,0.43508),
-            QVector3D(0.76922,0.65123,0.4344),
-            QVector3D(0.77257,0.65152,0.43372),
-            QVector3D(0.77583,0.65185,0.43305),
-            QVector3D(0.779,0.65219,0.43239),
-            QVector3D(0.78209,0.65257,0.43171),
-            QVector3D(0.78507,0.65298,0.43103),
-            QVector3D(0.78797,0.65343,0.43036),
-            QVector3D(0.79078,0.65391,0.42968),
-            QVector3D(0.7935,0.65441,0.42901),
-            QVector3D(0.79612,0.65495,0.42833),
-            QVector3D(0.79867,0.65553,0.42766),
-            QVector3D(0.80112,0.65614,0.42699),
-            QVector3D(0.80349,0.65678,0.4263),
-            QVector3D(0.80576,0.65745,0.42564),
-            QVector3D(0.80795,0.65816,0.42497),
-            QVector3D(0.81006,0.65889,0.42428),
-            QVector3D(0.81207,0.65966,0.42361),
-            QVector3D(0.814,0.66047,0.42293),
-            QVector3D(0.81584,0.66131,0.42225),
-            QVector3D(0.8176,0.66219,0.42158),
-            QVector3D(0.81927,0.66309,0.4209),
-            QVector3D(0.82085,0.66403,0.42023),
-            QVector3D(0.82235,0.665,0.41956),
-            QVector3D(0.82376,0.66601,0.41887),
-            QVector3D(0.82508,0.66705,0.41819),
-            QVector3D(0.82632,0.66813,0.41752),
-            QVector3D(0.82747,0.66924,0.41684),
-            QVector3D(0.82853,0.67039,0.41616),
-            QVector3D(0.82952,0.67156,0.41547),
-            QVector3D(0.83041,0.67278,0.41479),
-            QVector3D(0.83123,0.67401,0.41414),
-            QVector3D(0.83202,0.67526,0.41355),
-            QVector3D(0.83279,0.67651,0.41307),
-            QVector3D(0.83355,0.67776,0.41268),
-            QVector3D(0.83429,0.67901,0.41239),
-            QVector3D(0.83501,0.68025,0.41219),
-            QVector3D(0.83572,0.68151,0.41208),
-            QVector3D(0.83641,0.68277,0.41209),
-            QVector3D(0.83708,0.68402,0.41219),
-            QVector3D(0.83774,0.68528,0.41239),
-            QVector3D(0.83838,0.68653,0.41269),
-            QVector3D(0.83901,0.68779,0.41309),
-            QVector3D(0.83962,0.68906,0.41358),
-            QVector3D(0.84021,0.69031,0.41417),
-            QVector3D(0.84079,0.69157,0.41487),
-            QVector3D(0.84135,0.69284,0.41567),
-            QVector3D(0.84189,0.6941,0.41657),
-            QVector3D(0.84242,0.69537,0.41757),
-            QVector3D(0.84293,0.69663,0.41865),
-            QVector3D(0.84342,0.6979,0.41986),
-            QVector3D(0.8439,0.69916,0.42115),
-            QVector3D(0.84436,0.70044,0.42254),
-            QVector3D(0.8448,0.7017,0.42404),
-            QVector3D(0.84523,0.70298,0.42564),
-            QVector3D(0.84563,0.70425,0.42735),
-            QVector3D(0.84602,0.70552,0.42913),
-            QVector3D(0.84639,0.7068,0.43103),
-            QVector3D(0.84674,0.70808,0.43303),
-            QVector3D(0.84707,0.70936,0.43513),
-            QVector3D(0.84739,0.71063,0.43732),
-            QVector3D(0.84768,0.71191,0.4396),
-            QVector3D(0.84796,0.71319,0.44201),
-            QVector3D(0.84821,0.71447,0.4445),
-            QVector3D(0.84845,0.71577,0.44707),
-            QVector3D(0.84866,0.71705,0.44976),
-            QVector3D(0.84885,0.71833,0.45256),
-            QVector3D(0.84903,0.71963,0.45543),
-            QVector3D(0.84918,0.72091,0.45841),
-            QVector3D(0.8493,0.7222,0.46149),
-            QVector3D(0.84941,0.7235,0.46467),
-            QVector3D(0.84949,0.7248,0.46793),
-            QVector3D(0.84954,0.72609,0.4713),
-            QVector3D(0.84958,0.72739,0.47477),
-            QVector3D(0.84958,0.72869,0.47832),
-            QVector3D(0.84956,0.72999,0.48199),
-            QVector3D(0.84952,0.73129,0.48573),
-            QVector3D(0.84945,0.7326,0.48957),
-            QVector3D(0.84935,0.7339,0.49352),
-            QVector3D(0.84922,0.73521,0.49757),
-            QVector3D(0.84907,0.73652,0.5017),
-            QVector3D(0.84889,0.73783,0.50591),
-            QVector3D(0.84868,0.73916,0.51022),
-            QVector3D(0.84848,0.74046,0.51454),
-            QVector3D(0.84828,0.74176,0.51885),
-            QVector3D(0.8481,0.74306,0.52316),
-            QVector3D(0.84792,0.74435,0.52745),
-            QVector3D(0.84775,0.74564,0.53175),
-            QVector3D(0.84759,0.74692,0.53603),
-            QVector3D(0.84743,0.74821,0.54032),
-            QVector3D(0.84727,0.74947,0.5446),
-            QVector3D(0.84712,0.75075,0.54888),
-            QVector3D(0.84698,0.75202,0.55314),
-            QVector3D(0.84684,0.75328,0.55742),
-            QVector3D(0.8467,0.75455,0.56168),
-            QVector3D(0.84656,0.7558,0.56594),
-            QVector3D(0.84643,0.75706,0.57019),
-            QVector3D(0.84629,0.75831,0.57444),
-            QVector3D(0.84616,0.75955,0.5787),
-            QVector3D(0.84603,0.76081,0.58295),
-            QVector3D(0.8459,0.76205,0.58719),
-            QVector3D(0.84577,0.76329,0.59144),
-            QVector3D(0.84564,0.76453,0.59568),
-            QVector3D(0.84551,0.76577,0.59993),
-            QVector3D(0.84537,0.767,0.60417),
-            QVector3D(0.84524,0.76824,0.6084),
-            QVector3D(0.84511,0.76947,0.61263),
-            QVector3D(0.84497,0.77071,0.61687),
-            QVector3D(0.84484,0.77194,0.6211),
-            QVector3D(0.8447,0.77316,0.62533),
-            QVector3D(0.84455,0.77439,0.62955),
-            QVector3D(0.84441,0.77561,0.63379),
-            QVector3D(0.84426,0.77684,0.63801),
-            QVector3D(0.84411,0.77806,0.64224),
-            QVector3D(0.84396,0.77928,0.64646),
-            QVector3D(0.8438,0.7805,0.65068),
-            QVector3D(0.84364,0.78172,0.6549),
-            QVector3D(0.84348,0.78294,0.65912),
-            QVector3D(0.84331,0.78416,0.66335),
-            QVector3D(0.84314,0.78537,0.66757),
-            QVector3D(0.84297,0.78659,0.67179),
-            QVector3D(0.84279,0.7878,0.67601),
-            QVector3D(0.84261,0.78901,0.68022),
-            QVector3D(0.84243,0.79022,0.68444),
-            QVector3D(0.84224,0.79143,0.68867),
-            QVector3D(0.84204,0.79265,0.69289),
-            QVector3D(0.84184,0.79386,0.6971),
-            QVector3D(0.84163,0.79507,0.70132),
-            QVector3D(0.84142,0.79627,0.70554),
-            QVector3D(0.8412,0.79748,0.70976),
-            QVector3D(0.84098,0.79869,0.71398),
-            QVector3D(0.84076,0.7999,0.7182),
-            QVector3D(0.84053,0.8011,0.72241),
-            QVector3D(0.84029,0.80231,0.72663),
-            QVector3D(0.84004,0.80352,0.73085),
-            QVector3D(0.8398,0.80472,0.73508),
-            QVector3D(0.83954,0.80593,0.7393),
-            QVector3D(0.83928,0.80713,0.74352),
-            QVector3D(0.83901,0.80834,0.74774),
-            QVector3D(0.83873,0.80954,0.75196),
-            QVector3D(0.83845,0.81074,0.75618),
-            QVector3D(0.83817,0.81195,0.76041),
-            QVector3D(0.83788,0.81315,0.76463),
-            QVector3D(0.83758,0.81435,0.76885),
-            QVector3D(0.83727,0.81555,0.77308),
-            QVector3D(0.83695,0.81676,0.77731),
-            QVector3D(0.83663,0.81795,0.78154),
-            QVector3D(0.8363,0.81916,0.78577),
-            QVector3D(0.83597,0.82036,0.78999),
-            QVector3D(0.83563,0.82156,0.79422),
-            QVector3D(0.83528,0.82277,0.79845),
-            QVector3D(0.83492,0.82396,0.80268),
-            QVector3D(0.83456,0.82516,0.80692),
-            QVector3D(0.83419,0.82637,0.81115),
-            QVector3D(0.83381,0.82757,0.81538),
-            QVector3D(0.83342,0.82877,0.81962),
-            QVector3D(0.83302,0.82997,0.82386),
-            QVector3D(0.83262,0.83118,0.82809),
-            QVector3D(0.83221,0.83237,0.83233)
-        },
-        {
-            QVector3D(0.0020082,0.082527,0.022201),
-            QVector3D(0.004381,0.08615,0.022118),
-            QVector3D(0.0067598,0.089747,0.022041),
-            QVector3D(0.0091625,0.093124,0.021981),
-            QVector3D(0.011768,0.096433,0.021933),
-            QVector3D(0.014187,0.099686,0.021895),
-            QVector3D(0.016629,0.10283,0.021877),
-            QVector3D(0.019082,0.10587,0.021867),
-            QVector3D(0.021556,0.1088,0.021877),
-            QVector3D(0.024018,0.11172,0.021897),
-            QVector3D(0.026293,0.11459,0.021902),
-            QVector3D(0.028361,0.1176,0.0219),
-            QVector3D(0.030209,0.12061,0.021879),
-            QVector3D(0.031836,0.12368,0.021843),
-            QVector3D(0.033248,0.12681,0.021797),
-            QVector3D(0.03448,0.13002,0.021732),
-            QVector3D(0.035611,0.13318,0.021656),
-            QVector3D(0.036308,0.13639,0.021568),
-            QVector3D(0.036803,0.13965,0.021464),
-            QVector3D(0.037067,0.14299,0.021348),
-            QVector3D(0.037096,0.14631,0.021222),
-            QVector3D(0.036881,0.14971,0.021083),
-            QVector3D(0.036566,0.15305,0.020931),
-            QVector3D(0.036258,0.15648,0.020778),
-            QVector3D(0.035956,0.15982,0.02062),
-            QVector3D(0.035648,0.16326,0.020454),
-            QVector3D(0.03531,0.16666,0.020281),
-            QVector3D(0.034935,0.17007,0.02011),
-            QVector3D(0.034549,0.17347,0.019938),
-            QVector3D(0.034194,0.17689,0.019764),
-            QVector3D(0.0339,0.18031,0.01959),
-            QVector3D(0.033658,0.18374,0.019418),
-            QVector3D(0.03346,0.18719,0.019251),
-            QVector3D(0.033308,0.1906,0.019094),
-            QVector3D(0.033202,0.19407,0.018947),
-            QVector3D(0.033153,0.19748,0.018811),
-            QVector3D(0.033171,0.2009,0.018691),
-            QVector3D(0.033269,0.20438,0.018588),
-            QVector3D(0.033456,0.2078,0.018509),
-            QVector3D(0.033755,0.21125,0.018457),
-            QVector3D(0.034229,0.21467,0.018437),
-            QVector3D(0.03498,0.21811,0.018456),
-            QVector3D(0.03581,0.22154,0.018521),
-            QVector3D(0.036701,0.22495,0.018622),
-            QVector3D(0.037696,0.22842,0.018735),
-            QVector3D(0.038702,0.23186,0.018848),
-            QVector3D(0.039729,0.23531,0.018957),
-            QVector3D(0.040766,0.23875,0.019061),
-            QVector3D(0.041844,0.24222,0.019159),
-            QVector3D(0.042758,0.24568,0.019252),
-            QVector3D(0.043802,0.24918,0.019339),
-            QVector3D(0.044931,0.25267,0.019419),
-            QVector3D(0.045873,0.25616,0.019493),
-            QVector3D(0.047009,0.25968,0.019561),
-            QVector3D(0.047989,0.26319,0.019623),
-            QVector3D(0.049157,0.2667,0.019676),
-            QVector3D(0.050138,0.27025,0.019721),
-            QVector3D(0.051173,0.27378,0.019758),
-            QVector3D(0.052215,0.27732,0.019785),
-            QVector3D(0.053276,0.28085,0.019802),
-            QVector3D(0.054355,0.28442,0.01981),
-            QVector3D(0.055446,0.28799,0.01981),
-            QVector3D(0.056569,0.29158,0.019809),
-            QVector3D(0.057528,0.29515,0.019834),
-            QVector3D(0.058624,0.29874,0.01989),
-            QVector3D(0.059734,0.30233,0.019977),
-            QVector3D(0.06068,0.30596,0.020098),
-            QVector3D(0.061651,0.30957,0.020253),
-            QVector3D(0.062756,0.31318,0.020445),
-            QVector3D(0.063696,0.31681,0.020677),
-            QVector3D(0.064656,0.32045,0.02095),
-            QVector3D(0.065612,0.32408,0.021258),
-            QVector3D(0.066576,0.32773,0.021584),
-            QVector3D(0.067549,0.33138,0.021916),
-            QVector3D(0.068538,0.33506,0.022251),
-            QVector3D(0.06952,0.33872,0.022589),
-            QVector3D(0.070402,0.3424,0.022929),
-            QVector3D(0.071419,0.34607,0.023272),
-            QVector3D(0.072319,0.34977,0.023618),
-            QVector3D(0.073361,0.35346,0.023966),
-            QVector3D(0.074283,0.35718,0.024318),
-            QVector3D(0.075218,0.36087,0.024672),
-            QVector3D(0.076165,0.36459,0.025028),
-            QVector3D(0.077123,0.36832,0.025388),
-            QVector3D(0.078091,0.37204,0.02575),
-            QVector3D(0.079071,0.37578,0.026116),
-            QVector3D(0.080061,0.37952,0.026484),
-            QVector3D(0.081061,0.38328,0.026854),
-            QVector3D(0.082077,0.38702,0.027228),
-            QVector3D(0.082984,0.39079,0.027604),
-            QVector3D(0.084013,0.39456,0.027983),
-            QVector3D(0.084952,0.39834,0.028365),
-            QVector3D(0.085878,0.40211,0.02875),
-            QVector3D(0.086941,0.40591,0.029138),
-            QVector3D(0.087908,0.4097,0.029528),
-            QVector3D(0.088876,0.4135,0.029921),
-            QVector3D(0.089858,0.41731,0.030317),
-            QVector3D(0.090847,0.42111,0.030716),
-            QVector3D(0.091852,0.42494,0.031118),
-            QVector3D(0.092761,0.42876,0.031521),
-            QVector3D(0.093773,0.43259,0.031927),
-            QVector3D(0.094809,0.43643,0.032341),
-            QVector3D(0.09575,0.44027,0.03276),
-            QVector3D(0.096692,0.44412,0.033171),
-            QVector3D(0.097753,0.44796,0.033567),
-            QVector3D(0.098721,0.45183,0.033985),
-            QVector3D(0.099698,0.4557,0.034483),
-            QVector3D(0.10069,0.45957,0.035028),
-            QVector3D(0.10168,0.46344,0.035514),
-            QVector3D(0.10269,0.46733,0.035934),
-            QVector3D(0.1037,0.47122,0.036349),
-            QVector3D(0.10463,0.47512,0.036789),
-            QVector3D(0.10568,0.47902,0.037237),
-            QVector3D(0.10671,0.48292,0.037682),
-            QVector3D(0.10766,0.48683,0.038128),
-            QVector3D(0.10865,0.49076,0.038578),
-            QVector3D(0.10971,0.49468,0.039032),
-            QVector3D(0.11069,0.49861,0.039489),
-            QVector3D(0.11169,0.50254,0.039948),
-            QVector3D(0.1127,0.50648,0.040406),
-            QVector3D(0.11369,0.51042,0.040871),
-            QVector3D(0.11464,0.51438,0.041351),
-            QVector3D(0.11569,0.51834,0.041826),
-            QVector3D(0.1167,0.52229,0.042253),
-            QVector3D(0.11769,0.52627,0.042639),
-            QVector3D(0.11873,0.53024,0.043044),
-            QVector3D(0.1197,0.53421,0.043511),
-            QVector3D(0.1207,0.53821,0.044017),
-            QVector3D(0.1217,0.54219,0.044525),
-            QVector3D(0.12271,0.54619,0.044992),
-            QVector3D(0.12373,0.55018,0.045398),
-            QVector3D(0.12476,0.55419,0.045806),
-            QVector3D(0.12581,0.55819,0.046288),
-            QVector3D(0.12679,0.56222,0.046801),
-            QVector3D(0.12783,0.56624,0.047247),
-            QVector3D(0.12882,0.57026,0.047653),
-            QVector3D(0.12988,0.57429,0.048118),
-            QVector3D(0.13089,0.57833,0.048645),
-            QVector3D(0.1319,0.58237,0.049135),
-            QVector3D(0.13292,0.58642,0.049563),
-            QVector3D(0.13395,0.59047,0.04998),
-            QVector3D(0.13498,0.59453,0.050418),
-            QVector3D(0.13595,0.59859,0.050866),
-            QVector3D(0.13701,0.60266,0.051311),
-            QVector3D(0.13806,0.60673,0.051757),
-            QVector3D(0.13904,0.61081,0.052205),
-            QVector3D(0.14007,0.61488,0.052658),
-            QVector3D(0.14114,0.61898,0.053112),
-            QVector3D(0.14214,0.62307,0.053569),
-            QVector3D(0.14318,0.62716,0.054029),
-            QVector3D(0.14421,0.63127,0.054491),
-            QVector3D(0.14526,0.63537,0.054953),
-            QVector3D(0.14626,0.63949,0.055418),
-            QVector3D(0.1473,0.6436,0.055896),
-            QVector3D(0.14831,0.64772,0.056378),
-            QVector3D(0.14938,0.65185,0.056824),
-            QVector3D(0.15041,0.65599,0.057227),
-            QVector3D(0.15143,0.66012,0.057637),
-            QVector3D(0.15246,0.66426,0.058099),
-            QVector3D(0.15349,0.66841,0.058598),
-            QVector3D(0.15454,0.67256,0.0591),
-            QVector3D(0.1556,0.67671,0.059581),
-            QVector3D(0.15665,0.68086,0.060024),
-            QVector3D(0.15766,0.68503,0.06044),
-            QVector3D(0.15873,0.68921,0.060845),
-            QVector3D(0.15973,0.69338,0.061267),
-            QVector3D(0.1608,0.69755,0.061737),
-            QVector3D(0.16187,0.70173,0.06225),
-            QVector3D(0.16291,0.70593,0.06274),
-            QVector3D(0.16396,0.71012,0.063178),
-            QVector3D(0.16497,0.71431,0.063603),
-            QVector3D(0.16602,0.71852,0.064042),
-            QVector3D(0.1671,0.72272,0.064491),
-            QVector3D(0.16812,0.72693,0.064939),
-            QVector3D(0.16921,0.73115,0.065387),
-            QVector3D(0.17024,0.73537,0.065837),
-            QVector3D(0.17128,0.7396,0.066291),
-            QVector3D(0.17233,0.74382,0.066748),
-            QVector3D(0.17339,0.74806,0.067206),
-            QVector3D(0.17446,0.75229,0.067663),
-            QVector3D(0.1755,0.75654,0.068124),
-            QVector3D(0.17654,0.76078,0.068597),
-            QVector3D(0.17764,0.76504,0.069073),
-            QVector3D(0.17869,0.76929,0.069516),
-            QVector3D(0.17973,0.77355,0.06992),
-            QVector3D(0.18078,0.77782,0.070337),
-            QVector3D(0.18184,0.78209,0.070809),
-            QVector3D(0.1829,0.78636,0.071291),
-            QVector3D(0.18397,0.79063,0.071723),
-            QVector3D(0.18506,0.79491,0.072134),
-            QVector3D(0.18612,0.7992,0.07259),
-            QVector3D(0.18718,0.80349,0.073087),
-            QVector3D(0.18826,0.80779,0.073557),
-            QVector3D(0.1893,0.81208,0.073983),
-            QVector3D(0.19036,0.81639,0.074402),
-            QVector3D(0.19143,0.82069,0.074835),
-            QVector3D(0.1925,0.825,0.075276),
-            QVector3D(0.19359,0.82933,0.075716),
-            QVector3D(0.19467,0.83365,0.076155),
-            QVector3D(0.19571,0.83797,0.076597),
-            QVector3D(0.19681,0.8423,0.077042),
-            QVector3D(0.19786,0.84663,0.077489),
-            QVector3D(0.19892,0.85096,0.077938),
-            QVector3D(0.19999,0.85531,0.078388),
-            QVector3D(0.20106,0.85965,0.078841),
-            QVector3D(0.20215,0.864,0.079296),
-            QVector3D(0.20324,0.86836,0.079753),
-            QVector3D(0.20434,0.87271,0.080211),
-            QVector3D(0.20539,0.87707,0.080669),
-            QVector3D(0.2065,0.88144,0.081135),
-            QVector3D(0.20756,0.88581,0.08161),
-            QVector3D(0.20863,0.89017,0.082069),
-            QVector3D(0.20974,0.89456,0.082489),
-            QVector3D(0.21167,0.8989,0.082885),
-            QVector3D(0.21577,0.90314,0.083267),
-            QVector3D(0.22243,0.90724,0.083619),
-            QVector3D(0.23129,0.91122,0.083917),
-            QVector3D(0.24192,0.91509,0.084156),
-            QVector3D(0.25398,0.91886,0.084342),
-            QVector3D(0.26714,0.92253,0.084483),
-            QVector3D(0.28122,0.92611,0.084587),
-            QVector3D(0.29605,0.92959,0.084656),
-            QVector3D(0.31138,0.93299,0.084696),
-            QVector3D(0.32707,0.93632,0.08471),
-            QVector3D(0.34303,0.93956,0.084701),
-            QVector3D(0.35913,0.94274,0.084672),
-            QVector3D(0.37535,0.94584,0.084623),
-            QVector3D(0.39181,0.94887,0.084553),
-            QVector3D(0.40832,0.95183,0.084465),
-            QVector3D(0.42483,0.95473,0.084363),
-            QVector3D(0.4413,0.95756,0.084247),
-            QVector3D(0.45785,0.96033,0.084113),
-            QVector3D(0.47443,0.96303,0.083964),
-            QVector3D(0.49093,0.96567,0.083803),
-            QVector3D(0.50737,0.96826,0.083635),
-            QVector3D(0.52388,0.97077,0.083456),
-            QVector3D(0.54033,0.97323,0.083278),
-            QVector3D(0.55668,0.97564,0.083106),
-            QVector3D(0.57311,0.97798,0.082937),
-            QVector3D(0.58945,0.98026,0.082777),
-            QVector3D(0.60571,0.98249,0.082624),
-            QVector3D(0.62205,0.98465,0.082472),
-            QVector3D(0.63831,0.98675,0.082325),
-            QVector3D(0.6545,0.9888,0.08218),
-            QVector3D(0.67074,0.99078,0.082035),
-            QVector3D(0.68689,0.99272,0.081896),
-            QVector3D(0.70305,0.99458,0.081762),
-            QVector3D(0.71919,0.99639,0.081638),
-            QVector3D(0.73525,0.99815,0.081527),
-            QVector3D(0.75139,0.99984,0.081428),
-            QVector3D(0.76742,1,0.081347),
-            QVector3D(0.78349,1,0.081282),
-            QVector3D(0.79956,1,0.081236),
-            QVector3D(0.81555,1,0.08121),
-            QVector3D(0.83159,1,0.081204),
-            QVector3D(0.84754,1,0.081223)
-        },
-        {
-            QVector3D(0,0,0),
-            QVector3D(0.0055606,0.0055631,0.0055625),
-            QVector3D(0.011212,0.011219,0.011217),
-            QVector3D(0.016877,0.016885,0.016883),
-            QVector3D(0.022438,0.022448,0.022445),
-            QVector3D(0.027998,0.028011,0.028008),
-            QVector3D(0.03354,0.033554,0.033551),
-            QVector3D(0.039316,0.039333,0.039329),
-            QVector3D(0.0447,0.044719,0.044714),
-            QVector3D(0.049695,0.049713,0.049709),
-            QVector3D(0.054322,0.054343,0.054338),
-            QVector3D(0.058797,0.058821,0.058815),
-            QVector3D(0.063041,0.063062,0.063057),
-            QVector3D(0.066996,0.067019,0.067014),
-            QVector3D(0.070827,0.070853,0.070846),
-            QVector3D(0.074487,0.074511,0.074505),
-            QVector3D(0.077967,0.077992,0.077986),
-            QVector3D(0.081449,0.081477,0.08147),
-            QVector3D(0.084728,0.084752,0.084746),
-            QVector3D(0.087913,0.087939,0.087933),
-            QVector3D(0.091003,0.091031,0.091024),
-            QVector3D(0.094004,0.094034,0.094027),
-            QVector3D(0.096981,0.097012,0.097005),
-            QVector3D(0.10004,0.10007,0.10006),
-            QVector3D(0.10311,0.10314,0.10314),
-            QVector3D(0.10618,0.10621,0.1062),
-            QVector3D(0.10924,0.10928,0.10927),
-            QVector3D(0.11232,0.11235,0.11234),
-            QVector3D(0.11538,0.11541,0.1154),
-            QVector3D(0.11852,0.11855,0.11854),
-            QVector3D(0.12157,0.1216,0.12159),
-            QVector3D(0.12471,0.12474,0.12473),
-            QVector3D(0.12787,0.1279,0.12789),
-            QVector3D(0.13102,0.13105,0.13105),
-            QVector3D(0.13418,0.13421,0.1342),
-            QVector3D(0.13734,0.13738,0.13737),
-            QVector3D(0.14051,0.14055,0.14054),
-            QVector3D(0.1437,0.14373,0.14372),
-            QVector3D(0.14687,0.14691,0.1469),
-            QVector3D(0.15011,0.15015,0.15014),
-            QVector3D(0.15329,0.15333,0.15332),
-            QVector3D(0.15656,0.15659,0.15659),
-            QVector3D(0.15975,0.15979,0.15978),
-            QVector3D(0.16304,0.16308,0.16307),
-            QVector3D(0.16628,0.16632,0.16631),
-            QVector3D(0.16957,0.16961,0.1696),
-            QVector3D(0.17281,0.17286,0.17285),
-            QVector3D(0.17608,0.17612,0.17611),
-            QVector3D(0.1794,0.17944,0.17943),
-            QVector3D(0.18269,0.18273,0.18272),
-            QVector3D(0.18604,0.18608,0.18607),
-            QVector3D(0.18934,0.18939,0.18938),
-            QVector3D(0.19267,0.19272,0.19271),
-            QVector3D(0.19602,0.19607,0.19606),
-            QVector3D(0.19934,0.19939,0.19938),
-            QVector3D(0.20271,0.20276,0.20275),
-            QVector3D(0.20611,0.20616,0.20615),
-            QVector3D(0.20946,0.20951,0.2095),
-            QVector3D(0.21284,0.21289,0.21288),
-            QVector3D(0.21626,0.21632,0.2163),
-            QVector3D(0.21965,0.2197,0.21969),
-            QVector3D(0.22307,0.22312,0.22311),
-            QVector3D(0.22649,0.22654,0.22653),
-            QVector3D(0.22988,0.22994,0.22992),
-            QVector3D(0.23332,0.23337,0.23336),
-            QVector3D(0.2368,0.23685,0.23684),
-            QVector3D(0.24022,0.24027,0.24026),
-            QVector3D(0.24368,0.24373,0.24372),
-            QVector3D(0.24716,0.24722,0.2472),
-            QVector3D(0.25063,0.25069,0.25067),
-            QVector3D(0.25412,0.25418,0.25417),
-            QVector3D(0.2576,0.25766,0.25765),
-            QVector3D(0.26111,0.26117,0.26115),
-            QVector3D(0.26461,0.26467,0.26465),
-            QVector3D(0.26812,0.26818,0.26817),
-            QVector3D(0.27164,0.2717,0.27168),
-            QVector3D(0.27518,0.27525,0.27523),
-            QVector3D(0.27872,0.27879,0.27877),
-            QVector3D(0.28227,0.28234,0.28232),
-            QVector3D(0.2858,0.28587,0.28585),
-            QVector3D(0.28938,0.28945,0.28943),
-            QVector3D(0.29294,0.293,0.29298),
-            QVector3D(0.29652,0.29659,0.29657),
-            QVector3D(0.30009,0.30016,0.30014),
-            QVector3D(0.30368,0.30375,0.30373),
-            QVector3D(0.30728,0.30734,0.30733),
-            QVector3D(0.3109,0.31096,0.31095),
-            QVector3D(0.31449,0.31456,0.31454),
-            QVector3D(0.31811,0.31819,0.31817),
-            QVector3D(0.32173,0.32181,0.32179),
-            QVector3D(0.32536,0.32543,0.32542),
-            QVector3D(0.32902,0.32909,0.32907),
-            QVector3D(0.33267,0.33274,0.33272),
-            QVector3D(0.3363,0.33638,0.33636),
-            QVector3D(0.33997,0.34005,0.34003),
-            QVector3D(0.34363,0.3437,0.34369),
-            QVector3D(0.34731,0.34739,0.34737),
-            QVector3D(0.35099,0.35107,0.35105),
-            QVector3D(0.35468,0.35476,0.35474),
-            QVector3D(0.35836,0.35844,0.35842),
-            QVector3D(0.36207,0.36214,0.36212),
-            QVector3D(0.36577,0.36585,0.36583),
-            QVector3D(0.36948,0.36956,0.36954),
-            QVector3D(0.37319,0.37328,0.37326),
-            QVector3D(0.37693,0.37701,0.37699),
-            QVector3D(0.38066,0.38074,0.38072),
-            QVector3D(0.38439,0.38447,0.38445),
-            QVector3D(0.38814,0.38822,0.3882),
-            QVector3D(0.39189,0.39197,0.39195),
-            QVector3D(0.39565,0.39574,0.39572),
-            QVector3D(0.3994,0.39949,0.39946),
-            QVector3D(0.40318,0.40327,0.40325),
-            QVector3D(0.40695,0.40704,0.40702),
-            QVector3D(0.41074,0.41083,0.41081),
-            QVector3D(0.41452,0.41461,0.41459),
-            QVector3D(0.41831,0.4184,0.41838),
-            QVector3D(0.42211,0.4222,0.42218),
-            QVector3D(0.42592,0.42601,0.42599),
-            QVector3D(0.42974,0.42983,0.42981),
-            QVector3D(0.43355,0.43364,0.43362),
-            QVector3D(0.43739,0.43748,0.43746),
-            QVector3D(0.44121,0.44131,0.44128),
-            QVector3D(0.44505,0.44515,0.44512),
-            QVector3D(0.4489,0.449,0.44897),
-            QVector3D(0.45275,0.45284,0.45282),
-            QVector3D(0.45659,0.45669,0.45667),
-            QVector3D(0.46045,0.46055,0.46052),
-            QVector3D(0.46433,0.46443,0.46441),
-            QVector3D(0.46819,0.46829,0.46826),
-            QVector3D(0.47208,0.47218,0.47215),
-            QVector3D(0.47596,0.47606,0.47603),
-            QVector3D(0.47985,0.47995,0.47992),
-            QVector3D(0.48373,0.48383,0.48381),
-            QVector3D(0.48764,0.48775,0.48772),
-            QVector3D(0.49155,0.49165,0.49163),
-            QVector3D(0.49545,0.49556,0.49553),
-            QVector3D(0.49936,0.49947,0.49944),
-            QVector3D(0.50329,0.50339,0.50337),
-            QVector3D(0.50722,0.50733,0.5073),
-            QVector3D(0.51115,0.51126,0.51123),
-            QVector3D(0.51509,0.5152,0.51517),
-            QVector3D(0.51904,0.51915,0.51912),
-            QVector3D(0.52299,0.5231,0.52307),
-            QVector3D(0.52695,0.52706,0.52703),
-            QVector3D(0.5309,0.53101,0.53099),
-            QVector3D(0.53487,0.53498,0.53495),
-            QVector3D(0.53884,0.53895,0.53893),
-            QVector3D(0.54282,0.54293,0.5429),
-            QVector3D(0.5468,0.54691,0.54688),
-            QVector3D(0.55078,0.5509,0.55087),
-            QVector3D(0.55478,0.55489,0.55486),
-            QVector3D(0.55877,0.55888,0.55886),
-            QVector3D(0.56278,0.5629,0.56287),
-            QVector3D(0.56679,0.56691,0.56688),
-            QVector3D(0.57079,0.57091,0.57088),
-            QVector3D(0.57481,0.57493,0.5749),
-            QVector3D(0.57884,0.57896,0.57893),
-            QVector3D(0.58286,0.58298,0.58295),
-            QVector3D(0.5869,0.58702,0.58699),
-            QVector3D(0.59094,0.59106,0.59103),
-            QVector3D(0.59498,0.5951,0.59507),
-            QVector3D(0.59903,0.59916,0.59913),
-            QVector3D(0.60309,0.60321,0.60318),
-            QVector3D(0.60715,0.60728,0.60724),
-            QVector3D(0.61121,0.61134,0.61131),
-            QVector3D(0.61527,0.6154,0.61537),
-            QVector3D(0.61936,0.61948,0.61945),
-            QVector3D(0.62343,0.62356,0.62353),
-            QVector3D(0.62751,0.62764,0.62761),
-            QVector3D(0.6316,0.63173,0.6317),
-            QVector3D(0.63569,0.63583,0.63579),
-            QVector3D(0.6398,0.63993,0.63989),
-            QVector3D(0.64389,0.64402,0.64399),
-            QVector3D(0.648,0.64813,0.6481),
-            QVector3D(0.65212,0.65225,0.65222),
-            QVector3D(0.65624,0.65637,0.65634),
-            QVector3D(0.66035,0.66049,0.66045),
-            QVector3D(0.66448,0.66461,0.66458),
-            QVector3D(0.66862,0.66875,0.66872),
-            QVector3D(0.67275,0.67289,0.67286),
-            QVector3D(0.6769,0.67703,0.677),
-            QVector3D(0.68103,0.68117,0.68114),
-            QVector3D(0.68519,0.68533,0.6853),
-            QVector3D(0.68935,0.68949,0.68945),
-            QVector3D(0.6935,0.69364,0.69361),
-            QVector3D(0.69766,0.69781,0.69777),
-            QVector3D(0.70183,0.70197,0.70194),
-            QVector3D(0.70601,0.70616,0.70612),
-            QVector3D(0.71019,0.71033,0.7103),
-            QVector3D(0.71437,0.71451,0.71448),
-            QVector3D(0.71855,0.7187,0.71867),
-            QVector3D(0.72274,0.72289,0.72286),
-            QVector3D(0.72694,0.72709,0.72706),
-            QVector3D(0.73114,0.73129,0.73126),
-            QVector3D(0.73535,0.7355,0.73546),
-            QVector3D(0.73957,0.73972,0.73968),
-            QVector3D(0.74378,0.74393,0.74389),
-            QVector3D(0.748,0.74815,0.74811),
-            QVector3D(0.75222,0.75237,0.75233),
-            QVector3D(0.75644,0.7566,0.75656),
-            QVector3D(0.76068,0.76083,0.76079),
-            QVector3D(0.76492,0.76507,0.76503),
-            QVector3D(0.76915,0.76931,0.76927),
-            QVector3D(0.7734,0.77355,0.77351),
-            QVector3D(0.77765,0.77781,0.77777),
-            QVector3D(0.78191,0.78206,0.78202),
-            QVector3D(0.78616,0.78632,0.78628),
-            QVector3D(0.79042,0.79058,0.79054),
-            QVector3D(0.79469,0.79485,0.79481),
-            QVector3D(0.79896,0.79913,0.79909),
-            QVector3D(0.80323,0.8034,0.80336),
-            QVector3D(0.80752,0.80768,0.80764),
-            QVector3D(0.8118,0.81196,0.81192),
-            QVector3D(0.81609,0.81626,0.81621),
-            QVector3D(0.82038,0.82054,0.8205),
-            QVector3D(0.82467,0.82484,0.8248),
-            QVector3D(0.82898,0.82915,0.82911),
-            QVector3D(0.83328,0.83345,0.83341),
-            QVector3D(0.83759,0.83776,0.83772),
-            QVector3D(0.84191,0.84208,0.84204),
-            QVector3D(0.84622,0.84639,0.84635),
-            QVector3D(0.85054,0.85071,0.85067),
-            QVector3D(0.85487,0.85504,0.855),
-            QVector3D(0.8592,0.85937,0.85933),
-            QVector3D(0.86354,0.86371,0.86367),
-            QVector3D(0.86787,0.86805,0.86801),
-            QVector3D(0.87222,0.87239,0.87235),
-            QVector3D(0.87656,0.87673,0.87669),
-            QVector3D(0.88091,0.88109,0.88104),
-            QVector3D(0.88527,0.88544,0.8854),
-            QVector3D(0.88962,0.8898,0.88976),
-            QVector3D(0.89399,0.89417,0.89412),
-            QVector3D(0.89835,0.89853,0.89849),
-            QVector3D(0.90272,0.90291,0.90286),
-            QVector3D(0.9071,0.90728,0.90724),
-            QVector3D(0.91148,0.91166,0.91161),
-            QVector3D(0.91585,0.91604,0.91599),
-            QVector3D(0.92024,0.92043,0.92038),
-            QVector3D(0.92463,0.92482,0.92477),
-            QVector3D(0.92903,0.92921,0.92917),
-            QVector3D(0.93342,0.93361,0.93356),
-            QVector3D(0.93783,0.93802,0.93797),
-            QVector3D(0.94224,0.94243,0.94238),
-            QVector3D(0.94664,0.94683,0.94679),
-            QVector3D(0.95106,0.95125,0.9512),
-            QVector3D(0.95548,0.95567,0.95562),
-            QVector3D(0.9599,0.96009,0.96004),
-            QVector3D(0.96432,0.96451,0.96446),
-            QVector3D(0.96875,0.96894,0.9689),
-            QVector3D(0.97318,0.97338,0.97333),
-            QVector3D(0.97762,0.97781,0.97777),
-            QVector3D(0.98206,0.98226,0.98221),
-            QVector3D(0.98651,0.9867,0.98666),
-            QVector3D(0.99095,0.99115,0.9911),
-            QVector3D(0.9954,0.9956,0.99555),
-            QVector3D(0.99986,1,1)
-        },
-        {
-            QVector3D(0.066001,0.066024,0.066019),
-            QVector3D(0.080835,0.066624,0.064683),
-            QVector3D(0.093644,0.067235,0.063358),
-            QVector3D(0.10501,0.067862,0.061943),
-            QVector3D(0.11533,0.068524,0.060589),
-            QVector3D(0.12493,0.06913,0.059252),
-            QVector3D(0.13446,0.069402,0.057766),
-            QVector3D(0.14389,0.069337,0.05652),
-            QVector3D(0.15329,0.068912,0.055114),
-            QVector3D(0.16265,0.068217,0.053762),
-            QVector3D(0.17186,0.067393,0.052418),
-            QVector3D(0.18101,0.066415,0.051087),
-            QVector3D(0.19008,0.065312,0.049777),
-            QVector3D(0.19905,0.064056,0.04839),
-            QVector3D(0.208,0.06267,0.047034),
-            QVector3D(0.21686,0.060979,0.045586),
-            QVector3D(0.22565,0.059301,0.04424),
-            QVector3D(0.2344,0.057256,0.042784),
-            QVector3D(0.24306,0.055098,0.041497),
-            QVector3D(0.2517,0.05272,0.040051),
-            QVector3D(0.26025,0.050192,0.038638),
-            QVector3D(0.26877,0.047379,0.037249),
-            QVector3D(0.27721,0.044339,0.035898),
-            QVector3D(0.28558,0.041067,0.034375),
-            QVector3D(0.2939,0.0375,0.03304),
-            QVector3D(0.30215,0.033602,0.031743),
-            QVector3D(0.31036,0.029855,0.030482),
-            QVector3D(0.31847,0.026015,0.029246),
-            QVector3D(0.32649,0.022146,0.028041),
-            QVector3D(0.33446,0.018274,0.026868),
-            QVector3D(0.34231,0.014418,0.025725),
-            QVector3D(0.35006,0.010378,0.024615),
-            QVector3D(0.35772,0.0066727,0.023538),
-            QVector3D(0.36524,0.0030611,0.022497),
-            QVector3D(0.37265,0,0.021492),
-            QVector3D(0.37993,0,0.020527),
-            QVector3D(0.38704,0,0.019604),
-            QVector3D(0.39401,0,0.018725),
-            QVector3D(0.40079,0,0.017895),
-            QVector3D(0.40735,0,0.017114),
-            QVector3D(0.41371,0,0.016389),
-            QVector3D(0.41991,0,0.01571),
-            QVector3D(0.42607,0,0.015054),
-            QVector3D(0.43225,0,0.014413),
-            QVector3D(0.43842,0,0.013785),
-            QVector3D(0.44461,0,0.013163),
-            QVector3D(0.4508,0,0.01258),
-            QVector3D(0.45699,0,0.012015),
-            QVector3D(0.46319,0,0.011343),
-            QVector3D(0.46943,0,0.01065),
-            QVector3D(0.47565,0,0.010097),
-            QVector3D(0.48187,0,0.0095904),
-            QVector3D(0.48811,0,0.0090697),
-            QVector3D(0.49436,0,0.0085559),
-            QVector3D(0.5006,0,0.0080597),
-            QVector3D(0.50686,0,0.0075745),
-            QVector3D(0.51313,0,0.0071),
-            QVector3D(0.5194,0,0.0066376),
-            QVector3D(0.52568,0,0.0061855),
-            QVector3D(0.53196,0,0.0057427),
-            QVector3D(0.53826,0,0.0053086),
-            QVector3D(0.54455,0,0.0048845),
-            QVector3D(0.55086,0,0.0044712),
-            QVector3D(0.55718,0,0.004067),
-            QVector3D(0.5635,0,0.0036703),
-            QVector3D(0.56981,0,0.003281),
-            QVector3D(0.57615,0,0.0028993),
-            QVector3D(0.58248,0,0.002527),
-            QVector3D(0.58883,0,0.0021643),
-            QVector3D(0.5952,0,0.0018102),
-            QVector3D(0.60158,0,0.0014648),
-            QVector3D(0.60799,0,0.0011281),
-            QVector3D(0.6144,0,0.0008024),
-            QVector3D(0.62084,0,0.00048773),
-            QVector3D(0.62729,0,0.00018111),
-            QVector3D(0.63377,0,0),
-            QVector3D(0.64026,0,0),
-            QVector3D(0.64676,0,0),
-            QVector3D(0.65328,0,0),
-            QVector3D(0.65983,0,0),
-            QVector3D(0.66638,0,0),
-            QVector3D(0.67297,0,0),
-            QVector3D(0.67955,0,0),
-            QVector3D(0.68617,0,0),
-            QVector3D(0.6928,0,0),
-            QVector3D(0.69944,0,0),
-            QVector3D(0.70611,0,0),
-            QVector3D(0.71279,0,0),
-            QVector3D(0.7195,0,0),
-            QVector3D(0.72621,0,0),
-            QVector3D(0.73295,0,0),
-            QVector3D(0.7397,0,0),
-            QVector3D(0.74647,0,0),
-            QVector3D(0.75325,0,0),
-            QVector3D(0.76005,0,0),
-            QVector3D(0.76685,0,0),
-            QVector3D(0.77364,0,0),
-            QVector3D(0.78042,0,0),
-            QVector3D(0.78719,0,0),
-            QVector3D(0.79394,0,0),
-            QVector3D(0.80067,0,0),
-            QVector3D(0.8074,0,0),
-            QVector3D(0.8141,0,0),
-            QVector3D(0.8208,0,0),
-            QVector3D(0.82748,0,0),
-            QVector3D(0.83414,0,0),
-            QVector3D(0.84079,0,0),
-            QVector3D(0.84742,0,0),
-            QVector3D(0.85404,0,0),
-            QVector3D(0.86065,0,0),
-            QVector3D(0.86723,0,0),
-            QVector3D(0.8738,0,0),
-            QVector3D(0.88036,0,0),
-            QVector3D(0.8869,0,0),
-            QVector3D(0.89342,0,0),
-            QVector3D(0.89993,0,0),
-            QVector3D(0.90642,0,0),
-            QVector3D(0.91289,0,0),
-            QVector3D(0.91935,0,0),
-            QVector3D(0.92579,0.0041866,0),
-            QVector3D(0.93221,0.0088411,0),
-            QVector3D(0.93858,0.014235,0),
-            QVector3D(0.94484,0.020592,0),
-            QVector3D(0.9509,0.028663,0),
-            QVector3D(0.95676,0.038768,0),
-            QVector3D(0.96242,0.049864,0),
-            QVector3D(0.96787,0.061034,0),
-            QVector3D(0.97311,0.072263,0),
-            QVector3D(0.97815,0.083447,0),
-            QVector3D(0.983,0.094617,0),
-            QVector3D(0.98764,0.10571,0),
-            QVector3D(0.99205,0.11685,0),
-            QVector3D(0.99626,0.12797,0),
-            QVector3D(1,0.139,0),
-            QVector3D(1,0.15006,0),
-            QVector3D(1,0.16105,0),
-            QVector3D(1,0.17204,0),
-            QVector3D(1,0.18303,0),
-            QVector3D(1,0.19402,0),
-            QVector3D(1,0.20493,0),
-            QVector3D(1,0.21586,0),
-            QVector3D(1,0.22677,0),
-            QVector3D(1,0.23768,0),
-            QVector3D(1,0.24857,0),
-            QVector3D(1,0.25943,0),
-            QVector3D(1,0.27027,0),
-            QVector3D(1,0.28108,0),
-            QVector3D(1,0.29193,0),
-            QVector3D(1,0.30267,0),
-            QVector3D(1,0.31323,0),
-            QVector3D(1,0.32352,0),
-            QVector3D(1,0.33356,0),
-            QVector3D(1,0.34337,0),
-            QVector3D(1,0.35298,0),
-            QVector3D(1,0.3624,0),
-            QVector3D(1,0.37164,0.00061699),
-            QVector3D(1,0.38075,0.0021825),
-            QVector3D(1,0.38968,0.0037567),
-            QVector3D(1,0.3985,0.0053395),
-            QVector3D(1,0.40718,0.0069314),
-            QVector3D(1,0.41575,0.0085283),
-            QVector3D(1,0.4242,0.010112),
-            QVector3D(1,0.43257,0.011953),
-            QVector3D(1,0.44081,0.013525),
-            QVector3D(1,0.44899,0.015122),
-            QVector3D(1,0.45706,0.016714),
-            QVector3D(1,0.46506,0.018299),
-            QVector3D(1,0.47298,0.019872),
-            QVector3D(1,0.48083,0.021427),
-            QVector3D(1,0.48862,0.022968),
-            QVector3D(1,0.49633,0.024493),
-            QVector3D(1,0.504,0.026001),
-            QVector3D(1,0.51159,0.027485),
-            QVector3D(1,0.51914,0.028939),
-            QVector3D(1,0.52664,0.030367),
-            QVector3D(1,0.53406,0.03178),
-            QVector3D(1,0.54143,0.033208),
-            QVector3D(1,0.54875,0.034768),
-            QVector3D(1,0.55598,0.036315),
-            QVector3D(1,0.56318,0.037812),
-            QVector3D(1,0.5703,0.039323),
-            QVector3D(1,0.57737,0.040851),
-            QVector3D(1,0.58439,0.04235),
-            QVector3D(1,0.59136,0.043767),
-            QVector3D(1,0.59828,0.045295),
-            QVector3D(1,0.60516,0.046771),
-            QVector3D(1,0.61199,0.048174),
-            QVector3D(1,0.61878,0.049666),
-            QVector3D(1,0.62552,0.051026),
-            QVector3D(1,0.63222,0.0524),
-            QVector3D(1,0.63889,0.053786),
-            QVector3D(1,0.64551,0.055176),
-            QVector3D(1,0.65211,0.056589),
-            QVector3D(1,0.65866,0.057815),
-            QVector3D(1,0.66518,0.05925),
-            QVector3D(1,0.67167,0.060511),
-            QVector3D(1,0.67814,0.061743),
-            QVector3D(1,0.68456,0.063098),
-            QVector3D(1,0.69095,0.064301),
-            QVector3D(1,0.69731,0.065521),
-            QVector3D(1,0.70365,0.066739),
-            QVector3D(1,0.70997,0.068288),
-            QVector3D(1,0.71622,0.071897),
-            QVector3D(1,0.72231,0.079934),
-            QVector3D(1,0.72829,0.091953),
-            QVector3D(1,0.73416,0.10627),
-            QVector3D(1,0.73994,0.12182),
-            QVector3D(1,0.74564,0.13819),
-            QVector3D(1,0.75128,0.1548),
-            QVector3D(1,0.75686,0.17158),
-            QVector3D(1,0.76238,0.18858),
-            QVector3D(1,0.76786,0.20562),
-            QVector3D(1,0.7733,0.22256),
-            QVector3D(1,0.77871,0.23945),
-            QVector3D(1,0.7841,0.2564),
-            QVector3D(1,0.78945,0.27335),
-            QVector3D(1,0.79478,0.29018),
-            QVector3D(1,0.80008,0.30712),
-            QVector3D(1,0.80537,0.32404),
-            QVector3D(1,0.81064,0.34096),
-            QVector3D(1,0.81591,0.35795),
-            QVector3D(1,0.82116,0.37487),
-            QVector3D(1,0.8264,0.39194),
-            QVector3D(1,0.83163,0.40902),
-            QVector3D(1,0.83685,0.42615),
-            QVector3D(1,0.84207,0.44336),
-            QVector3D(1,0.84727,0.4606),
-            QVector3D(1,0.85249,0.47795),
-            QVector3D(1,0.85769,0.49533),
-            QVector3D(1,0.8629,0.51282),
-            QVector3D(1,0.86811,0.53035),
-            QVector3D(1,0.87331,0.54803),
-            QVector3D(1,0.87852,0.56571),
-            QVector3D(1,0.88373,0.58356),
-            QVector3D(1,0.88894,0.60144),
-            QVector3D(1,0.89415,0.61947),
-            QVector3D(1,0.89937,0.63753),
-            QVector3D(1,0.9046,0.65574),
-            QVector3D(1,0.90983,0.67401),
-            QVector3D(1,0.91506,0.69239),
-            QVector3D(1,0.9203,0.71087),
-            QVector3D(1,0.92556,0.72942),
-            QVector3D(1,0.93081,0.74812),
-            QVector3D(1,0.93608,0.76684),
-            QVector3D(1,0.94135,0.78577),
-            QVector3D(1,0.94664,0.80471),
-            QVector3D(1,0.95193,0.82381),
-            QVector3D(1,0.95723,0.84299),
-            QVector3D(1,0.96255,0.86225),
-            QVector3D(1,0.96787,0.88166),
-            QVector3D(1,0.97321,0.90108),
-            QVector3D(1,0.97856,0.92074),
-            QVector3D(1,0.98392,0.94042),
-            QVector3D(1,0.98928,0.96017),
-            QVector3D(1,0.99466,0.98008),
-            QVector3D(0.99986,1,1)
-        },
-        {
-            QVector3D(0.066001,0.066024,0.066019),
-            QVector3D(0.07965,0.066744,0.064745),
-            QVector3D(0.091664,0.06747,0.063475),
-            QVector3D(0.10228,0.068214,0.06216),
-            QVector3D(0.112,0.068994,0.060816),
-            QVector3D(0.12092,0.069706,0.059585),
-            QVector3D(0.12971,0.070185,0.058154),
-            QVector3D(0.13843,0.07042,0.05692),
-            QVector3D(0.14709,0.070382,0.055604),
-            QVector3D(0.15576,0.07009,0.054295),
-            QVector3D(0.16433,0.069694,0.052994),
-            QVector3D(0.17278,0.069179,0.051712),
-            QVector3D(0.18118,0.068484,0.050432),
-            QVector3D(0.18954,0.067685,0.049199),
-            QVector3D(0.1978,0.066788,0.047758),
-            QVector3D(0.20605,0.065769,0.046454),
-            QVector3D(0.2142,0.064648,0.045151),
-            QVector3D(0.2223,0.063428,0.043725),
-            QVector3D(0.23036,0.062012,0.042429),
-            QVector3D(0.23838,0.060521,0.04109),
-            QVector3D(0.24634,0.058898,0.039699),
-            QVector3D(0.25428,0.057101,0.038324),
-            QVector3D(0.26215,0.055158,0.036964),
-            QVector3D(0.26998,0.053082,0.035663),
-            QVector3D(0.27773,0.050917,0.034117),
-            QVector3D(0.28544,0.048622,0.032846),
-            QVector3D(0.29312,0.046013,0.031565),
-            QVector3D(0.30072,0.043344,0.030323),
-            QVector3D(0.30827,0.040658,0.029105),
-            QVector3D(0.31576,0.037722,0.02791),
-            QVector3D(0.32318,0.034637,0.02674),
-            QVector3D(0.33052,0.031576,0.025595),
-            QVector3D(0.33779,0.028628,0.024479),
-            QVector3D(0.34497,0.025745,0.023396),
-            QVector3D(0.35205,0.022943,0.022345),
-            QVector3D(0.35905,0.020248,0.021325),
-            QVector3D(0.36595,0.017697,0.02034),
-            QVector3D(0.37272,0.015331,0.01939),
-            QVector3D(0.37938,0.01319,0.01848),
-            QVector3D(0.38589,0.01125,0.017611),
-            QVector3D(0.39225,0.0096476,0.016788),
-            QVector3D(0.39845,0.0085386,0.016013),
-            QVector3D(0.40447,0.0079151,0.015288),
-            QVector3D(0.41036,0.0076915,0.014615),
-            QVector3D(0.41618,0.0076329,0.013987),
-            QVector3D(0.42199,0.007602,0.01339),
-            QVector3D(0.42783,0.0075831,0.012837),
-            QVector3D(0.43365,0.0075764,0.012347),
-            QVector3D(0.4395,0.0075827,0.011859),
-            QVector3D(0.44534,0.0076027,0.011316),
-            QVector3D(0.4512,0.0076373,0.010796),
-            QVector3D(0.45705,0.0076872,0.010385),
-            QVector3D(0.46291,0.0077536,0.010055),
-            QVector3D(0.46879,0.0078379,0.0097685),
-            QVector3D(0.47467,0.0079404,0.0095068),
-            QVector3D(0.48054,0.0080616,0.0092717),
-            QVector3D(0.48643,0.0082023,0.0090674),
-            QVector3D(0.49232,0.0083637,0.0088963),
-            QVector3D(0.49823,0.0085472,0.008759),
-            QVector3D(0.50414,0.0087542,0.0086553),
-            QVector3D(0.51004,0.008987,0.0085858),
-            QVector3D(0.51595,0.0092456,0.0085516),
-            QVector3D(0.52187,0.0095265,0.0085507),
-            QVector3D(0.5278,0.0098238,0.0085815),
-            QVector3D(0.53373,0.010138,0.0086438),
-            QVector3D(0.53967,0.010498,0.0087375),
-            QVector3D(0.54563,0.010949,0.0088628),
-            QVector3D(0.55158,0.011488,0.0090195),
-            QVector3D(0.55753,0.012012,0.0092082),
-            QVector3D(0.56349,0.012487,0.0094284),
-            QVector3D(0.56945,0.012988,0.0096743),
-            QVector3D(0.57543,0.013545,0.009933),
-            QVector3D(0.5814,0.014124,0.010192),
-            QVector3D(0.5874,0.014709,0.010451),
-            QVector3D(0.59341,0.015309,0.010717),
-            QVector3D(0.59942,0.015921,0.010993),
-            QVector3D(0.60544,0.016546,0.011263),
-            QVector3D(0.61149,0.017183,0.011511),
-            QVector3D(0.61754,0.017832,0.011726),
-            QVector3D(0.62361,0.018494,0.011906),
-            QVector3D(0.62967,0.019169,0.012055),
-            QVector3D(0.63576,0.019858,0.012179),
-            QVector3D(0.64186,0.020559,0.01228),
-            QVector3D(0.64796,0.021273,0.012363),
-            QVector3D(0.65409,0.022,0.012427),
-            QVector3D(0.66022,0.022741,0.012473),
-            QVector3D(0.66635,0.023496,0.012501),
-            QVector3D(0.67251,0.024264,0.012512),
-            QVector3D(0.67867,0.025046,0.012503),
-            QVector3D(0.68485,0.025842,0.012477),
-            QVector3D(0.69103,0.026652,0.012431),
-            QVector3D(0.69722,0.027476,0.012369),
-            QVector3D(0.70343,0.028316,0.012312),
-            QVector3D(0.70965,0.02917,0.012261),
-            QVector3D(0.71588,0.030041,0.012218),
-            QVector3D(0.7221,0.030928,0.012182),
-            QVector3D(0.72835,0.031827,0.012155),
-            QVector3D(0.73461,0.032755,0.012137),
-            QVector3D(0.74086,0.033657,0.012129),
-            QVector3D(0.74714,0.034746,0.01213),
-            QVector3D(0.7534,0.035909,0.012143),
-            QVector3D(0.75965,0.037152,0.012168),
-            QVector3D(0.76588,0.038639,0.012207),
-            QVector3D(0.77207,0.040359,0.012259),
-            QVector3D(0.77825,0.042283,0.012323),
-            QVector3D(0.7844,0.044355,0.0124),
-            QVector3D(0.79052,0.046616,0.012491),
-            QVector3D(0.79662,0.049121,0.012597),
-            QVector3D(0.80269,0.051607,0.01272),
-            QVector3D(0.80874,0.054357,0.012862),
-            QVector3D(0.81476,0.057256,0.013025),
-            QVector3D(0.82076,0.060328,0.013209),
-            QVector3D(0.82673,0.063454,0.013414),
-            QVector3D(0.83267,0.066671,0.01364),
-            QVector3D(0.83859,0.070023,0.013884),
-            QVector3D(0.84448,0.073512,0.014147),
-            QVector3D(0.85034,0.076937,0.014432),
-            QVector3D(0.85618,0.080598,0.014739),
-            QVector3D(0.86199,0.084349,0.015072),
-            QVector3D(0.86776,0.088098,0.015429),
-            QVector3D(0.87351,0.09196,0.015811),
-            QVector3D(0.87924,0.095821,0.016218),
-            QVector3D(0.88494,0.099784,0.016653),
-            QVector3D(0.89061,0.10383,0.017114),
-            QVector3D(0.89625,0.10787,0.017605),
-            QVector3D(0.90186,0.11205,0.018127),
-            QVector3D(0.90744,0.11624,0.018679),
-            QVector3D(0.91299,0.12043,0.019262),
-            QVector3D(0.91846,0.12485,0.019871),
-            QVector3D(0.92381,0.12964,0.020493),
-            QVector3D(0.92898,0.13485,0.021122),
-            QVector3D(0.93399,0.14044,0.02176),
-            QVector3D(0.93881,0.14642,0.022407),
-            QVector3D(0.94345,0.15278,0.023063),
-            QVector3D(0.94791,0.15946,0.023731),
-            QVector3D(0.95218,0.16642,0.024411),
-            QVector3D(0.95628,0.17361,0.025105),
-            QVector3D(0.9602,0.18101,0.025814),
-            QVector3D(0.96394,0.18866,0.026541),
-            QVector3D(0.9675,0.19646,0.027287),
-            QVector3D(0.97086,0.20443,0.028053),
-            QVector3D(0.97403,0.21254,0.028843),
-            QVector3D(0.97702,0.22083,0.029658),
-            QVector3D(0.97982,0.22918,0.0305),
-            QVector3D(0.98243,0.23769,0.031373),
-            QVector3D(0.98485,0.24624,0.032279),
-            QVector3D(0.98708,0.25493,0.03322),
-            QVector3D(0.98911,0.26367,0.034197),
-            QVector3D(0.99095,0.27247,0.035441),
-            QVector3D(0.99259,0.28137,0.036475),
-            QVector3D(0.99402,0.29032,0.0376),
-            QVector3D(0.99526,0.29935,0.038765),
-            QVector3D(0.99629,0.3084,0.039989),
-            QVector3D(0.99713,0.31749,0.041278),
-            QVector3D(0.99777,0.32662,0.042522),
-            QVector3D(0.9982,0.3358,0.043828),
-            QVector3D(0.99844,0.34498,0.045261),
-            QVector3D(0.99859,0.35407,0.04666),
-            QVector3D(0.99869,0.36301,0.048013),
-            QVector3D(0.99878,0.37178,0.049508),
-            QVector3D(0.99884,0.38043,0.050843),
-            QVector3D(0.99888,0.38894,0.052219),
-            QVector3D(0.99889,0.39731,0.05362),
-            QVector3D(0.99887,0.40558,0.055042),
-            QVector3D(0.99884,0.41373,0.056502),
-            QVector3D(0.99878,0.42178,0.057786),
-            QVector3D(0.99869,0.42975,0.059296),
-            QVector3D(0.99857,0.43763,0.060625),
-            QVector3D(0.99844,0.4454,0.061996),
-            QVector3D(0.99827,0.45312,0.063411),
-            QVector3D(0.99808,0.46074,0.064752),
-            QVector3D(0.99787,0.46831,0.066112),
-            QVector3D(0.99763,0.47581,0.067489),
-            QVector3D(0.99736,0.48323,0.068891),
-            QVector3D(0.99707,0.49061,0.070164),
-            QVector3D(0.99675,0.49792,0.071543),
-            QVector3D(0.9964,0.50517,0.072849),
-            QVector3D(0.99603,0.51237,0.074177),
-            QVector3D(0.99563,0.51953,0.075448),
-            QVector3D(0.9952,0.52664,0.076731),
-            QVector3D(0.99474,0.53369,0.078024),
-            QVector3D(0.99426,0.54072,0.079325),
-            QVector3D(0.99375,0.54769,0.08063),
-            QVector3D(0.99322,0.55463,0.081958),
-            QVector3D(0.99265,0.56153,0.083158),
-            QVector3D(0.99204,0.5684,0.084524),
-            QVector3D(0.99138,0.57524,0.085856),
-            QVector3D(0.99067,0.58206,0.087485),
-            QVector3D(0.98991,0.58886,0.089115),
-            QVector3D(0.98909,0.59566,0.090908),
-            QVector3D(0.98821,0.60242,0.092755),
-            QVector3D(0.98728,0.60918,0.094848),
-            QVector3D(0.98629,0.6159,0.096892),
-            QVector3D(0.98524,0.62262,0.099162),
-            QVector3D(0.98414,0.62932,0.1015),
-            QVector3D(0.98297,0.63601,0.10396),
-            QVector3D(0.98175,0.64268,0.10656),
-            QVector3D(0.98046,0.64934,0.10919),
-            QVector3D(0.97912,0.65599,0.11195),
-            QVector3D(0.97771,0.66262,0.11474),
-            QVector3D(0.97623,0.66924,0.11771),
-            QVector3D(0.9747,0.67585,0.12072),
-            QVector3D(0.9731,0.68244,0.12383),
-            QVector3D(0.97144,0.68904,0.12703),
-            QVector3D(0.9697,0.69561,0.13037),
-            QVector3D(0.96791,0.70217,0.1337),
-            QVector3D(0.96603,0.70874,0.13715),
-            QVector3D(0.96409,0.71529,0.14067),
-            QVector3D(0.96208,0.72182,0.14425),
-            QVector3D(0.96,0.72836,0.14791),
-            QVector3D(0.95785,0.73488,0.15162),
-            QVector3D(0.95563,0.74139,0.15542),
-            QVector3D(0.95333,0.74791,0.15928),
-            QVector3D(0.95104,0.75439,0.16306),
-            QVector3D(0.94892,0.76075,0.16643),
-            QVector3D(0.94705,0.767,0.16936),
-            QVector3D(0.9454,0.77315,0.1718),
-            QVector3D(0.94394,0.7792,0.1739),
-            QVector3D(0.94268,0.78516,0.17562),
-            QVector3D(0.94159,0.79104,0.17704),
-            QVector3D(0.94067,0.79684,0.17816),
-            QVector3D(0.93991,0.80258,0.17893),
-            QVector3D(0.93929,0.80825,0.17943),
-            QVector3D(0.93881,0.81387,0.1797),
-            QVector3D(0.93845,0.81943,0.17972),
-            QVector3D(0.9382,0.82494,0.17952),
-            QVector3D(0.93807,0.83042,0.17911),
-            QVector3D(0.93806,0.83583,0.17845),
-            QVector3D(0.93816,0.84121,0.17756),
-            QVector3D(0.93835,0.84655,0.17643),
-            QVector3D(0.93863,0.85186,0.17517),
-            QVector3D(0.93901,0.85713,0.17363),
-            QVector3D(0.93948,0.86238,0.17189),
-            QVector3D(0.94002,0.86758,0.16998),
-            QVector3D(0.94064,0.87277,0.16783),
-            QVector3D(0.94135,0.87792,0.16542),
-            QVector3D(0.94214,0.88305,0.16286),
-            QVector3D(0.94298,0.88816,0.16003),
-            QVector3D(0.94391,0.89324,0.15697),
-            QVector3D(0.9449,0.8983,0.15365),
-            QVector3D(0.94594,0.90334,0.15015),
-            QVector3D(0.94707,0.90836,0.14627),
-            QVector3D(0.94825,0.91336,0.14216),
-            QVector3D(0.94948,0.91834,0.13776),
-            QVector3D(0.95079,0.92331,0.13295),
-            QVector3D(0.95212,0.92826,0.12782),
-            QVector3D(0.95354,0.93319,0.12222),
-            QVector3D(0.955,0.93811,0.11627),
-            QVector3D(0.95649,0.94302,0.1098),
-            QVector3D(0.95807,0.94791,0.10259),
-            QVector3D(0.95966,0.95279,0.094821),
-            QVector3D(0.96132,0.95766,0.086007),
-            QVector3D(0.96302,0.96252,0.076202),
-            QVector3D(0.96476,0.96736,0.065035),
-            QVector3D(0.96656,0.97219,0.051675),
-            QVector3D(0.96837,0.97701,0.035491)
-        },
-        {
-            QVector3D(0,0,0),
-            QVector3D(0.00074336,0.0024531,0.0074342),
-            QVector3D(0.0014922,0.0049243,0.014921),
-            QVector3D(0.0022238,0.0073388,0.022238),
-            QVector3D(0.0029727,0.0098191,0.029727),
-            QVector3D(0.003759,0.01243,0.037588),
-            QVector3D(0.0044965,0.014837,0.045061),
-            QVector3D(0.0052171,0.017216,0.052174),
-            QVector3D(0.0059233,0.019547,0.05928),
-            QVector3D(0.0066117,0.021819,0.066122),
-            QVector3D(0.0072841,0.024037,0.07289),
-            QVector3D(0.0079425,0.026211,0.079443),
-            QVector3D(0.008587,0.02834,0.085862),
-            QVector3D(0.0092271,0.03044,0.092265),
-            QVector3D(0.009844,0.03246,0.098364),
-            QVector3D(0.010477,0.034486,0.10458),
-            QVector3D(0.011109,0.036556,0.11078),
-            QVector3D(0.01171,0.038495,0.11667),
-            QVector3D(0.012273,0.040403,0.12242),
-            QVector3D(0.012818,0.042245,0.1279),
-            QVector3D(0.013348,0.043976,0.13326),
-            QVector3D(0.013879,0.04566,0.1385),
-            QVector3D(0.014395,0.047394,0.14358),
-            QVector3D(0.014889,0.049082,0.14858),
-            QVector3D(0.015355,0.050605,0.15335),
-            QVector3D(0.015827,0.052141,0.15801),
-            QVector3D(0.016294,0.053656,0.16261),
-            QVector3D(0.016752,0.05516,0.16717),
-            QVector3D(0.017191,0.056648,0.17153),
-            QVector3D(0.017621,0.057987,0.17584),
-            QVector3D(0.018044,0.059476,0.18012),
-            QVector3D(0.018452,0.060774,0.18421),
-            QVector3D(0.018859,0.062143,0.1883),
-            QVector3D(0.019258,0.063465,0.19229),
-            QVector3D(0.019638,0.064737,0.19618),
-            QVector3D(0.019991,0.066008,0.19999),
-            QVector3D(0.020369,0.06727,0.20383),
-            QVector3D(0.020743,0.068517,0.20757),
-            QVector3D(0.021108,0.069731,0.21123),
-            QVector3D(0.021466,0.07089,0.21479),
-            QVector3D(0.021817,0.072042,0.21833),
-            QVector3D(0.022172,0.073262,0.22184),
-            QVector3D(0.022518,0.074345,0.22528),
-            QVector3D(0.022855,0.075456,0.22864),
-            QVector3D(0.023186,0.076553,0.23196),
-            QVector3D(0.023512,0.077642,0.23526),
-            QVector3D(0.02384,0.078716,0.2385),
-            QVector3D(0.024178,0.079786,0.24179),
-            QVector3D(0.024507,0.080865,0.24506),
-            QVector3D(0.024831,0.08197,0.24832),
-            QVector3D(0.025156,0.08299,0.25156),
-            QVector3D(0.02548,0.084106,0.2548),
-            QVector3D(0.025801,0.085132,0.25798),
-            QVector3D(0.026127,0.086192,0.26127),
-            QVector3D(0.026456,0.087333,0.26456),
-            QVector3D(0.026783,0.088377,0.26781),
-            QVector3D(0.027109,0.089458,0.27108),
-            QVector3D(0.027438,0.090542,0.27438),
-            QVector3D(0.027766,0.091648,0.27766),
-            QVector3D(0.02809,0.092669,0.28088),
-            QVector3D(0.028421,0.093789,0.2842),
-            QVector3D(0.028753,0.094903,0.28753),
-            QVector3D(0.029077,0.095942,0.29078),
-            QVector3D(0.029408,0.097031,0.29407),
-            QVector3D(0.029741,0.09817,0.29742),
-            QVector3D(0.030072,0.099229,0.30072),
-            QVector3D(0.030403,0.10033,0.30402),
-            QVector3D(0.030735,0.10143,0.30733),
-            QVector3D(0.031072,0.10254,0.31072),
-            QVector3D(0.031403,0.10364,0.31403),
-            QVector3D(0.031734,0.1047,0.31734),
-            QVector3D(0.032072,0.10585,0.32074),
-            QVector3D(0.032408,0.10696,0.32408),
-            QVector3D(0.032743,0.10802,0.32739),
-            QVector3D(0.033082,0.10918,0.33077),
-            QVector3D(0.033414,0.11028,0.33418),
-            QVector3D(0.033742,0.11138,0.33753),
-            QVector3D(0.034077,0.1125,0.3409),
-            QVector3D(0.03442,0.11362,0.34424),
-            QVector3D(0.034765,0.11469,0.34763),
-            QVector3D(0.035114,0.11586,0.35104),
-            QVector3D(0.035456,0.11695,0.35445),
-            QVector3D(0.035791,0.1181,0.35784),
-            QVector3D(0.036121,0.1192,0.36122),
-            QVector3D(0.036456,0.12031,0.36459),
-            QVector3D(0.036796,0.12143,0.36797),
-            QVector3D(0.037139,0.12255,0.37137),
-            QVector3D(0.037483,0.12369,0.37481),
-            QVector3D(0.037828,0.12482,0.37826),
-            QVector3D(0.038169,0.12598,0.38168),
-            QVector3D(0.038511,0.12707,0.3851),
-            QVector3D(0.038856,0.12823,0.38856),
-            QVector3D(0.0392,0.12935,0.392),
-            QVector3D(0.039546,0.13052,0.39546),
-            QVector3D(0.03989,0.13163,0.39889),
-            QVector3D(0.040235,0.13277,0.40233),
-            QVector3D(0.040581,0.13392,0.40582),
-            QVector3D(0.040922,0.13506,0.40923),
-            QVector3D(0.041266,0.13617,0.41269),
-            QVector3D(0.041619,0.13735,0.4162),
-            QVector3D(0.04197,0.13849,0.41964),
-            QVector3D(0.042315,0.1396,0.42308),
-            QVector3D(0.042655,0.14079,0.42658),
-            QVector3D(0.042998,0.14192,0.43006),
-            QVector3D(0.043353,0.14307,0.43353),
-            QVector3D(0.043707,0.14422,0.43705),
-            QVector3D(0.044054,0.1454,0.44054),
-            QVector3D(0.044401,0.14652,0.44404),
-            QVector3D(0.044755,0.14769,0.44752),
-            QVector3D(0.045109,0.14883,0.45103),
-            QVector3D(0.045452,0.15001,0.45455),
-            QVector3D(0.045792,0.15115,0.45803),
-            QVector3D(0.046147,0.15231,0.46154),
-            QVector3D(0.046509,0.15347,0.46506),
-            QVector3D(0.046871,0.15464,0.4686),
-            QVector3D(0.047221,0.15582,0.47216),
-            QVector3D(0.047563,0.15696,0.47568),
-            QVector3D(0.047916,0.15815,0.47921),
-            QVector3D(0.048273,0.1593,0.48272),
-            QVector3D(0.048631,0.16046,0.48628),
-            QVector3D(0.048997,0.16167,0.48986),
-            QVector3D(0.049352,0.16283,0.49342),
-            QVector3D(0.049698,0.16401,0.49696),
-            QVector3D(0.050046,0.16514,0.50048),
-            QVector3D(0.050404,0.16634,0.50406),
-            QVector3D(0.050762,0.16751,0.50763),
-            QVector3D(0.051121,0.1687,0.5112),
-            QVector3D(0.051479,0.16988,0.51479),
-            QVector3D(0.051833,0.17105,0.51834),
-            QVector3D(0.05219,0.17223,0.5219),
-            QVector3D(0.052551,0.17342,0.52551),
-            QVector3D(0.052909,0.17461,0.5291),
-            QVector3D(0.053266,0.17577,0.53267),
-            QVector3D(0.053628,0.17697,0.53628),
-            QVector3D(0.05399,0.17818,0.53989),
-            QVector3D(0.054349,0.17935,0.54349),
-            QVector3D(0.054708,0.18053,0.54707),
-            QVector3D(0.055067,0.18172,0.55067),
-            QVector3D(0.055429,0.18292,0.55429),
-            QVector3D(0.055793,0.18412,0.55793),
-            QVector3D(0.056155,0.18533,0.56157),
-            QVector3D(0.056521,0.18651,0.5652),
-            QVector3D(0.056888,0.18772,0.56884),
-            QVector3D(0.057244,0.18891,0.57245),
-            QVector3D(0.0576,0.1901,0.57607),
-            QVector3D(0.057967,0.1913,0.57969),
-            QVector3D(0.058336,0.1925,0.58335),
-            QVector3D(0.058702,0.19372,0.58701),
-            QVector3D(0.059067,0.19492,0.59066),
-            QVector3D(0.059436,0.19613,0.59432),
-            QVector3D(0.059804,0.19733,0.59797),
-            QVector3D(0.060167,0.19853,0.60161),
-            QVector3D(0.060527,0.19973,0.60525),
-            QVector3D(0.060887,0.20094,0.60892),
-            QVector3D(0.061253,0.20216,0.61259),
-            QVector3D(0.061628,0.20338,0.6163),
-            QVector3D(0.062,0.2046,0.61999),
-            QVector3D(0.06237,0.20581,0.62368),
-            QVector3D(0.062743,0.20703,0.62736),
-            QVector3D(0.063109,0.20824,0.63104),
-            QVector3D(0.063471,0.20946,0.63472),
-            QVector3D(0.06384,0.21068,0.63842),
-            QVector3D(0.064212,0.21191,0.64213),
-            QVector3D(0.064582,0.2131,0.64581),
-            QVector3D(0.064951,0.21435,0.64951),
-            QVector3D(0.065324,0.21557,0.65323),
-            QVector3D(0.065695,0.21679,0.65696),
-            QVector3D(0.066066,0.21802,0.66066),
-            QVector3D(0.066438,0.21924,0.66438),
-            QVector3D(0.066811,0.22049,0.66812),
-            QVector3D(0.067184,0.22169,0.67183),
-            QVector3D(0.067556,0.22294,0.67556),
-            QVector3D(0.067927,0.22415,0.67926),
-            QVector3D(0.068301,0.2254,0.68302),
-            QVector3D(0.068677,0.22664,0.68678),
-            QVector3D(0.069052,0.22788,0.69052),
-            QVector3D(0.069427,0.2291,0.69424),
-            QVector3D(0.0698,0.23033,0.69799),
-            QVector3D(0.07017,0.23158,0.70175),
-            QVector3D(0.070545,0.23281,0.70549),
-            QVector3D(0.070927,0.23405,0.70927),
-            QVector3D(0.07131,0.23531,0.71304),
-            QVector3D(0.071685,0.23655,0.71681),
-            QVector3D(0.072052,0.23779,0.72056),
-            QVector3D(0.072426,0.23902,0.72432),
-            QVector3D(0.072809,0.24026,0.72809),
-            QVector3D(0.073193,0.24153,0.73188),
-            QVector3D(0.073573,0.24276,0.73565),
-            QVector3D(0.073946,0.24401,0.73944),
-            QVector3D(0.074319,0.24526,0.74322),
-            QVector3D(0.0747,0.24651,0.74702),
-            QVector3D(0.075082,0.24778,0.75083),
-            QVector3D(0.075461,0.24902,0.75462),
-            QVector3D(0.075841,0.25026,0.75841),
-            QVector3D(0.076222,0.25154,0.76222),
-            QVector3D(0.076602,0.25279,0.76602),
-            QVector3D(0.076984,0.25405,0.76985),
-            QVector3D(0.077365,0.25531,0.77365),
-            QVector3D(0.077744,0.25656,0.77745),
-            QVector3D(0.078128,0.25781,0.78128),
-            QVector3D(0.078511,0.25909,0.78511),
-            QVector3D(0.078893,0.26035,0.78893),
-            QVector3D(0.079275,0.26161,0.79275),
-            QVector3D(0.07966,0.26288,0.7966),
-            QVector3D(0.080044,0.26414,0.80043),
-            QVector3D(0.080427,0.26541,0.80427),
-            QVector3D(0.08081,0.26667,0.80809),
-            QVector3D(0.081193,0.26794,0.81194),
-            QVector3D(0.081582,0.26923,0.81583),
-            QVector3D(0.081967,0.27049,0.81966),
-            QVector3D(0.082351,0.27175,0.8235),
-            QVector3D(0.082734,0.27303,0.82736),
-            QVector3D(0.08312,0.2743,0.83122),
-            QVector3D(0.08351,0.27558,0.8351),
-            QVector3D(0.083897,0.27686,0.83896),
-            QVector3D(0.084288,0.27814,0.84284),
-            QVector3D(0.084673,0.27941,0.84669),
-            QVector3D(0.085055,0.28068,0.85055),
-            QVector3D(0.085441,0.28197,0.85445),
-            QVector3D(0.085828,0.28325,0.85832),
-            QVector3D(0.086218,0.28452,0.8622),
-            QVector3D(0.086607,0.2858,0.86608),
-            QVector3D(0.087001,0.28709,0.86997),
-            QVector3D(0.087391,0.28838,0.87388),
-            QVector3D(0.087778,0.28967,0.87777),
-            QVector3D(0.088167,0.29095,0.88168),
-            QVector3D(0.088557,0.29224,0.88557),
-            QVector3D(0.088947,0.29352,0.88947),
-            QVector3D(0.089338,0.29481,0.89338),
-            QVector3D(0.08973,0.29611,0.8973),
-            QVector3D(0.090121,0.29741,0.90121),
-            QVector3D(0.090513,0.29869,0.90514),
-            QVector3D(0.090904,0.29999,0.90904),
-            QVector3D(0.091296,0.30128,0.91296),
-            QVector3D(0.09169,0.30257,0.91688),
-            QVector3D(0.092085,0.30387,0.92081),
-            QVector3D(0.092476,0.30517,0.92477),
-            QVector3D(0.092866,0.30647,0.92868),
-            QVector3D(0.093261,0.30776,0.93261),
-            QVector3D(0.093659,0.30908,0.93659),
-            QVector3D(0.094052,0.31037,0.94052),
-            QVector3D(0.094445,0.31167,0.94445),
-            QVector3D(0.094842,0.31297,0.9484),
-            QVector3D(0.095238,0.31428,0.95235),
-            QVector3D(0.095633,0.31559,0.95632),
-            QVector3D(0.096025,0.31689,0.96026),
-            QVector3D(0.096419,0.31819,0.96422),
-            QVector3D(0.096817,0.3195,0.96819),
-            QVector3D(0.097216,0.32082,0.97216),
-            QVector3D(0.097613,0.32212,0.97613),
-            QVector3D(0.098012,0.32343,0.9801),
-            QVector3D(0.098407,0.32474,0.98406),
-            QVector3D(0.098802,0.32605,0.98803),
-            QVector3D(0.099201,0.32737,0.99202),
-            QVector3D(0.099601,0.32868,0.99601),
-            QVector3D(0.1,0.33,1)
-        },
-        {
-            QVector3D(0,0,0),
-            QVector3D(0,0.0035927,0),
-            QVector3D(0,0.0071431,1.452e-17),
-            QVector3D(2.0473e-17,0.010757,3.0748e-17),
-            QVector3D(8.1864e-21,0.014524,2.5379e-17),
-            QVector3D(1.7446e-17,0.018105,6.1007e-18),
-            QVector3D(4.169e-17,0.021687,5.0758e-17),
-            QVector3D(0,0.025284,2.5867e-17),
-            QVector3D(6.0593e-17,0.028821,1.8546e-17),
-            QVector3D(0,0.032444,2.5867e-17),
-            QVector3D(4.253e-17,0.036221,5.8567e-18),
-            QVector3D(0,0.039766,1.269e-17),
-            QVector3D(2.4692e-17,0.043161,2.6355e-17),
-            QVector3D(1.4341e-16,0.046597,3.7093e-17),
-            QVector3D(0,0.049768,1.9522e-17),
-            QVector3D(5.3227e-17,0.052749,4.0997e-17),
-            QVector3D(1.6012e-18,0.055759,0),
-            QVector3D(0,0.058542,7.1257e-17),
-            QVector3D(5.6429e-17,0.061269,3.1236e-17),
-            QVector3D(6.2098e-17,0.063951,4.783e-17),
-            QVector3D(1.3454e-16,0.066548,3.026e-17),
-            QVector3D(1.454e-17,0.069095,2.3427e-17),
-            QVector3D(0,0.071498,4.6854e-17),
-            QVector3D(3.2058e-17,0.07387,3.9045e-18),
-            QVector3D(1.6029e-16,0.076086,1.9522e-17),
-            QVector3D(1.1606e-16,0.07832,5.271e-17),
-            QVector3D(6.2194e-17,0.080566,1.3666e-17),
-            QVector3D(0,0.082735,0),
-            QVector3D(0,0.084825,0),
-            QVector3D(0,0.086923,0),
-            QVector3D(8.7753e-18,0.088913,4.0997e-17),
-            QVector3D(4.5733e-17,0.090908,0),
-            QVector3D(5.8543e-17,0.092798,0),
-            QVector3D(7.9487e-17,0.094766,0),
-            QVector3D(0,0.096572,0),
-            QVector3D(0,0.098465,1.9522e-18),
-            QVector3D(0,0.10025,0),
-            QVector3D(4.9576e-17,0.10204,0),
-            QVector3D(1.1817e-16,0.10382,0),
-            QVector3D(1.1049e-16,0.10552,1.9522e-18),
-            QVector3D(0,0.10725,0),
-            QVector3D(0,0.10892,0),
-            QVector3D(8.1348e-18,0.11059,4.2949e-17),
-            QVector3D(1.5174e-16,0.11222,1.1713e-17),
-            QVector3D(4.2384e-06,0.11381,5.6236e-07),
-            QVector3D(1.619e-05,0.11539,2.1481e-06),
-            QVector3D(1.6699e-05,0.11698,2.2156e-06),
-            QVector3D(1.2756e-05,0.11863,1.6925e-06),
-            QVector3D(9.7295e-06,0.12018,1.2909e-06),
-            QVector3D(1.3177e-05,0.12176,1.7484e-06),
-            QVector3D(1.6418e-05,0.12338,2.1783e-06),
-            QVector3D(1.7338e-05,0.12502,2.3004e-06),
-            QVector3D(1.6062e-05,0.12662,2.1312e-06),
-            QVector3D(1.1099e-05,0.12826,1.4726e-06),
-            QVector3D(8.2989e-06,0.1299,1.1011e-06),
-            QVector3D(1.4157e-05,0.1315,1.8783e-06),
-            QVector3D(1.7475e-05,0.13312,2.3186e-06),
-            QVector3D(1.7885e-05,0.13477,2.373e-06),
-            QVector3D(1.5761e-05,0.13635,2.0912e-06),
-            QVector3D(1.1631e-05,0.13803,1.5432e-06),
-            QVector3D(8.4045e-06,0.13962,1.1151e-06),
-            QVector3D(1.4146e-05,0.1413,1.8769e-06),
-            QVector3D(1.7579e-05,0.14293,2.3324e-06),
-            QVector3D(1.8299e-05,0.14458,2.428e-06),
-            QVector3D(1.7087e-05,0.14621,2.2671e-06),
-            QVector3D(1.2461e-05,0.14787,1.6533e-06),
-            QVector3D(9.2002e-06,0.14954,1.2207e-06),
-            QVector3D(1.3439e-05,0.15116,1.7831e-06),
-            QVector3D(1.7166e-05,0.15281,2.2777e-06),
-            QVector3D(1.8547e-05,0.15448,2.4608e-06),
-            QVector3D(1.8043e-05,0.15618,2.394e-06),
-            QVector3D(1.5436e-05,0.15782,2.048e-06),
-            QVector3D(1.1288e-05,0.15947,1.4977e-06),
-            QVector3D(9.1088e-06,0.16118,1.2086e-06),
-            QVector3D(1.463e-05,0.16284,1.9412e-06),
-            QVector3D(1.7571e-05,0.16452,2.3725e-06),
-            QVector3D(9.5709e-06,0.16618,2.3585e-06),
-            QVector3D(0,0.16786,2.12e-06),
-            QVector3D(0,0.16957,1.7933e-06),
-            QVector3D(0,0.17123,1.2872e-06),
-            QVector3D(0,0.17292,1.0023e-06),
-            QVector3D(0,0.17462,1.66e-06),
-            QVector3D(0,0.17629,2.0398e-06),
-            QVector3D(0,0.17804,2.1855e-06),
-            QVector3D(0,0.1797,2.2541e-06),
-            QVector3D(0,0.18139,1.9666e-06),
-            QVector3D(0,0.18309,1.524e-06),
-            QVector3D(0,0.18482,1.1233e-06),
-            QVector3D(0,0.18653,1.2478e-06),
-            QVector3D(0,0.18826,1.8149e-06),
-            QVector3D(0,0.18994,2.1666e-06),
-            QVector3D(0,0.19165,2.2543e-06),
-            QVector3D(0,0.19339,2.1978e-06),
-            QVector3D(0,0.1951,2.0405e-06),
-            QVector3D(0,0.19684,1.6279e-06),
-            QVector3D(0,0.19854,1.1674e-06),
-            QVector3D(0,0.20025,1.2082e-06),
-            QVector3D(0,0.20199,1.6696e-06),
-            QVector3D(0,0.20375,2.0125e-06),
-            QVector3D(0,0.20547,2.2769e-06),
-            QVector3D(0,0.20722,2.3292e-06),
-            QVector3D(0,0.20894,2.1993e-06),
-            QVector3D(0,0.21069,1.9215e-06),
-            QVector3D(0,0.21244,1.5648e-06),
-            QVector3D(0,0.21419,1.1031e-06),
-            QVector3D(0,0.21594,1.1824e-06),
-            QVector3D(0,0.21768,1.6796e-06),
-            QVector3D(0,0.21944,2.0449e-06),
-            QVector3D(0,0.2212,2.2667e-06),
-            QVector3D(0,0.22296,2.3344e-06),
-            QVector3D(0,0.22468,2.2953e-06),
-            QVector3D(0,0.22648,2.1282e-06),
-            QVector3D(0,0.22824,1.8455e-06),
-            QVector3D(0,0.22999,1.3868e-06),
-            QVector3D(0,0.23177,1.0492e-06),
-            QVector3D(0,0.23352,1.2152e-06),
-            QVector3D(0,0.23533,1.6192e-06),
-            QVector3D(0,0.2371,2.0168e-06),
-            QVector3D(0,0.23885,2.2741e-06),
-            QVector3D(0,0.24062,2.3737e-06),
-            QVector3D(0,0.24241,2.3904e-06),
-            QVector3D(0,0.24419,2.2583e-06),
-            QVector3D(0,0.24598,2.0443e-06),
-            QVector3D(0,0.24779,1.7786e-06),
-            QVector3D(0,0.24956,1.4126e-06),
-            QVector3D(0,0.25137,1.0243e-06),
-            QVector3D(0,0.25316,1.0702e-06),
-            QVector3D(0,0.25496,1.5288e-06),
-            QVector3D(0,0.25675,1.8855e-06),
-            QVector3D(0,0.25854,2.1333e-06),
-            QVector3D(0,0.26035,2.3139e-06),
-            QVector3D(0,0.26215,2.3948e-06),
-            QVector3D(0,0.26397,2.4069e-06),
-            QVector3D(0,0.26577,2.301e-06),
-            QVector3D(0,0.26756,2.1598e-06),
-            QVector3D(0,0.26941,1.9587e-06),
-            QVector3D(0,0.2712,1.6921e-06),
-            QVector3D(0,0.27302,1.2675e-06),
-            QVector3D(0,0.27484,9.345e-07),
-            QVector3D(0,0.27667,1.0391e-06),
-            QVector3D(0,0.27848,1.4548e-06),
-            QVector3D(0,0.2803,1.7503e-06),
-            QVector3D(0,0.28214,1.9921e-06),
-            QVector3D(0,0.28396,2.2429e-06),
-            QVector3D(0,0.28578,2.3368e-06),
-            QVector3D(0,0.28761,2.387e-06),
-            QVector3D(0,0.28946,2.4145e-06),
-            QVector3D(0,0.2913,2.3634e-06),
-            QVector3D(0,0.29313,2.3021e-06),
-            QVector3D(0,0.29497,2.1385e-06),
-            QVector3D(0,0.29682,1.9682e-06),
-            QVector3D(0,0.29866,1.7236e-06),
-            QVector3D(0,0.3005,1.4728e-06),
-            QVector3D(0,0.30234,1.137e-06),
-            QVector3D(0,0.30421,8.5235e-07),
-            QVector3D(0,0.30606,9.2407e-07),
-            QVector3D(0,0.30791,1.2303e-06),
-            QVector3D(0,0.30977,1.5259e-06),
-            QVector3D(0,0.31161,1.7664e-06),
-            QVector3D(0,0.31349,1.8547e-06),
-            QVector3D(0,0.31534,8.3145e-07),
-            QVector3D(6.8048e-16,0.31721,9.3707e-17),
-            QVector3D(3.4536e-16,0.31907,3.1236e-17),
-            QVector3D(3.3512e-16,0.32095,6.2472e-17),
-            QVector3D(1.0248e-17,0.32282,0),
-            QVector3D(0,0.32467,6.2472e-17),
-            QVector3D(0,0.32654,1.0933e-16),
-            QVector3D(6.7536e-16,0.32843,1.0933e-16),
-            QVector3D(7.4709e-16,0.3303,0),
-            QVector3D(3.3512e-16,0.33219,6.2472e-17),
-            QVector3D(6.9585e-16,0.33407,4.6854e-17),
-            QVector3D(1.6756e-16,0.33594,3.1236e-17),
-            QVector3D(8.4804e-16,0.33782,1.2494e-16),
-            QVector3D(1.7781e-16,0.33972,0),
-            QVector3D(0,0.3416,6.2472e-17),
-            QVector3D(0,0.34348,0),
-            QVector3D(7.2147e-16,0.34538,0),
-            QVector3D(0,0.34727,0),
-            QVector3D(0,0.34917,0),
-            QVector3D(1.5731e-16,0.35106,6.2472e-17),
-            QVector3D(6.4974e-16,0.35296,1.8741e-16),
-            QVector3D(3.8636e-16,0.35487,0),
-            QVector3D(2.0855e-16,0.35676,0),
-            QVector3D(0,0.35865,0),
-            QVector3D(3.1462e-16,0.36055,1.2494e-16),
-            QVector3D(4.4119e-16,0.36247,2.8112e-16),
-            QVector3D(5.1292e-16,0.36437,6.2472e-17),
-            QVector3D(0,0.3663,0),
-            QVector3D(6.8048e-16,0.3682,9.3707e-17),
-            QVector3D(7.0098e-16,0.3701,3.1236e-17),
-            QVector3D(2.9412e-16,0.37202,1.8741e-16),
-            QVector3D(5.0268e-16,0.37395,9.3707e-17),
-            QVector3D(0,0.37586,3.1236e-17),
-            QVector3D(6.7023e-16,0.37778,1.2494e-16),
-            QVector3D(0,0.3797,3.1236e-17),
-            QVector3D(6.7023e-16,0.38163,1.2494e-16),
-            QVector3D(8.5829e-16,0.38356,9.3707e-17),
-            QVector3D(5.2317e-16,0.38547,3.1236e-17),
-            QVector3D(1.0566e-15,0.3874,3.1236e-17),
-            QVector3D(4.9243e-16,0.38934,1.2494e-16),
-            QVector3D(0,0.39128,6.2472e-17),
-            QVector3D(3.5561e-16,0.3932,0),
-            QVector3D(1.0607e-16,0.39514,2.1865e-16),
-            QVector3D(0,0.39707,9.3707e-17),
-            QVector3D(2.0855e-16,0.39901,0),
-            QVector3D(1.2037e-15,0.40097,1.2494e-16),
-            QVector3D(9.951e-16,0.4029,2.1865e-16),
-            QVector3D(1.1934e-15,0.40484,1.5618e-16),
-            QVector3D(0,0.40679,1.2494e-16),
-            QVector3D(0,0.40874,1.2494e-16),
-            QVector3D(0,0.41069,0),
-            QVector3D(1.3507e-15,0.41264,2.1865e-16),
-            QVector3D(1.0258e-15,0.41458,1.2494e-16),
-            QVector3D(3.1462e-16,0.41654,1.2494e-16),
-            QVector3D(1.3815e-15,0.41849,1.2494e-16),
-            QVector3D(6.9073e-16,0.42045,6.2472e-17),
-            QVector3D(7.0098e-16,0.4224,3.1236e-17),
-            QVector3D(6.0875e-16,0.42437,3.1236e-16),
-            QVector3D(3.4536e-16,0.42633,3.1236e-17),
-            QVector3D(9.3361e-16,0.4283,4.0607e-16),
-            QVector3D(7.0098e-16,0.43026,3.1236e-17),
-            QVector3D(1.3507e-15,0.43223,2.1865e-16),
-            QVector3D(1.0258e-15,0.43419,1.2494e-16),
-            QVector3D(1.3712e-15,0.43617,1.5618e-16),
-            QVector3D(5.4726e-16,0.43814,4.9977e-16),
-            QVector3D(7.1123e-16,0.44011,0),
-            QVector3D(1.7063e-15,0.44209,2.1865e-16),
-            QVector3D(6.3949e-16,0.44406,2.1865e-16),
-            QVector3D(3.4536e-16,0.44603,3.1236e-17),
-            QVector3D(6.1488e-17,0.44801,0),
-            QVector3D(4.4784e-16,0.45,0),
-            QVector3D(1.0566e-15,0.45199,3.1236e-17),
-            QVector3D(1.0463e-15,0.45396,6.2472e-17),
-            QVector3D(6.7023e-16,0.45594,1.2494e-16),
-            QVector3D(1.0668e-15,0.45793,0),
-            QVector3D(9.951e-16,0.45992,2.1865e-16),
-            QVector3D(7.4197e-16,0.46191,0),
-            QVector3D(1.1181e-15,0.46391,0),
-            QVector3D(9.6436e-16,0.46589,3.1236e-16),
-            QVector3D(1.2585e-15,0.46789,4.9977e-16),
-            QVector3D(1.3815e-15,0.46989,1.2494e-16),
-            QVector3D(6.7023e-16,0.47189,1.2494e-16),
-            QVector3D(3.5561e-16,0.47388,0),
-            QVector3D(2.0722e-15,0.47589,1.8741e-16),
-            QVector3D(1.1078e-15,0.47788,0),
-            QVector3D(1.6346e-15,0.4799,4.373e-16),
-            QVector3D(6.2924e-16,0.4819,2.4989e-16),
-            QVector3D(1.6756e-15,0.48389,3.1236e-16),
-            QVector3D(1.402e-15,0.48591,6.2472e-17),
-            QVector3D(1.0668e-15,0.48793,0),
-            QVector3D(0,0.48992,0),
-            QVector3D(0,0.49195,2.4989e-16),
-            QVector3D(6.7023e-16,0.49395,1.2494e-16),
-            QVector3D(1.4429e-15,0.49597,0),
-            QVector3D(2.7363e-16,0.498,2.4989e-16),
-            QVector3D(7.1123e-16,0.5,0)
-        },
-        {
-            QVector3D(0,0,0),
-            QVector3D(0.0080248,0.0015152,4.5084e-17),
-            QVector3D(0.016166,0.0030536,0),
-            QVector3D(0.024126,0.0045572,6.0397e-18),
-            QVector3D(0.032164,0.0060809,1.6594e-17),
-            QVector3D(0.040345,0.0076161,0),
-            QVector3D(0.047917,0.0090568,0),
-            QVector3D(0.055209,0.010404,3.9777e-17),
-            QVector3D(0.06236,0.011803,0),
-            QVector3D(0.068888,0.012988,0),
-            QVector3D(0.074917,0.014153,0),
-            QVector3D(0.080792,0.015256,5.8811e-17),
-            QVector3D(0.086386,0.016319,8.7851e-18),
-            QVector3D(0.091832,0.017341,0),
-            QVector3D(0.096947,0.018317,0),
-            QVector3D(0.10199,0.019262,2.1475e-17),
-            QVector3D(0.10688,0.020182,0),
-            QVector3D(0.11156,0.021071,4.2461e-17),
-            QVector3D(0.11612,0.021929,0),
-            QVector3D(0.12051,0.022761,0),
-            QVector3D(0.12482,0.023572,0),
-            QVector3D(0.12901,0.024369,0),
-            QVector3D(0.13312,0.025144,0),
-            QVector3D(0.13712,0.025899,2.9284e-17),
-            QVector3D(0.14104,0.026637,0),
-            QVector3D(0.14484,0.027362,0),
-            QVector3D(0.14852,0.028076,0),
-            QVector3D(0.15218,0.028765,0),
-            QVector3D(0.15579,0.029444,0),
-            QVector3D(0.15929,0.03011,0),
-            QVector3D(0.16274,0.03076,0),
-            QVector3D(0.16612,0.031401,0),
-            QVector3D(0.16947,0.032031,0),
-            QVector3D(0.17271,0.032655,0),
-            QVector3D(0.1759,0.033257,0),
-            QVector3D(0.17909,0.033824,0),
-            QVector3D(0.18223,0.034436,0),
-            QVector3D(0.18542,0.035067,0),
-            QVector3D(0.18847,0.03563,0),
-            QVector3D(0.19142,0.03617,0),
-            QVector3D(0.19437,0.036729,0),
-            QVector3D(0.19725,0.037267,5.4019e-07),
-            QVector3D(0.20012,0.037802,1.2837e-06),
-            QVector3D(0.20303,0.038349,9.9959e-07),
-            QVector3D(0.20594,0.038898,7.7892e-07),
-            QVector3D(0.20884,0.039449,9.7112e-07),
-            QVector3D(0.21176,0.039999,1.2788e-06),
-            QVector3D(0.21466,0.040546,1.373e-06),
-            QVector3D(0.21761,0.0411,1.2556e-06),
-            QVector3D(0.22057,0.041669,9.5959e-07),
-            QVector3D(0.22346,0.042219,8.1372e-07),
-            QVector3D(0.22635,0.042741,1.1485e-06),
-            QVector3D(0.22925,0.043284,1.3628e-06),
-            QVector3D(0.23223,0.04386,1.3699e-06),
-            QVector3D(0.23522,0.044439,1.2685e-06),
-            QVector3D(0.23815,0.045002,1.0271e-06),
-            QVector3D(0.24106,0.045522,7.9582e-07),
-            QVector3D(0.24401,0.046076,1.0449e-06),
-            QVector3D(0.24701,0.046672,1.3237e-06),
-            QVector3D(0.24995,0.047232,1.4871e-06),
-            QVector3D(0.25293,0.047749,1.4007e-06),
-            QVector3D(0.25591,0.048339,1.1191e-06),
-            QVector3D(0.25894,0.048928,8.5433e-07),
-            QVector3D(0.26191,0.049479,9.2045e-07),
-            QVector3D(0.26486,0.050025,1.3084e-06),
-            QVector3D(0.26783,0.05059,1.4958e-06),
-            QVector3D(0.27084,0.051156,1.5067e-06),
-            QVector3D(0.27383,0.051721,1.3409e-06),
-            QVector3D(0.27682,0.052289,1.0257e-06),
-            QVector3D(0.27983,0.052858,7.8803e-07),
-            QVector3D(0.28284,0.053424,1.0814e-06),
-            QVector3D(0.28584,0.053993,1.3794e-06),
-            QVector3D(0.28888,0.054565,1.5209e-06),
-            QVector3D(0.2919,0.055134,1.522e-06),
-            QVector3D(0.29494,0.055708,1.3561e-06),
-            QVector3D(0.29798,0.056296,1.0594e-06),
-            QVector3D(0.30101,0.056866,8.5564e-07),
-            QVector3D(0.30401,0.057414,1.0969e-06),
-            QVector3D(0.30705,0.057986,1.3643e-06),
-            QVector3D(0.31013,0.05858,1.5001e-06),
-            QVector3D(0.3132,0.05917,1.5634e-06),
-            QVector3D(0.31627,0.059754,1.4993e-06),
-            QVector3D(0.31931,0.06032,1.2688e-06),
-            QVector3D(0.32234,0.060876,9.3009e-07),
-            QVector3D(0.32538,0.061448,8.4705e-07),
-            QVector3D(0.32848,0.062046,1.1943e-06),
-            QVector3D(0.33157,0.06265,1.4594e-06),
-            QVector3D(0.33467,0.06322,1.6339e-06),
-            QVector3D(0.33772,0.063788,1.6369e-06),
-            QVector3D(0.3408,0.064374,1.4847e-06),
-            QVector3D(0.34388,0.064956,1.2226e-06),
-            QVector3D(0.34698,0.065538,8.9134e-07),
-            QVector3D(0.35008,0.066125,8.5068e-07),
-            QVector3D(0.35318,0.066712,1.2269e-06),
-            QVector3D(0.35629,0.067299,1.4894e-06),
-            QVector3D(0.35939,0.067883,1.6295e-06),
-            QVector3D(0.36252,0.068473,1.6472e-06),
-            QVector3D(0.36565,0.069079,1.5852e-06),
-            QVector3D(0.36876,0.069658,1.4248e-06),
-            QVector3D(0.37185,0.070223,1.0684e-06),
-            QVector3D(0.37498,0.070835,7.9019e-07),
-            QVector3D(0.37813,0.071435,1.022e-06),
-            QVector3D(0.38125,0.072005,1.3647e-06),
-            QVector3D(0.38438,0.072592,1.5517e-06),
-            QVector3D(0.38754,0.073217,1.6548e-06),
-            QVector3D(0.39069,0.073807,1.7253e-06),
-            QVector3D(0.39382,0.074384,1.6463e-06),
-            QVector3D(0.39695,0.074981,1.4452e-06),
-            QVector3D(0.40011,0.075576,1.1513e-06),
-            QVector3D(0.40327,0.076172,8.5042e-07),
-            QVector3D(0.40643,0.076769,8.941e-07),
-            QVector3D(0.40959,0.077367,1.2367e-06),
-            QVector3D(0.41277,0.077967,1.4894e-06),
-            QVector3D(0.41594,0.078566,1.6548e-06),
-            QVector3D(0.41912,0.079167,1.728e-06),
-            QVector3D(0.4223,0.079769,1.7184e-06),
-            QVector3D(0.4255,0.080371,1.6249e-06),
-            QVector3D(0.4287,0.080974,1.4674e-06),
-            QVector3D(0.43192,0.081588,1.2356e-06),
-            QVector3D(0.43512,0.082195,9.4259e-07),
-            QVector3D(0.43828,0.08278,7.201e-07),
-            QVector3D(0.4415,0.083388,1.052e-06),
-            QVector3D(0.44472,0.084012,1.3338e-06),
-            QVector3D(0.44791,0.084617,1.593e-06),
-            QVector3D(0.45112,0.085205,1.7373e-06),
-            QVector3D(0.45433,0.085801,1.7608e-06),
-            QVector3D(0.45756,0.086427,1.7212e-06),
-            QVector3D(0.4608,0.087056,1.6842e-06),
-            QVector3D(0.46404,0.087652,1.5738e-06),
-            QVector3D(0.46727,0.088257,1.3578e-06),
-            QVector3D(0.47049,0.088871,1.1045e-06),
-            QVector3D(0.47373,0.089482,8.1745e-07),
-            QVector3D(0.47697,0.090095,7.8044e-07),
-            QVector3D(0.48022,0.090707,1.0884e-06),
-            QVector3D(0.48348,0.091327,1.3399e-06),
-            QVector3D(0.48673,0.091949,1.5673e-06),
-            QVector3D(0.48996,0.092545,1.7249e-06),
-            QVector3D(0.49321,0.093154,1.7614e-06),
-            QVector3D(0.49649,0.093784,1.7613e-06),
-            QVector3D(0.49977,0.094411,1.763e-06),
-            QVector3D(0.50305,0.095031,1.7236e-06),
-            QVector3D(0.50631,0.09564,1.6147e-06),
-            QVector3D(0.50957,0.096244,1.4163e-06),
-            QVector3D(0.51285,0.096865,1.1666e-06),
-            QVector3D(0.51615,0.097503,9.3008e-07),
-            QVector3D(0.51945,0.098123,7.3324e-07),
-            QVector3D(0.52274,0.098737,8.3616e-07),
-            QVector3D(0.52603,0.099359,1.0957e-06),
-            QVector3D(0.52932,0.099983,1.3165e-06),
-            QVector3D(0.53262,0.10061,1.4935e-06),
-            QVector3D(0.53592,0.10123,1.6285e-06),
-            QVector3D(0.53923,0.10185,1.7225e-06),
-            QVector3D(0.54255,0.10248,1.7716e-06),
-            QVector3D(0.54588,0.10311,1.8035e-06),
-            QVector3D(0.54919,0.10374,1.8308e-06),
-            QVector3D(0.55249,0.10435,1.7782e-06),
-            QVector3D(0.5558,0.10498,1.6557e-06),
-            QVector3D(0.55915,0.10562,1.5548e-06),
-            QVector3D(0.56251,0.10626,1.4434e-06),
-            QVector3D(0.56583,0.10688,1.3031e-06),
-            QVector3D(0.56915,0.10751,1.1028e-06),
-            QVector3D(0.57249,0.10813,8.5642e-07),
-            QVector3D(0.57584,0.10877,6.5276e-07),
-            QVector3D(0.57921,0.10941,6.6729e-07),
-            QVector3D(0.58255,0.11004,8.9887e-07),
-            QVector3D(0.58591,0.11067,1.1025e-06),
-            QVector3D(0.58925,0.1113,1.264e-06),
-            QVector3D(0.59262,0.11194,1.3991e-06),
-            QVector3D(0.59599,0.11257,1.5204e-06),
-            QVector3D(0.59936,0.11322,1.6369e-06),
-            QVector3D(0.60271,0.11385,1.7384e-06),
-            QVector3D(0.60606,0.11447,1.7667e-06),
-            QVector3D(0.60945,0.11512,1.7698e-06),
-            QVector3D(0.61284,0.11576,1.7921e-06),
-            QVector3D(0.61623,0.11641,1.8189e-06),
-            QVector3D(0.6196,0.11703,1.7927e-06),
-            QVector3D(0.62299,0.11767,1.7298e-06),
-            QVector3D(0.62639,0.11833,1.7048e-06),
-            QVector3D(0.62978,0.11896,1.6692e-06),
-            QVector3D(0.63317,0.1196,1.5768e-06),
-            QVector3D(0.63657,0.12024,1.4791e-06),
-            QVector3D(0.63997,0.12088,1.3801e-06),
-            QVector3D(0.64337,0.12153,1.2686e-06),
-            QVector3D(0.64679,0.12217,1.1466e-06),
-            QVector3D(0.65019,0.12281,1.0261e-06),
-            QVector3D(0.65362,0.12346,8.8816e-07),
-            QVector3D(0.65704,0.12411,7.6247e-07),
-            QVector3D(0.66046,0.12475,6.252e-07),
-            QVector3D(0.6639,0.1254,5.0813e-07),
-            QVector3D(0.66734,0.12605,5.4766e-07),
-            QVector3D(0.67075,0.12669,4.2573e-07),
-            QVector3D(0.67419,0.12734,2.3855e-08),
-            QVector3D(0.67764,0.128,0),
-            QVector3D(0.68106,0.12864,0),
-            QVector3D(0.68451,0.12929,0),
-            QVector3D(0.68797,0.12996,0),
-            QVector3D(0.69142,0.13061,0),
-            QVector3D(0.69486,0.13125,0),
-            QVector3D(0.69832,0.1319,0),
-            QVector3D(0.70177,0.13256,0),
-            QVector3D(0.70524,0.13321,0),
-            QVector3D(0.70871,0.13387,0),
-            QVector3D(0.71218,0.13453,0),
-            QVector3D(0.71565,0.13518,0),
-            QVector3D(0.7191,0.13582,0),
-            QVector3D(0.72258,0.13648,0),
-            QVector3D(0.72607,0.13715,0),
-            QVector3D(0.72956,0.13781,0),
-            QVector3D(0.73304,0.13847,0),
-            QVector3D(0.73651,0.13912,0),
-            QVector3D(0.74001,0.13977,0),
-            QVector3D(0.74351,0.14044,0),
-            QVector3D(0.74701,0.14111,0),
-            QVector3D(0.75051,0.14176,0),
-            QVector3D(0.75401,0.14242,0),
-            QVector3D(0.75751,0.14309,0),
-            QVector3D(0.76102,0.14375,0),
-            QVector3D(0.76454,0.14441,0),
-            QVector3D(0.76805,0.14508,0),
-            QVector3D(0.77157,0.14575,0),
-            QVector3D(0.77507,0.1464,0),
-            QVector3D(0.7786,0.14707,0),
-            QVector3D(0.78213,0.14774,0),
-            QVector3D(0.78565,0.14839,0),
-            QVector3D(0.78919,0.14907,0),
-            QVector3D(0.79273,0.14975,0),
-            QVector3D(0.79625,0.1504,0),
-            QVector3D(0.7998,0.15107,0),
-            QVector3D(0.80333,0.15174,0),
-            QVector3D(0.80688,0.15241,0),
-            QVector3D(0.81042,0.15308,0),
-            QVector3D(0.81397,0.15375,0),
-            QVector3D(0.81752,0.15442,0),
-            QVector3D(0.82108,0.15509,0),
-            QVector3D(0.82465,0.15577,0),
-            QVector3D(0.82821,0.15645,0),
-            QVector3D(0.83177,0.15711,0),
-            QVector3D(0.83534,0.15778,0),
-            QVector3D(0.83891,0.15847,0),
-            QVector3D(0.84248,0.15914,0),
-            QVector3D(0.84604,0.1598,0),
-            QVector3D(0.84963,0.16048,0),
-            QVector3D(0.85322,0.16117,0),
-            QVector3D(0.8568,0.16184,0),
-            QVector3D(0.86038,0.16251,0),
-            QVector3D(0.86398,0.16319,0),
-            QVector3D(0.86757,0.16388,0),
-            QVector3D(0.87115,0.16455,0),
-            QVector3D(0.87473,0.16523,0),
-            QVector3D(0.87834,0.16591,0),
-            QVector3D(0.88196,0.16659,0),
-            QVector3D(0.88556,0.16727,0),
-            QVector3D(0.88915,0.16795,0),
-            QVector3D(0.89277,0.16863,0),
-            QVector3D(0.89639,0.16932,0),
-            QVector3D(0.9,0.17,2.0303e-16)
-        },
-        {
-            QVector3D(0,0.20755,0.97632),
-            QVector3D(0,0.22113,0.96201),
-            QVector3D(0,0.23397,0.94773),
-            QVector3D(0,0.24623,0.93346),
-            QVector3D(0,0.25798,0.91922),
-            QVector3D(0,0.26932,0.905),
-            QVector3D(0,0.28022,0.89081),
-            QVector3D(0,0.29079,0.87663),
-            QVector3D(0,0.30104,0.8625),
-            QVector3D(0,0.31103,0.84838),
-            QVector3D(0,0.32074,0.83429),
-            QVector3D(0,0.3302,0.82023),
-            QVector3D(0,0.33945,0.80621),
-            QVector3D(0,0.34846,0.79222),
-            QVector3D(0,0.35727,0.77828),
-            QVector3D(0,0.36586,0.76439),
-            QVector3D(0,0.37426,0.75056),
-            QVector3D(0,0.38245,0.7368),
-            QVector3D(0,0.39044,0.72311),
-            QVector3D(0,0.39823,0.70952),
-            QVector3D(0,0.4058,0.69603),
-            QVector3D(0,0.41317,0.68264),
-            QVector3D(0.0064797,0.42031,0.66938),
-            QVector3D(0.016533,0.42727,0.65626),
-            QVector3D(0.028131,0.43398,0.64326),
-            QVector3D(0.041954,0.44052,0.63041),
-            QVector3D(0.055821,0.44686,0.6177),
-            QVector3D(0.069351,0.45301,0.60514),
-            QVector3D(0.082392,0.45898,0.59273),
-            QVector3D(0.095132,0.46479,0.58043),
-            QVector3D(0.10747,0.47045,0.56826),
-            QVector3D(0.11942,0.47598,0.55619),
-            QVector3D(0.13095,0.48139,0.54423),
-            QVector3D(0.14195,0.48671,0.53234),
-            QVector3D(0.15241,0.49195,0.52051),
-            QVector3D(0.16235,0.49712,0.50873),
-            QVector3D(0.17166,0.50225,0.49697),
-            QVector3D(0.18039,0.50733,0.48522),
-            QVector3D(0.18854,0.51239,0.47347),
-            QVector3D(0.19606,0.51744,0.46171),
-            QVector3D(0.20297,0.52246,0.4499),
-            QVector3D(0.20931,0.5275,0.43806),
-            QVector3D(0.21508,0.53254,0.42613),
-            QVector3D(0.22033,0.53758,0.41415),
-            QVector3D(0.225,0.54263,0.40206),
-            QVector3D(0.22922,0.54768,0.38989),
-            QVector3D(0.23295,0.55275,0.37763),
-            QVector3D(0.23626,0.55783,0.36524),
-            QVector3D(0.23913,0.56292,0.35274),
-            QVector3D(0.24164,0.56801,0.3401),
-            QVector3D(0.24376,0.57311,0.32732),
-            QVector3D(0.24561,0.57819,0.31441),
-            QVector3D(0.24723,0.58328,0.30137),
-            QVector3D(0.24866,0.58836,0.28822),
-            QVector3D(0.24993,0.59342,0.27496),
-            QVector3D(0.25123,0.59845,0.2616),
-            QVector3D(0.25256,0.60344,0.2482),
-            QVector3D(0.25407,0.60839,0.23474),
-            QVector3D(0.25584,0.61326,0.22129),
-            QVector3D(0.25802,0.61807,0.2079),
-            QVector3D(0.26074,0.6228,0.19465),
-            QVector3D(0.26408,0.62744,0.18153),
-            QVector3D(0.26813,0.63197,0.16873),
-            QVector3D(0.273,0.63639,0.15625),
-            QVector3D(0.27873,0.64068,0.14417),
-            QVector3D(0.28531,0.64485,0.13262),
-            QVector3D(0.29279,0.6489,0.12165),
-            QVector3D(0.30109,0.65281,0.1115),
-            QVector3D(0.31019,0.65661,0.10209),
-            QVector3D(0.31996,0.66028,0.093634),
-            QVector3D(0.33034,0.66383,0.08618),
-            QVector3D(0.34123,0.66728,0.079836),
-            QVector3D(0.35254,0.67063,0.074617),
-            QVector3D(0.36416,0.67388,0.07048),
-            QVector3D(0.37603,0.67707,0.067441),
-            QVector3D(0.38805,0.68017,0.065341),
-            QVector3D(0.40017,0.68323,0.064135),
-            QVector3D(0.41235,0.68622,0.063669),
-            QVector3D(0.42451,0.68918,0.063793),
-            QVector3D(0.43665,0.6921,0.064391),
-            QVector3D(0.44873,0.69498,0.065355),
-            QVector3D(0.46073,0.69783,0.066603),
-            QVector3D(0.47266,0.70067,0.068066),
-            QVector3D(0.4845,0.70348,0.06967),
-            QVector3D(0.49625,0.70628,0.071332),
-            QVector3D(0.50793,0.70905,0.07306),
-            QVector3D(0.5195,0.71181,0.074792),
-            QVector3D(0.53099,0.71455,0.076552),
-            QVector3D(0.5424,0.71728,0.078345),
-            QVector3D(0.55372,0.72,0.08017),
-            QVector3D(0.56497,0.72269,0.082034),
-            QVector3D(0.57617,0.72539,0.083799),
-            QVector3D(0.58729,0.72805,0.085523),
-            QVector3D(0.59835,0.73071,0.087403),
-            QVector3D(0.60937,0.73336,0.089162),
-            QVector3D(0.62033,0.73599,0.090964),
-            QVector3D(0.63124,0.73861,0.092702),
-            QVector3D(0.64211,0.74121,0.094561),
-            QVector3D(0.65293,0.7438,0.096272),
-            QVector3D(0.66373,0.74637,0.09813),
-            QVector3D(0.67447,0.74893,0.099882),
-            QVector3D(0.68519,0.75149,0.10167),
-            QVector3D(0.69588,0.75402,0.1035),
-            QVector3D(0.70654,0.75653,0.10524),
-            QVector3D(0.71717,0.75904,0.10708),
-            QVector3D(0.72776,0.76153,0.10884),
-            QVector3D(0.73834,0.764,0.11066),
-            QVector3D(0.7489,0.76647,0.11246),
-            QVector3D(0.75944,0.76891,0.1142),
-            QVector3D(0.76996,0.77134,0.11604),
-            QVector3D(0.78045,0.77373,0.1178),
-            QVector3D(0.79092,0.7761,0.11957),
-            QVector3D(0.80136,0.77843,0.12132),
-            QVector3D(0.81178,0.78071,0.12308),
-            QVector3D(0.82215,0.78294,0.12485),
-            QVector3D(0.83247,0.78509,0.12657),
-            QVector3D(0.84272,0.78715,0.12828),
-            QVector3D(0.85289,0.78908,0.12995),
-            QVector3D(0.86295,0.79087,0.13152),
-            QVector3D(0.87287,0.79248,0.13305),
-            QVector3D(0.88262,0.79388,0.13451),
-            QVector3D(0.89216,0.79501,0.13581),
-            QVector3D(0.90143,0.79585,0.13707),
-            QVector3D(0.9104,0.79634,0.13819),
-            QVector3D(0.919,0.79646,0.1391),
-            QVector3D(0.9272,0.79616,0.13987),
-            QVector3D(0.93494,0.79542,0.1405),
-            QVector3D(0.94218,0.7942,0.14092),
-            QVector3D(0.94889,0.79248,0.14112),
-            QVector3D(0.95503,0.79026,0.14111),
-            QVector3D(0.9606,0.78755,0.14089),
-            QVector3D(0.96559,0.78436,0.14045),
-            QVector3D(0.97002,0.7807,0.1398),
-            QVector3D(0.9739,0.77661,0.13901),
-            QVector3D(0.97726,0.77212,0.13808),
-            QVector3D(0.98015,0.76727,0.13693),
-            QVector3D(0.9826,0.76211,0.13566),
-            QVector3D(0.98467,0.75668,0.13433),
-            QVector3D(0.9864,0.75102,0.13284),
-            QVector3D(0.98784,0.74515,0.13129),
-            QVector3D(0.98904,0.73914,0.12968),
-            QVector3D(0.99004,0.73298,0.128),
-            QVector3D(0.99087,0.72672,0.1263),
-            QVector3D(0.99158,0.72038,0.12453),
-            QVector3D(0.99217,0.71398,0.12276),
-            QVector3D(0.99268,0.70752,0.121),
-            QVector3D(0.99312,0.70102,0.11926),
-            QVector3D(0.9935,0.69447,0.11747),
-            QVector3D(0.99383,0.68791,0.11573),
-            QVector3D(0.99412,0.68132,0.11394),
-            QVector3D(0.99438,0.6747,0.1122),
-            QVector3D(0.99461,0.66807,0.11045),
-            QVector3D(0.99481,0.66142,0.10865),
-            QVector3D(0.995,0.65473,0.10697),
-            QVector3D(0.99516,0.64804,0.10517),
-            QVector3D(0.99529,0.64132,0.1035),
-            QVector3D(0.99541,0.63459,0.10176),
-            QVector3D(0.9955,0.62783,0.10005),
-            QVector3D(0.99557,0.62104,0.098389),
-            QVector3D(0.99561,0.61422,0.096641),
-            QVector3D(0.99564,0.60739,0.095059),
-            QVector3D(0.99564,0.60052,0.093326),
-            QVector3D(0.99562,0.59363,0.091753),
-            QVector3D(0.99558,0.5867,0.090085),
-            QVector3D(0.99551,0.57975,0.08846),
-            QVector3D(0.99543,0.57276,0.086866),
-            QVector3D(0.99532,0.56573,0.085214),
-            QVector3D(0.9952,0.55867,0.083665),
-            QVector3D(0.99505,0.55159,0.082128),
-            QVector3D(0.99488,0.54446,0.080509),
-            QVector3D(0.99469,0.53729,0.078934),
-            QVector3D(0.99448,0.53007,0.077397),
-            QVector3D(0.99425,0.52281,0.0759),
-            QVector3D(0.994,0.5155,0.074438),
-            QVector3D(0.99373,0.50816,0.07298),
-            QVector3D(0.99343,0.50075,0.071525),
-            QVector3D(0.99312,0.49329,0.070045),
-            QVector3D(0.99279,0.48577,0.068661),
-            QVector3D(0.99244,0.4782,0.067207),
-            QVector3D(0.99206,0.47057,0.0658),
-            QVector3D(0.99167,0.46285,0.064435),
-            QVector3D(0.99126,0.45509,0.063129),
-            QVector3D(0.99083,0.44724,0.061707),
-            QVector3D(0.99038,0.43931,0.060477),
-            QVector3D(0.98991,0.43131,0.059288),
-            QVector3D(0.98943,0.42321,0.058031),
-            QVector3D(0.98894,0.41505,0.05706),
-            QVector3D(0.98843,0.40681,0.056202),
-            QVector3D(0.98792,0.3985,0.055473),
-            QVector3D(0.98741,0.39011,0.055034),
-            QVector3D(0.9869,0.38168,0.054941),
-            QVector3D(0.9864,0.37321,0.055283),
-            QVector3D(0.98593,0.36474,0.056189),
-            QVector3D(0.98549,0.3563,0.057588),
-            QVector3D(0.9851,0.34792,0.059933),
-            QVector3D(0.98478,0.33968,0.062969),
-            QVector3D(0.98453,0.33161,0.066854),
-            QVector3D(0.98439,0.32384,0.071751),
-            QVector3D(0.98437,0.31645,0.077527),
-            QVector3D(0.98449,0.30952,0.084428),
-            QVector3D(0.98477,0.30314,0.09217),
-            QVector3D(0.98521,0.29747,0.10081),
-            QVector3D(0.98584,0.29256,0.1104),
-            QVector3D(0.98667,0.28854,0.12072),
-            QVector3D(0.98768,0.28545,0.1319),
-            QVector3D(0.98888,0.2834,0.14376),
-            QVector3D(0.99026,0.28237,0.15632),
-            QVector3D(0.9918,0.28237,0.16948),
-            QVector3D(0.9935,0.28336,0.18318),
-            QVector3D(0.99531,0.28528,0.19743),
-            QVector3D(0.99722,0.2881,0.21214),
-            QVector3D(0.99921,0.29171,0.22722),
-            QVector3D(1,0.29596,0.24264),
-            QVector3D(1,0.3008,0.25836),
-            QVector3D(1,0.30615,0.27432),
-            QVector3D(1,0.31182,0.29047),
-            QVector3D(1,0.31783,0.30679),
-            QVector3D(1,0.32406,0.32321),
-            QVector3D(1,0.33045,0.33974),
-            QVector3D(1,0.33697,0.35632),
-            QVector3D(1,0.34355,0.37295),
-            QVector3D(1,0.3502,0.38964),
-            QVector3D(1,0.35686,0.40637),
-            QVector3D(1,0.36352,0.42312),
-            QVector3D(1,0.37019,0.43991),
-            QVector3D(1,0.37687,0.45672),
-            QVector3D(1,0.38352,0.47355),
-            QVector3D(1,0.39014,0.49042),
-            QVector3D(1,0.39675,0.50731),
-            QVector3D(1,0.40335,0.52423),
-            QVector3D(1,0.40993,0.54118),
-            QVector3D(1,0.41648,0.55818),
-            QVector3D(1,0.42301,0.57522),
-            QVector3D(1,0.42955,0.5923),
-            QVector3D(1,0.43607,0.60942),
-            QVector3D(1,0.44258,0.62659),
-            QVector3D(1,0.44907,0.6438),
-            QVector3D(1,0.45556,0.66106),
-            QVector3D(1,0.46203,0.67837),
-            QVector3D(1,0.4685,0.69574),
-            QVector3D(1,0.47498,0.71314),
-            QVector3D(1,0.48143,0.7306),
-            QVector3D(1,0.48789,0.74812),
-            QVector3D(1,0.49434,0.76568),
-            QVector3D(1,0.50078,0.78329),
-            QVector3D(1,0.50723,0.80096),
-            QVector3D(1,0.51367,0.81867),
-            QVector3D(1,0.5201,0.83645),
-            QVector3D(1,0.52655,0.85427),
-            QVector3D(1,0.53299,0.87215),
-            QVector3D(1,0.53942,0.89007),
-            QVector3D(1,0.54587,0.90805),
-            QVector3D(1,0.55231,0.92608),
-            QVector3D(0.99945,0.55874,0.94416),
-            QVector3D(0.99597,0.56518,0.96229),
-            QVector3D(0.99228,0.57163,0.98048)
-        },
-        {
-            QVector3D(0,0.20387,0.96251),
-            QVector3D(0,0.21524,0.9514),
-            QVector3D(0,0.22613,0.94031),
-            QVector3D(0,0.23654,0.92923),
-            QVector3D(0,0.24654,0.91817),
-            QVector3D(0,0.2562,0.90712),
-            QVector3D(0,0.26557,0.89608),
-            QVector3D(0,0.27465,0.88506),
-            QVector3D(0,0.28348,0.87405),
-            QVector3D(0,0.29209,0.86305),
-            QVector3D(0,0.30047,0.85206),
-            QVector3D(0,0.3087,0.84109),
-            QVector3D(0,0.31672,0.83013),
-            QVector3D(0,0.32458,0.81917),
-            QVector3D(0,0.33232,0.80823),
-            QVector3D(0,0.3399,0.7973),
-            QVector3D(0,0.34736,0.78638),
-            QVector3D(0,0.3547,0.77546),
-            QVector3D(0,0.36191,0.76456),
-            QVector3D(0,0.36902,0.75367),
-            QVector3D(0,0.37602,0.7428),
-            QVector3D(0,0.38291,0.73193),
-            QVector3D(0,0.38969,0.72108),
-            QVector3D(0,0.39636,0.71026),
-            QVector3D(0,0.40292,0.69946),
-            QVector3D(0,0.40934,0.68872),
-            QVector3D(0,0.41561,0.67802),
-            QVector3D(0,0.42172,0.66738),
-            QVector3D(0,0.42768,0.65684),
-            QVector3D(0,0.43342,0.64639),
-            QVector3D(0,0.43896,0.63605),
-            QVector3D(0,0.44432,0.62583),
-            QVector3D(0,0.44945,0.61575),
-            QVector3D(0,0.45438,0.60579),
-            QVector3D(0,0.45911,0.59597),
-            QVector3D(0.0043377,0.46367,0.58627),
-            QVector3D(0.029615,0.46807,0.57668),
-            QVector3D(0.055795,0.47235,0.56717),
-            QVector3D(0.077065,0.47652,0.55774),
-            QVector3D(0.095292,0.48061,0.54837),
-            QVector3D(0.11119,0.48465,0.53903),
-            QVector3D(0.1253,0.48865,0.52971),
-            QVector3D(0.13799,0.49262,0.5204),
-            QVector3D(0.14937,0.49658,0.5111),
-            QVector3D(0.15963,0.50055,0.50179),
-            QVector3D(0.169,0.50452,0.49244),
-            QVector3D(0.17747,0.50849,0.48309),
-            QVector3D(0.18517,0.51246,0.4737),
-            QVector3D(0.19217,0.51645,0.46429),
-            QVector3D(0.19856,0.52046,0.45483),
-            QVector3D(0.20443,0.52448,0.44531),
-            QVector3D(0.20974,0.52851,0.43577),
-            QVector3D(0.21461,0.53255,0.42616),
-            QVector3D(0.21905,0.53661,0.41651),
-            QVector3D(0.22309,0.54066,0.40679),
-            QVector3D(0.22674,0.54474,0.397),
-            QVector3D(0.23002,0.54883,0.38713),
-            QVector3D(0.233,0.55292,0.3772),
-            QVector3D(0.23568,0.55703,0.36716),
-            QVector3D(0.23802,0.56114,0.35704),
-            QVector3D(0.24006,0.56526,0.34678),
-            QVector3D(0.24185,0.56939,0.3364),
-            QVector3D(0.24334,0.57354,0.32588),
-            QVector3D(0.24458,0.57769,0.31523),
-            QVector3D(0.24556,0.58185,0.30439),
-            QVector3D(0.2463,0.58603,0.29336),
-            QVector3D(0.2468,0.59019,0.28214),
-            QVector3D(0.24707,0.59438,0.27067),
-            QVector3D(0.24714,0.59856,0.25896),
-            QVector3D(0.24703,0.60275,0.24696),
-            QVector3D(0.24679,0.60693,0.23473),
-            QVector3D(0.24647,0.61109,0.22216),
-            QVector3D(0.24615,0.61523,0.20936),
-            QVector3D(0.24595,0.61936,0.19632),
-            QVector3D(0.246,0.62342,0.18304),
-            QVector3D(0.24644,0.62742,0.16969),
-            QVector3D(0.24748,0.63135,0.1563),
-            QVector3D(0.24925,0.63518,0.14299),
-            QVector3D(0.25196,0.6389,0.13001),
-            QVector3D(0.2557,0.64249,0.11741),
-            QVector3D(0.26057,0.64594,0.10557),
-            QVector3D(0.26659,0.64926,0.094696),
-            QVector3D(0.27372,0.65242,0.084904),
-            QVector3D(0.28182,0.65545,0.076489),
-            QVector3D(0.29078,0.65835,0.069753),
-            QVector3D(0.30043,0.66113,0.064513),
-            QVector3D(0.31061,0.66383,0.060865),
-            QVector3D(0.32112,0.66642,0.058721),
-            QVector3D(0.33186,0.66896,0.057692),
-            QVector3D(0.34272,0.67144,0.057693),
-            QVector3D(0.35356,0.67388,0.058443),
-            QVector3D(0.36439,0.67628,0.059738),
-            QVector3D(0.37512,0.67866,0.061142),
-            QVector3D(0.38575,0.68102,0.062974),
-            QVector3D(0.39627,0.68337,0.064759),
-            QVector3D(0.40666,0.68571,0.066664),
-            QVector3D(0.41692,0.68803,0.068644),
-            QVector3D(0.42707,0.69034,0.070512),
-            QVector3D(0.43709,0.69266,0.072423),
-            QVector3D(0.44701,0.69494,0.074359),
-            QVector3D(0.45683,0.69723,0.076211),
-            QVector3D(0.46657,0.6995,0.07809),
-            QVector3D(0.47621,0.70177,0.079998),
-            QVector3D(0.48577,0.70403,0.081943),
-            QVector3D(0.49527,0.70629,0.083778),
-            QVector3D(0.5047,0.70853,0.085565),
-            QVector3D(0.51405,0.71076,0.087502),
-            QVector3D(0.52335,0.71298,0.089316),
-            QVector3D(0.53259,0.7152,0.091171),
-            QVector3D(0.54176,0.7174,0.092931),
-            QVector3D(0.5509,0.7196,0.094839),
-            QVector3D(0.55999,0.72178,0.096566),
-            QVector3D(0.56902,0.72396,0.098445),
-            QVector3D(0.57802,0.72613,0.10023),
-            QVector3D(0.58698,0.72828,0.10204),
-            QVector3D(0.5959,0.73044,0.10385),
-            QVector3D(0.60479,0.73258,0.10564),
-            QVector3D(0.61363,0.73471,0.10744),
-            QVector3D(0.62246,0.73683,0.10925),
-            QVector3D(0.63125,0.73895,0.11102),
-            QVector3D(0.64001,0.74104,0.11282),
-            QVector3D(0.64874,0.74315,0.11452),
-            QVector3D(0.65745,0.74523,0.11636),
-            QVector3D(0.66613,0.74731,0.11813),
-            QVector3D(0.67479,0.74937,0.11986),
-            QVector3D(0.68343,0.75144,0.12161),
-            QVector3D(0.69205,0.75348,0.12338),
-            QVector3D(0.70065,0.75552,0.12517),
-            QVector3D(0.70923,0.75755,0.12691),
-            QVector3D(0.71779,0.75957,0.12868),
-            QVector3D(0.72633,0.76158,0.13048),
-            QVector3D(0.73487,0.76359,0.13221),
-            QVector3D(0.74338,0.76559,0.13396),
-            QVector3D(0.75188,0.76756,0.13568),
-            QVector3D(0.76037,0.76954,0.13747),
-            QVector3D(0.76884,0.77151,0.13917),
-            QVector3D(0.77731,0.77346,0.14097),
-            QVector3D(0.78576,0.77541,0.14269),
-            QVector3D(0.7942,0.77736,0.14444),
-            QVector3D(0.80262,0.77928,0.14617),
-            QVector3D(0.81105,0.7812,0.14791),
-            QVector3D(0.81945,0.78311,0.14967),
-            QVector3D(0.82786,0.78502,0.15138),
-            QVector3D(0.83626,0.78691,0.15311),
-            QVector3D(0.84465,0.7888,0.15486),
-            QVector3D(0.85304,0.79066,0.15662),
-            QVector3D(0.86141,0.79251,0.15835),
-            QVector3D(0.86978,0.79434,0.16002),
-            QVector3D(0.87814,0.79612,0.16178),
-            QVector3D(0.88647,0.79786,0.16346),
-            QVector3D(0.89477,0.79952,0.16507),
-            QVector3D(0.90301,0.80106,0.1667),
-            QVector3D(0.91115,0.80245,0.16819),
-            QVector3D(0.91917,0.80364,0.16964),
-            QVector3D(0.92701,0.80456,0.1709),
-            QVector3D(0.93459,0.80514,0.172),
-            QVector3D(0.94185,0.80532,0.17289),
-            QVector3D(0.94869,0.80504,0.17355),
-            QVector3D(0.95506,0.80424,0.17392),
-            QVector3D(0.96088,0.80289,0.17399),
-            QVector3D(0.96609,0.80097,0.17375),
-            QVector3D(0.97069,0.7985,0.17319),
-            QVector3D(0.97465,0.79549,0.17234),
-            QVector3D(0.97801,0.79201,0.17121),
-            QVector3D(0.98082,0.7881,0.16986),
-            QVector3D(0.98314,0.78384,0.16825),
-            QVector3D(0.98504,0.77928,0.16652),
-            QVector3D(0.9866,0.7745,0.16463),
-            QVector3D(0.98789,0.76955,0.16265),
-            QVector3D(0.98897,0.76449,0.16056),
-            QVector3D(0.9899,0.75932,0.15848),
-            QVector3D(0.99072,0.75411,0.15634),
-            QVector3D(0.99146,0.74885,0.15414),
-            QVector3D(0.99214,0.74356,0.15196),
-            QVector3D(0.99279,0.73825,0.14981),
-            QVector3D(0.9934,0.73293,0.1476),
-            QVector3D(0.99398,0.72759,0.14543),
-            QVector3D(0.99454,0.72224,0.1432),
-            QVector3D(0.99509,0.71689,0.14103),
-            QVector3D(0.99562,0.71152,0.1388),
-            QVector3D(0.99613,0.70614,0.13659),
-            QVector3D(0.99662,0.70075,0.13444),
-            QVector3D(0.9971,0.69534,0.13223),
-            QVector3D(0.99755,0.68993,0.13006),
-            QVector3D(0.998,0.6845,0.12783),
-            QVector3D(0.99842,0.67906,0.12564),
-            QVector3D(0.99883,0.67361,0.1234),
-            QVector3D(0.99922,0.66815,0.12119),
-            QVector3D(0.99959,0.66267,0.11904),
-            QVector3D(0.99994,0.65717,0.11682),
-            QVector3D(1,0.65166,0.11458),
-            QVector3D(1,0.64613,0.11244),
-            QVector3D(1,0.64059,0.11024),
-            QVector3D(1,0.63503,0.10797),
-            QVector3D(1,0.62945,0.1058),
-            QVector3D(1,0.62386,0.1036),
-            QVector3D(1,0.61825,0.10135),
-            QVector3D(1,0.61261,0.099135),
-            QVector3D(1,0.60697,0.096882),
-            QVector3D(1,0.6013,0.094743),
-            QVector3D(1,0.59561,0.092465),
-            QVector3D(1,0.58989,0.090257),
-            QVector3D(1,0.58416,0.088032),
-            QVector3D(1,0.5784,0.085726),
-            QVector3D(1,0.57263,0.083542),
-            QVector3D(1,0.56682,0.081316),
-            QVector3D(1,0.56098,0.079004),
-            QVector3D(1,0.55513,0.076745),
-            QVector3D(1,0.54925,0.07453),
-            QVector3D(1,0.54333,0.072245),
-            QVector3D(1,0.53739,0.070004),
-            QVector3D(1,0.53141,0.067732),
-            QVector3D(1,0.52541,0.065424),
-            QVector3D(1,0.51937,0.06318),
-            QVector3D(1,0.5133,0.06081),
-            QVector3D(1,0.50718,0.058502),
-            QVector3D(1,0.50104,0.056232),
-            QVector3D(1,0.49486,0.053826),
-            QVector3D(1,0.48863,0.051494),
-            QVector3D(1,0.48236,0.049242),
-            QVector3D(1,0.47605,0.046828),
-            QVector3D(1,0.46969,0.044447),
-            QVector3D(1,0.46327,0.042093),
-            QVector3D(1,0.45681,0.039648),
-            QVector3D(1,0.45031,0.037261),
-            QVector3D(1,0.44374,0.034882),
-            QVector3D(1,0.43712,0.032495),
-            QVector3D(1,0.43043,0.030303),
-            QVector3D(1,0.42367,0.02818),
-            QVector3D(1,0.41686,0.026121),
-            QVector3D(1,0.40997,0.024126),
-            QVector3D(1,0.40299,0.022194),
-            QVector3D(1,0.39595,0.020325),
-            QVector3D(1,0.38882,0.018517),
-            QVector3D(0.99994,0.38159,0.016771),
-            QVector3D(0.99961,0.37428,0.015085),
-            QVector3D(0.99927,0.36685,0.013457),
-            QVector3D(0.99892,0.35932,0.011916),
-            QVector3D(0.99855,0.35167,0.010169),
-            QVector3D(0.99817,0.3439,0.0087437),
-            QVector3D(0.99778,0.336,0.0073541),
-            QVector3D(0.99738,0.32796,0.0060199),
-            QVector3D(0.99696,0.31976,0.0047429),
-            QVector3D(0.99653,0.31138,0.0035217),
-            QVector3D(0.99609,0.30282,0.0023557),
-            QVector3D(0.99563,0.29407,0.0012445),
-            QVector3D(0.99517,0.2851,0.00018742),
-            QVector3D(0.99469,0.27591,0),
-            QVector3D(0.9942,0.26642,0),
-            QVector3D(0.99369,0.25664,0),
-            QVector3D(0.99318,0.24652,0),
-            QVector3D(0.99265,0.23605,0),
-            QVector3D(0.99211,0.22511,0),
-            QVector3D(0.99155,0.2137,0),
-            QVector3D(0.99099,0.20169,0),
-            QVector3D(0.99041,0.18903,0)
-        }
-    };
+
+}
+
+int ColourMaps::clampMap(int mapNum) const
+{
+    if (mapNum >= NUMBER_OF_MAPS)
+    {
+        return NUMBER_OF_MAPS - 1;
+    }
+    else if (mapNum < 0)
+    {
+        return 0;
+    }
+    return mapNum;
 }
@@ -2,10 +2,12 @@
  * @file ColourMaps.h
  * @author Donal Evans
  * @date 09 Sep 2016
- * @brief This class provides a list of colour maps, as QVectors of QVector3D
- * RBG float values, from 0-1.
+ * @brief This class provides a list of colour maps, as tables of RGB float
+ * values, from 0-1.
  *
- * Detailed description goes here
+ * The colour maps are stored as a single compile-time constant table in
+ * ColourMaps.cpp, so no map construction takes place at startup and each map
+ * is a contiguous block of MAP_LENGTH RGB triplets.
  */
 
 #ifndef COLOURMAPS_H
@@ -25,29 +27,59 @@ public:
     /**
      * @brief Access function for an individual colour in a colour map.
      * @param map The map to be accessed.
-     * @param mapIndex The index of the colour to be accessed.
+     * @param mapIndex The index of the colour to be accessed. Indices outside
+     * the map are clamped to the first or last colour.
      * @return A QVector3D of RBG float values, from 0-1.
      */
-    QVector3D GetColour(int map, int mapIndex);
+    QVector3D GetColour(int map, int mapIndex) const;
 
     /**
      * @brief Access function for a particular colour map.
+     *
+     * The returned QVector is built from the constant table on each call, so
+     * this should only be used where a copy is needed, such as by the legend.
      * @param mapNum The index of the colour map to be accessed.
      * @return A QVector of QVector3D RBG float values, from 0-1.
      */
-    QVector<QVector3D> GetMap(int mapNum);
+    QVector<QVector3D> GetMap(int mapNum) const;
 
     /**
-     * @brief Returns the length of m_ColourMaps.
-     * @return The number of maps in m_ColourMaps.
+     * @brief Access function for the raw data of a particular colour map.
+     * @param mapNum The index of the colour map to be accessed. Indices
+     * outside the list of maps are clamped to the first or last map.
+     * @return A pointer to MAP_LENGTH consecutive RGB triplets of floats,
+     * from 0-1.
      */
-    int GetNumberOfMaps();
+    const float* GetMapData(int mapNum) const;
+
+    /**
+     * @brief Returns the number of colours in each map.
+     * @return The number of colours in each map.
+     */
+    int GetMapLength() const;
+
+    /**
+     * @brief Returns the number of available colour maps.
+     * @return The number of colour maps.
+     */
+    int GetNumberOfMaps() const;
+
+    /**
+     * @brief The number of colours in each colour map.
+     */
+    static const int MAP_LENGTH = 256;
+
+    /**
+     * @brief The number of colour maps in the table.
+     */
+    static const int NUMBER_OF_MAPS = 38;
 
 private:
     /**
-     *@brief A QVector of colour maps, each one being a QVector of QVector3D
-     *RBG float values, from 0-1.
+     * @brief Clamps a map number to the range of available maps.
+     * @param mapNum The index of the colour map to be accessed.
+     * @return A valid index into the colour map table.
      */
-    QVector<QVector<QVector3D> > m_ColourMaps;
+    int clampMap(int mapNum) const;
 };
 #endif // COLOURMAPS_H
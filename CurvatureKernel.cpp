@@ -0,0 +1,118 @@
+#include "CurvatureKernel.h"
+#include "Parallel.h"
+#include <QtMath>
+
+namespace
+{
+    /**
+     * @brief The smallest denominator used, preventing division by zero when
+     * an atom does not move between frames.
+     */
+    const float MIN_DENOMINATOR = 1e-30f;
+}
+
+void CurvatureKernel::CalculateBlock(const float* x,
+                                     const float* y,
+                                     const float* z,
+                                     int frames,
+                                     int lanes,
+                                     float* curvature)
+{
+    if (frames < 3)
+    {
+        for (int i = 0; i < frames*lanes; ++i)
+        {
+            curvature[i] = 0;
+        }
+        return;
+    }
+
+    for (int f = 1; f < frames - 1; ++f)
+    {
+        const int prev = (f - 1)*lanes;
+        const int curr = f*lanes;
+        const int next = (f + 1)*lanes;
+        for (int lane = 0; lane < lanes; ++lane)
+        {
+            float ax = x[curr + lane] - x[prev + lane];
+            float ay = y[curr + lane] - y[prev + lane];
+            float az = z[curr + lane] - z[prev + lane];
+            float bx = x[next + lane] - x[curr + lane];
+            float by = y[next + lane] - y[curr + lane];
+            float bz = z[next + lane] - z[curr + lane];
+
+            float cx = ay*bz - az*by;
+            float cy = az*bx - ax*bz;
+            float cz = ax*by - ay*bx;
+            float sx = ax + bx;
+            float sy = ay + by;
+            float sz = az + bz;
+
+            float cross = cx*cx + cy*cy + cz*cz;
+            float denominator = (ax*ax + ay*ay + az*az)
+                              * (bx*bx + by*by + bz*bz)
+                              * (sx*sx + sy*sy + sz*sz);
+            denominator = denominator > MIN_DENOMINATOR ? denominator
+                                                        : MIN_DENOMINATOR;
+            curvature[curr + lane] = 2*sqrtf(cross/denominator);
+        }
+    }
+
+    const int last = (frames - 1)*lanes;
+    for (int lane = 0; lane < lanes; ++lane)
+    {
+        curvature[lane] = curvature[lanes + lane];
+        curvature[last + lane] = curvature[last - lanes + lane];
+    }
+}
+
+void CurvatureKernel::Calculate(const QVector<Atom*>& atoms)
+{
+    if (atoms.isEmpty())
+    {
+        return;
+    }
+    const int frames = atoms[0]->GetTrajectoryRef().length();
+    const int blocks = (atoms.length() + BLOCK_SIZE - 1)/BLOCK_SIZE;
+
+    Parallel::For(blocks, 1, [&](int, int firstBlock, int lastBlock)
+    {
+        QVector<float> x(frames*BLOCK_SIZE);
+        QVector<float> y(frames*BLOCK_SIZE);
+        QVector<float> z(frames*BLOCK_SIZE);
+        QVector<float> curvature(frames*BLOCK_SIZE);
+
+        for (int block = firstBlock; block < lastBlock; ++block)
+        {
+            const int firstAtom = block*BLOCK_SIZE;
+            const int remaining = atoms.length() - firstAtom;
+            const int lanes = remaining < BLOCK_SIZE ? remaining : BLOCK_SIZE;
+
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                const QVector3D* trajectory =
+                        atoms[firstAtom + lane]->GetTrajectoryRef().constData();
+                for (int f = 0; f < frames; ++f)
+                {
+                    x[f*lanes + lane] = trajectory[f].x();
+                    y[f*lanes + lane] = trajectory[f].y();
+                    z[f*lanes + lane] = trajectory[f].z();
+                }
+            }
+
+            CalculateBlock(x.constData(), y.constData(), z.constData(),
+                           frames, lanes, curvature.data());
+
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                QVector<float>& atomCurvature =
+                        atoms[firstAtom + lane]->GetDiscreteCurvatureRef();
+                atomCurvature.resize(frames);
+                for (int f = 0; f < frames; ++f)
+                {
+                    atomCurvature[f] = curvature[f*lanes + lane];
+                }
+            }
+        }
+    });
+}
@@ -0,0 +1,64 @@
+/**
+ * @file CurvatureKernel.h
+ * @date 19 Oct 2026
+ * @see Atom.h
+ * @brief This class calculates the discrete curvature of atom paths without
+ * trigonometric functions.
+ *
+ * The curvature at each frame is the Menger curvature of the positions at
+ * the previous, current and next frames, 2|a x b|/(|a||b||a + b|), where a
+ * and b are the displacements into and out of the frame. This is the inverse
+ * radius of the circle through the three points, in inverse nm. Atoms are
+ * processed in blocks that are transposed into a structure of arrays layout,
+ * so the inner loop runs across the atoms of a block and can be vectorized
+ * by the compiler. The calculation holds no state between frames or atoms
+ * and is safe to run on many threads at once.
+ */
+
+#ifndef CURVATUREKERNEL_H
+#define CURVATUREKERNEL_H
+
+#include "Atom.h"
+#include <QVector>
+
+class CurvatureKernel
+{
+public:
+    /**
+     * @brief Calculates the discrete curvature for every frame of a block of
+     * atoms stored in structure of arrays layout.
+     *
+     * The coordinate of atom @e lane at frame @e f is found at index
+     * f*lanes + lane of each coordinate array, and the curvature is written
+     * to the same index of @e curvature. The first and last frames take the
+     * value of their neighbouring frame, and paths with fewer than three
+     * frames have zero curvature.
+     * @param x The x coordinates.
+     * @param y The y coordinates.
+     * @param z The z coordinates.
+     * @param frames The number of frames.
+     * @param lanes The number of atoms in the block.
+     * @param curvature The output array, of frames*lanes floats.
+     */
+    static void CalculateBlock(const float* x,
+                               const float* y,
+                               const float* z,
+                               int frames,
+                               int lanes,
+                               float* curvature);
+
+    /**
+     * @brief Calculates the discrete curvature for every @Atom in @e atoms
+     * and stores it in each @Atom, splitting the atoms across the global
+     * thread pool. All atoms must have the same number of frames.
+     * @param atoms The atoms to be processed.
+     */
+    static void Calculate(const QVector<Atom*>& atoms);
+
+    /**
+     * @brief The number of atoms transposed into each block.
+     */
+    static const int BLOCK_SIZE = 16;
+};
+
+#endif // CURVATUREKERNEL_H
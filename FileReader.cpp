@@ -1,6 +1,10 @@
 #include "FileReader.h"
-#include "xdrfile.h"
-#include "xdrfile_xtc.h"
+#include "CurvatureKernel.h"
+#include "MeanSquareDisplacement.h"
+#include "MemoryAccount.h"
+#include "Parallel.h"
+#include "ResultsFile.h"
+#include "Trace.h"
 #include <QFile>
 #include <QTextStream>
 
@@ -24,6 +28,21 @@ void FileReader::setGroList(QStringList& groList)
     m_GroList = groList;
 }
 
+float FileReader::GetMaxDiffusion()
+{
+    return m_MaxDiffusion;
+}
+
+float FileReader::GetMaxDiscreteCurvature()
+{
+    return m_MaxDiscreteCurvature;
+}
+
+float FileReader::GetMaxFluctuation()
+{
+    return m_MaxFluctuation;
+}
+
 float FileReader::GetMaxPathCurvature()
 {
     return m_MaxPathCurvature;
@@ -39,6 +58,21 @@ float FileReader::GetMaxVelocity()
     return m_MaxVelocity;
 }
 
+float FileReader::GetMinDiffusion()
+{
+    return m_MinDiffusion;
+}
+
+float FileReader::GetMinDiscreteCurvature()
+{
+    return m_MinDiscreteCurvature;
+}
+
+float FileReader::GetMinFluctuation()
+{
+    return m_MinFluctuation;
+}
+
 float FileReader::GetMinPathCurvature()
 {
     return m_MinPathCurvature;
@@ -54,6 +88,71 @@ float FileReader::GetMinVelocity()
     return m_MinVelocity;
 }
 
+const QVector<XtcPipeline::Stage>& FileReader::GetLoadStages()
+{
+    return m_LoadStages;
+}
+
+int FileReader::GetFrameStride()
+{
+    return m_FrameStride;
+}
+
+void FileReader::SetFrameStride(int stride)
+{
+    m_FrameStride = qMax(1, stride);
+}
+
+float FileReader::GetStartTime()
+{
+    return m_StartTime;
+}
+
+float FileReader::GetEndTime()
+{
+    return m_EndTime;
+}
+
+void FileReader::SetTimeWindow(float startTime, float endTime)
+{
+    m_StartTime = startTime;
+    m_EndTime = endTime;
+}
+
+const AtomSelection& FileReader::GetAtomSelection()
+{
+    return m_AtomSelection;
+}
+
+void FileReader::SetAtomSelection(const AtomSelection& selection)
+{
+    m_AtomSelection = selection;
+}
+
+const QVector<Superposition::Fit>& FileReader::GetFitsRef()
+{
+    return m_Fits;
+}
+
+void FileReader::SetFit(const SelectionExpression& selection,
+                        int referenceFrame)
+{
+    if (selection.GetExpression() == m_FitSelection.GetExpression()
+            && referenceFrame == m_FitReference)
+    {
+        return;
+    }
+    m_FitSelection = selection;
+    m_FitReference = referenceFrame;
+    m_Fits.clear();
+    m_Fits.squeeze();
+    clearAlignedTrajectories();
+    m_Fluctuation = false;
+    m_MaxFluctuation = -INFINITY;
+    m_MinFluctuation = INFINITY;
+    updateMemoryAccount();
+}
+
 int FileReader::getNumOfResidues()
 {
     return m_NumOfResidues;
@@ -69,6 +168,11 @@ QVector<Residue *> &FileReader::GetResidueVectorRef()
     return m_ResidueVector;
 }
 
+float FileReader::GetResidueRadius()
+{
+    return m_ResidueRadius;
+}
+
 void FileReader::SetResidueVector(QVector<Residue *> residueVector)
 {
     m_ResidueVector = residueVector;
@@ -91,34 +195,98 @@ FileReader::FileReader()
 
 }
 
-void FileReader::addResidue(Residue* residue, int index)
+void FileReader::CalculateDiffusion()
+{
+    if(!m_Diffusion)
+    {
+        TRACE_SCOPE("FileReader::CalculateDiffusion");
+        emit consoleOutput("Calculating Diffusion Coefficients",0);
+        MeanSquareDisplacement::Calculate(GetAtomVectorRef());
+        findRange(&Atom::GetDiffusionRef, true,
+                  m_MinDiffusion, m_MaxDiffusion);
+        averageForAllResidues(&Atom::GetDiffusionRef);
+        averageForAllResidues(&Atom::GetMeanSquareDisplacementRef);
+        m_Diffusion = true;
+        updateMemoryAccount();
+        emit consoleOutput("Diffusion Coefficients Calculated",0);
+    }
+}
+
+void FileReader::CalculateDiscreteCurvature()
+{
+    if(!m_DiscreteCurvature)
+    {
+        TRACE_SCOPE("FileReader::CalculateDiscreteCurvature");
+        emit consoleOutput("Calculating Discrete Curvature",0);
+        CurvatureKernel::Calculate(GetAtomVectorRef());
+        findRange(&Atom::GetDiscreteCurvatureRef, false,
+                  m_MinDiscreteCurvature, m_MaxDiscreteCurvature);
+        averageForAllResidues(&Atom::GetDiscreteCurvatureRef);
+        m_DiscreteCurvature = true;
+        updateMemoryAccount();
+        emit consoleOutput("Discrete Curvature Calculated",0);
+    }
+}
+
+void FileReader::CalculateMeanSquareDisplacement()
+{
+    if (m_Diffusion && !GetAtomVectorRef().isEmpty()
+            && GetAtomVectorRef()[0]->GetMeanSquareDisplacementRef().isEmpty())
+    {
+        m_Diffusion = false;
+    }
+    CalculateDiffusion();
+}
+
+void FileReader::CalculateFluctuation()
+{
+    if(!m_Fluctuation && FitFrames())
+    {
+        TRACE_SCOPE("FileReader::CalculateFluctuation");
+        emit consoleOutput("Calculating Fluctuation",0);
+        Superposition::CalculateFluctuation(GetAtomVectorRef(), m_Fits);
+        findRange(&Atom::GetFluctuationRef, true,
+                  m_MinFluctuation, m_MaxFluctuation);
+        averageForAllResidues(&Atom::GetFluctuationRef);
+        m_Fluctuation = true;
+        updateMemoryAccount();
+        emit consoleOutput("Fluctuation Calculated",0);
+    }
+}
+
+bool FileReader::AlignFrames()
 {
-    GetResidueVectorRef()[index] = residue;
+    if(!m_Aligned && FitFrames())
+    {
+        TRACE_SCOPE("FileReader::AlignFrames");
+        emit consoleOutput("Aligning frames",0);
+        Superposition::Align(GetAtomVectorRef(), m_Fits);
+        QVector<Atom*> centroids;
+        centroids.reserve(GetResidueVectorRef().length());
+        for (int i = 0; i < GetResidueVectorRef().length(); ++i)
+        {
+            centroids.append(&GetResidueVectorRef()[i]->GetCentroidRef());
+        }
+        Superposition::Align(centroids, m_Fits);
+        m_Aligned = true;
+        updateMemoryAccount();
+        emit consoleOutput("Frames Aligned",0);
+    }
+    return m_Aligned;
 }
 
 void FileReader::CalculatePathCurvature()
 {
     if(!m_PathCurvature)
     {
+        TRACE_SCOPE("FileReader::CalculatePathCurvature");
         emit consoleOutput("Calculating Path Curvature",0);
-        QVector<float> pathCurve;
-        for (int i = 0; i < GetAtomVectorRef().length(); ++i)
-        {
-            GetAtomVectorRef()[i]->CalculatePathCurvature();
-            pathCurve = GetAtomVectorRef()[i]->GetPathCurvatureRef();
-            for (int j = 0; j < pathCurve.length(); ++j)
-            {
-                if (pathCurve[j] > m_MaxPathCurvature)
-                {
-                    m_MaxPathCurvature = pathCurve[j];
-                }
-                else if (pathCurve[j] < m_MinPathCurvature)
-                {
-                    m_MinPathCurvature = pathCurve[j];
-                }
-            }
-        }
+        calculateForAllAtoms(&Atom::CalculatePathCurvature);
+        findRange(&Atom::GetPathCurvatureRef, false,
+                  m_MinPathCurvature, m_MaxPathCurvature);
+        averageForAllResidues(&Atom::GetPathCurvatureRef);
         m_PathCurvature = true;
+        updateMemoryAccount();
         emit consoleOutput("Path Curvature Calculated",0);
     }
 }
@@ -127,22 +295,14 @@ void FileReader::CalculatePathLength()
 {
     if(!m_PathLength)
     {
+        TRACE_SCOPE("FileReader::CalculatePathLength");
         emit consoleOutput("Calculating Path Length",0);
-        QVector<float> pathLength;
-        for (int i = 0; i < GetAtomVectorRef().length(); ++i)
-        {
-            GetAtomVectorRef()[i]->CalculatePathLength();
-            pathLength = GetAtomVectorRef()[i]->GetPathLengthRef();
-            if (pathLength.last() > m_MaxPathLength)
-            {
-                m_MaxPathLength = pathLength.last();
-            }
-            else if (pathLength.last() < m_MinPathLength)
-            {
-                m_MinPathLength = pathLength.last();
-            }
-        }
+        calculateForAllAtoms(&Atom::CalculatePathLength);
+        findRange(&Atom::GetPathLengthRef, true,
+                  m_MinPathLength, m_MaxPathLength);
+        averageForAllResidues(&Atom::GetPathLengthRef);
         m_PathLength = true;
+        updateMemoryAccount();
         emit consoleOutput("Path Length Calculated",0);
     }
 }
@@ -151,29 +311,122 @@ void FileReader::CalculateVelocity()
 {
     if(!m_Velocity)
     {
+        TRACE_SCOPE("FileReader::CalculateVelocity");
         emit consoleOutput("Calculating velocity magnitude",0);
-        QVector<float> velocity;
-        for (int i = 0; i < GetAtomVectorRef().length(); ++i)
-        {
-            GetAtomVectorRef()[i]->CalculateVelocity();
-            velocity = GetAtomVectorRef()[i]->GetVelocityRef();
-            for (int j = 0; j < velocity.length(); ++j)
-            {
-                if (velocity[j] > m_MaxVelocity)
-                {
-                    m_MaxVelocity = velocity[j];
-                }
-                else if (velocity[j] < m_MinVelocity)
-                {
-                    m_MinVelocity = velocity[j];
-                }
-            }
-        }
+        calculateForAllAtoms(&Atom::CalculateVelocity);
+        findRange(&Atom::GetVelocityRef, false,
+                  m_MinVelocity, m_MaxVelocity);
+        averageForAllResidues(&Atom::GetVelocityRef);
         m_Velocity = true;
+        updateMemoryAccount();
         emit consoleOutput("Velocity Calculated",0);
     }
 }
 
+bool FileReader::FitFrames()
+{
+    if (!m_Fits.isEmpty())
+    {
+        return true;
+    }
+    if (GetAtomVectorRef().isEmpty())
+    {
+        return false;
+    }
+
+    TRACE_SCOPE("FileReader::FitFrames");
+    emit consoleOutput("Fitting frames",0);
+    QVector<Atom*> fitted;
+    if (m_FitSelection.IsEmpty())
+    {
+        fitted = GetAtomVectorRef();
+    }
+    else
+    {
+        Bitset chosen = m_FitSelection.Evaluate(AtomTable::FromAtoms(GetAtomVectorRef()));
+        QVector<int> indices = chosen.ToIndices();
+        fitted.reserve(indices.length());
+        for (int i = 0; i < indices.length(); ++i)
+        {
+            fitted.append(GetAtomVectorRef()[indices[i]]);
+        }
+    }
+    if (fitted.isEmpty())
+    {
+        emit consoleOutput("The fit selection chose no atoms",0);
+        return false;
+    }
+    int frames = GetAtomVectorRef()[0]->GetTrajectoryRef().length();
+    Superposition superposition;
+    superposition.SetReference(fitted, qBound(0, m_FitReference, frames - 1));
+    superposition.FitFrames(m_Fits);
+    updateMemoryAccount();
+    return true;
+}
+
+void FileReader::averageForAllResidues(QVector<float>& (Atom::*metric)())
+{
+    Residue* const* residues = GetResidueVectorRef().constData();
+    Parallel::For(GetResidueVectorRef().length(), MIN_RESIDUES_PER_THREAD,
+                  [residues, metric](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            residues[i]->AverageMetric(metric);
+        }
+    });
+}
+
+void FileReader::calculateForAllAtoms(void (Atom::*calculate)())
+{
+    Atom* const* atoms = GetAtomVectorRef().constData();
+    Parallel::For(GetAtomVectorRef().length(), MIN_ATOMS_PER_THREAD,
+                  [atoms, calculate](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            (atoms[i]->*calculate)();
+        }
+    });
+}
+
+void FileReader::calculateResidueCentroids()
+{
+    TRACE_SCOPE("FileReader::calculateResidueCentroids");
+    Residue* const* residues = GetResidueVectorRef().constData();
+    QVector3D box = GetSimBoxRef();
+    Parallel::For(GetResidueVectorRef().length(), MIN_RESIDUES_PER_THREAD,
+                  [residues, box](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            residues[i]->CalculateCentroid(box);
+        }
+    });
+
+    float radii = 0;
+    for (int i = 0; i < GetResidueVectorRef().length(); ++i)
+    {
+        radii += residues[i]->GetRadius();
+    }
+    m_ResidueRadius = GetResidueVectorRef().isEmpty()
+            ? 0 : radii/GetResidueVectorRef().length();
+}
+
+void FileReader::clearAlignedTrajectories()
+{
+    for (int i = 0; i < GetAtomVectorRef().length(); ++i)
+    {
+        GetAtomVectorRef()[i]->GetAlignedTrajectoryRef() = QVector<QVector3D>();
+    }
+    for (int i = 0; i < GetResidueVectorRef().length(); ++i)
+    {
+        GetResidueVectorRef()[i]->GetCentroidRef().GetAlignedTrajectoryRef()
+                = QVector<QVector3D>();
+    }
+    m_Aligned = false;
+}
+
 void FileReader::clearAtomVector()
 {
     emit consoleOutput("Clearing atom vector",0);
@@ -184,9 +437,28 @@ void FileReader::clearAtomVector()
     }
     GetAtomVectorRef().clear();
     GetAtomVectorRef().squeeze();
+    m_Fits.clear();
+    m_Fits.squeeze();
+    updateMemoryAccount();
+    m_Aligned = false;
+    m_Diffusion = false;
+    m_DiscreteCurvature = false;
+    m_Fluctuation = false;
     m_PathCurvature = false;
     m_PathLength = false;
     m_Velocity = false;
+    m_MaxDiffusion = -INFINITY;
+    m_MaxDiscreteCurvature = -INFINITY;
+    m_MaxFluctuation = -INFINITY;
+    m_MaxPathCurvature = -INFINITY;
+    m_MaxPathLength = -INFINITY;
+    m_MaxVelocity = -INFINITY;
+    m_MinDiffusion = INFINITY;
+    m_MinDiscreteCurvature = INFINITY;
+    m_MinFluctuation = INFINITY;
+    m_MinPathCurvature = INFINITY;
+    m_MinPathLength = INFINITY;
+    m_MinVelocity = INFINITY;
 }
 
 void FileReader::clearResidueVector()
@@ -198,27 +470,58 @@ void FileReader::clearResidueVector()
     }
     GetResidueVectorRef().clear();
     GetResidueVectorRef().squeeze();
+    m_ResidueRadius = 0;
 }
 
-void FileReader::createAtomVector()
+bool FileReader::createAtomVector(const QStringList& groList,
+                                  QVector<Atom*>& atoms,
+                                  QVector<int>& atomIndices,
+                                  int& numOfResidues)
 {
     emit consoleOutput("Creating atom vector...",0);
-    QStringListIterator groIterator(getGroList());
-    setNumOfResidues(0);
+    QStringListIterator groIterator(groList);
+    numOfResidues = 0;
+    atoms.clear();
+    atomIndices.clear();
+    atoms.reserve(groList.length());
     while (groIterator.hasNext())
     {
         QString atomDetail = groIterator.next();
         Atom* newAtomPtr = new Atom(atomDetail);
+        newAtomPtr->SetAtomNumber(atoms.length() + 1);
         int residueNumber = newAtomPtr->GetParentResidueID();
-        if (residueNumber > getNumOfResidues())
+        if (residueNumber > numOfResidues)
         {
-            setNumOfResidues(residueNumber);
+            numOfResidues = residueNumber;
         }
-        GetAtomVectorRef().append(newAtomPtr);
+        atoms.append(newAtomPtr);
     }
+
+    if (!m_AtomSelection.IsEmpty())
+    {
+        // Evaluate the selection over the whole topology at once, then keep
+        // only the chosen atoms.
+        Bitset chosen = m_AtomSelection.Select(AtomTable::FromAtoms(atoms));
+        atomIndices = chosen.ToIndices();
+        QVector<Atom*> chosenAtoms;
+        chosenAtoms.reserve(atomIndices.length());
+        for (int i = 0; i < atoms.length(); ++i)
+        {
+            if (chosen.Test(i))
+            {
+                chosenAtoms.append(atoms[i]);
+            }
+            else
+            {
+                delete atoms[i];
+            }
+        }
+        atoms = chosenAtoms;
+    }
+    return !atoms.isEmpty();
 }
 
-void FileReader::createGroList(QString groFileData)
+QStringList FileReader::createGroList(QString groFileData)
 {
     QStringList groList = groFileData.split(QString("\n"));
     groList.removeFirst();
@@ -228,35 +531,73 @@ void FileReader::createGroList(QString groFileData)
         groList.removeLast();
     }
     groList.removeLast();
-    setGroList(groList);
+    return groList;
 }
 
 void FileReader::createResidueVector()
 {
-    GetResidueVectorRef().resize(getNumOfResidues());
-    GetResidueVectorRef().fill(0);
+    Residue* residuePtr = 0;
     QVectorIterator<Atom*> atomIterator(GetAtomVectorRef());
     while (atomIterator.hasNext())
     {
         Atom* atomPtr = atomIterator.next();
         int residueID = atomPtr->GetParentResidueID();
+        QString residueName = atomPtr->GetParentResidue();
 
-        if (GetResidueVectorRef()[residueID - 1] == 0)
+        if (residuePtr == 0 || residuePtr->GetResidueID() != residueID
+                || residuePtr->GetResidueName() != residueName)
         {
-            Residue* residuePtr = new Residue();
+            residuePtr = new Residue();
             residuePtr->SetResidueID(residueID);
-            QString residueName = atomPtr->GetParentResidue();
             residuePtr->SetResidueName(residueName);
-            addResidue(residuePtr, residueID - 1);
+            GetResidueVectorRef().append(residuePtr);
         }
 
-        GetResidueVectorRef()[residueID - 1]->AddAtom(atomPtr);
+        residuePtr->AddAtom(atomPtr);
+    }
+}
 
+void FileReader::findRange(QVector<float>& (Atom::*metric)(),
+                           bool lastOnly,
+                           float& min,
+                           float& max)
+{
+    Atom* const* atoms = GetAtomVectorRef().constData();
+    int chunks = Parallel::ChunkCount(GetAtomVectorRef().length(),
+                                      MIN_ATOMS_PER_THREAD);
+    QVector<float> minima(chunks, INFINITY);
+    QVector<float> maxima(chunks, -INFINITY);
+    Parallel::For(GetAtomVectorRef().length(), MIN_ATOMS_PER_THREAD,
+                  [&](int chunk, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            QVector<float>& values = (atoms[i]->*metric)();
+            int start = lastOnly ? values.length() - 1 : 0;
+            for (int j = qMax(start, 0); j < values.length(); ++j)
+            {
+                if (values[j] > maxima[chunk])
+                {
+                    maxima[chunk] = values[j];
+                }
+                if (values[j] < minima[chunk])
+                {
+                    minima[chunk] = values[j];
+                }
+            }
+        }
+    });
+    for (int i = 0; i < chunks; ++i)
+    {
+        min = qMin(min, minima[i]);
+        max = qMax(max, maxima[i]);
     }
 }
 
-bool FileReader::fetchGroData(const QString& groFilePath)
+bool FileReader::fetchGroData(const QString& groFilePath,
+                              QStringList& groList)
 {
+    TRACE_SCOPE("FileReader::fetchGroData");
     QFile groFile(groFilePath);
     QString groFileData;
 
@@ -265,8 +606,7 @@ bool FileReader::fetchGroData(const QString& groFilePath)
         groFileData = groFile.readAll();
         groFile.close();
 
-        createGroList(groFileData);
-        createAtomVector();
+        groList = createGroList(groFileData);
         return true;
     }
     else
@@ -276,134 +616,255 @@ bool FileReader::fetchGroData(const QString& groFilePath)
     }
 }
 
-bool FileReader::fetchXtcData(const QString& xtcFilePath)
+bool FileReader::fetchXtcData(const QString& xtcFilePath,
+                              const XtcFrameIndex& index,
+                              const QVector<int>& frames)
 {
+    TRACE_SCOPE("FileReader::fetchXtcData");
     emit consoleOutput("Fetching .xtc data...",0);
-    char* xtcCharPath = xtcFilePath.toLatin1().data();
-    int xtcResult;
-    int xtcNumOfAtoms;
 
-    xtcResult = read_xtc_natoms(xtcCharPath,& xtcNumOfAtoms);
+    // Reserve the selected frames up front, so that the trajectories do not
+    // overshoot their final size as they grow.
+    for (int i = 0; i < GetAtomVectorRef().length(); ++i)
+    {
+        GetAtomVectorRef()[i]->GetTrajectoryRef().reserve(frames.length());
+        GetAtomVectorRef()[i]->GetStepTimeRef().reserve(frames.length());
+    }
 
-    if (xtcResult != exdrOK)
+    XtcPipeline pipeline(GetAtomVectorRef(), m_AtomIndices, index, frames);
+    if (!pipeline.Run(xtcFilePath))
     {
         emit consoleOutput("Failed to open .xtc file.",0);
         return false;
     }
+    m_LoadStages = pipeline.GetStages();
+    QVector3D box = pipeline.GetSimBox();
+    setSimBox(box.x(), box.y(), box.z());
+
+    emit consoleOutput(".xtc data fetching complete!",0);
+    return true;
+}
 
-    if (xtcNumOfAtoms != getGroList().length())
+bool FileReader::indexXtcData(const QString& xtcFilePath,
+                              int atoms,
+                              XtcFrameIndex& index,
+                              QVector<int>& frames)
+{
+    TRACE_SCOPE("FileReader::indexXtcData");
+    if (!index.Build(xtcFilePath))
+    {
+        emit consoleOutput("Failed to open .xtc file.",0);
+        return false;
+    }
+
+    if (index.GetAtoms() != atoms)
     {
         emit consoleOutput(".gro file and .xtc file "
                            "have different number of atoms!",0);
         return false;
     }
 
-    XDRFILE* xtcFile;
-    xtcFile = xdrfile_open(xtcCharPath, "r");
-
-    if (xtcFile == NULL)
+    frames = index.Select(m_StartTime, m_EndTime, m_FrameStride);
+    // The velocity and curvature need at least two frames.
+    if (frames.length() < 2)
     {
-        xdrfile_close(xtcFile);
+        emit consoleOutput("Fewer than two frames of the .xtc file are "
+                           "within the chosen time window and stride.",0);
         return false;
     }
+    return true;
+}
 
-    int xtcStep;
-    float xtcTime;
-    matrix boxMatrix;
-    int actualStep = 0;
-    int startTime;
-    int stepTime = 0;
-
-    while(1)
+float FileReader::UnwrapCoordinate(float position,
+                                   float previous,
+                                   float boxLength)
+{
+    if ((boxLength/position > 0.9)||(boxLength/position < 0.1))
     {
-        rvec* xtcPosition;
-        xtcPosition = (rvec* )calloc(xtcNumOfAtoms, sizeof(xtcPosition[0]));
-
-        xtcResult = read_xtc(xtcFile,xtcNumOfAtoms,&xtcStep,&xtcTime,
-                             boxMatrix,xtcPosition,&XTC_PREC);
-
-        if (xtcResult == exdrOK)
-        {
-            if (actualStep == 0)
-            {
-                startTime = xtcTime;
-            }
-            stepTime = xtcTime - startTime;
-
-            int atomIndex = 0;
-
-            for (int i = 0; i < GetAtomVectorRef().length(); ++i)
-            {
-                float xPos = xtcPosition[atomIndex][X_POSITION];
-                float yPos = xtcPosition[atomIndex][Y_POSITION];
-                float zPos = xtcPosition[atomIndex][Z_POSITION];
-
-                if ((actualStep > 0)&&
-                   ((boxMatrix[X_POSITION][X_POSITION]/xPos > 0.9)||
-                   (boxMatrix[X_POSITION][X_POSITION]/xPos < 0.1)))
-                {
-                    float prevX = GetAtomVectorRef()[i]->GetTrajectoryRef()[actualStep -1].x();
-                    if (abs(prevX - xPos) > boxMatrix[X_POSITION][X_POSITION] / 2)
-                    {
-                        xPos += (boxMatrix[X_POSITION][X_POSITION]*
-                                 (((prevX - xPos) > 0) - ((prevX - xPos) < 0)));
-                    }
-                }
-
-                if ((actualStep > 0)&&
-                   ((boxMatrix[Y_POSITION][Y_POSITION]/yPos > 0.9)||
-                   (boxMatrix[Y_POSITION][Y_POSITION]/yPos < 0.1)))
-                {
-                    float prevY = GetAtomVectorRef()[i]->GetTrajectoryRef()[actualStep -1].y();
-                    if (abs(prevY - yPos) > boxMatrix[Y_POSITION][Y_POSITION] / 2)
-                    {
-                        yPos += (boxMatrix[Y_POSITION][Y_POSITION]*
-                                 (((prevY - yPos) > 0) - ((prevY - yPos) < 0)));
-                    }
-                }
-
-                GetAtomVectorRef()[i]->AddTimeStep(xPos, yPos, zPos, stepTime);
-                ++atomIndex;
-            }
-            ++actualStep;
-        }
-        else
+        float difference = previous - position;
+        if (qAbs(difference) > boxLength / 2)
         {
-            setSimBox(boxMatrix[X_POSITION][X_POSITION],
-                      boxMatrix[Y_POSITION][Y_POSITION],
-                      boxMatrix[Z_POSITION][Z_POSITION]);
-            break;
+            position += boxLength*((difference > 0) - (difference < 0));
         }
     }
-
-    xdrfile_close(xtcFile);
-    emit consoleOutput(".xtc data fetching complete!",0);
-    return true;
+    return position;
 }
 
 bool FileReader::LoadData(const QString& groFilePath,
                           const QString& xtcFilePath)
 {
+    TRACE_SCOPE("FileReader::LoadData");
+    // Both files and the atom selection are checked before the current data
+    // is cleared, so that a rejected load keeps it.
+    QStringList groList;
+    if (!fetchGroData(groFilePath, groList))
+    {
+        return false;
+    }
+    XtcFrameIndex index;
+    QVector<int> frames;
+    if (!indexXtcData(xtcFilePath, groList.length(), index, frames))
+    {
+        return false;
+    }
+    QVector<Atom*> atoms;
+    QVector<int> atomIndices;
+    int numOfResidues;
+    if (!createAtomVector(groList, atoms, atomIndices, numOfResidues))
+    {
+        emit consoleOutput("No atoms of the .gro file are chosen by the "
+                           "atom selection.",0);
+        return false;
+    }
+
     if (GetAtomVectorRef().length() > 0)
     {
         clearAtomVector();
         clearResidueVector();
     }
-    if (!fetchGroData(groFilePath))
+    setGroList(groList);
+    setAtomVector(atoms);
+    m_AtomIndices = atomIndices;
+    setNumOfResidues(numOfResidues);
+    bool fetched = fetchXtcData(xtcFilePath, index, frames);
+    if (fetched)
     {
-        return false;
+        createResidueVector();
+        calculateResidueCentroids();
+    }
+    else
+    {
+        // Leave the reader empty rather than holding a partial load.
+        clearAtomVector();
+        m_AtomIndices.clear();
+        m_GroList.clear();
     }
+    updateMemoryAccount();
+    return fetched;
+}
 
-    if (!fetchXtcData(xtcFilePath))
+bool FileReader::LoadResults(const QString& filePath)
+{
+    TRACE_SCOPE("FileReader::LoadResults");
+    struct LoadedMetric
+    {
+        const char* name;
+        QVector<float>& (Atom::*values)();
+        bool* calculated;
+        float* min;
+        float* max;
+    };
+    // The names are those written by mdvis-cli.
+    const LoadedMetric metrics[] =
     {
+        {"path_length", &Atom::GetPathLengthRef,
+         &m_PathLength, &m_MinPathLength, &m_MaxPathLength},
+        {"velocity", &Atom::GetVelocityRef,
+         &m_Velocity, &m_MinVelocity, &m_MaxVelocity},
+        {"path_curvature", &Atom::GetPathCurvatureRef,
+         &m_PathCurvature, &m_MinPathCurvature, &m_MaxPathCurvature},
+        {"discrete_curvature", &Atom::GetDiscreteCurvatureRef,
+         &m_DiscreteCurvature, &m_MinDiscreteCurvature, &m_MaxDiscreteCurvature},
+        {"diffusion", &Atom::GetDiffusionRef,
+         &m_Diffusion, &m_MinDiffusion, &m_MaxDiffusion},
+        {"rmsf", &Atom::GetFluctuationRef,
+         &m_Fluctuation, &m_MinFluctuation, &m_MaxFluctuation}
+    };
+    const int count = sizeof(metrics)/sizeof(metrics[0]);
+
+    ResultsFile results(ResultsFile::BINARY);
+    for (int i = 0; i < count; ++i)
+    {
+        ResultsFile::Metric metric;
+        metric.name = metrics[i].name;
+        metric.values = metrics[i].values;
+        metric.min = 0;
+        metric.max = 0;
+        results.AddMetric(metric);
+    }
+    QVector<ResultsFile::Metric> found;
+    if (!results.Read(filePath, GetAtomVectorRef(), found))
+    {
+        emit consoleOutput(results.GetError(),0);
+        return false;
+    }
+    if (found.isEmpty())
+    {
+        emit consoleOutput(filePath + " holds none of the metrics MDVis "
+                           "shows.",0);
         return false;
     }
 
-//    createResidueVector();
-
+    for (int i = 0; i < found.length(); ++i)
+    {
+        for (int j = 0; j < count; ++j)
+        {
+            if (found[i].name == metrics[j].name)
+            {
+                *metrics[j].calculated = true;
+                *metrics[j].min = found[i].min;
+                *metrics[j].max = found[i].max;
+                averageForAllResidues(metrics[j].values);
+            }
+        }
+    }
+    updateMemoryAccount();
+    emit consoleOutput("Results loaded",0);
     return true;
 }
 
+void FileReader::updateMemoryAccount()
+{
+    qint64 topology = GetAtomVectorRef().capacity()*sizeof(Atom*)
+                    + m_AtomIndices.capacity()*sizeof(int)
+                    + m_GroList.length()*sizeof(QString);
+    for (int i = 0; i < m_GroList.length(); ++i)
+    {
+        topology += m_GroList[i].capacity()*sizeof(QChar);
+    }
+    qint64 trajectory = 0;
+    qint64 metrics = 0;
+    for (int i = 0; i < GetAtomVectorRef().length(); ++i)
+    {
+        Atom* atom = GetAtomVectorRef()[i];
+        topology += sizeof(Atom)
+                  + (atom->GetAtomName().capacity()
+                     + atom->GetParentResidue().capacity())*sizeof(QChar);
+        trajectory += (atom->GetTrajectoryRef().capacity()
+                       + atom->GetAlignedTrajectoryRef().capacity())*sizeof(QVector3D)
+                    + atom->GetStepTimeRef().capacity()*sizeof(int);
+        metrics += (atom->GetDiffusionRef().capacity()
+                    + atom->GetDiscreteCurvatureRef().capacity()
+                    + atom->GetFluctuationRef().capacity()
+                    + atom->GetMeanSquareDisplacementRef().capacity()
+                    + atom->GetPathCurvatureRef().capacity()
+                    + atom->GetPathLengthRef().capacity()
+                    + atom->GetVelocityRef().capacity())*sizeof(float);
+    }
+    topology += GetResidueVectorRef().capacity()*sizeof(Residue*);
+    for (int i = 0; i < GetResidueVectorRef().length(); ++i)
+    {
+        Residue* residue = GetResidueVectorRef()[i];
+        Atom& centroid = residue->GetCentroidRef();
+        topology += sizeof(Residue)
+                  + residue->GetAtomVectorRef().capacity()*sizeof(Atom*);
+        trajectory += (centroid.GetTrajectoryRef().capacity()
+                       + centroid.GetAlignedTrajectoryRef().capacity())*sizeof(QVector3D)
+                    + centroid.GetStepTimeRef().capacity()*sizeof(int);
+        metrics += (centroid.GetDiffusionRef().capacity()
+                    + centroid.GetDiscreteCurvatureRef().capacity()
+                    + centroid.GetFluctuationRef().capacity()
+                    + centroid.GetMeanSquareDisplacementRef().capacity()
+                    + centroid.GetPathCurvatureRef().capacity()
+                    + centroid.GetPathLengthRef().capacity()
+                    + centroid.GetVelocityRef().capacity())*sizeof(float);
+    }
+    MemoryAccount::Set(MemoryAccount::TOPOLOGY, topology);
+    MemoryAccount::Set(MemoryAccount::TRAJECTORY, trajectory);
+    metrics += m_Fits.capacity()*sizeof(Superposition::Fit);
+    MemoryAccount::Set(MemoryAccount::METRICS, metrics);
+}
+
 void FileReader::print(QString output)
 {
     QTextStream out(stdout);
@@ -13,7 +13,11 @@
 #define FILEREADER_H
 
 #include "Atom.h"
+#include "AtomSelection.h"
 #include "Residue.h"
+#include "SelectionExpression.h"
+#include "Superposition.h"
+#include "XtcPipeline.h"
 #include <QObject>
 #include <QVector3D>
 #include <limits>
@@ -29,6 +33,27 @@ public:
      */
     QVector<Atom*>& GetAtomVectorRef();
 
+    /**
+     * @brief Getter for the maximum diffusion coefficient among the atoms
+     * in the atom vector.
+     * @return The value of the maximum diffusion coefficient, as a float.
+     */
+    float GetMaxDiffusion();
+
+    /**
+     * @brief Getter for the maximum discrete curvature value among the atoms
+     * in the atom vector.
+     * @return The value of the maximum discrete curvature, as a float.
+     */
+    float GetMaxDiscreteCurvature();
+
+    /**
+     * @brief Getter for the maximum root mean square fluctuation among the
+     * atoms in the atom vector.
+     * @return The value of the maximum fluctuation, as a float.
+     */
+    float GetMaxFluctuation();
+
     /**
      * @brief Getter for the maximum path curvature value among the atoms
      * in the atom vector.
@@ -50,6 +75,27 @@ public:
      */
     float GetMaxVelocity();
 
+    /**
+     * @brief Getter for the minimum diffusion coefficient among the atoms
+     * in the atom vector.
+     * @return The value of the minimum diffusion coefficient, as a float.
+     */
+    float GetMinDiffusion();
+
+    /**
+     * @brief Getter for the minimum discrete curvature value among the atoms
+     * in the atom vector.
+     * @return The value of the minimum discrete curvature, as a float.
+     */
+    float GetMinDiscreteCurvature();
+
+    /**
+     * @brief Getter for the minimum root mean square fluctuation among the
+     * atoms in the atom vector.
+     * @return The value of the minimum fluctuation, as a float.
+     */
+    float GetMinFluctuation();
+
     /**
      * @brief Getter for the minimum path curvature value among the atoms
      * in the atom vector.
@@ -71,6 +117,82 @@ public:
      */
     float GetMinVelocity();
 
+    /**
+     * @brief Getter for the work done by each stage of the .xtc loading
+     * pipeline during the last load.
+     * @return A QVector of XtcPipeline::Stage, in pipeline order.
+     */
+    const QVector<XtcPipeline::Stage>& GetLoadStages();
+
+    /**
+     * @brief Getter for the frame stride used when loading.
+     * @return The stride, where 1 keeps every frame.
+     */
+    int GetFrameStride();
+
+    /**
+     * @brief Setter for the frame stride used when loading. Only every
+     * stride-th frame within the time window is loaded, and the others are
+     * not decompressed.
+     * @param stride The stride, where 1 keeps every frame.
+     */
+    void SetFrameStride(int stride);
+
+    /**
+     * @brief Getter for the start of the time window loaded.
+     * @return The start time, in ps.
+     */
+    float GetStartTime();
+
+    /**
+     * @brief Getter for the end of the time window loaded.
+     * @return The end time, in ps.
+     */
+    float GetEndTime();
+
+    /**
+     * @brief Setter for the time window loaded. Frames outside the window
+     * are not decompressed.
+     * @param startTime Frames before this time, in ps, are not loaded.
+     * @param endTime Frames after this time, in ps, are not loaded.
+     */
+    void SetTimeWindow(float startTime, float endTime);
+
+    /**
+     * @brief Getter for the selection of atoms loaded.
+     * @return The AtomSelection.
+     */
+    const AtomSelection& GetAtomSelection();
+
+    /**
+     * @brief Setter for the selection of atoms loaded. Only the chosen atoms
+     * are created, and the .xtc coordinates of the others are discarded as
+     * soon as each frame is decompressed.
+     * @param selection The AtomSelection.
+     */
+    void SetAtomSelection(const AtomSelection& selection);
+
+    /**
+     * @brief Getter for the fit of each frame onto the reference frame,
+     * from the last call to FitFrames(), CalculateFluctuation() or
+     * AlignFrames().
+     * @return A QVector of Superposition::Fit, one per frame, which holds
+     * the RMSD of each frame.
+     */
+    const QVector<Superposition::Fit>& GetFitsRef();
+
+    /**
+     * @brief Setter for the atoms fitted and the frame they are fitted onto
+     * before the fluctuation is calculated. Both are kept when new data is
+     * loaded. Clears any fluctuation and aligned trajectories already
+     * calculated if either changes.
+     * @param selection The selection of the atoms fitted, where an empty
+     * selection fits every atom.
+     * @param referenceFrame The frame fitted onto, which is clamped to the
+     * frames loaded.
+     */
+    void SetFit(const SelectionExpression& selection, int referenceFrame);
+
     /**
      * @brief Getter for the vector containing the Residue pointers from
      *        the .gro file.
@@ -78,6 +200,12 @@ public:
      */
     QVector<Residue*>& GetResidueVectorRef();
 
+    /**
+     * @brief Getter for the typical size of a Residue.
+     * @return The mean over the Residues of their radii, in nm.
+     */
+    float GetResidueRadius();
+
     /**
      * @brief Setter for the vector containing Residue pointers.
      * @param residueVector A QVector of Residue objects.
@@ -96,6 +224,44 @@ public:
      */
     FileReader();
 
+    /**
+     * @brief Fits every frame onto the reference frame by the atoms set by
+     * SetFit() and stores the fitted positions of every @Atom and Residue
+     * centroid as their aligned trajectory, without rereading the .xtc
+     * file.
+     * @return true if the aligned trajectories are available, false if the
+     * fit selection chose no atoms.
+     */
+    bool AlignFrames();
+
+    /**
+     * @brief Calculates the mean square displacement and diffusion
+     * coefficient for every @Atom in the atom vector using
+     * @MeanSquareDisplacement.
+     */
+    void CalculateDiffusion();
+
+    /**
+     * @brief Calculates the discrete curvature for every @Atom in the atom
+     * vector using the trig-free @CurvatureKernel.
+     */
+    void CalculateDiscreteCurvature();
+
+    /**
+     * @brief Calculates the mean square displacement for every @Atom in the
+     * atom vector, recalculating the diffusion coefficients if they were
+     * read by LoadResults() without it.
+     */
+    void CalculateMeanSquareDisplacement();
+
+    /**
+     * @brief Fits every frame onto the reference frame by the atoms set by
+     * SetFit(), keeping the RMSD of each frame, and calculates the root
+     * mean square fluctuation of every @Atom in the atom vector about its
+     * fitted mean position using @Superposition.
+     */
+    void CalculateFluctuation();
+
     /**
      * @brief Calculates the path curvature for every @Atom in the atom vector.
      */
@@ -111,6 +277,15 @@ public:
      */
     void CalculateVelocity();
 
+    /**
+     * @brief Fits every frame onto the reference frame by the atoms set by
+     * SetFit(), unless the fits are already known, so that GetFitsRef()
+     * holds them.
+     * @return true if the fits are available, false if there are no atoms
+     * or the fit selection chose none.
+     */
+    bool FitFrames();
+
     /**
      * @brief Reads data from .gro and .xtc files and stores it.
      * @param groFilePath The file path of the .gro file.
@@ -120,6 +295,29 @@ public:
     bool LoadData(const QString& groFilePath,
                   const QString& xtcFilePath);
 
+    /**
+     * @brief Reads metrics precalculated by mdvis-cli from a binary results
+     * file into the loaded atoms, so that they are not calculated again.
+     * The file must have been written for the same atoms and frames.
+     * @param filePath The file path of the results file.
+     * @return true if any metrics were read, false otherwise.
+     */
+    bool LoadResults(const QString& filePath);
+
+    /**
+     * @brief Undoes the periodic boundary wrapping of one coordinate of an
+     * atom position, so that atoms crossing the box boundary keep a
+     * continuous path.
+     * @param position The wrapped coordinate in the current frame.
+     * @param previous The unwrapped coordinate in the previous frame.
+     * @param boxLength The length of the simulation box along this axis.
+     * @return The coordinate, shifted by one box length if the atom has
+     * jumped more than half a box since the previous frame.
+     */
+    static float UnwrapCoordinate(float position,
+                                  float previous,
+                                  float boxLength);
+
 signals:
 
     /**
@@ -172,11 +370,31 @@ private:
     void setSimBox(float x, float y, float z);
 
     /**
-     * @brief Adds a Residue @e residue to the Residue vector at index @e index.
-     * @param residue The Residue to be added to the Residue vector.
-     * @param index The index at which the Residue will be added.
+     * @brief Sets a metric of every Residue centroid to the mean over the
+     * Residue's atoms, splitting the Residues across the global thread pool.
+     * @param metric The @Atom getter for the metric.
+     */
+    void averageForAllResidues(QVector<float>& (Atom::*metric)());
+
+    /**
+     * @brief Calls an @Atom calculation function for every @Atom in the atom
+     * vector, splitting the atoms across the global thread pool.
+     * @param calculate The @Atom member function to be called.
+     */
+    void calculateForAllAtoms(void (Atom::*calculate)());
+
+    /**
+     * @brief Calculates the centroid trajectory of every Residue, splitting
+     * the Residues across the global thread pool, and the mean Residue
+     * radius.
+     */
+    void calculateResidueCentroids();
+
+    /**
+     * @brief Frees the aligned trajectories of every @Atom and Residue
+     * centroid.
      */
-    void addResidue(Residue* residue, int index);
+    void clearAlignedTrajectories();
 
     /**
      * @brief Removes all Atoms from the Atom vector.
@@ -189,54 +407,191 @@ private:
     void clearResidueVector();
 
     /**
-     * @brief Creates an Atom for each line of the .gro file data and adds
-     * it to the Atom vector.
+     * @brief Creates an Atom for each line of the .gro file data chosen by
+     * the atom selection, without touching the current Atom vector.
+     * @param groList The lines of atom data from the .gro file.
+     * @param atoms Set to the chosen Atoms, which the caller owns.
+     * @param atomIndices Set to the indices of the chosen Atoms in the .gro
+     * file, or left empty if the atom selection is empty.
+     * @param numOfResidues Set to the largest Residue number in the .gro
+     * file.
+     * @return true if any atoms were chosen, false otherwise.
      */
-    void createAtomVector();
+    bool createAtomVector(const QStringList& groList,
+                          QVector<Atom*>& atoms,
+                          QVector<int>& atomIndices,
+                          int& numOfResidues);
 
     /**
-     * @brief Stores a list of all the lines of data in the .gro file.
+     * @brief Lists all the lines of data in the .gro file.
      *
      * Takes a String containing the entire contents of the .gro file, splits
      * it up by line and discards the first two lines and the last line, which
      * do not contain atom information.
      * @param groFileData The contents of the .gro file.
+     * @return The lines of atom data.
      */
-    void createGroList(QString groFileData);
+    QStringList createGroList(QString groFileData);
 
     /**
-     * @brief Creates a vector of the residues in the .gro file.
+     * @brief Creates a vector of the residues of the loaded atoms.
      *
-     * For each unique residue in the .gro file, creates a Residue object and
-     * populates it with Atom objects for each atom belonging to that residue.
+     * Creates a Residue object for each run of consecutive atoms with the
+     * same residue ID and name, and populates it with those atoms. Residue
+     * IDs wrap around in large .gro files, so the same ID may be given to
+     * several Residues.
      */
     void createResidueVector();
 
     /**
-     * @brief Reads data from the .gro file and stores it.
+     * @brief Finds the range of a calculated metric across every @Atom in the
+     * atom vector, in parallel, and widens @e min and @e max to include it.
+     * @param metric The @Atom getter for the metric.
+     * @param lastOnly If true only the last value of each @Atom is used, as
+     * for the total path length.
+     * @param min The minimum value, updated in place.
+     * @param max The maximum value, updated in place.
+     */
+    void findRange(QVector<float>& (Atom::*metric)(),
+                   bool lastOnly,
+                   float& min,
+                   float& max);
+
+    /**
+     * @brief Reports the memory held by the topology, trajectory and metrics
+     * to the @MemoryAccount.
+     */
+    void updateMemoryAccount();
+
+    /**
+     * @brief Reads the lines of atom data from the .gro file.
      * @param groFilePath The file path of the .gro file.
+     * @param groList Set to the lines of atom data.
      * @return true if the data was fetched successfully, false otherwise.
      */
-    bool fetchGroData(const QString& groFilePath);
+    bool fetchGroData(const QString& groFilePath, QStringList& groList);
 
     /**
-     * @brief Reads data from the .xtc file and adds it to the data from
-     *        the .gro file.
+     * @brief Reads the chosen frames of the .xtc file and adds them to the
+     *        data from the .gro file.
      * @param xtcFilePath The file path of the .xtc file.
+     * @param index The index of the frames of the .xtc file.
+     * @param frames The frames to read, from indexXtcData().
      * @return true if the data was fetched successfully, false otherwise.
      */
-    bool fetchXtcData(const QString& xtcFilePath);
+    bool fetchXtcData(const QString& xtcFilePath,
+                      const XtcFrameIndex& index,
+                      const QVector<int>& frames);
+
+    /**
+     * @brief Indexes the frames of the .xtc file and chooses those within
+     * the time window and stride, without reading any coordinates.
+     * @param xtcFilePath The file path of the .xtc file.
+     * @param atoms The number of atoms in the .gro file.
+     * @param index Built over the .xtc file.
+     * @param frames Set to the chosen frames.
+     * @return true if the file matches the .gro file and at least two frames
+     * are chosen, false otherwise.
+     */
+    bool indexXtcData(const QString& xtcFilePath,
+                      int atoms,
+                      XtcFrameIndex& index,
+                      QVector<int>& frames);
+
+    /**
+     * @brief The index within the .gro file of each Atom in the Atom vector,
+     * counting from 0, or empty if every atom was loaded.
+     */
+    QVector<int> m_AtomIndices;
+
+    /**
+     * @brief Flag signifying if the aligned trajectories have already been
+     * calculated for the atoms in the atom vector or not.
+     */
+    bool m_Aligned = false;
+
+    /**
+     * @brief The selection of atoms loaded.
+     */
+    AtomSelection m_AtomSelection;
 
     /**
-     * @brief A QVector of pointers to all the Atoms in the .gro file.
+     * @brief A QVector of pointers to the loaded Atoms in the .gro file.
      */
     QVector<Atom*> m_AtomVector;
 
+    /**
+     * @brief Frames after this time, in ps, are not loaded.
+     */
+    float m_EndTime = std::numeric_limits<float>::infinity();
+
+    /**
+     * @brief Only every stride-th frame within the time window is loaded.
+     */
+    int m_FrameStride = 1;
+
+    /**
+     * @brief The work done by each stage of the .xtc loading pipeline during
+     * the last load.
+     */
+    QVector<XtcPipeline::Stage> m_LoadStages;
+
+    /**
+     * @brief The fit of each frame onto the reference frame.
+     */
+    QVector<Superposition::Fit> m_Fits;
+
+    /**
+     * @brief The selection of the atoms fitted.
+     */
+    SelectionExpression m_FitSelection;
+
+    /**
+     * @brief The frame the atoms are fitted onto.
+     */
+    int m_FitReference = 0;
+
     /**
      * @brief A list of Strings containing each line of the .gro file.
      */
     QStringList m_GroList;
 
+    /**
+     * @brief Flag signifying if the diffusion coefficients have already been
+     * calculated for the atoms in the atom vector or not.
+     */
+    bool m_Diffusion = false;
+
+    /**
+     * @brief Flag signifying if the discrete curvature has already been
+     * calculated for the atoms in the atom vector or not.
+     */
+    bool m_DiscreteCurvature = false;
+
+    /**
+     * @brief Flag signifying if the fluctuation has already been calculated
+     * for the atoms in the atom vector or not.
+     */
+    bool m_Fluctuation = false;
+
+    /**
+     * @brief The value of the maximum diffusion coefficient among the atoms
+     * in the atom vector, as a float.
+     */
+    float m_MaxDiffusion = -INFINITY;
+
+    /**
+     * @brief The value of the maximum discrete curvature value among the atoms
+     * in the atom vector, as a float.
+     */
+    float m_MaxDiscreteCurvature = -INFINITY;
+
+    /**
+     * @brief The value of the maximum root mean square fluctuation among the
+     * atoms in the atom vector, as a float.
+     */
+    float m_MaxFluctuation = -INFINITY;
+
     /**
      * @brief The value of the maximum path curvature value among the atoms
      * in the atom vector, as a float.
@@ -255,6 +610,24 @@ private:
      */
     float m_MaxVelocity = -INFINITY;
 
+    /**
+     * @brief The value of the minimum diffusion coefficient among the atoms
+     * in the atom vector, as a float.
+     */
+    float m_MinDiffusion = INFINITY;
+
+    /**
+     * @brief The value of the minimum discrete curvature value among the atoms
+     * in the atom vector, as a float.
+     */
+    float m_MinDiscreteCurvature = INFINITY;
+
+    /**
+     * @brief The value of the minimum root mean square fluctuation among the
+     * atoms in the atom vector, as a float.
+     */
+    float m_MinFluctuation = INFINITY;
+
     /**
      * @brief The value of the minimum path curvature value among the atoms
      * in the atom vector, as a float.
@@ -282,13 +655,13 @@ private:
      * @brief Flag signifying if the path curvature has already been calculated for
      * the atoms in the atom vector or not.
      */
-    bool m_PathCurvature;
+    bool m_PathCurvature = false;
 
     /**
      * @brief Flag signifying if the path length has already been calculated for
      * the atoms in the atom vector or not.
      */
-    bool m_PathLength;
+    bool m_PathLength = false;
 
     /**
      * @brief A vector of all the Residues in the .gro file.
@@ -296,36 +669,37 @@ private:
     QVector<Residue*> m_ResidueVector;
 
     /**
-     * @brief The dimensions of the computational box in which the Atoms exist.
+     * @brief The mean radius of the Residues, in nm.
      */
-    QVector3D m_SimBox;
+    float m_ResidueRadius = 0;
 
     /**
-     * @brief Flag signifying if the velocity has already been calculated for
-     * the atoms in the atom vector or not.
+     * @brief The dimensions of the computational box in which the Atoms exist.
      */
-    bool m_Velocity;
+    QVector3D m_SimBox;
 
     /**
-     * @brief Xtc position data is stored in reduced precision. This scaling
-     * factor allows original precision to be restored.
+     * @brief Frames before this time, in ps, are not loaded.
      */
-    float XTC_PREC = 1000.0;
+    float m_StartTime = -std::numeric_limits<float>::infinity();
 
     /**
-     * @brief The index of the x coordinate in position vectors.
+     * @brief Flag signifying if the velocity has already been calculated for
+     * the atoms in the atom vector or not.
      */
-    const int X_POSITION = 0;
-    
+    bool m_Velocity = false;
+
     /**
-     * @brief The index of the y coordinate in position vectors.
+     * @brief The smallest number of atoms worth handing to a thread when
+     * calculating metrics.
      */
-    const int Y_POSITION = 1;
+    static const int MIN_ATOMS_PER_THREAD = 64;
 
     /**
-     * @brief The index of the z coordinate in position vectors.
+     * @brief The smallest number of residues worth handing to a thread when
+     * calculating centroids and their metrics.
      */
-    const int Z_POSITION = 2;
+    static const int MIN_RESIDUES_PER_THREAD = 16;
 
     /**
      * @brief Allows printing of Strings to console.
@@ -0,0 +1,54 @@
+#include "Frustum.h"
+
+Frustum::Frustum()
+{
+    for (int i = 0; i < PLANES; ++i)
+    {
+        m_Planes[i] = QVector4D(0, 0, 0, 1);
+    }
+}
+
+Frustum::Frustum(const QMatrix4x4& modelToClip)
+{
+    // A point is inside when -w <= x, y, z <= w in clip coordinates, so each
+    // plane is the last row of the matrix plus or minus one of the others.
+    QVector4D last = modelToClip.row(3);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        QVector4D row = modelToClip.row(axis);
+        m_Planes[2*axis] = last + row;
+        m_Planes[2*axis + 1] = last - row;
+    }
+}
+
+bool Frustum::Contains(const QVector3D& point) const
+{
+    for (int i = 0; i < PLANES; ++i)
+    {
+        const QVector4D& plane = m_Planes[i];
+        if (plane.x()*point.x() + plane.y()*point.y() + plane.z()*point.z()
+                + plane.w() < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const QVector3D& minimum, const QVector3D& maximum) const
+{
+    for (int i = 0; i < PLANES; ++i)
+    {
+        // Only the corner furthest along the normal of the plane needs to be
+        // tested.
+        const QVector4D& plane = m_Planes[i];
+        float x = plane.x() >= 0 ? maximum.x() : minimum.x();
+        float y = plane.y() >= 0 ? maximum.y() : minimum.y();
+        float z = plane.z() >= 0 ? maximum.z() : minimum.z();
+        if (plane.x()*x + plane.y()*y + plane.z()*z + plane.w() < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Frustum.h
+ * @date 19 Oct 2026
+ * @see SpatialGrid.h
+ * @see MyOpenGLWidget.h
+ * @brief This class holds the six planes bounding the volume seen by the
+ * camera, used to skip atoms which cannot appear on screen.
+ *
+ * The planes are taken from the matrix which maps model coordinates to clip
+ * coordinates, so they are expressed in model coordinates and can be tested
+ * directly against atom positions. The tests are conservative: a box near a
+ * corner of the frustum may be reported as seen when it is not, but a box
+ * which is seen is never reported as unseen.
+ */
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <QMatrix4x4>
+#include <QVector3D>
+#include <QVector4D>
+
+class Frustum
+{
+public:
+    /**
+     * @brief Constructor for a frustum containing everything.
+     */
+    Frustum();
+
+    /**
+     * @brief Constructor
+     * @param modelToClip The product of the projection, camera and model
+     * matrices.
+     */
+    explicit Frustum(const QMatrix4x4& modelToClip);
+
+    /**
+     * @brief Tests whether a point lies inside the frustum.
+     * @param point The point, in model coordinates.
+     * @return true if the point is inside every plane, false otherwise.
+     */
+    bool Contains(const QVector3D& point) const;
+
+    /**
+     * @brief Tests whether an axis aligned box may overlap the frustum.
+     * @param minimum The lowest corner of the box, in model coordinates.
+     * @param maximum The highest corner of the box, in model coordinates.
+     * @return false if the box lies wholly outside one of the planes, true
+     * otherwise.
+     */
+    bool Intersects(const QVector3D& minimum, const QVector3D& maximum) const;
+
+    /**
+     * @brief The number of planes bounding the frustum.
+     */
+    static const int PLANES = 6;
+
+private:
+    /**
+     * @brief The planes, as (a, b, c, d) with a*x + b*y + c*z + d >= 0 for
+     * points inside the plane.
+     */
+    QVector4D m_Planes[PLANES];
+};
+
+#endif // FRUSTUM_H
@@ -0,0 +1,215 @@
+#include "Histogram.h"
+#include "Parallel.h"
+#include <QtMath>
+#include <cstring>
+
+namespace
+{
+    /**
+     * @brief Converts a float into an unsigned key that sorts in the same
+     * order as the float values.
+     * @param value The float to be converted.
+     * @return The ordered key.
+     */
+    inline quint32 orderedKey(float value)
+    {
+        quint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+    /**
+     * @brief Converts an ordered key back into the float it was made from.
+     * @param key The ordered key.
+     * @return The float value.
+     */
+    inline float fromOrderedKey(quint32 key)
+    {
+        quint32 bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+float Histogram::GetMax() const
+{
+    return m_Max;
+}
+
+float Histogram::GetMin() const
+{
+    return m_Min;
+}
+
+qint64 Histogram::GetTotal() const
+{
+    return m_Total;
+}
+
+Histogram::Histogram()
+{
+
+}
+
+void Histogram::Build(const QVector<Span>& spans)
+{
+    Clear();
+
+    QVector<Span> pieces;
+    for (int i = 0; i < spans.length(); ++i)
+    {
+        for (int first = 0; first < spans[i].count; first += SPLIT_SIZE)
+        {
+            int remaining = spans[i].count - first;
+            Span piece;
+            piece.values = spans[i].values + first;
+            piece.count = remaining < SPLIT_SIZE ? remaining : SPLIT_SIZE;
+            pieces.append(piece);
+        }
+    }
+
+    int chunks = Parallel::ChunkCount(pieces.length(), 1);
+    QVector<QVector<qint64> > threadBins(chunks);
+    QVector<float> threadMin(chunks, INFINITY);
+    QVector<float> threadMax(chunks, -INFINITY);
+    Parallel::For(pieces.length(), 1, [&](int chunk, int first, int last)
+    {
+        QVector<qint64>& bins = threadBins[chunk];
+        bins.fill(0, BIN_COUNT);
+        qint64* binData = bins.data();
+        float min = INFINITY;
+        float max = -INFINITY;
+        for (int i = first; i < last; ++i)
+        {
+            const float* values = pieces[i].values;
+            for (int j = 0; j < pieces[i].count; ++j)
+            {
+                float value = values[j];
+                if (qIsNaN(value))
+                {
+                    continue;
+                }
+                ++binData[binOf(value)];
+                min = value < min ? value : min;
+                max = value > max ? value : max;
+            }
+        }
+        threadMin[chunk] = min;
+        threadMax[chunk] = max;
+    });
+
+    m_Bins.fill(0, BIN_COUNT);
+    float min = INFINITY;
+    float max = -INFINITY;
+    for (int i = 0; i < threadBins.length(); ++i)
+    {
+        for (int j = 0; j < threadBins[i].length(); ++j)
+        {
+            m_Bins[j] += threadBins[i][j];
+            m_Total += threadBins[i][j];
+        }
+        min = qMin(min, threadMin[i]);
+        max = qMax(max, threadMax[i]);
+    }
+    if (m_Total > 0)
+    {
+        m_Min = min;
+        m_Max = max;
+    }
+}
+
+void Histogram::Clear()
+{
+    m_Bins.clear();
+    m_Total = 0;
+    m_Min = 0;
+    m_Max = 0;
+}
+
+bool Histogram::IsEmpty() const
+{
+    return m_Total == 0;
+}
+
+float Histogram::Percentile(float fraction) const
+{
+    if (IsEmpty())
+    {
+        return 0;
+    }
+    fraction = qBound(0.0f, fraction, 1.0f);
+    double target = fraction*m_Total;
+    qint64 cumulative = 0;
+    for (int i = 0; i < m_Bins.length(); ++i)
+    {
+        if (m_Bins[i] > 0 && cumulative + m_Bins[i] >= target)
+        {
+            double lower = qMax(lowerEdge(i), m_Min);
+            double upper = qMin(upperEdge(i), m_Max);
+            double withinBin = (target - cumulative)/m_Bins[i];
+            return lower + withinBin*(upper - lower);
+        }
+        cumulative += m_Bins[i];
+    }
+    return m_Max;
+}
+
+QVector<float> Histogram::Resample(float min, float max, int binCount) const
+{
+    QVector<float> display;
+    if (binCount <= 0)
+    {
+        return display;
+    }
+    display.fill(0, binCount);
+    if (IsEmpty() || max <= min)
+    {
+        return display;
+    }
+
+    double scale = binCount/(double)(max - min);
+    for (int i = 0; i < m_Bins.length(); ++i)
+    {
+        if (m_Bins[i] == 0)
+        {
+            continue;
+        }
+        double centre = ((double)lowerEdge(i) + upperEdge(i))/2;
+        double position = (centre - min)*scale;
+        if (position >= 0 && position < binCount)
+        {
+            display[(int)position] += m_Bins[i];
+        }
+    }
+
+    float largest = 0;
+    for (int i = 0; i < binCount; ++i)
+    {
+        largest = qMax(largest, display[i]);
+    }
+    if (largest > 0)
+    {
+        for (int i = 0; i < binCount; ++i)
+        {
+            display[i] /= largest;
+        }
+    }
+    return display;
+}
+
+int Histogram::binOf(float value)
+{
+    return orderedKey(value) >> (32 - BIN_BITS);
+}
+
+float Histogram::lowerEdge(int bin)
+{
+    return fromOrderedKey((quint32)bin << (32 - BIN_BITS));
+}
+
+float Histogram::upperEdge(int bin)
+{
+    quint32 shift = 32 - BIN_BITS;
+    return fromOrderedKey(((quint32)bin << shift) | ((1u << shift) - 1));
+}
@@ -0,0 +1,162 @@
+/**
+ * @file Histogram.h
+ * @date 19 Oct 2026
+ * @brief This class builds a fine-grained histogram of a set of values and
+ * answers percentile queries from it.
+ *
+ * Values are binned by the upper bits of their floating point
+ * representation, the sign, the exponent and the top 7 bits of the
+ * mantissa, which gives every bin the same relative width (2^-7 of its lower
+ * edge, about 0.8%) across the whole float range. The histogram therefore
+ * needs no range to be known in advance and a single outlier cannot flatten
+ * it. It is built in one parallel pass, with each thread filling its own
+ * bins before they are merged, and percentiles for any fraction can then be
+ * read without touching the original data again.
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <QVector>
+
+class Histogram
+{
+public:
+    /**
+     * @brief A contiguous array of values to be counted.
+     */
+    struct Span
+    {
+        /**
+         * @brief A pointer to the first value.
+         */
+        const float* values;
+
+        /**
+         * @brief The number of values.
+         */
+        int count;
+    };
+
+    /**
+     * @brief Getter for the largest value counted.
+     * @return The largest value counted, or 0 if the histogram is empty.
+     */
+    float GetMax() const;
+
+    /**
+     * @brief Getter for the smallest value counted.
+     * @return The smallest value counted, or 0 if the histogram is empty.
+     */
+    float GetMin() const;
+
+    /**
+     * @brief Getter for the number of values counted.
+     * @return The total of all bin counts.
+     */
+    qint64 GetTotal() const;
+
+    /**
+     * @brief Constructor
+     */
+    Histogram();
+
+    /**
+     * @brief Counts every value in @e spans, replacing any previous contents.
+     * NaN values are ignored.
+     * @param spans The arrays of values to be counted.
+     */
+    void Build(const QVector<Span>& spans);
+
+    /**
+     * @brief Removes all counts from the histogram.
+     */
+    void Clear();
+
+    /**
+     * @brief Returns true if no values have been counted.
+     * @return true if the histogram is empty, false otherwise.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Estimates the value below which a given fraction of the counted
+     * values lie, interpolating linearly within a bin.
+     * @param fraction The fraction of values, from 0-1.
+     * @return The estimated value, or 0 if the histogram is empty.
+     */
+    float Percentile(float fraction) const;
+
+    /**
+     * @brief Re-bins the histogram into equal width bins covering a range,
+     * for display.
+     * @param min The lower edge of the first display bin.
+     * @param max The upper edge of the last display bin.
+     * @param binCount The number of display bins.
+     * @return A QVector of the display bin counts, scaled so that the largest
+     * bin is 1.
+     */
+    QVector<float> Resample(float min, float max, int binCount) const;
+
+    /**
+     * @brief The number of bits of each value used to select its bin: the
+     * sign, 8 bits of exponent and 7 bits of mantissa.
+     */
+    static const int BIN_BITS = 16;
+
+    /**
+     * @brief The number of bins.
+     */
+    static const int BIN_COUNT = 1 << BIN_BITS;
+
+private:
+    /**
+     * @brief Returns the bin into which a value is counted.
+     * @param value The value, which must not be NaN.
+     * @return The index of the bin.
+     */
+    static int binOf(float value);
+
+    /**
+     * @brief Returns the smallest value that is counted into a bin.
+     * @param bin The index of the bin.
+     * @return The lower edge of the bin.
+     */
+    static float lowerEdge(int bin);
+
+    /**
+     * @brief Returns the largest value that is counted into a bin.
+     * @param bin The index of the bin.
+     * @return The upper edge of the bin.
+     */
+    static float upperEdge(int bin);
+
+    /**
+     * @brief The number of values in each bin, ordered from the most
+     * negative to the most positive values.
+     */
+    QVector<qint64> m_Bins;
+
+    /**
+     * @brief The largest value counted.
+     */
+    float m_Max = 0;
+
+    /**
+     * @brief The smallest value counted.
+     */
+    float m_Min = 0;
+
+    /**
+     * @brief The total number of values counted.
+     */
+    qint64 m_Total = 0;
+
+    /**
+     * @brief The largest number of values handed to a thread as one piece
+     * of work.
+     */
+    static const int SPLIT_SIZE = 65536;
+};
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,34 @@
+#include "HistogramWidget.h"
+#include <QPainter>
+
+void HistogramWidget::SetBins(QVector<float> bins)
+{
+    m_Bins = bins;
+    update();
+}
+
+HistogramWidget::HistogramWidget(QWidget* parent) : QWidget(parent)
+{
+
+}
+
+void HistogramWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    painter.eraseRect(this->rect());
+    if (m_Bins.isEmpty())
+    {
+        return;
+    }
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(Qt::darkGray));
+    float barHeight = (float)this->height()/m_Bins.length();
+    for (int i = 0; i < m_Bins.length(); ++i)
+    {
+        float barWidth = m_Bins[i]*this->width();
+        float top = this->height() - (i + 1)*barHeight;
+        painter.drawRect(QRectF(this->width() - barWidth, top,
+                                barWidth, barHeight));
+    }
+}
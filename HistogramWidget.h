@@ -0,0 +1,50 @@
+/**
+ * @file HistogramWidget.h
+ * @date 19 Oct 2026
+ * @see Histogram.h
+ * @brief This class provides a widget that draws a histogram as horizontal
+ * bars, for display alongside the colour legend.
+ *
+ * The first bar is drawn at the bottom of the widget, so the bars line up
+ * with a vertical ColourLegend covering the same range.
+ */
+
+#ifndef HISTOGRAMWIDGET_H
+#define HISTOGRAMWIDGET_H
+
+#include <QWidget>
+#include <QVector>
+
+class HistogramWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Sets the bars to be drawn.
+     * @param bins A QVector of bar lengths, from 0-1, with the first bar
+     * drawn at the bottom of the widget.
+     */
+    void SetBins(QVector<float> bins);
+
+    /**
+     * @brief Constructor
+     * @param parent The parent QWidget of this widget.
+     */
+    HistogramWidget(QWidget* parent);
+
+protected:
+    /**
+     * @brief Function for painting the histogram bars to the widget.
+     * @param event The QPaintEvent that triggered painting.
+     */
+    void paintEvent(QPaintEvent *event);
+
+private:
+    /**
+     * @brief The bar lengths, from 0-1.
+     */
+    QVector<float> m_Bins;
+};
+
+#endif // HISTOGRAMWIDGET_H
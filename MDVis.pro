@@ -4,41 +4,35 @@
 #
 #-------------------------------------------------
 
-QT       += core gui widgets
+QT       += core gui widgets concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
 TARGET = MDVis
 TEMPLATE = app
 
+CONFIG   += c++11
+
 LIBS += -lopengl32 -lglu32 -lglut32
 
+include(MDVisCore.pri)
+
 SOURCES += main.cpp\
         MainWindow.cpp \
-    Atom.cpp \
-    FileReader.cpp \
-    Residue.cpp \
-    xdrfile.c \
-    xdrfile_xtc.c \
     MyOpenGLWidget.cpp \
-    Vertex.cpp \
     ColourLegend.cpp \
     Transform3D.cpp \
     Camera3D.cpp \
-    ColourMaps.cpp
+    HistogramWidget.cpp \
+    PlotWidget.cpp
 
 HEADERS  += MainWindow.h \
-    Atom.h \
-    FileReader.h \
-    Residue.h \
-    xdrfile.h \
-    xdrfile_xtc.h \
     MyOpenGLWidget.h \
-    Vertex.h \
     ColourLegend.h \
     Transform3D.h \
     Camera3D.h \
-    ColourMaps.h
+    HistogramWidget.h \
+    PlotWidget.h
 
 FORMS    += mainwindow.ui
 
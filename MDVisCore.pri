@@ -0,0 +1,80 @@
+#-------------------------------------------------
+#
+# The non-GUI core of MDVis: file reading, the atom model, the metric,
+# colour mapping and histogram kernels and the vertex data uploaded for
+# drawing. Shared by the application, the command line tools and the
+# benchmarks.
+#
+#-------------------------------------------------
+
+QT       += concurrent
+
+INCLUDEPATH += $$PWD
+
+SOURCES += $$PWD/Atom.cpp \
+    $$PWD/AtomSelection.cpp \
+    $$PWD/AtomTable.cpp \
+    $$PWD/Bitset.cpp \
+    $$PWD/CellList.cpp \
+    $$PWD/SelectionExpression.cpp \
+    $$PWD/FileReader.cpp \
+    $$PWD/MeanSquareDisplacement.cpp \
+    $$PWD/Frustum.cpp \
+    $$PWD/PathLevels.cpp \
+    $$PWD/PrincipalComponents.cpp \
+    $$PWD/RadialDistribution.cpp \
+    $$PWD/Residue.cpp \
+    $$PWD/Superposition.cpp \
+    $$PWD/SymmetricEigen.cpp \
+    $$PWD/SpatialGrid.cpp \
+    $$PWD/SpatialIndex.cpp \
+    $$PWD/xdrfile.c \
+    $$PWD/xdrfile_xtc.c \
+    $$PWD/ColourMaps.cpp \
+    $$PWD/ColourMapper.cpp \
+    $$PWD/Histogram.cpp \
+    $$PWD/CurvatureKernel.cpp \
+    $$PWD/ResultsFile.cpp \
+    $$PWD/TrajectoryGenerator.cpp \
+    $$PWD/Trace.cpp \
+    $$PWD/MemoryAccount.cpp \
+    $$PWD/MemoryBudget.cpp \
+    $$PWD/Vertex.cpp \
+    $$PWD/VertexFiller.cpp \
+    $$PWD/XtcPipeline.cpp \
+    $$PWD/XtcFrameIndex.cpp
+
+HEADERS  += $$PWD/Atom.h \
+    $$PWD/AtomSelection.h \
+    $$PWD/AtomTable.h \
+    $$PWD/Bitset.h \
+    $$PWD/CellList.h \
+    $$PWD/SelectionExpression.h \
+    $$PWD/FileReader.h \
+    $$PWD/MeanSquareDisplacement.h \
+    $$PWD/Frustum.h \
+    $$PWD/PathLevels.h \
+    $$PWD/PrincipalComponents.h \
+    $$PWD/RadialDistribution.h \
+    $$PWD/Residue.h \
+    $$PWD/Superposition.h \
+    $$PWD/SymmetricEigen.h \
+    $$PWD/SpatialGrid.h \
+    $$PWD/SpatialIndex.h \
+    $$PWD/xdrfile.h \
+    $$PWD/xdrfile_xtc.h \
+    $$PWD/ColourMaps.h \
+    $$PWD/ColourMapper.h \
+    $$PWD/Parallel.h \
+    $$PWD/Histogram.h \
+    $$PWD/CurvatureKernel.h \
+    $$PWD/ResultsFile.h \
+    $$PWD/TrajectoryGenerator.h \
+    $$PWD/Trace.h \
+    $$PWD/MemoryAccount.h \
+    $$PWD/MemoryBudget.h \
+    $$PWD/Vertex.h \
+    $$PWD/VertexFiller.h \
+    $$PWD/BoundedQueue.h \
+    $$PWD/XtcPipeline.h \
+    $$PWD/XtcFrameIndex.h
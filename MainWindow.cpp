@@ -1,8 +1,18 @@
 #include "MainWindow.h"
 #include "ui_mainwindow.h"
+#include "ColourMapper.h"
+#include "MeanSquareDisplacement.h"
+#include "MemoryAccount.h"
+#include "MemoryBudget.h"
+#include "PathLevels.h"
+#include "SelectionExpression.h"
+#include "SpatialIndex.h"
+#include "Trace.h"
+#include "VertexFiller.h"
 #include <QFileDialog>
 #include <QFile>
 #include <QTextStream>
+#include <QtConcurrent>
 #include <algorithm>
 
 QVector<Atom*>& MainWindow::getAtomVectorRef()
@@ -30,10 +40,24 @@ MainWindow::MainWindow(QWidget* parent) :
                      ui->m_OpenGLWidget, SLOT(SetDrawPaths(bool)));
     QObject::connect(ui->drawPointsCheck, SIGNAL(toggled(bool)),
                      ui->m_OpenGLWidget, SLOT(SetDrawPoints(bool)));
+    QObject::connect(ui->m_ResidueDetailCheck, SIGNAL(toggled(bool)),
+                     ui->m_OpenGLWidget, SLOT(SetResidueDetail(bool)));
+    QObject::connect(ui->m_TrailLengthBox, SIGNAL(valueChanged(int)),
+                     ui->m_OpenGLWidget, SLOT(SetTrailLength(int)));
+    QObject::connect(ui->m_TrailCentredCheck, SIGNAL(toggled(bool)),
+                     ui->m_OpenGLWidget, SLOT(SetTrailCentred(bool)));
     QObject::connect(ui->m_CircleRadiusBox, SIGNAL(valueChanged(int)),
                      ui->m_OpenGLWidget, SLOT(SetCircleRadius(int)));
     QObject::connect(ui->m_FrameBox, SIGNAL(valueChanged(int)),
                      ui->m_OpenGLWidget, SLOT(SetFrame(int)));
+    QObject::connect(ui->m_FrameBox, SIGNAL(valueChanged(int)),
+                     ui->m_RmsdPlot, SLOT(SetMarker(int)));
+    QObject::connect(ui->m_OpenGLWidget, SIGNAL(atomPicked(int,bool)),
+                     this, SLOT(showPickedItem(int,bool)));
+    QObject::connect(&m_AnalysisWatcher, SIGNAL(finished()),
+                     this, SLOT(showRadialDistribution()));
+    QObject::connect(&m_PcaWatcher, SIGNAL(finished()),
+                     this, SLOT(showPrincipalComponents()));
     QObject::connect(m_FPSTimer, SIGNAL(timeout()),
                      this, SLOT(outputFPS()));
     QObject::connect(ui->m_ResetCamera, SIGNAL(released()),
@@ -47,6 +71,11 @@ MainWindow::MainWindow(QWidget* parent) :
     QObject::connect(ui->m_MinPathLength, SIGNAL(valueChanged(int)),
                     ui->m_OpenGLWidget, SLOT(SetMinPathLength(int)));
 
+    ui->statusBar->addPermanentWidget(m_MemoryLabel);
+    m_PlotWidget->setWindowFlags(Qt::Window);
+    m_AnalysisPool.setMaxThreadCount(1);
+    updateMemoryLabel();
+
     ui->m_ColourLegend->SetIsHorizontal(false);
     ui->m_ColourSpinBox->setMaximum(m_ColourMaps.GetNumberOfMaps()-1);
 
@@ -59,13 +88,45 @@ MainWindow::MainWindow(QWidget* parent) :
     ui->m_Mapping->addItem("Path Length",Qt::DisplayRole);
     ui->m_Mapping->addItem("Velocity Magnitude",Qt::DisplayRole);
     ui->m_Mapping->addItem("Path Curvature",Qt::DisplayRole);
+    ui->m_Mapping->addItem("Discrete Curvature",Qt::DisplayRole);
+    ui->m_Mapping->addItem("Diffusion Coefficient",Qt::DisplayRole);
+    ui->m_Mapping->addItem("RMSF",Qt::DisplayRole);
+    ui->m_Mapping->addItem("Mode Amplitude",Qt::DisplayRole);
 }
 
 MainWindow::~MainWindow()
 {
+    m_AnalysisPool.waitForDone();
     delete ui;
 }
 
+void MainWindow::buildHistogram()
+{
+    QVector<Histogram::Span> spans;
+    QVector<float> pathLengths;
+    AtomMetric metric = currentMetric();
+    if (metric)
+    {
+        for (int i = 0; i < m_AtomVector.length(); ++i)
+        {
+            QVector<float>& values = (m_AtomVector[i]->*metric)();
+            Histogram::Span span = {values.constData(), values.length()};
+            spans.append(span);
+        }
+    }
+    else
+    {
+        pathLengths.resize(m_AtomVector.length());
+        for (int i = 0; i < m_AtomVector.length(); ++i)
+        {
+            pathLengths[i] = m_AtomVector[i]->GetPathLengthRef().last();
+        }
+        Histogram::Span span = {pathLengths.constData(), pathLengths.length()};
+        spans.append(span);
+    }
+    m_Histogram.Build(spans);
+}
+
 void MainWindow::calculateDataRange()
 {
     if(ui->m_Mapping->currentText() == "Path Curvature")
@@ -75,6 +136,7 @@ void MainWindow::calculateDataRange()
         {
             m_RealMapMax = m_FileReader->GetMaxPathCurvature();
             m_RealMapMin = m_FileReader->GetMinPathCurvature();
+            buildHistogram();
             resetLegend();
         }
     }
@@ -85,6 +147,7 @@ void MainWindow::calculateDataRange()
         {
             m_RealMapMax = m_FileReader->GetMaxPathLength();
             m_RealMapMin = m_FileReader->GetMinPathLength();
+            buildHistogram();
             resetLegend();
         }
     }
@@ -95,26 +158,134 @@ void MainWindow::calculateDataRange()
         {
             m_RealMapMax = m_FileReader->GetMaxVelocity();
             m_RealMapMin = m_FileReader->GetMinVelocity();
+            buildHistogram();
+            resetLegend();
+        }
+    }
+    else if(ui->m_Mapping->currentText() == "Discrete Curvature")
+    {
+        m_FileReader->CalculateDiscreteCurvature();
+        if(m_LastMappedTo != ui->m_Mapping->currentText())
+        {
+            m_RealMapMax = m_FileReader->GetMaxDiscreteCurvature();
+            m_RealMapMin = m_FileReader->GetMinDiscreteCurvature();
+            buildHistogram();
             resetLegend();
         }
     }
+    else if(ui->m_Mapping->currentText() == "Diffusion Coefficient")
+    {
+        m_FileReader->CalculateDiffusion();
+        if(m_LastMappedTo != ui->m_Mapping->currentText())
+        {
+            m_RealMapMax = m_FileReader->GetMaxDiffusion();
+            m_RealMapMin = m_FileReader->GetMinDiffusion();
+            buildHistogram();
+            resetLegend();
+        }
+    }
+    else if(ui->m_Mapping->currentText() == "RMSF")
+    {
+        m_FileReader->CalculateFluctuation();
+        updateRmsdPlot();
+        if(m_LastMappedTo != ui->m_Mapping->currentText())
+        {
+            m_RealMapMax = m_FileReader->GetMaxFluctuation();
+            m_RealMapMin = m_FileReader->GetMinFluctuation();
+            buildHistogram();
+            resetLegend();
+        }
+    }
+    else if(ui->m_Mapping->currentText() == "Mode Amplitude")
+    {
+        float maxAmplitude = storeModeAmplitudes();
+        if(m_LastMappedTo != ui->m_Mapping->currentText())
+        {
+            m_RealMapMax = maxAmplitude;
+            m_RealMapMin = 0;
+            buildHistogram();
+            resetLegend();
+        }
+    }
+}
+
+void MainWindow::clearData()
+{
+    ui->m_OpenGLWidget->ClearData();
+    m_AtomVector.clear();
+    m_AtomVector.squeeze();
+    m_ResidueVector.clear();
+    m_CentroidVector.clear();
+    m_AtomTable = AtomTable();
+    m_ResidueAtomTable = AtomTable();
+    m_ResidueAtomOffsets.clear();
+    m_LastMappedTo.clear();
+    ui->m_RmsdPlot->SetSeries(QVector<QPointF>(), QString(), QString());
+    m_PrincipalComponents.Clear();
+}
+
+MainWindow::AtomTrajectory MainWindow::currentTrajectory()
+{
+    if (ui->m_AlignCheck->isChecked())
+    {
+        return &Atom::GetAlignedTrajectoryRef;
+    }
+    return &Atom::GetTrajectoryRef;
 }
 
-void MainWindow::createVertices()
+MainWindow::AtomMetric MainWindow::currentMetric()
 {
-    QVector<Vertex> vertices;
-    Vertex vertex;
+    if (ui->m_Mapping->currentText() == "Path Curvature")
+    {
+        return &Atom::GetPathCurvatureRef;
+    }
+    else if (ui->m_Mapping->currentText() == "Velocity Magnitude")
+    {
+        return &Atom::GetVelocityRef;
+    }
+    else if (ui->m_Mapping->currentText() == "Discrete Curvature")
+    {
+        return &Atom::GetDiscreteCurvatureRef;
+    }
+    else if (ui->m_Mapping->currentText() == "Diffusion Coefficient")
+    {
+        return &Atom::GetDiffusionRef;
+    }
+    else if (ui->m_Mapping->currentText() == "RMSF")
+    {
+        return &Atom::GetFluctuationRef;
+    }
+    else if (ui->m_Mapping->currentText() == "Mode Amplitude")
+    {
+        return &Atom::GetModeAmplitudeRef;
+    }
+    return 0;
+}
 
-    for (int i = 0; i < m_AtomVector.length(); ++i)
+QString MainWindow::describeMetrics(Atom* atom, int frame)
+{
+    QStringList names = QStringList() << "path length" << "velocity"
+                                      << "path curvature"
+                                      << "discrete curvature" << "diffusion"
+                                      << "rmsf" << "mode amplitude";
+    AtomMetric metrics[] = {&Atom::GetPathLengthRef, &Atom::GetVelocityRef,
+                            &Atom::GetPathCurvatureRef,
+                            &Atom::GetDiscreteCurvatureRef,
+                            &Atom::GetDiffusionRef, &Atom::GetFluctuationRef,
+                            &Atom::GetModeAmplitudeRef};
+    QStringList described;
+    for (int i = 0; i < names.length(); ++i)
     {
-        for (int j = 0; j < m_AtomVector[i]->GetTrajectoryRef().length(); ++j)
+        // Metrics from differences between frames have fewer values than
+        // there are frames.
+        QVector<float>& values = (atom->*metrics[i])();
+        if (!values.isEmpty())
         {
-            vertex.SetPosition(m_AtomVector[i]->GetTrajectoryRef()[j]);
-            vertices.append(vertex);
+            described.append(names[i] + " "
+                             + QString::number(values[qMin(frame, values.length() - 1)]));
         }
-        ui->m_OpenGLWidget->AddVertices(vertices);
-        vertices.clear();
     }
+    return described.join(", ");
 }
 
 void MainWindow::incrementFrame()
@@ -135,55 +306,53 @@ void MainWindow::incrementFrame()
 
 void MainWindow::mapColour()
 {
-    if (ui->m_OpenGLWidget->GetVerticesRef().length() == 0)
+    if (m_AtomVector.isEmpty())
     {
         return;
     }
     printString("Mapping colour to atoms...", MS_SECOND);
-    float range = m_UserMapMax - m_UserMapMin;
-    if (range == 0)
+    TRACE_SCOPE("MainWindow::mapColour");
+
+    int map = ui->m_ColourSpinBox->value();
+    ColourMapper mapper;
+    mapper.SetColourMap(m_ColourMaps.GetMapData(map), m_ColourMaps.GetMapLength());
+    mapper.SetRange(m_UserMapMin, m_UserMapMax);
+
+    AtomMetric metric = currentMetric();
+    QString mapping = ui->m_Mapping->currentText();
+    bool isLength = mapping == "Path Length";
+    // The diffusion coefficient, RMSF and mode amplitude have one value for
+    // the whole path.
+    bool isPerAtom = mapping == "Diffusion Coefficient" || mapping == "RMSF"
+            || mapping == "Mode Amplitude";
+
+    VertexFiller filler(m_AtomVector);
+    VertexFiller residueFiller(m_CentroidVector);
+    filler.SetTrajectory(currentTrajectory());
+    residueFiller.SetTrajectory(currentTrajectory());
+    if (isLength)
     {
-        range = 1;
+        filler.SetColours(&mapper, &Atom::GetPathLengthRef, true);
+        residueFiller.SetColours(&mapper, &Atom::GetPathLengthRef, true);
     }
-    float mapValue;
-    int mapIndex;
-    int map = ui->m_ColourSpinBox->value();
-    bool isCurve = ui->m_Mapping->currentText() == "Path Curvature";
-    bool isLength = ui->m_Mapping->currentText() == "Path Length";
-    bool isVelocity = ui->m_Mapping->currentText() == "Velocity Magnitude";
-    for (int i = 0; i < ui->m_OpenGLWidget->GetVerticesRef().length(); ++i)
+    else if (metric)
     {
-        if(isCurve)
-        {
-            for (int j = 0; j < ui->m_OpenGLWidget->GetVerticesRef()[i].length(); ++j)
-            {
-                mapValue = m_AtomVector[i]->GetPathCurvatureRef()[j] - m_RealMapMin;
-                mapIndex = m_ColourMaps.GetMap(map).length()*(mapValue/range);
-                ui->m_OpenGLWidget->GetVerticesRef()[i][j].SetColour(m_ColourMaps.GetColour(map,mapIndex));
-            }
-        }
-        else if(isLength)
-        {
-            for (int j = 0; j < ui->m_OpenGLWidget->GetVerticesRef()[i].length(); ++j)
-            {
-                mapValue = m_AtomVector[i]->GetPathLengthRef().last() - m_RealMapMin;
-                mapIndex = m_ColourMaps.GetMap(map).length()*(mapValue/range);
-                ui->m_OpenGLWidget->GetVerticesRef()[i][j].SetColour(m_ColourMaps.GetColour(map,mapIndex));
-            }
-        }
-        else if(isVelocity)
-        {
-            for (int j = 0; j < ui->m_OpenGLWidget->GetVerticesRef()[i].length(); ++j)
-            {
-                mapValue = m_AtomVector[i]->GetVelocityRef()[j] - m_RealMapMin;
-                mapIndex = m_ColourMaps.GetMap(map).length()*(mapValue/range);
-                ui->m_OpenGLWidget->GetVerticesRef()[i][j].SetColour(m_ColourMaps.GetColour(map,mapIndex));
-            }
-        }
+        filler.SetColours(&mapper, metric, isPerAtom);
+        residueFiller.SetColours(&mapper, metric, isPerAtom);
     }
-    m_LastMappedTo = ui->m_Mapping->currentText();
-    ui->m_OpenGLWidget->CreateTrajBuffer();
+    m_LastMappedTo = mapping;
+    bool filled = ui->m_OpenGLWidget->CreateTrajBuffer(filler);
+    filled = ui->m_OpenGLWidget->CreateResidueBuffer(residueFiller,
+                                                     m_FileReader->GetResidueRadius())
+            && filled;
     ui->m_OpenGLWidget->update();
+    updateMemoryLabel();
+    if (!filled)
+    {
+        printString("The trajectory is too large to draw. Choose fewer atoms "
+                    "or frames.", 5*MS_SECOND);
+        return;
+    }
     printString("Colour mapping complete!",MS_SECOND);
 }
 
@@ -201,29 +370,108 @@ void MainWindow::on_groSelectButton_clicked()
 
 void MainWindow::on_loadDataButton_clicked()
 {
+    TRACE_SCOPE("MainWindow::loadData");
     printString("Starting!", MS_SECOND);
 
     ui->m_FrameBox->setValue(0);
     QString groFilePath = ui->groLineEdit->text();
     QString xtcFilePath = ui->xtcLineEdit->text();
+    float startTime = ui->m_StartTime->value();
+    float endTime = ui->m_EndTime->value() > 0
+            ? ui->m_EndTime->value() : std::numeric_limits<float>::infinity();
+    m_FileReader->SetTimeWindow(startTime, endTime);
+    AtomSelection selection;
+    if (!selection.SetExpression(ui->m_LoadSelection->text()))
+    {
+        printString("Invalid selection: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    if (!selection.SetResidueNames(ui->m_ResidueSelection->text()))
+    {
+        printString("Invalid residue names: " + selection.GetError(),
+                    5*MS_SECOND);
+        return;
+    }
+    if (!selection.SetAtomNames(ui->m_AtomNameSelection->text()))
+    {
+        printString("Invalid atom names: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    if (!selection.SetAtomNumbers(ui->m_AtomNumberSelection->text()))
+    {
+        printString("The atom numbers must be numbers or ranges such as "
+                    "1-100.", 5*MS_SECOND);
+        return;
+    }
+    m_FileReader->SetAtomSelection(selection);
+    int stride = chooseFrameStride(xtcFilePath);
+    if (stride == 0)
+    {
+        return;
+    }
+    m_FileReader->SetFrameStride(stride);
     if(m_FileReader->LoadData(groFilePath, xtcFilePath))
     {
-        ui->m_OpenGLWidget->ClearData();
-        m_AtomVector.clear();
-        m_AtomVector.squeeze();
+        clearData();
         setAtomVector(m_FileReader->GetAtomVectorRef());
+        m_ResidueVector = m_FileReader->GetResidueVectorRef();
         printString("Files Loaded", MS_SECOND);
         int totalFrames = m_AtomVector[0]->GetTrajectoryRef().length();
         ui->m_FrameBox->setMaximum(totalFrames - 1);
+        ui->m_FitReference->setMaximum(totalFrames - 1);
         sort();
-        createVertices();
+        m_AtomTable = AtomTable::FromAtoms(m_AtomVector);
+        QVector<Atom*> residueAtoms;
+        m_ResidueAtomOffsets.clear();
+        for (int i = 0; i < m_ResidueVector.length(); ++i)
+        {
+            m_ResidueAtomOffsets.append(residueAtoms.length());
+            residueAtoms += m_ResidueVector[i]->GetAtomVectorRef();
+        }
+        m_ResidueAtomOffsets.append(residueAtoms.length());
+        m_ResidueAtomTable = AtomTable::FromAtoms(residueAtoms);
+        if (ui->m_AlignCheck->isChecked() && !m_FileReader->AlignFrames())
+        {
+            // The paths are drawn below, so unchecking need not redraw them.
+            ui->m_AlignCheck->blockSignals(true);
+            ui->m_AlignCheck->setChecked(false);
+            ui->m_AlignCheck->blockSignals(false);
+            printString("The fit selection chose no atoms.", 5*MS_SECOND);
+        }
         calculateDataRange();
         resetLegend();
         mapColour();
+        updateVisibleAtoms();
+        updatePaths();
         ui->m_OpenGLWidget->SetBoundingBox(m_FileReader->GetSimBoxRef());
         ui->m_OpenGLWidget->ResetLighting();
         ui->m_OpenGLWidget->ResetView();
     }
+    else if (m_FileReader->GetAtomVectorRef().isEmpty())
+    {
+        // The reader has dropped the previous data, so nothing may keep
+        // pointing into it.
+        clearData();
+    }
+    updateMemoryLabel();
+}
+
+void MainWindow::on_m_AlignCheck_toggled(bool checked)
+{
+    if (m_AtomVector.isEmpty())
+    {
+        return;
+    }
+
+    if (checked && !m_FileReader->AlignFrames())
+    {
+        printString("The fit selection chose no atoms.", 5*MS_SECOND);
+        ui->m_AlignCheck->setChecked(false);
+        return;
+    }
+    mapColour();
+    updatePaths();
+    updateMemoryLabel();
 }
 
 void MainWindow::on_m_ApplyColour_released()
@@ -232,6 +480,121 @@ void MainWindow::on_m_ApplyColour_released()
     mapColour();
 }
 
+void MainWindow::on_m_ApplyFit_clicked()
+{
+    if (m_AtomVector.isEmpty())
+    {
+        return;
+    }
+
+    SelectionExpression selection;
+    if (!selection.Compile(ui->m_FitSelection->text()))
+    {
+        printString("Invalid selection: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    if (!selection.IsEmpty() && selection.Evaluate(m_AtomTable).Count() == 0)
+    {
+        printString("The fit selection chose no atoms.", 5*MS_SECOND);
+        return;
+    }
+
+    m_FileReader->SetFit(selection, ui->m_FitReference->value());
+    m_FileReader->CalculateFluctuation();
+    updateRmsdPlot();
+    bool aligned = ui->m_AlignCheck->isChecked() && m_FileReader->AlignFrames();
+    if (ui->m_Mapping->currentText() == "RMSF")
+    {
+        m_LastMappedTo.clear();
+        calculateDataRange();
+        mapColour();
+    }
+    else if (aligned)
+    {
+        mapColour();
+    }
+    if (aligned)
+    {
+        updatePaths();
+    }
+    updateMemoryLabel();
+}
+
+void MainWindow::on_m_CalculateRdf_clicked()
+{
+    if (m_AtomVector.isEmpty() || m_AnalysisWatcher.isRunning()
+            || m_PcaWatcher.isRunning())
+    {
+        return;
+    }
+
+    SelectionExpression firstSelection;
+    SelectionExpression secondSelection;
+    if (!firstSelection.Compile(ui->m_RdfFirst->text())
+            || !secondSelection.Compile(ui->m_RdfSecond->text()))
+    {
+        QString error = firstSelection.GetError().isEmpty()
+                ? secondSelection.GetError() : firstSelection.GetError();
+        printString("Invalid selection: " + error, 5*MS_SECOND);
+        return;
+    }
+    Bitset first = firstSelection.Evaluate(m_AtomTable);
+    Bitset second = secondSelection.Evaluate(m_AtomTable);
+    m_RadialDistribution.SetCutoff(ui->m_RdfCutoff->value());
+    m_RadialDistribution.SetFrameStride(ui->m_RdfStride->value());
+
+    // The atoms must stay loaded until the calculation has finished.
+    ui->loadDataButton->setEnabled(false);
+    ui->m_CalculateRdf->setEnabled(false);
+    ui->m_CalculatePca->setEnabled(false);
+    printString("Calculating RDF...", MS_SECOND);
+    RadialDistribution* rdf = &m_RadialDistribution;
+    QVector<Atom*> atoms = m_AtomVector;
+    QVector3D box = m_FileReader->GetSimBoxRef();
+    m_AnalysisWatcher.setFuture(QtConcurrent::run(&m_AnalysisPool, [=]()
+    {
+        return rdf->Calculate(atoms, first, second, box);
+    }));
+}
+
+void MainWindow::on_m_CalculatePca_clicked()
+{
+    if (m_AtomVector.isEmpty() || m_AnalysisWatcher.isRunning()
+            || m_PcaWatcher.isRunning())
+    {
+        return;
+    }
+
+    SelectionExpression selection;
+    if (!selection.Compile(ui->m_PcaSelection->text()))
+    {
+        printString("Invalid selection: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    Bitset selected = selection.Evaluate(m_AtomTable);
+    if (!m_FileReader->FitFrames())
+    {
+        printString("The fit selection chose no atoms.", 5*MS_SECOND);
+        return;
+    }
+    updateRmsdPlot();
+    updateMemoryLabel();
+    m_PrincipalComponents.SetMemoryBudget(ui->m_MemoryBudget->value()*BYTES_PER_MB);
+
+    // The atoms must stay loaded until the calculation has finished.
+    ui->loadDataButton->setEnabled(false);
+    ui->m_CalculateRdf->setEnabled(false);
+    ui->m_CalculatePca->setEnabled(false);
+    printString("Calculating PCA...", MS_SECOND);
+    PrincipalComponents* pca = &m_PrincipalComponents;
+    QVector<Atom*> atoms = m_AtomVector;
+    QVector<Superposition::Fit> fits = m_FileReader->GetFitsRef();
+    m_PcaWatcher.setFuture(QtConcurrent::run(&m_AnalysisPool, [=]()
+    {
+        return pca->Calculate(atoms, selected, fits);
+    }));
+}
+
 void MainWindow::on_m_ColourSpinBox_valueChanged(int arg1)
 {
     ui->m_ColourLegend->SetColourMap(m_ColourMaps.GetMap(arg1));
@@ -241,12 +604,123 @@ void MainWindow::on_m_LegendMax_textEdited(const QString &arg1)
 {
     m_UserMapMax = arg1.toFloat();
     ui->m_LegendMid->setText(QString::number((m_UserMapMax + m_UserMapMin)/2).left(5));
+    updateHistogram();
 }
 
 void MainWindow::on_m_LegendMin_textEdited(const QString &arg1)
 {
     m_UserMapMin = arg1.toFloat();
     ui->m_LegendMid->setText(QString::number((m_UserMapMax + m_UserMapMin)/2).left(5));
+    updateHistogram();
+}
+
+void MainWindow::on_m_ExportTrace_clicked()
+{
+    QString traceFilePath = QFileDialog::getSaveFileName(this,
+                                                         tr("Export trace"),
+                                                         QDir::homePath(),
+                                                         tr("Chrome trace files (*.json)"));
+    if (traceFilePath.isEmpty())
+    {
+        return;
+    }
+    if (Trace::WriteChromeJson(traceFilePath))
+    {
+        printString("Trace written to " + traceFilePath, MS_SECOND);
+    }
+    else
+    {
+        printString("Could not write trace file.", MS_SECOND);
+    }
+}
+
+void MainWindow::on_m_LoadResults_clicked()
+{
+    if (m_AtomVector.isEmpty())
+    {
+        printString("Load the data the results were calculated for first.",
+                    5*MS_SECOND);
+        return;
+    }
+    QString resultsFilePath = QFileDialog::getOpenFileName(this,
+                                                           tr("Select results file"),
+                                                           QDir::homePath(),
+                                                           tr("MDVis results files (*.mdvis)"));
+    if (resultsFilePath.isEmpty())
+    {
+        return;
+    }
+    if (m_FileReader->LoadResults(resultsFilePath))
+    {
+        m_LastMappedTo.clear();
+        mapColour();
+    }
+    updateMemoryLabel();
+}
+
+void MainWindow::on_m_PercentileCheck_toggled(bool checked)
+{
+    Q_UNUSED(checked);
+    if (m_Histogram.IsEmpty())
+    {
+        return;
+    }
+    resetLegend();
+}
+
+void MainWindow::on_m_PcaComponent_valueChanged(int value)
+{
+    if (m_PcaWatcher.isRunning() || value > m_PrincipalComponents.GetComponents())
+    {
+        return;
+    }
+
+    updatePcaPlot();
+    if (ui->m_Mapping->currentText() == "Mode Amplitude")
+    {
+        m_LastMappedTo.clear();
+        calculateDataRange();
+        mapColour();
+    }
+}
+
+void MainWindow::on_m_PlotMsd_clicked()
+{
+    if (m_AtomVector.isEmpty())
+    {
+        return;
+    }
+
+    SelectionExpression selection;
+    if (!selection.Compile(ui->m_MsdSelection->text()))
+    {
+        printString("Invalid selection: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    Bitset selected = selection.Evaluate(m_AtomTable);
+    if (selected.Count() == 0)
+    {
+        printString("The MSD selection chose no atoms.", 5*MS_SECOND);
+        return;
+    }
+
+    m_FileReader->CalculateMeanSquareDisplacement();
+    updateMemoryLabel();
+    QVector<float> msd = MeanSquareDisplacement::Average(m_AtomVector, selected);
+    const QVector<int>& stepTime = m_AtomVector[0]->GetStepTimeRef();
+    QVector<QPointF> points(msd.length());
+    for (int i = 0; i < msd.length(); ++i)
+    {
+        points[i] = QPointF(stepTime[i] - stepTime[0], msd[i]);
+    }
+    m_PlotWidget->SetSeries(points, "t (ps)", "MSD (nm^2)");
+    m_PlotWidget->setWindowTitle("Mean Square Displacement");
+    m_PlotWidget->show();
+    m_PlotWidget->raise();
+    float diffusion = MeanSquareDisplacement::DiffusionCoefficient(msd, stepTime);
+    printString("Diffusion coefficient of " + QString::number(selected.Count())
+                + " atoms: " + QString::number(diffusion) + " nm^2/ps",
+                5*MS_SECOND);
 }
 
 void MainWindow::on_m_RefreshRateSlider_valueChanged(int value)
@@ -265,6 +739,11 @@ void MainWindow::on_m_ResetLegendScale_released()
     resetLegend();
 }
 
+void MainWindow::on_m_ShowSelection_editingFinished()
+{
+    updateVisibleAtoms();
+}
+
 void MainWindow::on_xtcSelectButton_clicked()
 {
     QString xtcFilePath = QFileDialog::getOpenFileName(this,
@@ -285,11 +764,19 @@ void MainWindow::outputFPS()
 
 void MainWindow::resetLegend()
 {
-    ui->m_LegendMax->setText(QString::number(m_RealMapMax,'f',3));
-    ui->m_LegendMin->setText(QString::number(m_RealMapMin,'f',3));
-    ui->m_LegendMid->setText(QString::number((m_RealMapMax + m_RealMapMin)/2,'f',3));
-    m_UserMapMax = m_RealMapMax;
-    m_UserMapMin = m_RealMapMin;
+    float max = m_RealMapMax;
+    float min = m_RealMapMin;
+    if (ui->m_PercentileCheck->isChecked() && !m_Histogram.IsEmpty())
+    {
+        max = m_Histogram.Percentile(UPPER_PERCENTILE);
+        min = m_Histogram.Percentile(LOWER_PERCENTILE);
+    }
+    ui->m_LegendMax->setText(QString::number(max,'f',3));
+    ui->m_LegendMin->setText(QString::number(min,'f',3));
+    ui->m_LegendMid->setText(QString::number((max + min)/2,'f',3));
+    m_UserMapMax = max;
+    m_UserMapMin = min;
+    updateHistogram();
 }
 
 void MainWindow::printString(QString string, int duration)
@@ -314,15 +801,256 @@ void MainWindow::setTimerStatus(bool running)
     }
 }
 
-void MainWindow::sort()
+void MainWindow::showPickedItem(int item, bool residue)
+{
+    if (item < 0)
+    {
+        printString("No atom under the cursor.", MS_SECOND);
+        return;
+    }
+
+    int frame = ui->m_FrameBox->value();
+    QString description;
+    Atom* atom;
+    if (residue)
+    {
+        Residue* picked = m_ResidueVector[item];
+        atom = &picked->GetCentroidRef();
+        description = "Residue " + picked->GetResidueName() + " "
+                + QString::number(picked->GetResidueID()) + " ("
+                + QString::number(picked->GetAtomVectorRef().length())
+                + " atoms)";
+    }
+    else
+    {
+        atom = m_AtomVector[item];
+        description = "Atom " + atom->GetAtomName() + " "
+                + QString::number(atom->GetAtomNumber()) + " of residue "
+                + atom->GetParentResidue() + " "
+                + QString::number(atom->GetParentResidueID());
+    }
+    QString metrics = describeMetrics(atom, frame);
+    if (!metrics.isEmpty())
+    {
+        description += ": " + metrics;
+    }
+    printString(description, 5*MS_SECOND);
+}
+
+void MainWindow::showPrincipalComponents()
+{
+    ui->loadDataButton->setEnabled(true);
+    ui->m_CalculateRdf->setEnabled(true);
+    ui->m_CalculatePca->setEnabled(true);
+    if (!m_PcaWatcher.result())
+    {
+        printString(m_PrincipalComponents.GetError(), 5*MS_SECOND);
+        return;
+    }
+
+    int components = m_PrincipalComponents.GetComponents();
+    ui->m_PcaComponent->blockSignals(true);
+    ui->m_PcaComponent->setMaximum(components);
+    ui->m_PcaComponent->blockSignals(false);
+    QStringList shares;
+    for (int i = 0; i < components; ++i)
+    {
+        float share = m_PrincipalComponents.GetVariance(i)
+                /qMax(m_PrincipalComponents.GetTotalVariance(),
+                      std::numeric_limits<float>::min());
+        shares.append(QString::number(100*share, 'f', 1) + "%");
+    }
+    printString("Principal components explain " + shares.join(", ")
+                + " of the variance over "
+                + QString::number(m_PrincipalComponents.GetProjection(0).length())
+                + " frames.", 5*MS_SECOND);
+    on_m_PcaComponent_valueChanged(ui->m_PcaComponent->value());
+}
+
+void MainWindow::showRadialDistribution()
+{
+    ui->loadDataButton->setEnabled(true);
+    ui->m_CalculateRdf->setEnabled(true);
+    ui->m_CalculatePca->setEnabled(true);
+    if (!m_AnalysisWatcher.result())
+    {
+        printString(m_RadialDistribution.GetError(), 5*MS_SECOND);
+        return;
+    }
+
+    const QVector<float>& values = m_RadialDistribution.GetValues();
+    QVector<QPointF> points(values.length());
+    for (int i = 0; i < values.length(); ++i)
+    {
+        points[i] = QPointF(m_RadialDistribution.GetRadius(i), values[i]);
+    }
+    m_PlotWidget->SetSeries(points, "r (nm)", "g(r)");
+    m_PlotWidget->setWindowTitle("Radial Distribution Function");
+    m_PlotWidget->show();
+    m_PlotWidget->raise();
+    printString("RDF calculated over "
+                + QString::number(m_RadialDistribution.GetFrames())
+                + " frames.", MS_SECOND);
+}
+
+Bitset MainWindow::selectResidues(const SelectionExpression& selection)
+{
+    Bitset atoms = selection.Evaluate(m_ResidueAtomTable);
+    Bitset residues(m_ResidueVector.length());
+    for (int i = 0; i < m_ResidueVector.length(); ++i)
+    {
+        for (int j = m_ResidueAtomOffsets[i]; j < m_ResidueAtomOffsets[i + 1]; ++j)
+        {
+            if (atoms.Test(j))
+            {
+                residues.Set(i);
+                break;
+            }
+        }
+    }
+    return residues;
+}
+
+float MainWindow::storeModeAmplitudes()
 {
-    struct {
-        bool operator()(Atom* atom1, Atom* atom2)
+    float largest = 0;
+    if (m_PcaWatcher.isRunning())
+    {
+        // The components are being replaced, so no atom has an amplitude.
+        for (int i = 0; i < m_AtomVector.length(); ++i)
         {
-            return atom1->GetPathLengthRef().last()
-                 < atom2->GetPathLengthRef().last();
+            m_AtomVector[i]->GetModeAmplitudeRef().fill(0, 1);
         }
-    } compare;
+    }
+    else
+    {
+        largest = m_PrincipalComponents.StoreAmplitudes(m_AtomVector,
+                                                        ui->m_PcaComponent->value() - 1);
+    }
+    for (int i = 0; i < m_ResidueVector.length(); ++i)
+    {
+        m_ResidueVector[i]->AverageMetric(&Atom::GetModeAmplitudeRef);
+    }
+    return largest;
+}
+
+void MainWindow::sort()
+{
     m_FileReader->CalculatePathLength();
-    std::sort(m_AtomVector.begin(), m_AtomVector.end(), compare);
+    std::sort(m_AtomVector.begin(), m_AtomVector.end(),
+              Atom::PathLengthLessThan);
+    std::sort(m_ResidueVector.begin(), m_ResidueVector.end(),
+              [](Residue* residue1, Residue* residue2)
+    {
+        return Atom::PathLengthLessThan(&residue1->GetCentroidRef(),
+                                        &residue2->GetCentroidRef());
+    });
+    m_CentroidVector.clear();
+    for (int i = 0; i < m_ResidueVector.length(); ++i)
+    {
+        m_CentroidVector.append(&m_ResidueVector[i]->GetCentroidRef());
+    }
+}
+
+int MainWindow::chooseFrameStride(const QString& xtcFilePath)
+{
+    MemoryBudget budget(ui->m_MemoryBudget->value()*BYTES_PER_MB);
+    budget.SetSelection(m_FileReader->GetStartTime(),
+                        m_FileReader->GetEndTime(),
+                        ui->m_FrameStride->value());
+    if (!budget.Estimate(xtcFilePath))
+    {
+        // Let the file reader report the problem with the file.
+        return ui->m_FrameStride->value();
+    }
+
+    int stride = budget.ChooseStride();
+    if (stride == 0)
+    {
+        int maxStride = qMax(1, budget.GetFrames()/MemoryBudget::MIN_FRAMES);
+        printString("The trajectory needs at least "
+                    + MemoryAccount::ToMegabytes(budget.GetRequiredBytes(maxStride))
+                    + ", which is over the memory budget.", 5*MS_SECOND);
+    }
+    else if (stride > ui->m_FrameStride->value())
+    {
+        printString("Loading every " + QString::number(stride)
+                    + " frames to fit the memory budget, "
+                    + MemoryAccount::ToMegabytes(budget.GetRequiredBytes(stride))
+                    + " estimated.", 5*MS_SECOND);
+    }
+    return stride;
+}
+
+void MainWindow::updateHistogram()
+{
+    ui->m_Histogram->SetBins(m_Histogram.Resample(m_UserMapMin, m_UserMapMax,
+                                                  HISTOGRAM_BARS));
+}
+
+void MainWindow::updateVisibleAtoms()
+{
+    SelectionExpression selection;
+    if (!selection.Compile(ui->m_ShowSelection->text()))
+    {
+        printString("Invalid selection: " + selection.GetError(), 5*MS_SECOND);
+        return;
+    }
+    Bitset visible = selection.Evaluate(m_AtomTable);
+    ui->m_OpenGLWidget->SetVisibleAtoms(visible);
+    ui->m_OpenGLWidget->SetVisibleResidues(selectResidues(selection));
+    if (!selection.IsEmpty())
+    {
+        printString("Showing " + QString::number(visible.Count()) + " of "
+                    + QString::number(visible.Size()) + " atoms.", MS_SECOND);
+    }
+}
+
+void MainWindow::updateMemoryLabel()
+{
+    m_MemoryLabel->setText("Memory: " + MemoryAccount::Summary());
+}
+
+void MainWindow::updatePaths()
+{
+    PathLevels atomLevels;
+    atomLevels.Build(m_AtomVector, currentTrajectory());
+    PathLevels residueLevels;
+    residueLevels.Build(m_CentroidVector, currentTrajectory());
+    ui->m_OpenGLWidget->CreatePathLevelBuffers(atomLevels, residueLevels);
+    SpatialIndex atomIndex;
+    atomIndex.Build(m_AtomVector, currentTrajectory());
+    SpatialIndex residueIndex;
+    residueIndex.Build(m_CentroidVector, currentTrajectory());
+    ui->m_OpenGLWidget->SetSpatialIndices(atomIndex, residueIndex);
+}
+
+void MainWindow::updatePcaPlot()
+{
+    int component = ui->m_PcaComponent->value() - 1;
+    QVector<float> projection = m_PrincipalComponents.GetProjection(component);
+    const QVector<int>& stepTime = m_AtomVector[0]->GetStepTimeRef();
+    int stride = m_PrincipalComponents.GetFrameStride();
+    QVector<QPointF> points(projection.length());
+    for (int i = 0; i < projection.length(); ++i)
+    {
+        points[i] = QPointF(stepTime[i*stride] - stepTime[0], projection[i]);
+    }
+    m_PlotWidget->SetSeries(points, "t (ps)",
+                            "PC" + QString::number(component + 1) + " (nm)");
+    m_PlotWidget->setWindowTitle("Principal Component Projection");
+    m_PlotWidget->show();
+    m_PlotWidget->raise();
+}
+
+void MainWindow::updateRmsdPlot()
+{
+    const QVector<Superposition::Fit>& fits = m_FileReader->GetFitsRef();
+    QVector<QPointF> points(fits.length());
+    for (int i = 0; i < fits.length(); ++i)
+    {
+        points[i] = QPointF(i, fits[i].rmsd);
+    }
+    ui->m_RmsdPlot->SetSeries(points, "Frame", "RMSD (nm)");
+    ui->m_RmsdPlot->SetMarker(ui->m_FrameBox->value());
 }
@@ -15,10 +15,18 @@
 #include <QGraphicsScene>
 #include <QTimer>
 #include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QLabel>
+#include <QThreadPool>
 #include "Residue.h"
 #include "FileReader.h"
 #include "Vertex.h"
 #include "ColourMaps.h"
+#include "Histogram.h"
+#include "PlotWidget.h"
+#include "PrincipalComponents.h"
+#include "RadialDistribution.h"
+#include "SelectionExpression.h"
 
 namespace Ui {
 class MainWindow;
@@ -59,12 +67,44 @@ private slots:
      */
     void on_loadDataButton_clicked();
 
+    /**
+     * @brief Function describing actions to be taken upon toggling the
+     * aligned check box. Aligns the frames by the fit selection if they
+     * have not been aligned, and redraws the paths.
+     * @param checked True if the aligned positions are to be drawn, false
+     * if the positions as loaded are to be drawn.
+     */
+    void on_m_AlignCheck_toggled(bool checked);
+
     /**
      * @brief Function describing actions to be taken upon releasing the
      * Apply Colour Mapping button.
      */
     void on_m_ApplyColour_released();
 
+    /**
+     * @brief Function describing actions to be taken upon clicking the fit
+     * button. Fits every frame onto the fit reference frame by the atoms
+     * chosen by the fit selection, plots the RMSD of each frame and
+     * recalculates the RMSF and, if they are drawn, the aligned paths.
+     */
+    void on_m_ApplyFit_clicked();
+
+    /**
+     * @brief Function describing actions to be taken upon clicking the
+     * calculate RDF button. Starts calculating the radial distribution
+     * function between the two RDF selections in the background.
+     */
+    void on_m_CalculateRdf_clicked();
+
+    /**
+     * @brief Function describing actions to be taken upon clicking the
+     * calculate PCA button. Starts finding the principal components of the
+     * fitted motion of the atoms chosen by the PCA selection in the
+     * background.
+     */
+    void on_m_CalculatePca_clicked();
+
     /**
      * @brief Function describing actions to be taken upon changing the
      * value of the colour map selection spin box.
@@ -86,6 +126,43 @@ private slots:
      */
     void on_m_LegendMin_textEdited(const QString &arg1);
 
+    /**
+     * @brief Function describing actions to be taken upon clicking the export
+     * trace button. Writes the recorded timing spans to a Chrome trace file.
+     */
+    void on_m_ExportTrace_clicked();
+
+    /**
+     * @brief Function describing actions to be taken upon clicking the load
+     * results button. Reads metrics precalculated by mdvis-cli for the
+     * loaded data, and colours the atoms with them.
+     */
+    void on_m_LoadResults_clicked();
+
+    /**
+     * @brief Function describing actions to be taken upon changing the
+     * value of the mode spin box. Plots the projection onto the chosen
+     * principal component, and recolours the atoms if they are coloured by
+     * mode amplitude.
+     * @param value The new value of the mode spin box, counting from 1.
+     */
+    void on_m_PcaComponent_valueChanged(int value);
+
+    /**
+     * @brief Function describing actions to be taken upon toggling the
+     * percentile clipping check box.
+     * @param checked True if the legend range is to be clipped to the
+     * percentile range, false if it is to cover all values.
+     */
+    void on_m_PercentileCheck_toggled(bool checked);
+
+    /**
+     * @brief Function describing actions to be taken upon clicking the plot
+     * MSD button. Plots the mean square displacement of the atoms chosen by
+     * the MSD selection and prints their diffusion coefficient.
+     */
+    void on_m_PlotMsd_clicked();
+
     /**
      * @brief Function describing actions to be taken upon changing the
      * value of the refresh rate slider.
@@ -99,6 +176,12 @@ private slots:
      */
     void on_m_ResetLegendScale_released();
 
+    /**
+     * @brief Function describing actions to be taken upon finishing editing
+     * the visible atom selection line edit.
+     */
+    void on_m_ShowSelection_editingFinished();
+
     /**
      * @brief Function describing actions to be taken upon clicking the .xtc
      * file select button.
@@ -127,7 +210,41 @@ private slots:
      */
     void setTimerStatus(bool running);
 
+    /**
+     * @brief Prints the name, Residue and metrics at the current frame of a
+     * picked atom or Residue.
+     * @param item The index of the atom in m_AtomVector, or of the Residue
+     * in m_ResidueVector, or -1 if nothing was picked.
+     * @param residue True if @e item is a Residue, false if it is an atom.
+     */
+    void showPickedItem(int item, bool residue);
+
+    /**
+     * @brief Plots the projection onto the chosen principal component once
+     * the components have been found in the background, or prints why they
+     * could not be.
+     */
+    void showPrincipalComponents();
+
+    /**
+     * @brief Plots the radial distribution function once it has been
+     * calculated in the background, or prints why it could not be.
+     */
+    void showRadialDistribution();
+
 private:
+    /**
+     * @brief Pointer to an @Atom member function returning a per-frame
+     * metric.
+     */
+    typedef QVector<float>& (Atom::*AtomMetric)();
+
+    /**
+     * @brief Pointer to an @Atom member function returning a layer of
+     * positions.
+     */
+    typedef QVector<QVector3D>& (Atom::*AtomTrajectory)();
+
     /**
      * @brief Getter for the @Atom pointer vector.
      * @return A reference to a QVector of @Atom pointers.
@@ -140,6 +257,11 @@ private:
      */
     void setAtomVector(QVector<Atom*> atomVector);
 
+    /**
+     * @brief Builds the histogram of the currently colour-mapped variable.
+     */
+    void buildHistogram();
+
     /**
      * @brief Calculates the range of values for the currently colour-mapped
      * variable and updates the maximum and minimum mapping values accordingly.
@@ -147,10 +269,34 @@ private:
     void calculateDataRange();
 
     /**
-     * @brief Generates a list of @Vertex objects from the @Atoms in
-     * m_AtomVector and adds them to the OpenGL drawing surface.
+     * @brief Drops every pointer to the loaded Atoms and Residues and clears
+     * the drawn data.
+     */
+    void clearData();
+
+    /**
+     * @brief Returns the @Atom metric for the currently selected colour
+     * mapping.
+     * @return A pointer to the @Atom getter for the metric, or 0 if the
+     * mapping is the path length, which is mapped by its final value.
      */
-    void createVertices();
+    AtomMetric currentMetric();
+
+    /**
+     * @brief Returns the layer of positions drawn.
+     * @return A pointer to the @Atom getter for the aligned trajectory if
+     * the aligned check box is checked, or for the trajectory otherwise.
+     */
+    AtomTrajectory currentTrajectory();
+
+    /**
+     * @brief Describes the metrics of an @Atom at a frame, leaving out
+     * metrics which have not been calculated.
+     * @param atom The @Atom, or Residue centroid.
+     * @param frame The frame.
+     * @return The metrics, separated by commas.
+     */
+    QString describeMetrics(Atom* atom, int frame);
 
     /**
      * @brief Applies the currently selected colour mapping to the data.
@@ -164,25 +310,116 @@ private:
     void resetLegend();
 
     /**
-     * @brief Sorts m_AtomVector by path length.
+     * @brief Chooses the Residues with any atom chosen by a selection.
+     * @param selection The selection.
+     * @return One bit per Residue of m_ResidueVector, set for the chosen
+     * Residues.
+     */
+    Bitset selectResidues(const SelectionExpression& selection);
+
+    /**
+     * @brief Stores the amplitude of every @Atom in the principal component
+     * chosen by the mode spin box, and averages it over each Residue.
+     * @return The largest amplitude, or zero if no components have been
+     * found.
+     */
+    float storeModeAmplitudes();
+
+    /**
+     * @brief Sorts m_AtomVector, and m_ResidueVector by the path length of
+     * the Residue centroids, by path length.
      */
     void sort();
 
+    /**
+     * @brief Chooses the frame stride for loading an .xtc file within the
+     * memory budget set by the user. The stride is never smaller than the
+     * one set by the user.
+     * @param xtcFilePath The path of the .xtc file to be loaded.
+     * @return The frame stride, or zero if the file cannot be loaded within
+     * the budget.
+     */
+    int chooseFrameStride(const QString& xtcFilePath);
+
+    /**
+     * @brief Redraws the histogram alongside the legend for the current
+     * legend range.
+     */
+    void updateHistogram();
+
+    /**
+     * @brief Shows the memory held by each subsystem in the status bar.
+     */
+    void updateMemoryLabel();
+
+    /**
+     * @brief Builds the simplified paths and spatial indices of the drawn
+     * positions.
+     */
+    void updatePaths();
+
+    /**
+     * @brief Plots the projection of each frame used onto the principal
+     * component chosen by the mode spin box.
+     */
+    void updatePcaPlot();
+
+    /**
+     * @brief Plots the RMSD of each frame from the last fit alongside the
+     * frame counter.
+     */
+    void updateRmsdPlot();
+
+    /**
+     * @brief Shows only the atoms chosen by the visible atom selection.
+     */
+    void updateVisibleAtoms();
+
     /**
      * @brief The UI for this window.
      */
     Ui::MainWindow *ui;
 
+    /**
+     * @brief The thread on which analyses run in the background, so that
+     * the window stays responsive while they split their work across the
+     * global thread pool.
+     */
+    QThreadPool m_AnalysisPool;
+
+    /**
+     * @brief Watches the radial distribution function being calculated in
+     * the background, if any.
+     */
+    QFutureWatcher<bool> m_AnalysisWatcher;
+
+    /**
+     * @brief The topology of m_AtomVector, in the same order, for evaluating
+     * selections.
+     */
+    AtomTable m_AtomTable;
+
     /**
      * @brief A QVector of @Atom pointers.
      */
     QVector<Atom*> m_AtomVector;
 
+    /**
+     * @brief The centroids of m_ResidueVector, in the same order.
+     */
+    QVector<Atom*> m_CentroidVector;
+
     /**
      * @brief The @ColourMaps object to be used.
      */
     ColourMaps m_ColourMaps;
 
+    /**
+     * @brief The histogram of the variable to which colour is currently
+     * mapped.
+     */
+    Histogram m_Histogram;
+
     /**
      * @brief The @FileReader object to be used.
      */
@@ -207,6 +444,33 @@ private:
      */
     QString m_LastMappedTo;
 
+    /**
+     * @brief Permanent status bar label showing the memory held by each
+     * subsystem.
+     */
+    QLabel* m_MemoryLabel = new QLabel(this);
+
+    /**
+     * @brief Watches the principal components being found in the
+     * background, if any.
+     */
+    QFutureWatcher<bool> m_PcaWatcher;
+
+    /**
+     * @brief The window in which the results of analyses are plotted.
+     */
+    PlotWidget* m_PlotWidget = new PlotWidget(this);
+
+    /**
+     * @brief The principal components last found.
+     */
+    PrincipalComponents m_PrincipalComponents;
+
+    /**
+     * @brief The radial distribution function last calculated.
+     */
+    RadialDistribution m_RadialDistribution;
+
     /**
      * @brief The actual maximum value of the variable to which colour is
      * currently mapped.
@@ -219,6 +483,24 @@ private:
      */
     float m_RealMapMin = INFINITY;
 
+    /**
+     * @brief The index in m_ResidueAtomTable of the first atom of each
+     * Residue of m_ResidueVector, followed by the number of atoms.
+     */
+    QVector<int> m_ResidueAtomOffsets;
+
+    /**
+     * @brief The topology of the atoms of m_ResidueVector, Residue by
+     * Residue, for evaluating selections.
+     */
+    AtomTable m_ResidueAtomTable;
+
+    /**
+     * @brief The Residues of the loaded atoms, sorted by the path length of
+     * their centroids.
+     */
+    QVector<Residue*> m_ResidueVector;
+
     /**
      * @brief The time between painting events when animation is occurring.
      */
@@ -242,10 +524,32 @@ private:
      */
     float m_UserMapMin;
 
+    /**
+     * @brief The number of bars drawn in the histogram alongside the legend.
+     */
+    const int HISTOGRAM_BARS = 64;
+
+    /**
+     * @brief The fraction of values below the legend minimum when the legend
+     * is clipped to the percentile range.
+     */
+    const float LOWER_PERCENTILE = 0.01;
+
+    /**
+     * @brief The number of bytes in a MB.
+     */
+    const qint64 BYTES_PER_MB = 1024*1024;
+
     /**
      * @brief The number of miliseconds in a second.
      */
     const int MS_SECOND = 1000;
+
+    /**
+     * @brief The fraction of values below the legend maximum when the legend
+     * is clipped to the percentile range.
+     */
+    const float UPPER_PERCENTILE = 0.99;
 };
 
 #endif // MAINWINDOW_H
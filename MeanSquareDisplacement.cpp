@@ -0,0 +1,254 @@
+#include "MeanSquareDisplacement.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <QtMath>
+#include <complex>
+#include <utility>
+
+constexpr float MeanSquareDisplacement::FIT_START;
+constexpr float MeanSquareDisplacement::FIT_END;
+
+namespace
+{
+    /**
+     * @brief A complex number in double precision.
+     */
+    typedef std::complex<double> Complex;
+
+    /**
+     * @brief Performs an in-place radix-2 fast Fourier transform.
+     * @param data The values to be transformed, a power of two in number.
+     * @param twiddles The roots of unity exp(-2 pi i k/size) for k below
+     * half the size.
+     * @param size The number of values.
+     * @param inverse True for the inverse transform, without the 1/size
+     * scaling, false for the forward transform.
+     */
+    void transform(Complex* data, const Complex* twiddles, int size, bool inverse)
+    {
+        for (int i = 1, j = 0; i < size; ++i)
+        {
+            int bit = size >> 1;
+            for (; j & bit; bit >>= 1)
+            {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j)
+            {
+                std::swap(data[i], data[j]);
+            }
+        }
+
+        for (int length = 2; length <= size; length <<= 1)
+        {
+            int step = size/length;
+            int half = length/2;
+            for (int start = 0; start < size; start += length)
+            {
+                for (int k = 0; k < half; ++k)
+                {
+                    Complex twiddle = inverse ? std::conj(twiddles[k*step])
+                                              : twiddles[k*step];
+                    Complex odd = data[start + k + half]*twiddle;
+                    data[start + k + half] = data[start + k] - odd;
+                    data[start + k] += odd;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calculates the mean square displacement of one path.
+     * @param trajectory The positions of the path.
+     * @param twiddles The roots of unity for transforms of @e size values.
+     * @param size A power of two at least twice the number of frames, so
+     * that the autocorrelation does not wrap around.
+     * @param packed Workspace of @e size values.
+     * @param power Workspace of @e size values.
+     * @param msd Set to the mean square displacement at each lag.
+     */
+    void calculatePath(const QVector<QVector3D>& trajectory,
+                       const Complex* twiddles, int size,
+                       Complex* packed, Complex* power, QVector<float>& msd)
+    {
+        int frames = trajectory.length();
+        msd.fill(0, frames);
+        if (frames < 2)
+        {
+            return;
+        }
+
+        double mean[3] = {0, 0, 0};
+        for (int i = 0; i < frames; ++i)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                mean[axis] += trajectory[i][axis];
+            }
+        }
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            mean[axis] /= frames;
+        }
+
+        // x and y are transformed together as the real and imaginary parts
+        // of one signal, and z on its own.
+        for (int i = 0; i < size; ++i)
+        {
+            if (i < frames)
+            {
+                packed[i] = Complex(trajectory[i].x() - mean[0],
+                                    trajectory[i].y() - mean[1]);
+                power[i] = Complex(trajectory[i].z() - mean[2], 0);
+            }
+            else
+            {
+                packed[i] = 0;
+                power[i] = 0;
+            }
+        }
+        transform(packed, twiddles, size, false);
+        transform(power, twiddles, size, false);
+
+        // The power spectra of x and y summed are separated from the packed
+        // transform as (|X(k)|^2 + |X(-k)|^2)/2, and its inverse transform
+        // is the autocorrelation summed over the axes.
+        for (int k = 0; k < size; ++k)
+        {
+            double packedPower = (std::norm(packed[k])
+                                  + std::norm(packed[(size - k) % size]))/2;
+            power[k] = packedPower + std::norm(power[k]);
+        }
+        transform(power, twiddles, size, true);
+
+        // The sum of squared positions at both ends of each pair, dropping
+        // the frames which no longer have a partner at each longer lag.
+        QVector<double> squared(frames);
+        double total = 0;
+        for (int i = 0; i < frames; ++i)
+        {
+            double sum = 0;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                double position = trajectory[i][axis] - mean[axis];
+                sum += position*position;
+            }
+            squared[i] = sum;
+            total += 2*sum;
+        }
+        for (int lag = 0; lag < frames; ++lag)
+        {
+            if (lag > 0)
+            {
+                total -= squared[lag - 1] + squared[frames - lag];
+            }
+            double pairs = frames - lag;
+            double autocorrelation = power[lag].real()/size;
+            msd[lag] = (float)qMax(0.0, (total - 2*autocorrelation)/pairs);
+        }
+    }
+}
+
+void MeanSquareDisplacement::Calculate(const QVector<Atom*>& atoms)
+{
+    TRACE_SCOPE("MeanSquareDisplacement::Calculate");
+    if (atoms.isEmpty())
+    {
+        return;
+    }
+
+    int frames = atoms[0]->GetTrajectoryRef().length();
+    int size = 1;
+    while (size < 2*frames)
+    {
+        size <<= 1;
+    }
+    QVector<Complex> twiddles(qMax(1, size/2));
+    for (int k = 0; k < twiddles.length(); ++k)
+    {
+        twiddles[k] = std::polar(1.0, -2*M_PI*k/size);
+    }
+
+    Atom* const* atomData = atoms.constData();
+    const Complex* twiddleData = twiddles.constData();
+    Parallel::For(atoms.length(), MIN_ATOMS_PER_THREAD,
+                  [atomData, twiddleData, size](int, int first, int last)
+    {
+        QVector<Complex> packed(size);
+        QVector<Complex> power(size);
+        for (int i = first; i < last; ++i)
+        {
+            Atom* atom = atomData[i];
+            QVector<float>& msd = atom->GetMeanSquareDisplacementRef();
+            calculatePath(atom->GetTrajectoryRef(), twiddleData, size,
+                          packed.data(), power.data(), msd);
+            atom->GetDiffusionRef().fill(
+                        DiffusionCoefficient(msd, atom->GetStepTimeRef()), 1);
+        }
+    });
+}
+
+QVector<float> MeanSquareDisplacement::Average(const QVector<Atom*>& atoms,
+                                               const Bitset& selection)
+{
+    QVector<double> sum;
+    int count = 0;
+    for (int i = 0; i < atoms.length(); ++i)
+    {
+        if (!selection.Test(i))
+        {
+            continue;
+        }
+        const QVector<float>& msd = atoms[i]->GetMeanSquareDisplacementRef();
+        if (sum.isEmpty())
+        {
+            sum.fill(0, msd.length());
+        }
+        for (int j = 0; j < qMin(sum.length(), msd.length()); ++j)
+        {
+            sum[j] += msd[j];
+        }
+        ++count;
+    }
+
+    QVector<float> mean(sum.length());
+    for (int j = 0; j < sum.length(); ++j)
+    {
+        mean[j] = (float)(sum[j]/count);
+    }
+    return mean;
+}
+
+float MeanSquareDisplacement::DiffusionCoefficient(const QVector<float>& msd,
+                                                   const QVector<int>& stepTime)
+{
+    int lags = qMin(msd.length(), stepTime.length());
+    int first = qMax(1, (int)(lags*FIT_START));
+    int last = qMin(lags - 1, (int)(lags*FIT_END));
+    if (last <= first)
+    {
+        return 0;
+    }
+
+    double sumT = 0;
+    double sumM = 0;
+    double sumTT = 0;
+    double sumTM = 0;
+    int count = last - first + 1;
+    for (int lag = first; lag <= last; ++lag)
+    {
+        double time = stepTime[lag] - stepTime[0];
+        sumT += time;
+        sumM += msd[lag];
+        sumTT += time*time;
+        sumTM += time*msd[lag];
+    }
+    double denominator = count*sumTT - sumT*sumT;
+    if (denominator <= 0)
+    {
+        return 0;
+    }
+    double slope = (count*sumTM - sumT*sumM)/denominator;
+    return (float)(slope/6);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file MeanSquareDisplacement.h
+ * @date 19 Oct 2026
+ * @see Atom.h
+ * @see FileReader.h
+ * @brief This class calculates the mean square displacement of atom paths
+ * and the diffusion coefficients derived from them.
+ *
+ * The mean square displacement at a lag of m frames is the mean over every
+ * pair of frames m apart of the squared distance between them. Rather than
+ * visiting every pair, which takes O(N^2) time for N frames, it is split
+ * into a sum of squared positions, found with a running total, and the
+ * autocorrelation of the positions, found with a fast Fourier transform in
+ * O(N log N) time. The positions are taken relative to their mean and the
+ * sums are made in double precision, so the difference of the two terms
+ * keeps its precision at short lags. The paths must be unwrapped, as they
+ * are when loaded from an .xtc file.
+ *
+ * The diffusion coefficient is found from the Einstein relation
+ * MSD(t) = 6Dt, by a least squares fit of the mean square displacement
+ * between FIT_START and FIT_END of the longest lag. Short lags are left out
+ * because motion there is not yet diffusive, and long lags because they
+ * average over few pairs of frames.
+ */
+
+#ifndef MEANSQUAREDISPLACEMENT_H
+#define MEANSQUAREDISPLACEMENT_H
+
+#include "Atom.h"
+#include "Bitset.h"
+#include <QVector>
+
+class MeanSquareDisplacement
+{
+public:
+    /**
+     * @brief Calculates the mean square displacement and diffusion
+     * coefficient of every @Atom in @e atoms and stores them in each @Atom,
+     * splitting the atoms across the global thread pool. All atoms must have
+     * the same number of frames.
+     * @param atoms The atoms to be processed.
+     */
+    static void Calculate(const QVector<Atom*>& atoms);
+
+    /**
+     * @brief Averages the mean square displacements of a selection of
+     * atoms, which must already have been calculated.
+     * @param atoms The atoms.
+     * @param selection One bit per atom of @e atoms, set for the atoms to be
+     * averaged.
+     * @return The mean square displacement at each lag, in nm^2, or an empty
+     * QVector if no atoms are selected.
+     */
+    static QVector<float> Average(const QVector<Atom*>& atoms,
+                                  const Bitset& selection);
+
+    /**
+     * @brief Fits a diffusion coefficient to a mean square displacement.
+     * @param msd The mean square displacement at each lag, in nm^2.
+     * @param stepTime The time of each frame, in ps, evenly spaced.
+     * @return The diffusion coefficient, in nm^2/ps, or 0 if there are too
+     * few frames to fit.
+     */
+    static float DiffusionCoefficient(const QVector<float>& msd,
+                                      const QVector<int>& stepTime);
+
+    /**
+     * @brief The fraction of the longest lag at which the fit starts.
+     */
+    static constexpr float FIT_START = 0.1f;
+
+    /**
+     * @brief The fraction of the longest lag at which the fit ends.
+     */
+    static constexpr float FIT_END = 0.9f;
+
+private:
+    /**
+     * @brief The smallest number of atoms worth handing to a thread.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 64;
+};
+
+#endif // MEANSQUAREDISPLACEMENT_H
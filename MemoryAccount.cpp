@@ -0,0 +1,66 @@
+#include "MemoryAccount.h"
+#include <QStringList>
+#include <atomic>
+
+namespace
+{
+    /**
+     * @brief The number of bytes held by each subsystem.
+     */
+    std::atomic<qint64> g_Bytes[MemoryAccount::SUBSYSTEM_COUNT];
+
+    /**
+     * @brief The display names of the subsystems.
+     */
+    const char* const SUBSYSTEM_NAMES[MemoryAccount::SUBSYSTEM_COUNT] =
+    {
+        "Topology",
+        "Trajectory",
+        "Metrics",
+        "GPU"
+    };
+}
+
+qint64 MemoryAccount::Get(Subsystem subsystem)
+{
+    return g_Bytes[subsystem].load(std::memory_order_relaxed);
+}
+
+QString MemoryAccount::GetName(Subsystem subsystem)
+{
+    return SUBSYSTEM_NAMES[subsystem];
+}
+
+qint64 MemoryAccount::GetHostTotal()
+{
+    qint64 total = 0;
+    for (int i = 0; i < SUBSYSTEM_COUNT; ++i)
+    {
+        if (i != GPU)
+        {
+            total += Get((Subsystem)i);
+        }
+    }
+    return total;
+}
+
+void MemoryAccount::Set(Subsystem subsystem, qint64 bytes)
+{
+    g_Bytes[subsystem].store(bytes, std::memory_order_relaxed);
+}
+
+QString MemoryAccount::ToMegabytes(qint64 bytes)
+{
+    return QString::number(bytes/(1024.0*1024.0), 'f', 1) + " MB";
+}
+
+QString MemoryAccount::Summary()
+{
+    QStringList parts;
+    for (int i = 0; i < SUBSYSTEM_COUNT; ++i)
+    {
+        parts.append(GetName((Subsystem)i) + " "
+                     + ToMegabytes(Get((Subsystem)i)));
+    }
+    return parts.join(", ");
+}
@@ -0,0 +1,76 @@
+/**
+ * @file MemoryAccount.h
+ * @date 19 Oct 2026
+ * @brief This class keeps a running account of the memory held by each
+ * subsystem of the application.
+ *
+ * Each subsystem reports the number of bytes it currently holds whenever
+ * that changes, such as after a load or calculation. The totals are stored
+ * in atomic counters, so they can be reported from any thread and read at
+ * any time for display.
+ */
+
+#ifndef MEMORYACCOUNT_H
+#define MEMORYACCOUNT_H
+
+#include <QString>
+#include <QtGlobal>
+
+class MemoryAccount
+{
+public:
+    /**
+     * @brief The subsystems whose memory is accounted for.
+     */
+    enum Subsystem
+    {
+        TOPOLOGY,
+        TRAJECTORY,
+        METRICS,
+        GPU,
+        SUBSYSTEM_COUNT
+    };
+
+    /**
+     * @brief Returns the number of bytes held by a subsystem.
+     * @param subsystem The subsystem.
+     * @return The number of bytes last reported for the subsystem.
+     */
+    static qint64 Get(Subsystem subsystem);
+
+    /**
+     * @brief Returns the name of a subsystem, for display.
+     * @param subsystem The subsystem.
+     * @return The name of the subsystem.
+     */
+    static QString GetName(Subsystem subsystem);
+
+    /**
+     * @brief Returns the number of bytes held in main memory by all
+     * subsystems, which excludes GPU memory.
+     * @return The total number of bytes.
+     */
+    static qint64 GetHostTotal();
+
+    /**
+     * @brief Sets the number of bytes held by a subsystem.
+     * @param subsystem The subsystem.
+     * @param bytes The number of bytes the subsystem now holds.
+     */
+    static void Set(Subsystem subsystem, qint64 bytes);
+
+    /**
+     * @brief Formats a number of bytes in MB, for display.
+     * @param bytes The number of bytes.
+     * @return The size in MB, with one decimal place.
+     */
+    static QString ToMegabytes(qint64 bytes);
+
+    /**
+     * @brief Returns a one line summary of every subsystem, for display.
+     * @return The summary.
+     */
+    static QString Summary();
+};
+
+#endif // MEMORYACCOUNT_H
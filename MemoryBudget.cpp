@@ -0,0 +1,90 @@
+#include "MemoryBudget.h"
+#include "XtcFrameIndex.h"
+#include <QFile>
+#include <cmath>
+
+MemoryBudget::MemoryBudget(qint64 budget)
+    : m_Budget(budget)
+{
+}
+
+void MemoryBudget::SetSelection(float startTime, float endTime, int stride)
+{
+    m_StartTime = startTime;
+    m_EndTime = endTime;
+    m_Stride = qMax(1, stride);
+}
+
+bool MemoryBudget::Estimate(const QString& xtcFilePath)
+{
+    QFile xtcFile(xtcFilePath);
+    if (!xtcFile.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+    QByteArray frame;
+    if (!XtcFrameIndex::ReadFrame(xtcFile, frame))
+    {
+        return false;
+    }
+    int atoms = XtcFrameIndex::GetFrameAtoms(frame);
+    if (atoms < 1)
+    {
+        return false;
+    }
+    qint64 frameBytes = frame.size();
+    qint64 frames = qMax((qint64)1, (xtcFile.size() + frameBytes - 1)/frameBytes);
+
+    // Assume a constant time step to count the frames in the time window.
+    float firstTime = XtcFrameIndex::GetFrameTime(frame);
+    float timeStep = 0;
+    if (XtcFrameIndex::ReadFrame(xtcFile, frame))
+    {
+        timeStep = XtcFrameIndex::GetFrameTime(frame) - firstTime;
+    }
+    if (timeStep > 0)
+    {
+        double first = qMax(0.0, std::ceil(((double)m_StartTime - firstTime)/timeStep));
+        double last = qMin(frames - 1.0, std::floor(((double)m_EndTime - firstTime)/timeStep));
+        frames = last < first ? 0 : (qint64)(last - first) + 1;
+    }
+
+    m_Atoms = atoms;
+    m_Frames = (int)frames;
+    return true;
+}
+
+int MemoryBudget::GetAtoms() const
+{
+    return m_Atoms;
+}
+
+int MemoryBudget::GetFrames() const
+{
+    return m_Frames;
+}
+
+qint64 MemoryBudget::GetRequiredBytes(int stride) const
+{
+    qint64 frames = (m_Frames + stride - 1)/stride;
+    qint64 perAtomFrame = TRAJECTORY_BYTES + METRIC_BYTES;
+    return (qint64)m_Atoms*TOPOLOGY_BYTES + (qint64)m_Atoms*frames*perAtomFrame;
+}
+
+int MemoryBudget::ChooseStride() const
+{
+    if (m_Budget <= 0 || m_Frames == 0)
+    {
+        return m_Stride;
+    }
+    qint64 perAtomFrame = TRAJECTORY_BYTES + METRIC_BYTES;
+    qint64 available = m_Budget - (qint64)m_Atoms*TOPOLOGY_BYTES;
+    qint64 frames = available/((qint64)m_Atoms*perAtomFrame);
+    int minFrames = m_Frames < MIN_FRAMES ? m_Frames : MIN_FRAMES;
+    if (frames < minFrames)
+    {
+        return 0;
+    }
+    int stride = (int)((m_Frames + frames - 1)/frames);
+    return qMax(m_Stride, stride);
+}
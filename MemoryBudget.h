@@ -0,0 +1,135 @@
+/**
+ * @file MemoryBudget.h
+ * @date 19 Oct 2026
+ * @see MemoryAccount.h
+ * @brief This class estimates the memory a trajectory will need before it is
+ * loaded, and chooses how to load it within a memory budget.
+ *
+ * The number of atoms and the size of the first frame are read from the
+ * .xtc header, and the number of frames is estimated from the file size.
+ * The times of the first two frames give the time step, so the number of
+ * frames within a time window can be estimated too. Only every stride-th
+ * frame is kept when loading, so the smallest stride whose estimated memory
+ * fits within the budget is chosen.
+ */
+
+#ifndef MEMORYBUDGET_H
+#define MEMORYBUDGET_H
+
+#include <QString>
+#include <QtGlobal>
+#include <limits>
+
+class MemoryBudget
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param budget The number of bytes of main memory the trajectory may
+     * use, or zero for no limit.
+     */
+    MemoryBudget(qint64 budget);
+
+    /**
+     * @brief Sets the frames the user has chosen to load. Call this before
+     * Estimate().
+     * @param startTime Frames before this time, in ps, are not loaded.
+     * @param endTime Frames after this time, in ps, are not loaded.
+     * @param stride The smallest stride that will be chosen.
+     */
+    void SetSelection(float startTime, float endTime, int stride);
+
+    /**
+     * @brief Reads the .xtc header and estimates the size of the trajectory.
+     * @param xtcFilePath The path of the .xtc file.
+     * @return true if the header could be read, false otherwise.
+     */
+    bool Estimate(const QString& xtcFilePath);
+
+    /**
+     * @brief Returns the number of atoms in the trajectory.
+     * @return The number of atoms, from the .xtc header.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the estimated number of frames in the time window.
+     * @return The number of frames, estimated from the file size and the
+     * time step.
+     */
+    int GetFrames() const;
+
+    /**
+     * @brief Returns the estimated number of bytes needed to load every
+     * stride-th frame.
+     * @param stride The frame stride.
+     * @return The estimated number of bytes.
+     */
+    qint64 GetRequiredBytes(int stride) const;
+
+    /**
+     * @brief Chooses the smallest frame stride, no smaller than the stride
+     * set by SetSelection(), whose estimated memory fits within the budget,
+     * keeping at least MIN_FRAMES frames.
+     * @return The frame stride, or zero if the trajectory cannot fit within
+     * the budget at any stride.
+     */
+    int ChooseStride() const;
+
+    /**
+     * @brief The number of bytes held per atom per frame by the trajectory
+     * store: a QVector3D position and an int time.
+     */
+    static const int TRAJECTORY_BYTES = 16;
+
+    /**
+     * @brief The number of bytes held per atom per frame by the four
+     * calculated metrics.
+     */
+    static const int METRIC_BYTES = 16;
+
+    /**
+     * @brief The number of bytes held per atom by the topology, including
+     * the Atom object and its name strings.
+     */
+    static const int TOPOLOGY_BYTES = 256;
+
+    /**
+     * @brief The fewest frames a stride may reduce a trajectory to, as the
+     * path metrics need at least three.
+     */
+    static const int MIN_FRAMES = 3;
+
+private:
+    /**
+     * @brief The number of atoms in the trajectory.
+     */
+    int m_Atoms = 0;
+
+    /**
+     * @brief The number of bytes the trajectory may use, or zero for no limit.
+     */
+    qint64 m_Budget;
+
+    /**
+     * @brief Frames after this time, in ps, are not loaded.
+     */
+    float m_EndTime = std::numeric_limits<float>::infinity();
+
+    /**
+     * @brief The estimated number of frames in the time window.
+     */
+    int m_Frames = 0;
+
+    /**
+     * @brief Frames before this time, in ps, are not loaded.
+     */
+    float m_StartTime = -std::numeric_limits<float>::infinity();
+
+    /**
+     * @brief The smallest stride that will be chosen.
+     */
+    int m_Stride = 1;
+};
+
+#endif // MEMORYBUDGET_H
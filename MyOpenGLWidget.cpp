@@ -1,8 +1,13 @@
 #include "MyOpenGLWidget.h"
 #include "GL/glu.h"
 #include "math.h"
+#include "MemoryAccount.h"
+#include "Trace.h"
 #include <QMouseEvent>
+#include <QOpenGLContext>
 #include <QtMath>
+#include <QVector4D>
+#include <limits>
 
 void MyOpenGLWidget::SetAmbientValue(int ambientValue)
 {
@@ -72,88 +77,324 @@ void MyOpenGLWidget::SetMinPathLength(int percentage)
     }
 }
 
-void MyOpenGLWidget::setPan(bool panning)
+void MyOpenGLWidget::SetTrailCentred(bool centred)
 {
-    m_IsPanning = panning;
+    m_TrailCentred = centred;
+    update();
 }
 
-void MyOpenGLWidget::setRotate(bool rotating)
+void MyOpenGLWidget::SetTrailLength(int frames)
 {
-    m_IsRotating = rotating;
+    m_TrailLength = qMax(0, frames);
+    update();
 }
 
-QVector<QVector<Vertex> >& MyOpenGLWidget::GetVerticesRef()
+void MyOpenGLWidget::SetResidueDetail(bool enabled)
 {
-    return m_Vertices;
+    m_ResidueDetail = enabled;
+    update();
 }
 
-void MyOpenGLWidget::SetVertices(QVector<QVector<Vertex> > vertices)
+void MyOpenGLWidget::SetVisibleAtoms(const Bitset& visible)
 {
-    m_Vertices = vertices;
-    CreateTrajBuffer();
+    m_VisibleAtoms = visible;
+    findRuns(visible, m_VisibleRuns);
+    update();
 }
 
-void MyOpenGLWidget::SetZoom(float zoom)
+void MyOpenGLWidget::SetVisibleResidues(const Bitset& visible)
 {
-    m_Zoom = zoom;
+    m_VisibleResidues = visible;
+    findRuns(visible, m_VisibleResidueRuns);
     update();
 }
 
-MyOpenGLWidget::MyOpenGLWidget(QWidget* parent) : QOpenGLWidget(parent)
+void MyOpenGLWidget::setPan(bool panning)
 {
+    m_IsPanning = panning;
+}
 
+void MyOpenGLWidget::setRotate(bool rotating)
+{
+    m_IsRotating = rotating;
 }
 
-void MyOpenGLWidget::AddVertices(QVector<Vertex> vertices)
+void MyOpenGLWidget::SetZoom(float zoom)
 {
-    m_Vertices.append(vertices);
+    m_Zoom = zoom;
+    update();
+}
+
+MyOpenGLWidget::MyOpenGLWidget(QWidget* parent) : QOpenGLWidget(parent)
+{
+
 }
 
 void MyOpenGLWidget::ClearData()
 {
-    m_Vertices.clear();
-    m_Vertices.squeeze();
+    m_Atoms = 0;
+    m_Residues = 0;
+    m_ResidueRadius = 0;
+    m_TotalFrames = 0;
+    m_VisibleAtoms = Bitset();
+    m_VisibleRuns.clear();
+    m_VisibleResidues = Bitset();
+    m_VisibleResidueRuns.clear();
+    m_SpatialIndex = SpatialIndex();
+    m_ResidueSpatialIndex = SpatialIndex();
+    m_Highlighted = -1;
     m_TrajBuffer.destroy();
     m_TrajBuffer.create();
+    m_ResidueBuffer.destroy();
+    m_ResidueBuffer.create();
+    m_PathLevels = PathLevels();
+    m_ResiduePathLevels = PathLevels();
+    m_PathIndexBuffer.destroy();
+    m_PathIndexBuffer.create();
+    m_ResiduePathIndexBuffer.destroy();
+    m_ResiduePathIndexBuffer.create();
+    MemoryAccount::Set(MemoryAccount::GPU, 0);
+}
+
+bool MyOpenGLWidget::CreateTrajBuffer(const VertexFiller& filler)
+{
+    TRACE_SCOPE("MyOpenGLWidget::CreateTrajBuffer");
+
+    // Recolouring refills the buffer with the same atoms, so only new data
+    // resets which atoms are drawn.
+    if (filler.GetAtoms() != m_Atoms)
+    {
+        SetVisibleAtoms(Bitset(filler.GetAtoms(), true));
+    }
+    m_Atoms = filler.GetAtoms();
+    m_TotalFrames = filler.GetFrames();
+    bool filled = fillBuffer(m_TrajBuffer, filler);
+    if (!filled)
+    {
+        // Draw nothing rather than reading past the end of the buffer.
+        m_Atoms = 0;
+        SetVisibleAtoms(Bitset());
+        m_TrajBuffer.destroy();
+        m_TrajBuffer.create();
+    }
+    updateMemoryAccount();
+    return filled;
 }
 
-void MyOpenGLWidget::CreateTrajBuffer()
+bool MyOpenGLWidget::CreateResidueBuffer(const VertexFiller& filler,
+                                         float residueRadius)
 {
+    TRACE_SCOPE("MyOpenGLWidget::CreateResidueBuffer");
+
+    if (filler.GetAtoms() != m_Residues)
+    {
+        SetVisibleResidues(Bitset(filler.GetAtoms(), true));
+    }
+    m_Residues = filler.GetAtoms();
+    m_ResidueRadius = residueRadius;
+    bool filled = fillBuffer(m_ResidueBuffer, filler);
+    if (!filled)
+    {
+        m_Residues = 0;
+        SetVisibleResidues(Bitset());
+        m_ResidueBuffer.destroy();
+        m_ResidueBuffer.create();
+    }
+    updateMemoryAccount();
+    return filled;
+}
+
+void MyOpenGLWidget::CreatePathLevelBuffers(const PathLevels& atomLevels,
+                                            const PathLevels& residueLevels)
+{
+    TRACE_SCOPE("MyOpenGLWidget::CreatePathLevelBuffers");
     QOpenGLWidget::makeCurrent();
+    uploadPathLevels(atomLevels, m_PathIndexBuffer, m_PathLevels);
+    uploadPathLevels(residueLevels, m_ResiduePathIndexBuffer, m_ResiduePathLevels);
+    QOpenGLWidget::doneCurrent();
+    updateMemoryAccount();
+}
 
-    m_Atoms = m_Vertices.length();
-    m_TotalFrames = m_Vertices[0].length();
+void MyOpenGLWidget::SetSpatialIndices(const SpatialIndex& atomIndex,
+                                       const SpatialIndex& residueIndex)
+{
+    m_SpatialIndex = atomIndex;
+    m_ResidueSpatialIndex = residueIndex;
+    update();
+}
 
-    m_TrajBuffer.bind();
-    m_TrajBuffer.setUsagePattern(QOpenGLBuffer::StaticDraw);
-    m_TrajBuffer.allocate(sizeof(m_Vertices[0][0])*m_Atoms*m_TotalFrames);
+bool MyOpenGLWidget::fillBuffer(QOpenGLBuffer& buffer, const VertexFiller& filler)
+{
+    int items = filler.GetAtoms();
+    int frames = filler.GetFrames();
+    qint64 itemBytes = static_cast<qint64>(sizeof(Vertex))*frames;
 
-    int offset = sizeof(m_Vertices[0][0])*m_TotalFrames;
+    // QOpenGLBuffer takes sizes and offsets as int, so anything larger would
+    // wrap.
+    if (itemBytes*items > std::numeric_limits<int>::max())
+    {
+        return false;
+    }
+
+    QOpenGLWidget::makeCurrent();
+
+    buffer.bind();
+    buffer.setUsagePattern(QOpenGLBuffer::StaticDraw);
+    buffer.allocate(static_cast<int>(itemBytes*items));
+
+    int chunkItems = static_cast<int>(qMax(static_cast<qint64>(1),
+                                           UPLOAD_CHUNK_BYTES/qMax(static_cast<qint64>(1), itemBytes)));
 
-    for (int i = 0; i < m_Atoms; ++i)
+    // Only used if the buffer cannot be mapped, and never larger than one
+    // chunk.
+    QVector<Vertex> fallback;
+
+    for (int first = 0; first < items; first += chunkItems)
     {
-        m_TrajBuffer.write(offset*i, m_Vertices[i].constData(), offset);
+        int last = first + qMin(chunkItems, items - first);
+        qint64 offset = itemBytes*first;
+        qint64 bytes = itemBytes*(last - first);
+        void* mapped = buffer.mapRange(static_cast<int>(offset),
+                                       static_cast<int>(bytes),
+                                       QOpenGLBuffer::RangeWrite
+                                       | QOpenGLBuffer::RangeInvalidate);
+        if (mapped)
+        {
+            filler.Fill(first, last, static_cast<Vertex*>(mapped));
+            if (buffer.unmap())
+            {
+                continue;
+            }
+        }
+        fallback.resize((last - first)*frames);
+        filler.Fill(first, last, fallback.data());
+        buffer.write(static_cast<int>(offset), fallback.constData(),
+                     static_cast<int>(bytes));
     }
 
-    m_TrajBuffer.release();
+    buffer.release();
     QOpenGLWidget::doneCurrent();
+    return true;
+}
+
+void MyOpenGLWidget::findRuns(const Bitset& visible,
+                              QVector<QPair<int, int> >& runs)
+{
+    runs.clear();
+    int runFirst = -1;
+    for (int i = 0; i <= visible.Size(); ++i)
+    {
+        bool shown = i < visible.Size() && visible.Test(i);
+        if (shown && runFirst < 0)
+        {
+            runFirst = i;
+        }
+        else if (!shown && runFirst >= 0)
+        {
+            runs.append(qMakePair(runFirst, i));
+            runFirst = -1;
+        }
+    }
+}
+
+void MyOpenGLWidget::appendPath(const PathLevels& levels, int level, int item,
+                                int startFrame, int frames)
+{
+    if (level >= 0)
+    {
+        m_PathCounts.append(levels.GetCount(level, item));
+        m_PathOffsets.append((const GLvoid*)(sizeof(quint32)
+                                             *levels.GetFirst(level, item)));
+    }
+    else
+    {
+        m_PathFirsts.append(item*m_TotalFrames + startFrame);
+        m_PathCounts.append(frames);
+    }
+}
+
+bool MyOpenGLWidget::cullItems(SpatialIndex& index, const Frustum& frustum,
+                               bool paths, int items, const Bitset& visible,
+                               QVector<int>& culled)
+{
+    TRACE_SCOPE("MyOpenGLWidget::cullItems");
+    if (index.GetAtoms() != items || visible.Size() != items)
+    {
+        return false;
+    }
+    int maxItems = items*CULL_FRACTION;
+    if (!paths)
+    {
+        index.SetFrame(m_Frame);
+    }
+    if (paths ? !index.CullPaths(frustum, maxItems, culled)
+              : !index.CullPoints(frustum, maxItems, culled))
+    {
+        return false;
+    }
+
+    int kept = 0;
+    for (int i = 0; i < culled.length(); ++i)
+    {
+        if (isDrawn(culled[i], items, visible))
+        {
+            culled[kept++] = culled[i];
+        }
+    }
+    culled.resize(kept);
+    return true;
+}
+
+void MyOpenGLWidget::drawHighlight(QOpenGLBuffer& buffer)
+{
+    m_PathProgram->bind();
+    buffer.bind();
+
+    m_PathProgram->enableAttributeArray(0);
+    m_PathProgram->setAttributeBuffer(0, GL_FLOAT,
+                                  Vertex::PositionOffset(),
+                                  Vertex::TUPLE_SIZE,
+                                  Vertex::Stride());
+    m_PathProgram->disableAttributeArray(1);
+    m_PathProgram->setAttributeValue(1, HIGHLIGHT_COLOUR);
+
+    m_PathProgram->setUniformValue(m_PathProgram->uniformLocation("modelToWorld"),
+                                   m_Transform.ToMatrix());
+    m_PathProgram->setUniformValue(m_PathProgram->uniformLocation("worldToCamera"),
+                                   m_Camera.ToMatrix());
+    m_PathProgram->setUniformValue(m_PathProgram->uniformLocation("cameraToView"),
+                                   m_Projection);
+
+    // The path may already be drawn at the same depth.
+    glDepthFunc(GL_LEQUAL);
+    glLineWidth(HIGHLIGHT_WIDTH);
+    glDrawArrays(GL_LINE_STRIP, m_Highlighted*m_TotalFrames, m_TotalFrames);
+    glLineWidth(1.0f);
+    glDepthFunc(GL_LESS);
+
+    buffer.release();
+    m_PathProgram->release();
 }
 
-void MyOpenGLWidget::drawPaths()
+void MyOpenGLWidget::drawPaths(QOpenGLBuffer& buffer, int items,
+                               const QVector<QPair<int, int> >& runs,
+                               const PathLevels& levels, QOpenGLBuffer& indexBuffer,
+                               const QVector<int>* culled)
 {
     m_PathProgram->bind();
-    m_TrajBuffer.bind();
+    buffer.bind();
 
+    // The attributes start at the beginning of the buffer, so that the
+    // indices of the simplified paths address it directly.
     m_PathProgram->enableAttributeArray(0);
     m_PathProgram->enableAttributeArray(1);
-    int skippedAtoms = m_Atoms*m_MinPathLength;
-    int filterOffset = m_TotalFrames*skippedAtoms*Vertex::Stride();
+    int skippedAtoms = items*m_MinPathLength;
     m_PathProgram->setAttributeBuffer(0, GL_FLOAT,
-                                  filterOffset + Vertex::PositionOffset(),
+                                  Vertex::PositionOffset(),
                                   Vertex::TUPLE_SIZE,
                                   Vertex::Stride());
     m_PathProgram->setAttributeBuffer(1, GL_FLOAT,
-                                  filterOffset + Vertex::ColourOffset(),
+                                  Vertex::ColourOffset(),
                                   Vertex::TUPLE_SIZE,
                                   Vertex::Stride());
 
@@ -164,24 +405,103 @@ void MyOpenGLWidget::drawPaths()
     m_PathProgram->setUniformValue(m_PathProgram->uniformLocation("cameraToView"),
                                    m_Projection);
 
+    // The range of frames drawn, which is the whole path unless a trail
+    // is drawn.
+    int startFrame = 0;
+    int frames = m_TotalFrames;
+    int level = -1;
+    if (m_TrailLength > 0)
+    {
+        startFrame = m_TrailCentred ? m_Frame - m_TrailLength/2
+                                    : m_Frame - m_TrailLength;
+        int endFrame = qMin(startFrame + m_TrailLength, m_TotalFrames - 1);
+        startFrame = qMax(startFrame, 0);
+        frames = endFrame - startFrame + 1;
+    }
+    else if (levels.GetAtoms() == items)
+    {
+        level = levels.ChooseLevel(PATH_ERROR_PIXELS/pixelsPerNm());
+    }
+
+    // Gather every visible path, so that they are drawn in one call.
+    m_PathFirsts.clear();
+    m_PathCounts.clear();
+    m_PathOffsets.clear();
+    int filteredAtoms = items*(m_MaxPathLength-m_MinPathLength);
+    if (culled)
+    {
+        for (int i = 0; i < culled->length(); ++i)
+        {
+            appendPath(levels, level, culled->at(i), startFrame, frames);
+        }
+    }
+    else
+    {
+        for (int run = 0; run < runs.length(); ++run)
+        {
+            int runFirst;
+            int runLast;
+            if (!clipVisibleRun(runs[run], skippedAtoms,
+                                skippedAtoms + filteredAtoms, runFirst, runLast))
+            {
+                continue;
+            }
+            for (int i = runFirst; i < runLast; ++i)
+            {
+                appendPath(levels, level, i, startFrame, frames);
+            }
+        }
+    }
+
     glLineWidth(1.0f);
-    for (int i = 0; i < m_Atoms*(m_MaxPathLength-m_MinPathLength); ++i)
+    if (level >= 0)
     {
-        glDrawArrays(GL_LINE_STRIP, i*m_TotalFrames, m_TotalFrames);
+        indexBuffer.bind();
+        if (m_MultiDrawElements)
+        {
+            m_MultiDrawElements(GL_LINE_STRIP, m_PathCounts.constData(),
+                                GL_UNSIGNED_INT, m_PathOffsets.constData(),
+                                m_PathCounts.length());
+        }
+        else
+        {
+            for (int i = 0; i < m_PathCounts.length(); ++i)
+            {
+                glDrawElements(GL_LINE_STRIP, m_PathCounts[i],
+                               GL_UNSIGNED_INT, m_PathOffsets[i]);
+            }
+        }
+        indexBuffer.release();
+    }
+    else if (m_MultiDrawArrays)
+    {
+        m_MultiDrawArrays(GL_LINE_STRIP, m_PathFirsts.constData(),
+                          m_PathCounts.constData(), m_PathCounts.length());
+    }
+    else
+    {
+        for (int i = 0; i < m_PathCounts.length(); ++i)
+        {
+            glDrawArrays(GL_LINE_STRIP, m_PathFirsts[i], m_PathCounts[i]);
+        }
     }
 
-    m_TrajBuffer.release();
+    buffer.release();
     m_PathProgram->release();
 
 }
 
-void MyOpenGLWidget::drawPoints()
+void MyOpenGLWidget::drawPoints(QOpenGLBuffer& buffer, int items,
+                                const QVector<QPair<int, int> >& runs,
+                                const QVector<int>* culled)
 {
     m_PointProgram->bind();
-    m_TrajBuffer.bind();
+    buffer.bind();
 
+    // Culled points are drawn by their index in the whole buffer, so the
+    // attributes only skip the filtered atoms when drawing runs.
     int frameOffset = m_Frame*Vertex::Stride();
-    int skippedAtoms = m_Atoms*m_MinPathLength;
+    int skippedAtoms = culled ? 0 : items*m_MinPathLength;
     int filterOffset = m_TotalFrames*skippedAtoms*Vertex::Stride();
 
     m_PointProgram->enableAttributeArray(0);
@@ -208,12 +528,45 @@ void MyOpenGLWidget::drawPoints()
 
     glPointSize(m_CircleRadius/m_Zoom);
 
-    glDrawArrays(GL_POINTS, 0, m_Atoms*(m_MaxPathLength-m_MinPathLength));
+    if (culled)
+    {
+        // The indices are never negative, so they can be read as unsigned.
+        m_CullIndexBuffer.bind();
+        m_CullIndexBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
+        m_CullIndexBuffer.allocate(culled->constData(),
+                                   sizeof(int)*culled->length());
+        glDrawElements(GL_POINTS, culled->length(), GL_UNSIGNED_INT, 0);
+        m_CullIndexBuffer.release();
+    }
+    else
+    {
+        int filteredAtoms = items*(m_MaxPathLength-m_MinPathLength);
+        for (int run = 0; run < runs.length(); ++run)
+        {
+            int runFirst;
+            int runLast;
+            if (clipVisibleRun(runs[run], skippedAtoms,
+                               skippedAtoms + filteredAtoms, runFirst, runLast))
+            {
+                glDrawArrays(GL_POINTS, runFirst - skippedAtoms,
+                             runLast - runFirst);
+            }
+        }
+    }
 
-    m_TrajBuffer.release();
+    buffer.release();
     m_PointProgram->release();
 }
 
+bool MyOpenGLWidget::clipVisibleRun(const QPair<int, int>& run,
+                                    int first, int last,
+                                    int& runFirst, int& runLast)
+{
+    runFirst = qMax(run.first, first);
+    runLast = qMin(run.second, last);
+    return runFirst < runLast;
+}
+
 void MyOpenGLWidget::initializeGL()
 {
     glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
@@ -243,6 +596,34 @@ void MyOpenGLWidget::initializeGL()
     m_PointProgram->release();
 
     m_TrajBuffer.create();
+    m_ResidueBuffer.create();
+    m_PathIndexBuffer.create();
+    m_ResiduePathIndexBuffer.create();
+    m_CullIndexBuffer.create();
+
+    QOpenGLContext* context = QOpenGLContext::currentContext();
+    m_MultiDrawArrays = reinterpret_cast<MultiDrawArrays>(
+                context->getProcAddress("glMultiDrawArrays"));
+    m_MultiDrawElements = reinterpret_cast<MultiDrawElements>(
+                context->getProcAddress("glMultiDrawElements"));
+}
+
+bool MyOpenGLWidget::isDrawn(int item, int items, const Bitset& visible)
+{
+    // The same filter as the visible runs are clipped to when drawing.
+    int skippedAtoms = items*m_MinPathLength;
+    int filteredAtoms = items*(m_MaxPathLength-m_MinPathLength);
+    return item >= skippedAtoms && item < skippedAtoms + filteredAtoms
+            && visible.Test(item);
+}
+
+bool MyOpenGLWidget::isResidueLevel()
+{
+    if (!m_ResidueDetail || m_Residues == 0 || m_ResidueRadius <= 0)
+    {
+        return false;
+    }
+    return 2*m_ResidueRadius*pixelsPerNm() < RESIDUE_DETAIL_PIXELS;
 }
 
 void MyOpenGLWidget::mouseMoveEvent(QMouseEvent *event)
@@ -320,7 +701,16 @@ void MyOpenGLWidget::mousePressEvent(QMouseEvent *event)
 {
     setLastX(event->x());
     setLastY(event->y());
-    if (event->button() == Qt::LeftButton)
+    if (event->button() == Qt::LeftButton
+            && event->modifiers() == Qt::ControlModifier)
+    {
+        bool residues = isResidueLevel();
+        m_Highlighted = pickItem(event->x(), event->y(), residues);
+        m_HighlightResidue = residues;
+        emit atomPicked(m_Highlighted, residues);
+        update();
+    }
+    else if (event->button() == Qt::LeftButton)
     {
         setPan(true);
     }
@@ -340,6 +730,7 @@ void MyOpenGLWidget::mouseReleaseEvent(QMouseEvent *event)
 
 void MyOpenGLWidget::paintGL()
 {
+    TRACE_SCOPE("MyOpenGLWidget::paintGL");
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     m_Projection.setToIdentity();
@@ -347,16 +738,86 @@ void MyOpenGLWidget::paintGL()
                              (float)this->width()/(float)this->height(),
                              m_Near, m_Far);
 
+    bool residues = isResidueLevel();
+    const PathLevels& levels = residues ? m_ResiduePathLevels : m_PathLevels;
+    QOpenGLBuffer& indexBuffer = residues ? m_ResiduePathIndexBuffer
+                                          : m_PathIndexBuffer;
+    QOpenGLBuffer& buffer = residues ? m_ResidueBuffer : m_TrajBuffer;
+    int items = residues ? m_Residues : m_Atoms;
+    const QVector<QPair<int, int> >& runs = residues ? m_VisibleResidueRuns
+                                                     : m_VisibleRuns;
+    const Bitset& visible = residues ? m_VisibleResidues : m_VisibleAtoms;
+    SpatialIndex& index = residues ? m_ResidueSpatialIndex : m_SpatialIndex;
+    Frustum frustum(m_Projection*m_Camera.ToMatrix()*m_Transform.ToMatrix());
     if(m_DrawPaths)
     {
-        drawPaths();
+        bool culled = cullItems(index, frustum, true, items, visible,
+                                m_CulledItems);
+        drawPaths(buffer, items, runs, levels, indexBuffer,
+                  culled ? &m_CulledItems : 0);
     }
     if(m_DrawPoints)
     {
-        drawPoints();
+        bool culled = cullItems(index, frustum, false, items, visible,
+                                m_CulledItems);
+        drawPoints(buffer, items, runs, culled ? &m_CulledItems : 0);
+    }
+    if (m_Highlighted >= 0 && m_Highlighted < items
+            && m_HighlightResidue == residues)
+    {
+        drawHighlight(buffer);
     }
 }
 
+int MyOpenGLWidget::pickItem(int x, int y, bool residues)
+{
+    TRACE_SCOPE("MyOpenGLWidget::pickItem");
+    SpatialIndex& index = residues ? m_ResidueSpatialIndex : m_SpatialIndex;
+    int items = residues ? m_Residues : m_Atoms;
+    const Bitset& visible = residues ? m_VisibleResidues : m_VisibleAtoms;
+    if (items == 0 || index.GetAtoms() != items || visible.Size() != items)
+    {
+        return -1;
+    }
+    index.SetFrame(m_Frame);
+
+    // Unproject the point onto the near and far clipping planes to give the
+    // ray in model coordinates.
+    bool invertible;
+    QMatrix4x4 clipToModel = (m_Projection*m_Camera.ToMatrix()
+                              *m_Transform.ToMatrix()).inverted(&invertible);
+    if (!invertible)
+    {
+        return -1;
+    }
+    float clipX = 2.0f*x/this->width() - 1;
+    float clipY = 1 - 2.0f*y/this->height();
+    QVector3D nearPoint = clipToModel.map(QVector3D(clipX, clipY, -1));
+    QVector3D farPoint = clipToModel.map(QVector3D(clipX, clipY, 1));
+    QVector3D direction = (farPoint - nearPoint).normalized();
+
+    float pixels = qMax(PICK_PIXELS, m_CircleRadius/m_Zoom/2);
+    index.FindAlongRay(nearPoint, direction, pixels/pixelsPerNm(), m_CulledItems);
+    for (int i = 0; i < m_CulledItems.length(); ++i)
+    {
+        if (isDrawn(m_CulledItems[i], items, visible))
+        {
+            return m_CulledItems[i];
+        }
+    }
+    return -1;
+}
+
+float MyOpenGLWidget::pixelsPerNm()
+{
+    // A length at view depth d covers projection(1,1)/d of the half height
+    // of the viewport.
+    QVector4D centre = m_Camera.ToMatrix()*m_Transform.ToMatrix()
+            *QVector4D(m_BoxCentre, 1);
+    float depth = qMax(m_Near, -centre.z());
+    return m_Projection(1, 1)*this->height()/(2*depth);
+}
+
 void MyOpenGLWidget::PrintMatrix(QMatrix4x4 matrix)
 {
     QTextStream out(stdout);
@@ -388,6 +849,7 @@ void MyOpenGLWidget::SetBoundingBox(QVector3D box)
     m_Transform.ResetRotation();
     m_Transform.ResetTranslation();
     m_Transform.Translate(-box/2);
+    m_BoxCentre = box/2;
 
     setFar(box.x()*FAR_SCALING);
 
@@ -400,6 +862,27 @@ void MyOpenGLWidget::SetBoundingBox(QVector3D box)
     m_LightingMatrix.SetDefaultView(defaultView);
 }
 
+void MyOpenGLWidget::updateMemoryAccount()
+{
+    qint64 vertices = (qint64)sizeof(Vertex)*(m_Atoms + m_Residues)*m_TotalFrames;
+    qint64 indices = (qint64)sizeof(quint32)*(m_PathLevels.GetIndexCount()
+                                             + m_ResiduePathLevels.GetIndexCount());
+    MemoryAccount::Set(MemoryAccount::GPU, vertices + indices);
+}
+
+void MyOpenGLWidget::uploadPathLevels(const PathLevels& levels,
+                                      QOpenGLBuffer& buffer,
+                                      PathLevels& stored)
+{
+    buffer.bind();
+    buffer.setUsagePattern(QOpenGLBuffer::StaticDraw);
+    buffer.allocate(levels.GetIndices().constData(),
+                    sizeof(quint32)*levels.GetIndexCount());
+    buffer.release();
+    stored = levels;
+    stored.ClearIndices();
+}
+
 void MyOpenGLWidget::wheelEvent(QWheelEvent *event)
 {
     if (event->delta() < 0 && m_Zoom < ZOOM_SPEED)
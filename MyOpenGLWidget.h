@@ -10,7 +10,10 @@
 #ifndef MYOPENGLWIDGET_H
 #define MYOPENGLWIDGET_H
 
-#include "Vertex.h"
+#include "Bitset.h"
+#include "PathLevels.h"
+#include "SpatialIndex.h"
+#include "VertexFiller.h"
 #include "Transform3D.h"
 #include "Camera3D.h"
 #include <QOpenGLWidget>
@@ -23,19 +26,6 @@ class MyOpenGLWidget : public QOpenGLWidget
     Q_OBJECT
 
 public:
-    /**
-     * @brief Getter for a reference to the Vertex vector.
-     * @return A reference to the Vertex vector.
-     */
-    QVector<QVector<Vertex> >& GetVerticesRef();
-
-    /**
-     * @brief Setter for the Vertex data that is to be used in drawing.
-     * @param vertices A 2-dimensional QVector containing @Vertex objects for
-     * each time step, for each atom.
-     */
-    void SetVertices(QVector<QVector<Vertex> > vertices);
-
     /**
      * @brief Setter for the zoom level.
      * @param zoom The zoom factor as a float.
@@ -48,22 +38,61 @@ public:
      */
     MyOpenGLWidget(QWidget* parent);
 
-    /**
-     * @brief Appends a QVector of @Vertex objects to the vertex vector.
-     * @param vertices The QVector of @Vertex objects to be appended.
-     */
-    void AddVertices(QVector<Vertex> vertices);
-
     /**
      * @brief Clears all data currently stored in this object.
      */
     void ClearData();
 
     /**
-     * @brief Loads the vertices required to draw points and paths into the 
+     * @brief Loads the vertices required to draw points and paths into the
      * GPU memory as a buffer.
+     *
+     * The buffer is filled a chunk of atoms at a time, writing directly into
+     * mapped ranges of the buffer where the driver supports it, so at most
+     * one chunk of vertices is ever held in main memory.
+     * @param filler The VertexFiller used to write the vertices.
+     * @return true if the buffer was filled, false if it is larger than
+     * OpenGL buffers can address from here, in which case no atoms are drawn.
+     */
+    bool CreateTrajBuffer(const VertexFiller& filler);
+
+    /**
+     * @brief Loads the vertices of the Residue centroids into the GPU memory
+     * as a second buffer, laid out like the trajectory buffer. The centroids
+     * are drawn instead of the atoms when a Residue would cover fewer than
+     * RESIDUE_DETAIL_PIXELS pixels.
+     * @param filler The VertexFiller used to write the vertices, which has
+     * the same number of frames as the trajectory buffer.
+     * @param residueRadius The typical radius of a Residue, in nm.
+     * @return true if the buffer was filled, false if it is too large, in
+     * which case no Residues are drawn.
      */
-    void CreateTrajBuffer();
+    bool CreateResidueBuffer(const VertexFiller& filler, float residueRadius);
+
+    /**
+     * @brief Loads the simplified paths into the GPU memory as index buffers
+     * over the trajectory and Residue buffers. When zoomed out, paths are
+     * drawn from the coarsest level whose error is under PATH_ERROR_PIXELS
+     * pixels.
+     * @param atomLevels The levels of the atoms, in the order of the
+     * trajectory buffer.
+     * @param residueLevels The levels of the Residue centroids, in the order
+     * of the Residue buffer.
+     */
+    void CreatePathLevelBuffers(const PathLevels& atomLevels,
+                                const PathLevels& residueLevels);
+
+    /**
+     * @brief Sets the spatial indices used to skip atoms and paths outside
+     * the view. When zoomed in far enough that at most CULL_FRACTION of the
+     * atoms or Residues may be seen, only those are drawn.
+     * @param atomIndex The index of the atoms, in the order of the
+     * trajectory buffer.
+     * @param residueIndex The index of the Residue centroids, in the order
+     * of the Residue buffer.
+     */
+    void SetSpatialIndices(const SpatialIndex& atomIndex,
+                           const SpatialIndex& residueIndex);
 
     /**
      * @brief Convenience function for printint the contents of a 4x4 matrix.
@@ -138,6 +167,61 @@ public slots:
      */
     void SetMinPathLength(int percentage);
 
+    /**
+     * @brief Setter for whether the trail is centred on the current frame.
+     * @param centred If true the trail runs from half its length before the
+     * current frame to half its length after it, if false it ends at the
+     * current frame.
+     */
+    void SetTrailCentred(bool centred);
+
+    /**
+     * @brief Setter for the number of frames of each path drawn around the
+     * current frame. Trails are drawn from the full paths, not the
+     * simplified ones, as they are short.
+     * @param frames The length of the trail in frames, or 0 to draw whole
+     * paths.
+     */
+    void SetTrailLength(int frames);
+
+    /**
+     * @brief Setter for whether Residue centroids are drawn instead of atoms
+     * when the view is zoomed out.
+     * @param enabled If true the centroids are drawn when a Residue would
+     * cover fewer than RESIDUE_DETAIL_PIXELS pixels, if false atoms are
+     * always drawn.
+     */
+    void SetResidueDetail(bool enabled);
+
+    /**
+     * @brief Setter for which atoms are drawn. Every atom is drawn after new
+     * data is loaded.
+     * @param visible One bit per atom, in the order of the atoms in the
+     * trajectory buffer, set for the atoms to be drawn.
+     */
+    void SetVisibleAtoms(const Bitset& visible);
+
+    /**
+     * @brief Setter for which Residue centroids are drawn. Every centroid is
+     * drawn after new data is loaded.
+     * @param visible One bit per Residue, in the order of the centroids in
+     * the Residue buffer, set for the centroids to be drawn.
+     */
+    void SetVisibleResidues(const Bitset& visible);
+
+signals:
+    /**
+     * @brief Emitted when the user picks an atom or Residue by clicking on
+     * it with the control key held. The path of the picked item is drawn
+     * highlighted until the next pick.
+     * @param item The index of the atom in the trajectory buffer, or of the
+     * Residue in the Residue buffer, or -1 if nothing is drawn under the
+     * cursor.
+     * @param residue True if Residue centroids were drawn when picking,
+     * false if atoms were.
+     */
+    void atomPicked(int item, bool residue);
+
 protected:
     /**
      * @brief This function sets up the OpenGL environment and initializes
@@ -158,6 +242,25 @@ protected:
     void resizeGL(int w, int h);
 
 private:
+    /**
+     * @brief Pointer to glMultiDrawArrays(), which draws many ranges of
+     * vertices in one call.
+     */
+    typedef void (QOPENGLF_APIENTRYP MultiDrawArrays)(GLenum mode,
+                                                     const GLint* first,
+                                                     const GLsizei* count,
+                                                     GLsizei drawCount);
+
+    /**
+     * @brief Pointer to glMultiDrawElements(), which draws many ranges of
+     * indices in one call.
+     */
+    typedef void (QOPENGLF_APIENTRYP MultiDrawElements)(GLenum mode,
+                                                       const GLsizei* count,
+                                                       GLenum type,
+                                                       const GLvoid* const* indices,
+                                                       GLsizei drawCount);
+
     /**
      * @brief Getter for the far flipping plane.
      * @return The distance from the camera to the far clipping plane
@@ -197,16 +300,152 @@ private:
     void setRotate(bool rotating);
 
     /**
-     * @brief Uses the vertex data stored in the trajectory buffer to draw
-     * atom paths to the drawing surface.
+     * @brief Adds a path to the paths gathered for drawing.
+     * @param levels The simplified paths.
+     * @param level The level drawn, or -1 to draw the full paths.
+     * @param item The index of the atom or Residue.
+     * @param startFrame The first frame drawn of a full path.
+     * @param frames The number of frames drawn of a full path.
+     */
+    void appendPath(const PathLevels& levels, int level, int item,
+                    int startFrame, int frames);
+
+    /**
+     * @brief Finds the atoms or Residues which may be seen and are to be
+     * drawn, if few enough of them may be seen for culling to pay off.
+     * @param index The spatial index of the atoms or Residues.
+     * @param frustum The view frustum, in model coordinates.
+     * @param paths If true paths are culled, if false positions at the
+     * current frame are.
+     * @param items The number of atoms or Residues.
+     * @param visible The atoms or Residues to be drawn.
+     * @param culled Set to the atoms or Residues to be drawn which may be
+     * seen.
+     * @return true if @e culled is to be drawn, false if every atom or
+     * Residue is to be drawn from the visible runs instead.
      */
-    void drawPaths();
+    bool cullItems(SpatialIndex& index, const Frustum& frustum, bool paths,
+                   int items, const Bitset& visible, QVector<int>& culled);
 
     /**
-     * @brief Uses the vertex data stored in the trajectory buffer to draw
-     * atom positions as points to the drawing surface.
+     * @brief Draws the full path of the picked atom or Residue over the
+     * other paths, thicker and in HIGHLIGHT_COLOUR.
+     * @param buffer The trajectory buffer or the Residue buffer.
      */
-    void drawPoints();
+    void drawHighlight(QOpenGLBuffer& buffer);
+
+    /**
+     * @brief Uses the vertex data stored in a buffer to draw paths to the
+     * drawing surface.
+     * @param buffer The trajectory buffer or the Residue buffer.
+     * @param items The number of atoms or Residues in @e buffer.
+     * @param runs The runs of atoms or Residues to be drawn.
+     * @param levels The simplified paths of @e buffer, without indices.
+     * @param indexBuffer The indices of @e levels.
+     * @param culled The atoms or Residues to be drawn, or 0 to draw @e runs.
+     */
+    void drawPaths(QOpenGLBuffer& buffer, int items,
+                   const QVector<QPair<int, int> >& runs,
+                   const PathLevels& levels, QOpenGLBuffer& indexBuffer,
+                   const QVector<int>* culled);
+
+    /**
+     * @brief Uses the vertex data stored in a buffer to draw positions as
+     * points to the drawing surface.
+     * @param buffer The trajectory buffer or the Residue buffer.
+     * @param items The number of atoms or Residues in @e buffer.
+     * @param runs The runs of atoms or Residues to be drawn.
+     * @param culled The atoms or Residues to be drawn, or 0 to draw @e runs.
+     */
+    void drawPoints(QOpenGLBuffer& buffer, int items,
+                    const QVector<QPair<int, int> >& runs,
+                    const QVector<int>* culled);
+
+    /**
+     * @brief Clips a run of visible atoms to the atoms passing the path
+     * length filter.
+     * @param run The run, as the first atom and one past the last atom.
+     * @param first The first atom passing the filter.
+     * @param last One past the last atom passing the filter.
+     * @param runFirst Set to the first atom of the clipped run.
+     * @param runLast Set to one past the last atom of the clipped run.
+     * @return true if any atoms of the run pass the filter, false otherwise.
+     */
+    static bool clipVisibleRun(const QPair<int, int>& run, int first, int last,
+                               int& runFirst, int& runLast);
+
+    /**
+     * @brief Fills a buffer with vertices a chunk at a time, writing
+     * directly into mapped ranges of the buffer where the driver supports
+     * it.
+     * @param buffer The buffer, which is reallocated.
+     * @param filler The VertexFiller used to write the vertices.
+     * @return true if the buffer was filled, false if it needs more bytes
+     * than QOpenGLBuffer can take as an int, in which case the buffer is
+     * left untouched.
+     */
+    bool fillBuffer(QOpenGLBuffer& buffer, const VertexFiller& filler);
+
+    /**
+     * @brief Finds the runs of consecutive set bits.
+     * @param visible The bits.
+     * @param runs Set to the runs, as the first index and one past the last
+     * index of each run.
+     */
+    static void findRuns(const Bitset& visible, QVector<QPair<int, int> >& runs);
+
+    /**
+     * @brief Decides whether an atom or Residue is drawn, as it passes the
+     * path length filter and is visible.
+     * @param item The index of the atom or Residue.
+     * @param items The number of atoms or Residues.
+     * @param visible The atoms or Residues to be drawn.
+     * @return true if the atom or Residue is drawn, false otherwise.
+     */
+    bool isDrawn(int item, int items, const Bitset& visible);
+
+    /**
+     * @brief Finds the drawn atom or Residue under a point of the widget
+     * which is nearest to the camera, by casting a ray from the camera
+     * through the point and searching the spatial index of the current
+     * frame along it.
+     * @param x The x position of the point, in pixels.
+     * @param y The y position of the point, in pixels.
+     * @param residues If true Residue centroids are picked, if false atoms
+     * are.
+     * @return The index of the atom or Residue, or -1 if none is within
+     * PICK_PIXELS of the point.
+     */
+    int pickItem(int x, int y, bool residues);
+
+    /**
+     * @brief Returns the scale of the view at the centre of the simulation
+     * box with the current camera and zoom.
+     * @return The number of pixels covered by 1 nm.
+     */
+    float pixelsPerNm();
+
+    /**
+     * @brief Sets the GPU memory account to the bytes of every buffer.
+     */
+    void updateMemoryAccount();
+
+    /**
+     * @brief Uploads the indices of a set of simplified paths.
+     * @param levels The simplified paths.
+     * @param buffer The index buffer, which is reallocated.
+     * @param stored Set to @e levels, without its indices.
+     */
+    void uploadPathLevels(const PathLevels& levels, QOpenGLBuffer& buffer,
+                          PathLevels& stored);
+
+    /**
+     * @brief Decides whether Residue centroids are drawn instead of atoms,
+     * from the size in pixels of a typical Residue at the centre of the
+     * simulation box with the current camera and zoom.
+     * @return true if the centroids are to be drawn, false otherwise.
+     */
+    bool isResidueLevel();
 
     /**
      * @brief Handles behaviour on mouse movement.
@@ -240,7 +479,12 @@ private:
     /**
      * @brief The number of atoms currently being drawn.
      */
-    int m_Atoms;
+    int m_Atoms = 0;
+
+    /**
+     * @brief The centre of the simulation box, in model coordinates.
+     */
+    QVector3D m_BoxCentre;
 
     /**
      * @brief The camera object.
@@ -258,6 +502,18 @@ private:
      */
     float m_CircleRadius;
 
+    /**
+     * @brief The atoms or Residues left after culling, reused between
+     * frames.
+     */
+    QVector<int> m_CulledItems;
+
+    /**
+     * @brief The indices of the culled points being drawn, refilled on
+     * every frame they are culled.
+     */
+    QOpenGLBuffer m_CullIndexBuffer = QOpenGLBuffer(QOpenGLBuffer::IndexBuffer);
+
     /**
      * @brief Matrix describing the default camera view.
      */
@@ -283,6 +539,17 @@ private:
      */
     int m_Frame = 0;
 
+    /**
+     * @brief The index of the picked atom or Residue whose path is
+     * highlighted, or -1 if none is.
+     */
+    int m_Highlighted = -1;
+
+    /**
+     * @brief True if m_Highlighted is a Residue, false if it is an atom.
+     */
+    bool m_HighlightResidue = false;
+
     /**
      * @brief True if panning is occurring, false otherwise.
      */
@@ -326,11 +593,50 @@ private:
      */
     int m_ModelToWorld;
 
+    /**
+     * @brief glMultiDrawArrays(), or 0 if the driver does not provide it.
+     */
+    MultiDrawArrays m_MultiDrawArrays = 0;
+
+    /**
+     * @brief glMultiDrawElements(), or 0 if the driver does not provide it.
+     */
+    MultiDrawElements m_MultiDrawElements = 0;
+
     /**
      * @brief The distance from the camera to the near clipping plane.
      */
     float m_Near = 1;
 
+    /**
+     * @brief The number of vertices of each path drawn, reused between
+     * frames.
+     */
+    QVector<GLsizei> m_PathCounts;
+
+    /**
+     * @brief The first vertex of each path drawn from the full paths, reused
+     * between frames.
+     */
+    QVector<GLint> m_PathFirsts;
+
+    /**
+     * @brief The indices of the simplified atom paths.
+     */
+    QOpenGLBuffer m_PathIndexBuffer = QOpenGLBuffer(QOpenGLBuffer::IndexBuffer);
+
+    /**
+     * @brief The simplified atom paths, without their indices, which are
+     * held in m_PathIndexBuffer.
+     */
+    PathLevels m_PathLevels;
+
+    /**
+     * @brief The byte offset within the index buffer of each path drawn from
+     * the simplified paths, reused between frames.
+     */
+    QVector<const GLvoid*> m_PathOffsets;
+
     /**
      * @brief The shader program used for drawing paths.
      */
@@ -346,26 +652,98 @@ private:
      */
     QMatrix4x4 m_Projection;
     
+    /**
+     * @brief The buffer in which vertices used for drawing Residue centroids
+     * and their paths are stored.
+     */
+    QOpenGLBuffer m_ResidueBuffer;
+
+    /**
+     * @brief The indices of the simplified Residue centroid paths.
+     */
+    QOpenGLBuffer m_ResiduePathIndexBuffer = QOpenGLBuffer(QOpenGLBuffer::IndexBuffer);
+
+    /**
+     * @brief The simplified Residue centroid paths, without their indices,
+     * which are held in m_ResiduePathIndexBuffer.
+     */
+    PathLevels m_ResiduePathLevels;
+
+    /**
+     * @brief Flag determining if Residue centroids are drawn instead of
+     * atoms when zoomed out.
+     */
+    bool m_ResidueDetail = true;
+
+    /**
+     * @brief The typical radius of a Residue, in nm.
+     */
+    float m_ResidueRadius = 0;
+
+    /**
+     * @brief The number of Residues in the Residue buffer.
+     */
+    int m_Residues = 0;
+
+    /**
+     * @brief The spatial index of the Residue centroids.
+     */
+    SpatialIndex m_ResidueSpatialIndex;
+
+    /**
+     * @brief The spatial index of the atoms.
+     */
+    SpatialIndex m_SpatialIndex;
+
     /**
      * @brief The total number of frames in the data.
      */
-    int m_TotalFrames;
+    int m_TotalFrames = 0;
+
+    /**
+     * @brief Flag determining if the trail is centred on the current frame
+     * rather than ending at it.
+     */
+    bool m_TrailCentred = false;
+
+    /**
+     * @brief The number of frames of each path drawn around the current
+     * frame, or 0 to draw whole paths.
+     */
+    int m_TrailLength = 0;
 
     /**
      * @brief The buffer in which vertices used for drawing points and paths
      * are stored.
      */
     QOpenGLBuffer m_TrajBuffer;
-    
+
     /**
-     * @brief The Transform3D object to be used for handling transformations.
+     * @brief The atoms to be drawn, in the order of the trajectory buffer.
      */
-    Transform3D m_Transform;
+    Bitset m_VisibleAtoms;
+
+    /**
+     * @brief The runs of consecutive atoms to be drawn, as the first atom and
+     * one past the last atom of each run.
+     */
+    QVector<QPair<int, int> > m_VisibleRuns;
 
     /**
-     * @brief The @Vertex objects for each @Atom at each time step of the data.
+     * @brief The Residues to be drawn, in the order of the Residue buffer.
      */
-    QVector<QVector<Vertex> > m_Vertices;
+    Bitset m_VisibleResidues;
+
+    /**
+     * @brief The runs of consecutive Residues to be drawn, as the first
+     * Residue and one past the last Residue of each run.
+     */
+    QVector<QPair<int, int> > m_VisibleResidueRuns;
+    
+    /**
+     * @brief The Transform3D object to be used for handling transformations.
+     */
+    Transform3D m_Transform;
 
     /**
      * @brief The uniform location within the shader files of the world to
@@ -378,6 +756,13 @@ private:
      */
     float m_Zoom = 1.0;
 
+    /**
+     * @brief Only the atoms or Residues which may be seen are drawn when
+     * they are at most this fraction of all of them. Above it, gathering
+     * them costs more than drawing everything.
+     */
+    const float CULL_FRACTION = 0.5;
+
     /**
      * @brief A scaling factor used when determining the appropriate far
      * clipping plane for the simulation space size.
@@ -389,17 +774,46 @@ private:
      */
     const float FOV = 0.88;
 
+    /**
+     * @brief The colour of the highlighted path.
+     */
+    const QVector3D HIGHLIGHT_COLOUR = QVector3D(0, 0, 0);
+
+    /**
+     * @brief The width of the highlighted path, in pixels.
+     */
+    const float HIGHLIGHT_WIDTH = 3.0;
+
     /**
      * @brief The number one hundred as an int.
      */
     const int HUNDRED = 100;
 
+    /**
+     * @brief Paths are drawn from the coarsest simplified level whose error
+     * is at most this many pixels at the centre of the simulation box.
+     */
+    const float PATH_ERROR_PIXELS = 0.5;
+
+    /**
+     * @brief Atoms drawn within this many pixels of the cursor, or within
+     * their drawn point if larger, can be picked.
+     */
+    const float PICK_PIXELS = 4.0;
+
     /**
      * @brief A scaling factor used when setting the radius of circles to be
      * drawn.
      */
     const float RADIUS_SCALING = 10.0;
     
+    /**
+     * @brief Residue centroids are drawn instead of atoms when a typical
+     * Residue would be less than this many pixels across, as its atoms can
+     * no longer be told apart.
+     */
+    const float RESIDUE_DETAIL_PIXELS = 4.0;
+
     /**
      * @brief Scaling factor influencing the speed at which rotation occurs.
      */
@@ -420,6 +834,12 @@ private:
      */
     const int TUPLE_SIZE_3D = 3;
 
+    /**
+     * @brief The largest number of bytes of vertices written to a buffer in
+     * one chunk.
+     */
+    const int UPLOAD_CHUNK_BYTES = 16*1024*1024;
+
     /**
      * @brief The rate at which zooming occurs.
      */
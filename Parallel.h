@@ -0,0 +1,82 @@
+/**
+ * @file Parallel.h
+ * @date 19 Oct 2026
+ * @brief Provides a helper for splitting loops over a range of indices
+ * across the global thread pool.
+ *
+ * The range is divided into contiguous chunks, at most one per thread, and
+ * each chunk is passed to the supplied function as a half-open range.
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "Trace.h"
+#include <QThreadPool>
+#include <QVector>
+#include <QtConcurrent>
+
+namespace Parallel
+{
+    /**
+     * @brief Returns the number of chunks a range of indices will be split
+     * into by For(), which is the maximum number of concurrent calls. This
+     * is limited by the size of the global thread pool, so lowering its
+     * maximum thread count limits every parallel loop in the application.
+     * @param count The number of indices in the range.
+     * @param minChunkSize The smallest number of indices in a chunk.
+     * @return The number of chunks, at least one.
+     */
+    inline int ChunkCount(int count, int minChunkSize)
+    {
+        int threads = qMax(1, QThreadPool::globalInstance()->maxThreadCount());
+        int chunks = qMin(threads, count/qMax(1, minChunkSize));
+        return qMax(1, chunks);
+    }
+
+    /**
+     * @brief Calls @e function on contiguous chunks of the range [0, count)
+     * in parallel, and returns when all chunks have been processed.
+     * @param count The number of indices in the range.
+     * @param minChunkSize The smallest number of indices worth handing to a
+     * thread. Ranges smaller than this are processed on the calling thread.
+     * @param function A callable taking (int chunk, int first, int last),
+     * where @e chunk is the index of the chunk, from 0 to ChunkCount() - 1,
+     * and [first, last) is the range of indices to process.
+     */
+    template <typename Function>
+    void For(int count, int minChunkSize, Function function)
+    {
+        if (count <= 0)
+        {
+            return;
+        }
+        int chunks = ChunkCount(count, minChunkSize);
+        if (chunks == 1)
+        {
+            function(0, 0, count);
+            return;
+        }
+
+        struct Chunk
+        {
+            int index;
+            int first;
+            int last;
+        };
+        QVector<Chunk> ranges(chunks);
+        for (int i = 0; i < chunks; ++i)
+        {
+            ranges[i].index = i;
+            ranges[i].first = (int)((qint64)count*i/chunks);
+            ranges[i].last = (int)((qint64)count*(i + 1)/chunks);
+        }
+        QtConcurrent::blockingMap(ranges, [&function](Chunk& chunk)
+        {
+            TRACE_SCOPE("Parallel::For");
+            function(chunk.index, chunk.first, chunk.last);
+        });
+    }
+}
+
+#endif // PARALLEL_H
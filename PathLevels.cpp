@@ -0,0 +1,232 @@
+#include "PathLevels.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <QPair>
+
+const float PathLevels::FINEST_TOLERANCE = 0.01f;
+
+void PathLevels::Build(const QVector<Atom*>& atoms, AtomTrajectory trajectory)
+{
+    TRACE_SCOPE("PathLevels::Build");
+    m_Atoms = atoms.length();
+    m_Indices.clear();
+    m_Starts.clear();
+    m_Tolerances.clear();
+
+    // The frames kept for each atom at each candidate level, atom by atom.
+    QVector<QVector<int> > kept(m_Atoms*CANDIDATE_LEVELS);
+    QVector<int>* keptData = kept.data();
+    Atom* const* atomData = atoms.constData();
+    Parallel::For(m_Atoms, MIN_ATOMS_PER_THREAD,
+                  [keptData, atomData, trajectory](int, int first, int last)
+    {
+        QVector<int> frames;
+        for (int i = first; i < last; ++i)
+        {
+            const QVector<QVector3D>& positions = (atomData[i]->*trajectory)();
+            frames.resize(positions.length());
+            for (int j = 0; j < frames.length(); ++j)
+            {
+                frames[j] = j;
+            }
+            float tolerance = FINEST_TOLERANCE;
+            for (int level = 0; level < CANDIDATE_LEVELS; ++level)
+            {
+                QVector<int>& levelKept = keptData[i*CANDIDATE_LEVELS + level];
+                simplify(positions.constData(), frames, tolerance/2, levelKept);
+                frames = levelKept;
+                tolerance *= 2;
+            }
+        }
+    });
+
+    qint64 previous = 0;
+    for (int i = 0; i < m_Atoms; ++i)
+    {
+        previous += atomData[i]->GetTrajectoryRef().length();
+    }
+    QVector<int> candidates;
+    float tolerance = FINEST_TOLERANCE;
+    for (int level = 0; level < CANDIDATE_LEVELS; ++level)
+    {
+        qint64 vertices = 0;
+        for (int i = 0; i < m_Atoms; ++i)
+        {
+            vertices += kept[i*CANDIDATE_LEVELS + level].length();
+        }
+        if (vertices > 0 && 2*vertices <= previous)
+        {
+            candidates.append(level);
+            m_Tolerances.append(tolerance);
+            previous = vertices;
+        }
+        tolerance *= 2;
+    }
+
+    int stride = m_Atoms + 1;
+    m_Starts.resize(candidates.length()*stride);
+    int total = 0;
+    for (int level = 0; level < candidates.length(); ++level)
+    {
+        for (int i = 0; i < m_Atoms; ++i)
+        {
+            m_Starts[level*stride + i] = total;
+            total += kept[i*CANDIDATE_LEVELS + candidates[level]].length();
+        }
+        m_Starts[level*stride + m_Atoms] = total;
+    }
+
+    m_Indices.resize(total);
+    quint32* indices = m_Indices.data();
+    const int* starts = m_Starts.constData();
+    const int* candidateData = candidates.constData();
+    int levels = candidates.length();
+    Parallel::For(m_Atoms, MIN_ATOMS_PER_THREAD,
+                  [=](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            quint32 base = (quint32)i*atomData[i]->GetTrajectoryRef().length();
+            for (int level = 0; level < levels; ++level)
+            {
+                const QVector<int>& levelKept
+                        = keptData[i*CANDIDATE_LEVELS + candidateData[level]];
+                quint32* out = indices + starts[level*stride + i];
+                for (int j = 0; j < levelKept.length(); ++j)
+                {
+                    out[j] = base + levelKept[j];
+                }
+            }
+        }
+    });
+}
+
+int PathLevels::GetAtoms() const
+{
+    return m_Atoms;
+}
+
+int PathLevels::GetLevels() const
+{
+    return m_Tolerances.length();
+}
+
+float PathLevels::GetTolerance(int level) const
+{
+    return m_Tolerances[level];
+}
+
+int PathLevels::ChooseLevel(float maxError) const
+{
+    for (int level = GetLevels() - 1; level >= 0; --level)
+    {
+        if (GetTolerance(level) <= maxError)
+        {
+            return level;
+        }
+    }
+    return -1;
+}
+
+int PathLevels::GetFirst(int level, int atom) const
+{
+    return m_Starts[level*(m_Atoms + 1) + atom];
+}
+
+int PathLevels::GetCount(int level, int atom) const
+{
+    return GetFirst(level, atom + 1) - GetFirst(level, atom);
+}
+
+int PathLevels::GetVertices(int level) const
+{
+    return GetFirst(level, m_Atoms) - GetFirst(level, 0);
+}
+
+int PathLevels::GetIndexCount() const
+{
+    return m_Starts.isEmpty() ? 0 : m_Starts.last();
+}
+
+const QVector<quint32>& PathLevels::GetIndices() const
+{
+    return m_Indices;
+}
+
+void PathLevels::ClearIndices()
+{
+    m_Indices.clear();
+    m_Indices.squeeze();
+}
+
+qint64 PathLevels::GetBytes() const
+{
+    return m_Indices.capacity()*sizeof(quint32) + m_Starts.capacity()*sizeof(int)
+            + m_Tolerances.capacity()*sizeof(float);
+}
+
+void PathLevels::simplify(const QVector3D* positions,
+                          const QVector<int>& frames,
+                          float tolerance,
+                          QVector<int>& kept)
+{
+    kept.clear();
+    int count = frames.length();
+    if (count <= 2)
+    {
+        kept = frames;
+        return;
+    }
+
+    QVector<bool> keep(count, false);
+    keep[0] = true;
+    keep[count - 1] = true;
+    QVector<QPair<int, int> > spans;
+    spans.append(qMakePair(0, count - 1));
+    while (!spans.isEmpty())
+    {
+        QPair<int, int> span = spans.takeLast();
+        const QVector3D& start = positions[frames[span.first]];
+        const QVector3D& end = positions[frames[span.second]];
+        float furthest = tolerance;
+        int split = -1;
+        for (int i = span.first + 1; i < span.second; ++i)
+        {
+            float distance = segmentDistance(positions[frames[i]], start, end);
+            if (distance > furthest)
+            {
+                furthest = distance;
+                split = i;
+            }
+        }
+        if (split >= 0)
+        {
+            keep[split] = true;
+            spans.append(qMakePair(span.first, split));
+            spans.append(qMakePair(split, span.second));
+        }
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (keep[i])
+        {
+            kept.append(frames[i]);
+        }
+    }
+}
+
+float PathLevels::segmentDistance(const QVector3D& point,
+                                  const QVector3D& start,
+                                  const QVector3D& end)
+{
+    QVector3D segment = end - start;
+    float lengthSquared = segment.lengthSquared();
+    if (lengthSquared == 0)
+    {
+        return (point - start).length();
+    }
+    float t = QVector3D::dotProduct(point - start, segment)/lengthSquared;
+    t = qBound(0.0f, t, 1.0f);
+    return (point - (start + t*segment)).length();
+}
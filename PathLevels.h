@@ -0,0 +1,190 @@
+/**
+ * @file PathLevels.h
+ * @date 19 Oct 2026
+ * @see MyOpenGLWidget.h
+ * @see VertexFiller.h
+ * @brief This class builds simplified versions of the atom paths, used to
+ * draw long trajectories with fewer vertices when zoomed out.
+ *
+ * Each level keeps a subset of the frames of every path, chosen by the
+ * Douglas-Peucker algorithm so that no dropped position is further than the
+ * tolerance of the level from the simplified path. Candidate levels double
+ * the tolerance each time, and each is simplified from the one before with
+ * half its own tolerance, so the errors add up to less than the tolerance.
+ * A candidate is only kept if it has at most half the vertices of the last
+ * level kept, or of the full paths, so noisy paths which barely simplify do
+ * not cost more memory than drawing them in full, and all the levels
+ * together hold fewer indices than the full paths have vertices.
+ *
+ * The kept frames are stored as indices into the trajectory buffer, laid out
+ * atom by atom with every frame of an atom stored consecutively, so a level
+ * can be drawn as an index buffer over the unchanged trajectory buffer.
+ */
+
+#ifndef PATHLEVELS_H
+#define PATHLEVELS_H
+
+#include "Atom.h"
+#include <QVector>
+#include <QVector3D>
+
+class PathLevels
+{
+public:
+    /**
+     * @brief Pointer to an @Atom getter for a layer of positions, such as
+     * the trajectory or the aligned trajectory.
+     */
+    typedef QVector<QVector3D>& (Atom::*AtomTrajectory)();
+
+    /**
+     * @brief Builds every level for a set of atoms, splitting the atoms
+     * across the global thread pool.
+     * @param atoms The atoms, in the order of the trajectory buffer. Every
+     * atom must have the same number of frames.
+     * @param trajectory The @Atom getter for the positions drawn.
+     */
+    void Build(const QVector<Atom*>& atoms,
+               AtomTrajectory trajectory = &Atom::GetTrajectoryRef);
+
+    /**
+     * @brief Returns the number of atoms.
+     * @return The number of atoms.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the number of levels.
+     * @return The number of levels, or zero before Build().
+     */
+    int GetLevels() const;
+
+    /**
+     * @brief Returns the largest distance of a dropped position from the
+     * paths of a level.
+     * @param level The level.
+     * @return The tolerance, in nm.
+     */
+    float GetTolerance(int level) const;
+
+    /**
+     * @brief Chooses the coarsest level whose tolerance is within an error.
+     * @param maxError The largest acceptable error, in nm.
+     * @return The level, or -1 if every level is too coarse and the full
+     * paths are to be drawn.
+     */
+    int ChooseLevel(float maxError) const;
+
+    /**
+     * @brief Returns where the path of an atom starts within the indices.
+     * @param level The level.
+     * @param atom The index of the atom.
+     * @return The index in GetIndices() of the first kept frame of the atom.
+     */
+    int GetFirst(int level, int atom) const;
+
+    /**
+     * @brief Returns the number of frames kept for an atom.
+     * @param level The level.
+     * @param atom The index of the atom.
+     * @return The number of frames, at least two for paths with two or more
+     * frames.
+     */
+    int GetCount(int level, int atom) const;
+
+    /**
+     * @brief Returns the number of frames kept for every atom.
+     * @param level The level.
+     * @return The number of indices in the level.
+     */
+    int GetVertices(int level) const;
+
+    /**
+     * @brief Returns the number of indices of every level together.
+     * @return The number of indices, which is kept by ClearIndices().
+     */
+    int GetIndexCount() const;
+
+    /**
+     * @brief Returns the indices of every level, level by level and atom by
+     * atom, as vertex indices into the trajectory buffer.
+     * @return The indices.
+     */
+    const QVector<quint32>& GetIndices() const;
+
+    /**
+     * @brief Frees the indices, keeping where each path starts, once they
+     * have been uploaded.
+     */
+    void ClearIndices();
+
+    /**
+     * @brief Returns the number of bytes held.
+     * @return The number of bytes.
+     */
+    qint64 GetBytes() const;
+
+    /**
+     * @brief The number of candidate levels.
+     */
+    static const int CANDIDATE_LEVELS = 10;
+
+    /**
+     * @brief The tolerance of the finest candidate level, in nm.
+     */
+    static const float FINEST_TOLERANCE;
+
+private:
+    /**
+     * @brief Simplifies a path, keeping its first and last positions.
+     * @param positions The positions of every frame of the path.
+     * @param frames The frames to simplify, in increasing order.
+     * @param tolerance The largest distance of a dropped position from the
+     * simplified path, in nm.
+     * @param kept Set to the frames kept, in increasing order.
+     */
+    static void simplify(const QVector3D* positions,
+                         const QVector<int>& frames,
+                         float tolerance,
+                         QVector<int>& kept);
+
+    /**
+     * @brief Returns the distance of a point from a line segment.
+     * @param point The point.
+     * @param start The start of the segment.
+     * @param end The end of the segment.
+     * @return The distance.
+     */
+    static float segmentDistance(const QVector3D& point,
+                                 const QVector3D& start,
+                                 const QVector3D& end);
+
+    /**
+     * @brief The number of atoms.
+     */
+    int m_Atoms = 0;
+
+    /**
+     * @brief The indices of every level, level by level and atom by atom.
+     */
+    QVector<quint32> m_Indices;
+
+    /**
+     * @brief The tolerance of each level kept, in nm.
+     */
+    QVector<float> m_Tolerances;
+
+    /**
+     * @brief For each level, the index in m_Indices of the first kept frame
+     * of each atom, followed by the end of the level.
+     */
+    QVector<int> m_Starts;
+
+    /**
+     * @brief The smallest number of atoms worth handing to a thread when
+     * building the levels.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 16;
+};
+
+#endif // PATHLEVELS_H
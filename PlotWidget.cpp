@@ -0,0 +1,86 @@
+#include "PlotWidget.h"
+#include <QPainter>
+#include <QPolygonF>
+
+void PlotWidget::SetSeries(QVector<QPointF> points, QString xLabel,
+                           QString yLabel)
+{
+    m_Points = points;
+    m_XLabel = xLabel;
+    m_YLabel = yLabel;
+    update();
+}
+
+void PlotWidget::SetMarker(int index)
+{
+    if (index != m_Marker)
+    {
+        m_Marker = index;
+        update();
+    }
+}
+
+PlotWidget::PlotWidget(QWidget* parent) : QWidget(parent)
+{
+    setMinimumSize(4*MARGIN, 3*MARGIN);
+}
+
+void PlotWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    painter.eraseRect(this->rect());
+    if (m_Points.length() < 2)
+    {
+        return;
+    }
+
+    float minX = m_Points.first().x();
+    float maxX = m_Points.last().x();
+    float minY = 0;
+    float maxY = 0;
+    for (int i = 0; i < m_Points.length(); ++i)
+    {
+        minY = qMin(minY, (float)m_Points[i].y());
+        maxY = qMax(maxY, (float)m_Points[i].y());
+    }
+    if (maxX <= minX || maxY <= minY)
+    {
+        return;
+    }
+
+    QRectF area(MARGIN, MARGIN/2, this->width() - 3*MARGIN/2,
+                this->height() - 3*MARGIN/2);
+    painter.setPen(QColor(Qt::black));
+    painter.drawLine(area.bottomLeft(), area.bottomRight());
+    painter.drawLine(area.bottomLeft(), area.topLeft());
+    painter.drawText(QRectF(area.left(), area.bottom(), area.width(), MARGIN),
+                     Qt::AlignHCenter | Qt::AlignVCenter, m_XLabel);
+    painter.drawText(QRectF(area.left(), area.bottom(), area.width(), MARGIN),
+                     Qt::AlignLeft | Qt::AlignTop, QString::number(minX));
+    painter.drawText(QRectF(area.left(), area.bottom(), area.width(), MARGIN),
+                     Qt::AlignRight | Qt::AlignTop, QString::number(maxX));
+    painter.drawText(QRectF(0, area.top(), MARGIN, area.height()),
+                     Qt::AlignHCenter | Qt::AlignVCenter, m_YLabel);
+    painter.drawText(QRectF(0, area.top(), MARGIN - 2, area.height()),
+                     Qt::AlignRight | Qt::AlignTop, QString::number(maxY));
+    painter.drawText(QRectF(0, area.top(), MARGIN - 2, area.height()),
+                     Qt::AlignRight | Qt::AlignBottom, QString::number(minY));
+
+    QPolygonF line;
+    for (int i = 0; i < m_Points.length(); ++i)
+    {
+        float x = (m_Points[i].x() - minX)/(maxX - minX);
+        float y = (m_Points[i].y() - minY)/(maxY - minY);
+        line.append(QPointF(area.left() + x*area.width(),
+                            area.bottom() - y*area.height()));
+    }
+    if (m_Marker >= 0 && m_Marker < m_Points.length())
+    {
+        painter.setPen(QColor(Qt::red));
+        painter.drawLine(QPointF(line[m_Marker].x(), area.top()),
+                         QPointF(line[m_Marker].x(), area.bottom()));
+    }
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(QColor(Qt::darkBlue), 1.5));
+    painter.drawPolyline(line);
+}
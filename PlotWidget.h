@@ -0,0 +1,81 @@
+/**
+ * @file PlotWidget.h
+ * @date 19 Oct 2026
+ * @see RadialDistribution.h
+ * @brief This class provides a widget that draws a line plot of one series
+ * of values, for showing the results of analyses in their own window.
+ *
+ * The axes are scaled to the range of the values, with the vertical axis
+ * always including zero, and are labelled with their limits. One point can
+ * be marked by a vertical line, such as the current frame of a timeline.
+ */
+
+#ifndef PLOTWIDGET_H
+#define PLOTWIDGET_H
+
+#include <QPointF>
+#include <QString>
+#include <QVector>
+#include <QWidget>
+
+class PlotWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Sets the series to be drawn.
+     * @param points The points of the series, in order of increasing x.
+     * @param xLabel The label of the horizontal axis.
+     * @param yLabel The label of the vertical axis.
+     */
+    void SetSeries(QVector<QPointF> points, QString xLabel, QString yLabel);
+
+    /**
+     * @brief Constructor
+     * @param parent The parent QWidget of this widget.
+     */
+    PlotWidget(QWidget* parent);
+
+public slots:
+    /**
+     * @brief Marks one point of the series with a vertical line.
+     * @param index The index of the point, or -1 to mark none.
+     */
+    void SetMarker(int index);
+
+protected:
+    /**
+     * @brief Function for painting the axes and series to the widget.
+     * @param event The QPaintEvent that triggered painting.
+     */
+    void paintEvent(QPaintEvent *event);
+
+private:
+    /**
+     * @brief The index of the marked point, or -1 if none is marked.
+     */
+    int m_Marker = -1;
+
+    /**
+     * @brief The points of the series.
+     */
+    QVector<QPointF> m_Points;
+
+    /**
+     * @brief The label of the horizontal axis.
+     */
+    QString m_XLabel;
+
+    /**
+     * @brief The label of the vertical axis.
+     */
+    QString m_YLabel;
+
+    /**
+     * @brief The space left around the axes for their labels, in pixels.
+     */
+    const int MARGIN = 40;
+};
+
+#endif // PLOTWIDGET_H
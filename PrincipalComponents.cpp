@@ -0,0 +1,638 @@
+#include "PrincipalComponents.h"
+#include "Parallel.h"
+#include "SymmetricEigen.h"
+#include "Trace.h"
+#include <QFile>
+#include <QTextStream>
+#include <QtMath>
+#include <limits>
+
+const qint64 PrincipalComponents::DEFAULT_MEMORY_BUDGET;
+const double PrincipalComponents::TOLERANCE = 1e-4;
+
+void PrincipalComponents::SetComponents(int count)
+{
+    m_Wanted = qMax(1, count);
+}
+
+void PrincipalComponents::SetMemoryBudget(qint64 bytes)
+{
+    m_MemoryBudget = bytes > 0 ? bytes : DEFAULT_MEMORY_BUDGET;
+}
+
+bool PrincipalComponents::Calculate(const QVector<Atom*>& atoms,
+                                    const Bitset& selection,
+                                    const QVector<Superposition::Fit>& fits)
+{
+    TRACE_SCOPE("PrincipalComponents::Calculate");
+    Clear();
+    m_AtomCount = atoms.length();
+    for (int index : selection.ToIndices())
+    {
+        if (index < atoms.length())
+        {
+            m_Indices.append(index);
+        }
+    }
+    if (m_Indices.length() < 2)
+    {
+        m_Error = "The selection must choose at least two atoms.";
+        return false;
+    }
+
+    int frames = atoms[m_Indices[0]]->GetTrajectoryRef().length();
+    if (frames < 2)
+    {
+        m_Error = "At least two frames are needed to find principal components.";
+        return false;
+    }
+    if (!fits.isEmpty() && fits.length() != frames)
+    {
+        m_Error = "The fits do not match the frames loaded.";
+        return false;
+    }
+
+    // The vectors iterated, their product with the covariance, the Ritz
+    // vectors and their product, and one partial product per thread for the
+    // matrix-free multiplication.
+    int dimension = 3*m_Indices.length();
+    int columns = qMin(m_Wanted + EXTRA_VECTORS, dimension);
+    int threads = Parallel::ChunkCount(frames, MIN_FRAMES_PER_THREAD);
+    qint64 vectorBytes = (qint64)dimension*columns*sizeof(double)*(4 + threads);
+    qint64 frameBytes = (qint64)dimension*sizeof(float);
+    qint64 available = qMin(m_MemoryBudget - vectorBytes,
+                            (qint64)std::numeric_limits<int>::max());
+    qint64 maxFrames = available > 0 ? available/frameBytes : 0;
+    if (maxFrames < 2)
+    {
+        m_Error = QString("The memory budget is too small for %1 atoms.")
+                .arg(m_Indices.length());
+        m_Indices.clear();
+        return false;
+    }
+    m_Dimension = dimension;
+    m_FrameStride = (int)((frames + maxFrames - 1)/maxFrames);
+    m_Frames = (frames + m_FrameStride - 1)/m_FrameStride;
+
+    // Gather the fitted coordinates of each frame used into one row.
+    m_Coordinates.resize(m_Frames*dimension);
+    float* coordinates = m_Coordinates.data();
+    Atom* const* atomData = atoms.constData();
+    const int* indices = m_Indices.constData();
+    const Superposition::Fit* fitData = fits.isEmpty() ? nullptr : fits.constData();
+    int count = m_Indices.length();
+    int stride = m_FrameStride;
+    Parallel::For(m_Frames, MIN_FRAMES_PER_THREAD,
+                  [=](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            int frame = i*stride;
+            float* row = coordinates + (qint64)i*dimension;
+            for (int j = 0; j < count; ++j)
+            {
+                QVector3D position = atomData[indices[j]]->GetTrajectoryRef()[frame];
+                if (fitData)
+                {
+                    position = fitData[frame].Apply(position);
+                }
+                row[3*j] = position.x();
+                row[3*j + 1] = position.y();
+                row[3*j + 2] = position.z();
+            }
+        }
+    });
+
+    // The mean of each coordinate, summed by each thread over its own frames
+    // before the partial sums are added together.
+    int chunks = Parallel::ChunkCount(m_Frames, MIN_FRAMES_PER_THREAD);
+    QVector<double> partial(chunks*dimension, 0);
+    double* partialData = partial.data();
+    Parallel::For(m_Frames, MIN_FRAMES_PER_THREAD,
+                  [=](int chunk, int first, int last)
+    {
+        double* sum = partialData + (qint64)chunk*dimension;
+        for (int i = first; i < last; ++i)
+        {
+            const float* row = coordinates + (qint64)i*dimension;
+            for (int j = 0; j < dimension; ++j)
+            {
+                sum[j] += row[j];
+            }
+        }
+    });
+    QVector<float> mean(dimension, 0);
+    for (int j = 0; j < dimension; ++j)
+    {
+        double sum = 0;
+        for (int chunk = 0; chunk < chunks; ++chunk)
+        {
+            sum += partialData[(qint64)chunk*dimension + j];
+        }
+        mean[j] = (float)(sum/m_Frames);
+    }
+    partial = QVector<double>();
+
+    QVector<double> squares(chunks, 0);
+    double* squareData = squares.data();
+    const float* meanData = mean.constData();
+    Parallel::For(m_Frames, MIN_FRAMES_PER_THREAD,
+                  [=](int chunk, int first, int last)
+    {
+        double sum = 0;
+        for (int i = first; i < last; ++i)
+        {
+            float* row = coordinates + (qint64)i*dimension;
+            for (int j = 0; j < dimension; ++j)
+            {
+                row[j] -= meanData[j];
+                sum += (double)row[j]*row[j];
+            }
+        }
+        squareData[chunk] = sum;
+    });
+    double total = 0;
+    for (double sum : squares)
+    {
+        total += sum;
+    }
+    m_TotalVariance = (float)(total/m_Frames);
+
+    // Forming the covariance costs about as much as dimension/(4 columns)
+    // products going through every frame, which is often more than the
+    // whole iteration needs. It is only formed once the iteration has cost that
+    // much, if it fits within the budget and a product by it is cheaper
+    // than going through every frame.
+    qint64 covarianceBytes = (qint64)dimension*dimension*sizeof(double);
+    bool covarianceFits = (qint64)m_Frames*frameBytes + covarianceBytes
+            + vectorBytes <= m_MemoryBudget
+            && covarianceBytes <= std::numeric_limits<int>::max()
+            && dimension < 2*m_Frames;
+    int formAfter = dimension/(4*columns);
+
+    // Subspace iteration from a fixed pseudo-random start, so that repeated
+    // calculations agree.
+    QVector<double> vectors(dimension*columns);
+    quint32 state = 12345;
+    for (int i = 0; i < vectors.length(); ++i)
+    {
+        state = state*1664525u + 1013904223u;
+        vectors[i] = (state >> 8)/(double)(1 << 24) - 0.5;
+    }
+    orthonormalise(vectors, dimension, columns);
+
+    int wanted = qMin(m_Wanted, dimension);
+    QVector<double> product(dimension*columns);
+    QVector<double> ritz(dimension*columns);
+    QVector<double> ritzProduct(dimension*columns);
+    QVector<double> small(columns*columns);
+    QVector<double> rotation(columns*columns);
+    QVector<double> values(columns);
+    for (m_Iterations = 1; m_Iterations <= MAX_ITERATIONS; ++m_Iterations)
+    {
+        if (covarianceFits && m_Covariance.isEmpty() && m_Iterations > formAfter)
+        {
+            formCovariance();
+        }
+        multiply(vectors, columns, product);
+
+        // The covariance within the span of the vectors, whose eigenvectors
+        // rotate the vectors onto the best approximations to the components.
+        for (int a = 0; a < columns; ++a)
+        {
+            for (int b = a; b < columns; ++b)
+            {
+                double sum = 0;
+                for (int r = 0; r < dimension; ++r)
+                {
+                    sum += vectors[r*columns + a]*product[r*columns + b]
+                         + vectors[r*columns + b]*product[r*columns + a];
+                }
+                small[a*columns + b] = sum/2;
+                small[b*columns + a] = sum/2;
+            }
+        }
+        SymmetricEigen::Solve(small.data(), columns, values.data(), rotation.data());
+
+        for (int r = 0; r < dimension; ++r)
+        {
+            for (int c = 0; c < columns; ++c)
+            {
+                double vector = 0;
+                double image = 0;
+                for (int a = 0; a < columns; ++a)
+                {
+                    vector += vectors[r*columns + a]*rotation[a*columns + c];
+                    image += product[r*columns + a]*rotation[a*columns + c];
+                }
+                ritz[r*columns + c] = vector;
+                ritzProduct[r*columns + c] = image;
+            }
+        }
+
+        bool converged = true;
+        double scale = qMax(values[0], std::numeric_limits<double>::min());
+        for (int c = 0; c < wanted && converged; ++c)
+        {
+            double residual = 0;
+            for (int r = 0; r < dimension; ++r)
+            {
+                double difference = ritzProduct[r*columns + c]
+                        - values[c]*ritz[r*columns + c];
+                residual += difference*difference;
+            }
+            converged = qSqrt(residual) <= TOLERANCE*scale;
+        }
+        if (converged || m_Iterations == MAX_ITERATIONS)
+        {
+            break;
+        }
+        vectors.swap(ritzProduct);
+        orthonormalise(vectors, dimension, columns);
+    }
+    m_Iterations = qMin(m_Iterations, MAX_ITERATIONS);
+    m_MatrixFree = m_Covariance.isEmpty();
+    m_Covariance = QVector<double>();
+
+    // Keep the wanted components, each signed so that its largest element
+    // is positive.
+    m_Variances.resize(wanted);
+    m_Vectors.resize(dimension*wanted);
+    for (int c = 0; c < wanted; ++c)
+    {
+        m_Variances[c] = (float)qMax(0.0, values[c]);
+        int largest = 0;
+        for (int r = 1; r < dimension; ++r)
+        {
+            if (qAbs(ritz[r*columns + c]) > qAbs(ritz[largest*columns + c]))
+            {
+                largest = r;
+            }
+        }
+        double sign = ritz[largest*columns + c] < 0 ? -1 : 1;
+        for (int r = 0; r < dimension; ++r)
+        {
+            m_Vectors[r*wanted + c] = (float)(sign*ritz[r*columns + c]);
+        }
+    }
+
+    m_Projections.resize(m_Frames*wanted);
+    float* projections = m_Projections.data();
+    const float* componentData = m_Vectors.constData();
+    Parallel::For(m_Frames, MIN_FRAMES_PER_THREAD,
+                  [=](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            const float* row = coordinates + (qint64)i*dimension;
+            for (int c = 0; c < wanted; ++c)
+            {
+                double sum = 0;
+                for (int j = 0; j < dimension; ++j)
+                {
+                    sum += (double)row[j]*componentData[j*wanted + c];
+                }
+                projections[i*wanted + c] = (float)sum;
+            }
+        }
+    });
+    m_Coordinates = QVector<float>();
+    return true;
+}
+
+void PrincipalComponents::Clear()
+{
+    m_AtomCount = 0;
+    m_Coordinates = QVector<float>();
+    m_Covariance = QVector<double>();
+    m_Dimension = 0;
+    m_Error.clear();
+    m_FrameStride = 1;
+    m_Frames = 0;
+    m_Indices.clear();
+    m_Iterations = 0;
+    m_MatrixFree = false;
+    m_Projections.clear();
+    m_TotalVariance = 0;
+    m_Variances.clear();
+    m_Vectors.clear();
+}
+
+QString PrincipalComponents::GetError() const
+{
+    return m_Error;
+}
+
+int PrincipalComponents::GetComponents() const
+{
+    return m_Variances.length();
+}
+
+int PrincipalComponents::GetFrameStride() const
+{
+    return m_FrameStride;
+}
+
+int PrincipalComponents::GetIterations() const
+{
+    return m_Iterations;
+}
+
+bool PrincipalComponents::IsMatrixFree() const
+{
+    return m_MatrixFree;
+}
+
+float PrincipalComponents::GetVariance(int component) const
+{
+    return m_Variances.value(component);
+}
+
+float PrincipalComponents::GetTotalVariance() const
+{
+    return m_TotalVariance;
+}
+
+QVector<float> PrincipalComponents::GetProjection(int component) const
+{
+    QVector<float> projection;
+    int components = m_Variances.length();
+    if (component < 0 || component >= components)
+    {
+        return projection;
+    }
+    projection.resize(m_Frames);
+    for (int i = 0; i < m_Frames; ++i)
+    {
+        projection[i] = m_Projections[i*components + component];
+    }
+    return projection;
+}
+
+float PrincipalComponents::StoreAmplitudes(const QVector<Atom*>& atoms,
+                                           int component) const
+{
+    for (Atom* atom : atoms)
+    {
+        atom->GetModeAmplitudeRef().fill(0, 1);
+    }
+    int components = m_Variances.length();
+    if (component < 0 || component >= components || atoms.length() != m_AtomCount)
+    {
+        return 0;
+    }
+
+    // The displacement of each coordinate along a component has the
+    // standard deviation of the component times the element of its vector.
+    float deviation = qSqrt(m_Variances[component]);
+    float largest = 0;
+    for (int i = 0; i < m_Indices.length(); ++i)
+    {
+        float sum = 0;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            float element = m_Vectors[(3*i + axis)*components + component];
+            sum += element*element;
+        }
+        float amplitude = deviation*qSqrt(sum);
+        atoms[m_Indices[i]]->GetModeAmplitudeRef().fill(amplitude, 1);
+        largest = qMax(largest, amplitude);
+    }
+    return largest;
+}
+
+bool PrincipalComponents::WriteCsv(const QString& filePath)
+{
+    m_Error.clear();
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        m_Error = "Could not open " + filePath + " for writing.";
+        return false;
+    }
+
+    QTextStream out(&file);
+    int components = m_Variances.length();
+    out << "# variance";
+    for (int c = 0; c < components; ++c)
+    {
+        out << " " << m_Variances[c];
+    }
+    out << " of total " << m_TotalVariance << "\n";
+    out << "frame";
+    for (int c = 0; c < components; ++c)
+    {
+        out << ",pc" << c + 1;
+    }
+    out << "\n";
+    for (int i = 0; i < m_Frames; ++i)
+    {
+        out << i*m_FrameStride;
+        for (int c = 0; c < components; ++c)
+        {
+            out << "," << m_Projections[i*components + c];
+        }
+        out << "\n";
+    }
+    out.flush();
+    if (out.status() != QTextStream::Ok)
+    {
+        m_Error = "Failed while writing " + filePath + ".";
+        return false;
+    }
+    return true;
+}
+
+void PrincipalComponents::multiply(const QVector<double>& vectors, int columns,
+                                   QVector<double>& product) const
+{
+    TRACE_SCOPE("PrincipalComponents::multiply");
+    int dimension = m_Dimension;
+    const double* vectorData = vectors.constData();
+    double* productData = product.data();
+
+    if (!m_Covariance.isEmpty())
+    {
+        const double* covariance = m_Covariance.constData();
+        Parallel::For(dimension, MIN_ROWS_PER_THREAD,
+                      [=](int, int first, int last)
+        {
+            for (int r = first; r < last; ++r)
+            {
+                const double* row = covariance + (qint64)r*dimension;
+                double* result = productData + r*columns;
+                for (int c = 0; c < columns; ++c)
+                {
+                    result[c] = 0;
+                }
+                for (int k = 0; k < dimension; ++k)
+                {
+                    double element = row[k];
+                    const double* vector = vectorData + k*columns;
+                    for (int c = 0; c < columns; ++c)
+                    {
+                        result[c] += element*vector[c];
+                    }
+                }
+            }
+        });
+        return;
+    }
+
+    // Without the covariance, the product is X^T (X V)/F for the frames X.
+    // Each frame is projected onto the vectors and its outer product with
+    // the projection is summed into the partial product of its thread, so
+    // the coordinates are read once and in order.
+    const float* coordinates = m_Coordinates.constData();
+    int chunks = Parallel::ChunkCount(m_Frames, MIN_FRAMES_PER_THREAD);
+    QVector<double> partial(chunks*dimension*columns, 0);
+    double* partialData = partial.data();
+    Parallel::For(m_Frames, MIN_FRAMES_PER_THREAD,
+                  [=](int chunk, int first, int last)
+    {
+        double* sum = partialData + (qint64)chunk*dimension*columns;
+        QVector<double> projection(columns);
+        double* p = projection.data();
+        for (int i = first; i < last; ++i)
+        {
+            const float* row = coordinates + (qint64)i*dimension;
+            for (int c = 0; c < columns; ++c)
+            {
+                p[c] = 0;
+            }
+            for (int j = 0; j < dimension; ++j)
+            {
+                double x = row[j];
+                const double* vector = vectorData + j*columns;
+                for (int c = 0; c < columns; ++c)
+                {
+                    p[c] += x*vector[c];
+                }
+            }
+            for (int j = 0; j < dimension; ++j)
+            {
+                double x = row[j];
+                double* result = sum + j*columns;
+                for (int c = 0; c < columns; ++c)
+                {
+                    result[c] += x*p[c];
+                }
+            }
+        }
+    });
+
+    int frames = m_Frames;
+    Parallel::For(dimension, MIN_ROWS_PER_THREAD,
+                  [=](int, int first, int last)
+    {
+        for (int index = first*columns; index < last*columns; ++index)
+        {
+            double sum = 0;
+            for (int chunk = 0; chunk < chunks; ++chunk)
+            {
+                sum += partialData[(qint64)chunk*dimension*columns + index];
+            }
+            productData[index] = sum/frames;
+        }
+    });
+}
+
+void PrincipalComponents::formCovariance()
+{
+    TRACE_SCOPE("PrincipalComponents::formCovariance");
+    int dimension = m_Dimension;
+    int blocks = (dimension + BLOCK_SIZE - 1)/BLOCK_SIZE;
+    QVector<int> rowBlocks;
+    QVector<int> columnBlocks;
+    for (int i = 0; i < blocks; ++i)
+    {
+        for (int j = i; j < blocks; ++j)
+        {
+            rowBlocks.append(i);
+            columnBlocks.append(j);
+        }
+    }
+
+    // Each task sums the products of one block of rows with one block of
+    // columns over every frame, in a block small enough to stay in cache,
+    // and writes it and its mirror image across the diagonal.
+    m_Covariance.fill(0, dimension*dimension);
+    double* covariance = m_Covariance.data();
+    const float* coordinates = m_Coordinates.constData();
+    const int* rowData = rowBlocks.constData();
+    const int* columnData = columnBlocks.constData();
+    int frames = m_Frames;
+    Parallel::For(rowBlocks.length(), 1, [=](int, int first, int last)
+    {
+        QVector<double> block(BLOCK_SIZE*BLOCK_SIZE);
+        double* sum = block.data();
+        for (int task = first; task < last; ++task)
+        {
+            int rowStart = rowData[task]*BLOCK_SIZE;
+            int rowEnd = qMin(rowStart + BLOCK_SIZE, dimension);
+            int columnStart = columnData[task]*BLOCK_SIZE;
+            int columnEnd = qMin(columnStart + BLOCK_SIZE, dimension);
+            int width = columnEnd - columnStart;
+            block.fill(0);
+            for (int i = 0; i < frames; ++i)
+            {
+                const float* row = coordinates + (qint64)i*dimension;
+                for (int r = rowStart; r < rowEnd; ++r)
+                {
+                    double x = row[r];
+                    double* result = sum + (r - rowStart)*BLOCK_SIZE;
+                    const float* column = row + columnStart;
+                    for (int c = 0; c < width; ++c)
+                    {
+                        result[c] += x*column[c];
+                    }
+                }
+            }
+            for (int r = rowStart; r < rowEnd; ++r)
+            {
+                for (int c = columnStart; c < columnEnd; ++c)
+                {
+                    double value = sum[(r - rowStart)*BLOCK_SIZE + c - columnStart]/frames;
+                    covariance[(qint64)r*dimension + c] = value;
+                    covariance[(qint64)c*dimension + r] = value;
+                }
+            }
+        }
+    });
+}
+
+void PrincipalComponents::orthonormalise(QVector<double>& vectors, int rows,
+                                         int columns)
+{
+    double* data = vectors.data();
+    for (int c = 0; c < columns; ++c)
+    {
+        double original = 0;
+        for (int r = 0; r < rows; ++r)
+        {
+            original += data[r*columns + c]*data[r*columns + c];
+        }
+        for (int previous = 0; previous < c; ++previous)
+        {
+            double dot = 0;
+            for (int r = 0; r < rows; ++r)
+            {
+                dot += data[r*columns + c]*data[r*columns + previous];
+            }
+            for (int r = 0; r < rows; ++r)
+            {
+                data[r*columns + c] -= dot*data[r*columns + previous];
+            }
+        }
+        double norm = 0;
+        for (int r = 0; r < rows; ++r)
+        {
+            norm += data[r*columns + c]*data[r*columns + c];
+        }
+        double scale = norm > 1e-20*original && norm > 0 ? 1/qSqrt(norm) : 0;
+        for (int r = 0; r < rows; ++r)
+        {
+            data[r*columns + c] *= scale;
+        }
+    }
+}
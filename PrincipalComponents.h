@@ -0,0 +1,306 @@
+/**
+ * @file PrincipalComponents.h
+ * @date 19 Oct 2026
+ * @see Superposition.h
+ * @see SymmetricEigen.h
+ * @brief This class finds the principal components of the motion of a
+ * selection of atoms, the directions in which their positions vary most
+ * over a trajectory.
+ *
+ * Each frame is fitted onto the reference frame, and the 3N fitted
+ * coordinates of the N selected atoms are gathered, frame by frame, into
+ * one matrix about their mean. The largest eigenvectors of the 3N x 3N
+ * covariance of the coordinates are found by subspace iteration: a few more
+ * vectors than are wanted are repeatedly multiplied by the covariance and
+ * orthonormalised, and the small matrix of the covariance within their span
+ * is solved by SymmetricEigen until the wanted vectors stop changing.
+ *
+ * Each multiplication goes through the coordinates of every frame once,
+ * projecting the frame onto the vectors and summing its outer product with
+ * the projection into a partial product for each thread, which needs memory
+ * only in proportion to 3N. When the iteration runs long enough to have cost
+ * as much as forming the covariance, and the covariance fits within the
+ * memory budget, it is formed once, in square blocks of coordinates which
+ * are split across the global thread pool so that each thread sums every
+ * frame into its own block, and later multiplications use it instead. Every
+ * stride-th frame is used, with the smallest stride that keeps the
+ * coordinates within the budget.
+ */
+
+#ifndef PRINCIPALCOMPONENTS_H
+#define PRINCIPALCOMPONENTS_H
+
+#include "Atom.h"
+#include "Bitset.h"
+#include "Superposition.h"
+#include <QString>
+#include <QVector>
+
+class PrincipalComponents
+{
+public:
+    /**
+     * @brief Sets the number of components found.
+     * @param count The number of components, at least one.
+     */
+    void SetComponents(int count);
+
+    /**
+     * @brief Sets the memory the calculation may use.
+     * @param bytes The number of bytes, or zero for DEFAULT_MEMORY_BUDGET.
+     */
+    void SetMemoryBudget(qint64 bytes);
+
+    /**
+     * @brief Finds the principal components of a selection of atoms.
+     * @param atoms The atoms. Every atom must have the same number of
+     * frames.
+     * @param selection One bit per atom of @e atoms, set for the atoms
+     * analysed.
+     * @param fits The fit of each frame onto the reference frame, or an
+     * empty QVector to use the positions as loaded.
+     * @return true if the components were found, false otherwise, in which
+     * case GetError() gives the reason.
+     */
+    bool Calculate(const QVector<Atom*>& atoms, const Bitset& selection,
+                   const QVector<Superposition::Fit>& fits);
+
+    /**
+     * @brief Forgets the components found, as when the atoms they were
+     * found for are unloaded.
+     */
+    void Clear();
+
+    /**
+     * @brief Returns the reason the last calculation or write failed.
+     * @return The error message.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Returns the number of components found.
+     * @return The number of components, or zero before Calculate().
+     */
+    int GetComponents() const;
+
+    /**
+     * @brief Returns the stride between the frames used.
+     * @return 1 if every frame was used, 2 for every second frame, and so
+     * on.
+     */
+    int GetFrameStride() const;
+
+    /**
+     * @brief Returns the number of multiplications by the covariance taken
+     * by the subspace iteration.
+     * @return The number of iterations.
+     */
+    int GetIterations() const;
+
+    /**
+     * @brief Returns whether the covariance was never formed, because the
+     * iteration converged before forming it would have paid off or it did
+     * not fit within the memory budget.
+     * @return true if the covariance was not formed, false otherwise.
+     */
+    bool IsMatrixFree() const;
+
+    /**
+     * @brief Returns the variance along a component, its eigenvalue.
+     * @param component The component, counting from 0 for the largest.
+     * @return The variance, in nm^2.
+     */
+    float GetVariance(int component) const;
+
+    /**
+     * @brief Returns the total variance of the coordinates, the sum of
+     * every eigenvalue.
+     * @return The variance, in nm^2.
+     */
+    float GetTotalVariance() const;
+
+    /**
+     * @brief Returns the projection of each frame used onto a component.
+     * @param component The component.
+     * @return The displacement of each frame from the mean along the
+     * component, in nm.
+     */
+    QVector<float> GetProjection(int component) const;
+
+    /**
+     * @brief Stores the amplitude of each atom in a component, the root
+     * mean square displacement of the atom along the component, in each
+     * @Atom.
+     * @param atoms The atoms passed to Calculate(). Atoms which were not
+     * analysed are given zero, as is every atom before Calculate().
+     * @param component The component.
+     * @return The largest amplitude, in nm.
+     */
+    float StoreAmplitudes(const QVector<Atom*>& atoms, int component) const;
+
+    /**
+     * @brief Writes the variance of each component and the projection of
+     * each frame onto them to a CSV file.
+     * @param filePath The path of the file.
+     * @return true if the file was written, false otherwise, in which case
+     * GetError() gives the reason.
+     */
+    bool WriteCsv(const QString& filePath);
+
+    /**
+     * @brief The number of components found unless SetComponents() is
+     * called.
+     */
+    static const int DEFAULT_COMPONENTS = 3;
+
+    /**
+     * @brief The memory the calculation may use unless SetMemoryBudget() is
+     * called, in bytes.
+     */
+    static const qint64 DEFAULT_MEMORY_BUDGET = 1024LL*1024*1024;
+
+    /**
+     * @brief The number of vectors iterated beyond the components wanted,
+     * which speeds up convergence when eigenvalues are close.
+     */
+    static const int EXTRA_VECTORS = 4;
+
+    /**
+     * @brief The largest number of subspace iterations.
+     */
+    static const int MAX_ITERATIONS = 300;
+
+    /**
+     * @brief The largest residual of a converged component, relative to the
+     * largest eigenvalue.
+     */
+    static const double TOLERANCE;
+
+private:
+    /**
+     * @brief Multiplies vectors by the covariance.
+     * @param vectors The 3N x m matrix of vectors, row by row.
+     * @param columns The number of vectors, m.
+     * @param product Set to the 3N x m product, row by row.
+     */
+    void multiply(const QVector<double>& vectors, int columns,
+                  QVector<double>& product) const;
+
+    /**
+     * @brief Forms the covariance from the coordinates, one block of
+     * coordinates per task.
+     */
+    void formCovariance();
+
+    /**
+     * @brief Makes the columns of a matrix orthonormal by modified
+     * Gram-Schmidt, zeroing any column which depends on those before it.
+     * @param vectors The rows x columns matrix, row by row.
+     * @param rows The number of rows.
+     * @param columns The number of columns.
+     */
+    static void orthonormalise(QVector<double>& vectors, int rows, int columns);
+
+    /**
+     * @brief The number of atoms passed to Calculate().
+     */
+    int m_AtomCount = 0;
+
+    /**
+     * @brief The coordinates of each frame used about their mean, frame by
+     * frame, only held during Calculate().
+     */
+    QVector<float> m_Coordinates;
+
+    /**
+     * @brief The covariance of the coordinates, row by row, only held during
+     * Calculate() and only once it has been formed.
+     */
+    QVector<double> m_Covariance;
+
+    /**
+     * @brief The number of coordinates, 3N.
+     */
+    int m_Dimension = 0;
+
+    /**
+     * @brief The reason the last calculation or write failed.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The stride between the frames used.
+     */
+    int m_FrameStride = 1;
+
+    /**
+     * @brief The number of frames used.
+     */
+    int m_Frames = 0;
+
+    /**
+     * @brief The index in the atoms passed to Calculate() of each atom
+     * analysed.
+     */
+    QVector<int> m_Indices;
+
+    /**
+     * @brief The number of subspace iterations taken.
+     */
+    int m_Iterations = 0;
+
+    /**
+     * @brief Whether the covariance was never formed.
+     */
+    bool m_MatrixFree = false;
+
+    /**
+     * @brief The memory the calculation may use, in bytes.
+     */
+    qint64 m_MemoryBudget = DEFAULT_MEMORY_BUDGET;
+
+    /**
+     * @brief The projection of each frame used onto each component, frame
+     * by frame.
+     */
+    QVector<float> m_Projections;
+
+    /**
+     * @brief The total variance of the coordinates, in nm^2.
+     */
+    float m_TotalVariance = 0;
+
+    /**
+     * @brief The variance along each component found, largest first.
+     */
+    QVector<float> m_Variances;
+
+    /**
+     * @brief The unit vector of each component found, 3N x components, row
+     * by row.
+     */
+    QVector<float> m_Vectors;
+
+    /**
+     * @brief The number of components wanted.
+     */
+    int m_Wanted = DEFAULT_COMPONENTS;
+
+    /**
+     * @brief The number of coordinates in each square block of the
+     * covariance.
+     */
+    static const int BLOCK_SIZE = 64;
+
+    /**
+     * @brief The smallest number of frames worth handing to a thread.
+     */
+    static const int MIN_FRAMES_PER_THREAD = 16;
+
+    /**
+     * @brief The smallest number of coordinates worth handing to a thread.
+     */
+    static const int MIN_ROWS_PER_THREAD = 64;
+};
+
+#endif // PRINCIPALCOMPONENTS_H
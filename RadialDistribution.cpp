@@ -0,0 +1,172 @@
+#include "RadialDistribution.h"
+#include "CellList.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <QFile>
+#include <QTextStream>
+#include <QtMath>
+
+void RadialDistribution::SetBins(int bins)
+{
+    m_Bins = qMax(1, bins);
+}
+
+void RadialDistribution::SetCutoff(float cutoff)
+{
+    m_Cutoff = cutoff;
+}
+
+void RadialDistribution::SetFrameStride(int stride)
+{
+    m_FrameStride = qMax(1, stride);
+}
+
+bool RadialDistribution::Calculate(const QVector<Atom*>& atoms,
+                                   const Bitset& first, const Bitset& second,
+                                   const QVector3D& box)
+{
+    TRACE_SCOPE("RadialDistribution::Calculate");
+    m_Error.clear();
+    m_Frames = 0;
+    m_Values.clear();
+
+    // Only the atoms of either selection are searched, each marked with the
+    // selections it belongs to.
+    QVector<Atom*> selected;
+    QVector<char> roles;
+    qint64 firstCount = 0;
+    qint64 secondCount = 0;
+    qint64 bothCount = 0;
+    for (int i = 0; i < atoms.length(); ++i)
+    {
+        char role = (first.Test(i) ? 1 : 0) | (second.Test(i) ? 2 : 0);
+        if (role != 0)
+        {
+            selected.append(atoms[i]);
+            roles.append(role);
+            firstCount += role & 1;
+            secondCount += role >> 1;
+            bothCount += role == 3;
+        }
+    }
+    qint64 pairs = firstCount*secondCount - bothCount;
+    if (pairs <= 0)
+    {
+        m_Error = "The selections must choose at least two different atoms.";
+        return false;
+    }
+
+    CellList cells;
+    int frames = selected[0]->GetTrajectoryRef().length();
+    float binsPerNm = m_Bins/m_Cutoff;
+    const char* roleData = roles.constData();
+    QVector<QVector<qint64> > threadBins;
+    for (int frame = 0; frame < frames; frame += m_FrameStride)
+    {
+        if (!cells.Build(selected, frame, box, m_Cutoff))
+        {
+            m_Error = "The cutoff must be positive and at most half the "
+                      "shortest side of the simulation box.";
+            return false;
+        }
+
+        int chunks = Parallel::ChunkCount(cells.GetCells(), MIN_CELLS_PER_THREAD);
+        while (threadBins.length() < chunks)
+        {
+            threadBins.append(QVector<qint64>(m_Bins, 0));
+        }
+        Parallel::For(cells.GetCells(), MIN_CELLS_PER_THREAD,
+                      [&](int chunk, int firstCell, int lastCell)
+        {
+            qint64* bins = threadBins[chunk].data();
+            int binCount = m_Bins;
+            cells.ForEachPair(firstCell, lastCell, m_Cutoff,
+                              [=](int a, int b, float distanceSquared)
+            {
+                int matches = ((roleData[a] & 1) && (roleData[b] & 2))
+                        + ((roleData[b] & 1) && (roleData[a] & 2));
+                if (matches == 0)
+                {
+                    return;
+                }
+                int bin = (int)(qSqrt(distanceSquared)*binsPerNm);
+                if (bin < binCount)
+                {
+                    bins[bin] += matches;
+                }
+            });
+        });
+        ++m_Frames;
+    }
+
+    // The count expected in a shell if the second selection were spread
+    // evenly through the box.
+    float volume = box.x()*box.y()*box.z();
+    float binWidth = GetBinWidth();
+    m_Values.resize(m_Bins);
+    for (int bin = 0; bin < m_Bins; ++bin)
+    {
+        qint64 count = 0;
+        for (int chunk = 0; chunk < threadBins.length(); ++chunk)
+        {
+            count += threadBins[chunk][bin];
+        }
+        double inner = bin*binWidth;
+        double outer = (bin + 1)*binWidth;
+        double shell = 4.0/3.0*M_PI*(outer*outer*outer - inner*inner*inner);
+        double expected = (double)m_Frames*pairs*shell/volume;
+        m_Values[bin] = (float)(count/expected);
+    }
+    return true;
+}
+
+QString RadialDistribution::GetError() const
+{
+    return m_Error;
+}
+
+float RadialDistribution::GetBinWidth() const
+{
+    return m_Cutoff/m_Bins;
+}
+
+int RadialDistribution::GetFrames() const
+{
+    return m_Frames;
+}
+
+float RadialDistribution::GetRadius(int bin) const
+{
+    return (bin + 0.5f)*GetBinWidth();
+}
+
+const QVector<float>& RadialDistribution::GetValues() const
+{
+    return m_Values;
+}
+
+bool RadialDistribution::WriteCsv(const QString& filePath)
+{
+    m_Error.clear();
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        m_Error = "Could not open " + filePath + " for writing.";
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "# " << m_Frames << " frames\n";
+    out << "r,g\n";
+    for (int i = 0; i < m_Values.length(); ++i)
+    {
+        out << GetRadius(i) << "," << m_Values[i] << "\n";
+    }
+    out.flush();
+    if (out.status() != QTextStream::Ok)
+    {
+        m_Error = "Failed while writing " + filePath + ".";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file RadialDistribution.h
+ * @date 19 Oct 2026
+ * @see CellList.h
+ * @see SelectionExpression.h
+ * @brief This class calculates the radial distribution function g(r)
+ * between two selections of atoms, averaged over the frames of a trajectory.
+ *
+ * Only the atoms of either selection are placed in a CellList at each frame,
+ * and every pair within the cutoff is counted once, using the periodic
+ * boundary of the simulation box. The cells are split across the global
+ * thread pool, and each thread counts into its own histogram for the whole
+ * run, so the histograms are only merged once at the end. A pair is counted
+ * once for each way round it matches the selections, so an atom in both
+ * selections is paired with the others of both, but never with itself.
+ *
+ * The counts are normalised by the number of pairs and the volume of each
+ * spherical shell, so g(r) tends to 1 at distances where the positions of
+ * the second selection are uncorrelated with the first.
+ */
+
+#ifndef RADIALDISTRIBUTION_H
+#define RADIALDISTRIBUTION_H
+
+#include "Atom.h"
+#include "Bitset.h"
+#include <QString>
+#include <QVector>
+#include <QVector3D>
+
+class RadialDistribution
+{
+public:
+    /**
+     * @brief Sets the number of bins between zero and the cutoff.
+     * @param bins The number of bins, at least one.
+     */
+    void SetBins(int bins);
+
+    /**
+     * @brief Sets the largest distance counted.
+     * @param cutoff The cutoff, in nm, at most half the shortest side of the
+     * simulation box.
+     */
+    void SetCutoff(float cutoff);
+
+    /**
+     * @brief Sets how many frames are skipped between the frames counted.
+     * @param stride 1 to count every frame, 2 for every second frame, and so
+     * on.
+     */
+    void SetFrameStride(int stride);
+
+    /**
+     * @brief Calculates g(r) over the frames of a set of atoms.
+     * @param atoms The atoms. Every atom must have the same number of
+     * frames.
+     * @param first One bit per atom of @e atoms, set for the atoms of the
+     * first selection.
+     * @param second One bit per atom of @e atoms, set for the atoms of the
+     * second selection.
+     * @param box The sides of the periodic simulation box, in nm.
+     * @return true if g(r) was calculated, false otherwise, in which case
+     * GetError() gives the reason.
+     */
+    bool Calculate(const QVector<Atom*>& atoms, const Bitset& first,
+                   const Bitset& second, const QVector3D& box);
+
+    /**
+     * @brief Returns the reason the last calculation or write failed.
+     * @return The error message.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Returns the width of each bin.
+     * @return The width, in nm.
+     */
+    float GetBinWidth() const;
+
+    /**
+     * @brief Returns the number of frames counted by the last calculation.
+     * @return The number of frames.
+     */
+    int GetFrames() const;
+
+    /**
+     * @brief Returns the distance at the centre of a bin.
+     * @param bin The bin.
+     * @return The distance, in nm.
+     */
+    float GetRadius(int bin) const;
+
+    /**
+     * @brief Returns g(r) for each bin.
+     * @return The values, or an empty QVector before the first successful
+     * calculation.
+     */
+    const QVector<float>& GetValues() const;
+
+    /**
+     * @brief Writes g(r) to a CSV file, one bin per line.
+     * @param filePath The path of the file.
+     * @return true if the file was written, false otherwise, in which case
+     * GetError() gives the reason.
+     */
+    bool WriteCsv(const QString& filePath);
+
+    /**
+     * @brief The number of bins used if SetBins() is not called.
+     */
+    static const int DEFAULT_BINS = 200;
+
+private:
+    /**
+     * @brief The number of bins.
+     */
+    int m_Bins = DEFAULT_BINS;
+
+    /**
+     * @brief The largest distance counted.
+     */
+    float m_Cutoff = 1;
+
+    /**
+     * @brief The reason the last calculation or write failed.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The number of frames counted by the last calculation.
+     */
+    int m_Frames = 0;
+
+    /**
+     * @brief How many frames are skipped between the frames counted.
+     */
+    int m_FrameStride = 1;
+
+    /**
+     * @brief g(r) for each bin.
+     */
+    QVector<float> m_Values;
+
+    /**
+     * @brief The smallest number of cells worth handing to a thread.
+     */
+    static const int MIN_CELLS_PER_THREAD = 16;
+};
+
+#endif // RADIALDISTRIBUTION_H
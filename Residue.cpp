@@ -1,11 +1,22 @@
 #include "Residue.h"
 #include <QTextStream>
+#include <QtMath>
 
 QVector<Atom*>& Residue::GetAtomVectorRef()
 {
     return m_AtomVector;
 }
 
+Atom& Residue::GetCentroidRef()
+{
+    return m_Centroid;
+}
+
+float Residue::GetRadius()
+{
+    return m_Radius;
+}
+
 void Residue::setAtomVector(QVector<Atom*> atomVector)
 {
     m_AtomVector = atomVector;
@@ -41,6 +52,84 @@ void Residue::AddAtom(Atom* atom)
     GetAtomVectorRef().append(atom);
 }
 
+void Residue::CalculateCentroid(const QVector3D& box)
+{
+    m_Centroid.SetParentResidue(GetResidueName());
+    m_Centroid.setParentResidueID(GetResidueID());
+    m_Centroid.SetAtomName(GetResidueName());
+    m_Centroid.GetTrajectoryRef().clear();
+    m_Centroid.GetStepTimeRef().clear();
+    m_Radius = 0;
+    if (GetAtomVectorRef().isEmpty())
+    {
+        return;
+    }
+
+    // The shift which puts each atom on the same side of the periodic
+    // boundary as the first atom, found at the first frame.
+    const QVector<QVector3D>& first = GetAtomVectorRef()[0]->GetTrajectoryRef();
+    int frames = first.length();
+    int atoms = GetAtomVectorRef().length();
+    QVector<QVector3D> shifts(atoms);
+    for (int i = 0; i < atoms; ++i)
+    {
+        QVector3D separation = first[0]
+                - GetAtomVectorRef()[i]->GetTrajectoryRef()[0];
+        for (int j = 0; j < Atom::DIMENSIONS; ++j)
+        {
+            if (box[j] > 0)
+            {
+                shifts[i][j] = box[j]*qRound(separation[j]/box[j]);
+            }
+        }
+    }
+
+    m_Centroid.GetTrajectoryRef().resize(frames);
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        QVector3D sum;
+        for (int i = 0; i < atoms; ++i)
+        {
+            sum += GetAtomVectorRef()[i]->GetTrajectoryRef()[frame] + shifts[i];
+        }
+        m_Centroid.GetTrajectoryRef()[frame] = sum/atoms;
+    }
+    m_Centroid.GetStepTimeRef() = GetAtomVectorRef()[0]->GetStepTimeRef();
+
+    float squares = 0;
+    for (int i = 0; i < atoms; ++i)
+    {
+        QVector3D offset = GetAtomVectorRef()[i]->GetTrajectoryRef()[0]
+                + shifts[i] - m_Centroid.GetTrajectoryRef()[0];
+        squares += offset.lengthSquared();
+    }
+    m_Radius = qSqrt(squares/atoms);
+}
+
+void Residue::AverageMetric(QVector<float>& (Atom::*metric)())
+{
+    QVector<float>& mean = (m_Centroid.*metric)();
+    mean.clear();
+    if (GetAtomVectorRef().isEmpty())
+    {
+        return;
+    }
+    int atoms = GetAtomVectorRef().length();
+    mean.fill(0, (GetAtomVectorRef()[0]->*metric)().length());
+    for (int i = 0; i < atoms; ++i)
+    {
+        const QVector<float>& values = (GetAtomVectorRef()[i]->*metric)();
+        for (int j = 0; j < qMin(mean.length(), values.length()); ++j)
+        {
+            mean[j] += values[j];
+        }
+    }
+    for (int j = 0; j < mean.length(); ++j)
+    {
+        mean[j] /= atoms;
+    }
+}
+
 void Residue::PrintResidue()
 {
     QTextStream out(stdout);
@@ -5,7 +5,10 @@
  * @see Atom.h
  * @brief This class stores information about one residue from the input files.
  *
- * Detailed description goes here
+ * Each Residue also has a centroid, a pseudo-Atom whose trajectory is the
+ * mean position of the Residue's atoms at every frame, and whose metrics are
+ * the mean of its atoms' metrics. The centroids are drawn instead of the
+ * atoms when the view is zoomed out too far to tell the atoms apart.
  */
 
 #ifndef RESIDUE_H
@@ -24,6 +27,19 @@ public:
      */
      QVector<Atom*>& GetAtomVectorRef();
 
+    /**
+     * @brief Getter for the centroid of the Residue.
+     * @return The pseudo-Atom following the centroid of the Residue.
+     */
+     Atom& GetCentroidRef();
+
+    /**
+     * @brief Getter for the size of the Residue.
+     * @return The root mean square distance of the Residue's atoms from its
+     * centroid at the first frame, calculated by CalculateCentroid().
+     */
+     float GetRadius();
+
     /**
      * @brief Getter for the Residue ID.
      * @return The unique ID number for the Residue.
@@ -59,6 +75,23 @@ public:
      */
     void AddAtom(Atom* atom);
 
+    /**
+     * @brief Calculates the trajectory of the centroid from the trajectories
+     * of the Residue's atoms. Atoms which are split from the first atom
+     * across the periodic boundary are moved back by a box length, so the
+     * centroid of a Residue lying across the boundary stays inside it.
+     * @param box The dimensions of the simulation box.
+     */
+    void CalculateCentroid(const QVector3D& box);
+
+    /**
+     * @brief Sets a metric of the centroid to the mean of the metric over
+     * the Residue's atoms at every frame.
+     * @param metric The getter for the metric, which has already been
+     * calculated for the atoms.
+     */
+    void AverageMetric(QVector<float>& (Atom::*metric)());
+
     /**
      * @brief Prints out the Residue info.
      */
@@ -78,6 +111,17 @@ private:
      */
     QVector<Atom*> m_AtomVector;
 
+    /**
+     * @brief The pseudo-Atom following the centroid of the Residue.
+     */
+    Atom m_Centroid;
+
+    /**
+     * @brief The root mean square distance of the atoms from the centroid at
+     * the first frame.
+     */
+    float m_Radius = 0;
+
     /**
      * @brief The unique ID number for the Residue.
      */
@@ -0,0 +1,231 @@
+#include "ResultsFile.h"
+#include "Trace.h"
+#include <QDataStream>
+#include <QFile>
+#include <QTextStream>
+
+ResultsFile::ResultsFile(Format format)
+    : m_Format(format)
+{
+}
+
+void ResultsFile::AddMetric(const Metric& metric)
+{
+    m_Metrics.append(metric);
+}
+
+QString ResultsFile::GetError() const
+{
+    return m_Error;
+}
+
+bool ResultsFile::Write(const QString& filePath, const QVector<Atom*>& atoms)
+{
+    TRACE_SCOPE("ResultsFile::Write");
+    m_Error.clear();
+    if (m_Format == BINARY)
+    {
+        return writeBinary(filePath, atoms);
+    }
+    return writeCsv(filePath, atoms);
+}
+
+bool ResultsFile::Read(const QString& filePath, const QVector<Atom*>& atoms,
+                       QVector<Metric>& found)
+{
+    TRACE_SCOPE("ResultsFile::Read");
+    m_Error.clear();
+    found.clear();
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        m_Error = "Could not open " + filePath + " for reading.";
+        return false;
+    }
+
+    QDataStream in(&file);
+    in.setByteOrder(QDataStream::BigEndian);
+    in.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    quint32 magic;
+    quint32 version;
+    in >> magic >> version;
+    if (in.status() != QDataStream::Ok || magic != MAGIC)
+    {
+        m_Error = filePath + " is not an MDVis binary results file.";
+        return false;
+    }
+    if (version != VERSION)
+    {
+        m_Error = filePath + " has unsupported format version "
+                + QString::number(version) + ".";
+        return false;
+    }
+
+    qint32 fileAtoms;
+    qint32 fileFrames;
+    qint32 fileMetrics;
+    in >> fileAtoms >> fileFrames >> fileMetrics;
+    int frames = atoms.isEmpty() ? 0 : atoms[0]->GetTrajectoryRef().length();
+    if (fileAtoms != atoms.length() || fileFrames != frames)
+    {
+        m_Error = "The results in " + filePath + " are for "
+                + QString::number(fileAtoms) + " atoms and "
+                + QString::number(fileFrames) + " frames, but "
+                + QString::number(atoms.length()) + " atoms and "
+                + QString::number(frames) + " frames are loaded.";
+        return false;
+    }
+
+    // The values are only moved into the atoms once every one has been read.
+    QVector<QVector<QVector<float> > > values;
+    for (int i = 0; i < fileMetrics && in.status() == QDataStream::Ok; ++i)
+    {
+        Metric metric;
+        in >> metric.name >> metric.min >> metric.max;
+        int wanted = -1;
+        for (int j = 0; j < m_Metrics.length(); ++j)
+        {
+            if (m_Metrics[j].name == metric.name)
+            {
+                wanted = j;
+            }
+        }
+
+        QVector<QVector<float> > metricValues(wanted >= 0 ? fileAtoms : 0);
+        for (int j = 0; j < fileAtoms && in.status() == QDataStream::Ok; ++j)
+        {
+            qint32 length;
+            in >> length;
+            if (length < 0 || length > fileFrames)
+            {
+                m_Error = filePath + " is corrupt.";
+                return false;
+            }
+            if (wanted < 0)
+            {
+                in.skipRawData(length*sizeof(float));
+                continue;
+            }
+            metricValues[j].resize(length);
+            for (int k = 0; k < length; ++k)
+            {
+                in >> metricValues[j][k];
+            }
+        }
+        if (wanted >= 0)
+        {
+            metric.values = m_Metrics[wanted].values;
+            found.append(metric);
+            values.append(metricValues);
+        }
+    }
+
+    if (in.status() != QDataStream::Ok)
+    {
+        m_Error = "Failed while reading " + filePath + ".";
+        found.clear();
+        return false;
+    }
+    for (int i = 0; i < found.length(); ++i)
+    {
+        for (int j = 0; j < atoms.length(); ++j)
+        {
+            (atoms[j]->*found[i].values)() = values[i][j];
+        }
+    }
+    return true;
+}
+
+bool ResultsFile::writeBinary(const QString& filePath,
+                              const QVector<Atom*>& atoms)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        m_Error = "Could not open " + filePath + " for writing.";
+        return false;
+    }
+
+    int frames = atoms.isEmpty() ? 0 : atoms[0]->GetTrajectoryRef().length();
+    QDataStream out(&file);
+    out.setByteOrder(QDataStream::BigEndian);
+    out.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    out << MAGIC << VERSION;
+    out << (qint32)atoms.length() << (qint32)frames
+        << (qint32)m_Metrics.length();
+
+    for (int i = 0; i < m_Metrics.length(); ++i)
+    {
+        const Metric& metric = m_Metrics[i];
+        out << metric.name << metric.min << metric.max;
+        for (int j = 0; j < atoms.length(); ++j)
+        {
+            const QVector<float>& values = (atoms[j]->*metric.values)();
+            out << (qint32)values.length();
+            for (int k = 0; k < values.length(); ++k)
+            {
+                out << values[k];
+            }
+        }
+    }
+
+    if (out.status() != QDataStream::Ok)
+    {
+        m_Error = "Failed while writing " + filePath + ".";
+        return false;
+    }
+    return true;
+}
+
+bool ResultsFile::writeCsv(const QString& filePath,
+                           const QVector<Atom*>& atoms)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        m_Error = "Could not open " + filePath + " for writing.";
+        return false;
+    }
+
+    QTextStream out(&file);
+    for (int i = 0; i < m_Metrics.length(); ++i)
+    {
+        out << "# " << m_Metrics[i].name << " range "
+            << m_Metrics[i].min << " " << m_Metrics[i].max << "\n";
+    }
+
+    out << "atom,frame,time";
+    for (int i = 0; i < m_Metrics.length(); ++i)
+    {
+        out << "," << m_Metrics[i].name;
+    }
+    out << "\n";
+
+    for (int i = 0; i < atoms.length(); ++i)
+    {
+        const QVector<int>& stepTime = atoms[i]->GetStepTimeRef();
+        for (int j = 0; j < stepTime.length(); ++j)
+        {
+            out << i << "," << j << "," << stepTime[j];
+            for (int k = 0; k < m_Metrics.length(); ++k)
+            {
+                const QVector<float>& values =
+                        (atoms[i]->*m_Metrics[k].values)();
+                out << ",";
+                if (j < values.length())
+                {
+                    out << values[j];
+                }
+            }
+            out << "\n";
+        }
+    }
+
+    out.flush();
+    if (out.status() != QTextStream::Ok)
+    {
+        m_Error = "Failed while writing " + filePath + ".";
+        return false;
+    }
+    return true;
+}
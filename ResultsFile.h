@@ -0,0 +1,152 @@
+/**
+ * @file ResultsFile.h
+ * @date 19 Oct 2026
+ * @see Atom.h
+ * @brief This class writes calculated per-atom metrics, and their ranges, to
+ * disk as either a compact binary file or a CSV table, and reads the binary
+ * file back.
+ *
+ * The binary format is written with a big-endian QDataStream. It starts with
+ * a magic number and format version, followed by the number of atoms, the
+ * number of frames and the number of metrics. Each metric then stores its
+ * name, minimum and maximum, followed by one length-prefixed array of floats
+ * per atom. The CSV format lists the range of each metric in comment lines,
+ * followed by one row per atom per frame.
+ */
+
+#ifndef RESULTSFILE_H
+#define RESULTSFILE_H
+
+#include "Atom.h"
+#include <QString>
+#include <QVector>
+
+class ResultsFile
+{
+public:
+    /**
+     * @brief Pointer to an @Atom getter returning one of its calculated
+     * metrics.
+     */
+    typedef QVector<float>& (Atom::*AtomMetric)();
+
+    /**
+     * @brief A calculated metric to be written, with its range.
+     */
+    struct Metric
+    {
+        /**
+         * @brief The name of the metric, used as a column heading.
+         */
+        QString name;
+
+        /**
+         * @brief The @Atom getter for the metric's values.
+         */
+        AtomMetric values;
+
+        /**
+         * @brief The minimum value of the metric among all atoms.
+         */
+        float min;
+
+        /**
+         * @brief The maximum value of the metric among all atoms.
+         */
+        float max;
+    };
+
+    /**
+     * @brief The available output formats.
+     */
+    enum Format
+    {
+        BINARY,
+        CSV
+    };
+
+    /**
+     * @brief Constructor.
+     * @param format The format the results will be written in.
+     */
+    explicit ResultsFile(Format format);
+
+    /**
+     * @brief Adds a metric to the list of metrics to be written.
+     * @param metric The metric to be added.
+     */
+    void AddMetric(const Metric& metric);
+
+    /**
+     * @brief Returns a description of the last error, if Write() or Read()
+     * failed.
+     * @return The error message.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Writes the metrics for every @Atom in @e atoms to a file.
+     * @param filePath The path of the file to be written.
+     * @param atoms The atoms whose metrics will be written.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool Write(const QString& filePath, const QVector<Atom*>& atoms);
+
+    /**
+     * @brief Reads the metrics from a binary results file into every @Atom
+     * in @e atoms. Only the metrics added with AddMetric() are read, matched
+     * by name, and the others in the file are skipped. The atoms are left
+     * unchanged unless the whole file is read.
+     * @param filePath The path of the file to be read.
+     * @param atoms The atoms the results were calculated for, in the order
+     * they were written.
+     * @param found Set to the metrics read, with their ranges.
+     * @return true if the file was read successfully, false otherwise.
+     */
+    bool Read(const QString& filePath, const QVector<Atom*>& atoms,
+              QVector<Metric>& found);
+
+    /**
+     * @brief Identifies MDVis binary results files, "MDVR" in ASCII.
+     */
+    static const quint32 MAGIC = 0x4D445652;
+
+    /**
+     * @brief The version of the binary format written.
+     */
+    static const quint32 VERSION = 1;
+
+private:
+    /**
+     * @brief Writes the metrics in the binary format.
+     * @param filePath The path of the file to be written.
+     * @param atoms The atoms whose metrics will be written.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool writeBinary(const QString& filePath, const QVector<Atom*>& atoms);
+
+    /**
+     * @brief Writes the metrics as a CSV table.
+     * @param filePath The path of the file to be written.
+     * @param atoms The atoms whose metrics will be written.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool writeCsv(const QString& filePath, const QVector<Atom*>& atoms);
+
+    /**
+     * @brief The last error message.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The format the results will be written in.
+     */
+    Format m_Format;
+
+    /**
+     * @brief The metrics to be written.
+     */
+    QVector<Metric> m_Metrics;
+};
+
+#endif // RESULTSFILE_H
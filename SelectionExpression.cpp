@@ -0,0 +1,359 @@
+#include "SelectionExpression.h"
+
+bool SelectionExpression::Compile(const QString& expression)
+{
+    QStringList tokens = tokenize(expression);
+    QVector<Instruction> program;
+    QString error;
+    int position = 0;
+    if (!tokens.isEmpty())
+    {
+        if (parseOr(tokens, position, program, error)
+                && position < tokens.length())
+        {
+            error = "Unexpected '" + tokens[position] + "'.";
+        }
+        if (!error.isEmpty())
+        {
+            m_Error = error;
+            return false;
+        }
+    }
+    m_Error.clear();
+    m_Expression = expression;
+    m_Program = program;
+    return true;
+}
+
+QString SelectionExpression::GetError() const
+{
+    return m_Error;
+}
+
+QString SelectionExpression::GetExpression() const
+{
+    return m_Expression;
+}
+
+bool SelectionExpression::IsEmpty() const
+{
+    return m_Program.isEmpty();
+}
+
+Bitset SelectionExpression::Evaluate(const AtomTable& table) const
+{
+    if (m_Program.isEmpty())
+    {
+        return Bitset(table.GetAtoms(), true);
+    }
+
+    QVector<Bitset> stack;
+    for (int i = 0; i < m_Program.length(); ++i)
+    {
+        const Instruction& instruction = m_Program[i];
+        switch (instruction.op)
+        {
+        case SELECT_ALL:
+        case SELECT_NONE:
+            stack.append(Bitset(table.GetAtoms(), instruction.op == SELECT_ALL));
+            break;
+        case MATCH_RESIDUE_NAME:
+        case MATCH_ATOM_NAME:
+        {
+            bool residue = instruction.op == MATCH_RESIDUE_NAME;
+            QVector<int> matched;
+            for (int j = 0; j < instruction.names.length(); ++j)
+            {
+                matched.append(residue
+                               ? table.FindResidueName(instruction.names[j])
+                               : table.FindAtomName(instruction.names[j]));
+            }
+            stack.append(residue
+                         ? matchNames(table.GetResidueNameIDs(),
+                                      table.GetResidueNameCount(), matched)
+                         : matchNames(table.GetAtomNameIDs(),
+                                      table.GetAtomNameCount(), matched));
+            break;
+        }
+        case MATCH_RESIDUE_ID:
+            stack.append(matchRanges(table.GetResidueIDs(), instruction.ranges));
+            break;
+        case MATCH_ATOM_NUMBER:
+            stack.append(matchRanges(table.GetAtomNumbers(), instruction.ranges));
+            break;
+        case NOT:
+            stack.last() = ~stack.last();
+            break;
+        case AND:
+        case OR:
+        {
+            Bitset right = stack.takeLast();
+            if (instruction.op == AND)
+            {
+                stack.last() &= right;
+            }
+            else
+            {
+                stack.last() |= right;
+            }
+            break;
+        }
+        }
+    }
+    return stack.last();
+}
+
+QStringList SelectionExpression::tokenize(const QString& expression)
+{
+    QStringList tokens;
+    QString word;
+    for (int i = 0; i <= expression.length(); ++i)
+    {
+        QChar c = i < expression.length() ? expression[i] : QChar(' ');
+        if (c.isSpace() || c == '(' || c == ')')
+        {
+            if (!word.isEmpty())
+            {
+                tokens.append(word);
+                word.clear();
+            }
+            if (!c.isSpace())
+            {
+                tokens.append(QString(c));
+            }
+        }
+        else
+        {
+            word += c;
+        }
+    }
+    return tokens;
+}
+
+bool SelectionExpression::parseOr(const QStringList& tokens, int& position,
+                                  QVector<Instruction>& program, QString& error)
+{
+    if (!parseAnd(tokens, position, program, error))
+    {
+        return false;
+    }
+    while (position < tokens.length()
+           && tokens[position].compare("or", Qt::CaseInsensitive) == 0)
+    {
+        ++position;
+        if (!parseAnd(tokens, position, program, error))
+        {
+            return false;
+        }
+        Instruction instruction;
+        instruction.op = OR;
+        program.append(instruction);
+    }
+    return true;
+}
+
+bool SelectionExpression::parseAnd(const QStringList& tokens, int& position,
+                                   QVector<Instruction>& program, QString& error)
+{
+    if (!parseNot(tokens, position, program, error))
+    {
+        return false;
+    }
+    while (position < tokens.length()
+           && tokens[position].compare("and", Qt::CaseInsensitive) == 0)
+    {
+        ++position;
+        if (!parseNot(tokens, position, program, error))
+        {
+            return false;
+        }
+        Instruction instruction;
+        instruction.op = AND;
+        program.append(instruction);
+    }
+    return true;
+}
+
+bool SelectionExpression::parseNot(const QStringList& tokens, int& position,
+                                   QVector<Instruction>& program, QString& error)
+{
+    if (position < tokens.length()
+            && tokens[position].compare("not", Qt::CaseInsensitive) == 0)
+    {
+        ++position;
+        if (!parseNot(tokens, position, program, error))
+        {
+            return false;
+        }
+        Instruction instruction;
+        instruction.op = NOT;
+        program.append(instruction);
+        return true;
+    }
+    return parseTerm(tokens, position, program, error);
+}
+
+bool SelectionExpression::parseTerm(const QStringList& tokens, int& position,
+                                    QVector<Instruction>& program, QString& error)
+{
+    if (position >= tokens.length())
+    {
+        error = "The expression ends too soon.";
+        return false;
+    }
+
+    QString keyword = tokens[position++].toLower();
+    if (keyword == "(")
+    {
+        if (!parseOr(tokens, position, program, error))
+        {
+            return false;
+        }
+        if (position >= tokens.length() || tokens[position] != ")")
+        {
+            error = "Missing ')'.";
+            return false;
+        }
+        ++position;
+        return true;
+    }
+
+    Instruction instruction;
+    if (keyword == "all" || keyword == "none")
+    {
+        instruction.op = keyword == "all" ? SELECT_ALL : SELECT_NONE;
+        program.append(instruction);
+        return true;
+    }
+    else if (keyword == "resname")
+    {
+        instruction.op = MATCH_RESIDUE_NAME;
+    }
+    else if (keyword == "name")
+    {
+        instruction.op = MATCH_ATOM_NAME;
+    }
+    else if (keyword == "resid")
+    {
+        instruction.op = MATCH_RESIDUE_ID;
+    }
+    else if (keyword == "index")
+    {
+        instruction.op = MATCH_ATOM_NUMBER;
+    }
+    else
+    {
+        error = "Unknown keyword '" + tokens[position - 1] + "'.";
+        return false;
+    }
+
+    bool names = instruction.op == MATCH_RESIDUE_NAME
+            || instruction.op == MATCH_ATOM_NAME;
+    while (position < tokens.length() && !isReserved(tokens[position]))
+    {
+        if (names)
+        {
+            instruction.names.append(tokens[position]);
+        }
+        else
+        {
+            Range range;
+            if (!parseRange(tokens[position], range))
+            {
+                error = "'" + tokens[position] + "' is not a number or a "
+                        "range such as 10-200.";
+                return false;
+            }
+            instruction.ranges.append(range);
+        }
+        ++position;
+    }
+    if (instruction.names.isEmpty() && instruction.ranges.isEmpty())
+    {
+        error = "Expected a value after '" + keyword + "'.";
+        return false;
+    }
+    program.append(instruction);
+    return true;
+}
+
+bool SelectionExpression::isReserved(const QString& token)
+{
+    static const QStringList reserved = QStringList()
+            << "(" << ")" << "and" << "or" << "not" << "all" << "none"
+            << "resname" << "name" << "resid" << "index";
+    return reserved.contains(token.toLower());
+}
+
+bool SelectionExpression::parseRange(const QString& token, Range& range)
+{
+    // Split on a '-' after the first character, so that a negative first
+    // bound is not taken as the separator.
+    int separator = token.indexOf('-', 1);
+    bool firstOk;
+    bool lastOk = true;
+    range.first = token.left(separator).toInt(&firstOk);
+    range.second = range.first;
+    if (separator >= 0)
+    {
+        range.second = token.mid(separator + 1).toInt(&lastOk);
+    }
+    return firstOk && lastOk && range.first <= range.second;
+}
+
+Bitset SelectionExpression::matchNames(const QVector<int>& ids,
+                                       int idCount,
+                                       const QVector<int>& matched)
+{
+    QVector<quint64> isMatched(idCount, 0);
+    for (int i = 0; i < matched.length(); ++i)
+    {
+        if (matched[i] >= 0)
+        {
+            isMatched[matched[i]] = 1;
+        }
+    }
+
+    Bitset result(ids.length());
+    const int* id = ids.constData();
+    const quint64* lookup = isMatched.constData();
+    quint64* words = result.Words();
+    for (int word = 0; word < result.WordCount(); ++word)
+    {
+        int first = word*Bitset::WORD_BITS;
+        int count = qMin((int)Bitset::WORD_BITS, ids.length() - first);
+        quint64 bits = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            bits |= lookup[id[first + i]] << i;
+        }
+        words[word] = bits;
+    }
+    return result;
+}
+
+Bitset SelectionExpression::matchRanges(const QVector<int>& values,
+                                        const QVector<Range>& ranges)
+{
+    Bitset result(values.length());
+    const int* value = values.constData();
+    quint64* words = result.Words();
+    for (int r = 0; r < ranges.length(); ++r)
+    {
+        // One unsigned comparison tests both bounds of the range.
+        qint64 low = ranges[r].first;
+        quint64 width = (quint64)(ranges[r].second - low);
+        for (int word = 0; word < result.WordCount(); ++word)
+        {
+            int first = word*Bitset::WORD_BITS;
+            int count = qMin((int)Bitset::WORD_BITS, values.length() - first);
+            quint64 bits = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                bits |= (quint64)((quint64)(value[first + i] - low) <= width) << i;
+            }
+            words[word] |= bits;
+        }
+    }
+    return result;
+}
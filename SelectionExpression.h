@@ -0,0 +1,223 @@
+/**
+ * @file SelectionExpression.h
+ * @date 19 Oct 2026
+ * @see AtomTable.h
+ * @see Bitset.h
+ * @brief This class compiles an atom selection expression and evaluates it
+ * to a Bitset.
+ *
+ * An expression combines terms with @c and, @c or, @c not and parentheses,
+ * such as "resname LIG or (name CA and resid 10-200)". The terms are:
+ * - @c resname followed by one or more residue names,
+ * - @c name followed by one or more atom names,
+ * - @c resid followed by one or more residue IDs or ranges such as 10-200,
+ * - @c index followed by one or more atom numbers or ranges, counting .gro
+ *   lines from 1,
+ * - @c all and @c none.
+ *
+ * Keywords are not case sensitive, names are. An empty expression selects
+ * every atom.
+ *
+ * Compiling produces a postfix program of instructions. Evaluating runs each
+ * instruction over the columns of an AtomTable, building a whole Bitset at a
+ * time: name terms become a lookup table indexed by interned name ID, range
+ * terms become integer comparisons, and the operators combine the sets one
+ * 64 bit word at a time.
+ */
+
+#ifndef SELECTIONEXPRESSION_H
+#define SELECTIONEXPRESSION_H
+
+#include "AtomTable.h"
+#include "Bitset.h"
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class SelectionExpression
+{
+public:
+    /**
+     * @brief Compiles an expression. If the expression is invalid, the
+     * previously compiled expression is kept.
+     * @param expression The expression.
+     * @return true if the expression was valid, false otherwise.
+     */
+    bool Compile(const QString& expression);
+
+    /**
+     * @brief Returns the reason the last expression could not be compiled.
+     * @return The error message, or an empty string if it compiled.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Returns the compiled expression.
+     * @return The expression, as given to Compile().
+     */
+    QString GetExpression() const;
+
+    /**
+     * @brief Returns whether the expression selects every atom without
+     * needing to be evaluated.
+     * @return true if the expression is empty, false otherwise.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Evaluates the expression over a set of atoms.
+     * @param table The atoms.
+     * @return A Bitset with one bit per atom of @e table, set for the
+     * selected atoms.
+     */
+    Bitset Evaluate(const AtomTable& table) const;
+
+private:
+    /**
+     * @brief The operations of a compiled program.
+     */
+    enum OpCode
+    {
+        SELECT_ALL,
+        SELECT_NONE,
+        MATCH_RESIDUE_NAME,
+        MATCH_ATOM_NAME,
+        MATCH_RESIDUE_ID,
+        MATCH_ATOM_NUMBER,
+        NOT,
+        AND,
+        OR
+    };
+
+    /**
+     * @brief An inclusive range of integers.
+     */
+    typedef QPair<int, int> Range;
+
+    /**
+     * @brief One instruction of a compiled program. Match instructions push
+     * a new set, NOT replaces the top set and AND and OR combine the top two.
+     */
+    struct Instruction
+    {
+        /**
+         * @brief The operation.
+         */
+        OpCode op;
+
+        /**
+         * @brief The names matched by a name instruction.
+         */
+        QStringList names;
+
+        /**
+         * @brief The ranges matched by a range instruction.
+         */
+        QVector<Range> ranges;
+    };
+
+    /**
+     * @brief Splits an expression into words and parentheses.
+     * @param expression The expression.
+     * @return The tokens.
+     */
+    static QStringList tokenize(const QString& expression);
+
+    /**
+     * @brief Parses terms joined by @c or.
+     * @param tokens The tokens of the expression.
+     * @param position The index of the next token, which is advanced.
+     * @param program The program to which instructions are appended.
+     * @param error Set to a message if parsing fails.
+     * @return true on success, false otherwise.
+     */
+    static bool parseOr(const QStringList& tokens, int& position,
+                        QVector<Instruction>& program, QString& error);
+
+    /**
+     * @brief Parses terms joined by @c and.
+     * @param tokens The tokens of the expression.
+     * @param position The index of the next token, which is advanced.
+     * @param program The program to which instructions are appended.
+     * @param error Set to a message if parsing fails.
+     * @return true on success, false otherwise.
+     */
+    static bool parseAnd(const QStringList& tokens, int& position,
+                         QVector<Instruction>& program, QString& error);
+
+    /**
+     * @brief Parses a term which may be preceded by @c not.
+     * @param tokens The tokens of the expression.
+     * @param position The index of the next token, which is advanced.
+     * @param program The program to which instructions are appended.
+     * @param error Set to a message if parsing fails.
+     * @return true on success, false otherwise.
+     */
+    static bool parseNot(const QStringList& tokens, int& position,
+                         QVector<Instruction>& program, QString& error);
+
+    /**
+     * @brief Parses a keyword term or a parenthesised expression.
+     * @param tokens The tokens of the expression.
+     * @param position The index of the next token, which is advanced.
+     * @param program The program to which instructions are appended.
+     * @param error Set to a message if parsing fails.
+     * @return true on success, false otherwise.
+     */
+    static bool parseTerm(const QStringList& tokens, int& position,
+                          QVector<Instruction>& program, QString& error);
+
+    /**
+     * @brief Returns whether a token ends the values of a term.
+     * @param token The token.
+     * @return true for keywords, operators and parentheses.
+     */
+    static bool isReserved(const QString& token);
+
+    /**
+     * @brief Parses an integer or an inclusive range such as 10-200.
+     * @param token The token.
+     * @param range Set to the range.
+     * @return true on success, false otherwise.
+     */
+    static bool parseRange(const QString& token, Range& range);
+
+    /**
+     * @brief Selects the atoms whose interned name is one of a set of names.
+     * @param ids The interned name ID of each atom.
+     * @param idCount The number of interned names.
+     * @param matched The interned IDs of the names to match, or -1 for names
+     * which no atom has.
+     * @return The selected atoms.
+     */
+    static Bitset matchNames(const QVector<int>& ids,
+                             int idCount,
+                             const QVector<int>& matched);
+
+    /**
+     * @brief Selects the atoms whose value is within any of a set of ranges.
+     * @param values The value of each atom.
+     * @param ranges The ranges.
+     * @return The selected atoms.
+     */
+    static Bitset matchRanges(const QVector<int>& values,
+                              const QVector<Range>& ranges);
+
+    /**
+     * @brief The reason the last expression could not be compiled.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The compiled expression.
+     */
+    QString m_Expression;
+
+    /**
+     * @brief The compiled program, in postfix order.
+     */
+    QVector<Instruction> m_Program;
+};
+
+#endif // SELECTIONEXPRESSION_H
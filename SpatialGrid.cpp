@@ -0,0 +1,438 @@
+#include "SpatialGrid.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <QtMath>
+
+void SpatialGrid::SetBounds(const QVector3D& minimum, const QVector3D& maximum,
+                            int items)
+{
+    // Flat or empty regions are given a small depth so that the cells stay
+    // roughly cubic along the axes which do have an extent.
+    QVector3D extent = maximum - minimum;
+    float largest = qMax(extent.x(), qMax(extent.y(), extent.z()));
+    float smallest = largest > 0 ? largest/1000 : 1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        extent[axis] = qMax(extent[axis], smallest);
+    }
+
+    int target = qMax(1, items/ITEMS_PER_CELL);
+    float cellSize = qPow(extent.x()*extent.y()*extent.z()/target, 1.0/3);
+    m_Minimum = minimum;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_Dimensions[axis] = qBound(1, (int)qCeil(extent[axis]/cellSize), 1024);
+        m_Scale[axis] = m_Dimensions[axis]/extent[axis];
+    }
+    resetCells();
+}
+
+void SpatialGrid::SetCellSize(const QVector3D& minimum, const QVector3D& maximum,
+                              float cellSize)
+{
+    QVector3D extent = maximum - minimum;
+    m_Minimum = minimum;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_Dimensions[axis] = qBound(1, (int)(extent[axis]/cellSize), 1024);
+        m_Scale[axis] = extent[axis] > 0 ? m_Dimensions[axis]/extent[axis] : 0;
+    }
+    resetCells();
+}
+
+void SpatialGrid::Build(const QVector3D* minima, const QVector3D* maxima, int items)
+{
+    TRACE_SCOPE("SpatialGrid::Build");
+    int cells = GetCells();
+    if (cells == 0)
+    {
+        return;
+    }
+    m_ItemCells.resize(items);
+    m_Items.resize(items);
+    m_CellMinima.resize(cells);
+    m_CellMaxima.resize(cells);
+
+    // Each chunk counts its own boxes per cell, so that the boxes can then
+    // be scattered in parallel while keeping their order within a cell.
+    int chunks = Parallel::ChunkCount(items, MIN_ITEMS_PER_THREAD);
+    QVector<int> offsets(chunks*cells, 0);
+    int* offsetData = offsets.data();
+    int* itemCells = m_ItemCells.data();
+    Parallel::For(items, MIN_ITEMS_PER_THREAD,
+                  [this, minima, maxima, offsetData, itemCells, cells]
+                  (int chunk, int first, int last)
+    {
+        int* counts = offsetData + chunk*cells;
+        for (int i = first; i < last; ++i)
+        {
+            QVector3D centre = maxima ? (minima[i] + maxima[i])/2 : minima[i];
+            int cell = CellOf(centre);
+            itemCells[i] = cell;
+            ++counts[cell];
+        }
+    });
+
+    int total = 0;
+    for (int cell = 0; cell < cells; ++cell)
+    {
+        m_Starts[cell] = total;
+        for (int chunk = 0; chunk < chunks; ++chunk)
+        {
+            int count = offsetData[chunk*cells + cell];
+            offsetData[chunk*cells + cell] = total;
+            total += count;
+        }
+    }
+    m_Starts[cells] = total;
+
+    int* itemData = m_Items.data();
+    Parallel::For(items, MIN_ITEMS_PER_THREAD,
+                  [offsetData, itemCells, itemData, cells]
+                  (int chunk, int first, int last)
+    {
+        int* next = offsetData + chunk*cells;
+        for (int i = first; i < last; ++i)
+        {
+            itemData[next[itemCells[i]]++] = i;
+        }
+    });
+
+    const int* starts = m_Starts.constData();
+    QVector3D* cellMinima = m_CellMinima.data();
+    QVector3D* cellMaxima = m_CellMaxima.data();
+    QVector<QVector3D> reaches(Parallel::ChunkCount(cells,
+                                                    MIN_ITEMS_PER_THREAD/ITEMS_PER_CELL));
+    QVector3D* reachData = reaches.data();
+    Parallel::For(cells, MIN_ITEMS_PER_THREAD/ITEMS_PER_CELL,
+                  [this, minima, maxima, itemData, starts, cellMinima, cellMaxima,
+                   reachData]
+                  (int chunk, int first, int last)
+    {
+        float infinity = std::numeric_limits<float>::infinity();
+        for (int cell = first; cell < last; ++cell)
+        {
+            QVector3D low(infinity, infinity, infinity);
+            QVector3D high(-infinity, -infinity, -infinity);
+            for (int j = starts[cell]; j < starts[cell + 1]; ++j)
+            {
+                int item = itemData[j];
+                const QVector3D& itemLow = minima[item];
+                const QVector3D& itemHigh = maxima ? maxima[item] : minima[item];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    low[axis] = qMin(low[axis], itemLow[axis]);
+                    high[axis] = qMax(high[axis], itemHigh[axis]);
+                }
+            }
+            cellMinima[cell] = low;
+            cellMaxima[cell] = high;
+            if (starts[cell] == starts[cell + 1])
+            {
+                continue;
+            }
+
+            // Note how far the boxes reach beyond the cell itself.
+            int index = cell;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                int position = index % m_Dimensions[axis];
+                index /= m_Dimensions[axis];
+                if (m_Scale[axis] == 0)
+                {
+                    continue;
+                }
+                float cellLow = m_Minimum[axis] + position/m_Scale[axis];
+                float cellHigh = m_Minimum[axis] + (position + 1)/m_Scale[axis];
+                float reach = qMax(cellLow - low[axis], high[axis] - cellHigh);
+                reachData[chunk][axis] = qMax(reachData[chunk][axis], reach);
+            }
+        }
+    });
+    m_Reach = QVector3D();
+    for (int chunk = 0; chunk < reaches.length(); ++chunk)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            m_Reach[axis] = qMax(m_Reach[axis], reaches[chunk][axis]);
+        }
+    }
+}
+
+int SpatialGrid::GetCells() const
+{
+    return m_Dimensions[0]*m_Dimensions[1]*m_Dimensions[2];
+}
+
+int SpatialGrid::CellOf(const QVector3D& point) const
+{
+    int cell = 0;
+    for (int axis = 2; axis >= 0; --axis)
+    {
+        float position = (point[axis] - m_Minimum[axis])*m_Scale[axis];
+        int index = (int)qBound(0.0f, position, m_Dimensions[axis] - 1.0f);
+        cell = cell*m_Dimensions[axis] + index;
+    }
+    return cell;
+}
+
+int SpatialGrid::GetDimension(int axis) const
+{
+    return m_Dimensions[axis];
+}
+
+int SpatialGrid::GetCellFirst(int cell) const
+{
+    return m_Starts[cell];
+}
+
+const QVector<int>& SpatialGrid::GetSortedItems() const
+{
+    return m_Items;
+}
+
+int SpatialGrid::GetItems() const
+{
+    return m_Items.length();
+}
+
+bool SpatialGrid::Query(const Frustum& frustum, int maxItems,
+                        QVector<int>& items) const
+{
+    items.clear();
+    if (m_CellMinima.isEmpty())
+    {
+        return true;
+    }
+
+    QVector<int> cells;
+    int found = 0;
+    for (int cell = 0; cell < GetCells(); ++cell)
+    {
+        int count = m_Starts[cell + 1] - m_Starts[cell];
+        if (count > 0 && frustum.Intersects(m_CellMinima[cell], m_CellMaxima[cell]))
+        {
+            found += count;
+            if (found > maxItems)
+            {
+                return false;
+            }
+            cells.append(cell);
+        }
+    }
+
+    items.resize(found);
+    int* out = items.data();
+    for (int i = 0; i < cells.length(); ++i)
+    {
+        int first = m_Starts[cells[i]];
+        int count = m_Starts[cells[i] + 1] - first;
+        memcpy(out, m_Items.constData() + first, sizeof(int)*count);
+        out += count;
+    }
+    return true;
+}
+
+void SpatialGrid::QueryRay(const QVector3D& origin, const QVector3D& direction,
+                           float radius, QVector<int>& items) const
+{
+    items.clear();
+    if (m_CellMinima.isEmpty())
+    {
+        return;
+    }
+
+    // A cell's boxes lie within m_Reach of the cell, so only cells within
+    // the grown distance of the ray can be hit. Clip the ray to the grown
+    // grid, and find how many cells either side of the ray to look at.
+    QVector3D grown = m_Reach + QVector3D(radius, radius, radius);
+    float enter = 0;
+    float exit = std::numeric_limits<float>::infinity();
+    int spread[3];
+    int neighbours = 1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        spread[axis] = 0;
+        if (m_Scale[axis] == 0)
+        {
+            // A single cell covers the whole axis.
+            continue;
+        }
+        spread[axis] = qMin((int)(grown[axis]*m_Scale[axis]) + 1,
+                            m_Dimensions[axis]);
+        neighbours *= qMin(2*spread[axis] + 1, m_Dimensions[axis]);
+        float low = m_Minimum[axis] - grown[axis] - origin[axis];
+        float high = m_Minimum[axis] + m_Dimensions[axis]/m_Scale[axis]
+                + grown[axis] - origin[axis];
+        if (direction[axis] == 0)
+        {
+            if (low > 0 || high < 0)
+            {
+                return;
+            }
+            continue;
+        }
+        float lowHit = low/direction[axis];
+        float highHit = high/direction[axis];
+        enter = qMax(enter, qMin(lowHit, highHit));
+        exit = qMin(exit, qMax(lowHit, highHit));
+        if (enter > exit)
+        {
+            return;
+        }
+    }
+
+    // Walk the cells along the clipped ray (Amanatides and Woo), numbering
+    // them as if the grid carried on past its edges.
+    QVector3D start = origin + direction*enter;
+    int position[3];
+    int step[3];
+    float next[3];
+    float delta[3];
+    qint64 steps = 1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        position[axis] = 0;
+        step[axis] = 0;
+        next[axis] = std::numeric_limits<float>::infinity();
+        delta[axis] = std::numeric_limits<float>::infinity();
+        if (m_Scale[axis] == 0)
+        {
+            continue;
+        }
+        float along = (start[axis] - m_Minimum[axis])*m_Scale[axis];
+        position[axis] = qFloor(along);
+        float speed = direction[axis]*m_Scale[axis];
+        if (speed > 0)
+        {
+            step[axis] = 1;
+            delta[axis] = 1/speed;
+            next[axis] = enter + (position[axis] + 1 - along)*delta[axis];
+        }
+        else if (speed < 0)
+        {
+            step[axis] = -1;
+            delta[axis] = -1/speed;
+            next[axis] = enter + (along - position[axis])*delta[axis];
+        }
+        if (step[axis] != 0)
+        {
+            steps += (qint64)qMin((exit - enter)/delta[axis], (float)GetCells()) + 1;
+        }
+    }
+
+    QVector<int> cells;
+    if (steps*neighbours >= GetCells())
+    {
+        // The walk would look at more cells than there are, so look at each
+        // cell once instead.
+        cells.resize(GetCells());
+        for (int cell = 0; cell < cells.length(); ++cell)
+        {
+            cells[cell] = cell;
+        }
+    }
+    else
+    {
+        cells.reserve(steps*neighbours);
+        while (true)
+        {
+            int low[3];
+            int high[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                low[axis] = qMax(position[axis] - spread[axis], 0);
+                high[axis] = qMin(position[axis] + spread[axis],
+                                  m_Dimensions[axis] - 1);
+            }
+            for (int z = low[2]; z <= high[2]; ++z)
+            {
+                for (int y = low[1]; y <= high[1]; ++y)
+                {
+                    int row = (z*m_Dimensions[1] + y)*m_Dimensions[0];
+                    for (int x = low[0]; x <= high[0]; ++x)
+                    {
+                        cells.append(row + x);
+                    }
+                }
+            }
+
+            int axis = next[0] < next[1]
+                    ? (next[0] < next[2] ? 0 : 2)
+                    : (next[1] < next[2] ? 1 : 2);
+            if (step[axis] == 0 || next[axis] > exit)
+            {
+                break;
+            }
+            position[axis] += step[axis];
+            next[axis] += delta[axis];
+        }
+        // Neighbouring steps share most of their cells.
+        std::sort(cells.begin(), cells.end());
+        cells.resize(std::unique(cells.begin(), cells.end()) - cells.begin());
+    }
+
+    for (int i = 0; i < cells.length(); ++i)
+    {
+        int first = m_Starts[cells[i]];
+        int count = m_Starts[cells[i] + 1] - first;
+        if (count > 0 && rayHits(cells[i], origin, direction, radius))
+        {
+            items.resize(items.length() + count);
+            memcpy(items.data() + items.length() - count,
+                   m_Items.constData() + first, sizeof(int)*count);
+        }
+    }
+}
+
+qint64 SpatialGrid::GetBytes() const
+{
+    return sizeof(int)*((qint64)m_ItemCells.capacity() + m_Items.capacity()
+                        + m_Starts.capacity())
+            + sizeof(QVector3D)*((qint64)m_CellMinima.capacity()
+                                 + m_CellMaxima.capacity());
+}
+
+bool SpatialGrid::rayHits(int cell, const QVector3D& origin,
+                          const QVector3D& direction, float radius) const
+{
+    // Clip the ray to the slab of the grown cell along each axis, and keep
+    // the cell if any of the ray is left.
+    float enter = 0;
+    float exit = std::numeric_limits<float>::infinity();
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float low = m_CellMinima[cell][axis] - radius - origin[axis];
+        float high = m_CellMaxima[cell][axis] + radius - origin[axis];
+        if (direction[axis] == 0)
+        {
+            if (low > 0 || high < 0)
+            {
+                return false;
+            }
+            continue;
+        }
+        float lowHit = low/direction[axis];
+        float highHit = high/direction[axis];
+        enter = qMax(enter, qMin(lowHit, highHit));
+        exit = qMin(exit, qMax(lowHit, highHit));
+        if (enter > exit)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SpatialGrid::resetCells()
+{
+    m_Starts.fill(0, GetCells() + 1);
+    m_Items.clear();
+    m_ItemCells.clear();
+    m_CellMinima.clear();
+    m_CellMaxima.clear();
+    m_Reach = QVector3D();
+}
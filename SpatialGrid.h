@@ -0,0 +1,202 @@
+/**
+ * @file SpatialGrid.h
+ * @date 19 Oct 2026
+ * @see SpatialIndex.h
+ * @see Frustum.h
+ * @see CellList.h
+ * @brief This class sorts a set of boxes into the cells of a uniform grid,
+ * so that the boxes near a region of space can be found without testing
+ * every box.
+ *
+ * Each box is placed in the cell containing its centre, and each cell keeps
+ * the bounds of the boxes placed in it, which may reach beyond the cell.
+ * The cells are laid out by SetBounds() or SetCellSize() and can then be
+ * refilled many times by Build(), which is a counting sort over the cells
+ * split across the global thread pool. Within a cell the boxes keep their
+ * original order.
+ */
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include "Frustum.h"
+#include <QVector>
+#include <QVector3D>
+
+class SpatialGrid
+{
+public:
+    /**
+     * @brief Lays out the cells, keeping about ITEMS_PER_CELL boxes in each
+     * cell if the boxes are spread evenly.
+     * @param minimum The lowest corner of the region to cover.
+     * @param maximum The highest corner of the region to cover. Boxes with
+     * centres outside the region are placed in the nearest edge cell.
+     * @param items The number of boxes expected.
+     */
+    void SetBounds(const QVector3D& minimum, const QVector3D& maximum, int items);
+
+    /**
+     * @brief Lays out the cells so that every cell is at least a given size
+     * along each axis, and the cells exactly tile the region.
+     * @param minimum The lowest corner of the region to cover.
+     * @param maximum The highest corner of the region to cover.
+     * @param cellSize The smallest size of a cell.
+     */
+    void SetCellSize(const QVector3D& minimum, const QVector3D& maximum,
+                     float cellSize);
+
+    /**
+     * @brief Sorts a set of boxes into the cells.
+     * @param minima The lowest corner of each box.
+     * @param maxima The highest corner of each box, or 0 if the boxes are
+     * points given by @e minima.
+     * @param items The number of boxes.
+     */
+    void Build(const QVector3D* minima, const QVector3D* maxima, int items);
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The number of cells, or zero before SetBounds().
+     */
+    int GetCells() const;
+
+    /**
+     * @brief Returns the cell containing a point.
+     * @param point The point.
+     * @return The index of the cell, clamped to the grid.
+     */
+    int CellOf(const QVector3D& point) const;
+
+    /**
+     * @brief Returns the number of cells along an axis.
+     * @param axis The axis, from 0 to 2.
+     * @return The number of cells.
+     */
+    int GetDimension(int axis) const;
+
+    /**
+     * @brief Returns where the boxes of a cell start within
+     * GetSortedItems().
+     * @param cell The index of the cell, or the number of cells for the end
+     * of the last cell.
+     * @return The index of the first box of the cell.
+     */
+    int GetCellFirst(int cell) const;
+
+    /**
+     * @brief Returns the indices of the boxes, cell by cell.
+     * @return The indices.
+     */
+    const QVector<int>& GetSortedItems() const;
+
+    /**
+     * @brief Returns the number of boxes.
+     * @return The number of boxes passed to the last Build().
+     */
+    int GetItems() const;
+
+    /**
+     * @brief Finds the boxes of every cell which may overlap a frustum.
+     * @param frustum The frustum.
+     * @param maxItems The largest number of boxes worth returning.
+     * @param items Set to the indices of the boxes, cell by cell.
+     * @return true if at most @e maxItems boxes were found, false otherwise,
+     * in which case @e items is left empty.
+     */
+    bool Query(const Frustum& frustum, int maxItems, QVector<int>& items) const;
+
+    /**
+     * @brief Finds the boxes of every cell which may pass within a distance
+     * of a ray. Only the cells along the ray, and those near enough to it
+     * for their boxes to reach it, are looked at.
+     * @param origin The start of the ray.
+     * @param direction The direction of the ray, of unit length.
+     * @param radius The distance from the ray.
+     * @param items Set to the indices of the boxes, cell by cell.
+     */
+    void QueryRay(const QVector3D& origin, const QVector3D& direction,
+                  float radius, QVector<int>& items) const;
+
+    /**
+     * @brief Returns the number of bytes held.
+     * @return The number of bytes.
+     */
+    qint64 GetBytes() const;
+
+    /**
+     * @brief The number of boxes aimed for in each cell.
+     */
+    static const int ITEMS_PER_CELL = 64;
+
+private:
+    /**
+     * @brief Returns whether a ray passes within a distance of the bounds of
+     * the boxes in a cell.
+     * @param cell The index of the cell.
+     * @param origin The start of the ray.
+     * @param direction The direction of the ray.
+     * @param radius The distance from the ray.
+     * @return true if the ray passes near enough, false otherwise.
+     */
+    bool rayHits(int cell, const QVector3D& origin,
+                 const QVector3D& direction, float radius) const;
+
+    /**
+     * @brief Clears the boxes once the cells have been laid out.
+     */
+    void resetCells();
+
+    /**
+     * @brief The highest corner of the boxes in each cell.
+     */
+    QVector<QVector3D> m_CellMaxima;
+
+    /**
+     * @brief The lowest corner of the boxes in each cell.
+     */
+    QVector<QVector3D> m_CellMinima;
+
+    /**
+     * @brief The number of cells along each axis.
+     */
+    int m_Dimensions[3] = {0, 0, 0};
+
+    /**
+     * @brief The cell of each box, kept between builds.
+     */
+    QVector<int> m_ItemCells;
+
+    /**
+     * @brief The indices of the boxes, cell by cell.
+     */
+    QVector<int> m_Items;
+
+    /**
+     * @brief The lowest corner of the grid.
+     */
+    QVector3D m_Minimum;
+
+    /**
+     * @brief The furthest any box reaches beyond its cell along each axis.
+     */
+    QVector3D m_Reach;
+
+    /**
+     * @brief The number of cells per nm along each axis.
+     */
+    QVector3D m_Scale;
+
+    /**
+     * @brief The index in m_Items of the first box of each cell, followed by
+     * the number of boxes.
+     */
+    QVector<int> m_Starts;
+
+    /**
+     * @brief The smallest number of boxes worth handing to a thread.
+     */
+    static const int MIN_ITEMS_PER_THREAD = 4096;
+};
+
+#endif // SPATIALGRID_H
@@ -0,0 +1,134 @@
+#include "SpatialIndex.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include <QPair>
+#include <algorithm>
+#include <limits>
+
+void SpatialIndex::Build(const QVector<Atom*>& atoms, AtomTrajectory trajectory)
+{
+    TRACE_SCOPE("SpatialIndex::Build");
+    m_Atoms = atoms;
+    m_Trajectory = trajectory;
+    m_Frame = -1;
+    m_Positions.clear();
+
+    int count = m_Atoms.length();
+    QVector<QVector3D> minima(count);
+    QVector<QVector3D> maxima(count);
+    QVector3D* minimaData = minima.data();
+    QVector3D* maximaData = maxima.data();
+    Atom* const* atomData = m_Atoms.constData();
+    Parallel::For(count, MIN_ATOMS_PER_THREAD,
+                  [atomData, minimaData, maximaData, trajectory](int, int first, int last)
+    {
+        float infinity = std::numeric_limits<float>::infinity();
+        for (int i = first; i < last; ++i)
+        {
+            const QVector<QVector3D>& positions = (atomData[i]->*trajectory)();
+            QVector3D low(infinity, infinity, infinity);
+            QVector3D high(-infinity, -infinity, -infinity);
+            for (int j = 0; j < positions.length(); ++j)
+            {
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    low[axis] = qMin(low[axis], positions[j][axis]);
+                    high[axis] = qMax(high[axis], positions[j][axis]);
+                }
+            }
+            minimaData[i] = low;
+            maximaData[i] = high;
+        }
+    });
+
+    // Unwrapped paths leave the simulation box, so both grids cover the
+    // bounds of the paths instead.
+    QVector3D low;
+    QVector3D high;
+    for (int i = 0; i < count; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            low[axis] = i == 0 ? minima[i][axis] : qMin(low[axis], minima[i][axis]);
+            high[axis] = i == 0 ? maxima[i][axis] : qMax(high[axis], maxima[i][axis]);
+        }
+    }
+    m_PathGrid.SetBounds(low, high, count);
+    m_PathGrid.Build(minimaData, maximaData, count);
+    m_PointGrid.SetBounds(low, high, count);
+}
+
+int SpatialIndex::GetAtoms() const
+{
+    return m_Atoms.length();
+}
+
+void SpatialIndex::SetFrame(int frame)
+{
+    if (frame == m_Frame || m_Atoms.isEmpty())
+    {
+        return;
+    }
+    TRACE_SCOPE("SpatialIndex::SetFrame");
+    m_Frame = frame;
+
+    int count = m_Atoms.length();
+    m_Positions.resize(count);
+    QVector3D* positions = m_Positions.data();
+    Atom* const* atomData = m_Atoms.constData();
+    AtomTrajectory trajectory = m_Trajectory;
+    Parallel::For(count, MIN_ATOMS_PER_THREAD,
+                  [atomData, positions, frame, trajectory](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            positions[i] = (atomData[i]->*trajectory)()[frame];
+        }
+    });
+    m_PointGrid.Build(positions, 0, count);
+}
+
+bool SpatialIndex::CullPoints(const Frustum& frustum, int maxAtoms,
+                              QVector<int>& atoms) const
+{
+    return m_PointGrid.Query(frustum, maxAtoms, atoms);
+}
+
+bool SpatialIndex::CullPaths(const Frustum& frustum, int maxAtoms,
+                             QVector<int>& atoms) const
+{
+    return m_PathGrid.Query(frustum, maxAtoms, atoms);
+}
+
+void SpatialIndex::FindAlongRay(const QVector3D& origin,
+                                const QVector3D& direction,
+                                float radius, QVector<int>& atoms) const
+{
+    QVector<int> candidates;
+    m_PointGrid.QueryRay(origin, direction, radius, candidates);
+
+    QVector<QPair<float, int> > hits;
+    for (int i = 0; i < candidates.length(); ++i)
+    {
+        QVector3D offset = m_Positions[candidates[i]] - origin;
+        float along = QVector3D::dotProduct(offset, direction);
+        if (along >= 0 && offset.lengthSquared() - along*along <= radius*radius)
+        {
+            hits.append(qMakePair(along, candidates[i]));
+        }
+    }
+    std::sort(hits.begin(), hits.end());
+
+    atoms.resize(hits.length());
+    for (int i = 0; i < hits.length(); ++i)
+    {
+        atoms[i] = hits[i].second;
+    }
+}
+
+qint64 SpatialIndex::GetBytes() const
+{
+    return sizeof(Atom*)*(qint64)m_Atoms.capacity()
+            + sizeof(QVector3D)*(qint64)m_Positions.capacity()
+            + m_PathGrid.GetBytes() + m_PointGrid.GetBytes();
+}
@@ -0,0 +1,131 @@
+/**
+ * @file SpatialIndex.h
+ * @date 19 Oct 2026
+ * @see SpatialGrid.h
+ * @see MyOpenGLWidget.h
+ * @brief This class finds the atoms whose positions or paths may be seen
+ * through a frustum, so that zoomed in views only draw what is on screen.
+ *
+ * Paths are indexed once, by the bounding box of each whole path. Positions
+ * are indexed one frame at a time, in a grid laid out over the bounds of
+ * every path, so moving to another frame only re-sorts the atoms into the
+ * same cells rather than rebuilding the grid. The atoms are referred to by
+ * their index in the vector passed to Build(), which is the order of the
+ * vertex buffers.
+ */
+
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+#include "Atom.h"
+#include "Frustum.h"
+#include "SpatialGrid.h"
+#include <QVector>
+
+class SpatialIndex
+{
+public:
+    /**
+     * @brief Pointer to an @Atom getter for a layer of positions, such as
+     * the trajectory or the aligned trajectory.
+     */
+    typedef QVector<QVector3D>& (Atom::*AtomTrajectory)();
+
+    /**
+     * @brief Indexes the paths of a set of atoms.
+     * @param atoms The atoms, in the order of the vertex buffer. Every atom
+     * must have the same number of frames, and the atoms must outlive this
+     * object or the next call to Build().
+     * @param trajectory The @Atom getter for the positions drawn.
+     */
+    void Build(const QVector<Atom*>& atoms,
+               AtomTrajectory trajectory = &Atom::GetTrajectoryRef);
+
+    /**
+     * @brief Returns the number of atoms.
+     * @return The number of atoms.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Indexes the positions of the atoms at a frame, unless they are
+     * already indexed.
+     * @param frame The frame.
+     */
+    void SetFrame(int frame);
+
+    /**
+     * @brief Finds the atoms whose positions at the frame of the last call
+     * to SetFrame() may be inside a frustum.
+     * @param frustum The frustum, in the coordinates of the atoms.
+     * @param maxAtoms The largest number of atoms worth returning.
+     * @param atoms Set to the indices of the atoms.
+     * @return true if at most @e maxAtoms atoms were found, false otherwise.
+     */
+    bool CullPoints(const Frustum& frustum, int maxAtoms, QVector<int>& atoms) const;
+
+    /**
+     * @brief Finds the atoms whose paths may pass through a frustum.
+     * @param frustum The frustum, in the coordinates of the atoms.
+     * @param maxAtoms The largest number of atoms worth returning.
+     * @param atoms Set to the indices of the atoms.
+     * @return true if at most @e maxAtoms atoms were found, false otherwise.
+     */
+    bool CullPaths(const Frustum& frustum, int maxAtoms, QVector<int>& atoms) const;
+
+    /**
+     * @brief Finds the atoms whose positions at the frame of the last call
+     * to SetFrame() lie within a distance of a ray.
+     * @param origin The start of the ray, in the coordinates of the atoms.
+     * @param direction The direction of the ray, of unit length.
+     * @param radius The distance from the ray.
+     * @param atoms Set to the indices of the atoms, nearest to @e origin
+     * along the ray first.
+     */
+    void FindAlongRay(const QVector3D& origin, const QVector3D& direction,
+                      float radius, QVector<int>& atoms) const;
+
+    /**
+     * @brief Returns the number of bytes held.
+     * @return The number of bytes.
+     */
+    qint64 GetBytes() const;
+
+private:
+    /**
+     * @brief The atoms, in the order of the vertex buffer.
+     */
+    QVector<Atom*> m_Atoms;
+
+    /**
+     * @brief The frame whose positions are indexed, or -1 if none are.
+     */
+    int m_Frame = -1;
+
+    /**
+     * @brief The grid of the paths.
+     */
+    SpatialGrid m_PathGrid;
+
+    /**
+     * @brief The grid of the positions at m_Frame.
+     */
+    SpatialGrid m_PointGrid;
+
+    /**
+     * @brief The positions at m_Frame, kept between frames.
+     */
+    QVector<QVector3D> m_Positions;
+
+    /**
+     * @brief The layer of positions indexed.
+     */
+    AtomTrajectory m_Trajectory = &Atom::GetTrajectoryRef;
+
+    /**
+     * @brief The smallest number of atoms worth handing to a thread.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 4096;
+};
+
+#endif // SPATIALINDEX_H
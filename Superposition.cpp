@@ -0,0 +1,224 @@
+#include "Superposition.h"
+#include "Parallel.h"
+#include "SymmetricEigen.h"
+#include "Trace.h"
+#include <QtMath>
+
+QVector3D Superposition::Fit::Apply(const QVector3D& point) const
+{
+    QVector3D offset = point - centroid;
+    return QVector3D(rotation[0]*offset.x() + rotation[1]*offset.y()
+                     + rotation[2]*offset.z(),
+                     rotation[3]*offset.x() + rotation[4]*offset.y()
+                     + rotation[5]*offset.z(),
+                     rotation[6]*offset.x() + rotation[7]*offset.y()
+                     + rotation[8]*offset.z()) + referenceCentroid;
+}
+
+void Superposition::SetReference(const QVector<Atom*>& atoms, int frame)
+{
+    m_Atoms = atoms;
+    int count = atoms.length();
+    m_X.resize(count);
+    m_Y.resize(count);
+    m_Z.resize(count);
+    double sum[3] = {0, 0, 0};
+    for (int i = 0; i < count; ++i)
+    {
+        const QVector3D& position = atoms[i]->GetTrajectoryRef()[frame];
+        m_X[i] = position.x();
+        m_Y[i] = position.y();
+        m_Z[i] = position.z();
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            sum[axis] += position[axis];
+        }
+    }
+    m_Centroid = count > 0 ? QVector3D(sum[0]/count, sum[1]/count, sum[2]/count)
+                           : QVector3D();
+
+    m_SquaredSum = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        m_X[i] -= m_Centroid.x();
+        m_Y[i] -= m_Centroid.y();
+        m_Z[i] -= m_Centroid.z();
+        m_SquaredSum += (double)m_X[i]*m_X[i] + (double)m_Y[i]*m_Y[i]
+                      + (double)m_Z[i]*m_Z[i];
+    }
+}
+
+int Superposition::GetAtoms() const
+{
+    return m_Atoms.length();
+}
+
+void Superposition::FitFrames(QVector<Fit>& fits) const
+{
+    TRACE_SCOPE("Superposition::FitFrames");
+    fits.clear();
+    if (m_Atoms.isEmpty())
+    {
+        return;
+    }
+
+    int count = m_Atoms.length();
+    int frames = m_Atoms[0]->GetTrajectoryRef().length();
+    fits.resize(frames);
+    Fit* fitData = fits.data();
+    Atom* const* atoms = m_Atoms.constData();
+    Parallel::For(frames, MIN_FRAMES_PER_THREAD,
+                  [this, fitData, atoms, count](int, int first, int last)
+    {
+        QVector<float> x(count);
+        QVector<float> y(count);
+        QVector<float> z(count);
+        for (int frame = first; frame < last; ++frame)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                const QVector3D& position = atoms[i]->GetTrajectoryRef()[frame];
+                x[i] = position.x();
+                y[i] = position.y();
+                z[i] = position.z();
+            }
+            fitData[frame] = fitPositions(x.data(), y.data(), z.data());
+        }
+    });
+}
+
+void Superposition::CalculateFluctuation(const QVector<Atom*>& atoms,
+                                         const QVector<Fit>& fits)
+{
+    TRACE_SCOPE("Superposition::CalculateFluctuation");
+    Atom* const* atomData = atoms.constData();
+    const Fit* fitData = fits.constData();
+    int frames = fits.length();
+    Parallel::For(atoms.length(), MIN_ATOMS_PER_THREAD,
+                  [atomData, fitData, frames](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            const QVector3D* trajectory = atomData[i]->GetTrajectoryRef().constData();
+            double sum[3] = {0, 0, 0};
+            double squared = 0;
+            for (int frame = 0; frame < frames; ++frame)
+            {
+                QVector3D fitted = fitData[frame].Apply(trajectory[frame]);
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    sum[axis] += fitted[axis];
+                    squared += fitted[axis]*fitted[axis];
+                }
+            }
+            double variance = 0;
+            if (frames > 0)
+            {
+                variance = squared/frames;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    double mean = sum[axis]/frames;
+                    variance -= mean*mean;
+                }
+            }
+            atomData[i]->GetFluctuationRef().fill(qSqrt(qMax(0.0, variance)), 1);
+        }
+    });
+}
+
+void Superposition::Align(const QVector<Atom*>& atoms, const QVector<Fit>& fits)
+{
+    TRACE_SCOPE("Superposition::Align");
+    Atom* const* atomData = atoms.constData();
+    const Fit* fitData = fits.constData();
+    int frames = fits.length();
+    Parallel::For(atoms.length(), MIN_ATOMS_PER_THREAD,
+                  [atomData, fitData, frames](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            const QVector3D* trajectory = atomData[i]->GetTrajectoryRef().constData();
+            QVector<QVector3D>& aligned = atomData[i]->GetAlignedTrajectoryRef();
+            aligned.resize(frames);
+            QVector3D* alignedData = aligned.data();
+            for (int frame = 0; frame < frames; ++frame)
+            {
+                alignedData[frame] = fitData[frame].Apply(trajectory[frame]);
+            }
+        }
+    });
+}
+
+Superposition::Fit Superposition::fitPositions(const float* x, const float* y,
+                                                const float* z) const
+{
+    int count = m_Atoms.length();
+    double sum[3] = {0, 0, 0};
+    for (int i = 0; i < count; ++i)
+    {
+        sum[0] += x[i];
+        sum[1] += y[i];
+        sum[2] += z[i];
+    }
+    double centre[3] = {sum[0]/count, sum[1]/count, sum[2]/count};
+    Fit fit;
+    fit.centroid = QVector3D(centre[0], centre[1], centre[2]);
+    fit.referenceCentroid = m_Centroid;
+
+    // The correlation of the centred positions with the reference, where
+    // element ab is the sum of the a coordinates of the frame times the b
+    // coordinates of the reference. The products are taken in double, as
+    // the RMSD is the small difference of large sums.
+    const float* rx = m_X.constData();
+    const float* ry = m_Y.constData();
+    const float* rz = m_Z.constData();
+    double s[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double squaredSum = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        double px = x[i] - centre[0];
+        double py = y[i] - centre[1];
+        double pz = z[i] - centre[2];
+        s[0] += px*rx[i];
+        s[1] += px*ry[i];
+        s[2] += px*rz[i];
+        s[3] += py*rx[i];
+        s[4] += py*ry[i];
+        s[5] += py*rz[i];
+        s[6] += pz*rx[i];
+        s[7] += pz*ry[i];
+        s[8] += pz*rz[i];
+        squaredSum += px*px + py*py + pz*pz;
+    }
+
+    double horn[16] =
+    {
+        s[0] + s[4] + s[8], s[5] - s[7], s[6] - s[2], s[1] - s[3],
+        s[5] - s[7], s[0] - s[4] - s[8], s[1] + s[3], s[6] + s[2],
+        s[6] - s[2], s[1] + s[3], -s[0] + s[4] - s[8], s[5] + s[7],
+        s[1] - s[3], s[6] + s[2], s[5] + s[7], -s[0] - s[4] + s[8]
+    };
+    double values[4];
+    double vectors[16];
+    SymmetricEigen::Solve(horn, 4, values, vectors);
+
+    // The largest eigenvector, the first column, is the rotation as a unit
+    // quaternion.
+    double q0 = vectors[0];
+    double q1 = vectors[4];
+    double q2 = vectors[8];
+    double q3 = vectors[12];
+    fit.rotation[0] = q0*q0 + q1*q1 - q2*q2 - q3*q3;
+    fit.rotation[1] = 2*(q1*q2 - q0*q3);
+    fit.rotation[2] = 2*(q1*q3 + q0*q2);
+    fit.rotation[3] = 2*(q1*q2 + q0*q3);
+    fit.rotation[4] = q0*q0 - q1*q1 + q2*q2 - q3*q3;
+    fit.rotation[5] = 2*(q2*q3 - q0*q1);
+    fit.rotation[6] = 2*(q1*q3 - q0*q2);
+    fit.rotation[7] = 2*(q2*q3 + q0*q1);
+    fit.rotation[8] = q0*q0 - q1*q1 - q2*q2 + q3*q3;
+
+    double deviation = (squaredSum + m_SquaredSum - 2*values[0])/count;
+    fit.rmsd = qSqrt(qMax(0.0, deviation));
+    return fit;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file Superposition.h
+ * @date 19 Oct 2026
+ * @see SymmetricEigen.h
+ * @see FileReader.h
+ * @brief This class fits the frames of a set of atoms onto a reference
+ * frame by the rotation and translation which minimise their RMSD, and
+ * measures how far each atom fluctuates once the frames are fitted. The
+ * fitted positions can also be stored as an aligned trajectory, which
+ * removes the tumbling and drift of the whole selection from the paths.
+ *
+ * The optimal rotation of the Kabsch problem is found by Horn's quaternion
+ * method: the largest eigenvector of a 4x4 matrix built from the correlation
+ * of the centred positions is the rotation as a unit quaternion, and its
+ * eigenvalue gives the RMSD directly. The positions of each frame are
+ * gathered into separate x, y and z arrays, so the centroid and correlation
+ * are plain sums over contiguous floats rather than over scattered
+ * QVector3Ds. Frames are split across the global thread pool, each thread
+ * keeping its own arrays.
+ */
+
+#ifndef SUPERPOSITION_H
+#define SUPERPOSITION_H
+
+#include "Atom.h"
+#include <QVector>
+#include <QVector3D>
+
+class Superposition
+{
+public:
+    /**
+     * @brief The rigid motion which fits one frame onto the reference.
+     */
+    struct Fit
+    {
+        /**
+         * @brief The rotation, row by row.
+         */
+        float rotation[9];
+
+        /**
+         * @brief The centroid of the fitted atoms at the frame.
+         */
+        QVector3D centroid;
+
+        /**
+         * @brief The centroid of the fitted atoms at the reference frame.
+         */
+        QVector3D referenceCentroid;
+
+        /**
+         * @brief The RMSD of the fitted atoms from the reference after the
+         * fit, in nm.
+         */
+        float rmsd;
+
+        /**
+         * @brief Moves a point of the frame onto the reference.
+         * @param point The point.
+         * @return The point, rotated about the centroid of the frame and
+         * moved onto the centroid of the reference.
+         */
+        QVector3D Apply(const QVector3D& point) const;
+    };
+
+    /**
+     * @brief Sets the atoms which are fitted and the frame they are fitted
+     * onto.
+     * @param atoms The atoms. Every atom must have the same number of
+     * frames, and the atoms must outlive this object or the next call to
+     * SetReference().
+     * @param frame The reference frame.
+     */
+    void SetReference(const QVector<Atom*>& atoms, int frame);
+
+    /**
+     * @brief Returns the number of atoms fitted.
+     * @return The number of atoms.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Fits every frame onto the reference, splitting the frames
+     * across the global thread pool.
+     * @param fits Set to the fit of each frame.
+     */
+    void FitFrames(QVector<Fit>& fits) const;
+
+    /**
+     * @brief Calculates the root mean square fluctuation of every @Atom in
+     * @e atoms about its mean position once each frame has been fitted, and
+     * stores it in each @Atom, splitting the atoms across the global thread
+     * pool.
+     * @param atoms The atoms, which need not be the atoms fitted.
+     * @param fits The fit of each frame, from FitFrames().
+     */
+    static void CalculateFluctuation(const QVector<Atom*>& atoms,
+                                     const QVector<Fit>& fits);
+
+    /**
+     * @brief Moves every frame of each @Atom in @e atoms onto the reference
+     * and stores the positions as its aligned trajectory, splitting the
+     * atoms across the global thread pool.
+     * @param atoms The atoms, which need not be the atoms fitted.
+     * @param fits The fit of each frame, from FitFrames().
+     */
+    static void Align(const QVector<Atom*>& atoms, const QVector<Fit>& fits);
+
+private:
+    /**
+     * @brief Fits one frame onto the reference.
+     * @param x The x coordinates of the atoms at the frame.
+     * @param y The y coordinates.
+     * @param z The z coordinates.
+     * @return The fit.
+     */
+    Fit fitPositions(const float* x, const float* y, const float* z) const;
+
+    /**
+     * @brief The atoms fitted.
+     */
+    QVector<Atom*> m_Atoms;
+
+    /**
+     * @brief The centroid of the atoms at the reference frame.
+     */
+    QVector3D m_Centroid;
+
+    /**
+     * @brief The sum of the squared distances of the atoms from their
+     * centroid at the reference frame.
+     */
+    double m_SquaredSum = 0;
+
+    /**
+     * @brief The x coordinates at the reference frame, about the centroid.
+     */
+    QVector<float> m_X;
+
+    /**
+     * @brief The y coordinates at the reference frame, about the centroid.
+     */
+    QVector<float> m_Y;
+
+    /**
+     * @brief The z coordinates at the reference frame, about the centroid.
+     */
+    QVector<float> m_Z;
+
+    /**
+     * @brief The smallest number of frames worth handing to a thread.
+     */
+    static const int MIN_FRAMES_PER_THREAD = 4;
+
+    /**
+     * @brief The smallest number of atoms worth handing to a thread.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 1024;
+};
+
+#endif // SUPERPOSITION_H
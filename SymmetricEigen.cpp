@@ -0,0 +1,97 @@
+#include "SymmetricEigen.h"
+#include <QtMath>
+#include <utility>
+
+void SymmetricEigen::Solve(double* matrix, int n, double* values, double* vectors)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            vectors[i*n + j] = i == j ? 1 : 0;
+        }
+    }
+
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep)
+    {
+        double offDiagonal = 0;
+        double diagonal = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            diagonal += matrix[i*n + i]*matrix[i*n + i];
+            for (int j = i + 1; j < n; ++j)
+            {
+                offDiagonal += matrix[i*n + j]*matrix[i*n + j];
+            }
+        }
+        if (offDiagonal <= 1e-30*qMax(diagonal, 1e-300))
+        {
+            break;
+        }
+
+        for (int p = 0; p < n; ++p)
+        {
+            for (int q = p + 1; q < n; ++q)
+            {
+                double apq = matrix[p*n + q];
+                if (apq == 0)
+                {
+                    continue;
+                }
+                // The rotation which zeroes element (p, q), choosing the
+                // smaller angle for stability.
+                double theta = (matrix[q*n + q] - matrix[p*n + p])/(2*apq);
+                double t = (theta >= 0 ? 1 : -1)
+                        /(qAbs(theta) + qSqrt(theta*theta + 1));
+                double c = 1/qSqrt(t*t + 1);
+                double s = t*c;
+                for (int k = 0; k < n; ++k)
+                {
+                    double akp = matrix[k*n + p];
+                    double akq = matrix[k*n + q];
+                    matrix[k*n + p] = c*akp - s*akq;
+                    matrix[k*n + q] = s*akp + c*akq;
+                }
+                for (int k = 0; k < n; ++k)
+                {
+                    double apk = matrix[p*n + k];
+                    double aqk = matrix[q*n + k];
+                    matrix[p*n + k] = c*apk - s*aqk;
+                    matrix[q*n + k] = s*apk + c*aqk;
+                }
+                for (int k = 0; k < n; ++k)
+                {
+                    double vkp = vectors[k*n + p];
+                    double vkq = vectors[k*n + q];
+                    vectors[k*n + p] = c*vkp - s*vkq;
+                    vectors[k*n + q] = s*vkp + c*vkq;
+                }
+            }
+        }
+    }
+
+    // Sort the eigenvalues, and their columns, largest first.
+    for (int i = 0; i < n; ++i)
+    {
+        values[i] = matrix[i*n + i];
+    }
+    for (int i = 0; i < n; ++i)
+    {
+        int largest = i;
+        for (int j = i + 1; j < n; ++j)
+        {
+            if (values[j] > values[largest])
+            {
+                largest = j;
+            }
+        }
+        if (largest != i)
+        {
+            std::swap(values[i], values[largest]);
+            for (int k = 0; k < n; ++k)
+            {
+                std::swap(vectors[k*n + i], vectors[k*n + largest]);
+            }
+        }
+    }
+}
@@ -0,0 +1,37 @@
+/**
+ * @file SymmetricEigen.h
+ * @date 19 Oct 2026
+ * @see Superposition.h
+ * @brief This class finds the eigenvalues and eigenvectors of small real
+ * symmetric matrices.
+ *
+ * The cyclic Jacobi method is used, which zeroes each off-diagonal element
+ * in turn with a plane rotation until the matrix is diagonal to within
+ * rounding. It takes O(n^3) time per sweep and converges in a handful of
+ * sweeps, which suits the 4x4 matrices of a superposition and the small
+ * projected matrices of an iterative solver, but not large matrices.
+ */
+
+#ifndef SYMMETRICEIGEN_H
+#define SYMMETRICEIGEN_H
+
+class SymmetricEigen
+{
+public:
+    /**
+     * @brief Finds every eigenvalue and eigenvector of a symmetric matrix.
+     * @param matrix The n x n matrix, row by row. It is overwritten.
+     * @param n The number of rows.
+     * @param values Set to the n eigenvalues, largest first.
+     * @param vectors Set to the n x n matrix whose column i is the unit
+     * eigenvector of values[i], row by row.
+     */
+    static void Solve(double* matrix, int n, double* values, double* vectors);
+
+    /**
+     * @brief The largest number of sweeps over the off-diagonal elements.
+     */
+    static const int MAX_SWEEPS = 50;
+};
+
+#endif // SYMMETRICEIGEN_H
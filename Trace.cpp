@@ -0,0 +1,178 @@
+#include "Trace.h"
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+#include <chrono>
+
+namespace
+{
+    /**
+     * @brief A finished span.
+     */
+    struct Event
+    {
+        const char* name;
+        qint64 start;
+        qint64 end;
+    };
+
+    /**
+     * @brief The number of spans each thread keeps. Must be a power of two.
+     */
+    const quint64 BUFFER_SIZE = 1 << 14;
+
+    /**
+     * @brief The spans recorded by one thread. Only the owning thread writes
+     * to a buffer, and it publishes each span by advancing @e written.
+     */
+    struct ThreadBuffer
+    {
+        Event events[BUFFER_SIZE];
+        std::atomic<quint64> written;
+        int id;
+        QString threadName;
+        ThreadBuffer* next;
+    };
+
+    /**
+     * @brief The head of the list of every thread's buffer. Buffers are only
+     * ever added, and live until the program exits, so that spans from
+     * threads which have finished can still be exported.
+     */
+    std::atomic<ThreadBuffer*> g_Buffers(nullptr);
+
+    /**
+     * @brief The number of buffers created, used to give each thread an id.
+     */
+    std::atomic<int> g_BufferCount(0);
+
+    /**
+     * @brief Whether spans are being recorded.
+     */
+    std::atomic<bool> g_Enabled(true);
+
+    /**
+     * @brief The calling thread's buffer, created on its first span.
+     */
+    thread_local ThreadBuffer* t_Buffer = nullptr;
+
+    /**
+     * @brief Returns the calling thread's buffer, creating and registering it
+     * if needed.
+     */
+    ThreadBuffer* threadBuffer()
+    {
+        if (!t_Buffer)
+        {
+            ThreadBuffer* buffer = new ThreadBuffer();
+            buffer->written.store(0, std::memory_order_relaxed);
+            buffer->id = g_BufferCount.fetch_add(1) + 1;
+            QThread* thread = QThread::currentThread();
+            buffer->threadName = thread ? thread->objectName() : QString();
+            if (buffer->threadName.isEmpty())
+            {
+                buffer->threadName = "Thread " + QString::number(buffer->id);
+            }
+            buffer->next = g_Buffers.load();
+            while (!g_Buffers.compare_exchange_weak(buffer->next, buffer))
+            {
+            }
+            t_Buffer = buffer;
+        }
+        return t_Buffer;
+    }
+
+    /**
+     * @brief Escapes a string for use inside a JSON string literal.
+     */
+    QString escapeJson(const QString& text)
+    {
+        QString escaped = text;
+        escaped.replace("\\", "\\\\");
+        escaped.replace("\"", "\\\"");
+        return escaped;
+    }
+}
+
+qint64 Trace::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Trace::Record(const char* name, qint64 start, qint64 end)
+{
+    ThreadBuffer* buffer = threadBuffer();
+    quint64 index = buffer->written.load(std::memory_order_relaxed);
+    Event& event = buffer->events[index & (BUFFER_SIZE - 1)];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    buffer->written.store(index + 1, std::memory_order_release);
+}
+
+void Trace::SetEnabled(bool enabled)
+{
+    g_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Trace::IsEnabled()
+{
+    return g_Enabled.load(std::memory_order_relaxed);
+}
+
+bool Trace::WriteChromeJson(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    QVector<Event> events;
+    for (ThreadBuffer* buffer = g_Buffers.load(); buffer; buffer = buffer->next)
+    {
+        quint64 written = buffer->written.load(std::memory_order_acquire);
+        quint64 oldest = written > BUFFER_SIZE ? written - BUFFER_SIZE : 0;
+        events.clear();
+        for (quint64 i = oldest; i < written; ++i)
+        {
+            events.append(buffer->events[i & (BUFFER_SIZE - 1)]);
+        }
+
+        // Discard any spans the owning thread may have overwritten, or been
+        // overwriting, while they were being copied.
+        quint64 rewritten = buffer->written.load(std::memory_order_acquire) + 1;
+        int overwritten = (int)qMin((quint64)events.size(),
+                                    rewritten > BUFFER_SIZE + oldest
+                                    ? rewritten - BUFFER_SIZE - oldest : 0);
+        events.remove(0, overwritten);
+
+        if (!first)
+        {
+            out << ",";
+        }
+        first = false;
+        out << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << buffer->id << ",\"args\":{\"name\":\""
+            << escapeJson(buffer->threadName) << "\"}}";
+
+        for (int i = 0; i < events.size(); ++i)
+        {
+            out << ",\n{\"name\":\"" << escapeJson(events[i].name)
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id
+                << ",\"ts\":" << QString::number(events[i].start/1000.0, 'f', 3)
+                << ",\"dur\":"
+                << QString::number((events[i].end - events[i].start)/1000.0, 'f', 3)
+                << "}";
+        }
+    }
+    out << "\n]}\n";
+    out.flush();
+    return out.status() == QTextStream::Ok;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file Trace.h
+ * @date 19 Oct 2026
+ * @brief Provides lightweight scoped timing spans which can be exported in
+ * the Chrome trace event format.
+ *
+ * A span is opened with TRACE_SCOPE("Name") and closed when the enclosing
+ * scope ends. Each thread records its finished spans into its own fixed size
+ * ring buffer, so recording takes no locks and, once the buffer is full, the
+ * oldest spans are overwritten. WriteChromeJson() collects the spans from
+ * every thread into a file which can be opened in chrome://tracing or
+ * Perfetto to show where time was spent.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QString>
+#include <QtGlobal>
+
+namespace Trace
+{
+    /**
+     * @brief Returns the current time on the trace clock.
+     * @return The time in nanoseconds since an arbitrary fixed point.
+     */
+    qint64 Now();
+
+    /**
+     * @brief Records a finished span for the calling thread.
+     * @param name The name of the span. This must stay valid for the lifetime
+     * of the program, such as a string literal.
+     * @param start The time the span started, from Now().
+     * @param end The time the span ended, from Now().
+     */
+    void Record(const char* name, qint64 start, qint64 end);
+
+    /**
+     * @brief Turns recording of spans on or off. Recording is on by default.
+     * @param enabled true to record spans.
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether spans are being recorded.
+     * @return true if spans are being recorded.
+     */
+    bool IsEnabled();
+
+    /**
+     * @brief Writes every span still held in the ring buffers to a file in
+     * the Chrome trace event JSON format.
+     * @param filePath The path of the file to be written.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool WriteChromeJson(const QString& filePath);
+
+    /**
+     * @brief Records the time between its construction and destruction as a
+     * span. Use through the TRACE_SCOPE macro.
+     */
+    class Span
+    {
+    public:
+        /**
+         * @brief Constructor, starting the span.
+         * @param name The name of the span, such as a string literal.
+         */
+        explicit Span(const char* name)
+            : m_Name(IsEnabled() ? name : 0),
+              m_Start(m_Name ? Now() : 0)
+        {
+        }
+
+        /**
+         * @brief Destructor, recording the span.
+         */
+        ~Span()
+        {
+            if (m_Name)
+            {
+                Record(m_Name, m_Start, Now());
+            }
+        }
+
+    private:
+        Q_DISABLE_COPY(Span)
+
+        /**
+         * @brief The name of the span, or null if it is not being recorded.
+         */
+        const char* m_Name;
+
+        /**
+         * @brief The time the span started.
+         */
+        qint64 m_Start;
+    };
+}
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Records the rest of the enclosing scope as a span called @e name.
+ */
+#define TRACE_SCOPE(name) Trace::Span TRACE_CONCAT(traceSpan, __LINE__)(name)
+
+#endif // TRACE_H
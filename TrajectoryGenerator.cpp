@@ -0,0 +1,279 @@
+#include "TrajectoryGenerator.h"
+#include "Parallel.h"
+#include "xdrfile.h"
+#include "xdrfile_xtc.h"
+#include <QFile>
+#include <QTextStream>
+#include <QtMath>
+
+namespace
+{
+    /**
+     * @brief Random number streams, so that the same index gives independent
+     * numbers for each purpose.
+     */
+    enum Stream
+    {
+        CENTRE_STREAM,
+        OFFSET_STREAM,
+        STEP_STREAM,
+        VIBRATION_STREAM
+    };
+
+    /**
+     * @brief The SplitMix64 finaliser, which mixes the bits of a 64 bit value.
+     * @param x The value to be mixed.
+     * @return The mixed value.
+     */
+    inline quint64 mix(quint64 x)
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30))*0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27))*0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Hashes a seed, a stream and two indices into 32 random bits.
+     * @param seed The seed of the trajectory.
+     * @param stream The purpose the number is used for.
+     * @param index The atom or residue index.
+     * @param frame The frame index.
+     * @return The hashed bits.
+     */
+    inline quint32 hash(quint32 seed, quint32 stream, quint32 index, quint32 frame)
+    {
+        quint64 x = mix(((quint64)seed << 32) | stream);
+        x = mix(x ^ index);
+        x = mix(x ^ frame);
+        return (quint32)(x >> 32);
+    }
+
+    /**
+     * @brief Returns a uniform random number in the range (0, 1].
+     */
+    inline float uniform(quint32 seed, quint32 stream, quint32 index, quint32 frame)
+    {
+        return ((hash(seed, stream, index, frame) >> 8) + 1.0f)/(1 << 24);
+    }
+
+    /**
+     * @brief Returns three normally distributed random numbers, with a mean of
+     * zero and a standard deviation of one, using the Box-Muller transform.
+     */
+    inline void gaussian3(quint32 seed, quint32 stream, quint32 index,
+                          quint32 frame, float* result)
+    {
+        float u1 = uniform(seed, stream, 4*index, frame);
+        float u2 = uniform(seed, stream, 4*index + 1, frame);
+        float u3 = uniform(seed, stream, 4*index + 2, frame);
+        float u4 = uniform(seed, stream, 4*index + 3, frame);
+        float r1 = sqrtf(-2.0f*logf(u1));
+        float r2 = sqrtf(-2.0f*logf(u3));
+        result[0] = r1*cosf(2.0f*(float)M_PI*u2);
+        result[1] = r1*sinf(2.0f*(float)M_PI*u2);
+        result[2] = r2*cosf(2.0f*(float)M_PI*u4);
+    }
+}
+
+TrajectoryGenerator::Settings::Settings()
+    : atoms(1000),
+      frames(100),
+      atomsPerResidue(3),
+      boxLength(10.0f),
+      diffusion(0.05f),
+      drift(0, 0, 0),
+      residueRadius(0.15f),
+      vibration(0.005f),
+      timeStep(10.0f),
+      precision(1000.0f),
+      seed(12345),
+      wrap(true),
+      residueNames(QStringList() << "SOL"),
+      atomNames(QStringList() << "OW" << "HW1" << "HW2")
+{
+}
+
+TrajectoryGenerator::TrajectoryGenerator(const Settings& settings)
+    : m_Settings(settings)
+{
+}
+
+QString TrajectoryGenerator::GetError() const
+{
+    return m_Error;
+}
+
+bool TrajectoryGenerator::Write(const QString& groFilePath,
+                                const QString& xtcFilePath)
+{
+    m_Error.clear();
+    if (m_Settings.atoms < 1 || m_Settings.frames < 1
+            || m_Settings.atomsPerResidue < 1 || m_Settings.boxLength <= 0
+            || m_Settings.residueNames.isEmpty()
+            || m_Settings.atomNames.isEmpty())
+    {
+        m_Error = "Invalid trajectory settings.";
+        return false;
+    }
+
+    initialise();
+    QVector<float> positions(m_Settings.atoms*3);
+    generateFrame(0, positions.data());
+    if (!writeGro(groFilePath, positions.constData()))
+    {
+        return false;
+    }
+
+    QByteArray xtcPath = xtcFilePath.toLocal8Bit();
+    XDRFILE* xtcFile = xdrfile_open(xtcPath.data(), "w");
+    if (xtcFile == NULL)
+    {
+        m_Error = "Could not open " + xtcFilePath + " for writing.";
+        return false;
+    }
+
+    float length = m_Settings.boxLength;
+    matrix box = {{length, 0, 0}, {0, length, 0}, {0, 0, length}};
+    for (int i = 0; i < m_Settings.frames; ++i)
+    {
+        if (i > 0)
+        {
+            stepResidues(i);
+            generateFrame(i, positions.data());
+        }
+        int result = write_xtc(xtcFile, m_Settings.atoms, i,
+                               i*m_Settings.timeStep, box,
+                               reinterpret_cast<rvec*>(positions.data()),
+                               m_Settings.precision);
+        if (result != exdrOK)
+        {
+            xdrfile_close(xtcFile);
+            m_Error = "Failed while writing " + xtcFilePath + ".";
+            return false;
+        }
+    }
+    xdrfile_close(xtcFile);
+    return true;
+}
+
+void TrajectoryGenerator::generateFrame(int frame, float* positions)
+{
+    const float* centres = m_Centres.constData();
+    const float* offsets = m_Offsets.constData();
+    const Settings& settings = m_Settings;
+    Parallel::For(settings.atoms, MIN_ATOMS_PER_THREAD,
+                  [=, &settings](int, int first, int last)
+    {
+        float length = settings.boxLength;
+        for (int i = first; i < last; ++i)
+        {
+            const float* centre = centres + 3*(i/settings.atomsPerResidue);
+            float vibration[3];
+            gaussian3(settings.seed, VIBRATION_STREAM, i, frame, vibration);
+            for (int j = 0; j < 3; ++j)
+            {
+                float position = centre[j] + offsets[3*i + j]
+                               + settings.vibration*vibration[j];
+                if (settings.wrap)
+                {
+                    position -= length*floorf(position/length);
+                }
+                positions[3*i + j] = position;
+            }
+        }
+    });
+}
+
+void TrajectoryGenerator::initialise()
+{
+    int residues = (m_Settings.atoms + m_Settings.atomsPerResidue - 1)
+                 / m_Settings.atomsPerResidue;
+    m_Centres.resize(residues*3);
+    for (int i = 0; i < m_Centres.length(); ++i)
+    {
+        m_Centres[i] = m_Settings.boxLength
+                     * uniform(m_Settings.seed, CENTRE_STREAM, i, 0);
+    }
+
+    m_Offsets.resize(m_Settings.atoms*3);
+    for (int i = 0; i < m_Settings.atoms; ++i)
+    {
+        // Rejection sampling of a point in the unit sphere.
+        float x, y, z;
+        int attempt = 0;
+        do
+        {
+            x = 2*uniform(m_Settings.seed, OFFSET_STREAM, 3*i, attempt) - 1;
+            y = 2*uniform(m_Settings.seed, OFFSET_STREAM, 3*i + 1, attempt) - 1;
+            z = 2*uniform(m_Settings.seed, OFFSET_STREAM, 3*i + 2, attempt) - 1;
+            ++attempt;
+        } while (x*x + y*y + z*z > 1);
+        m_Offsets[3*i] = m_Settings.residueRadius*x;
+        m_Offsets[3*i + 1] = m_Settings.residueRadius*y;
+        m_Offsets[3*i + 2] = m_Settings.residueRadius*z;
+    }
+}
+
+void TrajectoryGenerator::stepResidues(int frame)
+{
+    float* centres = m_Centres.data();
+    const Settings& settings = m_Settings;
+    Parallel::For(m_Centres.length()/3, MIN_ATOMS_PER_THREAD,
+                  [=, &settings](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            float step[3];
+            gaussian3(settings.seed, STEP_STREAM, i, frame, step);
+            centres[3*i] += settings.diffusion*step[0] + settings.drift.x();
+            centres[3*i + 1] += settings.diffusion*step[1] + settings.drift.y();
+            centres[3*i + 2] += settings.diffusion*step[2] + settings.drift.z();
+        }
+    });
+}
+
+bool TrajectoryGenerator::writeGro(const QString& groFilePath,
+                                   const float* positions)
+{
+    QFile groFile(groFilePath);
+    if (!groFile.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        m_Error = "Could not open " + groFilePath + " for writing.";
+        return false;
+    }
+
+    // .gro files have fixed width columns, so residue and atom numbers wrap
+    // around after 99999, as they do in files written by GROMACS.
+    const int GRO_NUMBER_LIMIT = 100000;
+    QTextStream gro(&groFile);
+    gro << "MDVis synthetic trajectory, seed " << m_Settings.seed << "\n"
+        << m_Settings.atoms << "\n";
+    for (int i = 0; i < m_Settings.atoms; ++i)
+    {
+        int residue = i/m_Settings.atomsPerResidue;
+        int atomInResidue = i % m_Settings.atomsPerResidue;
+        const QString& residueName = m_Settings.residueNames[
+                residue % m_Settings.residueNames.length()];
+        const QString& atomName = m_Settings.atomNames[
+                atomInResidue % m_Settings.atomNames.length()];
+        gro << QString("%1%2%3%4%5%6%7\n")
+               .arg((residue + 1) % GRO_NUMBER_LIMIT, 5)
+               .arg(residueName.left(5), -5)
+               .arg(atomName.left(5), 5)
+               .arg((i + 1) % GRO_NUMBER_LIMIT, 5)
+               .arg(positions[3*i], 8, 'f', 3)
+               .arg(positions[3*i + 1], 8, 'f', 3)
+               .arg(positions[3*i + 2], 8, 'f', 3);
+    }
+    float length = m_Settings.boxLength;
+    gro << QString("%1%2%3\n").arg(length, 10, 'f', 5)
+           .arg(length, 10, 'f', 5).arg(length, 10, 'f', 5);
+    gro.flush();
+    if (gro.status() != QTextStream::Ok)
+    {
+        m_Error = "Failed while writing " + groFilePath + ".";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file TrajectoryGenerator.h
+ * @date 19 Oct 2026
+ * @brief This class writes synthetic .gro and .xtc file pairs, for testing and
+ * benchmarking without real simulation data.
+ *
+ * Atoms are grouped into residues. Each residue centre follows a random walk
+ * with an optional constant drift, and its atoms sit at fixed offsets from
+ * the centre with a small vibration. Positions can be wrapped into the
+ * periodic box, as a simulation package would, so that the unwrapping done
+ * on load is exercised.
+ *
+ * Random numbers are derived by hashing the seed with the atom or residue
+ * and frame indices, so the output depends only on the settings and frames
+ * can be generated in parallel. Frames are generated and written one at a
+ * time, so memory use stays proportional to the number of atoms.
+ */
+
+#ifndef TRAJECTORYGENERATOR_H
+#define TRAJECTORYGENERATOR_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QVector3D>
+
+class TrajectoryGenerator
+{
+public:
+    /**
+     * @brief The parameters of a generated trajectory.
+     */
+    struct Settings
+    {
+        /**
+         * @brief Constructor, setting every parameter to its default.
+         */
+        Settings();
+
+        /**
+         * @brief The number of atoms.
+         */
+        int atoms;
+
+        /**
+         * @brief The number of frames.
+         */
+        int frames;
+
+        /**
+         * @brief The number of atoms in each residue. The last residue may
+         * have fewer.
+         */
+        int atomsPerResidue;
+
+        /**
+         * @brief The length of each side of the cubic simulation box, in nm.
+         */
+        float boxLength;
+
+        /**
+         * @brief The standard deviation of the random step taken by each
+         * residue centre in each frame, along each axis, in nm.
+         */
+        float diffusion;
+
+        /**
+         * @brief The constant displacement of every residue in each frame, in
+         * nm.
+         */
+        QVector3D drift;
+
+        /**
+         * @brief The largest distance of an atom from its residue centre, in
+         * nm.
+         */
+        float residueRadius;
+
+        /**
+         * @brief The standard deviation of the vibration of each atom about
+         * its place in the residue, in nm.
+         */
+        float vibration;
+
+        /**
+         * @brief The time between frames, in ps.
+         */
+        float timeStep;
+
+        /**
+         * @brief The precision the .xtc positions are stored with.
+         */
+        float precision;
+
+        /**
+         * @brief The seed for the random numbers.
+         */
+        quint32 seed;
+
+        /**
+         * @brief If true, positions are wrapped back into the box.
+         */
+        bool wrap;
+
+        /**
+         * @brief Residue names, assigned to residues in turn.
+         */
+        QStringList residueNames;
+
+        /**
+         * @brief Atom names, assigned to the atoms of each residue in turn.
+         */
+        QStringList atomNames;
+    };
+
+    /**
+     * @brief Constructor.
+     * @param settings The parameters of the trajectory to be generated.
+     */
+    explicit TrajectoryGenerator(const Settings& settings);
+
+    /**
+     * @brief Returns a description of the last error, if Write() failed.
+     * @return The error message.
+     */
+    QString GetError() const;
+
+    /**
+     * @brief Generates the trajectory and writes it to disk.
+     * @param groFilePath The path of the .gro file, containing the first frame.
+     * @param xtcFilePath The path of the .xtc file, containing every frame.
+     * @return true if both files were written successfully, false otherwise.
+     */
+    bool Write(const QString& groFilePath, const QString& xtcFilePath);
+
+private:
+    /**
+     * @brief Calculates the positions of every atom at a frame.
+     * @param frame The index of the frame.
+     * @param positions The array of atoms*3 floats to be filled.
+     */
+    void generateFrame(int frame, float* positions);
+
+    /**
+     * @brief Places every residue centre and atom offset at random, before
+     * the first frame.
+     */
+    void initialise();
+
+    /**
+     * @brief Advances every residue centre by one frame.
+     * @param frame The index of the frame being advanced to.
+     */
+    void stepResidues(int frame);
+
+    /**
+     * @brief Writes the .gro file for the first frame.
+     * @param groFilePath The path of the .gro file.
+     * @param positions The positions of the atoms at the first frame.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool writeGro(const QString& groFilePath, const float* positions);
+
+    /**
+     * @brief The unwrapped positions of the residue centres, as x, y and z
+     * for each residue.
+     */
+    QVector<float> m_Centres;
+
+    /**
+     * @brief The last error message.
+     */
+    QString m_Error;
+
+    /**
+     * @brief The offsets of the atoms from their residue centre, as x, y and
+     * z for each atom.
+     */
+    QVector<float> m_Offsets;
+
+    /**
+     * @brief The parameters of the trajectory.
+     */
+    Settings m_Settings;
+
+    /**
+     * @brief The smallest number of atoms worth handing to a thread.
+     */
+    static const int MIN_ATOMS_PER_THREAD = 4096;
+};
+
+#endif // TRAJECTORYGENERATOR_H
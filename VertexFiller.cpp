@@ -0,0 +1,78 @@
+#include "VertexFiller.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+VertexFiller::VertexFiller(const QVector<Atom*>& atoms)
+    : m_Atoms(atoms)
+{
+    if (!m_Atoms.isEmpty())
+    {
+        m_Frames = m_Atoms[0]->GetTrajectoryRef().length();
+    }
+}
+
+void VertexFiller::SetColours(const ColourMapper* mapper,
+                              AtomMetric metric,
+                              bool lastOnly)
+{
+    m_Mapper = mapper;
+    m_Metric = metric;
+    m_LastOnly = lastOnly;
+}
+
+void VertexFiller::SetTrajectory(AtomTrajectory trajectory)
+{
+    m_Trajectory = trajectory;
+}
+
+int VertexFiller::GetAtoms() const
+{
+    return m_Atoms.length();
+}
+
+int VertexFiller::GetFrames() const
+{
+    return m_Frames;
+}
+
+void VertexFiller::Fill(int firstAtom, int lastAtom, Vertex* vertices) const
+{
+    TRACE_SCOPE("VertexFiller::Fill");
+    const int colourOffset = Vertex::ColourOffset()/sizeof(float);
+    const int stride = Vertex::Stride()/sizeof(float);
+    Atom* const* atoms = m_Atoms.constData();
+    Parallel::For(lastAtom - firstAtom, 1, [&](int, int first, int last)
+    {
+        for (int i = first; i < last; ++i)
+        {
+            Atom* atom = atoms[firstAtom + i];
+            Vertex* atomVertices = vertices + (qint64)i*m_Frames;
+            const QVector3D* trajectory = (atom->*m_Trajectory)().constData();
+            for (int j = 0; j < m_Frames; ++j)
+            {
+                atomVertices[j].SetPosition(trajectory[j]);
+                atomVertices[j].SetColour(QVector3D());
+            }
+
+            if (!m_Mapper || !m_Metric)
+            {
+                continue;
+            }
+            const QVector<float>& values = (atom->*m_Metric)();
+            if (m_LastOnly)
+            {
+                QVector3D colour = m_Mapper->Colour(values.last());
+                for (int j = 0; j < m_Frames; ++j)
+                {
+                    atomVertices[j].SetColour(colour);
+                }
+            }
+            else
+            {
+                float* colours = reinterpret_cast<float*>(atomVertices) + colourOffset;
+                m_Mapper->Map(values.constData(), qMin(values.length(), m_Frames),
+                              colours, stride);
+            }
+        }
+    });
+}
@@ -0,0 +1,118 @@
+/**
+ * @file VertexFiller.h
+ * @date 19 Oct 2026
+ * @see Vertex.h
+ * @see ColourMapper.h
+ * @brief This class writes the @Vertex data used for drawing straight from
+ * the trajectories of a set of atoms.
+ *
+ * Vertices are laid out atom by atom, with every frame of one atom stored
+ * consecutively, which is the layout of the trajectory buffer drawn by
+ * MyOpenGLWidget. Any range of atoms can be written into caller supplied
+ * memory, such as a mapped range of a GPU buffer, so no full copy of the
+ * vertices needs to be kept in main memory.
+ */
+
+#ifndef VERTEXFILLER_H
+#define VERTEXFILLER_H
+
+#include "Atom.h"
+#include "ColourMapper.h"
+#include "Vertex.h"
+
+class VertexFiller
+{
+public:
+    /**
+     * @brief Pointer to an @Atom getter for a calculated metric.
+     */
+    typedef QVector<float>& (Atom::*AtomMetric)();
+
+    /**
+     * @brief Pointer to an @Atom getter for a layer of positions, such as
+     * the trajectory or the aligned trajectory.
+     */
+    typedef QVector<QVector3D>& (Atom::*AtomTrajectory)();
+
+    /**
+     * @brief Constructor.
+     * @param atoms The atoms whose vertices are to be written. Every atom
+     * must have the same number of frames.
+     */
+    VertexFiller(const QVector<Atom*>& atoms);
+
+    /**
+     * @brief Sets how the vertices are coloured. Without a colour mapper
+     * every vertex is given the default colour.
+     * @param mapper The colour mapper, which must outlive any call to
+     * Fill(), or 0 for no colouring.
+     * @param metric The metric to be mapped to colours.
+     * @param lastOnly If true every frame of an atom is given the colour of
+     * the last value of the metric, as for the total path length.
+     */
+    void SetColours(const ColourMapper* mapper, AtomMetric metric, bool lastOnly);
+
+    /**
+     * @brief Sets the layer of positions written. Without a layer the
+     * trajectory of each atom is written.
+     * @param trajectory The @Atom getter for the positions, which must have
+     * a position for every frame.
+     */
+    void SetTrajectory(AtomTrajectory trajectory);
+
+    /**
+     * @brief Returns the number of atoms.
+     * @return The number of atoms.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the number of frames of each atom.
+     * @return The number of frames.
+     */
+    int GetFrames() const;
+
+    /**
+     * @brief Writes the vertices for a range of atoms, splitting the atoms
+     * across the global thread pool.
+     * @param firstAtom The index of the first atom to be written.
+     * @param lastAtom One past the index of the last atom to be written.
+     * @param vertices The output array, with room for GetFrames() vertices
+     * per atom. The first frame of atom @e firstAtom is written to
+     * vertices[0].
+     */
+    void Fill(int firstAtom, int lastAtom, Vertex* vertices) const;
+
+private:
+    /**
+     * @brief The atoms whose vertices are written.
+     */
+    QVector<Atom*> m_Atoms;
+
+    /**
+     * @brief The number of frames of each atom.
+     */
+    int m_Frames = 0;
+
+    /**
+     * @brief If true only the last value of the metric is mapped.
+     */
+    bool m_LastOnly = false;
+
+    /**
+     * @brief The colour mapper, or 0 for no colouring.
+     */
+    const ColourMapper* m_Mapper = 0;
+
+    /**
+     * @brief The metric mapped to colours.
+     */
+    AtomMetric m_Metric = 0;
+
+    /**
+     * @brief The layer of positions written.
+     */
+    AtomTrajectory m_Trajectory = &Atom::GetTrajectoryRef;
+};
+
+#endif // VERTEXFILLER_H
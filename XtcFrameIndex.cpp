@@ -0,0 +1,186 @@
+#include "XtcFrameIndex.h"
+#include "Trace.h"
+#include <QFile>
+#include <QtEndian>
+#include <cstring>
+
+namespace
+{
+    /**
+     * @brief The magic number at the start of every .xtc frame.
+     */
+    const qint32 XTC_MAGIC = 1995;
+
+    /**
+     * @brief The offset of the number of atoms within a frame.
+     */
+    const int XTC_ATOMS_OFFSET = 4;
+
+    /**
+     * @brief The offset of the step within a frame.
+     */
+    const int XTC_STEP_OFFSET = 8;
+
+    /**
+     * @brief The offset of the time within a frame.
+     */
+    const int XTC_TIME_OFFSET = 12;
+
+    /**
+     * @brief The offset of the compressed byte count within a frame.
+     */
+    const int XTC_BYTE_COUNT_OFFSET = 88;
+
+    /**
+     * @brief The number of bytes before the compressed coordinates of a
+     * frame: the header, box, atom count, precision, bounds, small index and
+     * byte count.
+     */
+    const int XTC_COMPRESSED_HEADER = 92;
+
+    /**
+     * @brief The number of bytes before the coordinates of a frame with too
+     * few atoms to be compressed.
+     */
+    const int XTC_UNCOMPRESSED_HEADER = 56;
+
+    /**
+     * @brief Frames with this many atoms or fewer are not compressed.
+     */
+    const int XTC_MAX_UNCOMPRESSED_ATOMS = 9;
+
+    /**
+     * @brief Reads a big-endian 32 bit integer from a frame.
+     * @param frame The bytes of the frame.
+     * @param offset The offset of the integer.
+     * @return The integer.
+     */
+    qint32 readInt(const QByteArray& frame, int offset)
+    {
+        return qFromBigEndian<qint32>(
+                    reinterpret_cast<const uchar*>(frame.constData()) + offset);
+    }
+}
+
+bool XtcFrameIndex::Build(const QString& xtcFilePath)
+{
+    TRACE_SCOPE("XtcFrameIndex::Build");
+    m_Atoms = 0;
+    m_Frames.clear();
+
+    QFile xtcFile(xtcFilePath);
+    if (!xtcFile.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    qint64 fileSize = xtcFile.size();
+    qint64 offset = 0;
+    QByteArray header;
+    qint64 frameBytes;
+    while (xtcFile.seek(offset) && readHeader(xtcFile, header, frameBytes)
+           && offset + frameBytes <= fileSize)
+    {
+        if (m_Frames.isEmpty())
+        {
+            m_Atoms = GetFrameAtoms(header);
+        }
+        Frame frame;
+        frame.offset = offset;
+        frame.bytes = (int)frameBytes;
+        frame.step = readInt(header, XTC_STEP_OFFSET);
+        frame.time = GetFrameTime(header);
+        m_Frames.append(frame);
+        offset += frameBytes;
+    }
+    return !m_Frames.isEmpty();
+}
+
+int XtcFrameIndex::GetAtoms() const
+{
+    return m_Atoms;
+}
+
+const QVector<XtcFrameIndex::Frame>& XtcFrameIndex::GetFrames() const
+{
+    return m_Frames;
+}
+
+QVector<int> XtcFrameIndex::Select(float startTime, float endTime, int stride) const
+{
+    QVector<int> selected;
+    stride = qMax(1, stride);
+    int inWindow = 0;
+    for (int i = 0; i < m_Frames.length(); ++i)
+    {
+        float time = m_Frames[i].time;
+        if (time < startTime || time > endTime)
+        {
+            continue;
+        }
+        if (inWindow % stride == 0)
+        {
+            selected.append(i);
+        }
+        ++inWindow;
+    }
+    return selected;
+}
+
+bool XtcFrameIndex::ReadFrame(QIODevice& device, QByteArray& frame)
+{
+    qint64 frameBytes;
+    if (!readHeader(device, frame, frameBytes))
+    {
+        return false;
+    }
+    frame += device.read(frameBytes - frame.size());
+    return frame.size() == frameBytes;
+}
+
+int XtcFrameIndex::GetFrameAtoms(const QByteArray& frame)
+{
+    return readInt(frame, XTC_ATOMS_OFFSET);
+}
+
+float XtcFrameIndex::GetFrameTime(const QByteArray& frame)
+{
+    quint32 bits = readInt(frame, XTC_TIME_OFFSET);
+    float time;
+    memcpy(&time, &bits, sizeof(time));
+    return time;
+}
+
+bool XtcFrameIndex::readHeader(QIODevice& device, QByteArray& header, qint64& frameBytes)
+{
+    header = device.read(XTC_UNCOMPRESSED_HEADER);
+    if (header.size() < XTC_UNCOMPRESSED_HEADER || readInt(header, 0) != XTC_MAGIC)
+    {
+        return false;
+    }
+
+    qint32 atoms = GetFrameAtoms(header);
+    if (atoms < 0)
+    {
+        return false;
+    }
+    else if (atoms <= XTC_MAX_UNCOMPRESSED_ATOMS)
+    {
+        frameBytes = XTC_UNCOMPRESSED_HEADER + atoms*3*sizeof(float);
+    }
+    else
+    {
+        header += device.read(XTC_COMPRESSED_HEADER - XTC_UNCOMPRESSED_HEADER);
+        if (header.size() < XTC_COMPRESSED_HEADER)
+        {
+            return false;
+        }
+        qint32 byteCount = readInt(header, XTC_BYTE_COUNT_OFFSET);
+        if (byteCount < 0)
+        {
+            return false;
+        }
+        frameBytes = XTC_COMPRESSED_HEADER + ((byteCount + 3) & ~3);
+    }
+    return true;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file XtcFrameIndex.h
+ * @date 19 Oct 2026
+ * @see XtcPipeline.h
+ * @brief This class lists the position, size and time of every frame in a
+ * .xtc file, without decompressing any of them.
+ *
+ * Each .xtc frame starts with a header holding its step, time and, for
+ * compressed frames, the number of bytes of coordinate data that follow.
+ * The index is built by reading only these headers and seeking past the
+ * data, so a subset of frames, such as a time window or every n-th frame,
+ * can then be read and decoded without touching the rest of the file.
+ */
+
+#ifndef XTCFRAMEINDEX_H
+#define XTCFRAMEINDEX_H
+
+#include <QIODevice>
+#include <QString>
+#include <QVector>
+
+class XtcFrameIndex
+{
+public:
+    /**
+     * @brief The location and time of one frame.
+     */
+    struct Frame
+    {
+        /**
+         * @brief The offset of the frame from the start of the file.
+         */
+        qint64 offset;
+
+        /**
+         * @brief The size of the frame in bytes.
+         */
+        int bytes;
+
+        /**
+         * @brief The simulation step of the frame.
+         */
+        int step;
+
+        /**
+         * @brief The time of the frame, in ps.
+         */
+        float time;
+    };
+
+    /**
+     * @brief Builds the index for a .xtc file. Indexing stops quietly at the
+     * end of the file or at the first frame which is truncated or not a .xtc
+     * frame.
+     * @param xtcFilePath The path of the .xtc file.
+     * @return true if the file could be opened and has at least one frame,
+     * false otherwise.
+     */
+    bool Build(const QString& xtcFilePath);
+
+    /**
+     * @brief Returns the number of atoms in each frame.
+     * @return The number of atoms, from the first frame.
+     */
+    int GetAtoms() const;
+
+    /**
+     * @brief Returns the indexed frames, in file order.
+     * @return A QVector of @Frame.
+     */
+    const QVector<Frame>& GetFrames() const;
+
+    /**
+     * @brief Chooses the frames to be loaded.
+     * @param startTime Frames before this time, in ps, are skipped.
+     * @param endTime Frames after this time, in ps, are skipped.
+     * @param stride Only every stride-th frame within the time window is
+     * chosen, starting with the first.
+     * @return The indices of the chosen frames, in file order.
+     */
+    QVector<int> Select(float startTime, float endTime, int stride) const;
+
+    /**
+     * @brief Reads the raw bytes of the next frame of a .xtc file, without
+     * decoding them.
+     * @param device The open .xtc file, positioned at the start of a frame.
+     * @param frame Set to the bytes of the frame.
+     * @return true if a whole frame was read, false at the end of the file or
+     * if the frame is truncated or not a .xtc frame.
+     */
+    static bool ReadFrame(QIODevice& device, QByteArray& frame);
+
+    /**
+     * @brief Returns the number of atoms in a raw frame.
+     * @param frame The bytes of a frame, or at least of its header.
+     * @return The number of atoms.
+     */
+    static int GetFrameAtoms(const QByteArray& frame);
+
+    /**
+     * @brief Returns the time of a raw frame.
+     * @param frame The bytes of a frame, or at least of its header.
+     * @return The time of the frame, in ps.
+     */
+    static float GetFrameTime(const QByteArray& frame);
+
+private:
+    /**
+     * @brief Reads the header of the next frame of a .xtc file.
+     * @param device The open .xtc file, positioned at the start of a frame.
+     * The device is left positioned after the header.
+     * @param header Set to the bytes of the header.
+     * @param frameBytes Set to the size of the whole frame, including the
+     * header.
+     * @return true if a valid header was read, false otherwise.
+     */
+    static bool readHeader(QIODevice& device, QByteArray& header, qint64& frameBytes);
+
+    /**
+     * @brief The number of atoms in each frame.
+     */
+    int m_Atoms = 0;
+
+    /**
+     * @brief The indexed frames, in file order.
+     */
+    QVector<Frame> m_Frames;
+};
+
+#endif // XTCFRAMEINDEX_H
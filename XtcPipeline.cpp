@@ -0,0 +1,377 @@
+#include "XtcPipeline.h"
+#include "BoundedQueue.h"
+#include "FileReader.h"
+#include "Trace.h"
+#include "xdrfile.h"
+#include "xdrfile_xtc.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+namespace
+{
+    /**
+     * @brief The indices of the stages in the list of stages.
+     */
+    enum StageIndex
+    {
+        READ,
+        DECODE,
+        UNWRAP,
+        STORE,
+        STAGE_COUNT
+    };
+
+    /**
+     * @brief The display names of the stages.
+     */
+    const char* const STAGE_NAMES[STAGE_COUNT] =
+    {
+        "read",
+        "decode",
+        "unwrap",
+        "store"
+    };
+
+    /**
+     * @brief The raw bytes of a frame, tagged with its position in the list
+     * of frames being loaded.
+     */
+    struct RawFrame
+    {
+        int index;
+        QByteArray bytes;
+    };
+}
+
+double XtcPipeline::Stage::FramesPerSecond() const
+{
+    if (busyTime <= 0)
+    {
+        return 0;
+    }
+    return frames/(busyTime/1e9/threads);
+}
+
+double XtcPipeline::Stage::MegabytesPerSecond() const
+{
+    if (busyTime <= 0)
+    {
+        return 0;
+    }
+    return bytes/(1024.0*1024.0)/(busyTime/1e9/threads);
+}
+
+XtcPipeline::XtcPipeline(const QVector<Atom*>& atoms,
+                         const QVector<int>& atomIndices,
+                         const XtcFrameIndex& index,
+                         const QVector<int>& frames)
+    : m_AtomIndices(atomIndices),
+      m_Atoms(atoms),
+      m_Frames(frames),
+      m_Index(index)
+{
+    int threads = QThreadPool::globalInstance()->maxThreadCount();
+    SetDecodeThreads(threads - SERIAL_STAGES);
+}
+
+void XtcPipeline::SetDecodeThreads(int threads)
+{
+    m_DecodeThreads = qMax(1, threads);
+}
+
+bool XtcPipeline::Run(const QString& xtcFilePath)
+{
+    TRACE_SCOPE("XtcPipeline::Run");
+    QElapsedTimer wallClock;
+    wallClock.start();
+
+    QFile xtcFile(xtcFilePath);
+    if (!xtcFile.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    m_FramesRead = 0;
+    m_SimBox = QVector3D();
+    m_Stages = QVector<Stage>(STAGE_COUNT);
+    for (int i = 0; i < STAGE_COUNT; ++i)
+    {
+        m_Stages[i].name = STAGE_NAMES[i];
+    }
+    m_Stages[DECODE].threads = m_DecodeThreads;
+    Stage* stages = m_Stages.data();
+
+    const int atoms = m_Atoms.length();
+    const int frameAtoms = m_Index.GetAtoms();
+    const int capacity = FRAMES_PER_DECODER*m_DecodeThreads;
+    BoundedQueue<RawFrame> rawFrames(capacity);
+    ReorderQueue<DecodedFrame> decodedFrames(capacity);
+    BoundedQueue<UnwrappedFrame> unwrappedFrames(capacity);
+
+    // The stages block on the queues, so they run on their own pool rather
+    // than tying up the threads of the global pool.
+    QThreadPool pool;
+    pool.setMaxThreadCount(SERIAL_STAGES + m_DecodeThreads);
+    QVector<QFuture<void> > futures;
+
+    futures.append(QtConcurrent::run(&pool, [&]()
+    {
+        QThread::currentThread()->setObjectName("XTC read");
+        Stage& stage = stages[READ];
+        QElapsedTimer timer;
+        const QVector<XtcFrameIndex::Frame>& indexFrames = m_Index.GetFrames();
+        for (int index = 0; index < m_Frames.length(); ++index)
+        {
+            const XtcFrameIndex::Frame& indexFrame = indexFrames[m_Frames[index]];
+            RawFrame frame;
+            frame.index = index;
+            timer.start();
+            bool read;
+            {
+                TRACE_SCOPE("XtcPipeline::read");
+                read = xtcFile.seek(indexFrame.offset)
+                        && XtcFrameIndex::ReadFrame(xtcFile, frame.bytes);
+            }
+            stage.busyTime += timer.nsecsElapsed();
+            if (!read)
+            {
+                break;
+            }
+            ++stage.frames;
+            stage.bytes += frame.bytes.size();
+
+            timer.start();
+            bool pushed = rawFrames.Push(frame);
+            stage.waitTime += timer.nsecsElapsed();
+            if (!pushed)
+            {
+                break;
+            }
+        }
+        rawFrames.Close();
+    }));
+
+    QMutex decodeMutex;
+    int decodersRunning = m_DecodeThreads;
+    for (int i = 0; i < m_DecodeThreads; ++i)
+    {
+        futures.append(QtConcurrent::run(&pool, [&]()
+        {
+            QThread::currentThread()->setObjectName("XTC decode");
+            Stage local;
+            QElapsedTimer timer;
+            RawFrame frame;
+            QVector<float> coordinates;
+            while (true)
+            {
+                timer.start();
+                bool popped = rawFrames.Pop(frame);
+                local.waitTime += timer.nsecsElapsed();
+                if (!popped)
+                {
+                    break;
+                }
+
+                timer.start();
+                DecodedFrame decoded = decodeFrame(frame.bytes, frameAtoms,
+                                                   m_AtomIndices, coordinates);
+                local.busyTime += timer.nsecsElapsed();
+                ++local.frames;
+                local.bytes += frame.bytes.size();
+
+                timer.start();
+                bool pushed = decodedFrames.Push(frame.index, decoded);
+                local.waitTime += timer.nsecsElapsed();
+                if (!pushed)
+                {
+                    break;
+                }
+            }
+
+            QMutexLocker locker(&decodeMutex);
+            Stage& stage = stages[DECODE];
+            stage.frames += local.frames;
+            stage.bytes += local.bytes;
+            stage.busyTime += local.busyTime;
+            stage.waitTime += local.waitTime;
+            if (--decodersRunning == 0)
+            {
+                decodedFrames.Close();
+            }
+        }));
+    }
+
+    futures.append(QtConcurrent::run(&pool, [&]()
+    {
+        QThread::currentThread()->setObjectName("XTC unwrap");
+        Stage& stage = stages[UNWRAP];
+        QElapsedTimer timer;
+        QVector<float> previous;
+        // Times are kept relative to the start of the file, not the first
+        // frame loaded, so that they match across different selections.
+        float startTime = m_Index.GetFrames().isEmpty()
+                ? 0 : m_Index.GetFrames()[0].time;
+        DecodedFrame frame;
+        for (int index = 0; ; ++index)
+        {
+            timer.start();
+            bool popped = decodedFrames.Pop(frame);
+            stage.waitTime += timer.nsecsElapsed();
+            if (!popped)
+            {
+                break;
+            }
+            if (!frame.ok)
+            {
+                // Treat a bad frame as the end of the file, and stop the
+                // stages before this one.
+                rawFrames.Close();
+                decodedFrames.Close();
+                break;
+            }
+
+            timer.start();
+            UnwrappedFrame unwrapped;
+            {
+                TRACE_SCOPE("XtcPipeline::unwrap");
+                float* position = frame.coordinates.data();
+                if (index > 0)
+                {
+                    const float* last = previous.constData();
+                    for (int i = 0; i < atoms*3; i += 3)
+                    {
+                        position[i] = FileReader::UnwrapCoordinate(
+                                    position[i], last[i], frame.box.x());
+                        position[i + 1] = FileReader::UnwrapCoordinate(
+                                    position[i + 1], last[i + 1], frame.box.y());
+                        position[i + 2] = FileReader::UnwrapCoordinate(
+                                    position[i + 2], last[i + 2], frame.box.z());
+                    }
+                }
+                previous = frame.coordinates;
+                unwrapped.stepTime = frame.time - startTime;
+                unwrapped.coordinates = frame.coordinates;
+            }
+            stage.busyTime += timer.nsecsElapsed();
+            ++stage.frames;
+            stage.bytes += frame.coordinates.size()*sizeof(float);
+            m_SimBox = frame.box;
+            ++m_FramesRead;
+
+            timer.start();
+            bool pushed = unwrappedFrames.Push(unwrapped);
+            stage.waitTime += timer.nsecsElapsed();
+            if (!pushed)
+            {
+                break;
+            }
+        }
+        unwrappedFrames.Close();
+    }));
+
+    futures.append(QtConcurrent::run(&pool, [&]()
+    {
+        QThread::currentThread()->setObjectName("XTC store");
+        Stage& stage = stages[STORE];
+        QElapsedTimer timer;
+        UnwrappedFrame frame;
+        while (true)
+        {
+            timer.start();
+            bool popped = unwrappedFrames.Pop(frame);
+            stage.waitTime += timer.nsecsElapsed();
+            if (!popped)
+            {
+                break;
+            }
+
+            timer.start();
+            {
+                TRACE_SCOPE("XtcPipeline::store");
+                const float* position = frame.coordinates.constData();
+                for (int i = 0; i < atoms; ++i)
+                {
+                    m_Atoms[i]->AddTimeStep(position[3*i],
+                                            position[3*i + 1],
+                                            position[3*i + 2],
+                                            frame.stepTime);
+                }
+            }
+            stage.busyTime += timer.nsecsElapsed();
+            ++stage.frames;
+            stage.bytes += frame.coordinates.size()*sizeof(float);
+        }
+    }));
+
+    for (int i = 0; i < futures.length(); ++i)
+    {
+        futures[i].waitForFinished();
+    }
+    m_Elapsed = wallClock.nsecsElapsed();
+    return true;
+}
+
+int XtcPipeline::GetFramesRead() const
+{
+    return m_FramesRead;
+}
+
+QVector3D XtcPipeline::GetSimBox() const
+{
+    return m_SimBox;
+}
+
+const QVector<XtcPipeline::Stage>& XtcPipeline::GetStages() const
+{
+    return m_Stages;
+}
+
+qint64 XtcPipeline::GetElapsed() const
+{
+    return m_Elapsed;
+}
+
+XtcPipeline::DecodedFrame XtcPipeline::decodeFrame(const QByteArray& bytes,
+                                                   int frameAtoms,
+                                                   const QVector<int>& atomIndices,
+                                                   QVector<float>& coordinates)
+{
+    TRACE_SCOPE("XtcPipeline::decode");
+    DecodedFrame frame;
+    XDRFILE* xdrFile = xdrfile_open_memory(bytes.constData(), bytes.size());
+    if (xdrFile == NULL)
+    {
+        return frame;
+    }
+
+    int step;
+    float precision;
+    matrix box;
+    // Every atom has to be decompressed, but only the loaded ones are kept.
+    QVector<float>& decoded = atomIndices.isEmpty()
+            ? frame.coordinates : coordinates;
+    decoded.resize(frameAtoms*3);
+    int result = read_xtc(xdrFile, frameAtoms, &step, &frame.time, box,
+                          reinterpret_cast<rvec*>(decoded.data()),
+                          &precision);
+    xdrfile_close(xdrFile);
+
+    if (!atomIndices.isEmpty())
+    {
+        frame.coordinates.resize(atomIndices.length()*3);
+        float* kept = frame.coordinates.data();
+        for (int i = 0; i < atomIndices.length(); ++i)
+        {
+            const float* position = decoded.constData() + 3*atomIndices[i];
+            kept[3*i] = position[0];
+            kept[3*i + 1] = position[1];
+            kept[3*i + 2] = position[2];
+        }
+    }
+    frame.ok = result == exdrOK;
+    frame.box = QVector3D(box[0][0], box[1][1], box[2][2]);
+    return frame;
+}
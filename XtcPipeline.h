@@ -0,0 +1,262 @@
+/**
+ * @file XtcPipeline.h
+ * @date 19 Oct 2026
+ * @see FileReader.h
+ * @see BoundedQueue.h
+ * @see XtcFrameIndex.h
+ * @brief This class loads the frames of a .xtc file into a set of atoms
+ * using a pipeline of threads.
+ *
+ * The load is split into four stages connected by bounded queues. A read
+ * stage pulls the raw bytes of each chosen frame from the file, using an
+ * XtcFrameIndex to seek past the others, a pool of decode
+ * threads decompresses the coordinates, an unwrap stage undoes the periodic
+ * boundary wrapping in frame order, and a store stage appends the kept
+ * frames to the atoms, whose trajectories are expected to be reserved in
+ * advance. The time each stage spends working and waiting is recorded, so
+ * the stage limiting the load, such as reading from a slow filesystem or
+ * decoding on few cores, can be seen.
+ */
+
+#ifndef XTCPIPELINE_H
+#define XTCPIPELINE_H
+
+#include "Atom.h"
+#include "XtcFrameIndex.h"
+#include <QString>
+#include <QVector>
+#include <QVector3D>
+
+class XtcPipeline
+{
+public:
+    /**
+     * @brief The work done by one stage of the pipeline.
+     */
+    struct Stage
+    {
+        /**
+         * @brief The name of the stage.
+         */
+        QString name;
+
+        /**
+         * @brief The number of threads running the stage.
+         */
+        int threads = 1;
+
+        /**
+         * @brief The number of frames processed by the stage.
+         */
+        int frames = 0;
+
+        /**
+         * @brief The number of bytes processed by the stage.
+         */
+        qint64 bytes = 0;
+
+        /**
+         * @brief The time spent working, summed over the stage's threads,
+         * in nanoseconds.
+         */
+        qint64 busyTime = 0;
+
+        /**
+         * @brief The time spent waiting on the queues either side of the
+         * stage, summed over the stage's threads, in nanoseconds.
+         */
+        qint64 waitTime = 0;
+
+        /**
+         * @brief Returns the number of frames per second the stage could
+         * process if it never had to wait.
+         * @return The throughput in frames per second.
+         */
+        double FramesPerSecond() const;
+
+        /**
+         * @brief Returns the number of MB per second the stage could process
+         * if it never had to wait.
+         * @return The throughput in MB per second.
+         */
+        double MegabytesPerSecond() const;
+    };
+
+    /**
+     * @brief Constructor.
+     * @param atoms The atoms to which the frames are added.
+     * @param atomIndices The index within each .xtc frame of each of the
+     * atoms, in ascending order, or empty if the atoms are every atom of the
+     * file in order. The coordinates of other atoms are discarded as soon as
+     * each frame is decoded.
+     * @param index The index of the .xtc file.
+     * @param frames The indices of the frames to be loaded, in file order,
+     * such as from XtcFrameIndex::Select(). Frames which are not loaded are
+     * not read or decoded, so the periodic boundary is unwrapped between
+     * consecutive loaded frames.
+     */
+    XtcPipeline(const QVector<Atom*>& atoms,
+                const QVector<int>& atomIndices,
+                const XtcFrameIndex& index,
+                const QVector<int>& frames);
+
+    /**
+     * @brief Sets the number of threads decoding frames. By default this is
+     * the maximum thread count of the global thread pool, less one for each
+     * of the other stages, and at least one.
+     * @param threads The number of decode threads.
+     */
+    void SetDecodeThreads(int threads);
+
+    /**
+     * @brief Reads the chosen frames of a .xtc file into the atoms. Reading
+     * stops quietly at the first frame which cannot be read or decoded.
+     * @param xtcFilePath The path of the .xtc file.
+     * @return true if the file could be opened, false otherwise.
+     */
+    bool Run(const QString& xtcFilePath);
+
+    /**
+     * @brief Returns the number of frames read and decoded.
+     * @return The number of frames.
+     */
+    int GetFramesRead() const;
+
+    /**
+     * @brief Returns the dimensions of the simulation box in the last frame
+     * read.
+     * @return The x, y and z dimensions of the box.
+     */
+    QVector3D GetSimBox() const;
+
+    /**
+     * @brief Returns the work done by each stage of the last run, in
+     * pipeline order.
+     * @return A QVector of @Stage.
+     */
+    const QVector<Stage>& GetStages() const;
+
+    /**
+     * @brief Returns the wall clock time taken by the last run.
+     * @return The time in nanoseconds.
+     */
+    qint64 GetElapsed() const;
+
+private:
+    /**
+     * @brief A frame after decoding.
+     */
+    struct DecodedFrame
+    {
+        /**
+         * @brief false if the frame could not be decoded.
+         */
+        bool ok = false;
+
+        /**
+         * @brief The time of the frame.
+         */
+        float time = 0;
+
+        /**
+         * @brief The dimensions of the simulation box.
+         */
+        QVector3D box;
+
+        /**
+         * @brief The x, y and z coordinates of each loaded atom, packed.
+         */
+        QVector<float> coordinates;
+    };
+
+    /**
+     * @brief A frame after unwrapping, ready to be stored.
+     */
+    struct UnwrappedFrame
+    {
+        /**
+         * @brief The time of the frame, relative to the first frame.
+         */
+        int stepTime = 0;
+
+        /**
+         * @brief The unwrapped x, y and z coordinates of each atom, packed.
+         */
+        QVector<float> coordinates;
+    };
+
+    /**
+     * @brief Decodes the raw bytes of a frame, keeping only the coordinates
+     * of the loaded atoms.
+     * @param bytes The bytes of the frame.
+     * @param frameAtoms The number of atoms in the frame.
+     * @param atomIndices The index within the frame of each loaded atom, or
+     * empty if every atom is loaded.
+     * @param coordinates Scratch space for the coordinates of every atom in
+     * the frame.
+     * @return The decoded frame, which is not ok if it could not be decoded.
+     */
+    static DecodedFrame decodeFrame(const QByteArray& bytes,
+                                    int frameAtoms,
+                                    const QVector<int>& atomIndices,
+                                    QVector<float>& coordinates);
+
+    /**
+     * @brief The index within each .xtc frame of each of the atoms, or empty
+     * if the atoms are every atom of the file.
+     */
+    QVector<int> m_AtomIndices;
+
+    /**
+     * @brief The atoms to which the frames are added.
+     */
+    QVector<Atom*> m_Atoms;
+
+    /**
+     * @brief The number of threads decoding frames.
+     */
+    int m_DecodeThreads;
+
+    /**
+     * @brief The wall clock time taken by the last run, in nanoseconds.
+     */
+    qint64 m_Elapsed = 0;
+
+    /**
+     * @brief The indices of the frames to be loaded.
+     */
+    QVector<int> m_Frames;
+
+    /**
+     * @brief The number of frames read by the last run.
+     */
+    int m_FramesRead = 0;
+
+    /**
+     * @brief The index of the .xtc file.
+     */
+    XtcFrameIndex m_Index;
+
+    /**
+     * @brief The dimensions of the simulation box in the last frame read.
+     */
+    QVector3D m_SimBox;
+
+    /**
+     * @brief The work done by each stage of the last run.
+     */
+    QVector<Stage> m_Stages;
+
+    /**
+     * @brief The number of frames each queue holds per decode thread.
+     */
+    static const int FRAMES_PER_DECODER = 4;
+
+    /**
+     * @brief The number of stages other than decoding, each of which runs
+     * on its own thread.
+     */
+    static const int SERIAL_STAGES = 3;
+};
+
+#endif // XTCPIPELINE_H
@@ -0,0 +1,122 @@
+#include "BenchmarkRunner.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTextStream>
+
+namespace
+{
+    /**
+     * @brief Sink for values passed to KeepValue().
+     */
+    volatile float g_Sink = 0;
+}
+
+BenchmarkRunner::BenchmarkRunner()
+{
+
+}
+
+void BenchmarkRunner::KeepValue(float value)
+{
+    g_Sink = g_Sink + value;
+}
+
+void BenchmarkRunner::PrintResults()
+{
+    QTextStream out(stdout);
+    out << qSetFieldWidth(40) << left << "Case"
+        << qSetFieldWidth(12) << right << "Iterations"
+        << qSetFieldWidth(16) << "ns/iteration"
+        << qSetFieldWidth(16) << "min ns"
+        << qSetFieldWidth(0) << endl;
+    for (int i = 0; i < m_Results.length(); ++i)
+    {
+        out << qSetFieldWidth(40) << left << m_Results[i].name
+            << qSetFieldWidth(12) << right << m_Results[i].iterations
+            << qSetFieldWidth(16) << QString::number(m_Results[i].nsPerIteration, 'f', 1)
+            << qSetFieldWidth(16) << QString::number(m_Results[i].minNsPerIteration, 'f', 1)
+            << qSetFieldWidth(0) << endl;
+    }
+}
+
+void BenchmarkRunner::Run(const QString& name,
+                          int iterations,
+                          std::function<void()> function,
+                          std::function<void()> setup)
+{
+    if (!ShouldRun(name))
+    {
+        return;
+    }
+
+    if (setup)
+    {
+        setup();
+    }
+    function();
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    qint64 fastest = -1;
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (setup)
+        {
+            setup();
+        }
+        timer.start();
+        function();
+        qint64 time = timer.nsecsElapsed();
+        elapsed += time;
+        if (fastest < 0 || time < fastest)
+        {
+            fastest = time;
+        }
+    }
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.nsPerIteration = (double)elapsed/iterations;
+    result.minNsPerIteration = (double)fastest;
+    m_Results.append(result);
+}
+
+void BenchmarkRunner::SetFilter(const QString& filter)
+{
+    m_Filter = filter;
+}
+
+bool BenchmarkRunner::ShouldRun(const QString& name) const
+{
+    return m_Filter.isEmpty() || name.contains(m_Filter)
+            || m_Filter.startsWith(name);
+}
+
+bool BenchmarkRunner::WriteJson(const QString& filePath,
+                                const QJsonObject& parameters) const
+{
+    QJsonArray results;
+    for (int i = 0; i < m_Results.length(); ++i)
+    {
+        QJsonObject result;
+        result["name"] = m_Results[i].name;
+        result["iterations"] = m_Results[i].iterations;
+        result["ns_per_iteration"] = m_Results[i].nsPerIteration;
+        result["min_ns_per_iteration"] = m_Results[i].minNsPerIteration;
+        results.append(result);
+    }
+
+    QJsonObject root;
+    root["parameters"] = parameters;
+    root["results"] = results;
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+    return file.write(QJsonDocument(root).toJson()) >= 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file BenchmarkRunner.h
+ * @date 19 Oct 2026
+ * @brief This class times benchmark cases and reports the results.
+ *
+ * Each case is run once as a warm up and then repeatedly for the requested
+ * number of iterations, with the mean and fastest time per iteration being
+ * recorded. Results can be printed as a table or written as JSON, along with
+ * the parameters of the run, so that they can be compared across versions.
+ */
+
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QJsonObject>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+class BenchmarkRunner
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    BenchmarkRunner();
+
+    /**
+     * @brief Prevents the compiler from discarding a computed value.
+     * @param value The value to be kept.
+     */
+    static void KeepValue(float value);
+
+    /**
+     * @brief Prints a table of all recorded results to the console.
+     */
+    void PrintResults();
+
+    /**
+     * @brief Times a benchmark case and records the result. Cases whose name
+     * does not contain the filter are skipped.
+     * @param name The name of the case.
+     * @param iterations The number of timed iterations to run.
+     * @param function The code to be timed.
+     * @param setup Optional code run before each iteration, and the warm up,
+     * which is not included in the timing.
+     */
+    void Run(const QString& name,
+             int iterations,
+             std::function<void()> function,
+             std::function<void()> setup = std::function<void()>());
+
+    /**
+     * @brief Sets a filter on the names of the cases to be run.
+     * @param filter Only cases whose name contains this string are run. An
+     * empty string runs every case.
+     */
+    void SetFilter(const QString& filter);
+
+    /**
+     * @brief Returns whether a case would be run with the current filter, so
+     * that expensive preparation for skipped cases can be avoided.
+     * @param name The name, or a prefix of the names, of the cases.
+     * @return true if the case would be run.
+     */
+    bool ShouldRun(const QString& name) const;
+
+    /**
+     * @brief Writes all recorded results to a JSON file.
+     * @param filePath The path of the file to be written.
+     * @param parameters The parameters of the run, such as the number of
+     * atoms and frames, stored alongside the results.
+     * @return true if the file was written successfully, false otherwise.
+     */
+    bool WriteJson(const QString& filePath,
+                   const QJsonObject& parameters) const;
+
+private:
+    /**
+     * @brief The timing recorded for a single benchmark case.
+     */
+    struct Result
+    {
+        QString name;
+        int iterations;
+        double nsPerIteration;
+        double minNsPerIteration;
+    };
+
+    /**
+     * @brief Only cases whose name contains this string are run.
+     */
+    QString m_Filter;
+
+    /**
+     * @brief The results recorded so far, in the order they were run.
+     */
+    QVector<Result> m_Results;
+};
+
+#endif // BENCHMARKRUNNER_H
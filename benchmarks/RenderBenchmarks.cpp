@@ -0,0 +1,146 @@
+#include "RenderBenchmarks.h"
+#include "MyOpenGLWidget.h"
+#include "PathLevels.h"
+#include "SpatialIndex.h"
+#include "VertexFiller.h"
+#include <QImage>
+#include <QOpenGLContext>
+#include <QTextStream>
+
+namespace
+{
+    /**
+     * @brief The width of the framebuffer drawn into, in pixels.
+     */
+    const int RENDER_WIDTH = 1280;
+
+    /**
+     * @brief The height of the framebuffer drawn into, in pixels.
+     */
+    const int RENDER_HEIGHT = 720;
+
+    /**
+     * @brief The number of frames of each path drawn by the trail case.
+     */
+    const int TRAIL_FRAMES = 20;
+
+    /**
+     * @brief The zoom of the culling cases, which shows a tenth of the
+     * width of the default view.
+     */
+    const float ZOOMED_IN = 0.1f;
+
+    /**
+     * @brief Returns the fraction of pixels which differ between two images
+     * of the same size.
+     * @param first The first image.
+     * @param second The second image.
+     * @return The fraction of pixels with any differing channel.
+     */
+    double differingPixels(const QImage& first, const QImage& second)
+    {
+        qint64 differing = 0;
+        for (int y = 0; y < first.height(); ++y)
+        {
+            for (int x = 0; x < first.width(); ++x)
+            {
+                if (first.pixel(x, y) != second.pixel(x, y))
+                {
+                    ++differing;
+                }
+            }
+        }
+        return (double)differing/qMax(1, first.width()*first.height());
+    }
+}
+
+void BenchmarkRender(BenchmarkRunner& runner,
+                     const QVector<Atom*>& atoms,
+                     const QVector3D& box)
+{
+    if (!runner.ShouldRun("render/") || atoms.isEmpty())
+    {
+        return;
+    }
+
+    MyOpenGLWidget widget;
+    widget.resize(RENDER_WIDTH, RENDER_HEIGHT);
+    widget.grabFramebuffer();
+    if (!widget.context() || !widget.context()->isValid())
+    {
+        QTextStream(stdout) << "No OpenGL context available, "
+                               "skipping render benchmarks" << endl;
+        return;
+    }
+
+    VertexFiller filler(atoms);
+    runner.Run("render/create_traj_buffer", 5, [&widget, &filler]()
+    {
+        widget.CreateTrajBuffer(filler);
+    });
+
+    widget.SetBoundingBox(box);
+    widget.ResetLighting();
+    widget.ResetView();
+
+    // Each draw includes reading back the framebuffer, which waits for the
+    // GPU to finish and so gives a true time for the frame.
+    widget.SetDrawPoints(true);
+    runner.Run("render/draw_points", 20, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+
+    widget.SetDrawPoints(false);
+    widget.SetDrawPaths(true);
+    runner.Run("render/draw_paths", 5, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+
+    // Compare the simplified paths with the full paths drawn from the same
+    // view, which should differ only where a simplified path has moved by
+    // under PATH_ERROR_PIXELS.
+    QImage full = widget.grabFramebuffer();
+    PathLevels levels;
+    levels.Build(atoms);
+    widget.CreatePathLevelBuffers(levels, PathLevels());
+    runner.Run("render/draw_paths_simplified", 5, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+    QImage simplified = widget.grabFramebuffer();
+    QTextStream(stdout) << "Simplified paths differ from the full paths in "
+                        << 100*differingPixels(full, simplified)
+                        << "% of pixels" << endl;
+
+    widget.SetFrame(atoms[0]->GetTrajectoryRef().length()/2);
+    widget.SetTrailLength(TRAIL_FRAMES);
+    runner.Run("render/draw_paths_trail", 5, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+
+    // Zoom in on the centre of the box, first drawing every atom and then
+    // only those the spatial index finds in view, which should give the
+    // same image.
+    widget.SetTrailLength(0);
+    widget.SetZoom(ZOOMED_IN);
+    widget.SetDrawPoints(true);
+    runner.Run("render/draw_zoomed", 5, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+    QImage unculled = widget.grabFramebuffer();
+    SpatialIndex index;
+    index.Build(atoms);
+    widget.SetSpatialIndices(index, SpatialIndex());
+    runner.Run("render/draw_zoomed_culled", 5, [&widget]()
+    {
+        BenchmarkRunner::KeepValue(widget.grabFramebuffer().width());
+    });
+    QImage culled = widget.grabFramebuffer();
+    QTextStream(stdout) << "Culled view differs from the full view in "
+                        << 100*differingPixels(unculled, culled)
+                        << "% of pixels" << endl;
+}
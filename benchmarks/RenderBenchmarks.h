@@ -0,0 +1,31 @@
+/**
+ * @file RenderBenchmarks.h
+ * @date 19 Oct 2026
+ * @see MyOpenGLWidget.h
+ * @brief Benchmarks for uploading trajectories to the GPU and drawing them.
+ *
+ * The cases render through an MyOpenGLWidget that is never shown, using
+ * QOpenGLWidget::grabFramebuffer() to initialise and draw it, so they can be
+ * run on machines without a display using the offscreen platform.
+ */
+
+#ifndef RENDERBENCHMARKS_H
+#define RENDERBENCHMARKS_H
+
+#include "Atom.h"
+#include "BenchmarkRunner.h"
+
+/**
+ * @brief Benchmarks CreateTrajBuffer() and drawing of points and paths for a
+ * set of atoms, then draws the simplified paths, printing the fraction of
+ * pixels differing from the full paths, and trails. The cases are skipped if
+ * no OpenGL context can be created.
+ * @param runner The BenchmarkRunner used to time the cases.
+ * @param atoms The atoms to be drawn.
+ * @param box The dimensions of the simulation box containing the atoms.
+ */
+void BenchmarkRender(BenchmarkRunner& runner,
+                     const QVector<Atom*>& atoms,
+                     const QVector3D& box);
+
+#endif // RENDERBENCHMARKS_H
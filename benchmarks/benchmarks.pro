@@ -0,0 +1,35 @@
+#-------------------------------------------------
+#
+# Benchmark executable for MDVis. Builds the parts of the application that
+# are being measured directly from the main source tree. Run with --help for
+# the atom and frame counts, case filter and JSON output options.
+#
+#-------------------------------------------------
+
+QT       += core gui widgets concurrent
+
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TARGET = mdvis-bench
+TEMPLATE = app
+
+include(../MDVisCore.pri)
+
+win32: LIBS += -lopengl32 -lglu32
+unix: LIBS += -lGLU
+
+SOURCES += main.cpp \
+    BenchmarkRunner.cpp \
+    RenderBenchmarks.cpp \
+    ../MyOpenGLWidget.cpp \
+    ../Transform3D.cpp \
+    ../Camera3D.cpp
+
+HEADERS  += BenchmarkRunner.h \
+    RenderBenchmarks.h \
+    ../MyOpenGLWidget.h \
+    ../Transform3D.h \
+    ../Camera3D.h
+
+RESOURCES += ../resources.qrc
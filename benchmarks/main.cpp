@@ -0,0 +1,975 @@
+#include "BenchmarkRunner.h"
+#include "Atom.h"
+#include "AtomTable.h"
+#include "CellList.h"
+#include "ColourMapper.h"
+#include "ColourMaps.h"
+#include "CurvatureKernel.h"
+#include "FileReader.h"
+#include "Frustum.h"
+#include "MeanSquareDisplacement.h"
+#include "Parallel.h"
+#include "PathLevels.h"
+#include "PrincipalComponents.h"
+#include "RadialDistribution.h"
+#include "RenderBenchmarks.h"
+#include "SelectionExpression.h"
+#include "SpatialIndex.h"
+#include "Superposition.h"
+#include "TrajectoryGenerator.h"
+#include "VertexFiller.h"
+#include "XtcPipeline.h"
+#include "xdrfile.h"
+#include "xdrfile_xtc.h"
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonObject>
+#include <QMatrix4x4>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QVector3D>
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief The field of view of the zoomed culling case, in degrees, which
+     * is that of the view zoomed in ten times.
+     */
+    const float ZOOMED_FOV_DEGREES = 5.04f;
+
+    /**
+     * @brief The distance from the ray within which the pick cases accept
+     * an atom, in nm.
+     */
+    const float PICK_RADIUS = 0.05f;
+
+    /**
+     * @brief The distance within which the neighbour cases count pairs of
+     * atoms, in nm.
+     */
+    const float NEIGHBOUR_RADIUS = 0.5f;
+
+    /**
+     * @brief The largest number of atoms for which every pair is tested by
+     * the brute force neighbour case.
+     */
+    const int BRUTE_FORCE_MAX_ATOMS = 50000;
+
+    /**
+     * @brief The number of atoms whose mean square displacement is found by
+     * the double loop in the direct case, which takes O(N^2) time in the
+     * number of frames.
+     */
+    const int MSD_DIRECT_ATOMS = 100;
+
+    /**
+     * @brief The number of atoms whose principal components are found, from
+     * the start of the trajectory.
+     */
+    const int PCA_ATOMS = 1000;
+
+    /**
+     * @brief The cutoff of the radial distribution function case, in nm.
+     */
+    const float RDF_CUTOFF = 1.0f;
+
+    /**
+     * @brief Creates atoms following deterministic random walks.
+     * @param atoms The number of atoms to create.
+     * @param frames The number of frames in each trajectory.
+     * @return A QVector of new Atom pointers, owned by the caller.
+     */
+    QVector<Atom*> createAtoms(int atoms, int frames)
+    {
+        quint32 seed = 12345;
+        auto random = [&seed]()
+        {
+            seed = seed*1664525u + 1013904223u;
+            return (float)(seed >> 8)/(1 << 24) - 0.5f;
+        };
+
+        QVector<Atom*> atomVector;
+        for (int i = 0; i < atoms; ++i)
+        {
+            Atom* atom = new Atom();
+            QVector3D position(random(), random(), random());
+            for (int j = 0; j < frames; ++j)
+            {
+                position += 0.1f*QVector3D(random(), random(), random());
+                atom->AddTimeStep(position.x(), position.y(), position.z(), j);
+            }
+            atomVector.append(atom);
+        }
+        return atomVector;
+    }
+
+    /**
+     * @brief Benchmarks the stages of loading a trajectory: parsing the .gro
+     * file, decoding the .xtc file, unwrapping the periodic boundary, the
+     * same work through the threaded XtcPipeline and the whole of
+     * FileReader::LoadData().
+     * @param runner The BenchmarkRunner used to time the cases.
+     * @param groFilePath The path of the .gro file.
+     * @param xtcFilePath The path of the .xtc file.
+     */
+    void benchmarkLoading(BenchmarkRunner& runner,
+                          const QString& groFilePath,
+                          const QString& xtcFilePath)
+    {
+        runner.Run("load/gro_parse", 5, [&groFilePath]()
+        {
+            QFile groFile(groFilePath);
+            groFile.open(QIODevice::ReadOnly);
+            QStringList lines = QString(groFile.readAll()).split("\n");
+            QVector<Atom*> atoms;
+            for (int i = 2; i < lines.length() - 2; ++i)
+            {
+                atoms.append(new Atom(lines[i]));
+            }
+            BenchmarkRunner::KeepValue(atoms.last()->GetParentResidueID());
+            qDeleteAll(atoms);
+        });
+
+        QByteArray xtcPath = xtcFilePath.toLocal8Bit();
+        int atoms = 0;
+        read_xtc_natoms(xtcPath.data(), &atoms);
+        QVector<float> frames;
+        QVector<float> boxes;
+        runner.Run("load/read_xtc", 5, [&]()
+        {
+            frames.clear();
+            boxes.clear();
+            XDRFILE* xtcFile = xdrfile_open(xtcPath.data(), "r");
+            QVector<float> frame(atoms*3);
+            int step;
+            float time;
+            float precision;
+            matrix box;
+            while (read_xtc(xtcFile, atoms, &step, &time, box,
+                            reinterpret_cast<rvec*>(frame.data()),
+                            &precision) == exdrOK)
+            {
+                frames += frame;
+                boxes << box[0][0] << box[1][1] << box[2][2];
+            }
+            xdrfile_close(xtcFile);
+            BenchmarkRunner::KeepValue(frames.last());
+        });
+
+        runner.Run("load/unwrap", 5, [&]()
+        {
+            QVector<float> unwrapped = frames;
+            float* positions = unwrapped.data();
+            int frameCount = boxes.length()/3;
+            for (int i = 1; i < frameCount; ++i)
+            {
+                float* current = positions + i*atoms*3;
+                const float* previous = current - atoms*3;
+                for (int j = 0; j < atoms*3; ++j)
+                {
+                    current[j] = FileReader::UnwrapCoordinate(
+                                current[j], previous[j], boxes[3*i + j % 3]);
+                }
+            }
+            BenchmarkRunner::KeepValue(unwrapped.last());
+        });
+
+        QVector<Atom*> pipelineAtoms;
+        for (int i = 0; i < atoms; ++i)
+        {
+            pipelineAtoms.append(new Atom());
+        }
+        auto clearPipelineAtoms = [&]()
+        {
+            for (int i = 0; i < pipelineAtoms.length(); ++i)
+            {
+                pipelineAtoms[i]->GetTrajectoryRef().clear();
+                pipelineAtoms[i]->GetStepTimeRef().clear();
+            }
+        };
+        runner.Run("load/index", 5, [&]()
+        {
+            XtcFrameIndex index;
+            index.Build(xtcFilePath);
+            BenchmarkRunner::KeepValue(index.GetFrames().length());
+        });
+        XtcFrameIndex index;
+        index.Build(xtcFilePath);
+        float noLimit = std::numeric_limits<float>::infinity();
+        QVector<int> allFrames = index.Select(-noLimit, noLimit, 1);
+        runner.Run("load/pipeline", 5, [&]()
+        {
+            XtcPipeline pipeline(pipelineAtoms, QVector<int>(), index, allFrames);
+            pipeline.Run(xtcFilePath);
+            BenchmarkRunner::KeepValue(pipeline.GetFramesRead());
+        }, clearPipelineAtoms);
+        // Skipped frames are never decoded, so this should take about a
+        // quarter of the time of loading every frame.
+        QVector<int> strideFrames = index.Select(-noLimit, noLimit, 4);
+        runner.Run("load/pipeline_stride4", 5, [&]()
+        {
+            XtcPipeline pipeline(pipelineAtoms, QVector<int>(), index, strideFrames);
+            pipeline.Run(xtcFilePath);
+            BenchmarkRunner::KeepValue(pipeline.GetFramesRead());
+        }, clearPipelineAtoms);
+        // Every frame is still decoded, but only a tenth of the atoms are
+        // unwrapped and stored.
+        QVector<Atom*> subsetAtoms;
+        QVector<int> subsetIndices;
+        for (int i = 0; i < atoms; i += 10)
+        {
+            subsetAtoms.append(pipelineAtoms[i]);
+            subsetIndices.append(i);
+        }
+        runner.Run("load/pipeline_subset10", 5, [&]()
+        {
+            XtcPipeline pipeline(subsetAtoms, subsetIndices, index, allFrames);
+            pipeline.Run(xtcFilePath);
+            BenchmarkRunner::KeepValue(pipeline.GetFramesRead());
+        }, clearPipelineAtoms);
+        qDeleteAll(pipelineAtoms);
+
+        FileReader reader;
+        runner.Run("load/load_data", 3, [&]()
+        {
+            reader.LoadData(groFilePath, xtcFilePath);
+            BenchmarkRunner::KeepValue(reader.GetAtomVectorRef().length());
+        });
+    }
+
+    /**
+     * @brief Benchmarks each FileReader::Calculate* function, the Residue
+     * centroids calculated on loading, building the simplified paths and the
+     * sort of atoms by path length done by MainWindow after loading. The
+     * trajectory is reloaded, untimed, before each iteration so that nothing
+     * is cached.
+     * @param runner The BenchmarkRunner used to time the cases.
+     * @param groFilePath The path of the .gro file.
+     * @param xtcFilePath The path of the .xtc file.
+     */
+    void benchmarkAnalysis(BenchmarkRunner& runner,
+                           const QString& groFilePath,
+                           const QString& xtcFilePath)
+    {
+        FileReader reader;
+        auto load = [&]()
+        {
+            reader.LoadData(groFilePath, xtcFilePath);
+        };
+
+        runner.Run("analysis/path_length", 3, [&reader]()
+        {
+            reader.CalculatePathLength();
+        }, load);
+
+        runner.Run("analysis/velocity", 3, [&reader]()
+        {
+            reader.CalculateVelocity();
+        }, load);
+
+        runner.Run("analysis/path_curvature", 3, [&reader]()
+        {
+            reader.CalculatePathCurvature();
+        }, load);
+
+        runner.Run("analysis/discrete_curvature", 3, [&reader]()
+        {
+            reader.CalculateDiscreteCurvature();
+        }, load);
+
+        // The FFT mean square displacement of every atom, and the double
+        // loop over every pair of frames for the first MSD_DIRECT_ATOMS
+        // atoms, which should agree.
+        runner.Run("analysis/msd_fft", 3, [&reader]()
+        {
+            MeanSquareDisplacement::Calculate(reader.GetAtomVectorRef());
+            BenchmarkRunner::KeepValue(
+                        reader.GetAtomVectorRef()[0]->GetDiffusionRef()[0]);
+        }, load);
+
+        QVector<float> directMsd;
+        runner.Run("analysis/msd_direct", 1, [&reader, &directMsd]()
+        {
+            const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+            int count = qMin(atoms.length(), MSD_DIRECT_ATOMS);
+            int frames = atoms[0]->GetTrajectoryRef().length();
+            directMsd.resize(count*frames);
+            float* msd = directMsd.data();
+            Parallel::For(count, 1, [&atoms, msd, frames](int, int first, int last)
+            {
+                for (int i = first; i < last; ++i)
+                {
+                    const QVector<QVector3D>& trajectory = atoms[i]->GetTrajectoryRef();
+                    for (int lag = 0; lag < frames; ++lag)
+                    {
+                        double sum = 0;
+                        for (int j = 0; j + lag < frames; ++j)
+                        {
+                            sum += (trajectory[j + lag] - trajectory[j]).lengthSquared();
+                        }
+                        msd[i*frames + lag] = sum/(frames - lag);
+                    }
+                }
+            });
+            BenchmarkRunner::KeepValue(directMsd.last());
+        }, [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+            MeanSquareDisplacement::Calculate(reader.GetAtomVectorRef());
+        });
+        if (runner.ShouldRun("analysis/msd_direct") && !directMsd.isEmpty())
+        {
+            const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+            int frames = atoms[0]->GetTrajectoryRef().length();
+            double largest = 0;
+            for (int i = 0; i < directMsd.length(); ++i)
+            {
+                float fft = atoms[i/frames]->GetMeanSquareDisplacementRef()[i % frames];
+                largest = qMax(largest, (double)qAbs(fft - directMsd[i])
+                               /qMax(directMsd[i], 1e-6f));
+            }
+            QTextStream(stdout) << "Largest relative MSD difference " << largest
+                                << endl;
+        }
+
+        // Fit every frame onto the first by all of the atoms, then measure
+        // the fluctuation of every atom about its fitted mean position and
+        // store the aligned positions.
+        Superposition superposition;
+        QVector<Superposition::Fit> fits;
+        auto loadFit = [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+            superposition.SetReference(reader.GetAtomVectorRef(), 0);
+            superposition.FitFrames(fits);
+        };
+        runner.Run("analysis/fit_frames", 3, [&superposition, &fits]()
+        {
+            superposition.FitFrames(fits);
+            BenchmarkRunner::KeepValue(fits.last().rmsd);
+        }, loadFit);
+
+        runner.Run("analysis/rmsf", 3, [&reader, &fits]()
+        {
+            Superposition::CalculateFluctuation(reader.GetAtomVectorRef(), fits);
+            BenchmarkRunner::KeepValue(
+                        reader.GetAtomVectorRef()[0]->GetFluctuationRef()[0]);
+        }, loadFit);
+
+        runner.Run("analysis/align", 3, [&reader, &fits]()
+        {
+            Superposition::Align(reader.GetAtomVectorRef(), fits);
+            BenchmarkRunner::KeepValue(
+                        reader.GetAtomVectorRef()[0]->GetAlignedTrajectoryRef().last().x());
+        }, loadFit);
+
+        // The principal components of the fitted motion of the first
+        // PCA_ATOMS atoms, and of every atom.
+        PrincipalComponents pca;
+        Bitset pcaSelection;
+        auto loadPca = [&](int atoms)
+        {
+            loadFit();
+            int count = reader.GetAtomVectorRef().length();
+            pcaSelection = Bitset(count);
+            for (int i = 0; i < qMin(count, atoms); ++i)
+            {
+                pcaSelection.Set(i);
+            }
+        };
+        auto runPca = [&](const QString& name, int atoms)
+        {
+            runner.Run(name, 3, [&reader, &fits, &pca, &pcaSelection]()
+            {
+                pca.Calculate(reader.GetAtomVectorRef(), pcaSelection, fits);
+                BenchmarkRunner::KeepValue(pca.GetVariance(0));
+            }, [&loadPca, atoms]()
+            {
+                loadPca(atoms);
+            });
+            if (runner.ShouldRun(name) && pca.GetComponents() > 0)
+            {
+                QTextStream(stdout) << name << ": " << pca.GetIterations()
+                                    << " iterations, "
+                                    << (pca.IsMatrixFree() ? "matrix-free"
+                                                           : "covariance formed")
+                                    << ", first variance " << pca.GetVariance(0)
+                                    << endl;
+            }
+        };
+        runPca("analysis/pca", PCA_ATOMS);
+        runPca("analysis/pca_all_atoms", std::numeric_limits<int>::max());
+
+        // The centroids are calculated by LoadData(), so this repeats that
+        // step over the Residues of the loaded trajectory.
+        runner.Run("analysis/residue_centroids", 5, [&reader]()
+        {
+            Residue* const* residues = reader.GetResidueVectorRef().constData();
+            QVector3D box = reader.GetSimBoxRef();
+            Parallel::For(reader.GetResidueVectorRef().length(), 16,
+                          [residues, box](int, int first, int last)
+            {
+                for (int i = first; i < last; ++i)
+                {
+                    residues[i]->CalculateCentroid(box);
+                }
+            });
+            BenchmarkRunner::KeepValue(reader.GetResidueRadius());
+        }, [&]()
+        {
+            if (reader.GetResidueVectorRef().isEmpty())
+            {
+                load();
+            }
+        });
+
+        runner.Run("analysis/path_levels", 3, [&reader]()
+        {
+            PathLevels levels;
+            levels.Build(reader.GetAtomVectorRef());
+            BenchmarkRunner::KeepValue(levels.GetIndexCount());
+        }, [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+        });
+
+        // Index the atoms, move the index through the frames, then look into
+        // a region a tenth of the width of the box, as the view does when
+        // zoomed in ten times.
+        SpatialIndex index;
+        auto loadIndex = [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+            if (index.GetAtoms() != reader.GetAtomVectorRef().length())
+            {
+                index.Build(reader.GetAtomVectorRef());
+            }
+        };
+        runner.Run("analysis/spatial_index", 3, [&index, &reader]()
+        {
+            index.Build(reader.GetAtomVectorRef());
+            BenchmarkRunner::KeepValue(index.GetBytes());
+        }, [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+        });
+
+        int frame = 0;
+        runner.Run("analysis/spatial_frame", 20, [&index, &frame, &reader]()
+        {
+            frame = (frame + 1) % reader.GetAtomVectorRef()[0]->GetTrajectoryRef().length();
+            index.SetFrame(frame);
+        }, loadIndex);
+
+        QVector3D box = reader.GetSimBoxRef();
+        QMatrix4x4 modelToClip;
+        modelToClip.perspective(ZOOMED_FOV_DEGREES, 16.0f/9, 1, 3*box.x());
+        modelToClip.lookAt(QVector3D(0, 0, -1.5f*box.x()), QVector3D(),
+                           QVector3D(0, 1, 0));
+        modelToClip.translate(-box/2);
+        Frustum frustum(modelToClip);
+        QVector<int> culled;
+        int points = 0;
+        int paths = 0;
+        runner.Run("analysis/cull_zoomed", 100, [&]()
+        {
+            int atoms = index.GetAtoms();
+            points = index.CullPoints(frustum, atoms, culled) ? culled.length() : atoms;
+            paths = index.CullPaths(frustum, atoms, culled) ? culled.length() : atoms;
+        }, loadIndex);
+        if (runner.ShouldRun("analysis/cull_zoomed"))
+        {
+            QTextStream(stdout) << "Zoomed view keeps " << points << " points and "
+                                << paths << " paths of " << index.GetAtoms()
+                                << " atoms" << endl;
+        }
+
+        // Pick along a ray through the middle of the box, as a click in the
+        // centre of the default view does, against testing every atom.
+        QVector3D origin(box.x()/2, box.y()/2, -box.z());
+        QVector3D direction(0, 0, 1);
+        int picked = -1;
+        runner.Run("analysis/pick", 100, [&]()
+        {
+            index.SetFrame(0);
+            index.FindAlongRay(origin, direction, PICK_RADIUS, culled);
+            picked = culled.isEmpty() ? -1 : culled.first();
+        }, loadIndex);
+        int brutePicked = -1;
+        runner.Run("analysis/pick_brute_force", 10, [&]()
+        {
+            const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+            float nearest = std::numeric_limits<float>::infinity();
+            brutePicked = -1;
+            for (int i = 0; i < atoms.length(); ++i)
+            {
+                QVector3D offset = atoms[i]->GetTrajectoryRef()[0] - origin;
+                float along = QVector3D::dotProduct(offset, direction);
+                if (along >= 0 && along < nearest && offset.lengthSquared()
+                        - along*along <= PICK_RADIUS*PICK_RADIUS)
+                {
+                    nearest = along;
+                    brutePicked = i;
+                }
+            }
+        }, loadIndex);
+        if (runner.ShouldRun("analysis/pick"))
+        {
+            QTextStream(stdout) << "Picked atom " << picked << ", brute force "
+                                << brutePicked << endl;
+        }
+
+        // Count the pairs within NEIGHBOUR_RADIUS at the first frame with the
+        // cell list and by testing every pair, which should agree.
+        CellList cells;
+        auto loadCells = [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+            if (cells.GetAtoms() != reader.GetAtomVectorRef().length())
+            {
+                cells.Build(reader.GetAtomVectorRef(), 0, reader.GetSimBoxRef(),
+                            NEIGHBOUR_RADIUS);
+            }
+        };
+        runner.Run("analysis/neighbour_build", 10, [&cells, &reader]()
+        {
+            cells.Build(reader.GetAtomVectorRef(), 0, reader.GetSimBoxRef(),
+                        NEIGHBOUR_RADIUS);
+        }, loadCells);
+
+        qint64 pairs = 0;
+        runner.Run("analysis/neighbour_pairs", 5, [&cells, &pairs]()
+        {
+            QVector<qint64> counts(Parallel::ChunkCount(cells.GetCells(), 1), 0);
+            qint64* countData = counts.data();
+            Parallel::For(cells.GetCells(), 1,
+                          [&cells, countData](int chunk, int first, int last)
+            {
+                cells.ForEachPair(first, last, NEIGHBOUR_RADIUS,
+                                  [countData, chunk](int, int, float)
+                {
+                    ++countData[chunk];
+                });
+            });
+            pairs = 0;
+            for (int i = 0; i < counts.length(); ++i)
+            {
+                pairs += counts[i];
+            }
+        }, loadCells);
+
+        qint64 brutePairs = 0;
+        runner.Run("analysis/neighbour_pairs_brute_force", 1, [&]()
+        {
+            const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+            if (atoms.length() > BRUTE_FORCE_MAX_ATOMS)
+            {
+                return;
+            }
+            QVector<qint64> counts(Parallel::ChunkCount(atoms.length(), 64), 0);
+            qint64* countData = counts.data();
+            float radiusSquared = NEIGHBOUR_RADIUS*NEIGHBOUR_RADIUS;
+            Parallel::For(atoms.length(), 64,
+                          [&atoms, &cells, countData, radiusSquared]
+                          (int chunk, int first, int last)
+            {
+                QVector3D box = cells.GetBox();
+                for (int i = first; i < last; ++i)
+                {
+                    QVector3D position = atoms[i]->GetTrajectoryRef()[0];
+                    for (int j = i + 1; j < atoms.length(); ++j)
+                    {
+                        QVector3D delta = atoms[j]->GetTrajectoryRef()[0] - position;
+                        for (int axis = 0; axis < 3; ++axis)
+                        {
+                            delta[axis] -= box[axis]*qRound(delta[axis]/box[axis]);
+                        }
+                        if (delta.lengthSquared() <= radiusSquared)
+                        {
+                            ++countData[chunk];
+                        }
+                    }
+                }
+            });
+            brutePairs = 0;
+            for (int i = 0; i < counts.length(); ++i)
+            {
+                brutePairs += counts[i];
+            }
+        }, loadCells);
+        if (runner.ShouldRun("analysis/neighbour_pairs"))
+        {
+            QTextStream(stdout) << "Cell list found " << pairs
+                                << " pairs, brute force " << brutePairs << endl;
+        }
+
+        // The radial distribution function between every pair of atoms,
+        // over every frame.
+        RadialDistribution rdf;
+        rdf.SetCutoff(RDF_CUTOFF);
+        runner.Run("analysis/rdf", 1, [&rdf, &reader]()
+        {
+            int atoms = reader.GetAtomVectorRef().length();
+            Bitset all(atoms, true);
+            rdf.Calculate(reader.GetAtomVectorRef(), all, all,
+                          reader.GetSimBoxRef());
+            BenchmarkRunner::KeepValue(rdf.GetValues().last());
+        }, loadCells);
+
+        QVector<Atom*> sorted;
+        runner.Run("analysis/sort", 10, [&sorted]()
+        {
+            std::sort(sorted.begin(), sorted.end(), Atom::PathLengthLessThan);
+            BenchmarkRunner::KeepValue(sorted.last()->GetPathLengthRef().last());
+        }, [&]()
+        {
+            if (reader.GetAtomVectorRef().isEmpty())
+            {
+                load();
+            }
+            reader.CalculatePathLength();
+            sorted = reader.GetAtomVectorRef();
+        });
+    }
+
+    /**
+     * @brief Benchmarks creation of the colour maps at startup, comparing the
+     * constant table with building a QVector of maps one colour at a time.
+     * @param runner The BenchmarkRunner used to time the cases.
+     */
+    void benchmarkColourMaps(BenchmarkRunner& runner)
+    {
+        runner.Run("colour_maps/construct", 1000, []()
+        {
+            ColourMaps maps;
+            BenchmarkRunner::KeepValue(maps.GetMapData(15)[0]);
+        });
+
+        runner.Run("colour_maps/construct_appended", 100, []()
+        {
+            ColourMaps maps;
+            QVector<QVector<QVector3D> > appended;
+            for (int i = 0; i < maps.GetNumberOfMaps(); ++i)
+            {
+                QVector<QVector3D> map;
+                const float* data = maps.GetMapData(i);
+                for (int j = 0; j < maps.GetMapLength(); ++j)
+                {
+                    map.append(QVector3D(data[3*j], data[3*j + 1], data[3*j + 2]));
+                }
+                appended.append(map);
+            }
+            BenchmarkRunner::KeepValue(appended.last().last().x());
+        });
+
+        ColourMaps maps;
+        runner.Run("colour_maps/lookup", 100, [&maps]()
+        {
+            float sum = 0;
+            for (int i = 0; i < 100000; ++i)
+            {
+                sum += maps.GetColour(15, i % ColourMaps::MAP_LENGTH).x();
+            }
+            BenchmarkRunner::KeepValue(sum);
+        });
+    }
+
+    /**
+     * @brief Benchmarks mapping an array of values to colours, comparing the
+     * look-up table kernel with calling ColourMaps::GetColour() per value,
+     * and writing coloured vertices with the VertexFiller, as is done for
+     * each upload of the trajectory buffer.
+     * @param runner The BenchmarkRunner used to time the cases.
+     * @param atoms The number of atoms.
+     * @param frames The number of frames.
+     */
+    void benchmarkColourMapping(BenchmarkRunner& runner, int atoms, int frames)
+    {
+        if (!runner.ShouldRun("colour_mapping/"))
+        {
+            return;
+        }
+        const int count = atoms*frames;
+        QVector<float> values(count);
+        for (int i = 0; i < count; ++i)
+        {
+            values[i] = (float)(i % 9973)/9973;
+        }
+        QVector<float> colours(count*ColourMapper::TUPLE_SIZE);
+        ColourMaps maps;
+
+        runner.Run("colour_mapping/get_colour", 10, [&]()
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                int mapIndex = maps.GetMapLength()*values[i];
+                QVector3D colour = maps.GetColour(15, mapIndex);
+                colours[3*i] = colour.x();
+                colours[3*i + 1] = colour.y();
+                colours[3*i + 2] = colour.z();
+            }
+            BenchmarkRunner::KeepValue(colours[0]);
+        });
+
+        ColourMapper mapper;
+        mapper.SetColourMap(maps.GetMapData(15), maps.GetMapLength());
+        mapper.SetRange(0, 1);
+
+        runner.Run("colour_mapping/lut", 10, [&]()
+        {
+            mapper.Map(values.constData(), count, colours.data());
+            BenchmarkRunner::KeepValue(colours[0]);
+        });
+
+        runner.Run("colour_mapping/lut_parallel", 10, [&]()
+        {
+            mapper.MapParallel(values.constData(), count, colours.data());
+            BenchmarkRunner::KeepValue(colours[0]);
+        });
+
+        colours.clear();
+        colours.squeeze();
+        values.clear();
+        values.squeeze();
+        QVector<Atom*> atomVector = createAtoms(atoms, frames);
+        for (int i = 0; i < atomVector.length(); ++i)
+        {
+            atomVector[i]->CalculateVelocity();
+        }
+        VertexFiller filler(atomVector);
+        filler.SetColours(&mapper, &Atom::GetVelocityRef, false);
+        QVector<Vertex> vertices(atoms*frames);
+        runner.Run("colour_mapping/vertices", 10, [&]()
+        {
+            filler.Fill(0, atoms, vertices.data());
+            BenchmarkRunner::KeepValue(vertices[0].GetColour().x());
+        });
+        qDeleteAll(atomVector);
+    }
+
+    /**
+     * @brief Benchmarks path curvature, comparing the trigonometric per-atom
+     * calculation with the structure of arrays CurvatureKernel.
+     * @param runner The BenchmarkRunner used to time the cases.
+     * @param atomCount The number of atoms.
+     * @param frames The number of frames.
+     */
+    void benchmarkCurvature(BenchmarkRunner& runner, int atomCount, int frames)
+    {
+        if (!runner.ShouldRun("curvature/"))
+        {
+            return;
+        }
+        QVector<Atom*> atoms = createAtoms(atomCount, frames);
+
+        runner.Run("curvature/atom_trig", 5, [&]()
+        {
+            for (int i = 0; i < atoms.length(); ++i)
+            {
+                atoms[i]->GetPathCurvatureRef().clear();
+                atoms[i]->CalculatePathCurvature();
+            }
+            BenchmarkRunner::KeepValue(atoms[0]->GetPathCurvatureRef()[1]);
+        });
+
+        runner.Run("curvature/kernel", 5, [&]()
+        {
+            CurvatureKernel::Calculate(atoms);
+            BenchmarkRunner::KeepValue(atoms[0]->GetDiscreteCurvatureRef()[1]);
+        });
+
+        qDeleteAll(atoms);
+    }
+
+    /**
+     * @brief Benchmarks compiling and evaluating a selection expression over
+     * a million atom topology, against matching the same expression by
+     * comparing the names of each atom in turn.
+     * @param runner The BenchmarkRunner used to time the cases.
+     */
+    void benchmarkSelection(BenchmarkRunner& runner)
+    {
+        if (!runner.ShouldRun("selection/"))
+        {
+            return;
+        }
+
+        const int atomCount = 1000000;
+        const int atomsPerResidue = 10;
+        const QStringList residueNames = QStringList()
+                << "ALA" << "GLY" << "LEU" << "LIG" << "SOL";
+        const QStringList atomNames = QStringList()
+                << "N" << "CA" << "C" << "O" << "CB";
+        QVector<Atom*> atoms;
+        atoms.reserve(atomCount);
+        for (int i = 0; i < atomCount; ++i)
+        {
+            int residue = i/atomsPerResidue + 1;
+            QString line = QString("%1%2%3").arg(residue % 100000, 5)
+                    .arg(residueNames[residue % residueNames.length()], -5)
+                    .arg(atomNames[i % atomNames.length()], 5);
+            Atom* atom = new Atom(line);
+            atom->SetAtomNumber(i + 1);
+            atoms.append(atom);
+        }
+
+        const QString expression = "resname LIG or (name CA and resid 10-20000)";
+        runner.Run("selection/compile", 1000, [&]()
+        {
+            SelectionExpression selection;
+            BenchmarkRunner::KeepValue(selection.Compile(expression));
+        });
+
+        AtomTable table;
+        runner.Run("selection/table", 3, [&]()
+        {
+            table = AtomTable::FromAtoms(atoms);
+            BenchmarkRunner::KeepValue(table.GetAtoms());
+        });
+
+        SelectionExpression selection;
+        selection.Compile(expression);
+        runner.Run("selection/evaluate", 20, [&]()
+        {
+            BenchmarkRunner::KeepValue(selection.Evaluate(table).Count());
+        });
+
+        runner.Run("selection/string_compare", 3, [&]()
+        {
+            Bitset selected(atomCount);
+            for (int i = 0; i < atomCount; ++i)
+            {
+                int residueID = atoms[i]->GetParentResidueID();
+                selected.Set(i, atoms[i]->GetParentResidue() == "LIG"
+                             || (atoms[i]->GetAtomName() == "CA"
+                                 && residueID >= 10 && residueID <= 20000));
+            }
+            BenchmarkRunner::KeepValue(selected.Count());
+        });
+
+        qDeleteAll(atoms);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // The render benchmarks never show a window, so default to the offscreen
+    // platform to allow the suite to run without a display.
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty())
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("mdvis-bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks for the MDVis loading, "
+                                     "analysis, colour mapping and render "
+                                     "code.");
+    parser.addHelpOption();
+    QCommandLineOption atomsOption(QStringList() << "a" << "atoms",
+            "The number of atoms in the generated trajectory.",
+            "count", "10000");
+    QCommandLineOption framesOption(QStringList() << "f" << "frames",
+            "The number of frames in the generated trajectory.",
+            "count", "100");
+    QCommandLineOption filterOption(QStringList() << "filter",
+            "Only run cases whose name contains this string.", "text");
+    QCommandLineOption jsonOption(QStringList() << "j" << "json",
+            "Write the results to this JSON file.", "file");
+    parser.addOption(atomsOption);
+    parser.addOption(framesOption);
+    parser.addOption(filterOption);
+    parser.addOption(jsonOption);
+    parser.process(app);
+
+    QTextStream err(stderr);
+    bool atomsOk;
+    bool framesOk;
+    int atoms = parser.value(atomsOption).toInt(&atomsOk);
+    int frames = parser.value(framesOption).toInt(&framesOk);
+    if (!atomsOk || !framesOk || atoms < 1 || frames < 3)
+    {
+        err << "At least 1 atom and 3 frames are required." << endl;
+        return 1;
+    }
+
+    BenchmarkRunner runner;
+    runner.SetFilter(parser.value(filterOption));
+
+    benchmarkColourMaps(runner);
+    benchmarkColourMapping(runner, atoms, frames);
+    benchmarkCurvature(runner, atoms, frames);
+    benchmarkSelection(runner);
+
+    if (runner.ShouldRun("load/") || runner.ShouldRun("analysis/")
+            || runner.ShouldRun("render/"))
+    {
+        QTemporaryDir dir;
+        QString groFilePath = dir.path() + "/fixture.gro";
+        QString xtcFilePath = dir.path() + "/fixture.xtc";
+        TrajectoryGenerator::Settings settings;
+        settings.atoms = atoms;
+        settings.frames = frames;
+        TrajectoryGenerator generator(settings);
+        if (!dir.isValid() || !generator.Write(groFilePath, xtcFilePath))
+        {
+            err << "Could not write the trajectory fixture. "
+                << generator.GetError() << endl;
+            return 1;
+        }
+
+        benchmarkLoading(runner, groFilePath, xtcFilePath);
+        benchmarkAnalysis(runner, groFilePath, xtcFilePath);
+
+        if (runner.ShouldRun("render/"))
+        {
+            FileReader reader;
+            reader.LoadData(groFilePath, xtcFilePath);
+            BenchmarkRender(runner, reader.GetAtomVectorRef(),
+                            reader.GetSimBoxRef());
+        }
+    }
+
+    runner.PrintResults();
+
+    if (parser.isSet(jsonOption))
+    {
+        QJsonObject parameters;
+        parameters["atoms"] = atoms;
+        parameters["frames"] = frames;
+        parameters["threads"] = QThreadPool::globalInstance()->maxThreadCount();
+        parameters["qt_version"] = QString(qVersion());
+        parameters["timestamp"] =
+                QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+        if (!runner.WriteJson(parser.value(jsonOption), parameters))
+        {
+            err << "Could not write " << parser.value(jsonOption) << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,761 @@
+#include "FileReader.h"
+#include "MeanSquareDisplacement.h"
+#include "MemoryAccount.h"
+#include "MemoryBudget.h"
+#include "PrincipalComponents.h"
+#include "RadialDistribution.h"
+#include "ResultsFile.h"
+#include "SelectionExpression.h"
+#include "Trace.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+
+namespace
+{
+    /**
+     * @brief Describes a metric which can be calculated by the tool.
+     */
+    struct MetricOption
+    {
+        /**
+         * @brief The name used to select the metric on the command line.
+         */
+        const char* key;
+
+        /**
+         * @brief The name written to the results file.
+         */
+        const char* name;
+
+        /**
+         * @brief The FileReader function which calculates the metric.
+         */
+        void (FileReader::*calculate)();
+
+        /**
+         * @brief The @Atom getter for the metric's values.
+         */
+        ResultsFile::AtomMetric values;
+
+        /**
+         * @brief The FileReader getter for the metric's minimum.
+         */
+        float (FileReader::*min)();
+
+        /**
+         * @brief The FileReader getter for the metric's maximum.
+         */
+        float (FileReader::*max)();
+    };
+
+    /**
+     * @brief The metrics which can be calculated, in the order they are
+     * written.
+     */
+    const MetricOption METRIC_OPTIONS[] =
+    {
+        {"length", "path_length", &FileReader::CalculatePathLength,
+         &Atom::GetPathLengthRef,
+         &FileReader::GetMinPathLength, &FileReader::GetMaxPathLength},
+        {"velocity", "velocity", &FileReader::CalculateVelocity,
+         &Atom::GetVelocityRef,
+         &FileReader::GetMinVelocity, &FileReader::GetMaxVelocity},
+        {"curvature", "path_curvature", &FileReader::CalculatePathCurvature,
+         &Atom::GetPathCurvatureRef,
+         &FileReader::GetMinPathCurvature, &FileReader::GetMaxPathCurvature},
+        {"discrete", "discrete_curvature",
+         &FileReader::CalculateDiscreteCurvature,
+         &Atom::GetDiscreteCurvatureRef,
+         &FileReader::GetMinDiscreteCurvature,
+         &FileReader::GetMaxDiscreteCurvature},
+        {"diffusion", "diffusion", &FileReader::CalculateDiffusion,
+         &Atom::GetDiffusionRef,
+         &FileReader::GetMinDiffusion, &FileReader::GetMaxDiffusion},
+        {"rmsf", "rmsf", &FileReader::CalculateFluctuation,
+         &Atom::GetFluctuationRef,
+         &FileReader::GetMinFluctuation, &FileReader::GetMaxFluctuation}
+    };
+
+    /**
+     * @brief The number of entries in METRIC_OPTIONS.
+     */
+    const int METRIC_OPTION_COUNT =
+            sizeof(METRIC_OPTIONS)/sizeof(METRIC_OPTIONS[0]);
+
+    /**
+     * @brief Writes the mean square displacement of a selection to a CSV
+     * file, one lag per line.
+     * @param filePath The path of the file.
+     * @param msd The mean square displacement at each lag, in nm^2.
+     * @param stepTime The time of each frame, in ps.
+     * @return true if the file was written, false otherwise.
+     */
+    bool writeMsd(const QString& filePath, const QVector<float>& msd,
+                  const QVector<int>& stepTime)
+    {
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        {
+            return false;
+        }
+
+        QTextStream out(&file);
+        out << "# diffusion "
+            << MeanSquareDisplacement::DiffusionCoefficient(msd, stepTime)
+            << " nm^2/ps\n";
+        out << "lag,time,msd\n";
+        for (int i = 0; i < qMin(msd.length(), stepTime.length()); ++i)
+        {
+            out << i << "," << stepTime[i] - stepTime[0] << "," << msd[i]
+                << "\n";
+        }
+        out.flush();
+        return out.status() == QTextStream::Ok;
+    }
+
+    /**
+     * @brief Writes the RMSD of each frame from the fit reference frame to a
+     * CSV file, one frame per line.
+     * @param filePath The path of the file.
+     * @param fits The fit of each frame.
+     * @param stepTime The time of each frame, in ps.
+     * @return true if the file was written, false otherwise.
+     */
+    bool writeRmsd(const QString& filePath,
+                   const QVector<Superposition::Fit>& fits,
+                   const QVector<int>& stepTime)
+    {
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        {
+            return false;
+        }
+
+        QTextStream out(&file);
+        out << "frame,time,rmsd\n";
+        for (int i = 0; i < qMin(fits.length(), stepTime.length()); ++i)
+        {
+            out << i << "," << stepTime[i] << "," << fits[i].rmsd << "\n";
+        }
+        out.flush();
+        return out.status() == QTextStream::Ok;
+    }
+
+    /**
+     * @brief Writes the time taken by a stage of processing.
+     * @param out The stream to write to.
+     * @param stage The name of the stage.
+     * @param nanoseconds The time taken, in nanoseconds.
+     */
+    void printTiming(QTextStream& out, const QString& stage, qint64 nanoseconds)
+    {
+        out << qSetFieldWidth(28) << left << stage
+            << qSetFieldWidth(12) << right << nanoseconds/1.0e6
+            << qSetFieldWidth(0) << " ms" << endl;
+    }
+
+    /**
+     * @brief Writes the work done by each stage of the .xtc loading pipeline.
+     * The stage with the lowest throughput limits the speed of the load.
+     * @param out The stream to write to.
+     * @param stages The stages, from FileReader::GetLoadStages().
+     */
+    void printLoadStages(QTextStream& out,
+                         const QVector<XtcPipeline::Stage>& stages)
+    {
+        out << qSetFieldWidth(12) << left << "xtc stage"
+            << qSetFieldWidth(10) << right << "threads"
+            << qSetFieldWidth(12) << "busy ms" << qSetFieldWidth(12) << "wait ms"
+            << qSetFieldWidth(12) << "frames/s" << qSetFieldWidth(12) << "MB/s"
+            << qSetFieldWidth(0) << endl;
+        for (int i = 0; i < stages.length(); ++i)
+        {
+            const XtcPipeline::Stage& stage = stages[i];
+            out << qSetFieldWidth(12) << left << stage.name
+                << qSetFieldWidth(10) << right << stage.threads
+                << qSetFieldWidth(12) << stage.busyTime/1.0e6
+                << qSetFieldWidth(12) << stage.waitTime/1.0e6
+                << qSetFieldWidth(12) << qRound(stage.FramesPerSecond())
+                << qSetFieldWidth(12) << qRound(stage.MegabytesPerSecond())
+                << qSetFieldWidth(0) << endl;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("mdvis-cli");
+    QThread::currentThread()->setObjectName("Main");
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    QStringList metricKeys;
+    for (int i = 0; i < METRIC_OPTION_COUNT; ++i)
+    {
+        metricKeys.append(METRIC_OPTIONS[i].key);
+    }
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Calculates MDVis trajectory metrics "
+                                     "without a display.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("gro", "The .gro structure file.");
+    parser.addPositionalArgument("xtc", "The .xtc trajectory file.");
+    QCommandLineOption metricsOption(QStringList() << "m" << "metrics",
+            "Comma separated metrics to calculate, from: "
+            + metricKeys.join(", ") + ". Defaults to all of them.",
+            "metrics", metricKeys.join(","));
+    QCommandLineOption outputOption(QStringList() << "o" << "output",
+            "The results file to write. Defaults to the .xtc file path with "
+            "a .mdvis or .csv extension.", "file");
+    QCommandLineOption formatOption(QStringList() << "f" << "format",
+            "The output format, binary or csv.", "format", "binary");
+    QCommandLineOption threadsOption(QStringList() << "t" << "threads",
+            "The number of threads to use. Defaults to all cores.", "count");
+    QCommandLineOption verboseOption(QStringList() << "v" << "verbose",
+            "Print progress messages while working.");
+    QCommandLineOption startOption(QStringList() << "start",
+            "Skip frames before this time.", "ps");
+    QCommandLineOption endOption(QStringList() << "end",
+            "Skip frames after this time.", "ps");
+    QCommandLineOption strideOption(QStringList() << "stride",
+            "Load only every n-th frame between the start and end times.",
+            "n", "1");
+    QCommandLineOption selectOption(QStringList() << "s" << "select",
+            "Load only atoms chosen by a selection expression, such as "
+            "\"resname LIG or (name CA and resid 10-200)\".", "expression");
+    QCommandLineOption residuesOption(QStringList() << "residues",
+            "Load only atoms in these residues, separated by commas. Names "
+            "starting with ! are excluded instead.", "names");
+    QCommandLineOption atomNamesOption(QStringList() << "atom-names",
+            "Load only atoms with these names, separated by commas. Names "
+            "starting with ! are excluded instead.", "names");
+    QCommandLineOption atomNumbersOption(QStringList() << "atom-numbers",
+            "Load only atoms with these numbers, counting .gro lines from 1, "
+            "such as 1-100,250. Ranges starting with ! are excluded instead.",
+            "ranges");
+    QCommandLineOption budgetOption(QStringList() << "memory-budget",
+            "Skip frames when loading so that the trajectory fits within this "
+            "much memory.", "MB");
+    QCommandLineOption traceOption(QStringList() << "trace",
+            "Write a Chrome trace of the run to this file.", "file");
+    QCommandLineOption msdOption(QStringList() << "msd",
+            "Write the mean square displacement of the atoms chosen by "
+            "--msd-select to this file, as CSV.", "file");
+    QCommandLineOption msdSelectOption(QStringList() << "msd-select",
+            "The selection of the mean square displacement, such as "
+            "\"resname SOL\". Defaults to every atom.", "expression");
+    QCommandLineOption fitSelectOption(QStringList() << "fit-select",
+            "The atoms fitted onto the reference frame before the RMSD and "
+            "RMSF are measured, such as \"name CA\". Defaults to every "
+            "atom.", "expression");
+    QCommandLineOption fitReferenceOption(QStringList() << "fit-reference",
+            "The loaded frame the atoms are fitted onto.", "frame", "0");
+    QCommandLineOption rmsdOption(QStringList() << "rmsd",
+            "Write the RMSD of each frame from the fit reference frame to "
+            "this file, as CSV.", "file");
+    QCommandLineOption rdfOption(QStringList() << "rdf",
+            "Write the radial distribution function between the selections "
+            "of --rdf-select to this file, as CSV.", "file");
+    QCommandLineOption rdfSelectOption(QStringList() << "rdf-select",
+            "The selections of the radial distribution function, such as "
+            "\"name OW;name OW\". Empty selections choose every atom.",
+            "expressions", ";");
+    QCommandLineOption rdfCutoffOption(QStringList() << "rdf-cutoff",
+            "The largest distance of the radial distribution function.",
+            "nm", "1");
+    QCommandLineOption rdfBinsOption(QStringList() << "rdf-bins",
+            "The number of bins of the radial distribution function.",
+            "count", QString::number(RadialDistribution::DEFAULT_BINS));
+    QCommandLineOption rdfStrideOption(QStringList() << "rdf-stride",
+            "Count only every n-th loaded frame in the radial distribution "
+            "function.", "n", "1");
+    QCommandLineOption pcaOption(QStringList() << "pca",
+            "Write the variance of the principal components of the fitted "
+            "motion of the atoms chosen by --pca-select, and the projection "
+            "of each frame onto them, to this file, as CSV.", "file");
+    QCommandLineOption pcaSelectOption(QStringList() << "pca-select",
+            "The selection of the principal component analysis, such as "
+            "\"name CA\". Defaults to every atom.", "expression");
+    QCommandLineOption pcaComponentsOption(QStringList() << "pca-components",
+            "The number of principal components found.", "count",
+            QString::number(PrincipalComponents::DEFAULT_COMPONENTS));
+    parser.addOption(metricsOption);
+    parser.addOption(outputOption);
+    parser.addOption(formatOption);
+    parser.addOption(threadsOption);
+    parser.addOption(verboseOption);
+    parser.addOption(startOption);
+    parser.addOption(endOption);
+    parser.addOption(strideOption);
+    parser.addOption(selectOption);
+    parser.addOption(residuesOption);
+    parser.addOption(atomNamesOption);
+    parser.addOption(atomNumbersOption);
+    parser.addOption(budgetOption);
+    parser.addOption(traceOption);
+    parser.addOption(msdOption);
+    parser.addOption(msdSelectOption);
+    parser.addOption(fitSelectOption);
+    parser.addOption(fitReferenceOption);
+    parser.addOption(rmsdOption);
+    parser.addOption(rdfOption);
+    parser.addOption(rdfSelectOption);
+    parser.addOption(rdfCutoffOption);
+    parser.addOption(rdfBinsOption);
+    parser.addOption(rdfStrideOption);
+    parser.addOption(pcaOption);
+    parser.addOption(pcaSelectOption);
+    parser.addOption(pcaComponentsOption);
+    parser.process(app);
+
+    QStringList files = parser.positionalArguments();
+    if (files.length() != 2)
+    {
+        err << "Expected a .gro file and an .xtc file." << endl;
+        parser.showHelp(1);
+    }
+
+    QString format = parser.value(formatOption).toLower();
+    if (format != "binary" && format != "csv")
+    {
+        err << "Unknown format " << format << "." << endl;
+        return 1;
+    }
+
+    if (parser.isSet(threadsOption))
+    {
+        bool ok;
+        int threads = parser.value(threadsOption).toInt(&ok);
+        if (!ok || threads < 1)
+        {
+            err << "The number of threads must be a positive integer." << endl;
+            return 1;
+        }
+        QThreadPool::globalInstance()->setMaxThreadCount(threads);
+    }
+
+    QVector<const MetricOption*> metrics;
+    QStringList requested = parser.value(metricsOption).split(
+                ",", QString::SkipEmptyParts);
+    for (int i = 0; i < requested.length(); ++i)
+    {
+        QString key = requested[i].trimmed().toLower();
+        int index = metricKeys.indexOf(key);
+        if (index < 0)
+        {
+            err << "Unknown metric " << key << "." << endl;
+            return 1;
+        }
+        if (!metrics.contains(&METRIC_OPTIONS[index]))
+        {
+            metrics.append(&METRIC_OPTIONS[index]);
+        }
+    }
+
+    QString outputPath = parser.value(outputOption);
+    if (outputPath.isEmpty())
+    {
+        QFileInfo xtcInfo(files[1]);
+        outputPath = xtcInfo.path() + "/" + xtcInfo.completeBaseName()
+                + (format == "csv" ? ".csv" : ".mdvis");
+    }
+
+    FileReader reader;
+    bool ok;
+    float startTime = parser.isSet(startOption)
+            ? parser.value(startOption).toFloat(&ok) : reader.GetStartTime();
+    if (parser.isSet(startOption) && !ok)
+    {
+        err << "The start time must be a number of ps." << endl;
+        return 1;
+    }
+    float endTime = parser.isSet(endOption)
+            ? parser.value(endOption).toFloat(&ok) : reader.GetEndTime();
+    if (parser.isSet(endOption) && !ok)
+    {
+        err << "The end time must be a number of ps." << endl;
+        return 1;
+    }
+    int stride = parser.value(strideOption).toInt(&ok);
+    if (!ok || stride < 1)
+    {
+        err << "The stride must be a positive integer." << endl;
+        return 1;
+    }
+    reader.SetTimeWindow(startTime, endTime);
+    reader.SetFrameStride(stride);
+
+    AtomSelection selection;
+    if (!selection.SetExpression(parser.value(selectOption)))
+    {
+        err << "Invalid selection: " << selection.GetError() << endl;
+        return 1;
+    }
+    if (!selection.SetResidueNames(parser.value(residuesOption)))
+    {
+        err << "Invalid residue names: " << selection.GetError() << endl;
+        return 1;
+    }
+    if (!selection.SetAtomNames(parser.value(atomNamesOption)))
+    {
+        err << "Invalid atom names: " << selection.GetError() << endl;
+        return 1;
+    }
+    if (!selection.SetAtomNumbers(parser.value(atomNumbersOption)))
+    {
+        err << "The atom numbers must be numbers or ranges such as 1-100."
+            << endl;
+        return 1;
+    }
+    reader.SetAtomSelection(selection);
+
+    qint64 budgetMB = 0;
+    if (parser.isSet(budgetOption))
+    {
+        budgetMB = parser.value(budgetOption).toLongLong(&ok);
+        if (!ok || budgetMB < 1)
+        {
+            err << "The memory budget must be a positive number of MB." << endl;
+            return 1;
+        }
+        MemoryBudget budget(budgetMB*1024*1024);
+        budget.SetSelection(startTime, endTime, stride);
+        if (budget.Estimate(files[1]))
+        {
+            int budgetStride = budget.ChooseStride();
+            if (budgetStride == 0)
+            {
+                err << "The trajectory cannot fit within the memory budget."
+                    << endl;
+                return 1;
+            }
+            reader.SetFrameStride(budgetStride);
+        }
+    }
+
+    SelectionExpression msdSelection;
+    bool calculateMsd = parser.isSet(msdOption);
+    if (!msdSelection.Compile(parser.value(msdSelectOption)))
+    {
+        err << "Invalid MSD selection: " << msdSelection.GetError() << endl;
+        return 1;
+    }
+
+    SelectionExpression fitSelection;
+    if (!fitSelection.Compile(parser.value(fitSelectOption)))
+    {
+        err << "Invalid fit selection: " << fitSelection.GetError() << endl;
+        return 1;
+    }
+    int fitReference = parser.value(fitReferenceOption).toInt(&ok);
+    if (!ok || fitReference < 0)
+    {
+        err << "The fit reference must be a frame number." << endl;
+        return 1;
+    }
+    bool calculateRmsd = parser.isSet(rmsdOption);
+
+    RadialDistribution rdf;
+    SelectionExpression rdfSelections[2];
+    bool calculateRdf = parser.isSet(rdfOption);
+    if (calculateRdf)
+    {
+        QStringList expressions = parser.value(rdfSelectOption).split(";");
+        if (expressions.length() != 2)
+        {
+            err << "The RDF selections must be two expressions separated by "
+                << "a semicolon." << endl;
+            return 1;
+        }
+        for (int i = 0; i < 2; ++i)
+        {
+            if (!rdfSelections[i].Compile(expressions[i]))
+            {
+                err << "Invalid RDF selection: " << rdfSelections[i].GetError()
+                    << endl;
+                return 1;
+            }
+        }
+        float cutoff = parser.value(rdfCutoffOption).toFloat(&ok);
+        if (!ok || cutoff <= 0)
+        {
+            err << "The RDF cutoff must be a positive number of nm." << endl;
+            return 1;
+        }
+        int bins = parser.value(rdfBinsOption).toInt(&ok);
+        if (!ok || bins < 1)
+        {
+            err << "The number of RDF bins must be a positive integer." << endl;
+            return 1;
+        }
+        int rdfStride = parser.value(rdfStrideOption).toInt(&ok);
+        if (!ok || rdfStride < 1)
+        {
+            err << "The RDF stride must be a positive integer." << endl;
+            return 1;
+        }
+        rdf.SetCutoff(cutoff);
+        rdf.SetBins(bins);
+        rdf.SetFrameStride(rdfStride);
+    }
+
+    PrincipalComponents pca;
+    SelectionExpression pcaSelection;
+    bool calculatePca = parser.isSet(pcaOption);
+    if (calculatePca)
+    {
+        if (!pcaSelection.Compile(parser.value(pcaSelectOption)))
+        {
+            err << "Invalid PCA selection: " << pcaSelection.GetError() << endl;
+            return 1;
+        }
+        int components = parser.value(pcaComponentsOption).toInt(&ok);
+        if (!ok || components < 1)
+        {
+            err << "The number of principal components must be a positive "
+                << "integer." << endl;
+            return 1;
+        }
+        pca.SetComponents(components);
+        pca.SetMemoryBudget(budgetMB*1024*1024);
+    }
+
+    bool verbose = parser.isSet(verboseOption);
+    QObject::connect(&reader, &FileReader::consoleOutput,
+                     [&err, verbose](QString output, int)
+    {
+        if (verbose)
+        {
+            err << output << endl;
+        }
+    });
+
+    QElapsedTimer total;
+    QElapsedTimer timer;
+    total.start();
+    timer.start();
+    if (!reader.LoadData(files[0], files[1]))
+    {
+        err << "Failed to load " << files[0] << " and " << files[1]
+            << "." << endl;
+        return 1;
+    }
+    qint64 loadTime = timer.nsecsElapsed();
+    if (!fitSelection.IsEmpty()
+            && fitSelection.Evaluate(AtomTable::FromAtoms(reader.GetAtomVectorRef())).Count() == 0)
+    {
+        err << "The fit selection chose no atoms." << endl;
+        return 1;
+    }
+    reader.SetFit(fitSelection, fitReference);
+
+    ResultsFile results(format == "csv" ? ResultsFile::CSV
+                                        : ResultsFile::BINARY);
+    QVector<qint64> metricTimes;
+    for (int i = 0; i < metrics.length(); ++i)
+    {
+        timer.restart();
+        (reader.*metrics[i]->calculate)();
+        metricTimes.append(timer.nsecsElapsed());
+
+        ResultsFile::Metric metric;
+        metric.name = metrics[i]->name;
+        metric.values = metrics[i]->values;
+        metric.min = (reader.*metrics[i]->min)();
+        metric.max = (reader.*metrics[i]->max)();
+        results.AddMetric(metric);
+    }
+
+    timer.restart();
+    if (!results.Write(outputPath, reader.GetAtomVectorRef()))
+    {
+        err << results.GetError() << endl;
+        return 1;
+    }
+    qint64 writeTime = timer.nsecsElapsed();
+
+    qint64 msdTime = 0;
+    int msdAtoms = 0;
+    if (calculateMsd)
+    {
+        timer.restart();
+        reader.CalculateDiffusion();
+        const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+        Bitset selected = msdSelection.Evaluate(AtomTable::FromAtoms(atoms));
+        msdAtoms = selected.Count();
+        QVector<float> msd = MeanSquareDisplacement::Average(atoms, selected);
+        msdTime = timer.nsecsElapsed();
+        if (msdAtoms == 0)
+        {
+            err << "The MSD selection chose no atoms." << endl;
+            return 1;
+        }
+        if (!writeMsd(parser.value(msdOption), msd, atoms[0]->GetStepTimeRef()))
+        {
+            err << "Could not write " << parser.value(msdOption) << endl;
+            return 1;
+        }
+    }
+
+    qint64 rmsdTime = 0;
+    if (calculateRmsd)
+    {
+        timer.restart();
+        reader.CalculateFluctuation();
+        rmsdTime = timer.nsecsElapsed();
+        if (!writeRmsd(parser.value(rmsdOption), reader.GetFitsRef(),
+                       reader.GetAtomVectorRef()[0]->GetStepTimeRef()))
+        {
+            err << "Could not write " << parser.value(rmsdOption) << endl;
+            return 1;
+        }
+    }
+
+    qint64 rdfTime = 0;
+    if (calculateRdf)
+    {
+        timer.restart();
+        AtomTable table = AtomTable::FromAtoms(reader.GetAtomVectorRef());
+        if (!rdf.Calculate(reader.GetAtomVectorRef(),
+                           rdfSelections[0].Evaluate(table),
+                           rdfSelections[1].Evaluate(table),
+                           reader.GetSimBoxRef()))
+        {
+            err << rdf.GetError() << endl;
+            return 1;
+        }
+        rdfTime = timer.nsecsElapsed();
+        if (!rdf.WriteCsv(parser.value(rdfOption)))
+        {
+            err << rdf.GetError() << endl;
+            return 1;
+        }
+    }
+
+    qint64 pcaTime = 0;
+    if (calculatePca)
+    {
+        timer.restart();
+        const QVector<Atom*>& atoms = reader.GetAtomVectorRef();
+        reader.FitFrames();
+        if (!pca.Calculate(atoms, pcaSelection.Evaluate(AtomTable::FromAtoms(atoms)),
+                           reader.GetFitsRef()))
+        {
+            err << pca.GetError() << endl;
+            return 1;
+        }
+        pcaTime = timer.nsecsElapsed();
+        if (!pca.WriteCsv(parser.value(pcaOption)))
+        {
+            err << pca.GetError() << endl;
+            return 1;
+        }
+    }
+
+    int atoms = reader.GetAtomVectorRef().length();
+    int frames = atoms > 0
+            ? reader.GetAtomVectorRef()[0]->GetTrajectoryRef().length() : 0;
+    out << atoms << " atoms, " << frames << " frames, "
+        << QThreadPool::globalInstance()->maxThreadCount() << " threads";
+    if (reader.GetFrameStride() > 1)
+    {
+        out << ", every " << reader.GetFrameStride() << " frames loaded";
+    }
+    out << endl << endl;
+
+    for (int i = 0; i < MemoryAccount::SUBSYSTEM_COUNT; ++i)
+    {
+        MemoryAccount::Subsystem subsystem = (MemoryAccount::Subsystem)i;
+        if (subsystem == MemoryAccount::GPU)
+        {
+            continue;
+        }
+        out << qSetFieldWidth(28) << left << MemoryAccount::GetName(subsystem)
+            << qSetFieldWidth(0)
+            << MemoryAccount::ToMegabytes(MemoryAccount::Get(subsystem)) << endl;
+    }
+    out << endl;
+
+    for (int i = 0; i < metrics.length(); ++i)
+    {
+        out << qSetFieldWidth(28) << left << metrics[i]->name
+            << qSetFieldWidth(0) << (reader.*metrics[i]->min)()
+            << " to " << (reader.*metrics[i]->max)() << endl;
+    }
+    out << endl;
+
+    printTiming(out, "load", loadTime);
+    for (int i = 0; i < metrics.length(); ++i)
+    {
+        printTiming(out, QString("calculate ") + metrics[i]->name,
+                    metricTimes[i]);
+    }
+    printTiming(out, "write", writeTime);
+    if (calculateMsd)
+    {
+        printTiming(out, "calculate msd", msdTime);
+    }
+    if (calculateRmsd)
+    {
+        printTiming(out, "calculate rmsd", rmsdTime);
+    }
+    if (calculateRdf)
+    {
+        printTiming(out, "calculate rdf", rdfTime);
+    }
+    if (calculatePca)
+    {
+        printTiming(out, "calculate pca", pcaTime);
+    }
+    printTiming(out, "total", total.nsecsElapsed());
+    out << endl;
+    printLoadStages(out, reader.GetLoadStages());
+    out << endl << "Results written to " << outputPath << endl;
+    if (calculateMsd)
+    {
+        out << "MSD of " << msdAtoms << " atoms written to "
+            << parser.value(msdOption) << endl;
+    }
+    if (calculateRmsd)
+    {
+        out << "RMSD of " << reader.GetFitsRef().length()
+            << " frames written to " << parser.value(rmsdOption) << endl;
+    }
+    if (calculateRdf)
+    {
+        out << "RDF of " << rdf.GetFrames() << " frames written to "
+            << parser.value(rdfOption) << endl;
+    }
+    if (calculatePca)
+    {
+        out << pca.GetComponents() << " principal components of "
+            << pca.GetProjection(0).length() << " frames written to "
+            << parser.value(pcaOption) << " after " << pca.GetIterations()
+            << " iterations";
+        if (pca.IsMatrixFree())
+        {
+            out << ", without forming the covariance";
+        }
+        out << endl;
+    }
+
+    if (parser.isSet(traceOption))
+    {
+        if (!Trace::WriteChromeJson(parser.value(traceOption)))
+        {
+            err << "Could not write " << parser.value(traceOption) << endl;
+            return 1;
+        }
+        out << "Trace written to " << parser.value(traceOption) << endl;
+    }
+
+    return 0;
+}
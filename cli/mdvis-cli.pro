@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Headless command line tool for MDVis. Loads a trajectory, calculates the
+# requested metrics using every core and writes them to disk, without
+# creating any windows or OpenGL context.
+#
+#-------------------------------------------------
+
+QT       += core gui concurrent
+QT       -= widgets
+
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TARGET = mdvis-cli
+TEMPLATE = app
+
+include(../MDVisCore.pri)
+
+SOURCES += main.cpp
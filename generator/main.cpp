@@ -0,0 +1,143 @@
+#include "TrajectoryGenerator.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTextStream>
+
+namespace
+{
+    /**
+     * @brief Reads a numeric option, reporting an error if it is invalid.
+     * @param parser The parser holding the option values.
+     * @param option The option to be read.
+     * @param value Set to the value of the option, if it was given.
+     * @return false if the option was given but is not a number.
+     */
+    template <typename T>
+    bool readNumber(const QCommandLineParser& parser,
+                    const QCommandLineOption& option,
+                    T& value)
+    {
+        if (!parser.isSet(option))
+        {
+            return true;
+        }
+        bool ok;
+        double number = parser.value(option).toDouble(&ok);
+        if (!ok)
+        {
+            QTextStream(stderr) << "Invalid value for --" << option.names().last()
+                                << ": " << parser.value(option) << endl;
+            return false;
+        }
+        value = (T)number;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("mdvis-generate");
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    TrajectoryGenerator::Settings settings;
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Writes a synthetic .gro and .xtc "
+                                     "trajectory for testing MDVis.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("gro", "The .gro file to be written.");
+    parser.addPositionalArgument("xtc", "The .xtc file to be written.");
+    QCommandLineOption atomsOption(QStringList() << "a" << "atoms",
+            "The number of atoms.", "count", QString::number(settings.atoms));
+    QCommandLineOption framesOption(QStringList() << "f" << "frames",
+            "The number of frames.", "count", QString::number(settings.frames));
+    QCommandLineOption residueSizeOption(QStringList() << "residue-size",
+            "The number of atoms in each residue.", "count",
+            QString::number(settings.atomsPerResidue));
+    QCommandLineOption boxOption(QStringList() << "b" << "box",
+            "The side length of the cubic box, in nm.", "nm",
+            QString::number(settings.boxLength));
+    QCommandLineOption diffusionOption(QStringList() << "d" << "diffusion",
+            "The standard deviation of each residue step per frame, in nm.",
+            "nm", QString::number(settings.diffusion));
+    QCommandLineOption driftOption(QStringList() << "drift",
+            "The drift of every residue per frame, as x,y,z in nm.", "x,y,z",
+            "0,0,0");
+    QCommandLineOption timeStepOption(QStringList() << "time-step",
+            "The time between frames, in ps.", "ps",
+            QString::number(settings.timeStep));
+    QCommandLineOption seedOption(QStringList() << "s" << "seed",
+            "The seed for the random numbers.", "seed",
+            QString::number(settings.seed));
+    QCommandLineOption noWrapOption(QStringList() << "no-wrap",
+            "Do not wrap positions into the periodic box.");
+    QCommandLineOption residueNamesOption(QStringList() << "residue-names",
+            "Comma separated residue names, assigned in turn.", "names",
+            settings.residueNames.join(","));
+    QCommandLineOption atomNamesOption(QStringList() << "atom-names",
+            "Comma separated atom names, assigned in turn within each "
+            "residue.", "names", settings.atomNames.join(","));
+    parser.addOption(atomsOption);
+    parser.addOption(framesOption);
+    parser.addOption(residueSizeOption);
+    parser.addOption(boxOption);
+    parser.addOption(diffusionOption);
+    parser.addOption(driftOption);
+    parser.addOption(timeStepOption);
+    parser.addOption(seedOption);
+    parser.addOption(noWrapOption);
+    parser.addOption(residueNamesOption);
+    parser.addOption(atomNamesOption);
+    parser.process(app);
+
+    QStringList files = parser.positionalArguments();
+    if (files.length() != 2)
+    {
+        err << "Expected a .gro file and an .xtc file." << endl;
+        parser.showHelp(1);
+    }
+
+    if (!readNumber(parser, atomsOption, settings.atoms)
+            || !readNumber(parser, framesOption, settings.frames)
+            || !readNumber(parser, residueSizeOption, settings.atomsPerResidue)
+            || !readNumber(parser, boxOption, settings.boxLength)
+            || !readNumber(parser, diffusionOption, settings.diffusion)
+            || !readNumber(parser, timeStepOption, settings.timeStep)
+            || !readNumber(parser, seedOption, settings.seed))
+    {
+        return 1;
+    }
+
+    QStringList drift = parser.value(driftOption).split(",");
+    if (drift.length() != 3)
+    {
+        err << "--drift takes three comma separated values." << endl;
+        return 1;
+    }
+    settings.drift = QVector3D(drift[0].toFloat(), drift[1].toFloat(),
+                               drift[2].toFloat());
+    settings.wrap = !parser.isSet(noWrapOption);
+    settings.residueNames = parser.value(residueNamesOption).split(
+                ",", QString::SkipEmptyParts);
+    settings.atomNames = parser.value(atomNamesOption).split(
+                ",", QString::SkipEmptyParts);
+
+    QElapsedTimer timer;
+    timer.start();
+    TrajectoryGenerator generator(settings);
+    if (!generator.Write(files[0], files[1]))
+    {
+        err << generator.GetError() << endl;
+        return 1;
+    }
+
+    out << "Wrote " << settings.atoms << " atoms and " << settings.frames
+        << " frames in " << timer.elapsed() << " ms" << endl;
+    out << files[0] << ": " << QFileInfo(files[0]).size() << " bytes" << endl;
+    out << files[1] << ": " << QFileInfo(files[1]).size() << " bytes" << endl;
+    return 0;
+}
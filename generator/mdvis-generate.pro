@@ -0,0 +1,19 @@
+#-------------------------------------------------
+#
+# Command line tool which writes synthetic .gro and .xtc file pairs of any
+# size, for testing and benchmarking MDVis without real simulation data.
+#
+#-------------------------------------------------
+
+QT       += core gui concurrent
+QT       -= widgets
+
+CONFIG   += console c++11
+CONFIG   -= app_bundle
+
+TARGET = mdvis-generate
+TEMPLATE = app
+
+include(../MDVisCore.pri)
+
+SOURCES += main.cpp
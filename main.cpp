@@ -1,9 +1,11 @@
 #include "MainWindow.h"
 #include <QApplication>
+#include <QThread>
 
 int main(int argc, char* argv[])
 {
     QApplication a(argc, argv);
+    QThread::currentThread()->setObjectName("Main");
     MainWindow w;
     w.show();
 
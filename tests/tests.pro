@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Unit tests for the non-GUI core of MDVis. Generates small .gro and .xtc
+# file pairs in a temporary directory, so no simulation data is needed. Run
+# with make check.
+#
+#-------------------------------------------------
+
+QT       += core gui concurrent testlib
+QT       -= widgets
+
+CONFIG   += console c++11 testcase
+CONFIG   -= app_bundle
+
+TARGET = tst_FileReader
+TEMPLATE = app
+
+include(../MDVisCore.pri)
+
+SOURCES += tst_FileReader.cpp
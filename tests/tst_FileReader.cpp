@@ -0,0 +1,218 @@
+#include "FileReader.h"
+#include "ResultsFile.h"
+#include "TrajectoryGenerator.h"
+#include <QTemporaryDir>
+#include <QtTest>
+#include <limits>
+
+class TestFileReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    /**
+     * @brief Writes the trajectories loaded by the tests.
+     */
+    void initTestCase();
+
+    /**
+     * @brief Checks that a load with too few frames in the time window keeps
+     * the data already loaded.
+     */
+    void rejectedFramesKeepData();
+
+    /**
+     * @brief Checks that a .gro and .xtc file pair with different numbers of
+     * atoms keeps the data already loaded.
+     */
+    void mismatchedFilesKeepData();
+
+    /**
+     * @brief Checks that an atom selection which chooses no atoms keeps the
+     * data already loaded.
+     */
+    void rejectedSelectionKeepsData();
+
+    /**
+     * @brief Checks that a rejected load leaves a new reader empty and able
+     * to load again.
+     */
+    void rejectedLoadLeavesReaderEmpty();
+
+    /**
+     * @brief Checks that metrics written to a binary results file are read
+     * back into the atoms with their ranges.
+     */
+    void resultsRoundTrip();
+
+    /**
+     * @brief Checks that a results file written for other data is rejected
+     * without changing the atoms.
+     */
+    void resultsForOtherDataRejected();
+
+private:
+    /**
+     * @brief Writes a trajectory into the temporary directory.
+     * @param name The name of the files, without an extension.
+     * @param atoms The number of atoms.
+     * @return true if the files were written, false otherwise.
+     */
+    bool writeTrajectory(const QString& name, int atoms);
+
+    /**
+     * @brief Returns the path of a file in the temporary directory.
+     * @param name The name of the file.
+     * @return The path.
+     */
+    QString path(const QString& name) const;
+
+    /**
+     * @brief Holds the generated files until the tests finish.
+     */
+    QTemporaryDir m_Dir;
+
+    /**
+     * @brief The number of atoms in the main trajectory.
+     */
+    const int ATOMS = 30;
+
+    /**
+     * @brief The number of frames in every trajectory.
+     */
+    const int FRAMES = 10;
+};
+
+bool TestFileReader::writeTrajectory(const QString& name, int atoms)
+{
+    TrajectoryGenerator::Settings settings;
+    settings.atoms = atoms;
+    settings.frames = FRAMES;
+    TrajectoryGenerator generator(settings);
+    return generator.Write(path(name + ".gro"), path(name + ".xtc"));
+}
+
+QString TestFileReader::path(const QString& name) const
+{
+    return m_Dir.path() + "/" + name;
+}
+
+void TestFileReader::initTestCase()
+{
+    QVERIFY(m_Dir.isValid());
+    QVERIFY(writeTrajectory("main", ATOMS));
+    QVERIFY(writeTrajectory("other", ATOMS + 3));
+}
+
+void TestFileReader::rejectedFramesKeepData()
+{
+    FileReader reader;
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QVector<Atom*> atoms = reader.GetAtomVectorRef();
+    QVector<Residue*> residues = reader.GetResidueVectorRef();
+
+    reader.SetTimeWindow(1e9f, std::numeric_limits<float>::infinity());
+    QVERIFY(!reader.LoadData(path("main.gro"), path("main.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef(), atoms);
+    QCOMPARE(reader.GetResidueVectorRef(), residues);
+    QCOMPARE(atoms[0]->GetTrajectoryRef().length(), FRAMES);
+
+    reader.SetTimeWindow(0, std::numeric_limits<float>::infinity());
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef().length(), ATOMS);
+}
+
+void TestFileReader::mismatchedFilesKeepData()
+{
+    FileReader reader;
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QVector<Atom*> atoms = reader.GetAtomVectorRef();
+
+    QVERIFY(!reader.LoadData(path("main.gro"), path("other.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef(), atoms);
+    QCOMPARE(atoms[0]->GetTrajectoryRef().length(), FRAMES);
+}
+
+void TestFileReader::rejectedSelectionKeepsData()
+{
+    FileReader reader;
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QVector<Atom*> atoms = reader.GetAtomVectorRef();
+    QVector<Residue*> residues = reader.GetResidueVectorRef();
+
+    AtomSelection selection;
+    selection.SetResidueNames("XYZ");
+    reader.SetAtomSelection(selection);
+    QVERIFY(!reader.LoadData(path("main.gro"), path("main.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef(), atoms);
+    QCOMPARE(reader.GetResidueVectorRef(), residues);
+    QCOMPARE(atoms[0]->GetTrajectoryRef().length(), FRAMES);
+
+    reader.SetAtomSelection(AtomSelection());
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef().length(), ATOMS);
+}
+
+void TestFileReader::rejectedLoadLeavesReaderEmpty()
+{
+    FileReader reader;
+    QVERIFY(!reader.LoadData(path("main.gro"), path("missing.xtc")));
+    QVERIFY(reader.GetAtomVectorRef().isEmpty());
+    QVERIFY(reader.GetResidueVectorRef().isEmpty());
+
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QCOMPARE(reader.GetAtomVectorRef().length(), ATOMS);
+    QCOMPARE(reader.GetAtomVectorRef()[0]->GetTrajectoryRef().length(), FRAMES);
+    QVERIFY(!reader.GetResidueVectorRef().isEmpty());
+}
+
+void TestFileReader::resultsRoundTrip()
+{
+    FileReader written;
+    QVERIFY(written.LoadData(path("main.gro"), path("main.xtc")));
+    written.CalculateVelocity();
+    ResultsFile results(ResultsFile::BINARY);
+    ResultsFile::Metric metric;
+    metric.name = "velocity";
+    metric.values = &Atom::GetVelocityRef;
+    metric.min = written.GetMinVelocity();
+    metric.max = written.GetMaxVelocity();
+    results.AddMetric(metric);
+    QVERIFY(results.Write(path("main.mdvis"), written.GetAtomVectorRef()));
+
+    FileReader reader;
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QVERIFY(reader.LoadResults(path("main.mdvis")));
+    QCOMPARE(reader.GetMinVelocity(), written.GetMinVelocity());
+    QCOMPARE(reader.GetMaxVelocity(), written.GetMaxVelocity());
+    for (int i = 0; i < ATOMS; ++i)
+    {
+        QCOMPARE(reader.GetAtomVectorRef()[i]->GetVelocityRef(),
+                 written.GetAtomVectorRef()[i]->GetVelocityRef());
+    }
+    QVERIFY(!reader.GetResidueVectorRef()[0]->GetCentroidRef()
+            .GetVelocityRef().isEmpty());
+}
+
+void TestFileReader::resultsForOtherDataRejected()
+{
+    FileReader written;
+    QVERIFY(written.LoadData(path("other.gro"), path("other.xtc")));
+    written.CalculateVelocity();
+    ResultsFile results(ResultsFile::BINARY);
+    ResultsFile::Metric metric;
+    metric.name = "velocity";
+    metric.values = &Atom::GetVelocityRef;
+    metric.min = written.GetMinVelocity();
+    metric.max = written.GetMaxVelocity();
+    results.AddMetric(metric);
+    QVERIFY(results.Write(path("other.mdvis"), written.GetAtomVectorRef()));
+
+    FileReader reader;
+    QVERIFY(reader.LoadData(path("main.gro"), path("main.xtc")));
+    QVERIFY(!reader.LoadResults(path("other.mdvis")));
+    QVERIFY(reader.GetAtomVectorRef()[0]->GetVelocityRef().isEmpty());
+}
+
+QTEST_GUILESS_MAIN(TestFileReader)
+#include "tst_FileReader.moc"
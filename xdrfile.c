@@ -145,6 +145,7 @@ static int  xdr_double      (XDR *xdrs, double *ip);
 static int  xdr_string      (XDR *xdrs, char **ip, unsigned int maxsize);
 static int  xdr_opaque      (XDR *xdrs, char *cp, unsigned int cnt);
 static void xdrstdio_create (XDR *xdrs, FILE *fp, enum xdr_op xop);
+static void xdrmem_create   (XDR *xdrs, char *addr, unsigned int size, enum xdr_op xop);
 
 #define xdr_getpos(xdrs)                                \
         (*(xdrs)->x_ops->x_getpostn)(xdrs)
@@ -237,6 +238,26 @@ xdrfile_open(const char *path, const char *mode)
 	return xfp;
 }
 
+XDRFILE *
+xdrfile_open_memory(const char *data, unsigned int size)
+{
+	XDRFILE *xfp;
+
+	if((xfp=(XDRFILE *)malloc(sizeof(XDRFILE)))==NULL)
+		return NULL;
+	if((xfp->xdr=(XDR *)malloc(sizeof(XDR)))==NULL)
+    {
+		free(xfp);
+		return NULL;
+	}
+	xfp->fp=NULL;
+	xfp->mode='r';
+	xdrmem_create((XDR *)(xfp->xdr),(char *)data,size,XDR_DECODE);
+	xfp->buf1 = xfp->buf2 = NULL;
+	xfp->buf1size = xfp->buf2size = 0;
+	return xfp;
+}
+
 int 
 xdrfile_close(XDRFILE *xfp)
 {
@@ -248,8 +269,8 @@ xdrfile_close(XDRFILE *xfp)
 		if(xfp->xdr)
 			xdr_destroy((XDR *)(xfp->xdr));
 		free(xfp->xdr);
-		/* close the file */
-		ret=fclose(xfp->fp);
+		/* close the file, if the handle is not reading from memory */
+		ret = xfp->fp ? fclose(xfp->fp) : exdrOK;
 		if(xfp->buf1size)
 			free(xfp->buf1);
 		if(xfp->buf2size)
@@ -2617,4 +2638,130 @@ xdrstdio_setpos (XDR *xdrs, unsigned int pos)
 
 
 
+/*
+ * Memory type XDR, used to decode data that has already been read into a
+ * buffer. Only decoding is supported.
+ */
+struct xdrmem_buffer
+{
+	char *       base;     /**< start of the buffer                       */
+	unsigned int size;     /**< size of the buffer in bytes               */
+	unsigned int pos;      /**< offset of the next byte to be read        */
+};
+
+static int xdrmem_getlong (XDR *, int32_t *);
+static int xdrmem_putlong (XDR *, int32_t *);
+static int xdrmem_getbytes (XDR *, char *, unsigned int);
+static int xdrmem_putbytes (XDR *, char *, unsigned int);
+static unsigned int xdrmem_getpos (XDR *);
+static int xdrmem_setpos (XDR *, unsigned int);
+static void xdrmem_destroy (XDR *);
+
+/*
+ * Ops vector for memory type XDR
+ */
+static const struct xdr_ops xdrmem_ops =
+	{
+		xdrmem_getlong,			/* deserialize a long int */
+		xdrmem_putlong,			/* serialize a long int */
+		xdrmem_getbytes,		/* deserialize counted bytes */
+		xdrmem_putbytes,		/* serialize counted bytes */
+		xdrmem_getpos,			/* get offset in the stream */
+		xdrmem_setpos,			/* set offset in the stream */
+		xdrmem_destroy,			/* destroy stream */
+	};
+
+/*
+ * Initialize a memory xdr stream.
+ * Sets the xdr stream handle xdrs for reading size bytes from addr.
+ * Operation flag is set to op.
+ */
+static void
+xdrmem_create (XDR *xdrs, char *addr, unsigned int size, enum xdr_op op)
+{
+	struct xdrmem_buffer *buffer;
+
+	xdrs->x_op = op;
+	xdrs->x_ops = (struct xdr_ops *) &xdrmem_ops;
+	buffer = (struct xdrmem_buffer *) malloc (sizeof (struct xdrmem_buffer));
+	if (buffer)
+	{
+		buffer->base = addr;
+		buffer->size = size;
+		buffer->pos = 0;
+	}
+	xdrs->x_private = (char *) buffer;
+}
+
+/*
+ * Destroy a memory xdr stream.
+ * Frees the position state, but not the buffer itself.
+ */
+static void
+xdrmem_destroy (XDR *xdrs)
+{
+	free (xdrs->x_private);
+	xdrs->x_private = NULL;
+}
+
+static int
+xdrmem_getlong (XDR *xdrs, int32_t *lp)
+{
+	int32_t mycopy;
+
+	if (!xdrmem_getbytes (xdrs, (char *) & mycopy, 4))
+		return 0;
+	*lp = (int32_t) xdr_ntohl (mycopy);
+	return 1;
+}
+
+static int
+xdrmem_putlong (XDR *xdrs, int32_t *lp)
+{
+	(void) xdrs;
+	(void) lp;
+	return 0;
+}
+
+static int
+xdrmem_getbytes (XDR *xdrs, char *addr, unsigned int len)
+{
+	struct xdrmem_buffer *buffer = (struct xdrmem_buffer *) xdrs->x_private;
+
+	if (!buffer || len > buffer->size - buffer->pos)
+		return 0;
+	memcpy (addr, buffer->base + buffer->pos, len);
+	buffer->pos += len;
+	return 1;
+}
+
+static int
+xdrmem_putbytes (XDR *xdrs, char *addr, unsigned int len)
+{
+	(void) xdrs;
+	(void) addr;
+	(void) len;
+	return 0;
+}
+
+static unsigned int
+xdrmem_getpos (XDR *xdrs)
+{
+	struct xdrmem_buffer *buffer = (struct xdrmem_buffer *) xdrs->x_private;
+
+	return buffer ? buffer->pos : 0;
+}
+
+static int
+xdrmem_setpos (XDR *xdrs, unsigned int pos)
+{
+	struct xdrmem_buffer *buffer = (struct xdrmem_buffer *) xdrs->x_private;
+
+	if (!buffer || pos > buffer->size)
+		return 0;
+	buffer->pos = pos;
+	return 1;
+}
+
+
 #endif /* HAVE_RPC_XDR_H not defined */
@@ -123,6 +123,24 @@ extern "C"
 					 const char *    mode);
 
 
+	/*! \brief Open a buffer of portable binary data for reading
+	 *
+	 *  The returned handle reads from memory rather than a file, so data
+	 *  that has already been read, such as one frame of a trajectory, can
+	 *  be decoded on another thread. The buffer is not copied, and must
+	 *  outlive the handle. Close the handle with xdrfile_close().
+	 *
+	 *  \param data  Pointer to the data
+	 *  \param size  Size of the data in bytes
+	 *
+	 *  \return Pointer to abstract xdr file datatype, or NULL if an error occurs.
+	 *
+	 */
+	XDRFILE *
+	xdrfile_open_memory (const char *   data,
+						 unsigned int   size);
+
+
 	/*! \brief Close a previously opened portable binary file, just like fclose()
 	 *
 	 *  Use this routine much like calls to the standard library function